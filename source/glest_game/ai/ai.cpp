@@ -437,16 +437,14 @@ namespace
 		}
 
 		Ai::~Ai() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] deleting AI aiInterface [%p]\n",
 					__FILE__, __FUNCTION__, __LINE__,
 					aiInterface);
 			deleteValues(tasks.begin(), tasks.end());
 			tasks.clear();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] deleting AI aiInterface [%p]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -454,8 +452,7 @@ namespace
 
 			deleteValues(aiRules.begin(), aiRules.end());
 			aiRules.clear();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] deleting AI aiInterface [%p]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -478,12 +475,10 @@ namespace
 
 			Chrono
 				chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [START]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -550,8 +545,7 @@ namespace
 					(voteResult->allowSwitchTeam ? "Yes" : "No"),
 					allowJoinTeam, factionSwitchTeamRequestCountCurrent,
 					settings->getAiAcceptSwitchTeamPercentChance());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] %s\n", __FILE__,
 						__FUNCTION__, __LINE__, szBuf);
@@ -572,8 +566,7 @@ namespace
 						megaglest_runtime_error("rule == NULL");
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld [ruleIdx = %d]\n",
@@ -585,8 +578,7 @@ namespace
 					(rule->getTestInterval() * GameConstants::updateFps /
 						1000)) == 0) {
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld [ruleIdx = %d, before rule->test()]\n",
@@ -610,9 +602,7 @@ namespace
 							": Executing rule: " +
 							rule->getName() + '\n');
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugPerformance).
-							enabled && chrono.getMillis() > 0)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld [ruleIdx = %d, before rule->execute() [%s]]\n",
 								__FILE__, __FUNCTION__,
@@ -622,9 +612,7 @@ namespace
 						// Execute the rule.
 						rule->execute();
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugPerformance).
-							enabled && chrono.getMillis() > 0)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld [ruleIdx = %d, after rule->execute() [%s]]\n",
 								__FILE__, __FUNCTION__,
@@ -635,8 +623,7 @@ namespace
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [END]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1181,8 +1168,7 @@ namespace
 
 			if (aiInterface->getHomeLocation() != pos) {
 				if (findAbleUnit(&unit, ccAttack, false)) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -1403,8 +1389,7 @@ namespace
 				random.randRange(-villageRadius, villageRadius)) +
 				getRandomHomePosition();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -1446,12 +1431,10 @@ namespace
 			Ai::haveBlockedUnits() {
 			Chrono
 				chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [START]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1506,9 +1489,7 @@ namespace
 
 					if (unitImmediatelyBlocked) {
 						//printf("#1 AI unit IS BLOCKED [%d - %s]\n",u->getId(),u->getFullName().c_str());
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugPerformance).
-							enabled && chrono.getMillis() > 0)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld [START]\n",
 								__FILE__, __FUNCTION__,
@@ -1518,8 +1499,7 @@ namespace
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [START]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1596,12 +1576,10 @@ namespace
 			Ai::unblockUnits() {
 			Chrono
 				chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [START]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1657,8 +1635,7 @@ namespace
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [START]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1725,8 +1702,7 @@ namespace
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [START]\n",
 					__FILE__, __FUNCTION__, __LINE__,
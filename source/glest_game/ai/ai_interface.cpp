@@ -32,6 +32,8 @@
 #include "config.h"
 #include "network_manager.h"
 #include "platform_util.h"
+#include "simulation_benchmark.h"
+#include "profiler.h"
 #include "leak_dumper.h"
 
 using namespace
@@ -71,8 +73,7 @@ namespace
 
 		void
 			AiInterfaceThread::setQuitStatus(bool value) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d value = %d\n",
 					__FILE__, __FUNCTION__, __LINE__, value);
@@ -82,8 +83,7 @@ namespace
 				signal(-1);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -92,9 +92,7 @@ namespace
 		void
 			AiInterfaceThread::signal(int frameIndex) {
 			if (frameIndex >= 0) {
-				static string
-					mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutex(triggerIdMutex, mutexOwnerId);
 				this->frameIndex.first = frameIndex;
@@ -108,9 +106,7 @@ namespace
 		void
 			AiInterfaceThread::setTaskCompleted(int frameIndex) {
 			if (frameIndex >= 0) {
-				static string
-					mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutex(triggerIdMutex, mutexOwnerId);
 				if (this->frameIndex.first == frameIndex) {
@@ -138,8 +134,7 @@ namespace
 			if (getRunningStatus() == false) {
 				return true;
 			}
-			static string
-				mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper
 				safeMutex(triggerIdMutex, mutexOwnerId);
 			//bool result = (event != NULL ? event->eventCompleted : true);
@@ -158,7 +153,7 @@ namespace
 			if (this->aiIntf != NULL) {
 				MutexSafeWrapper
 					safeMutex(this->aiIntf->getMutex(),
-						string(__FILE__) + "_" + intToStr(__LINE__));
+						CODE_AT_LINE);
 				this->aiIntf = NULL;
 			}
 
@@ -170,8 +165,7 @@ namespace
 				runningStatus(this);
 			try {
 				//setRunningStatus(true);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -180,6 +174,11 @@ namespace
 					("In [%s::%s Line: %d] ****************** STARTING worker thread this = %p\n",
 						__FILE__, __FUNCTION__, __LINE__, this);
 
+				if (TraceProfiler::isEnabled() == true && this->aiIntf != NULL) {
+					TraceProfiler::setThreadName("AiInterfaceThread faction " +
+						intToStr(this->aiIntf->getFactionIndex()));
+				}
+
 				//bool minorDebugPerformance = false;
 				Chrono
 					chrono;
@@ -187,8 +186,7 @@ namespace
 				//unsigned int idx = 0;
 				for (; this->aiIntf != NULL;) {
 					if (getQuitStatus() == true) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								__FILE__, __FUNCTION__, __LINE__);
@@ -205,17 +203,14 @@ namespace
 							masterSlaveOwnerId);
 
 					if (getQuitStatus() == true) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								__FILE__, __FUNCTION__, __LINE__);
 						break;
 					}
 
-					static string
-						mutexOwnerId =
-						string(__FILE__) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					MutexSafeWrapper
 						safeMutex(triggerIdMutex, mutexOwnerId);
 					bool
@@ -231,7 +226,7 @@ namespace
 
 						MutexSafeWrapper
 							safeMutex(this->aiIntf->getMutex(),
-								string(__FILE__) + "_" + intToStr(__LINE__));
+								CODE_AT_LINE);
 
 						this->aiIntf->update();
 
@@ -241,8 +236,7 @@ namespace
 					}
 
 					if (getQuitStatus() == true) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								__FILE__, __FUNCTION__, __LINE__);
@@ -250,8 +244,7 @@ namespace
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -266,8 +259,7 @@ namespace
 					"In [%s::%s Line: %d] Error [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -275,8 +267,7 @@ namespace
 				throw
 					megaglest_runtime_error(ex.what());
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -285,8 +276,7 @@ namespace
 		AiInterface::AiInterface(Game & game, int factionIndex, int teamIndex,
 			int useStartLocation) :
 			fp(NULL) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -356,17 +346,13 @@ namespace
 					}
 					workerThread = NULL;
 				}
-				static string
-					mutexOwnerId =
-					string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-					string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				this->workerThread = new AiInterfaceThread(this);
 				this->workerThread->setUniqueID(mutexOwnerId);
 				this->workerThread->start();
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -389,8 +375,7 @@ namespace
 		}
 
 		AiInterface::~AiInterface() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] deleting AI factionIndex = %d, teamIndex = %d\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -439,6 +424,7 @@ namespace
 
 		void
 			AiInterface::update() {
+			SimulationBenchmarkTimer benchmarkTimer(sbsAI);
 			timer++;
 			ai.update();
 		}
@@ -457,7 +443,7 @@ namespace
 					logString = "(" + intToStr(factionIndex) + ") " + s;
 
 				MutexSafeWrapper
-					safeMutex(aiMutex, string(__FILE__) + "_" + intToStr(__LINE__));
+					safeMutex(aiMutex, CODE_AT_LINE);
 				//print log to file
 				if (fp != NULL) {
 					fprintf(fp, "%s\n", logString.c_str());
@@ -526,16 +512,14 @@ namespace
 						getUnit(unitIndex)->getType()->
 						getFirstCtOfClass(commandClass), pos);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 				result =
 					world->getFaction(factionIndex)->getUnit(unitIndex)->
 					giveCommand(c);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -598,8 +582,7 @@ namespace
 					unit->getDesc(false).c_str(),
 					unit->getFaction()->getIndex());
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 						szBuf);
 
@@ -618,8 +601,7 @@ namespace
 					NULL, unitGroupCommandId);
 				return result;
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -633,8 +615,7 @@ namespace
 				cmd->setUnitCommandGroupId(unitGroupCommandId);
 				result = unitToCommand->giveCommand(cmd);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -689,8 +670,7 @@ namespace
 					unit->getDesc(false).c_str(),
 					unit->getFaction()->getIndex());
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 						szBuf);
 
@@ -710,8 +690,7 @@ namespace
 						CardinalDir(CardinalDir::NORTH));
 				return result;
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -723,8 +702,7 @@ namespace
 					world->getFaction(factionIndex)->getUnit(unitIndex)->
 					giveCommand(cmd);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -779,8 +757,7 @@ namespace
 					unit->getDesc(false).c_str(),
 					unit->getFaction()->getIndex());
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 						szBuf);
 
@@ -799,8 +776,7 @@ namespace
 						CardinalDir(CardinalDir::NORTH));
 				return result;
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -811,8 +787,7 @@ namespace
 						Command(commandType, pos, ut,
 							CardinalDir(CardinalDir::NORTH)));
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -871,8 +846,7 @@ namespace
 					unit->getDesc(false).c_str(),
 					unit->getFaction()->getIndex());
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 						szBuf);
 
@@ -897,8 +871,7 @@ namespace
 
 				return result;
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -907,8 +880,7 @@ namespace
 					world->getFaction(factionIndex)->getUnit(unitIndex)->
 					giveCommand(new Command(commandType, u));
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -2011,10 +2011,7 @@ namespace
 												size
 												() -
 												1)];
-										if (SystemFlags::
-											getSystemSettingType(SystemFlags::
-												debugSystem).
-											enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 											SystemFlags::OutputDebug(SystemFlags::
 												debugSystem,
 												"In [%s::%s Line: %d]\n",
@@ -2052,9 +2049,7 @@ namespace
 											(commandIndex));
 									}
 								} else {   // do it like normal CPU
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::
-											debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::
 											debugSystem,
 											"In [%s::%s Line: %d]\n",
@@ -2076,10 +2071,7 @@ namespace
 												bestCommandTypeCount
 												- 1);
 
-										if (SystemFlags::
-											getSystemSettingType(SystemFlags::
-												debugSystem).
-											enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 											SystemFlags::OutputDebug(SystemFlags::
 												debugSystem,
 												"In [%s::%s Line: %d] bestCommandTypeIndex = %d, bestCommandTypeCount = %d\n",
@@ -2119,9 +2111,7 @@ namespace
 								}
 							} else {
 								if (currentCommandCount == 0) {
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::
-											debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::
 											debugSystem,
 											"In [%s::%s Line: %d]\n",
@@ -2144,10 +2134,7 @@ namespace
 												bestCommandTypeCount
 												- 1);
 
-										if (SystemFlags::
-											getSystemSettingType(SystemFlags::
-												debugSystem).
-											enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 											SystemFlags::OutputDebug(SystemFlags::
 												debugSystem,
 												"In [%s::%s Line: %d] bestCommandTypeIndex = %d, bestCommandTypeCount = %d\n",
@@ -2186,9 +2173,7 @@ namespace
 
 									aiInterface->giveCommand(bestIndex, defCt);
 								}
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::debugSystem).
-									enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::
 										debugSystem,
 										"In [%s::%s Line: %d]\n",
@@ -2208,9 +2193,7 @@ namespace
 											bestCommandTypeCount
 											- 1);
 
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::
-											debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::
 											debugSystem,
 											"In [%s::%s Line: %d] bestCommandTypeIndex = %d, bestCommandTypeCount = %d\n",
@@ -2268,9 +2251,7 @@ namespace
 									bestCommandTypeCount -
 									1);
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] bestCommandTypeIndex = %d, bestCommandTypeCount = %d\n",
 									__FILE__, __FUNCTION__,
@@ -2283,8 +2264,7 @@ namespace
 								[bestCommandTypeIndex];
 						}
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d] producers.size() = %d, producerIndex = %d, pIndex = %d, producersDefaultCommandType.size() = %d\n",
 								__FILE__, __FUNCTION__,
@@ -2848,9 +2828,7 @@ namespace
 									bestCommandTypeCount -
 									1);
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] bestCommandTypeIndex = %d, bestCommandTypeCount = %d\n",
 									__FILE__, __FUNCTION__,
@@ -2862,8 +2840,7 @@ namespace
 								buildersDefaultCommandType[builderIndex]
 								[bestCommandTypeIndex];
 						}
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d] builderIndex = %d, bIndex = %d, defBct = %p\n",
 								__FILE__, __FUNCTION__,
@@ -3123,9 +3100,7 @@ namespace
 							//if upgrades match
 							if (producedUpgrade == upgt->getUpgradeType()) {
 								if (aiInterface->reqsOk(uct)) {
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::
-											debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::
 											debugSystem,
 											"In [%s::%s Line: %d]\n",
@@ -11,6 +11,7 @@
 #include "path_finder.h"
 
 #include <algorithm>
+#include <stdarg.h>
 
 #include "config.h"
 #include "map.h"
@@ -20,6 +21,10 @@
 #include "command.h"
 #include "faction.h"
 #include "randomgen.h"
+#include "path_abstraction.h"
+#include "world.h"
+#include "simulation_benchmark.h"
+#include "game_settings.h"
 #include "leak_dumper.h"
 
 using namespace std;
@@ -58,9 +63,28 @@ namespace
 			PathFinder::pathFindExtendRefreshNodeCountMin = 40;
 		const int
 			PathFinder::pathFindExtendRefreshNodeCountMax = 40;
+		const int
+			PathFinder::hierarchicalSearchMinDistance =
+			PathAbstraction::clusterSize * 2;
+		const int
+			PathFinder::hierarchicalSearchMaxLeg =
+			PathAbstraction::clusterSize * 2;
+		const int
+			PathFinder::flowFieldGoalCellSize = 8;
+		const int
+			PathFinder::flowFieldCacheFrames = GameConstants::updateFps;
+		const int
+			PathFinder::flowFieldMaxCount = 8;
+		const int
+			PathFinder::flowFieldPathLength = 30;
+		const int
+			PathFinder::flowFieldWindowRadius = 64;
 
 		PathFinder::PathFinder() {
 			minorDebugPathfinder = false;
+			useFlatGridSearch = false;
+			useHierarchicalSearch = false;
+			useGroupFlowField = false;
 			map = NULL;
 		}
 
@@ -73,26 +97,46 @@ namespace
 
 		PathFinder::PathFinder(const Map * map) {
 			minorDebugPathfinder = false;
+			useFlatGridSearch = false;
+			useHierarchicalSearch = false;
+			useGroupFlowField = false;
 
 			map = NULL;
 			init(map);
 		}
 
 		void
-			PathFinder::init(const Map * map) {
+			PathFinder::init(const Map * map, const GameSettings * gameSettings) {
 			for (int factionIndex = 0; factionIndex < GameConstants::maxPlayers;
 				++factionIndex) {
 				FactionState & faction = factions.getFactionState(factionIndex);
 
 				faction.nodePool.resize(pathFindNodesAbsoluteMax);
 				faction.useMaxNodeCount = PathFinder::pathFindNodesMax;
+				faction.flowFields.clear();
 			}
 			this->map = map;
+
+			// Both search engines expand nodes in the same order so they
+			// produce identical paths, this only selects the data structures
+			useFlatGridSearch =
+				Config::getInstance().getBool("EnableFlatGridPathfinder", "false");
+			// These change the paths found, so every peer must agree on them and
+			// they come from the host's game settings and not the local config
+			useHierarchicalSearch = (gameSettings != NULL &&
+				isFlagType1BitEnabled(gameSettings->getFlagTypes1(),
+					ft1_hierarchical_pathfinder) == true);
+			useGroupFlowField = (gameSettings != NULL &&
+				isFlagType1BitEnabled(gameSettings->getFlagTypes1(),
+					ft1_group_flow_field_pathfinder) == true);
 		}
 
 		void
 			PathFinder::init() {
 			minorDebugPathfinder = false;
+			useFlatGridSearch = false;
+			useHierarchicalSearch = false;
+			useGroupFlowField = false;
 			map = NULL;
 		}
 
@@ -111,15 +155,16 @@ namespace
 			PathFinder::clearCaches() {
 			for (int factionIndex = 0; factionIndex < GameConstants::maxPlayers;
 				++factionIndex) {
-				static string
-					mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				FactionState & faction = factions.getFactionState(factionIndex);
 				MutexSafeWrapper
 					safeMutex(faction.getMutexPreCache(), mutexOwnerId);
 
 				faction.precachedTravelState.clear();
 				faction.precachedPath.clear();
+				for (unsigned int index = 0; index < faction.flowFields.size(); ++index) {
+					faction.flowFields[index].builtFrame = -1;
+				}
 			}
 		}
 
@@ -128,9 +173,7 @@ namespace
 			if (unit != NULL && factions.size() > unit->getFactionIndex()) {
 				int
 					factionIndex = unit->getFactionIndex();
-				static string
-					mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				FactionState & faction = factions.getFactionState(factionIndex);
 				MutexSafeWrapper
 					safeMutex(faction.getMutexPreCache(), mutexOwnerId);
@@ -145,9 +188,7 @@ namespace
 			if (unit != NULL && factions.size() > unit->getFactionIndex()) {
 				int
 					factionIndex = unit->getFactionIndex();
-				static string
-					mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				FactionState & faction = factions.getFactionState(factionIndex);
 				MutexSafeWrapper
 					safeMutex(faction.getMutexPreCache(), mutexOwnerId);
@@ -168,15 +209,14 @@ namespace
 				bool * wasStuck, int frameIndex) {
 			TravelState
 				ts = tsImpossible;
+			SimulationBenchmarkTimer benchmarkTimer(sbsPathfinding);
 
 			try {
 
 				int
 					factionIndex = unit->getFactionIndex();
 				FactionState & faction = factions.getFactionState(factionIndex);
-				static string
-					mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutexPrecache(faction.getMutexPreCache(), mutexOwnerId);
 
@@ -194,9 +234,7 @@ namespace
 				if (unit->getFaction()->canUnitsPathfind() == true) {
 					unit->getFaction()->addUnitToPathfindingList(unit->getId());
 				} else {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096, "canUnitsPathfind() == false");
@@ -207,8 +245,7 @@ namespace
 					return tsBlocked;
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char
 						szBuf[8096] = "";
 					snprintf(szBuf, 8096,
@@ -225,9 +262,7 @@ namespace
 						//if arrived
 						unit->setCurrSkill(scStop);
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugWorldSynch).
-							enabled == true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 							char
 								szBuf[8096] = "";
 							snprintf(szBuf, 8096,
@@ -240,9 +275,7 @@ namespace
 						}
 
 					}
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPathFinder).enabled ==
-						true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPathFinder) == true) {
 						string
 							commandDesc = "none";
 						Command *
@@ -275,14 +308,8 @@ namespace
 
 						if (map->canMove(unit, unit->getPos(), pos)) {
 							if (frameIndex < 0) {
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::
-										debugWorldSynch).enabled ==
-									true
-									&& SystemFlags::
-									getSystemSettingType(SystemFlags::
-										debugWorldSynchMax).
-									enabled == true) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+									&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 									char
 										szBuf[8096] = "";
 									snprintf(szBuf, 8096,
@@ -297,14 +324,8 @@ namespace
 
 								unit->setTargetPos(pos, frameIndex < 0);
 
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::
-										debugWorldSynch).enabled ==
-									true
-									&& SystemFlags::
-									getSystemSettingType(SystemFlags::
-										debugWorldSynchMax).
-									enabled == true) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+									&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 									char
 										szBuf[8096] = "";
 									snprintf(szBuf, 8096,
@@ -348,9 +369,7 @@ namespace
 					&& unit->
 					isLastStuckFrameWithinCurrentFrameTolerance(frameIndex >= 0) ==
 					true) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096,
@@ -372,9 +391,7 @@ namespace
 
 					maxNodeCount = PathFinder::pathFindNodesAbsoluteMax;
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096, "maxNodeCount: %d", maxNodeCount);
@@ -400,8 +417,7 @@ namespace
 						unit->getPos().getString().c_str(),
 						finalPos.getString().c_str(), frameIndex);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char
 						szBuf[8096] = "";
 					snprintf(szBuf, 8096, "calling aStar()");
@@ -409,8 +425,17 @@ namespace
 						c_str(), __LINE__, szBuf);
 				}
 
+				// long orders only search locally up to the next cluster entrance
+				Vec2i
+					searchPos = finalPos;
+				// group orders follow a shared flow field to the destination instead
+				if (useHierarchicalSearch == true &&
+					isGroupFlowFieldUnit(unit) == false) {
+					searchPos = computeHierarchicalWaypoint(unit, finalPos);
+				}
+
 				ts =
-					aStar(unit, finalPos, false, frameIndex, maxNodeCount,
+					aStar(unit, searchPos, false, frameIndex, maxNodeCount,
 						&searched_node_count);
 				//post actions
 				switch (ts) {
@@ -427,9 +452,7 @@ namespace
 									unit->getId(),
 									unit->getType()->getName(false).c_str(), frameIndex);
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugWorldSynch).
-								enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char
 									szBuf[8096] = "";
 								snprintf(szBuf, 8096,
@@ -489,9 +512,7 @@ namespace
 								//int tryRadius = faction.random.IRandomX(1,2);
 								//int tryRadius = 1;
 
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::debugWorldSynch).
-									enabled == true) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 									char
 										szBuf[8096] = "";
 									snprintf(szBuf, 8096,
@@ -524,10 +545,7 @@ namespace
 												map->canMove(unit, unit->getPos(),
 													newFinalPos);
 
-											if (SystemFlags::
-												getSystemSettingType(SystemFlags::
-													debugWorldSynch).
-												enabled == true && frameIndex < 0) {
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 												char
 													szBuf[8096] = "";
 												snprintf(szBuf, 8096,
@@ -547,10 +565,7 @@ namespace
 													maxBailoutNodeCount =
 													(PathFinder::pathFindBailoutRadius * 2);
 
-												if (SystemFlags::
-													getSystemSettingType(SystemFlags::
-														debugWorldSynch).
-													enabled == true && frameIndex < 0) {
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 													char
 														szBuf[8096] = "";
 													snprintf(szBuf, 8096,
@@ -586,10 +601,7 @@ namespace
 												map->canMove(unit, unit->getPos(),
 													newFinalPos);
 
-											if (SystemFlags::
-												getSystemSettingType(SystemFlags::
-													debugWorldSynch).
-												enabled == true && frameIndex < 0) {
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 												char
 													szBuf[8096] = "";
 												snprintf(szBuf, 8096,
@@ -608,10 +620,7 @@ namespace
 													maxBailoutNodeCount =
 													(PathFinder::pathFindBailoutRadius * 2);
 
-												if (SystemFlags::
-													getSystemSettingType(SystemFlags::
-														debugWorldSynch).
-													enabled == true && frameIndex < 0) {
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 													char
 														szBuf[8096] = "";
 													snprintf(szBuf, 8096,
@@ -684,9 +693,7 @@ namespace
 										(long long int) chrono.getMillis(), ts,
 										searched_node_count);
 
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::debugWorldSynch).
-									enabled == true && frameIndex < 0) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 									char
 										szBuf[8096] = "";
 									snprintf(szBuf, 8096, "tsBlocked");
@@ -754,8 +761,7 @@ namespace
 					"In [%s::%s Line: %d] Error [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -793,8 +799,7 @@ namespace
 					factionIndex = unit->getFactionIndex();
 				FactionState & faction = factions.getFactionState(factionIndex);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true && frameIndex >= 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex >= 0) {
 					char
 						szBuf[8096] = "";
 					snprintf(szBuf, 8096, "In aStar()");
@@ -803,8 +808,7 @@ namespace
 
 				Chrono
 					chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 					chrono.start();
 
 				if (map == NULL) {
@@ -834,6 +838,9 @@ namespace
 				faction.openNodesList.clear();
 				faction.openPosList.clear();
 				faction.closedNodesList.clear();
+				if (useFlatGridSearch == true) {
+					flatGridBeginSearch(faction);
+				}
 
 				// check the pre-cache to see if we can re-use a cached path
 				if (frameIndex < 0) {
@@ -932,10 +939,7 @@ namespace
 								}
 								unit->setUsePathfinderExtendedMaxNodes(false);
 
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::
-										debugWorldSynch).enabled ==
-									true) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 									char
 										szBuf[8096] = "";
 									snprintf(szBuf, 8096,
@@ -974,9 +978,7 @@ namespace
 				} else {
 					clearUnitPrecache(unit);
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096, "[clearUnitPrecache]");
@@ -995,8 +997,27 @@ namespace
 
 				faction.useMaxNodeCount = PathFinder::pathFindNodesMax;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled == true && chrono.getMillis() > 4)
+				// units of a command group share one search towards the goal block
+				if (inBailout == false && isGroupFlowFieldUnit(unit) == true) {
+					vector < Vec2i > flowPath;
+					if (computeFlowFieldPath(unit, finalPos, frameIndex, flowPath) ==
+						true && canUnitMoveSoon(unit, unitPos, flowPath[0]) == true) {
+						if (frameIndex >= 0) {
+							faction.precachedPath[unit->getId()] = flowPath;
+							faction.precachedTravelState[unit->getId()] = tsMoving;
+						} else {
+							unit->setUsePathfinderExtendedMaxNodes(false);
+							path->clear();
+							for (int i = 0; i < (int) flowPath.size() &&
+								i < unit->getPathFindRefreshCellCount(); ++i) {
+								path->add(flowPath[i]);
+							}
+						}
+						return tsMoving;
+					}
+				}
+
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 4)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -1018,12 +1039,17 @@ namespace
 				firstNode->pos = unitPos;
 				firstNode->heuristic = heuristic(unitPos, finalPos);
 				firstNode->exploredCell = true;
-				if (faction.openNodesList.find(firstNode->heuristic) ==
-					faction.openNodesList.end()) {
-					faction.openNodesList[firstNode->heuristic].clear();
+				if (useFlatGridSearch == true) {
+					flatGridPushOpenNode(faction, firstNode);
+					flatGridMarkVisitedPos(faction, firstNode->pos);
+				} else {
+					if (faction.openNodesList.find(firstNode->heuristic) ==
+						faction.openNodesList.end()) {
+						faction.openNodesList[firstNode->heuristic].clear();
+					}
+					faction.openNodesList[firstNode->heuristic].push_back(firstNode);
+					faction.openPosList[firstNode->pos] = true;
 				}
-				faction.openNodesList[firstNode->heuristic].push_back(firstNode);
-				faction.openPosList[firstNode->pos] = true;
 
 				//b) loop
 				bool
@@ -1033,8 +1059,7 @@ namespace
 				Node *
 					node = NULL;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled == true && chrono.getMillis() > 4)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 4)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -1066,9 +1091,7 @@ namespace
 					nodeLimitReached = (failureCount == cellCount);
 					pathFound = !nodeLimitReached;
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096,
@@ -1078,9 +1101,7 @@ namespace
 							c_str(), __LINE__, szBuf);
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPerformance).
-						enabled == true && chrono.getMillis() > 1)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 1)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] **Check if dest blocked, distance for unit [%d - %s] from [%s] to [%s] is %.2f took msecs: %lld nodeLimitReached = %d, failureCount = %d\n",
 							extractFileFromDirectoryPath
@@ -1115,9 +1136,7 @@ namespace
 						nodeLimitReached = (failureCount == cellCount);
 						pathFound = !nodeLimitReached;
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugWorldSynch).
-							enabled == true && frameIndex < 0) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 							char
 								szBuf[8096] = "";
 							snprintf(szBuf, 8096,
@@ -1128,9 +1147,7 @@ namespace
 									c_str(), __LINE__, szBuf);
 						}
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugPerformance).
-							enabled == true && chrono.getMillis() > 1)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 1)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] **Check if dest blocked, distance for unit [%d - %s] from [%s] to [%s] is %.2f took msecs: %lld nodeLimitReached = %d, failureCount = %d\n",
 								extractFileFromDirectoryPath
@@ -1146,9 +1163,7 @@ namespace
 								failureCount);
 					}
 				} else {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096,
@@ -1172,9 +1187,7 @@ namespace
 					whileLoopCount = 0;
 				if (nodeLimitReached == false) {
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096,
@@ -1186,10 +1199,16 @@ namespace
 							c_str(), __LINE__, szBuf);
 					}
 
-					doAStarPathSearch(nodeLimitReached, whileLoopCount,
-						unitFactionIndex, pathFound, node, finalPos,
-						closedNodes, cameFrom, canAddNode, unit,
-						maxNodeCount, frameIndex);
+					if (useFlatGridSearch == true) {
+						doFlatGridPathSearch(nodeLimitReached, whileLoopCount,
+							unitFactionIndex, pathFound, node, finalPos,
+							unit, maxNodeCount, frameIndex);
+					} else {
+						doAStarPathSearch(nodeLimitReached, whileLoopCount,
+							unitFactionIndex, pathFound, node, finalPos,
+							closedNodes, cameFrom, canAddNode, unit,
+							maxNodeCount, frameIndex);
+					}
 
 					if (searched_node_count != NULL) {
 						*searched_node_count = whileLoopCount;
@@ -1202,9 +1221,7 @@ namespace
 						unit->resetPathfindFailedConsecutiveFrameCount();
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096,
@@ -1226,9 +1243,7 @@ namespace
 								unit->setLastPathfindFailedPos(finalPos);
 							}
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugWorldSynch).
-								enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char
 									szBuf[8096] = "";
 								snprintf(szBuf, 8096, "calling aStar()");
@@ -1242,9 +1257,7 @@ namespace
 						}
 					}
 				} else {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char
 							szBuf[8096] = "";
 						snprintf(szBuf, 8096, "nodeLimitReached: %d",
@@ -1261,7 +1274,17 @@ namespace
 				//if consumed all nodes find best node (to avoid strange behaviour)
 				if (nodeLimitReached == true) {
 
-					if (faction.closedNodesList.empty() == false) {
+					if (useFlatGridSearch == true) {
+						if (faction.bestClosedNode != NULL) {
+							float
+								bestHeuristic =
+								truncateDecimal <
+								float >(faction.bestClosedNode->heuristic, 6);
+							if (lastNode != NULL && bestHeuristic < lastNode->heuristic) {
+								lastNode = faction.bestClosedNode;
+							}
+						}
+					} else if (faction.closedNodesList.empty() == false) {
 						float
 							bestHeuristic =
 							truncateDecimal <
@@ -1273,8 +1296,7 @@ namespace
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled == true && chrono.getMillis() > 4)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 4)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -1291,9 +1313,7 @@ namespace
 							whileLoopCount, frameIndex);
 
 					//blocked
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPathFinder).enabled ==
-						true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPathFinder) == true) {
 						string
 							commandDesc = "none";
 						Command *
@@ -1330,9 +1350,7 @@ namespace
 						path->incBlockCount();
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPerformance).
-						enabled == true && chrono.getMillis() > 4)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 4)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
@@ -1355,9 +1373,7 @@ namespace
 						currNode = currNode->prev;
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPerformance).
-						enabled == true && chrono.getMillis() > 4)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 4)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
@@ -1408,21 +1424,15 @@ namespace
 						}
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPerformance).
-						enabled == true && chrono.getMillis() > 4)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 4)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true
-						&& SystemFlags::getSystemSettingType(SystemFlags::
-							debugWorldSynchMax).
-						enabled == true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+						&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 						char
 							szBuf[8096] = "";
 
@@ -1465,9 +1475,7 @@ namespace
 						}
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPathFinder).enabled ==
-						true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPathFinder) == true) {
 						string
 							commandDesc = "none";
 						Command *
@@ -1488,9 +1496,7 @@ namespace
 						unit->setCurrentUnitTitle(szBuf);
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPerformance).
-						enabled == true && chrono.getMillis() > 4)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 4)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
@@ -1503,8 +1509,7 @@ namespace
 				faction.openPosList.clear();
 				faction.closedNodesList.clear();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled == true && chrono.getMillis() > 4)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true && chrono.getMillis() > 4)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -1524,8 +1529,7 @@ namespace
 							ts);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char
 						szBuf[8096] = "";
 					snprintf(szBuf, 8096, "return ts: %d", ts);
@@ -1539,8 +1543,7 @@ namespace
 					"In [%s::%s Line: %d] Error [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1560,6 +1563,256 @@ namespace
 			return ts;
 		}
 
+		// ==================== flat grid search engine ====================
+
+		void
+			PathFinder::flatGridBeginSearch(FactionState & faction) {
+			int
+				cellCount = map->getW() * map->getH();
+			if ((int) faction.visitedPosGeneration.size() != cellCount) {
+				faction.visitedPosGeneration.assign(cellCount, 0);
+				faction.searchGeneration = 0;
+			}
+
+			faction.searchGeneration++;
+			// on wrap around stale stamps could match again, so start over
+			if (faction.searchGeneration == 0) {
+				std::fill(faction.visitedPosGeneration.begin(),
+					faction.visitedPosGeneration.end(), 0);
+				faction.searchGeneration = 1;
+			}
+
+			faction.openHeap.clear();
+			faction.closedNodeCount = 0;
+			faction.bestClosedNode = NULL;
+		}
+
+		void
+			PathFinder::flatGridPushOpenNode(FactionState & faction, Node * node) {
+			int
+				nodeIndex = (int) (node - &faction.nodePool[0]);
+			std::vector < int >&heap = faction.openHeap;
+
+			int
+				childPos = (int) heap.size();
+			heap.push_back(nodeIndex);
+			while (childPos > 0) {
+				int
+					parentPos = (childPos - 1) / 2;
+				if (flatGridNodeLess(faction, nodeIndex, heap[parentPos]) == false) {
+					break;
+				}
+				heap[childPos] = heap[parentPos];
+				childPos = parentPos;
+			}
+			heap[childPos] = nodeIndex;
+		}
+
+		PathFinder::Node * PathFinder::flatGridPopOpenNode(FactionState & faction) {
+			std::vector < int >&heap = faction.openHeap;
+			if (heap.empty() == true) {
+				throw
+					megaglest_runtime_error("openHeap.empty() == true");
+			}
+
+			int
+				result = heap[0];
+			int
+				lastIndex = heap.back();
+			heap.pop_back();
+
+			int
+				heapSize = (int) heap.size();
+			if (heapSize > 0) {
+				int
+					parentPos = 0;
+				for (;;) {
+					int
+						childPos = parentPos * 2 + 1;
+					if (childPos >= heapSize) {
+						break;
+					}
+					if (childPos + 1 < heapSize &&
+						flatGridNodeLess(faction, heap[childPos + 1],
+							heap[childPos]) == true) {
+						childPos++;
+					}
+					if (flatGridNodeLess(faction, heap[childPos], lastIndex) == false) {
+						break;
+					}
+					heap[parentPos] = heap[childPos];
+					parentPos = childPos;
+				}
+				heap[parentPos] = lastIndex;
+			}
+			return &faction.nodePool[result];
+		}
+
+		void
+			PathFinder::flatGridCloseNode(FactionState & faction, Node * node) {
+			// keep the first closed node with the lowest heuristic, the same
+			// node closedNodesList.begin()->second.front() would return
+			if (faction.bestClosedNode == NULL ||
+				node->heuristic < faction.bestClosedNode->heuristic) {
+				faction.bestClosedNode = node;
+			}
+			faction.closedNodeCount++;
+		}
+
+		void
+			PathFinder::logSynchNodeData(Unit * unit, bool threaded,
+				const char *file, int line, const char *format, ...) {
+			char
+				szBuf[8096] = "";
+			va_list
+				argList;
+			va_start(argList, format);
+			vsnprintf(szBuf, 8096, format, argList);
+			va_end(argList);
+
+			if (threaded == true) {
+				unit->logSynchDataThreaded(file, line, szBuf);
+			} else {
+				unit->logSynchData(file, line, szBuf);
+			}
+		}
+
+		bool
+			PathFinder::processNodeFlatGrid(Unit * unit, Node * node,
+				const Vec2i finalPos, int x, int y,
+				bool & nodeLimitReached, int maxNodeCount) {
+			bool
+				result = false;
+			Vec2i
+				sucPos = node->pos + Vec2i(x, y);
+
+			int
+				unitFactionIndex = unit->getFactionIndex();
+			FactionState & faction = factions.getFactionState(unitFactionIndex);
+
+			bool
+				foundOpenPosForPos = flatGridIsVisitedPos(faction, sucPos);
+			bool
+				allowUnitMoveSoon = (foundOpenPosForPos == false &&
+					canUnitMoveSoon(unit, node->pos, sucPos));
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+				&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+				logSynchNodeData(unit, Thread::isCurrentThreadMainThread() == false,
+					__FILE__, __LINE__,
+					"In processNodeFlatGrid() nodeLimitReached %d unitFactionIndex %d foundOpenPosForPos %d allowUnitMoveSoon %d maxNodeCount %d node->pos = %s finalPos = %s sucPos = %s faction.openHeap.size() %lu closedNodeCount %d",
+					nodeLimitReached, unitFactionIndex, foundOpenPosForPos,
+					allowUnitMoveSoon, maxNodeCount,
+					node->pos.getString().c_str(),
+					finalPos.getString().c_str(),
+					sucPos.getString().c_str(),
+					(unsigned long) faction.openHeap.size(),
+					faction.closedNodeCount);
+			}
+
+			if (allowUnitMoveSoon == true) {
+				//if node is not open and canMove then generate another node
+				Node *
+					sucNode = newNode(faction, maxNodeCount);
+				if (sucNode != NULL) {
+					sucNode->pos = sucPos;
+					sucNode->heuristic = heuristic(sucNode->pos, finalPos);
+					sucNode->prev = node;
+					sucNode->next = NULL;
+					sucNode->exploredCell =
+						map->getSurfaceCell(Map::toSurfCoords(sucPos))->
+						isExplored(unit->getTeam());
+					flatGridPushOpenNode(faction, sucNode);
+					flatGridMarkVisitedPos(faction, sucNode->pos);
+
+					result = true;
+				} else {
+					nodeLimitReached = true;
+				}
+			}
+
+			return result;
+		}
+
+		void
+			PathFinder::doFlatGridPathSearch(bool & nodeLimitReached,
+				int &whileLoopCount, int unitFactionIndex,
+				bool & pathFound, Node * &node,
+				const Vec2i & finalPos, Unit * unit,
+				int maxNodeCount, int curFrameIndex) {
+
+			FactionState & faction = factions.getFactionState(unitFactionIndex);
+
+			while (nodeLimitReached == false) {
+				whileLoopCount++;
+				if (faction.openHeap.empty() == true) {
+					pathFound = false;
+					break;
+				}
+				node = flatGridPopOpenNode(faction);
+
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+					&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+					logSynchNodeData(unit, curFrameIndex >= 0,
+						__FILE__, __LINE__,
+						"In doFlatGridPathSearch() nodeLimitReached %d whileLoopCount %d unitFactionIndex %d pathFound %d maxNodeCount %d node->pos = %s finalPos = %s node->exploredCell = %d",
+						nodeLimitReached, whileLoopCount, unitFactionIndex,
+						pathFound, maxNodeCount,
+						node->pos.getString().c_str(),
+						finalPos.getString().c_str(), node->exploredCell);
+				}
+
+				if (node->pos == finalPos || node->exploredCell == false) {
+					pathFound = true;
+					break;
+				}
+
+				flatGridCloseNode(faction, node);
+
+				// must consume the faction random exactly like doAStarPathSearch
+				// so both engines stay in synch
+				int
+					tryDirection = faction.random.randRange(1, 4);
+				if (tryDirection == 4) {
+					for (int i = 1; i >= -1 && nodeLimitReached == false; --i) {
+						for (int j = -1; j <= 1 && nodeLimitReached == false; ++j) {
+							processNodeFlatGrid(unit, node, finalPos, i, j,
+								nodeLimitReached, maxNodeCount);
+						}
+					}
+				} else if (tryDirection == 3) {
+					for (int i = -1; i <= 1 && nodeLimitReached == false; ++i) {
+						for (int j = 1; j >= -1 && nodeLimitReached == false; --j) {
+							processNodeFlatGrid(unit, node, finalPos, i, j,
+								nodeLimitReached, maxNodeCount);
+						}
+					}
+				} else if (tryDirection == 2) {
+					for (int i = -1; i <= 1 && nodeLimitReached == false; ++i) {
+						for (int j = -1; j <= 1 && nodeLimitReached == false; ++j) {
+							processNodeFlatGrid(unit, node, finalPos, i, j,
+								nodeLimitReached, maxNodeCount);
+						}
+					}
+				} else {
+					for (int i = 1; i >= -1 && nodeLimitReached == false; --i) {
+						for (int j = 1; j >= -1 && nodeLimitReached == false; --j) {
+							processNodeFlatGrid(unit, node, finalPos, i, j,
+								nodeLimitReached, maxNodeCount);
+						}
+					}
+				}
+			}
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+				&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+				logSynchNodeData(unit, curFrameIndex >= 0,
+					__FILE__, __LINE__,
+					"In doFlatGridPathSearch() nodeLimitReached %d whileLoopCount %d unitFactionIndex %d pathFound %d maxNodeCount %d",
+					nodeLimitReached, whileLoopCount, unitFactionIndex,
+					pathFound, maxNodeCount);
+			}
+		}
+
 		void
 			PathFinder::processNearestFreePos(const Vec2i & finalPos, int i, int j,
 				int size, Field field, int teamIndex,
@@ -1592,8 +1845,7 @@ namespace
 					"In [%s::%s Line: %d] Error [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1659,8 +1911,7 @@ namespace
 					"In [%s::%s Line: %d] Error [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1680,6 +1931,324 @@ namespace
 			return nearestPos;
 		}
 
+		Vec2i
+			PathFinder::computeHierarchicalWaypoint(Unit * unit,
+				const Vec2i & finalPos) {
+			// multi cell units are not modelled by the abstract graph
+			if (unit->getType()->getSize() != 1) {
+				return finalPos;
+			}
+
+			const Vec2i
+				unitPos = unit->getPos();
+			if (abs(finalPos.x - unitPos.x) <= hierarchicalSearchMinDistance &&
+				abs(finalPos.y - unitPos.y) <= hierarchicalSearchMinDistance) {
+				return finalPos;
+			}
+
+			FactionState & faction =
+				factions.getFactionState(unit->getFactionIndex());
+			vector < Vec2i > waypoints;
+			if (map->getPathAbstraction()->findAbstractPath(unit->getCurrField(),
+				unitPos, finalPos,
+				waypoints, faction.abstractSearch) == false) {
+				return finalPos;
+			}
+
+			// aim for the furthest waypoint still in reach of a local search
+			Vec2i
+				result = waypoints[0];
+			for (unsigned int index = 0; index < waypoints.size(); ++index) {
+				const Vec2i & waypoint = waypoints[index];
+				if (abs(waypoint.x - unitPos.x) > hierarchicalSearchMaxLeg ||
+					abs(waypoint.y - unitPos.y) > hierarchicalSearchMaxLeg) {
+					break;
+				}
+				result = waypoint;
+			}
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+				&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+				char
+					szBuf[8096] = "";
+				snprintf(szBuf, 8096,
+					"In computeHierarchicalWaypoint() finalPos = %s waypoints %lu result = %s",
+					finalPos.getString().c_str(),
+					(unsigned long) waypoints.size(),
+					result.getString().c_str());
+				if (Thread::isCurrentThreadMainThread() == false) {
+					unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
+				} else {
+					unit->logSynchData(__FILE__, __LINE__, szBuf);
+				}
+			}
+
+			return result;
+		}
+
+		bool
+			PathFinder::isGroupFlowFieldUnit(const Unit * unit) const {
+			if (useGroupFlowField == false) {
+				return false;
+			}
+			const Command *
+				command = unit->getCurrCommand();
+			return (command != NULL && command->getUnitCommandGroupId() >= 0);
+		}
+
+		// same rules as the abstract graph: only terrain, objects and buildings
+		// count, moving units are left to the per step canMove checks
+		bool
+			PathFinder::flowFieldIsWalkable(int x, int y, Field field,
+				int size) const {
+			for (int i = x; i < x + size; ++i) {
+				for (int j = y; j < y + size; ++j) {
+					if (map->isInside(i, j) == false) {
+						return false;
+					}
+					Vec2i
+						pos(i, j);
+					Vec2i
+						surfPos = Map::toSurfCoords(pos);
+					if (map->isInsideSurface(surfPos) == false) {
+						return false;
+					}
+
+					const Cell *
+						cell = map->getCell(pos);
+					if (field == fLand) {
+						if (map->getSurfaceCell(surfPos)->isFree() == false ||
+							map->getDeepSubmerged(cell) == true) {
+							return false;
+						}
+					}
+					const Unit *
+						cellUnit = cell->getUnit(field);
+					if (cellUnit != NULL && cellUnit->getType()->isMobile() == false) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		PathFinder::FlowField &
+			PathFinder::getGroupFlowField(FactionState & faction,
+				const Vec2i & goalCell, Field field, int unitSize, int frame) {
+			if ((int) faction.flowFields.size() != flowFieldMaxCount) {
+				faction.flowFields.resize(flowFieldMaxCount);
+			}
+
+			// a live field for the goal, else an unused or expired slot,
+			// else the oldest one
+			int
+				reuseIndex = -1;
+			for (int index = 0; index < flowFieldMaxCount; ++index) {
+				FlowField & flowField = faction.flowFields[index];
+				if (flowField.builtFrame < 0 || frame < flowField.builtFrame ||
+					frame >= flowField.builtFrame + flowFieldCacheFrames) {
+					flowField.builtFrame = -1;
+				} else if (flowField.goalCell == goalCell &&
+					flowField.field == field && flowField.unitSize == unitSize) {
+					return flowField;
+				}
+				if (reuseIndex < 0 || flowField.builtFrame <
+					faction.flowFields[reuseIndex].builtFrame) {
+					reuseIndex = index;
+				}
+			}
+
+			FlowField & flowField = faction.flowFields[reuseIndex];
+			flowField.goalCell = goalCell;
+			flowField.field = field;
+			flowField.unitSize = unitSize;
+			flowField.builtFrame = frame;
+
+			const int
+				w = map->getW();
+			const int
+				h = map->getH();
+			const int
+				x0 = goalCell.x * flowFieldGoalCellSize;
+			const int
+				y0 = goalCell.y * flowFieldGoalCellSize;
+			flowField.windowX = max(x0 - flowFieldWindowRadius, 0);
+			flowField.windowY = max(y0 - flowFieldWindowRadius, 0);
+			flowField.windowW = min(x0 + flowFieldGoalCellSize + flowFieldWindowRadius, w) - flowField.windowX;
+			flowField.windowH = min(y0 + flowFieldGoalCellSize + flowFieldWindowRadius, h) - flowField.windowY;
+
+			const int
+				cellCount = max(flowField.windowW, 0) * max(flowField.windowH, 0);
+			if ((int) flowField.cellGeneration.size() < cellCount) {
+				flowField.generation = 0;
+				flowField.cellGeneration.assign(cellCount, 0);
+				flowField.cost.resize(cellCount);
+				flowField.next.resize(cellCount);
+				flowField.settled.resize(cellCount);
+			}
+			flowField.generation++;
+			if (flowField.generation == 0) {
+				std::fill(flowField.cellGeneration.begin(),
+					flowField.cellGeneration.end(), 0);
+				flowField.generation = 1;
+			}
+			flowField.openHeap.clear();
+
+			// every walkable cell of the goal block is a source
+			for (int y = y0; y < y0 + flowFieldGoalCellSize && y < h; ++y) {
+				for (int x = x0; x < x0 + flowFieldGoalCellSize && x < w; ++x) {
+					if (flowFieldIsWalkable(x, y, field, unitSize) == true) {
+						int
+							cellIndex = flowField.getCellIndex(x, y);
+						flowField.cellGeneration[cellIndex] = flowField.generation;
+						flowField.cost[cellIndex] = 0;
+						flowField.next[cellIndex] = -1;
+						flowField.settled[cellIndex] = 0;
+						flowField.openHeap.push_back(make_pair(0, cellIndex));
+					}
+				}
+			}
+			std::make_heap(flowField.openHeap.begin(), flowField.openHeap.end(),
+				std::greater < pair < int, int > >());
+
+			return flowField;
+		}
+
+		// Runs the goal rooted Dijkstra until cellIndex is settled. Cells come
+		// out in (cost, index) order, so pausing and resuming the search gives
+		// the same field no matter which unit of the group asked first.
+		bool
+			PathFinder::expandFlowField(FlowField & flowField, int cellIndex) {
+			while ((flowField.isCellStamped(cellIndex) == false ||
+				flowField.settled[cellIndex] == 0) &&
+				flowField.openHeap.empty() == false) {
+				std::pop_heap(flowField.openHeap.begin(),
+					flowField.openHeap.end(),
+					std::greater < pair < int, int > >());
+				pair < int, int >
+					current = flowField.openHeap.back();
+				flowField.openHeap.pop_back();
+				if (flowField.settled[current.second] != 0 ||
+					current.first != flowField.cost[current.second]) {
+					//stale heap entry
+					continue;
+				}
+				flowField.settled[current.second] = 1;
+
+				Vec2i
+					currentPos = flowField.getCellPos(current.second);
+				int
+					x = currentPos.x;
+				int
+					y = currentPos.y;
+				for (int i = -1; i <= 1; ++i) {
+					for (int j = -1; j <= 1; ++j) {
+						int
+							nx = x + i;
+						int
+							ny = y + j;
+						if (i == 0 && j == 0) {
+							continue;
+						}
+						if (flowField.isInsideWindow(nx, ny) == false ||
+							flowFieldIsWalkable(nx, ny, flowField.field,
+							flowField.unitSize) == false) {
+							continue;
+						}
+						if (i != 0 && j != 0 &&
+							(flowFieldIsWalkable(x, ny, flowField.field,
+								flowField.unitSize) == false
+								|| flowFieldIsWalkable(nx, y, flowField.field,
+									flowField.unitSize) == false)) {
+							continue;
+						}
+
+						int
+							nextIndex = flowField.getCellIndex(nx, ny);
+						int
+							cost = current.first + (i != 0 && j != 0 ?
+								PathAbstraction::diagonalCost :
+								PathAbstraction::straightCost);
+						if (flowField.isCellStamped(nextIndex) == false) {
+							flowField.cellGeneration[nextIndex] = flowField.generation;
+							flowField.cost[nextIndex] = -1;
+							flowField.settled[nextIndex] = 0;
+						}
+						if (flowField.settled[nextIndex] == 0 &&
+							(flowField.cost[nextIndex] < 0
+								|| cost < flowField.cost[nextIndex])) {
+							flowField.cost[nextIndex] = cost;
+							flowField.next[nextIndex] = current.second;
+							flowField.openHeap.push_back(make_pair(cost, nextIndex));
+							std::push_heap(flowField.openHeap.begin(),
+								flowField.openHeap.end(),
+								std::greater < pair < int, int > >());
+						}
+					}
+				}
+			}
+			return (flowField.isCellStamped(cellIndex) == true &&
+				flowField.settled[cellIndex] != 0);
+		}
+
+		bool
+			PathFinder::computeFlowFieldPath(Unit * unit, const Vec2i & finalPos,
+				int frameIndex, vector < Vec2i > &steps) {
+			steps.clear();
+
+			// the last stretch to each unit's own slot is a normal search
+			const Vec2i
+				unitPos = unit->getPos();
+			if (abs(finalPos.x - unitPos.x) <= flowFieldGoalCellSize &&
+				abs(finalPos.y - unitPos.y) <= flowFieldGoalCellSize) {
+				return false;
+			}
+
+			int
+				frame = frameIndex;
+			if (frame < 0) {
+				frame = unit->getFaction()->getWorld()->getFrameCount();
+			}
+
+			FactionState & faction =
+				factions.getFactionState(unit->getFactionIndex());
+			FlowField & flowField =
+				getGroupFlowField(faction,
+					Vec2i(finalPos.x / flowFieldGoalCellSize,
+						finalPos.y / flowFieldGoalCellSize),
+					unit->getCurrField(), unit->getType()->getSize(), frame);
+
+			// units beyond the window take the normal search
+			if (flowField.isInsideWindow(unitPos.x, unitPos.y) == true) {
+				int
+					cellIndex = flowField.getCellIndex(unitPos.x, unitPos.y);
+				if (expandFlowField(flowField, cellIndex) == true) {
+					for (int nextIndex = flowField.next[cellIndex];
+						nextIndex >= 0 && (int) steps.size() < flowFieldPathLength;
+						nextIndex = flowField.next[nextIndex]) {
+						steps.push_back(flowField.getCellPos(nextIndex));
+					}
+				}
+			}
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+				&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+				char
+					szBuf[8096] = "";
+				snprintf(szBuf, 8096,
+					"In computeFlowFieldPath() finalPos = %s built frame %d steps %lu",
+					finalPos.getString().c_str(), flowField.builtFrame,
+					(unsigned long) steps.size());
+				if (Thread::isCurrentThreadMainThread() == false) {
+					unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
+				} else {
+					unit->logSynchData(__FILE__, __LINE__, szBuf);
+				}
+			}
+
+			return steps.empty() == false;
+		}
+
 		int
 			PathFinder::findNodeIndex(Node * node, Nodes & nodeList) {
 			int
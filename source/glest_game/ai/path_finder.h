@@ -24,6 +24,7 @@
 #   include "skill_type.h"
 #   include "map.h"
 #   include "unit.h"
+#   include "path_abstraction.h"
 //#include "randomc.h"
 #   include "leak_dumper.h"
 
@@ -37,6 +38,8 @@ namespace
 	namespace
 		Game {
 
+		class GameSettings;
+
 		// =====================================================
 		//      class PathFinder
 		//
@@ -119,6 +122,76 @@ namespace
 				Node * >
 				Nodes;
 
+			// integration field (cost to the goal block) and direction field
+			// (next cell towards it) shared by the units of a command group,
+			// expanded lazily so only the cells the group asks for are searched.
+			// It covers a window around the goal block, cell indexes are
+			// relative to that window and stamped per build so the buffers
+			// are reused without clearing them.
+			class
+				FlowField {
+			public:
+				FlowField() {
+					goalCell = Vec2i(-1, -1);
+					field = fLand;
+					unitSize = -1;
+					builtFrame = -1;
+					windowX = 0;
+					windowY = 0;
+					windowW = 0;
+					windowH = 0;
+					generation = 0;
+				}
+				Vec2i
+					goalCell;
+				Field
+					field;
+				int
+					unitSize;
+				// -1 while the slot is unused
+				int
+					builtFrame;
+				int
+					windowX;
+				int
+					windowY;
+				int
+					windowW;
+				int
+					windowH;
+				uint32
+					generation;
+				std::vector < uint32 >
+					cellGeneration;
+				std::vector < int >
+					cost;
+				std::vector < int >
+					next;
+				std::vector < char >
+					settled;
+				std::vector < std::pair < int, int > >
+					openHeap;
+
+				inline bool
+					isInsideWindow(int x, int y) const {
+					return (x >= windowX && y >= windowY &&
+						x < windowX + windowW && y < windowY + windowH);
+				}
+				inline int
+					getCellIndex(int x, int y) const {
+					return (y - windowY) * windowW + (x - windowX);
+				}
+				inline Vec2i
+					getCellPos(int cellIndex) const {
+					return Vec2i(windowX + cellIndex % windowW,
+						windowY + cellIndex / windowW);
+				}
+				inline bool
+					isCellStamped(int cellIndex) const {
+					return cellGeneration[cellIndex] == generation;
+				}
+			};
+
 			class
 				FactionState {
 			protected:
@@ -146,6 +219,12 @@ namespace
 						clear();
 					precachedPath.
 						clear();
+
+					openHeap.clear();
+					visitedPosGeneration.clear();
+					searchGeneration = 0;
+					closedNodeCount = 0;
+					bestClosedNode = NULL;
 				}
 				~
 					FactionState() {
@@ -185,6 +264,23 @@ namespace
 					std::vector <
 					Vec2i > >
 					precachedPath;
+
+				// flat grid search engine state: a binary heap of nodePool
+				// indexes and a per cell stamp of the search that visited it
+				std::vector < int > openHeap;
+				std::vector < uint32 > visitedPosGeneration;
+				uint32
+					searchGeneration;
+				int
+					closedNodeCount;
+				Node *
+					bestClosedNode;
+
+				// group flow field slots, their buffers are kept between builds
+				std::vector < FlowField > flowFields;
+
+				// scratch of this faction's hierarchical searches
+				PathAbstraction::SearchState abstractSearch;
 			};
 
 			class
@@ -245,6 +341,20 @@ namespace
 				pathFindExtendRefreshNodeCountMin;
 			static const int
 				pathFindExtendRefreshNodeCountMax;
+			static const int
+				hierarchicalSearchMinDistance;
+			static const int
+				hierarchicalSearchMaxLeg;
+			static const int
+				flowFieldGoalCellSize;
+			static const int
+				flowFieldCacheFrames;
+			static const int
+				flowFieldMaxCount;
+			static const int
+				flowFieldPathLength;
+			static const int
+				flowFieldWindowRadius;
 
 		private:
 
@@ -260,6 +370,12 @@ namespace
 				map;
 			bool
 				minorDebugPathfinder;
+			bool
+				useFlatGridSearch;
+			bool
+				useHierarchicalSearch;
+			bool
+				useGroupFlowField;
 
 		public:
 			PathFinder();
@@ -279,7 +395,7 @@ namespace
 			}
 
 			void
-				init(const Map * map);
+				init(const Map * map, const GameSettings * gameSettings = NULL);
 			TravelState
 				findPath(Unit * unit, const Vec2i & finalPos, bool * wasStuck =
 					NULL, int frameIndex = -1);
@@ -325,6 +441,21 @@ namespace
 
 			Vec2i
 				computeNearestFreePos(const Unit * unit, const Vec2i & targetPos);
+			Vec2i
+				computeHierarchicalWaypoint(Unit * unit, const Vec2i & finalPos);
+
+			bool
+				isGroupFlowFieldUnit(const Unit * unit) const;
+			bool
+				flowFieldIsWalkable(int x, int y, Field field, int size) const;
+			FlowField &
+				getGroupFlowField(FactionState & faction, const Vec2i & goalCell,
+					Field field, int unitSize, int frame);
+			bool
+				expandFlowField(FlowField & flowField, int cellIndex);
+			bool
+				computeFlowFieldPath(Unit * unit, const Vec2i & finalPos,
+					int frameIndex, vector < Vec2i > &steps);
 
 			inline static float
 				heuristic(const Vec2i & pos, const Vec2i & finalPos) {
@@ -357,6 +488,12 @@ namespace
 				return result;
 			}
 
+			// writes a synch log entry of unit, kept out of line so the node
+			// loops do not carry its format buffer
+			static void
+				logSynchNodeData(Unit * unit, bool threaded, const char *file,
+					int line, const char *format, ...);
+
 			inline bool
 				processNode(Unit * unit, Node * node, const Vec2i finalPos,
 					int x, int y, bool & nodeLimitReached, int maxNodeCount) {
@@ -373,14 +510,10 @@ namespace
 					foundOpenPosForPos = openPos(sucPos, faction);
 				bool
 					allowUnitMoveSoon = canUnitMoveSoon(unit, node->pos, sucPos);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true
-					&& SystemFlags::getSystemSettingType(SystemFlags::
-						debugWorldSynchMax).
-					enabled == true) {
-					char
-						szBuf[8096] = "";
-					snprintf(szBuf, 8096,
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+					&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+					logSynchNodeData(unit, Thread::isCurrentThreadMainThread() == false,
+						__FILE__, __LINE__,
 						"In processNode() nodeLimitReached %d unitFactionIndex %d foundOpenPosForPos %d allowUnitMoveSoon %d maxNodeCount %d node->pos = %s finalPos = %s sucPos = %s faction.openPosList.size() %lu closedNodesList.size() %lu",
 						nodeLimitReached, unitFactionIndex, foundOpenPosForPos,
 						allowUnitMoveSoon, maxNodeCount,
@@ -389,12 +522,6 @@ namespace
 						sucPos.getString().c_str(),
 						faction.openPosList.size(),
 						faction.closedNodesList.size());
-
-					if (Thread::isCurrentThreadMainThread() == false) {
-						unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
-					} else {
-						unit->logSynchData(__FILE__, __LINE__, szBuf);
-					}
 				}
 
 				if (foundOpenPosForPos == false && allowUnitMoveSoon) {
@@ -418,23 +545,11 @@ namespace
 
 						result = true;
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugWorldSynch).
-							enabled == true
-							&& SystemFlags::getSystemSettingType(SystemFlags::
-								debugWorldSynchMax).
-							enabled == true) {
-							char
-								szBuf[8096] = "";
-							snprintf(szBuf, 8096, "In processNode() sucPos = %s",
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+							&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+							logSynchNodeData(unit, Thread::isCurrentThreadMainThread() == false,
+								__FILE__, __LINE__, "In processNode() sucPos = %s",
 								sucPos.getString().c_str());
-
-							if (Thread::isCurrentThreadMainThread() == false) {
-								unit->logSynchDataThreaded(__FILE__, __LINE__,
-									szBuf);
-							} else {
-								unit->logSynchData(__FILE__, __LINE__, szBuf);
-							}
 						}
 
 					} else {
@@ -452,6 +567,52 @@ namespace
 			int
 				getPathFindExtendRefreshNodeCount(FactionState & faction);
 
+			void
+				flatGridBeginSearch(FactionState & faction);
+			void
+				flatGridPushOpenNode(FactionState & faction, Node * node);
+			Node *
+				flatGridPopOpenNode(FactionState & faction);
+			void
+				flatGridCloseNode(FactionState & faction, Node * node);
+			bool
+				processNodeFlatGrid(Unit * unit, Node * node, const Vec2i finalPos,
+					int x, int y, bool & nodeLimitReached, int maxNodeCount);
+			void
+				doFlatGridPathSearch(bool & nodeLimitReached, int &whileLoopCount,
+					int unitFactionIndex, bool & pathFound, Node * &node,
+					const Vec2i & finalPos, Unit * unit, int maxNodeCount,
+					int curFrameIndex);
+
+			inline bool
+				flatGridIsVisitedPos(const FactionState & faction,
+					const Vec2i & pos) const {
+				if (map->isInside(pos) == false) {
+					return false;
+				}
+				return faction.visitedPosGeneration[pos.y * map->getW() + pos.x] ==
+					faction.searchGeneration;
+			}
+			inline void
+				flatGridMarkVisitedPos(FactionState & faction, const Vec2i & pos) {
+				faction.visitedPosGeneration[pos.y * map->getW() + pos.x] =
+					faction.searchGeneration;
+			}
+			// orders the open heap exactly like openNodesList: lowest heuristic
+			// first and ties in creation order, which is the nodePool index
+			inline static bool
+				flatGridNodeLess(const FactionState & faction, int nodeIndex1,
+					int nodeIndex2) {
+				float
+					heuristic1 = faction.nodePool[nodeIndex1].heuristic;
+				float
+					heuristic2 = faction.nodePool[nodeIndex2].heuristic;
+				if (heuristic1 != heuristic2) {
+					return heuristic1 < heuristic2;
+				}
+				return nodeIndex1 < nodeIndex2;
+			}
+
 			inline bool
 				canUnitMoveSoon(Unit * unit, const Vec2i & pos1, const Vec2i & pos2) {
 				bool
@@ -469,23 +630,13 @@ namespace
 					bool > &canAddNode, Unit * &unit, int &maxNodeCount,
 					int curFrameIndex) {
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true
-					&& SystemFlags::getSystemSettingType(SystemFlags::
-						debugWorldSynchMax).
-					enabled == true) {
-					char
-						szBuf[8096] = "";
-					snprintf(szBuf, 8096,
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+					&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+					logSynchNodeData(unit, curFrameIndex >= 0,
+						__FILE__, __LINE__,
 						"In doAStarPathSearch() nodeLimitReached %d whileLoopCount %d unitFactionIndex %d pathFound %d maxNodeCount %d",
 						nodeLimitReached, whileLoopCount, unitFactionIndex,
 						pathFound, maxNodeCount);
-
-					if (curFrameIndex >= 0) {
-						unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
-					} else {
-						unit->logSynchData(__FILE__, __LINE__, szBuf);
-					}
 				}
 
 				FactionState & faction = factions.getFactionState(unitFactionIndex);
@@ -493,25 +644,13 @@ namespace
 				while (nodeLimitReached == false) {
 					whileLoopCount++;
 					if (faction.openNodesList.empty() == true) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugWorldSynch).
-							enabled == true
-							&& SystemFlags::getSystemSettingType(SystemFlags::
-								debugWorldSynchMax).
-							enabled == true) {
-							char
-								szBuf[8096] = "";
-							snprintf(szBuf, 8096,
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+							&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+							logSynchNodeData(unit, curFrameIndex >= 0,
+								__FILE__, __LINE__,
 								"In doAStarPathSearch() nodeLimitReached %d whileLoopCount %d unitFactionIndex %d pathFound %d maxNodeCount %d",
 								nodeLimitReached, whileLoopCount,
 								unitFactionIndex, pathFound, maxNodeCount);
-
-							if (curFrameIndex >= 0) {
-								unit->logSynchDataThreaded(__FILE__, __LINE__,
-									szBuf);
-							} else {
-								unit->logSynchData(__FILE__, __LINE__, szBuf);
-							}
 						}
 
 						pathFound = false;
@@ -519,26 +658,15 @@ namespace
 					}
 					node = minHeuristicFastLookup(faction);
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true
-						&& SystemFlags::getSystemSettingType(SystemFlags::
-							debugWorldSynchMax).
-						enabled == true) {
-						char
-							szBuf[8096] = "";
-						snprintf(szBuf, 8096,
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+						&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+						logSynchNodeData(unit, curFrameIndex >= 0,
+							__FILE__, __LINE__,
 							"In doAStarPathSearch() nodeLimitReached %d whileLoopCount %d unitFactionIndex %d pathFound %d maxNodeCount %d node->pos = %s finalPos = %s node->exploredCell = %d",
 							nodeLimitReached, whileLoopCount, unitFactionIndex,
 							pathFound, maxNodeCount,
 							node->pos.getString().c_str(),
 							finalPos.getString().c_str(), node->exploredCell);
-
-						if (curFrameIndex >= 0) {
-							unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
-						} else {
-							unit->logSynchData(__FILE__, __LINE__, szBuf);
-						}
 					}
 
 					if (node->pos == finalPos || node->exploredCell == false) {
@@ -569,23 +697,12 @@ namespace
 						tryDirection = faction.random.randRange(1, 4);
 					//int tryDirection      = unit->getRandom(true)->randRange(1, 4);
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true
-						&& SystemFlags::getSystemSettingType(SystemFlags::
-							debugWorldSynchMax).
-						enabled == true) {
-						char
-							szBuf[8096] = "";
-						snprintf(szBuf, 8096,
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+						&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+						logSynchNodeData(unit, curFrameIndex >= 0,
+							__FILE__, __LINE__,
 							"In doAStarPathSearch() tryDirection %d",
 							tryDirection);
-
-						if (curFrameIndex >= 0) {
-							unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
-						} else {
-							unit->logSynchData(__FILE__, __LINE__, szBuf);
-						}
 					}
 
 					if (tryDirection == 4) {
@@ -635,23 +752,13 @@ namespace
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true
-					&& SystemFlags::getSystemSettingType(SystemFlags::
-						debugWorldSynchMax).
-					enabled == true) {
-					char
-						szBuf[8096] = "";
-					snprintf(szBuf, 8096,
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+					&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+					logSynchNodeData(unit, curFrameIndex >= 0,
+						__FILE__, __LINE__,
 						"In doAStarPathSearch() nodeLimitReached %d whileLoopCount %d unitFactionIndex %d pathFound %d maxNodeCount %d",
 						nodeLimitReached, whileLoopCount, unitFactionIndex,
 						pathFound, maxNodeCount);
-
-					if (curFrameIndex >= 0) {
-						unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
-					} else {
-						unit->logSynchData(__FILE__, __LINE__, szBuf);
-					}
 				}
 
 			}
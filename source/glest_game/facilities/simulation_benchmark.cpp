@@ -0,0 +1,226 @@
+//
+//	simulation_benchmark.cpp:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#include "simulation_benchmark.h"
+
+#include <fstream>
+#include "program.h"
+#include "game.h"
+#include "game_settings.h"
+#include "world.h"
+#include "conversion.h"
+#include "platform_util.h"
+#include "util.h"
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::Util;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		//	class SimulationBenchmark
+		// =====================================================
+
+		bool SimulationBenchmark::enabled = false;
+		int SimulationBenchmark::maxFrames = 2000;
+		string SimulationBenchmark::outputFile = "";
+
+		static string escapeJSONString(const string &value) {
+			string result;
+			for (unsigned int index = 0; index < value.size(); ++index) {
+				char ch = value[index];
+				if (ch == '"' || ch == '\\') {
+					result += '\\';
+					result += ch;
+				} else if ((unsigned char) ch < 0x20) {
+					char szBuf[8] = "";
+					snprintf(szBuf, 8, "\\u%04x", (unsigned char) ch);
+					result += szBuf;
+				} else {
+					result += ch;
+				}
+			}
+			return result;
+		}
+
+		SimulationBenchmark::SimulationBenchmark() {
+			mutex = new Mutex(CODE_AT_LINE);
+			for (int section = 0; section < sbsCount; ++section) {
+				totalMicros[section] = 0;
+				maxMicros[section] = 0;
+				sampleCount[section] = 0;
+			}
+			startCounter = 0;
+			started = false;
+			finished = false;
+		}
+
+		SimulationBenchmark::~SimulationBenchmark() {
+			delete mutex;
+			mutex = NULL;
+		}
+
+		SimulationBenchmark & SimulationBenchmark::getInstance() {
+			static SimulationBenchmark simulationBenchmark;
+			return simulationBenchmark;
+		}
+
+		const char * SimulationBenchmark::getSectionName(SimulationBenchmarkSection section) {
+			switch (section) {
+				case sbsWorldUpdate:
+					return "world_update";
+				case sbsWorldTick:
+					return "world_tick";
+				case sbsUnitUpdates:
+					return "unit_updates";
+				case sbsPathfinding:
+					return "pathfinding";
+				case sbsPathfindingPrecompute:
+					return "pathfinding_precompute";
+				case sbsFogOfWar:
+					return "fog_of_war";
+				case sbsAI:
+					return "ai";
+				case sbsScriptTriggers:
+					return "script_triggers";
+				default:
+					return "unknown";
+			}
+		}
+
+		int64 SimulationBenchmark::getCounterMicros(Uint64 count) {
+			static const Uint64 frequency = SDL_GetPerformanceFrequency();
+			if (frequency == 0) {
+				return 0;
+			}
+			// split up so long runs don't overflow the multiplication
+			return (int64) ((count / frequency) * 1000000 + (count % frequency) * 1000000 / frequency);
+		}
+
+		void SimulationBenchmark::addSample(SimulationBenchmarkSection section, int64 micros) {
+			if (section < 0 || section >= sbsCount) {
+				return;
+			}
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			if (started == false || finished == true) {
+				return;
+			}
+			totalMicros[section] += micros;
+			sampleCount[section]++;
+			if (micros > maxMicros[section]) {
+				maxMicros[section] = micros;
+			}
+		}
+
+		void SimulationBenchmark::prepareGameSettings(GameSettings *gameSettings) {
+			for (int factionIndex = 0; factionIndex < gameSettings->getFactionCount(); ++factionIndex) {
+				if (gameSettings->getFactionControl(factionIndex) == ctHuman) {
+					gameSettings->setFactionControl(factionIndex, ctCpu);
+				}
+			}
+		}
+
+		bool SimulationBenchmark::updateGame(Game *game) {
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			if (finished == true) {
+				return true;
+			}
+			// the game reaches its update loop once loading is done, timing
+			// starts from there so loading stays out of the numbers
+			if (started == false) {
+				started = true;
+				startCounter = SDL_GetPerformanceCounter();
+				printf("Simulation benchmark started, running %d frames...\n", maxFrames);
+				return false;
+			}
+			if (sampleCount[sbsWorldUpdate] < maxFrames) {
+				return false;
+			}
+			finished = true;
+			safeMutex.ReleaseLock();
+
+			saveResults(game);
+			game->getProgram()->exit();
+			return true;
+		}
+
+		string SimulationBenchmark::toJSON(Game *game) const {
+			const GameSettings *gameSettings = game->getGameSettings();
+			int64 frames = sampleCount[sbsWorldUpdate];
+			int64 wallMicros = getCounterMicros(SDL_GetPerformanceCounter() - startCounter);
+
+			string result = "{\n";
+			result += "\t\"scenario\": \"" + escapeJSONString(gameSettings->getScenario()) + "\",\n";
+			result += "\t\"tech\": \"" + escapeJSONString(gameSettings->getTech()) + "\",\n";
+			result += "\t\"map\": \"" + escapeJSONString(gameSettings->getMap()) + "\",\n";
+			result += "\t\"tileset\": \"" + escapeJSONString(gameSettings->getTileset()) + "\",\n";
+			result += "\t\"factions\": " + intToStr(gameSettings->getFactionCount()) + ",\n";
+			result += "\t\"frames\": " + intToStr(frames) + ",\n";
+			result += "\t\"world_frame\": " + intToStr(game->getWorld()->getFrameCount()) + ",\n";
+			result += "\t\"wall_us\": " + intToStr(wallMicros) + ",\n";
+			result += "\t\"sections\": {\n";
+			for (int section = 0; section < sbsCount; ++section) {
+				char szBuf[8096] = "";
+				snprintf(szBuf, 8096,
+					"\t\t\"%s\": { \"samples\": " MG_I64_SPECIFIER ", \"total_us\": " MG_I64_SPECIFIER ", \"max_us\": " MG_I64_SPECIFIER ", \"avg_us_per_frame\": %.3f }%s\n",
+					getSectionName((SimulationBenchmarkSection) section),
+					sampleCount[section], totalMicros[section], maxMicros[section],
+					(frames > 0 ? (double) totalMicros[section] / (double) frames : 0.0),
+					(section + 1 < sbsCount ? "," : ""));
+				result += szBuf;
+			}
+			result += "\t}\n";
+			result += "}\n";
+			return result;
+		}
+
+		void SimulationBenchmark::saveResults(Game *game) const {
+			string json = toJSON(game);
+			if (outputFile == "") {
+				printf("%s", json.c_str());
+				return;
+			}
+
+#if defined(WIN32) && !defined(__MINGW32__)
+			FILE *fp = _wfopen(utf8_decode(outputFile).c_str(), L"w");
+			std::ofstream resultFile(fp);
+#else
+			std::ofstream resultFile;
+			resultFile.open(outputFile.c_str(), ios_base::out | ios_base::trunc);
+#endif
+			if (resultFile.is_open() == false) {
+				throw megaglest_runtime_error("Cannot write simulation benchmark results to [" + outputFile + "]");
+			}
+			resultFile << json;
+			resultFile.close();
+#if defined(WIN32) && !defined(__MINGW32__)
+			if (fp) {
+				fclose(fp);
+			}
+#endif
+			printf("Simulation benchmark results written to [%s]\n", outputFile.c_str());
+		}
+
+	}
+}//end namespace
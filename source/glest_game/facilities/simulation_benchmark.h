@@ -0,0 +1,169 @@
+//
+//	simulation_benchmark.h:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#ifndef _GLEST_GAME_SIMULATION_BENCHMARK_H_
+#define _GLEST_GAME_SIMULATION_BENCHMARK_H_
+
+#ifdef WIN32
+#include <winsock2.h>
+#include <winsock.h>
+#endif
+
+#include <SDL.h>
+#include <string>
+#include "data_types.h"
+#include "profiler.h"
+#include "leak_dumper.h"
+
+using std::string;
+using Shared::Platform::int64;
+using Shared::Util::TraceProfiler;
+
+namespace Shared {
+	namespace Platform {
+		class Mutex;
+	}
+}
+
+namespace Glest {
+	namespace Game {
+
+		class Game;
+		class GameSettings;
+
+		// the parts of a simulation frame that get timed separately
+		enum SimulationBenchmarkSection {
+			sbsWorldUpdate,
+			sbsWorldTick,
+			sbsUnitUpdates,
+			sbsPathfinding,
+			sbsPathfindingPrecompute,
+			sbsFogOfWar,
+			sbsAI,
+			sbsScriptTriggers,
+
+			sbsCount
+		};
+
+		// =====================================================
+		//	class SimulationBenchmark
+		//
+		///	Collects per subsystem timings while a headless game
+		///	runs a fixed number of world frames, then writes
+		///	them as JSON and ends the program.
+		// =====================================================
+
+		class SimulationBenchmark {
+		private:
+			static bool enabled;
+			static int maxFrames;
+			static string outputFile;
+
+			::Shared::Platform::Mutex *mutex;
+			int64 totalMicros[sbsCount];
+			int64 maxMicros[sbsCount];
+			int64 sampleCount[sbsCount];
+			Uint64 startCounter;
+			bool started;
+			bool finished;
+
+			string toJSON(Game *game) const;
+			void saveResults(Game *game) const;
+
+		public:
+			static SimulationBenchmark & getInstance();
+			SimulationBenchmark();
+			~SimulationBenchmark();
+
+			static bool isEnabled() {
+				return enabled;
+			}
+			static void setEnabled(bool value) {
+				enabled = value;
+			}
+			static int getMaxFrames() {
+				return maxFrames;
+			}
+			static void setMaxFrames(int value) {
+				maxFrames = value;
+			}
+			static void setOutputFile(const string &filename) {
+				outputFile = filename;
+			}
+			static const char * getSectionName(SimulationBenchmarkSection section);
+			// Chrono only has millisecond resolution, too coarse for a single section
+			static int64 getCounterMicros(Uint64 count);
+
+			// may be called from any thread
+			void addSample(SimulationBenchmarkSection section, int64 micros);
+
+			// hands every slot to the AI so the game runs without input
+			void prepareGameSettings(GameSettings *gameSettings);
+			// returns true once the benchmark is done and the program is exiting
+			bool updateGame(Game *game);
+		};
+
+		// =====================================================
+		//	class SimulationBenchmarkTimer
+		//
+		///	Times its own scope into a benchmark section and the
+		///	trace profiler, costs two flag checks when neither runs.
+		// =====================================================
+
+		class SimulationBenchmarkTimer {
+		private:
+			SimulationBenchmarkSection section;
+			bool active;
+			bool traced;
+			Uint64 startCounter;
+
+		public:
+			explicit SimulationBenchmarkTimer(SimulationBenchmarkSection section) {
+				this->section = section;
+				this->active = SimulationBenchmark::isEnabled();
+				this->traced = TraceProfiler::isEnabled();
+				this->startCounter = (this->active == true || this->traced == true ? SDL_GetPerformanceCounter() : 0);
+			}
+			~SimulationBenchmarkTimer() {
+				stop();
+			}
+
+			// records the time so far, for sections that end before the scope
+			void stop() {
+				if (this->active == true || this->traced == true) {
+					Uint64 endCounter = SDL_GetPerformanceCounter();
+					if (this->active == true) {
+						this->active = false;
+						SimulationBenchmark::getInstance().addSample(section, SimulationBenchmark::getCounterMicros(endCounter - startCounter));
+					}
+					if (this->traced == true) {
+						this->traced = false;
+						TraceProfiler::addScope(SimulationBenchmark::getSectionName(section), startCounter, endCounter);
+					}
+				}
+			}
+		};
+
+	}
+}//end namespace
+
+#endif
@@ -0,0 +1,207 @@
+//
+//	cell_trigger_index.cpp:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#include "cell_trigger_index.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "leak_dumper.h"
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		// 	class CellTriggerEventIndex
+		// =====================================================
+
+		const int CellTriggerEventIndex::bucketSize = 16;
+
+		CellTriggerEventIndex::CellTriggerEventIndex() {
+			w = 0;
+			h = 0;
+			bucketW = 1;
+			bucketH = 1;
+			areaEventCount = 0;
+			clear();
+		}
+
+		void CellTriggerEventIndex::init(int w, int h) {
+			this->w = std::max(w, 0);
+			this->h = std::max(h, 0);
+			bucketW = std::max((this->w + bucketSize - 1) / bucketSize, 1);
+			bucketH = std::max((this->h + bucketSize - 1) / bucketSize, 1);
+			clear();
+		}
+
+		void CellTriggerEventIndex::clear() {
+			buckets.clear();
+			buckets.resize(bucketW * bucketH);
+			unitEvents.clear();
+			factionEvents.clear();
+			areaEventsWithUnitInside.clear();
+			areaEventCount = 0;
+		}
+
+		void CellTriggerEventIndex::getBucketRange(const Vec2i &pos, const Vec2i &posEnd,
+			int &bucketX0, int &bucketY0, int &bucketX1, int &bucketY1) const {
+			// cells off the map still count for units overlapping them from the
+			// edge, clamping keeps them in the edge buckets
+			bucketX0 = std::min(std::max(pos.x, 0), std::max(w - 1, 0)) / bucketSize;
+			bucketY0 = std::min(std::max(pos.y, 0), std::max(h - 1, 0)) / bucketSize;
+			bucketX1 = std::min(std::max(posEnd.x, 0), std::max(w - 1, 0)) / bucketSize;
+			bucketY1 = std::min(std::max(posEnd.y, 0), std::max(h - 1, 0)) / bucketSize;
+		}
+
+		void CellTriggerEventIndex::removeEventId(vector<int> &eventIds, int eventId) {
+			vector<int>::iterator iterFind = std::find(eventIds.begin(), eventIds.end(), eventId);
+			if (iterFind != eventIds.end()) {
+				eventIds.erase(iterFind);
+			}
+		}
+
+		void CellTriggerEventIndex::addUnitEvent(int eventId, int sourceUnitId) {
+			unitEvents[sourceUnitId].push_back(eventId);
+		}
+
+		void CellTriggerEventIndex::removeUnitEvent(int eventId, int sourceUnitId) {
+			std::map<int, vector<int> >::iterator iterFind = unitEvents.find(sourceUnitId);
+			if (iterFind != unitEvents.end()) {
+				removeEventId(iterFind->second, eventId);
+				if (iterFind->second.empty() == true) {
+					unitEvents.erase(iterFind);
+				}
+			}
+		}
+
+		void CellTriggerEventIndex::addFactionEvent(int eventId, int sourceFactionIndex) {
+			factionEvents[sourceFactionIndex].push_back(eventId);
+		}
+
+		void CellTriggerEventIndex::removeFactionEvent(int eventId, int sourceFactionIndex) {
+			std::map<int, vector<int> >::iterator iterFind = factionEvents.find(sourceFactionIndex);
+			if (iterFind != factionEvents.end()) {
+				removeEventId(iterFind->second, eventId);
+				if (iterFind->second.empty() == true) {
+					factionEvents.erase(iterFind);
+				}
+			}
+		}
+
+		void CellTriggerEventIndex::addAreaEvent(int eventId, const Vec2i &pos, const Vec2i &posEnd) {
+			// an empty area never sets its event off
+			if (posEnd.x < pos.x || posEnd.y < pos.y) {
+				return;
+			}
+			int bucketX0, bucketY0, bucketX1, bucketY1;
+			getBucketRange(pos, posEnd, bucketX0, bucketY0, bucketX1, bucketY1);
+			for (int bucketY = bucketY0; bucketY <= bucketY1; ++bucketY) {
+				for (int bucketX = bucketX0; bucketX <= bucketX1; ++bucketX) {
+					buckets[bucketY * bucketW + bucketX].push_back(eventId);
+				}
+			}
+			areaEventCount++;
+		}
+
+		void CellTriggerEventIndex::removeAreaEvent(int eventId, const Vec2i &pos, const Vec2i &posEnd) {
+			for (std::map<int, std::set<int> >::iterator iterMap = areaEventsWithUnitInside.begin();
+				iterMap != areaEventsWithUnitInside.end();) {
+				iterMap->second.erase(eventId);
+				if (iterMap->second.empty() == true) {
+					areaEventsWithUnitInside.erase(iterMap++);
+				} else {
+					++iterMap;
+				}
+			}
+
+			if (posEnd.x < pos.x || posEnd.y < pos.y) {
+				return;
+			}
+			int bucketX0, bucketY0, bucketX1, bucketY1;
+			getBucketRange(pos, posEnd, bucketX0, bucketY0, bucketX1, bucketY1);
+			for (int bucketY = bucketY0; bucketY <= bucketY1; ++bucketY) {
+				for (int bucketX = bucketX0; bucketX <= bucketX1; ++bucketX) {
+					removeEventId(buckets[bucketY * bucketW + bucketX], eventId);
+				}
+			}
+			areaEventCount--;
+		}
+
+		void CellTriggerEventIndex::setUnitInsideArea(int eventId, int unitId, bool inside) {
+			if (inside == true) {
+				areaEventsWithUnitInside[unitId].insert(eventId);
+			} else {
+				std::map<int, std::set<int> >::iterator iterFind = areaEventsWithUnitInside.find(unitId);
+				if (iterFind != areaEventsWithUnitInside.end()) {
+					iterFind->second.erase(eventId);
+					if (iterFind->second.empty() == true) {
+						areaEventsWithUnitInside.erase(iterFind);
+					}
+				}
+			}
+		}
+
+		void CellTriggerEventIndex::findEvents(int unitId, int factionIndex, const Vec2i &pos, int unitSize, std::set<int> &eventIds) const {
+			std::map<int, vector<int> >::const_iterator iterFind = unitEvents.find(unitId);
+			if (iterFind != unitEvents.end()) {
+				eventIds.insert(iterFind->second.begin(), iterFind->second.end());
+			}
+			iterFind = factionEvents.find(factionIndex);
+			if (iterFind != factionEvents.end()) {
+				eventIds.insert(iterFind->second.begin(), iterFind->second.end());
+			}
+
+			if (areaEventCount > 0) {
+				// a unit at pos covers an area cell c when pos - (size - 1) <= c <= pos
+				Vec2i posStart = pos - Vec2i(std::max(unitSize, 1) - 1);
+				int bucketX0, bucketY0, bucketX1, bucketY1;
+				getBucketRange(posStart, pos, bucketX0, bucketY0, bucketX1, bucketY1);
+				for (int bucketY = bucketY0; bucketY <= bucketY1; ++bucketY) {
+					for (int bucketX = bucketX0; bucketX <= bucketX1; ++bucketX) {
+						const vector<int> &bucket = buckets[bucketY * bucketW + bucketX];
+						eventIds.insert(bucket.begin(), bucket.end());
+					}
+				}
+			}
+
+			std::map<int, std::set<int> >::const_iterator iterInside = areaEventsWithUnitInside.find(unitId);
+			if (iterInside != areaEventsWithUnitInside.end()) {
+				eventIds.insert(iterInside->second.begin(), iterInside->second.end());
+			}
+		}
+
+		string CellTriggerEventIndex::getStats() const {
+			int usedBuckets = 0;
+			for (unsigned int index = 0; index < buckets.size(); ++index) {
+				if (buckets[index].empty() == false) {
+					usedBuckets++;
+				}
+			}
+
+			char szBuf[8096] = "";
+			snprintf(szBuf, 8096, "unit sources [%d] faction sources [%d] area events [%d] used buckets [%d] bucket size [%d]",
+				(int) unitEvents.size(), (int) factionEvents.size(), areaEventCount, usedBuckets, bucketSize);
+			return szBuf;
+		}
+
+	}
+} //end namespace
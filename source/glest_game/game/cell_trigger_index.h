@@ -0,0 +1,99 @@
+//
+//	cell_trigger_index.h:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#ifndef _GLEST_GAME_CELL_TRIGGER_INDEX_H_
+#define _GLEST_GAME_CELL_TRIGGER_INDEX_H_
+
+#ifdef WIN32
+#include <winsock2.h>
+#include <winsock.h>
+#endif
+
+#include <map>
+#include <set>
+#include <vector>
+#include <string>
+#include "vec.h"
+#include "leak_dumper.h"
+
+using std::vector;
+using std::string;
+using Shared::Graphics::Vec2i;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		// 	class CellTriggerEventIndex
+		//
+		///	Finds the lua cell trigger events a moving unit can
+		///	set off. Unit events are kept by their source unit,
+		///	unit to unit faction events by their source faction
+		///	and location events in a uniform grid of the map.
+		// =====================================================
+
+		class CellTriggerEventIndex {
+		public:
+			static const int bucketSize;
+
+		private:
+			int w;
+			int h;
+			int bucketW;
+			int bucketH;
+			vector<vector<int> > buckets;
+			std::map<int, vector<int> > unitEvents;
+			std::map<int, vector<int> > factionEvents;
+			// area events with the unit inside them, these fire when it leaves
+			std::map<int, std::set<int> > areaEventsWithUnitInside;
+			int areaEventCount;
+
+			void getBucketRange(const Vec2i &pos, const Vec2i &posEnd, int &bucketX0, int &bucketY0, int &bucketX1, int &bucketY1) const;
+			static void removeEventId(vector<int> &eventIds, int eventId);
+
+		public:
+			CellTriggerEventIndex();
+
+			void init(int w, int h);
+			void clear();
+
+			void addUnitEvent(int eventId, int sourceUnitId);
+			void removeUnitEvent(int eventId, int sourceUnitId);
+			void addFactionEvent(int eventId, int sourceFactionIndex);
+			void removeFactionEvent(int eventId, int sourceFactionIndex);
+			// [pos, posEnd] is the area of cells that sets the event off
+			void addAreaEvent(int eventId, const Vec2i &pos, const Vec2i &posEnd);
+			void removeAreaEvent(int eventId, const Vec2i &pos, const Vec2i &posEnd);
+
+			void setUnitInsideArea(int eventId, int unitId, bool inside);
+
+			// adds the events a unit of the given size standing at pos might set
+			// off, callers still run the exact test of each event
+			void findEvents(int unitId, int factionIndex, const Vec2i &pos, int unitSize, std::set<int> &eventIds) const;
+
+			string getStats() const;
+		};
+
+	}
+} //end namespace
+
+#endif
@@ -97,8 +97,7 @@ namespace
 				const UnitType * unitType,
 				CardinalDir facing, bool tryQueue,
 				Unit * targetUnit) const {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -207,8 +206,7 @@ namespace
 				CardinalDir facing, bool tryQueue,
 				Unit * targetUnit,
 				int unitGroupCommandId) const {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -220,8 +218,7 @@ namespace
 
 			Chrono
 				chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
 			assert(this->world != NULL);
@@ -229,8 +226,7 @@ namespace
 			assert(commandType != NULL);
 			assert(unitType != NULL);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d took msecs: %lld\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -247,8 +243,7 @@ namespace
 						(targetUnit != NULL ? targetUnit->getId() : -1),
 						facing, tryQueue, cst_None, -1, unitGroupCommandId);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -259,8 +254,7 @@ namespace
 				result = pushNetworkCommand(&networkCommand);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d took msecs: %lld\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -431,8 +425,7 @@ namespace
 				return std::pair < CommandResult, string >(crFailUndefined, "");
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -780,8 +773,7 @@ namespace
 					(world->getFrameCount() %
 						gameSettings->getNetworkFramePeriod()) == 0) {
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] networkManager.isNetworkGame() = %d,world->getFrameCount() = %d, gameSettings->getNetworkFramePeriod() = %d\n",
 							extractFileFromDirectoryPath
@@ -798,16 +790,12 @@ namespace
 							gameNetworkInterface =
 							NetworkManager::getInstance().getGameNetworkInterface();
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugPerformance).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 							perfTimer.start();
 						//update the keyframe
 						gameNetworkInterface->updateKeyframe(world->
 							getFrameCount());
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugPerformance).
-							enabled && perfTimer.getMillis() > 0)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && perfTimer.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] gameNetworkInterface->updateKeyframe for %d took %lld msecs\n",
 								extractFileFromDirectoryPath
@@ -816,9 +804,7 @@ namespace
 								world->getFrameCount(),
 								perfTimer.getMillis());
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugPerformance).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 							perfTimer.start();
 						//give pending commands
 						if (SystemFlags::VERBOSE_MODE_ENABLED)
@@ -836,9 +822,7 @@ namespace
 							printf("END process: %d network commands in frame: %d\n",
 								gameNetworkInterface->getPendingCommandCount(),
 								this->world->getFrameCount());
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugPerformance).
-							enabled && perfTimer.getMillis() > 0)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && perfTimer.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] giveNetworkCommand took %lld msecs, PendingCommandCount = %d\n",
 								extractFileFromDirectoryPath
@@ -866,13 +850,11 @@ namespace
 			Commander::giveNetworkCommand(NetworkCommand * networkCommand) const {
 			Chrono
 				chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.
 				start();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [START]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -887,8 +869,7 @@ namespace
 			networkCommand->
 				preprocessNetworkCommand(this->world);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [after networkCommand->preprocessNetworkCommand]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -901,8 +882,7 @@ namespace
 			switch (networkCommand->getNetworkCommandType()) {
 				case nctSwitchTeam:
 				{
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctSwitchTeam\n",
 							extractFileFromDirectoryPath
@@ -1002,8 +982,7 @@ namespace
 						}
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld [after unit->setMeetingPos]\n",
@@ -1011,8 +990,7 @@ namespace
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctSetMeetingPoint\n",
 							extractFileFromDirectoryPath
@@ -1023,8 +1001,7 @@ namespace
 
 				case nctSwitchTeamVote:
 				{
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctSwitchTeamVote\n",
 							extractFileFromDirectoryPath
@@ -1194,8 +1171,7 @@ namespace
 						}
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld [after unit->setMeetingPos]\n",
@@ -1203,8 +1179,7 @@ namespace
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctSetMeetingPoint\n",
 							extractFileFromDirectoryPath
@@ -1215,8 +1190,7 @@ namespace
 
 				case nctDisconnectNetworkPlayer:
 				{
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctDisconnectNetworkPlayer\n",
 							extractFileFromDirectoryPath
@@ -1274,8 +1248,7 @@ namespace
 							}
 						}
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctDisconnectNetworkPlayer\n",
 							extractFileFromDirectoryPath
@@ -1286,8 +1259,7 @@ namespace
 
 				case nctPauseResume:
 				{
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctPauseResume\n",
 							extractFileFromDirectoryPath
@@ -1308,8 +1280,7 @@ namespace
 					//printf("nctPauseResume pauseGame = %d\n",pauseGame);
 					game->setPaused(pauseGame, true, clearCaches, joinNetworkGame);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctPauseResume\n",
 							extractFileFromDirectoryPath
@@ -1320,8 +1291,7 @@ namespace
 
 				case nctPlayerStatusChange:
 				{
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctPlayerStatusChange\n",
 							extractFileFromDirectoryPath
@@ -1335,8 +1305,7 @@ namespace
 					int
 						playerStatus = networkCommand->getCommandTypeId();
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"nctPlayerStatusChange factionIndex = %d playerStatus = %d\n",
 							factionIndex, playerStatus);
@@ -1383,8 +1352,7 @@ namespace
 						}
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found nctPlayerStatusChange\n",
 							extractFileFromDirectoryPath
@@ -1399,8 +1367,7 @@ namespace
 				Unit *
 					unit = world->findUnitById(networkCommand->getUnitId());
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld [after world->findUnitById]\n",
@@ -1422,9 +1389,7 @@ namespace
 							assert(networkCommand->getCommandTypeId() !=
 								CommandType::invalidId);
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] found nctGiveCommand networkCommand->getUnitId() = %d\n",
 									extractFileFromDirectoryPath
@@ -1435,9 +1400,7 @@ namespace
 							Command *
 								command = buildCommand(networkCommand);
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugPerformance).
-								enabled && chrono.getMillis() > 0)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld [after buildCommand]\n",
 									extractFileFromDirectoryPath
@@ -1445,9 +1408,7 @@ namespace
 									__FUNCTION__, __LINE__,
 									chrono.getMillis());
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] command = %p\n",
 									extractFileFromDirectoryPath
@@ -1459,9 +1420,7 @@ namespace
 								(networkCommand->getWantQueue() !=
 									0));
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugPerformance).
-								enabled && chrono.getMillis() > 0)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld [after unit->giveCommand]\n",
 									extractFileFromDirectoryPath
@@ -1469,9 +1428,7 @@ namespace
 									__FUNCTION__, __LINE__,
 									chrono.getMillis());
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] found nctGiveCommand networkCommand->getUnitId() = %d\n",
 									extractFileFromDirectoryPath
@@ -1482,9 +1439,7 @@ namespace
 						break;
 						case nctCancelCommand:
 						{
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] found nctCancelCommand\n",
 									extractFileFromDirectoryPath
@@ -1493,9 +1448,7 @@ namespace
 
 							unit->cancelCommand();
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugPerformance).
-								enabled && chrono.getMillis() > 0)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld [after unit->cancelCommand]\n",
 									extractFileFromDirectoryPath
@@ -1503,9 +1456,7 @@ namespace
 									__FUNCTION__, __LINE__,
 									chrono.getMillis());
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] found nctCancelCommand\n",
 									extractFileFromDirectoryPath
@@ -1515,9 +1466,7 @@ namespace
 						break;
 						case nctSetMeetingPoint:
 						{
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] found nctSetMeetingPoint\n",
 									extractFileFromDirectoryPath
@@ -1526,9 +1475,7 @@ namespace
 
 							unit->setMeetingPos(networkCommand->getPosition());
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugPerformance).
-								enabled && chrono.getMillis() > 0)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld [after unit->setMeetingPos]\n",
 									extractFileFromDirectoryPath
@@ -1536,9 +1483,7 @@ namespace
 									__FUNCTION__, __LINE__,
 									chrono.getMillis());
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] found nctSetMeetingPoint\n",
 									extractFileFromDirectoryPath
@@ -1552,8 +1497,7 @@ namespace
 							break;
 					}
 				} else {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] NULL Unit for id = %d, networkCommand->getNetworkCommandType() = %d\n",
 							extractFileFromDirectoryPath
@@ -1565,8 +1509,7 @@ namespace
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld [END]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1580,8 +1523,7 @@ namespace
 			// Check a new command is actually being given (and not a cancel command, switch team etc.).
 			assert(networkCommand->getNetworkCommandType() == nctGiveCommand);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] networkCommand [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1617,8 +1559,7 @@ namespace
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, networkCommand->getUnitId());
 				SystemFlags::OutputDebug(SystemFlags::debugError, "%s\n", szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 						szBuf);
 
@@ -1659,8 +1600,7 @@ namespace
 					unit->getFaction()->getIndex());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "%s\n", szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 						szBuf);
 				//std::string worldLog = world->DumpWorldToLog();
@@ -1835,8 +1775,7 @@ namespace
 			command->setUnitCommandGroupId(networkCommand->
 				getUnitCommandGroupId());
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -35,6 +35,8 @@
 #include "network_manager.h"
 #include "checksum.h"
 #include "auto_test.h"
+#include "simulation_benchmark.h"
+#include "save_game_thread.h"
 #include "menu_state_keysetup.h"
 #include "video_player.h"
 #include "compression_utils.h"
@@ -184,6 +186,7 @@ namespace Glest {
 			//printf("In [%s:%s] Line: %d currentAmbientSound = [%p]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,currentAmbientSound);
 
 			loadGameNode = NULL;
+			saveGameThread = NULL;
 			lastworldFrameCountForReplay = -1;
 			lastNetworkPlayerConnectionCheck = time(NULL);
 			inJoinGameLoading = false;
@@ -311,6 +314,7 @@ namespace Glest {
 			//printf("In [%s:%s] Line: %d currentAmbientSound = [%p]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,currentAmbientSound);
 
 			loadGameNode = NULL;
+			saveGameThread = NULL;
 			lastworldFrameCountForReplay = -1;
 
 			lastNetworkPlayerConnectionCheck = time(NULL);
@@ -345,8 +349,7 @@ namespace Glest {
 				printf("In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -374,8 +377,7 @@ namespace Glest {
 				gameSettings.getNetworkAllowNativeLanguageTechtree
 				());
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -388,8 +390,7 @@ namespace Glest {
 				printf("In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -406,8 +407,7 @@ namespace Glest {
 				(originalDisplayMsgCallback);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -427,8 +427,7 @@ namespace Glest {
 					false);
 			logger.hideProgress();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -438,8 +437,7 @@ namespace Glest {
 			// Cannot Fade because sound files will be deleted below
 			SoundRenderer::getInstance().stopAllSounds(fadeMusicMilliseconds);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -449,8 +447,7 @@ namespace Glest {
 			//      deleteValues(aiInterfaces.begin(), aiInterfaces.end());
 			//      aiInterfaces.clear();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -459,8 +456,7 @@ namespace Glest {
 
 			gui.end();               //selection must be cleared before deleting units
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -469,8 +465,7 @@ namespace Glest {
 
 			//      world.end();    //must die before selection because of referencers
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] aiInterfaces.size() = %d\n",
 					extractFileFromDirectoryPath
@@ -485,8 +480,7 @@ namespace Glest {
 			GameConstants::updateFps = original_updateFps;
 			GameConstants::cameraFps = original_cameraFps;
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -495,16 +489,14 @@ namespace Glest {
 
 			Unit::setGame(NULL);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] ==== END GAME ==== getCurrentPixelByteCount() = "
 					MG_SIZE_T_SPECIFIER "\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderer.getCurrentPixelByteCount());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugWorldSynch).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 				SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 					"==== END GAME ====\n");
 
@@ -529,8 +521,7 @@ namespace Glest {
 				printf("In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -538,6 +529,7 @@ namespace Glest {
 					__LINE__);
 
 			quitGame();
+			shutdownSaveGameThread();
 
 			Object::setStateCallback(NULL);
 			thisGamePtr = NULL;
@@ -546,8 +538,7 @@ namespace Glest {
 				(originalDisplayMsgCallback);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -566,8 +557,7 @@ namespace Glest {
 					false);
 			logger.hideProgress();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -577,8 +567,7 @@ namespace Glest {
 			// Cannot Fade because sound files will be deleted below
 			SoundRenderer::getInstance().stopAllSounds();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -589,8 +578,7 @@ namespace Glest {
 			deleteValues(aiInterfaces.begin(), aiInterfaces.end());
 			aiInterfaces.clear();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -599,8 +587,7 @@ namespace Glest {
 
 			gui.end();               //selection must be cleared before deleting units
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -611,8 +598,7 @@ namespace Glest {
 
 			BaseColorPickEntity::resetUniqueColors();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] aiInterfaces.size() = %d\n",
 					extractFileFromDirectoryPath
@@ -632,8 +618,7 @@ namespace Glest {
 			GameConstants::updateFps = original_updateFps;
 			GameConstants::cameraFps = original_cameraFps;
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -652,16 +637,14 @@ namespace Glest {
 				preCacheCRCThreadPtr->setPauseForGame(false);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] ==== END GAME ==== getCurrentPixelByteCount() = "
 					MG_SIZE_T_SPECIFIER "\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderer.getCurrentPixelByteCount());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugWorldSynch).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 				SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 					"==== END GAME ====\n");
 
@@ -691,8 +674,7 @@ namespace Glest {
 		// ==================== init and load ====================
 
 		int Game::ErrorDisplayMessage(const char *msg, bool exitApp) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] %s\n",
 					extractFileFromDirectoryPath
@@ -758,8 +740,7 @@ namespace Glest {
 							logoIndex < loadScreenList.size(); ++logoIndex) {
 							string
 								senarioLogo = scenarioDir + loadScreenList[bestLogoIndex];
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] looking for loading screen '%s'\n",
 									extractFileFromDirectoryPath
@@ -771,8 +752,7 @@ namespace Glest {
 									senarioLogo.c_str());
 
 							if (fileExists(senarioLogo) == true) {
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line: %d] found loading screen '%s'\n",
 										extractFileFromDirectoryPath
@@ -820,8 +800,7 @@ namespace Glest {
 
 					string senarioLogo = scenarioDir + loadScreenList[bestLogoIndex];
 					if (fileExists(senarioLogo) == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s] found scenario loading screen '%s'\n",
 								extractFileFromDirectoryPath
@@ -835,8 +814,7 @@ namespace Glest {
 						loadingImageUsed = true;
 					}
 				}
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n",
 						extractFileFromDirectoryPath
@@ -856,8 +834,7 @@ namespace Glest {
 				const string & techName, Logger * logger,
 				string factionLogoFilter) {
 			string result = "";
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] Searching for faction loading screen\n",
 					extractFileFromDirectoryPath
@@ -873,8 +850,7 @@ namespace Glest {
 				//printf("In [%s::%s Line: %d] looking for loading screen '%s'\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,factionLogo.c_str());
 
 				if (fileExists(factionLogo) == true) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found loading screen '%s'\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -898,8 +874,7 @@ namespace Glest {
 					factionLogo = data_path + "data/core/misc_textures/random.jpg";
 
 				if (fileExists(factionLogo) == true) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] found loading screen '%s'\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -923,8 +898,7 @@ namespace Glest {
 					string
 						path =
 						currentPath + techName + "/" + "factions" + "/" + factionName;
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] possible loading screen dir '%s'\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -957,8 +931,7 @@ namespace Glest {
 									logoIndex <
 									(unsigned int) loadScreenList.size(); ++logoIndex) {
 									string factionLogo = path + loadScreenList[logoIndex];
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::debugSystem,
 											"In [%s::%s Line: %d] looking for loading screen '%s'\n",
 											extractFileFromDirectoryPath
@@ -971,8 +944,7 @@ namespace Glest {
 											logoIndex, factionLogo.c_str());
 
 									if (fileExists(factionLogo) == true) {
-										if (SystemFlags::getSystemSettingType
-										(SystemFlags::debugSystem).enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 											SystemFlags::OutputDebug(SystemFlags::debugSystem,
 												"In [%s::%s Line: %d] found loading screen '%s'\n",
 												extractFileFromDirectoryPath
@@ -1025,8 +997,7 @@ namespace Glest {
 							}
 
 							string factionLogo = path + loadScreenList[bestLogoIndex];
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] looking for loading screen '%s'\n",
 									extractFileFromDirectoryPath
@@ -1034,8 +1005,7 @@ namespace Glest {
 									__LINE__, factionLogo.c_str());
 
 							if (fileExists(factionLogo) == true) {
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line: %d] found loading screen '%s'\n",
 										extractFileFromDirectoryPath
@@ -1103,8 +1073,7 @@ namespace Glest {
 										//string linkedTmppath= linkedCurrentPath + factionName +".xml";
 
 										path = linkedCurrentPath;
-										if (SystemFlags::getSystemSettingType
-										(SystemFlags::debugSystem).enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 											SystemFlags::OutputDebug(SystemFlags::debugSystem,
 												"In [%s::%s Line: %d] possible loading screen dir '%s'\n",
 												extractFileFromDirectoryPath
@@ -1124,8 +1093,7 @@ namespace Glest {
 												loadScreenList, false, false);
 											if (loadScreenList.empty() == false) {
 												string factionLogo = path + loadScreenList[0];
-												if (SystemFlags::getSystemSettingType
-												(SystemFlags::debugSystem).enabled)
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 													SystemFlags::OutputDebug(SystemFlags::debugSystem,
 														"In [%s::%s Line: %d] looking for loading screen '%s'\n",
 														extractFileFromDirectoryPath
@@ -1137,8 +1105,7 @@ namespace Glest {
 												//printf("F factionLogo [%s]\n",factionLogo.c_str());
 
 												if (fileExists(factionLogo) == true) {
-													if (SystemFlags::getSystemSettingType
-													(SystemFlags::debugSystem).enabled)
+													if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 														SystemFlags::OutputDebug
 														(SystemFlags::debugSystem,
 															"In [%s::%s Line: %d] found loading screen '%s'\n",
@@ -1178,8 +1145,7 @@ namespace Glest {
 				bool & loadingImageUsed, Logger * logger,
 				const string & factionLogoFilter) {
 			string result = "";
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] Searching for tech loading screen\n",
 					extractFileFromDirectoryPath
@@ -1192,8 +1158,7 @@ namespace Glest {
 				string currentPath = pathList[idx];
 				endPathWithSlash(currentPath);
 				string path = currentPath + techName;
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] possible loading screen dir '%s'\n",
 						extractFileFromDirectoryPath
@@ -1206,8 +1171,7 @@ namespace Glest {
 					findAll(path + factionLogoFilter, loadScreenList, false, false);
 					if (loadScreenList.empty() == false) {
 						string factionLogo = path + loadScreenList[0];
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d] looking for loading screen '%s'\n",
 								extractFileFromDirectoryPath
@@ -1215,8 +1179,7 @@ namespace Glest {
 								__LINE__, factionLogo.c_str());
 
 						if (fileExists(factionLogo) == true) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] found loading screen '%s'\n",
 									extractFileFromDirectoryPath
@@ -1283,8 +1246,7 @@ namespace Glest {
 								("In [%s::%s Line: %d] looking for a HUD [%s]\n",
 									extractFileFromDirectoryPath(__FILE__).c_str(),
 									__FUNCTION__, __LINE__, hudImageFileName.c_str());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] looking for a HUD [%s]\n",
 									extractFileFromDirectoryPath
@@ -1298,8 +1260,7 @@ namespace Glest {
 									("In [%s::%s Line: %d] found HUD image [%s]\n",
 										extractFileFromDirectoryPath(__FILE__).c_str(),
 										__FUNCTION__, __LINE__, hudImageFileName.c_str());
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line: %d] found HUD image [%s]\n",
 										extractFileFromDirectoryPath
@@ -1477,8 +1438,7 @@ namespace Glest {
 				NetworkInterface::getDisplayMessageFunction();
 			NetworkInterface::setDisplayMessageFunction(ErrorDisplayMessage);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] loadTypes = %d, gameSettings = [%s]\n",
 					extractFileFromDirectoryPath
@@ -1548,8 +1508,7 @@ namespace Glest {
 			}
 
 			if ((loadTypes & lgt_FactionPreview) == lgt_FactionPreview) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1587,8 +1546,7 @@ namespace Glest {
 
 			string scenarioDir = "";
 			if (gameSettings.getScenarioDir() != "") {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1612,8 +1570,7 @@ namespace Glest {
 				perfList.push_back(perfBuf);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1622,8 +1579,7 @@ namespace Glest {
 
 			//tileset
 			if ((loadTypes & lgt_TileSet) == lgt_TileSet) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1647,8 +1603,7 @@ namespace Glest {
 			::Shared::Platform::Window::handleEvent();
 			SDL_PumpEvents();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1669,8 +1624,7 @@ namespace Glest {
 			}
 
 			if ((loadTypes & lgt_TechTree) == lgt_TechTree) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1705,8 +1659,7 @@ namespace Glest {
 			::Shared::Platform::Window::handleEvent();
 			SDL_PumpEvents();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1715,8 +1668,7 @@ namespace Glest {
 
 			//map
 			if ((loadTypes & lgt_Map) == lgt_Map) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1738,8 +1690,7 @@ namespace Glest {
 			::Shared::Platform::Window::handleEvent();
 			SDL_PumpEvents();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1748,8 +1699,7 @@ namespace Glest {
 
 			//scenario
 			if ((loadTypes & lgt_Scenario) == lgt_Scenario) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1784,8 +1734,7 @@ namespace Glest {
 			sleep(0);
 			SDL_PumpEvents();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1822,8 +1771,7 @@ namespace Glest {
 				perfList.push_back(perfBuf);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] initForPreviewOnly = %d\n",
 					extractFileFromDirectoryPath
@@ -1844,8 +1792,7 @@ namespace Glest {
 				throw megaglest_runtime_error("map == NULL");
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1889,8 +1836,7 @@ namespace Glest {
 					sErrBuf = ex.what();
 				}
 				SystemFlags::OutputDebug(SystemFlags::debugError, sErrBuf.c_str());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						sErrBuf.c_str());
 
@@ -1906,8 +1852,7 @@ namespace Glest {
 					string(szErrBuf) + string("\nerror [") + string(ex.what()) +
 					string("]\n");
 				SystemFlags::OutputDebug(SystemFlags::debugError, sErrBuf.c_str());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						sErrBuf.c_str());
 
@@ -1928,8 +1873,7 @@ namespace Glest {
 				//world.getMapPtr()->loadGame(loadGameNode,&world);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1944,8 +1888,7 @@ namespace Glest {
 
 				gui.init(this);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1986,8 +1929,7 @@ namespace Glest {
 				perfList.push_back(perfBuf);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -2005,8 +1947,7 @@ namespace Glest {
 
 				//good_fpu_control_registers(NULL,extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] creating AI's\n",
 						extractFileFromDirectoryPath
@@ -2065,8 +2006,7 @@ namespace Glest {
 					perfList.push_back(perfBuf);
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -2119,8 +2059,7 @@ namespace Glest {
 			}
 
 			//init renderer state
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Initializing renderer\n",
 					extractFileFromDirectoryPath
@@ -2165,8 +2104,7 @@ namespace Glest {
 				::Shared::Platform::Window::handleEvent();
 				SDL_PumpEvents();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s] Waiting for network\n",
 						extractFileFromDirectoryPath
@@ -2179,8 +2117,7 @@ namespace Glest {
 
 				//std::string worldLog = world.DumpWorldToLog(true);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] Starting music stream\n",
 						extractFileFromDirectoryPath
@@ -2261,12 +2198,10 @@ namespace Glest {
 
 			logger.setCancelLoadingEnabled(false);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"================ STARTING GAME ================\n");
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPathFinder).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPathFinder))
 				SystemFlags::OutputDebug(SystemFlags::debugPathFinder,
 					"================ STARTING GAME ================\n");
 			setupPopupMenus(false);
@@ -2329,8 +2264,7 @@ namespace Glest {
 				networkManager.initServerInterfaces(this);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] ==== START GAME ==== getCurrentPixelByteCount() = "
 					MG_SIZE_T_SPECIFIER "\n",
@@ -2338,20 +2272,16 @@ namespace Glest {
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderer.getCurrentPixelByteCount());
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugWorldSynch).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 				SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 					"=============================================\n");
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugWorldSynch).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 				SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 					"==== START GAME ====\n");
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugWorldSynch).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 				SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 					"=============================================\n");
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugWorldSynch).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 				SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 					"Starting framecount: %d\n",
 					world.getFrameCount());
@@ -2580,6 +2510,7 @@ namespace Glest {
 				if (currentUIState != NULL) {
 					currentUIState->update();
 				}
+				checkSaveGameThread();
 
 				bool
 					showPerfStats =
@@ -2601,8 +2532,7 @@ namespace Glest {
 
 				Chrono chronoGamePerformanceCounts;
 				Chrono chrono;
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 					chrono.start();
 
 				// a) Updates non dependent on speed
@@ -2631,8 +2561,7 @@ namespace Glest {
 					(this->masterserverMode == true ||
 					(mainMessageBox.getEnabled() == false
 						&& errorMessageBox.getEnabled() == false))) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -2841,8 +2770,7 @@ namespace Glest {
 				addPerformanceCount("CalculateNetworkUpdateLoops",
 					chronoGamePerformanceCounts.getMillis());
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2857,8 +2785,7 @@ namespace Glest {
 					perfList.push_back(perfBuf);
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld [before ReplaceDisconnectedNetworkPlayersWithAI]\n",
@@ -2886,8 +2813,7 @@ namespace Glest {
 
 				setupPopupMenus(true);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld [after ReplaceDisconnectedNetworkPlayersWithAI]\n",
@@ -2967,8 +2893,7 @@ namespace Glest {
 											&& scriptManager.
 											getPlayerModifiers(j)->getAiEnabled() == true) {
 
-											if (SystemFlags::getSystemSettingType
-											(SystemFlags::debugPerformance).enabled
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 												&& chrono.getMillis() > 0)
 												SystemFlags::
 												OutputDebug(SystemFlags::debugPerformance,
@@ -3102,16 +3027,14 @@ namespace Glest {
 								perfList.push_back(perfBuf);
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s] Line: %d took msecs: %lld [AI updates]\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -3124,16 +3047,14 @@ namespace Glest {
 							addPerformanceCount("ProcessWorldUpdate",
 								chronoGamePerformanceCounts.getMillis());
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s] Line: %d took msecs: %lld [world update i = %d]\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis(), i);
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -3198,16 +3119,14 @@ namespace Glest {
 								perfList.push_back(perfBuf);
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s] Line: %d took msecs: %lld [commander updateNetwork i = %d]\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis(), i);
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -3219,16 +3138,14 @@ namespace Glest {
 							addPerformanceCount("ProcessGUIUpdate",
 								chronoGamePerformanceCounts.getMillis());
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s] Line: %d took msecs: %lld [gui updating i = %d]\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis(), i);
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -3246,16 +3163,14 @@ namespace Glest {
 								weatherParticleSystem->setPos(gameCamera.getPos());
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s] Line: %d took msecs: %lld [weather particle updating i = %d]\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis(), i);
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -3277,16 +3192,14 @@ namespace Glest {
 							addPerformanceCount("ProcessParticleManager",
 								chronoGamePerformanceCounts.getMillis());
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s] Line: %d took msecs: %lld [particle manager updating i = %d]\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis(), i);
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -3302,6 +3215,15 @@ namespace Glest {
 							//good_fpu_control_registers(NULL,extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__);
 						}
 					} while (commander.hasReplayCommandListForFrame() == true);
+
+					// keyframes run in this update go out to the clients in one batch
+					if (isNetworkGame == true && role == nrServer) {
+						GameNetworkInterface *gameNetworkInterface =
+							NetworkManager::getInstance().getGameNetworkInterface();
+						if (gameNetworkInterface != NULL) {
+							gameNetworkInterface->flushCommandLists();
+						}
+					}
 				}
 				//else if(role == nrClient) {
 				else {
@@ -3329,16 +3251,14 @@ namespace Glest {
 
 				//call the chat manager
 				chatManager.updateNetwork();
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld [chatManager.updateNetwork]\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -3368,8 +3288,7 @@ namespace Glest {
 					getGameNetworkInterface()->getQuit()
 					&& mainMessageBox.getEnabled() == false
 					&& errorMessageBox.getEnabled() == false) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -3758,6 +3677,12 @@ namespace Glest {
 					return;
 				}
 
+				//update headless simulation benchmark
+				if (SimulationBenchmark::isEnabled() == true &&
+					SimulationBenchmark::getInstance().updateGame(this) == true) {
+					return;
+				}
+
 				if (showPerfStats) {
 					sprintf(perfBuf,
 						"In [%s::%s] Line: %d took msecs: " MG_I64_SPECIFIER
@@ -3859,8 +3784,7 @@ namespace Glest {
 									__FUNCTION__, __LINE__, ex.what());
 
 								SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 								if (errorMessageBox.getEnabled() == false) {
@@ -3960,8 +3884,7 @@ namespace Glest {
 						__FUNCTION__, __LINE__, ex.what());
 
 					SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 					//printf("#100 quitPendingIndicator = %d, errorMessageBox.getEnabled() = %d\n",quitPendingIndicator,errorMessageBox.getEnabled());
@@ -4063,8 +3986,7 @@ namespace Glest {
 				if (switchSetupRequests[i] != NULL) {
 					//printf("Faction Index: %d Switch slot = %d to = %d current control = %d\n",i,switchSetupRequests[i]->getCurrentSlotIndex(),switchSetupRequests[i]->getToSlotIndex(),gameSettings.getFactionControl(i));
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] switchSetupRequests[i]->getSwitchFlags() = %d\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -4085,8 +4007,7 @@ namespace Glest {
 						gameSettings.getFactionControl(i) == ctNetworkUnassigned ||
 						//(gameSettings.getFactionControl(i) != ctClosed && gameSettings.getFactionControl(i) != ctHuman)) {
 						(gameSettings.getFactionControl(i) != ctHuman)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d] switchSetupRequests[i]->getToFactionIndex() = %d\n",
 								extractFileFromDirectoryPath
@@ -4173,8 +4094,7 @@ namespace Glest {
 										(__FILE__).c_str(),
 										__FUNCTION__, __LINE__,
 										e.what());
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::debugSystem,
 											"In [%s::%s Line: %d] caught exception error = [%s]\n",
 											extractFileFromDirectoryPath
@@ -4225,8 +4145,7 @@ namespace Glest {
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(),
 									__FUNCTION__, __LINE__, e.what());
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line: %d] caught exception error = [%s]\n",
 										extractFileFromDirectoryPath
@@ -4601,43 +4520,37 @@ namespace Glest {
 			}
 
 			Chrono chrono;
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
 			render3d();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %d [render3d]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			render2d();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %d [render2d]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			Renderer::getInstance().swapBuffers();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %d [swap buffers]\n",
@@ -4665,8 +4578,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				if (errorMessageBox.getEnabled() == false) {
@@ -4691,8 +4603,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				if (errorMessageBox.getEnabled() == false) {
@@ -4718,8 +4629,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				if (errorMessageBox.getEnabled() == false) {
@@ -4743,8 +4653,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				if (errorMessageBox.getEnabled() == false) {
@@ -4768,8 +4677,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				if (errorMessageBox.getEnabled() == false) {
@@ -5647,8 +5555,7 @@ namespace Glest {
 				//exit message box, has to be the last thing to do in this function
 				if (errorMessageBox.getEnabled() == true) {
 					if (errorMessageBox.mouseClick(x, y)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -5662,8 +5569,7 @@ namespace Glest {
 					int button = 0;
 					if (mainMessageBox.mouseClick(x, y, button)) {
 						if (button == 0) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -5675,8 +5581,7 @@ namespace Glest {
 							quitTriggeredIndicator = true;
 							return;
 						} else {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -5694,8 +5599,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				NetworkManager & networkManager = NetworkManager::getInstance();
@@ -5770,8 +5674,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what(), x, y);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				NetworkManager & networkManager = NetworkManager::getInstance();
@@ -5829,8 +5732,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				NetworkManager & networkManager = NetworkManager::getInstance();
@@ -5882,8 +5784,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				NetworkManager & networkManager = NetworkManager::getInstance();
@@ -6076,8 +5977,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				NetworkManager & networkManager = NetworkManager::getInstance();
@@ -6119,8 +6019,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				NetworkManager & networkManager = NetworkManager::getInstance();
@@ -6184,8 +6083,7 @@ namespace Glest {
 				string keyName = "GroupUnitsKey" + intToStr(idx);
 
 				SDL_Keycode groupHotKey = configKeys.getSDLKey(keyName.c_str());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] keyName [%s] group index = %d, key = [%c] [%d]\n",
 						extractFileFromDirectoryPath
@@ -6201,8 +6099,7 @@ namespace Glest {
 						isKeyPressed(groupHotKey, key));
 				//printf(" group key check %d   scancode:%d sym:%d groupHotKey=%d  \n",idx,key.keysym.scancode,key.keysym.sym,groupHotKey);
 				if (key.keysym.sym == groupHotKey) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -6223,8 +6120,7 @@ namespace Glest {
 			//printf("In game checking keypress for key [%d]\n",key.keysym.sym);
 
 			try {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] key = [%c] [%d] gameStarted [%d]\n",
 						extractFileFromDirectoryPath
@@ -6257,8 +6153,7 @@ namespace Glest {
 
 				if (chatManager.getEditEnabled() == false) {
 					//printf("GAME KEYDOWN #2\n");
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] key = [%d - %c]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -6492,8 +6387,7 @@ namespace Glest {
 					}
 
 					//hotkeys
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] gameCamera.getState() = %d\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -6501,8 +6395,7 @@ namespace Glest {
 							gameCamera.getState());
 
 					if (gameCamera.getState() != GameCamera::sFree) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d] key = %d\n",
 								extractFileFromDirectoryPath
@@ -6543,8 +6436,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				NetworkManager & networkManager = NetworkManager::getInstance();
@@ -6651,8 +6543,7 @@ namespace Glest {
 					__FUNCTION__, __LINE__, ex.what());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				NetworkManager & networkManager = NetworkManager::getInstance();
@@ -6716,8 +6607,7 @@ namespace Glest {
 		}
 
 		Stats Game::quitGame() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -6737,9 +6627,10 @@ namespace Glest {
 				suffix = "_server";
 			}
 			this->DumpCRCWorldLogIfRequired(suffix);
+			this->DumpMutexProfilerReportIfRequired(suffix);
+			this->DumpTraceProfileIfRequired(suffix);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled == true) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem) == true) {
 				world.DumpWorldToLog();
 			}
 			//printf("Check savegame\n");
@@ -6750,8 +6641,7 @@ namespace Glest {
 
 			Stats endStats = getEndGameStats();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -6762,8 +6652,7 @@ namespace Glest {
 			NetworkManager::getInstance().end();
 			//sleep(0);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -6860,6 +6749,103 @@ namespace Glest {
 			}
 		}
 
+		void Game::DumpMutexProfilerReportIfRequired(string fileSuffix) {
+			if (MutexProfiler::isEnabled() == false) {
+				return;
+			}
+
+			string mutexProfilerLogFile =
+				Config::getInstance().getString("MutexProfilerLogFile",
+					"mutexContention.log");
+			mutexProfilerLogFile += fileSuffix;
+
+			if (getGameReadWritePath
+			(GameConstants::path_logs_CacheLookupKey) != "") {
+				mutexProfilerLogFile =
+					getGameReadWritePath(GameConstants::path_logs_CacheLookupKey) +
+					mutexProfilerLogFile;
+			} else {
+				string
+					userData =
+					Config::getInstance().getString("UserData_Root", "");
+				if (userData != "") {
+					endPathWithSlash(userData);
+				}
+				mutexProfilerLogFile = userData + mutexProfilerLogFile;
+			}
+
+			printf("Save lock contention report to %s\n",
+				mutexProfilerLogFile.c_str());
+
+#if defined(WIN32) && !defined(__MINGW32__)
+			FILE *fp =
+				_wfopen(utf8_decode(mutexProfilerLogFile).c_str(), L"w");
+			std::ofstream logFile(fp);
+#else
+			std::ofstream logFile;
+			logFile.open(mutexProfilerLogFile.c_str(),
+				ios_base::out | ios_base::trunc);
+#endif
+			logFile << "Lock contention by lock site:" << std::endl;
+			logFile << "=============================" << std::endl;
+			logFile << "Software version: " << glestVersionString << "-" <<
+				getCompilerNameString() << std::endl;
+			logFile << "World frames: " << world.getFrameCount() << std::endl;
+			logFile << MutexProfiler::getReport();
+			logFile.close();
+#if defined(WIN32) && !defined(__MINGW32__)
+			if (fp) {
+				fclose(fp);
+			}
+#endif
+
+			// the next game gets a report of its own
+			MutexProfiler::reset();
+		}
+
+		void Game::DumpTraceProfileIfRequired(string fileSuffix) {
+			if (TraceProfiler::isEnabled() == false) {
+				return;
+			}
+
+			string traceProfilerLogFile =
+				Config::getInstance().getString("TraceProfilerLogFile",
+					"zetaglestTrace.json");
+			// keep the extension so trace viewers pick the file up
+			size_t extensionPos = traceProfilerLogFile.find_last_of('.');
+			if (extensionPos == string::npos) {
+				extensionPos = traceProfilerLogFile.size();
+			}
+			traceProfilerLogFile.insert(extensionPos, fileSuffix);
+
+			if (getGameReadWritePath
+			(GameConstants::path_logs_CacheLookupKey) != "") {
+				traceProfilerLogFile =
+					getGameReadWritePath(GameConstants::path_logs_CacheLookupKey) +
+					traceProfilerLogFile;
+			} else {
+				string
+					userData =
+					Config::getInstance().getString("UserData_Root", "");
+				if (userData != "") {
+					endPathWithSlash(userData);
+				}
+				traceProfilerLogFile = userData + traceProfilerLogFile;
+			}
+
+			printf("Save trace profile to %s\n",
+				traceProfilerLogFile.c_str());
+			try {
+				// also starts the trace of the next game
+				TraceProfiler::saveChromeTrace(traceProfilerLogFile);
+			} catch (const exception & ex) {
+				SystemFlags::OutputDebug(SystemFlags::debugError,
+					"In [%s::%s Line: %d] Error [%s]\n",
+					extractFileFromDirectoryPath(__FILE__).c_str(),
+					__FUNCTION__, __LINE__, ex.what());
+			}
+		}
+
 		void saveStatsToSteam(Game * game, Stats & endStats) {
 			Steam *steamInstance =
 				CacheManager::getCachedItem <
@@ -7019,8 +7005,7 @@ namespace Glest {
 		}
 
 		void Game::exitGameState(Program * program, Stats & endStats) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -7051,8 +7036,7 @@ namespace Glest {
 
 			ProgramState *newState = new BattleEnd(program, &endStats, game);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -7061,8 +7045,7 @@ namespace Glest {
 
 			program->setState(newState, false);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -7089,25 +7072,23 @@ namespace Glest {
 		// ==================== render ====================
 
 		void Game::render3d() {
+			TraceScope traceScope("Game::render3d");
 			Chrono chrono;
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
 			Renderer & renderer = Renderer::getInstance();
 
 			//init
 			renderer.reset3d();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [reset3d]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
@@ -7116,119 +7097,115 @@ namespace Glest {
 			//      if(SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
 
 			renderer.loadGameCameraMatrix();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [loadGameCameraMatrix]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			renderer.computeVisibleQuad();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [computeVisibleQuad]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			renderer.setupLighting();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [setupLighting]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
+				&& chrono.getMillis() > 0)
+				chrono.start();
+
+			renderer.prepareUnitInterpolation();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
+				&& chrono.getMillis() > 0)
+				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
+					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [prepareUnitInterpolation]\n",
+					extractFileFromDirectoryPath
+					(__FILE__).c_str(), __FUNCTION__, __LINE__,
+					renderFps, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//shadow map
 			renderer.renderShadowsToTexture(avgRenderFps);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderShadowsToTexture]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//clear buffers
 			renderer.clearBuffers();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d renderFps = %d took msecs: %lld\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//surface
 			renderer.renderSurface(avgRenderFps);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderSurface]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//selection circles
 			renderer.renderSelectionEffects(healthbarMode);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderSelectionEffects]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			// renderTeamColorCircle
 			if ((renderExtraTeamColor & renderTeamColorCircleBit) > 0) {
 				renderer.renderTeamColorCircle();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled && chrono.getMillis() > 0)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderObjects]\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, renderFps, chrono.getMillis());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled && chrono.getMillis() > 0)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 					chrono.start();
 			}
 
@@ -7236,92 +7213,80 @@ namespace Glest {
 
 			// renderTeamColorCircle
 			renderer.renderMorphEffects();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderObjects]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//objects
 			renderer.renderObjects(avgRenderFps);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderObjects]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//ground units
 			renderer.renderUnits(false, avgRenderFps);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderUnits]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//water
 			renderer.renderWater();
 			renderer.renderWaterEffects();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderWater]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//air units
 			renderer.renderUnits(true, avgRenderFps);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderUnits]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//particles
 			renderer.renderParticleManager(rsGame);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderParticleManager]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
@@ -7333,22 +7298,19 @@ namespace Glest {
 			// renderTeamColorPlane
 			if ((renderExtraTeamColor & renderTeamColorPlaneBit) > 0) {
 				renderer.renderTeamColorPlane();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled && chrono.getMillis() > 0)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderObjects]\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, renderFps, chrono.getMillis());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled && chrono.getMillis() > 0)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 					chrono.start();
 			}
 
 			//mouse 3d
 			renderer.renderMouse3d();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderMouse3d]\n",
@@ -7357,16 +7319,14 @@ namespace Glest {
 					renderFps, chrono.getMillis());
 
 			renderer.renderUnitsToBuild(avgRenderFps);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] renderFps = %d took msecs: %lld [renderUnitsToBuild]\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					renderFps, chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
@@ -7446,9 +7406,12 @@ namespace Glest {
 			}
 
 			str +=
-				"UnitRangeCellsLookupItemCache: " +
-				world.getUnitUpdater()->getUnitRangeCellsLookupItemCacheStats() +
+				"UnitSpatialIndex: " +
+				world.getUnitUpdater()->getUnitSpatialIndexStats() +
 				"\n";
+			str +=
+				"CellTriggerEventIndex: " +
+				scriptManager.getCellTriggerEventIndexStats() + "\n";
 			str +=
 				"ExploredCellsLookupItemCache: " +
 				world.getExploredCellsLookupItemCacheStats() + "\n";
@@ -7481,6 +7444,12 @@ namespace Glest {
 				str +=
 					"Triangle count: " + intToStr(renderer.getTriangleCount()) + "\n";
 				str += "Vertex count: " + intToStr(renderer.getPointCount()) + "\n";
+				str +=
+					"Interpolation cache hits: " +
+					intToStr(renderer.getInterpolationCacheHits()) + " misses: " +
+					intToStr(renderer.getInterpolationCacheMisses()) + "\n";
+				str +=
+					"Font metrics " + renderer.getFontMetricsCacheStats() + "\n";
 			}
 
 			str += "Frame count:" + intToStr(world.getFrameCount()) + "\n";
@@ -7578,6 +7547,7 @@ namespace Glest {
 		}
 
 		void Game::render2d() {
+			TraceScope traceScope("Game::render2d");
 			Renderer & renderer = Renderer::getInstance();
 			//Config &config= Config::getInstance();
 			CoreData & coreData = CoreData::getInstance();
@@ -7657,11 +7627,8 @@ namespace Glest {
 
 			//debug info
 			bool perfLogging = false;
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled == true
-				|| SystemFlags::getSystemSettingType(SystemFlags::
-					debugWorldSynch).enabled ==
-				true) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) == true
+				|| DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 				perfLogging = true;
 			}
 
@@ -7816,8 +7783,7 @@ namespace Glest {
 				&& difftime((long int) time(NULL), lastRenderLog2d) >= 1) {
 				lastRenderLog2d = time(NULL);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] Statistics: %s\n",
 						extractFileFromDirectoryPath
@@ -8251,8 +8217,7 @@ namespace Glest {
 				!NetworkManager::getInstance().isNetworkGame();
 			//printf("Toggle pause value = %d, speedChangesAllowed = %d, forceAllowPauseStateChange = %d\n",value,speedChangesAllowed,forceAllowPauseStateChange);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugWorldSynch).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 				SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 					"game.cpp line: %d setPaused value: %d clearCaches: %d forceAllowPauseStateChange: %d speedChangesAllowed: %d pausedForJoinGame: %d joinNetworkGame: %d\n",
 					__LINE__, value, clearCaches,
@@ -8335,8 +8300,7 @@ namespace Glest {
 					pauseStateChanged = true;
 
 					if (clearCaches == true) {
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugWorldSynch).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 							SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 								"game.cpp line: %d Clear Caches for resume in progress game\n",
 								__LINE__);
@@ -8369,8 +8333,7 @@ namespace Glest {
 
 					if (clearCaches == true) {
 						//printf("Line: %d Clear Caches for resume in progress game\n",__LINE__);
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugWorldSynch).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch))
 							SystemFlags::OutputDebug(SystemFlags::debugWorldSynch,
 								"game.cpp line: %d Clear Caches for resume in progress game\n",
 								__LINE__);
@@ -8650,7 +8613,17 @@ namespace Glest {
 		}
 
 		void Game::saveGame() {
-			string file = this->saveGame(GameConstants::saveGameFilePattern);
+			bool inBackground =
+				Config::getInstance().getBool("SaveGameInBackground", "true");
+			string file = this->saveGame(GameConstants::saveGameFilePattern, "saved/",
+				inBackground);
+			// a background save is reported once it is on disk
+			if (inBackground == false) {
+				gameSaved(file);
+			}
+		}
+
+		void Game::gameSaved(const string & file) {
 			char szBuf[8096] = "";
 			Lang & lang = Lang::getInstance();
 			snprintf(szBuf, 8096, lang.getString("GameSaved", "", true).c_str(),
@@ -8662,7 +8635,42 @@ namespace Glest {
 			config.save();
 		}
 
-		string Game::saveGame(string name, const string & path) {
+		void Game::shutdownSaveGameThread() {
+			if (saveGameThread == NULL) {
+				return;
+			}
+			// let the saves the player asked for reach the disk
+			for (time_t elapsed = time(NULL);
+				saveGameThread->getPendingTaskCount() > 0 &&
+				difftime(time(NULL), elapsed) <= 15;) {
+				sleep(5);
+			}
+			checkSaveGameThread();
+
+			saveGameThread->signalQuit();
+			if (saveGameThread->canShutdown(true) == true &&
+				saveGameThread->shutdownAndWait() == true) {
+				delete saveGameThread;
+			}
+			saveGameThread = NULL;
+		}
+
+		void Game::checkSaveGameThread() {
+			if (saveGameThread == NULL) {
+				return;
+			}
+			vector < string > completedSaves = saveGameThread->popCompletedSaves();
+			for (unsigned int i = 0; i < completedSaves.size(); ++i) {
+				gameSaved(completedSaves[i]);
+			}
+			vector < string > failedSaves = saveGameThread->popFailedSaves();
+			for (unsigned int i = 0; i < failedSaves.size(); ++i) {
+				console.addLine("Error saving game: " + failedSaves[i], true);
+			}
+		}
+
+		string Game::saveGame(string name, const string & path,
+			bool inBackground) {
 			Config & config = Config::getInstance();
 			// auto name file if using saved file pattern string
 			if (name == GameConstants::saveGameFilePattern) {
@@ -8746,9 +8754,11 @@ namespace Glest {
 				xmlTreeSaveGame.save(replayFile);
 			}
 
-			XmlTree xmlTree;
-			xmlTree.init("zetaglest-saved-game");
-			XmlNode *rootNode = xmlTree.getRootNode();
+			// the node tree is the snapshot of this frame, once it is built
+			// the world may move on while another thread writes it out
+			auto_ptr < XmlTree > xmlTree(new XmlTree());
+			xmlTree->init("zetaglest-saved-game");
+			XmlNode *rootNode = xmlTree->getRootNode();
 
 			std::map < string, string > mapTagReplacements;
 			//time_t now = time(NULL);
@@ -8948,7 +8958,24 @@ namespace Glest {
 				intToStr(disableSpeedChange),
 				mapTagReplacements);
 
-			xmlTree.save(saveGameFile);
+			// the binary format skips building a second document and
+			// printing it, loading tells both formats apart on its own
+			bool binaryFormat =
+				config.getBool("SaveGameBinaryFormat", "false");
+			int compressionLevel =
+				config.getInt("SaveGameBinaryCompressionLevel", "1");
+			if (inBackground == true) {
+				if (saveGameThread == NULL) {
+					saveGameThread = new SaveGameThread();
+					saveGameThread->start();
+				}
+				saveGameThread->addTask(xmlTree.release(), saveGameFile,
+					binaryFormat, compressionLevel);
+			} else if (binaryFormat == true) {
+				xmlTree->saveBinary(saveGameFile, compressionLevel);
+			} else {
+				xmlTree->save(saveGameFile);
+			}
 
 			if (masterserverMode == false) {
 				// take Screenshot
@@ -61,6 +61,7 @@ namespace Glest {
 
 		class GraphicMessageBox;
 		class ServerInterface;
+		class SaveGameThread;
 
 		enum LoadGameItem {
 			lgt_FactionPreview = 0x01,
@@ -223,6 +224,7 @@ namespace Glest {
 			time_t lastMasterServerGameStatsDump;
 
 			XmlNode *loadGameNode;
+			SaveGameThread *saveGameThread;
 			int lastworldFrameCountForReplay;
 			std::vector < std::pair < int, NetworkCommand > > replayCommandList;
 
@@ -355,6 +357,9 @@ namespace Glest {
 			void tryPauseToggle(bool pause);
 			void setupRenderForVideo();
 			void saveGame();
+			void gameSaved(const string & file);
+			void shutdownSaveGameThread();
+			void checkSaveGameThread();
 			const int getTotalRenderFps() const {
 				return totalRenderFps;
 			}
@@ -446,7 +451,9 @@ namespace Glest {
 			void stopStreamingVideo(const string & playVideo);
 			void stopAllVideo();
 
-			string saveGame(string name, const string & path = "saved/");
+			// inBackground leaves writing the file to the save game thread
+			string saveGame(string name, const string & path = "saved/",
+				bool inBackground = false);
 			static void
 				loadGame(string name, Program * programPtr, bool isMasterserverMode,
 					const GameSettings * joinGameSettings = NULL);
@@ -469,6 +476,8 @@ namespace Glest {
 			bool showTranslatedTechTree()const;
 
 			void DumpCRCWorldLogIfRequired(string fileSuffix = "");
+			void DumpMutexProfilerReportIfRequired(string fileSuffix = "");
+			void DumpTraceProfileIfRequired(string fileSuffix = "");
 
 			bool getDisableSpeedChange()const {
 				return disableSpeedChange;
@@ -83,8 +83,10 @@ namespace
 			ft1_network_synch_checks_verbose = 0x08,
 			ft1_network_synch_checks = 0x10,
 			ft1_allow_shared_team_units = 0x20,
-			ft1_allow_shared_team_resources = 0x40
-			//ft1_xxx = 0x80
+			ft1_allow_shared_team_resources = 0x40,
+			ft1_hierarchical_pathfinder = 0x80,
+			ft1_group_flow_field_pathfinder = 0x100
+			//ft1_xxx = 0x200
 		};
 
 		inline static bool
@@ -0,0 +1,205 @@
+//
+//	save_game_thread.cpp:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#include "save_game_thread.h"
+
+#include "xml_parser.h"
+#include "platform_util.h"
+#include "platform_common.h"
+#include "util.h"
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::PlatformCommon;
+using namespace Shared::Util;
+using namespace Shared::Xml;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		//	class SaveGameThread
+		// =====================================================
+
+		SaveGameThread::SaveGameThread() : BaseThread(), mutexTaskList(new Mutex(CODE_AT_LINE)) {
+			uniqueID = "SaveGameThread";
+			pendingTaskCount = 0;
+		}
+
+		SaveGameThread::~SaveGameThread() {
+			// anything still queued was never written, don't leak it
+			for (unsigned int index = 0; index < taskList.size(); ++index) {
+				delete taskList[index].xmlTree;
+			}
+			taskList.clear();
+
+			delete mutexTaskList;
+			mutexTaskList = NULL;
+		}
+
+		void SaveGameThread::addTask(XmlTree *xmlTree, const string &file,
+			bool binaryFormat, int compressionLevel) {
+			SaveGameTask task;
+			task.xmlTree = xmlTree;
+			task.file = file;
+			task.binaryFormat = binaryFormat;
+			task.compressionLevel = compressionLevel;
+
+			static const char *mutexOwnerId = CODE_AT_LINE;
+			MutexSafeWrapper safeMutex(mutexTaskList, mutexOwnerId);
+			taskList.push_back(task);
+			pendingTaskCount++;
+			safeMutex.ReleaseLock();
+
+			semTaskSignalled.signal();
+		}
+
+		int SaveGameThread::getPendingTaskCount() {
+			static const char *mutexOwnerId = CODE_AT_LINE;
+			MutexSafeWrapper safeMutex(mutexTaskList, mutexOwnerId);
+			return pendingTaskCount;
+		}
+
+		vector<string> SaveGameThread::popCompletedSaves() {
+			static const char *mutexOwnerId = CODE_AT_LINE;
+			MutexSafeWrapper safeMutex(mutexTaskList, mutexOwnerId);
+			vector<string> result = completedSaveList;
+			completedSaveList.clear();
+			return result;
+		}
+
+		vector<string> SaveGameThread::popFailedSaves() {
+			static const char *mutexOwnerId = CODE_AT_LINE;
+			MutexSafeWrapper safeMutex(mutexTaskList, mutexOwnerId);
+			vector<string> result = failedSaveList;
+			failedSaveList.clear();
+			return result;
+		}
+
+		void SaveGameThread::signalQuit() {
+			BaseThread::signalQuit();
+			semTaskSignalled.signal();
+		}
+
+		bool SaveGameThread::canShutdown(bool deleteSelfIfShutdownDelayed) {
+			bool ret = (getExecutingTask() == false);
+			if (ret == false && deleteSelfIfShutdownDelayed == true) {
+				setDeleteSelfOnExecutionDone(deleteSelfIfShutdownDelayed);
+				deleteSelfIfRequired();
+				signalQuit();
+			}
+
+			return ret;
+		}
+
+		void SaveGameThread::saveTask(SaveGameTask &task) {
+			Chrono chrono;
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
+
+			string tempFile = task.file + ".tmp";
+			try {
+				if (task.binaryFormat == true) {
+					task.xmlTree->saveBinary(tempFile, task.compressionLevel);
+				} else {
+					task.xmlTree->save(tempFile);
+				}
+
+				// rename only replaces an existing file in one step on posix
+				if (renameFile(tempFile, task.file) == false) {
+					removeFile(task.file);
+					if (renameFile(tempFile, task.file) == false) {
+						throw megaglest_runtime_error("Cannot rename [" + tempFile + "] to [" + task.file + "]");
+					}
+				}
+
+				static const char *mutexOwnerId = CODE_AT_LINE;
+				MutexSafeWrapper safeMutex(mutexTaskList, mutexOwnerId);
+				completedSaveList.push_back(task.file);
+			} catch (const exception &ex) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error saving game to [%s]: [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, task.file.c_str(), ex.what());
+				removeFile(tempFile);
+
+				static const char *mutexOwnerId = CODE_AT_LINE;
+				MutexSafeWrapper safeMutex(mutexTaskList, mutexOwnerId);
+				failedSaveList.push_back(ex.what());
+			}
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] saved game to [%s] in " MG_I64_SPECIFIER " msecs\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, task.file.c_str(), chrono.getMillis());
+		}
+
+		bool SaveGameThread::saveNextTask() {
+			static const char *mutexOwnerId = CODE_AT_LINE;
+			MutexSafeWrapper safeMutex(mutexTaskList, mutexOwnerId);
+			if (taskList.empty() == true) {
+				return false;
+			}
+			SaveGameTask task = taskList.front();
+			taskList.erase(taskList.begin());
+			safeMutex.ReleaseLock(true);
+
+			saveTask(task);
+			delete task.xmlTree;
+			task.xmlTree = NULL;
+
+			safeMutex.Lock();
+			pendingTaskCount--;
+			return true;
+		}
+
+		void SaveGameThread::execute() {
+			void *ptr_cpy = this->ptr;
+			bool mustDeleteSelf = false;
+			{
+				RunningStatusSafeWrapper runningStatus(this);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "SaveGame thread is running\n");
+
+				try {
+					ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
+					for (; this->getQuitStatus() == false;) {
+						semTaskSignalled.waitTillSignalled(250);
+						while (saveNextTask() == true) {
+						}
+					}
+
+					// a save the player asked for is written even when the
+					// game is shutting down
+					while (saveNextTask() == true) {
+					}
+				} catch (const exception &ex) {
+					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
+				} catch (...) {
+					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				}
+
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "SaveGame thread is exiting\n");
+				mustDeleteSelf = getDeleteSelfOnExecutionDone();
+			}
+			if (mustDeleteSelf == true) {
+				if (isThreadDeleted(ptr_cpy) == false) {
+					this->setDeleteAfterExecute(true);
+				}
+				return;
+			}
+		}
+
+	}
+}//end namespace
@@ -0,0 +1,102 @@
+//
+//	save_game_thread.h:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#ifndef _GLEST_GAME_SAVEGAMETHREAD_H_
+#define _GLEST_GAME_SAVEGAMETHREAD_H_
+
+#ifdef WIN32
+#include <winsock2.h>
+#include <winsock.h>
+#endif
+
+#include <string>
+#include <vector>
+#include "base_thread.h"
+#include "leak_dumper.h"
+
+using std::string;
+using std::vector;
+using Shared::PlatformCommon::BaseThread;
+
+namespace Shared {
+	namespace Xml {
+		class XmlTree;
+	}
+}
+
+namespace Glest {
+	namespace Game {
+
+		// a saved game snapshot waiting to be written
+		class SaveGameTask {
+		public:
+			::Shared::Xml::XmlTree *xmlTree;
+			string file;
+			bool binaryFormat;
+			int compressionLevel;
+		};
+
+		// =====================================================
+		//	class SaveGameThread
+		//
+		///	Writes saved game snapshots to disk. The game builds
+		///	the node tree at a frame boundary and hands it over,
+		///	printing or compressing it and the file I/O happen
+		///	here so the game loop does not stall. Each save goes
+		///	to a temporary file first, so a crash mid write never
+		///	leaves a half written saved game behind.
+		// =====================================================
+
+		class SaveGameThread : public BaseThread {
+		protected:
+			::Shared::Platform::Mutex *mutexTaskList;
+			::Shared::Platform::Semaphore semTaskSignalled;
+			vector<SaveGameTask> taskList;
+			// includes the task being written right now
+			int pendingTaskCount;
+			vector<string> completedSaveList;
+			vector<string> failedSaveList;
+
+			bool saveNextTask();
+			void saveTask(SaveGameTask &task);
+
+		public:
+			SaveGameThread();
+			virtual ~SaveGameThread();
+			virtual void execute();
+			virtual void signalQuit();
+			virtual bool canShutdown(bool deleteSelfIfShutdownDelayed = false);
+
+			// takes ownership of xmlTree
+			void addTask(::Shared::Xml::XmlTree *xmlTree, const string &file,
+				bool binaryFormat, int compressionLevel);
+			int getPendingTaskCount();
+			// returns the files saved since the last call
+			vector<string> popCompletedSaves();
+			// returns the errors of failed saves since the last call
+			vector<string> popFailedSaves();
+		};
+
+	}
+}//end namespace
+
+#endif
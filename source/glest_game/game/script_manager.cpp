@@ -16,6 +16,7 @@
 #include "game_camera.h"
 #include "game.h"
 #include "config.h"
+#include "simulation_benchmark.h"
 
 #include "leak_dumper.h"
 
@@ -302,7 +303,7 @@ namespace
 		void
 			ScriptManager::init(World * world, GameCamera * gameCamera,
 				const XmlNode * rootNode) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -322,6 +323,12 @@ namespace
 			//printf("In [%s::%s Line: %d]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__);
 			currentEventId = 1;
 			CellTriggerEventList.clear();
+			if (world->getMap() != NULL) {
+				cellTriggerEventIndex.init(world->getMap()->getW(),
+					world->getMap()->getH());
+			} else {
+				cellTriggerEventIndex.init(0, 0);
+			}
 			TimerTriggerEventList.clear();
 
 			//printf("In [%s::%s Line: %d]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__);
@@ -607,7 +614,7 @@ namespace
 			gameOver = false;
 			gameWon = false;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -646,8 +653,7 @@ namespace
 					string(ex.what()) + string("]\n");
 				//}
 				SystemFlags::OutputDebug(SystemFlags::debugError, sErrBuf.c_str());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						sErrBuf.c_str());
 
@@ -656,7 +662,7 @@ namespace
 					(sErrBuf.c_str(), "error", -1, -1, true));
 				thisScriptManager->onMessageBoxOk(false);
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -667,7 +673,7 @@ namespace
 
 		void
 			ScriptManager::onMessageBoxOk(bool popFront) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -720,7 +726,7 @@ namespace
 
 		void
 			ScriptManager::onResourceHarvested() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -734,7 +740,7 @@ namespace
 
 		void
 			ScriptManager::onUnitCreated(const Unit * unit) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -753,7 +759,7 @@ namespace
 
 		void
 			ScriptManager::onUnitDied(const Unit * unit) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -791,7 +797,7 @@ namespace
 
 		void
 			ScriptManager::onUnitAttacked(const Unit * unit) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -807,7 +813,7 @@ namespace
 
 		void
 			ScriptManager::onUnitAttacking(const Unit * unit) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -823,7 +829,7 @@ namespace
 
 		void
 			ScriptManager::onGameOver(bool won) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -842,7 +848,8 @@ namespace
 			if (this->rootNode != NULL) {
 				return;
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			SimulationBenchmarkTimer benchmarkTimer(sbsScriptTriggers);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] TimerTriggerEventList.size() = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -855,8 +862,7 @@ namespace
 
 				TimerTriggerEvent & event = iterMap->second;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 					SystemFlags::OutputDebug(SystemFlags::debugLUA,
 						"In [%s::%s Line: %d] event.running = %d, event.startTime = %lld, event.endTime = %lld, diff = %f\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -866,8 +872,7 @@ namespace
 						(event.endFrame - event.startFrame));
 
 				if (event.running == true) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -906,8 +911,9 @@ namespace
 			if (this->rootNode != NULL) {
 				return;
 			}
+			SimulationBenchmarkTimer benchmarkTimer(sbsScriptTriggers);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] movingUnit = %p, CellTriggerEventList.size() = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -921,13 +927,22 @@ namespace
 			if (movingUnit != NULL) {
 				//ScenarioInfo scenarioInfoStart = world->getScenario()->getInfo();
 
-				for (std::map < int, CellTriggerEvent >::iterator iterMap =
-					CellTriggerEventList.begin();
-					iterMap != CellTriggerEventList.end(); ++iterMap) {
+				// only the events the unit can set off at its position, in event
+				// id order like a walk of the whole list
+				std::set < int >
+					eventIds;
+				findCellTriggerEvents(movingUnit, eventIds);
+
+				for (std::set < int >::iterator iterSet = eventIds.begin();
+					iterSet != eventIds.end(); ++iterSet) {
+					std::map < int, CellTriggerEvent >::iterator iterMap =
+						CellTriggerEventList.find(*iterSet);
+					if (iterMap == CellTriggerEventList.end()) {
+						continue;
+					}
 					CellTriggerEvent & event = iterMap->second;
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"In [%s::%s Line: %d] movingUnit = %d, event.type = %d, movingUnit->getPos() = %s, event.sourceId = %d, event.destId = %d, event.destPos = %s\n",
 							__FILE__, __FUNCTION__, __LINE__,
@@ -959,9 +974,7 @@ namespace
 											getPos(),
 											movingUnit->
 											getPos());
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::debugLUA).
-										enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 										SystemFlags::OutputDebug(SystemFlags::debugLUA,
 											"In [%s::%s Line: %d] movingUnit = %d, event.type = %d, movingUnit->getPos() = %s, event.sourceId = %d, event.destId = %d, event.destPos = %s, destUnit->getPos() = %s, srcInDst = %d\n",
 											__FILE__,
@@ -980,9 +993,7 @@ namespace
 											srcInDst);
 
 									if (srcInDst == true) {
-										if (SystemFlags::
-											getSystemSettingType(SystemFlags::
-												debugLUA).enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 											SystemFlags::OutputDebug(SystemFlags::
 												debugLUA,
 												"In [%s::%s Line: %d]\n",
@@ -998,9 +1009,7 @@ namespace
 												destUnit->getPos(),
 												movingUnit->
 												getPos());
-										if (SystemFlags::
-											getSystemSettingType(SystemFlags::
-												debugLUA).enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 											SystemFlags::OutputDebug(SystemFlags::
 												debugLUA,
 												"In [%s::%s Line: %d] movingUnit = %d, event.type = %d, movingUnit->getPos() = %s, event.sourceId = %d, event.destId = %d, event.destPos = %s, destUnit->getPos() = %s, srcInDst = %d\n",
@@ -1044,9 +1053,7 @@ namespace
 										event.destPos,
 										movingUnit->
 										getPos());
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::debugLUA).
-									enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 									SystemFlags::OutputDebug(SystemFlags::debugLUA,
 										"In [%s::%s Line: %d] movingUnit = %d, event.type = %d, movingUnit->getPos() = %s, event.sourceId = %d, event.destId = %d, event.destPos = %s, srcInDst = %d\n",
 										__FILE__, __FUNCTION__,
@@ -1062,9 +1069,7 @@ namespace
 										srcInDst);
 
 								if (srcInDst == true) {
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::debugLUA).
-										enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 										SystemFlags::OutputDebug(SystemFlags::debugLUA,
 											"In [%s::%s Line: %d]\n",
 											extractFileFromDirectoryPath
@@ -1122,10 +1127,7 @@ namespace
 														y),
 													movingUnit->
 													getPos());
-											if (SystemFlags::
-												getSystemSettingType(SystemFlags::
-													debugLUA).
-												enabled)
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 												SystemFlags::OutputDebug(SystemFlags::
 													debugLUA,
 													"In [%s::%s Line: %d] movingUnit = %d, event.type = %d, movingUnit->getPos() = %s, event.sourceId = %d, event.destId = %d, event.destPos = %s, srcInDst = %d\n",
@@ -1157,9 +1159,7 @@ namespace
 								}
 
 								if (srcInDst == true) {
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::debugLUA).
-										enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 										SystemFlags::OutputDebug(SystemFlags::debugLUA,
 											"In [%s::%s Line: %d]\n",
 											extractFileFromDirectoryPath
@@ -1190,9 +1190,7 @@ namespace
 										getPos(),
 										movingUnit->
 										getPos());
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::debugLUA).
-									enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 									SystemFlags::OutputDebug(SystemFlags::debugLUA,
 										"In [%s::%s Line: %d] movingUnit = %d, event.type = %d, movingUnit->getPos() = %s, event.sourceId = %d, event.destId = %d, event.destPos = %s, srcInDst = %d\n",
 										__FILE__, __FUNCTION__,
@@ -1208,9 +1206,7 @@ namespace
 										srcInDst);
 
 								if (srcInDst == true) {
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::debugLUA).
-										enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 										SystemFlags::OutputDebug(SystemFlags::debugLUA,
 											"In [%s::%s Line: %d]\n",
 											extractFileFromDirectoryPath
@@ -1223,9 +1219,7 @@ namespace
 										isNextToUnitTypeCells(destUnit->getType(),
 											destUnit->getPos(),
 											movingUnit->getPos());
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::debugLUA).
-										enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 										SystemFlags::OutputDebug(SystemFlags::debugLUA,
 											"In [%s::%s Line: %d] movingUnit = %d, event.type = %d, movingUnit->getPos() = %s, event.sourceId = %d, event.destId = %d, event.destPos = %s, destUnit->getPos() = %s, srcInDst = %d\n",
 											__FILE__,
@@ -1265,9 +1259,7 @@ namespace
 										movingUnit->
 										getPos());
 								if (srcInDst == true) {
-									if (SystemFlags::
-										getSystemSettingType(SystemFlags::debugLUA).
-										enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 										SystemFlags::OutputDebug(SystemFlags::debugLUA,
 											"In [%s::%s Line: %d]\n",
 											extractFileFromDirectoryPath
@@ -1328,9 +1320,7 @@ namespace
 													movingUnit->
 													getPos());
 											if (srcInDst == true) {
-												if (SystemFlags::
-													getSystemSettingType
-													(SystemFlags::debugLUA).enabled)
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 													SystemFlags::
 													OutputDebug(SystemFlags::
 														debugLUA,
@@ -1381,10 +1371,7 @@ namespace
 												Vec2i(x, y),
 												movingUnit->getPos());
 										if (srcInDst == true) {
-											if (SystemFlags::
-												getSystemSettingType(SystemFlags::
-													debugLUA).
-												enabled)
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 												SystemFlags::OutputDebug(SystemFlags::
 													debugLUA,
 													"In [%s::%s Line: %d]\n",
@@ -1399,6 +1386,9 @@ namespace
 											event.eventStateInfo[movingUnit->
 												getId()] =
 												Vec2i(x, y).getString();
+											cellTriggerEventIndex.
+												setUnitInsideArea(iterMap->first,
+													movingUnit->getId(), true);
 										}
 									}
 								}
@@ -1425,10 +1415,7 @@ namespace
 												Vec2i(x, y),
 												movingUnit->getPos());
 										if (srcInDst == true) {
-											if (SystemFlags::
-												getSystemSettingType(SystemFlags::
-													debugLUA).
-												enabled)
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 												SystemFlags::OutputDebug(SystemFlags::
 													debugLUA,
 													"In [%s::%s Line: %d]\n",
@@ -1453,6 +1440,9 @@ namespace
 										movingUnit->getId();
 
 									event.eventStateInfo.erase(movingUnit->getId());
+									cellTriggerEventIndex.
+										setUnitInsideArea(iterMap->first,
+											movingUnit->getId(), false);
 								}
 							}
 						}
@@ -1461,8 +1451,7 @@ namespace
 					}
 
 					if (triggerEvent == true) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugLUA).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 							SystemFlags::OutputDebug(SystemFlags::debugLUA,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -1474,6 +1463,10 @@ namespace
 
 						luaScript.beginCall("cellTriggerEvent");
 						luaScript.endCall();
+
+						// events the script registered, or the unit it moved, are
+						// picked up like the walk of the whole list did
+						findCellTriggerEvents(movingUnit, eventIds);
 					}
 
 					//                      ScenarioInfo scenarioInfoEnd = world->getScenario()->getInfo();
@@ -1530,7 +1523,7 @@ namespace
 		void
 			ScriptManager::networkSetCameraPositionForFaction(int factionIndex,
 				const Vec2i & pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1544,7 +1537,7 @@ namespace
 		void
 			ScriptManager::networkSetCameraPositionForTeam(int teamIndex,
 				const Vec2i & pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1584,7 +1577,7 @@ namespace
 		}
 		void
 			ScriptManager::addConsoleLangText(const char *fmt, ...) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1607,7 +1600,7 @@ namespace
 
 		void
 			ScriptManager::DisplayFormattedText(const char *fmt, ...) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1629,7 +1622,7 @@ namespace
 		}
 		void
 			ScriptManager::DisplayFormattedLangText(const char *fmt, ...) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1651,7 +1644,7 @@ namespace
 		}
 		void
 			ScriptManager::setCameraPosition(const Vec2i & pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1663,7 +1656,7 @@ namespace
 		void
 			ScriptManager::shakeCamera(int shakeIntensity, int shakeDuration,
 				bool cameraDistanceAffected, int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1686,7 +1679,7 @@ namespace
 		void
 			ScriptManager::createUnit(const string & unitName, int factionIndex,
 				Vec2i pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%s] factionIndex = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1698,7 +1691,7 @@ namespace
 		void
 			ScriptManager::createUnitNoSpacing(const string & unitName,
 				int factionIndex, Vec2i pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%s] factionIndex = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1710,7 +1703,7 @@ namespace
 		void
 			ScriptManager::setLockedUnitForFaction(const string & unitName,
 				int factionIndex, bool lock) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%s] factionIndex = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1733,7 +1726,7 @@ namespace
 
 		void
 			ScriptManager::destroyUnit(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1755,7 +1748,7 @@ namespace
 		}
 		void
 			ScriptManager::giveKills(int unitId, int amount) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1771,7 +1764,7 @@ namespace
 
 		void
 			ScriptManager::playStaticSound(const string & playSound) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] playSound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1781,7 +1774,7 @@ namespace
 		}
 		void
 			ScriptManager::playStreamingSound(const string & playSound) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] playSound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1792,7 +1785,7 @@ namespace
 
 		void
 			ScriptManager::stopStreamingSound(const string & playSound) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] playSound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1803,7 +1796,7 @@ namespace
 
 		void
 			ScriptManager::stopAllSound() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1813,7 +1806,7 @@ namespace
 
 		void
 			ScriptManager::playStaticVideo(const string & playVideo) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] playVideo [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1823,7 +1816,7 @@ namespace
 		}
 		void
 			ScriptManager::playStreamingVideo(const string & playVideo) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] playVideo [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1834,7 +1827,7 @@ namespace
 
 		void
 			ScriptManager::stopStreamingVideo(const string & playVideo) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] playVideo [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1845,7 +1838,7 @@ namespace
 
 		void
 			ScriptManager::stopAllVideo() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1855,7 +1848,7 @@ namespace
 
 		void
 			ScriptManager::togglePauseGame(int pauseStatus) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] pauseStatus = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1867,7 +1860,7 @@ namespace
 		void
 			ScriptManager::morphToUnit(int unitId, const string & morphName,
 				int ignoreRequirements) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%d] morphName [%s] forceUpgradesIfRequired = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1879,7 +1872,7 @@ namespace
 
 		void
 			ScriptManager::moveToUnit(int unitId, int destUnitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%d] destUnitId [%d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1892,7 +1885,7 @@ namespace
 		void
 			ScriptManager::giveResource(const string & resourceName,
 				int factionIndex, int amount) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1905,7 +1898,7 @@ namespace
 			ScriptManager::givePositionCommand(int unitId,
 				const string & commandName,
 				const Vec2i & pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1916,7 +1909,7 @@ namespace
 
 		void
 			ScriptManager::giveAttackCommand(int unitId, int unitToAttackId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1928,7 +1921,7 @@ namespace
 		void
 			ScriptManager::giveProductionCommand(int unitId,
 				const string & producedName) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1940,7 +1933,7 @@ namespace
 		void
 			ScriptManager::giveUpgradeCommand(int unitId,
 				const string & producedName) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1953,7 +1946,7 @@ namespace
 			ScriptManager::giveAttackStoppedCommand(int unitId,
 				const string & itemName,
 				int ignoreRequirements) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1965,7 +1958,7 @@ namespace
 
 		void
 			ScriptManager::disableAi(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1979,7 +1972,7 @@ namespace
 
 		void
 			ScriptManager::enableAi(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2001,7 +1994,7 @@ namespace
 
 		void
 			ScriptManager::disableConsume(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2014,7 +2007,7 @@ namespace
 
 		void
 			ScriptManager::enableConsume(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2045,9 +2038,9 @@ namespace
 
 			int
 				eventId = currentEventId++;
-			CellTriggerEventList[eventId] = trigger;
+			addCellTriggerEvent(eventId, trigger);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] Unit: %d will trigger cell event when reaching unit: %d, eventId = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2069,9 +2062,9 @@ namespace
 
 			int
 				eventId = currentEventId++;
-			CellTriggerEventList[eventId] = trigger;
+			addCellTriggerEvent(eventId, trigger);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] Unit: %d will trigger cell event when reaching pos: %s, eventId = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2097,9 +2090,9 @@ namespace
 
 			int
 				eventId = currentEventId++;
-			CellTriggerEventList[eventId] = trigger;
+			addCellTriggerEvent(eventId, trigger);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] Unit: %d will trigger cell event when reaching pos: %s, eventId = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2122,9 +2115,9 @@ namespace
 
 			int
 				eventId = currentEventId++;
-			CellTriggerEventList[eventId] = trigger;
+			addCellTriggerEvent(eventId, trigger);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] Faction: %d will trigger cell event when reaching unit: %d, eventId = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2146,9 +2139,9 @@ namespace
 
 			int
 				eventId = currentEventId++;
-			CellTriggerEventList[eventId] = trigger;
+			addCellTriggerEvent(eventId, trigger);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]Faction: %d will trigger cell event when reaching pos: %s, eventId = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2174,9 +2167,9 @@ namespace
 
 			int
 				eventId = currentEventId++;
-			CellTriggerEventList[eventId] = trigger;
+			addCellTriggerEvent(eventId, trigger);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]Faction: %d will trigger cell event when reaching pos: %s, eventId = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2200,9 +2193,9 @@ namespace
 
 			int
 				eventId = currentEventId++;
-			CellTriggerEventList[eventId] = trigger;
+			addCellTriggerEvent(eventId, trigger);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] trigger cell event when reaching pos: %s, eventId = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2227,7 +2220,7 @@ namespace
 			ScriptManager::unregisterCellTriggerEvent(int eventId) {
 			if (CellTriggerEventList.find(eventId) != CellTriggerEventList.end()) {
 				if (inCellTriggerEvent == false) {
-					CellTriggerEventList.erase(eventId);
+					eraseCellTriggerEvent(eventId);
 				} else {
 					unRegisterCellTriggerEventList.push_back(eventId);
 				}
@@ -2239,13 +2232,92 @@ namespace
 						i < (int) unRegisterCellTriggerEventList.size(); ++i) {
 						int
 							delayedEventId = unRegisterCellTriggerEventList[i];
-						CellTriggerEventList.erase(delayedEventId);
+						eraseCellTriggerEvent(delayedEventId);
 					}
 					unRegisterCellTriggerEventList.clear();
 				}
 			}
 		}
 
+		void
+			ScriptManager::addCellTriggerEvent(int eventId,
+				const CellTriggerEvent & event) {
+			std::map < int, CellTriggerEvent >::iterator iterFind =
+				CellTriggerEventList.find(eventId);
+			if (iterFind != CellTriggerEventList.end()) {
+				indexCellTriggerEvent(eventId, iterFind->second, false);
+			}
+			CellTriggerEventList[eventId] = event;
+			indexCellTriggerEvent(eventId, event, true);
+		}
+
+		void
+			ScriptManager::eraseCellTriggerEvent(int eventId) {
+			std::map < int, CellTriggerEvent >::iterator iterFind =
+				CellTriggerEventList.find(eventId);
+			if (iterFind != CellTriggerEventList.end()) {
+				indexCellTriggerEvent(eventId, iterFind->second, false);
+				CellTriggerEventList.erase(iterFind);
+			}
+		}
+
+		void
+			ScriptManager::indexCellTriggerEvent(int eventId,
+				const CellTriggerEvent & event, bool add) {
+			switch (event.type) {
+				case ctet_Unit:
+				case ctet_UnitPos:
+				case ctet_UnitAreaPos:
+					if (add == true) {
+						cellTriggerEventIndex.addUnitEvent(eventId, event.sourceId);
+					} else {
+						cellTriggerEventIndex.removeUnitEvent(eventId, event.sourceId);
+					}
+					break;
+				case ctet_Faction:
+					if (add == true) {
+						cellTriggerEventIndex.addFactionEvent(eventId, event.sourceId);
+					} else {
+						cellTriggerEventIndex.removeFactionEvent(eventId,
+							event.sourceId);
+					}
+					break;
+				case ctet_FactionPos:
+				case ctet_FactionAreaPos:
+				case ctet_AreaPos:
+				{
+					// a location event is set off from its one cell
+					Vec2i
+						posEnd = (event.type == ctet_FactionPos ?
+							event.destPos : event.destPosEnd);
+					if (add == true) {
+						cellTriggerEventIndex.addAreaEvent(eventId, event.destPos,
+							posEnd);
+						for (std::map < int, string >::const_iterator iterMap =
+							event.eventStateInfo.begin();
+							iterMap != event.eventStateInfo.end(); ++iterMap) {
+							cellTriggerEventIndex.setUnitInsideArea(eventId,
+								iterMap->first, true);
+						}
+					} else {
+						cellTriggerEventIndex.removeAreaEvent(eventId,
+							event.destPos, posEnd);
+					}
+				}
+				break;
+			}
+		}
+
+		void
+			ScriptManager::findCellTriggerEvents(Unit * movingUnit,
+				std::set < int > &eventIds) const {
+			cellTriggerEventIndex.findEvents(movingUnit->getId(),
+				movingUnit->getFactionIndex(),
+				movingUnit->getPos(),
+				movingUnit->getType()->getSize(),
+				eventIds);
+		}
+
 		int
 			ScriptManager::startTimerEvent() {
 			TimerTriggerEvent
@@ -2260,7 +2332,7 @@ namespace
 				eventId = currentEventId++;
 			TimerTriggerEventList[eventId] = trigger;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] TimerTriggerEventList.size() = %d, eventId = %d, trigger.startTime = %lld, trigger.endTime = %lld\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2287,7 +2359,7 @@ namespace
 				eventId = currentEventId++;
 			TimerTriggerEventList[eventId] = trigger;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] TimerTriggerEventList.size() = %d, eventId = %d, trigger.startTime = %lld, trigger.endTime = %lld\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2314,8 +2386,7 @@ namespace
 				trigger.endFrame = 0;
 				trigger.running = true;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 					SystemFlags::OutputDebug(SystemFlags::debugLUA,
 						"In [%s::%s Line: %d] TimerTriggerEventList.size() = %d, eventId = %d, trigger.startTime = %lld, trigger.endTime = %lld, result = %d\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -2340,8 +2411,7 @@ namespace
 				trigger.running = false;
 				result = getTimerEventSecondsElapsed(eventId);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 					SystemFlags::OutputDebug(SystemFlags::debugLUA,
 						"In [%s::%s Line: %d] TimerTriggerEventList.size() = %d, eventId = %d, trigger.startTime = %lld, trigger.endTime = %lld, result = %d\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -2382,7 +2452,7 @@ namespace
 
 		void
 			ScriptManager::setPlayerAsWinner(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2396,7 +2466,7 @@ namespace
 
 		void
 			ScriptManager::endGame() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2439,7 +2509,7 @@ namespace
 
 		Vec2i
 			ScriptManager::getStartLocation(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2451,7 +2521,7 @@ namespace
 
 		Vec2i
 			ScriptManager::getUnitPosition(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2460,7 +2530,7 @@ namespace
 			Vec2i
 				result = world->getUnitPosition(unitId);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s] unitId = %d, pos [%s]\n",
 					__FUNCTION__, unitId,
@@ -2471,7 +2541,7 @@ namespace
 
 		void
 			ScriptManager::setUnitPosition(int unitId, Vec2i pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2484,7 +2554,7 @@ namespace
 			ScriptManager::addCellMarker(Vec2i pos, int factionIndex,
 				const string & note,
 				const string & textureFile) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2495,7 +2565,7 @@ namespace
 
 		void
 			ScriptManager::removeCellMarker(Vec2i pos, int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2508,7 +2578,7 @@ namespace
 			ScriptManager::showMarker(Vec2i pos, int factionIndex,
 				const string & note,
 				const string & textureFile, int flashCount) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2519,7 +2589,7 @@ namespace
 
 		int
 			ScriptManager::getIsUnitAlive(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2530,7 +2600,7 @@ namespace
 
 		int
 			ScriptManager::getUnitFaction(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2540,7 +2610,7 @@ namespace
 		}
 		const string
 			ScriptManager::getUnitName(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2558,7 +2628,7 @@ namespace
 
 		const string
 			ScriptManager::getUnitDisplayName(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2570,7 +2640,7 @@ namespace
 		int
 			ScriptManager::getResourceAmount(const string & resourceName,
 				int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2582,7 +2652,7 @@ namespace
 		const
 			string &
 			ScriptManager::getLastCreatedUnitName() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2655,7 +2725,7 @@ namespace
 
 		int
 			ScriptManager::getLastCreatedUnitId() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2667,7 +2737,7 @@ namespace
 		const
 			string &
 			ScriptManager::getLastDeadUnitName() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2678,7 +2748,7 @@ namespace
 
 		int
 			ScriptManager::getLastDeadUnitId() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2689,7 +2759,7 @@ namespace
 
 		int
 			ScriptManager::getLastDeadUnitCauseOfDeath() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2701,7 +2771,7 @@ namespace
 		const
 			string &
 			ScriptManager::getLastDeadUnitKillerName() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2712,7 +2782,7 @@ namespace
 
 		int
 			ScriptManager::getLastDeadUnitKillerId() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2724,7 +2794,7 @@ namespace
 		const
 			string &
 			ScriptManager::getLastAttackedUnitName() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2735,7 +2805,7 @@ namespace
 
 		int
 			ScriptManager::getLastAttackedUnitId() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2747,7 +2817,7 @@ namespace
 		const
 			string &
 			ScriptManager::getLastAttackingUnitName() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2758,7 +2828,7 @@ namespace
 
 		int
 			ScriptManager::getLastAttackingUnitId() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2769,7 +2839,7 @@ namespace
 
 		int
 			ScriptManager::getUnitCount(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2781,7 +2851,7 @@ namespace
 		int
 			ScriptManager::getUnitCountOfType(int factionIndex,
 				const string & typeName) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2792,7 +2862,7 @@ namespace
 
 		const string
 			ScriptManager::getSystemMacroValue(const string & key) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2803,7 +2873,7 @@ namespace
 
 		const string
 			ScriptManager::getFactionName(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2814,7 +2884,7 @@ namespace
 
 		const string
 			ScriptManager::getPlayerName(int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2825,7 +2895,7 @@ namespace
 
 		void
 			ScriptManager::loadScenario(const string & name, bool keepFactions) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2839,7 +2909,7 @@ namespace
 			ScriptManager::getUnitsForFaction(int factionIndex,
 				const string & commandTypeName,
 				int field) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2851,7 +2921,7 @@ namespace
 
 		int
 			ScriptManager::getUnitCurrentField(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2863,7 +2933,7 @@ namespace
 
 		int
 			ScriptManager::isFreeCellsOrHasUnit(int field, int unitId, Vec2i pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2883,7 +2953,7 @@ namespace
 					static_cast <Field> (field),
 					unit);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s] unitId = %d, [%s] pos [%s] field = %d result = %d\n",
 					__FUNCTION__, unitId,
@@ -2895,7 +2965,7 @@ namespace
 
 		int
 			ScriptManager::isFreeCells(int unitSize, int field, Vec2i pos) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2907,7 +2977,7 @@ namespace
 					static_cast <Field> (field),
 					NULL);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s] unitSize = %d, pos [%s] field = %d result = %d\n",
 					__FUNCTION__, unitSize,
@@ -2918,7 +2988,7 @@ namespace
 
 		int
 			ScriptManager::getHumanFactionId() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2930,7 +3000,7 @@ namespace
 		void
 			ScriptManager::highlightUnit(int unitId, float radius, float thickness,
 				Vec4f color) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2942,7 +3012,7 @@ namespace
 
 		void
 			ScriptManager::unhighlightUnit(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2954,7 +3024,7 @@ namespace
 
 		void
 			ScriptManager::giveStopCommand(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2965,7 +3035,7 @@ namespace
 
 		bool
 			ScriptManager::selectUnit(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2976,7 +3046,7 @@ namespace
 
 		bool
 			ScriptManager::isBuilding(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2987,7 +3057,7 @@ namespace
 
 		void
 			ScriptManager::unselectUnit(int unitId) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2998,7 +3068,7 @@ namespace
 
 		void
 			ScriptManager::addUnitToGroupSelection(int unitId, int groupIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3008,7 +3078,7 @@ namespace
 		}
 		void
 			ScriptManager::recallGroupSelection(int groupIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3018,7 +3088,7 @@ namespace
 		}
 		void
 			ScriptManager::removeUnitFromGroupSelection(int unitId, int groupIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3029,7 +3099,7 @@ namespace
 
 		void
 			ScriptManager::setAttackWarningsEnabled(bool enabled) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3040,7 +3110,7 @@ namespace
 
 		bool
 			ScriptManager::getAttackWarningsEnabled() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3228,6 +3298,7 @@ namespace
 		void
 			ScriptManager::onDayNightTriggerEvent() {
 			if (registeredDayNightEvent == true) {
+				SimulationBenchmarkTimer benchmarkTimer(sbsScriptTriggers);
 				bool
 					isDay = (this->getIsDayTime() == 1);
 				if ((lastDayNightTriggerStatus != 1 && isDay == true) ||
@@ -3249,7 +3320,7 @@ namespace
 
 		int
 			ScriptManager::getIsDayTime() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3266,7 +3337,7 @@ namespace
 		}
 		int
 			ScriptManager::getIsNightTime() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3285,7 +3356,7 @@ namespace
 			ScriptManager::getTimeOfDay() {
 			//printf("File: %s line: %d\n",extractFileFromDirectoryPath(__FILE__).c_str(),__LINE__);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3555,7 +3626,7 @@ namespace
 			LuaArguments
 				luaArguments(luaHandle);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%s] factionIndex = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3608,8 +3679,7 @@ namespace
 				+ string(mgErr->what());
 
 			SystemFlags::OutputDebug(SystemFlags::debugError, sErrBuf.c_str());
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem, sErrBuf.c_str());
 
 			thisScriptManager->
@@ -3627,7 +3697,7 @@ namespace
 			LuaArguments
 				luaArguments(luaHandle);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%s] factionIndex = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3651,7 +3721,7 @@ namespace
 			LuaArguments
 				luaArguments(luaHandle);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3672,7 +3742,7 @@ namespace
 			LuaArguments
 				luaArguments(luaHandle);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%s] factionIndex = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3699,7 +3769,7 @@ namespace
 			LuaArguments
 				luaArguments(luaHandle);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3721,7 +3791,7 @@ namespace
 			LuaArguments
 				luaArguments(luaHandle);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%d] morphName [%s] forceUpgrade = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3746,7 +3816,7 @@ namespace
 			LuaArguments
 				luaArguments(luaHandle);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] unit [%d] dest unit [%d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3768,7 +3838,7 @@ namespace
 			ScriptManager::playStaticSound(LuaHandle * luaHandle) {
 			LuaArguments
 				luaArguments(luaHandle);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] sound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3788,7 +3858,7 @@ namespace
 			ScriptManager::playStreamingSound(LuaHandle * luaHandle) {
 			LuaArguments
 				luaArguments(luaHandle);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] sound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3808,7 +3878,7 @@ namespace
 			ScriptManager::stopStreamingSound(LuaHandle * luaHandle) {
 			LuaArguments
 				luaArguments(luaHandle);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] sound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3828,7 +3898,7 @@ namespace
 			ScriptManager::stopAllSound(LuaHandle * luaHandle) {
 			LuaArguments
 				luaArguments(luaHandle);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3847,7 +3917,7 @@ namespace
 			ScriptManager::playStaticVideo(LuaHandle * luaHandle) {
 			LuaArguments
 				luaArguments(luaHandle);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] sound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3867,7 +3937,7 @@ namespace
 			ScriptManager::playStreamingVideo(LuaHandle * luaHandle) {
 			LuaArguments
 				luaArguments(luaHandle);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] sound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3887,7 +3957,7 @@ namespace
 			ScriptManager::stopStreamingVideo(LuaHandle * luaHandle) {
 			LuaArguments
 				luaArguments(luaHandle);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] sound [%s]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3908,7 +3978,7 @@ namespace
 			LuaArguments
 				luaArguments(luaHandle);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3927,7 +3997,7 @@ namespace
 			ScriptManager::togglePauseGame(LuaHandle * luaHandle) {
 			LuaArguments
 				luaArguments(luaHandle);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d] value = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -4986,7 +5056,7 @@ namespace
 
 		int
 			ScriptManager::DisplayFormattedText(LuaHandle * luaHandle) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -5007,8 +5077,7 @@ namespace
 					//va_list argList;
 					//va_start(argList, fmt.c_str() );
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"DisplayFormattedText args = %d!\n",
 							args);
@@ -5172,7 +5241,7 @@ namespace
 
 		int
 			ScriptManager::addConsoleLangText(LuaHandle * luaHandle) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -5193,8 +5262,7 @@ namespace
 					//va_list argList;
 					//va_start(argList, fmt.c_str() );
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"DisplayFormattedText args = %d!\n",
 							args);
@@ -5339,7 +5407,7 @@ namespace
 
 		int
 			ScriptManager::DisplayFormattedLangText(LuaHandle * luaHandle) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -5360,8 +5428,7 @@ namespace
 					//va_list argList;
 					//va_start(argList, fmt.c_str() );
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"DisplayFormattedText args = %d!\n",
 							args);
@@ -5608,7 +5675,7 @@ namespace
 
 		int
 			ScriptManager::getHumanFactionId(LuaHandle * luaHandle) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 				SystemFlags::OutputDebug(SystemFlags::debugLUA,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -6388,8 +6455,8 @@ namespace
 				CellTriggerEvent
 					event;
 				event.loadGame(node);
-				CellTriggerEventList[node->getAttribute("key")->getIntValue()] =
-					event;
+				addCellTriggerEvent(node->getAttribute("key")->getIntValue(),
+					event);
 			}
 
 			//      std::map<int,TimerTriggerEvent> TimerTriggerEventList;
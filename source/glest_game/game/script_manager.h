@@ -22,7 +22,9 @@
 #   include "lua_script.h"
 #   include "components.h"
 #   include "game_constants.h"
+#   include "cell_trigger_index.h"
 #   include <map>
+#   include <set>
 #   include "xml_parser.h"
 #   include "randomgen.h"
 #   include "leak_dumper.h"
@@ -340,6 +342,9 @@ namespace
 			std::map < int,
 				CellTriggerEvent >
 				CellTriggerEventList;
+			// what a moving unit checks instead of every cell trigger event
+			CellTriggerEventIndex
+				cellTriggerEventIndex;
 			std::map < int,
 				TimerTriggerEvent >
 				TimerTriggerEventList;
@@ -375,6 +380,18 @@ namespace
 			static ScriptManager *
 				thisScriptManager;
 
+		private:
+			void
+				addCellTriggerEvent(int eventId, const CellTriggerEvent & event);
+			void
+				eraseCellTriggerEvent(int eventId);
+			void
+				indexCellTriggerEvent(int eventId, const CellTriggerEvent & event,
+					bool add);
+			void
+				findCellTriggerEvents(Unit * movingUnit,
+					std::set < int > &eventIds) const;
+
 		private:
 			static const int
 				messageWrapCount;
@@ -442,6 +459,11 @@ namespace
 				getGameWon() const;
 			bool
 				getIsGameOver() const;
+			string
+				getCellTriggerEventIndexStats() const {
+				return
+					cellTriggerEventIndex.getStats();
+			}
 
 			void
 				saveGame(XmlNode * rootNode);
@@ -367,8 +367,7 @@ namespace Glest {
 					"In [%s::%s Line: %d] Error [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] ERROR trying to auto-create cfgFile.second = [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -382,8 +381,7 @@ namespace Glest {
 			string custom_path) {
 			if (configList.find(type.first) == configList.end()) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -391,8 +389,7 @@ namespace Glest {
 				Config config(type, file, fileMustExist, custom_path);
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -401,8 +398,7 @@ namespace Glest {
 					Config >::value_type(type.first, config));
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -422,8 +418,7 @@ namespace Glest {
 
 		void Config::reload() {
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -436,8 +431,7 @@ namespace Glest {
 				std::make_pair(true, false), custom_path_parameter);
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -446,8 +440,7 @@ namespace Glest {
 			CopyAll(&newconfig, &oldconfig);
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1181,8 +1181,7 @@ namespace Glest {
 					"FontDisplay", "FontDisplayFamily",
 					"displayFont3D");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] displayFontName = [%s] displayFontSize = %d\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1220,8 +1219,7 @@ namespace Glest {
 					displayFontNameSmallSize, "FontSmallDisplay",
 					"FontSmallDisplayFamily", "displayFontSmall3D");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] displayFontSmallName = [%s] displayFontSmallNameSize = %d\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1258,8 +1256,7 @@ namespace Glest {
 					menuFontNameNormalSize, "FontMenuNormal",
 					"FontMenuNormalFamily", "menuFontNormal3D");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] menuFontNormalName = [%s] menuFontNormalNameSize = %d\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1294,8 +1291,7 @@ namespace Glest {
 					menuFontNameBigSize, "FontMenuBig",
 					"FontMenuBigFamily", "menuFontBig3D");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] menuFontNameBig = [%s] menuFontNameBigSize = %d\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1333,8 +1329,7 @@ namespace Glest {
 					menuFontNameVeryBigSize, "FontMenuVeryBig",
 					"FontMenuVeryBigFamily", "menuFontVeryBig3D");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] menuFontNameVeryBig = [%s] menuFontNameVeryBigSize = %d\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1370,8 +1365,7 @@ namespace Glest {
 					consoleFontNameSize, "FontConsole",
 					"FontConsoleFamily", "consoleFont3D");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] consoleFontName = [%s] consoleFontNameSize = %d\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1427,8 +1421,7 @@ namespace Glest {
 					rs = 10;
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] fontsize original %d      calculated:%d   \n",
 					__FILE__, __FUNCTION__, __LINE__, size, rs);
@@ -1438,8 +1431,7 @@ namespace Glest {
 		void CoreData::saveGameSettingsToFile(std::string fileName,
 			GameSettings * gameSettings,
 			int advancedIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -1451,8 +1443,7 @@ namespace Glest {
 			}
 			fileName = userData + fileName;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] fileName = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1565,8 +1556,7 @@ namespace Glest {
 			if (fp)
 				fclose(fp);
 #endif
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -1574,8 +1564,7 @@ namespace Glest {
 
 		bool CoreData::loadGameSettingsFromFile(std::string fileName,
 			GameSettings * gameSettings) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -1591,8 +1580,7 @@ namespace Glest {
 				fileWasFound = true;
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] fileName = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1603,8 +1591,7 @@ namespace Glest {
 			}
 
 			fileWasFound = true;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] fileName = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1613,8 +1600,7 @@ namespace Glest {
 			Properties properties;
 			properties.load(fileName);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] fileName = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -1663,6 +1649,22 @@ namespace Glest {
 				gameSettings->setFlagTypes1(valueFlags1);
 
 			}
+			if (Config::getInstance().
+				getBool("EnableHierarchicalPathfinder", "false") == true) {
+				valueFlags1 |= ft1_hierarchical_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			} else {
+				valueFlags1 &= ~ft1_hierarchical_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			}
+			if (Config::getInstance().
+				getBool("EnableGroupFlowFieldPathfinder", "false") == true) {
+				valueFlags1 |= ft1_group_flow_field_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			} else {
+				valueFlags1 &= ~ft1_group_flow_field_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			}
 
 
 			gameSettings->setEnableObserverModeAtEndGame(properties.
@@ -1742,8 +1744,7 @@ namespace Glest {
 					("FactionTypeNameForIndex")
 						+ intToStr(i), "?"));
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] i = %d, factionTypeName [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__, i,
@@ -1767,8 +1768,7 @@ namespace Glest {
 						+ intToStr(i), ""));
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n", __FILE__,
 					__FUNCTION__, __LINE__);
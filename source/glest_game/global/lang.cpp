@@ -229,8 +229,7 @@ namespace Glest {
 				return;
 			} else if (fileExists(languageFile) == false
 				&& fallbackToDefault == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] path = [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -255,8 +254,7 @@ namespace Glest {
 
 		void Lang::loadScenarioStrings(string scenarioDir, string scenarioName,
 			bool isTutorial) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] scenarioDir = [%s] scenarioName = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -296,8 +294,7 @@ namespace Glest {
 				scenarioFolder = extractDirectoryPathFromFile(scenarioDir);
 				path = scenarioFolder + scenarioName + "_" + language + ".lng";
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] path = [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -312,8 +309,7 @@ namespace Glest {
 
 				scenarioStrings.load(path);
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] path not found [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -321,8 +317,7 @@ namespace Glest {
 
 				//try english otherwise
 				path = scenarioFolder + scenarioName + "_english.lng";
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] path = [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -337,8 +332,7 @@ namespace Glest {
 		}
 
 		bool Lang::loadTechTreeStrings(string techTree, bool forceLoad) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] techTree = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -371,8 +365,7 @@ namespace Glest {
 				techTreeFolder + "lang/" + techTree + "_" + language + ".lng";
 			string pathDefault =
 				techTreeFolder + "lang/" + techTree + "_default.lng";
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] path = [%s] pathDefault = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -400,8 +393,7 @@ namespace Glest {
 					techNameLoaded = techTree;
 				}
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] path not found [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -412,8 +404,7 @@ namespace Glest {
 				path =
 					techTreeFolder + "lang/" + techTree + "_" + default_language +
 					".lng";
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] path = [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -466,8 +457,7 @@ namespace Glest {
 		}
 
 		void Lang::loadTilesetStrings(string tileset) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] tileset = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -493,8 +483,7 @@ namespace Glest {
 			string path =
 				tilesetFolder + "lang/" + tileset + "_" + language + ".lng";
 			string pathDefault = tilesetFolder + "lang/" + tileset + "_default.lng";
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] path = [%s] pathDefault = [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -507,8 +496,7 @@ namespace Glest {
 			if (fileExists(path)) {
 				tilesetStrings.load(path);
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] path not found [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -516,8 +504,7 @@ namespace Glest {
 
 				//try english otherwise
 				path = tilesetFolder + "lang/" + tileset + "_english.lng";
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] path = [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
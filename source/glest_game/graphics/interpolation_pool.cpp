@@ -0,0 +1,235 @@
+//
+//	interpolation_pool.cpp:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#include "interpolation_pool.h"
+
+#include <SDL.h>
+#include "model.h"
+#include "conversion.h"
+#include "platform_util.h"
+#include "util.h"
+#include "profiler.h"
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::Util;
+using namespace Shared::Graphics;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		//	class InterpolationWorkerThread
+		// =====================================================
+
+		InterpolationWorkerThread::InterpolationWorkerThread(InterpolationPool *pool) : BaseThread() {
+			this->pool = pool;
+			this->masterController = NULL;
+			uniqueID = "InterpolationWorkerThread";
+		}
+
+		InterpolationWorkerThread::~InterpolationWorkerThread() {
+			pool = NULL;
+		}
+
+		void InterpolationWorkerThread::signalSlave(void *userdata) {
+			semTaskSignalled.signal();
+		}
+
+		void InterpolationWorkerThread::signalQuit() {
+			BaseThread::signalQuit();
+			semTaskSignalled.signal();
+		}
+
+		bool InterpolationWorkerThread::canShutdown(bool deleteSelfIfShutdownDelayed) {
+			bool ret = (getExecutingTask() == false);
+			if (ret == false && deleteSelfIfShutdownDelayed == true) {
+				setDeleteSelfOnExecutionDone(deleteSelfIfShutdownDelayed);
+				deleteSelfIfRequired();
+				signalQuit();
+			}
+
+			return ret;
+		}
+
+		void InterpolationWorkerThread::execute() {
+			RunningStatusSafeWrapper runningStatus(this);
+			for (; getQuitStatus() == false;) {
+				semTaskSignalled.waitTillSignalled();
+
+				// always report back, the render thread waits on every worker
+				static string masterSlaveOwnerId = CODE_AT_LINE;
+				MasterSlaveThreadControllerSafeWrapper safeMasterController(masterController, 20000, masterSlaveOwnerId);
+
+				if (getQuitStatus() == true) {
+					break;
+				}
+
+				// an error only costs this frame's head start, the render
+				// pass interpolates whatever is missing itself
+				try {
+					ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
+					pool->runJobs();
+				} catch (const exception &ex) {
+					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
+				} catch (...) {
+					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				}
+			}
+		}
+
+		// =====================================================
+		//	class InterpolationPool
+		// =====================================================
+
+		InterpolationPool::InterpolationPool(int threadCount) : mutexJobs(new Mutex(CODE_AT_LINE)) {
+			nextJobIndex = 0;
+			jobsOpen = false;
+			runningJobCount = 0;
+			hits = 0;
+			misses = 0;
+
+			std::vector<SlaveThreadControllerInterface *> slaveThreadList;
+			for (int index = 0; index < threadCount; ++index) {
+				InterpolationWorkerThread *workerThread = new InterpolationWorkerThread(this);
+				workerThread->setUniqueID("InterpolationWorkerThread_" + intToStr(index));
+				workerThread->start();
+				threadList.push_back(workerThread);
+				slaveThreadList.push_back(workerThread);
+			}
+			masterController.setSlaves(slaveThreadList);
+		}
+
+		InterpolationPool::~InterpolationPool() {
+			masterController.clearSlaves(true);
+			for (unsigned int index = 0; index < threadList.size(); ++index) {
+				InterpolationWorkerThread *workerThread = threadList[index];
+				workerThread->setMasterController(NULL);
+				workerThread->signalQuit();
+				sleep(0);
+				if (workerThread->canShutdown(true) == true &&
+					workerThread->shutdownAndWait() == true) {
+					delete workerThread;
+				}
+			}
+			threadList.clear();
+
+			delete mutexJobs;
+			mutexJobs = NULL;
+		}
+
+		int InterpolationPool::getDefaultThreadCount() {
+			int threadCount = SDL_GetCPUCount() - 1;
+			if (threadCount < 0) {
+				threadCount = 0;
+			}
+			return min(threadCount, 4);
+		}
+
+		void InterpolationPool::addModel(Model *model, float t, bool cycle) {
+			for (unsigned int meshIndex = 0; meshIndex < model->getMeshCount(); ++meshIndex) {
+				InterpolationData *interpolationData = model->getMeshPtr(meshIndex)->getInterpolationDataPtr();
+				if (interpolationData == NULL) {
+					continue;
+				}
+
+				// models can share meshes, so jobs go by interpolation data
+				map<InterpolationData *, int>::iterator iterFind = jobIndexLookup.find(interpolationData);
+				if (iterFind == jobIndexLookup.end()) {
+					InterpolationJob job;
+					job.interpolationData = interpolationData;
+					jobList.push_back(job);
+					iterFind = jobIndexLookup.insert(make_pair(interpolationData, (int) jobList.size() - 1)).first;
+				}
+				jobList[iterFind->second].poses.push_back(make_pair(t, cycle));
+			}
+		}
+
+		void InterpolationPool::run() {
+			if (jobList.empty() == true) {
+				return;
+			}
+			TraceScope traceScope("InterpolationPool::run");
+			MutexSafeWrapper safeMutex(mutexJobs, CODE_AT_LINE);
+			nextJobIndex = 0;
+			jobsOpen = true;
+			hits = 0;
+			misses = 0;
+			safeMutex.ReleaseLock(true);
+
+			if (threadList.empty() == false && jobList.size() > 1) {
+				masterController.signalSlaves(NULL);
+				runJobs();
+				if (masterController.waitTillSlavesTrigger(20000) == false) {
+					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] timed out waiting for interpolation workers\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				}
+			} else {
+				runJobs();
+			}
+
+			// after a timeout some worker may still be inside a job, close
+			// the list and let those finish before it is cleared
+			safeMutex.Lock();
+			jobsOpen = false;
+			for (; runningJobCount > 0;) {
+				safeMutex.ReleaseLock(true);
+				sleep(1);
+				safeMutex.Lock();
+			}
+			safeMutex.ReleaseLock();
+
+			InterpolationData::addCacheStats(hits, misses);
+			jobList.clear();
+			jobIndexLookup.clear();
+		}
+
+		void InterpolationPool::runJobs() {
+			static const char *mutexOwnerId = CODE_AT_LINE;
+			TraceScope traceScope("InterpolationPool::runJobs");
+			for (;;) {
+				MutexSafeWrapper safeMutex(mutexJobs, mutexOwnerId);
+				if (jobsOpen == false || nextJobIndex >= jobList.size()) {
+					return;
+				}
+				InterpolationJob &job = jobList[nextJobIndex++];
+				runningJobCount++;
+				safeMutex.ReleaseLock(true);
+
+				uint64 jobHits = 0;
+				uint64 jobMisses = 0;
+				try {
+					job.interpolationData->preparePoses(job.poses, jobHits, jobMisses);
+				} catch (...) {
+					safeMutex.Lock();
+					runningJobCount--;
+					throw;
+				}
+
+				safeMutex.Lock();
+				runningJobCount--;
+				hits += jobHits;
+				misses += jobMisses;
+			}
+		}
+
+	}
+}//end namespace
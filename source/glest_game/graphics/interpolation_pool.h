@@ -0,0 +1,130 @@
+//
+//	interpolation_pool.h:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#ifndef _GLEST_GAME_INTERPOLATIONPOOL_H_
+#define _GLEST_GAME_INTERPOLATIONPOOL_H_
+
+#ifdef WIN32
+#include <winsock2.h>
+#include <winsock.h>
+#endif
+
+#include <map>
+#include <vector>
+#include "base_thread.h"
+#include "interpolation.h"
+#include "leak_dumper.h"
+
+using std::map;
+using std::pair;
+using std::vector;
+using Shared::PlatformCommon::BaseThread;
+using Shared::Platform::MasterSlaveThreadController;
+using Shared::Platform::SlaveThreadControllerInterface;
+using Shared::Graphics::InterpolationData;
+
+namespace Shared {
+	namespace Graphics {
+		class Model;
+	}
+}
+
+namespace Glest {
+	namespace Game {
+
+		class InterpolationPool;
+
+		// a mesh and every pose of it wanted this frame, a mesh is only
+		// ever part of one job so no two threads touch its cache
+		class InterpolationJob {
+		public:
+			InterpolationData *interpolationData;
+			vector<pair<float, bool> > poses;
+		};
+
+		// =====================================================
+		//	class InterpolationWorkerThread
+		// =====================================================
+
+		class InterpolationWorkerThread : public BaseThread, public SlaveThreadControllerInterface {
+		protected:
+			InterpolationPool *pool;
+			::Shared::Platform::Semaphore semTaskSignalled;
+			MasterSlaveThreadController *masterController;
+
+		public:
+			explicit InterpolationWorkerThread(InterpolationPool *pool);
+			virtual ~InterpolationWorkerThread();
+			virtual void execute();
+			virtual void signalQuit();
+			virtual bool canShutdown(bool deleteSelfIfShutdownDelayed = false);
+
+			virtual void setMasterController(MasterSlaveThreadController *master) {
+				masterController = master;
+			}
+			virtual void signalSlave(void *userdata);
+		};
+
+		// =====================================================
+		//	class InterpolationPool
+		//
+		///	Interpolates the meshes of the visible units across
+		///	worker threads before the render pass, which then
+		///	only picks up the finished poses.
+		// =====================================================
+
+		class InterpolationPool {
+		private:
+			::Shared::Platform::Mutex *mutexJobs;
+			vector<InterpolationJob> jobList;
+			map<InterpolationData *, int> jobIndexLookup;
+			unsigned int nextJobIndex;
+			// workers only take jobs while open, a late worker must not
+			// read the list while the next frame fills it
+			bool jobsOpen;
+			int runningJobCount;
+			uint64 hits;
+			uint64 misses;
+
+			vector<InterpolationWorkerThread *> threadList;
+			MasterSlaveThreadController masterController;
+
+		public:
+			explicit InterpolationPool(int threadCount);
+			~InterpolationPool();
+
+			// a worker for each spare core, at most four
+			static int getDefaultThreadCount();
+
+			// collects the meshes of model at animation position t
+			void addModel(::Shared::Graphics::Model *model, float t, bool cycle);
+			// hands the collected jobs to the workers, helps out and returns
+			// once every job is done
+			void run();
+			// called by the workers, takes jobs until none are left
+			void runJobs();
+		};
+
+	}
+}//end namespace
+
+#endif
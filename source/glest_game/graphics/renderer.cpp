@@ -21,6 +21,8 @@
 #include "core_data.h"
 #include "game.h"
 #include "metrics.h"
+#include "interpolation.h"
+#include "interpolation_pool.h"
 #include "opengl.h"
 #include "faction.h"
 #include "factory_repository.h"
@@ -119,6 +121,12 @@ namespace Glest {
 			photoMode = false;
 			focusArrows = false;
 			pointCount = 0;
+			interpolationCacheHits = 0;
+			interpolationCacheMisses = 0;
+			interpolationPool = NULL;
+			modelDrawCallCount = 0;
+			modelMeshSetupCount = 0;
+			particleDrawCallCount = 0;
 			maxLights = 0;
 			waterAnim = 0;
 
@@ -197,7 +205,7 @@ namespace Glest {
 			}
 
 			if (GlobalStaticFlags::getIsNonGraphicalModeEnabled() == false) {
-				static string mutexOwnerId = string(extractFileFromDirectoryPath(__FILE__).c_str()) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				saveScreenShotThread = new SimpleTaskThread(this, 0, 25);
 				saveScreenShotThread->setUniqueID(mutexOwnerId);
 				saveScreenShotThread->start();
@@ -224,9 +232,9 @@ namespace Glest {
 
 
 				if (getSaveScreenQueueSize() > 0) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line %d] FORCING MEMORY CLEANUP and NOT SAVING screenshots, saveScreenQueue.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, saveScreenQueue.size());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line %d] FORCING MEMORY CLEANUP and NOT SAVING screenshots, saveScreenQueue.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, saveScreenQueue.size());
 
-					static string mutexOwnerId = string(extractFileFromDirectoryPath(__FILE__).c_str()) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					MutexSafeWrapper safeMutex(saveScreenShotThreadAccessor, mutexOwnerId);
 					for (std::list<std::pair<string, Pixmap2D *> >::iterator iter = saveScreenQueue.begin();
 						iter != saveScreenQueue.end(); ++iter) {
@@ -239,7 +247,9 @@ namespace Glest {
 
 		Renderer::~Renderer() {
 			try {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+
+				cleanupInterpolationPool();
 
 				delete modelRenderer;
 				modelRenderer = NULL;
@@ -250,7 +260,7 @@ namespace Glest {
 				delete particleRenderer;
 				particleRenderer = NULL;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				//resources
 				for (int i = 0; i < rsCount; ++i) {
@@ -264,18 +274,18 @@ namespace Glest {
 					fontManager[i] = NULL;
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				// Wait for the queue to become empty or timeout the thread at 7 seconds
 				cleanupScreenshotThread();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				mapSurfaceData.clear();
 				quadCache = VisibleQuadContainerCache();
 				quadCache.clearFrustumData();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				this->menu = NULL;
 				this->game = NULL;
@@ -287,7 +297,7 @@ namespace Glest {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096, "In [%s::%s Line: %d]\nError [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, e.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				//throw megaglest_runtime_error(szBuf);
 			}
@@ -297,10 +307,10 @@ namespace Glest {
 			// This code reads pixmaps from a queue and saves them to disk
 			Pixmap2D *savePixMapBuffer = NULL;
 			string path = "";
-			static string mutexOwnerId = string(extractFileFromDirectoryPath(__FILE__).c_str()) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(saveScreenShotThreadAccessor, mutexOwnerId);
 			if (saveScreenQueue.empty() == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line %d] saveScreenQueue.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, saveScreenQueue.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line %d] saveScreenQueue.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, saveScreenQueue.size());
 
 				savePixMapBuffer = saveScreenQueue.front().second;
 				path = saveScreenQueue.front().first;
@@ -310,7 +320,7 @@ namespace Glest {
 			safeMutex.ReleaseLock();
 
 			if (savePixMapBuffer != NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line %d] about to save [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line %d] about to save [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str());
 
 				savePixMapBuffer->save(path);
 				delete savePixMapBuffer;
@@ -416,7 +426,7 @@ namespace Glest {
 
 		void Renderer::initGame(const Game *game, GameCamera *gameCamera) {
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			this->gameCamera = gameCamera;
@@ -434,7 +444,7 @@ namespace Glest {
 			waterAnim = 0;
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			if (GlobalStaticFlags::getIsNonGraphicalModeEnabled() == true) {
 				return;
@@ -468,7 +478,7 @@ namespace Glest {
 				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
 				if (shadows == sShadowMapping) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 					//shadow mapping
 					glTexParameteri(GL_TEXTURE_2D, GL_DEPTH_TEXTURE_MODE, GL_LUMINANCE);
@@ -481,7 +491,7 @@ namespace Glest {
 						shadowTextureSize, shadowTextureSize,
 						0, GL_DEPTH_COMPONENT, GL_UNSIGNED_BYTE, NULL);
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 					//projected
 					glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8,
@@ -492,7 +502,7 @@ namespace Glest {
 				shadowMapFrame = -1;
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			IF_DEBUG_EDITION(getDebugRenderer().init(); )
 
@@ -501,7 +511,7 @@ namespace Glest {
 			textureManager[rsGame]->init();
 			fontManager[rsGame]->init();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			init3dList();
 		}
@@ -563,11 +573,11 @@ namespace Glest {
 		}
 
 		void Renderer::initMenu(const MainMenu *mm) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			this->menu = mm;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			if (GlobalStaticFlags::getIsNonGraphicalModeEnabled() == true) {
 				return;
@@ -578,11 +588,11 @@ namespace Glest {
 			fontManager[rsMenu]->init();
 			//modelRenderer->setCustomTexture(CoreData::getInstance().getCustomTexture());
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			//init3dListMenu(mm);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		void Renderer::reset3d() {
@@ -593,6 +603,20 @@ namespace Glest {
 
 			pointCount = 0;
 			triangleCount = 0;
+			interpolationCacheHits = InterpolationData::getCacheHits();
+			interpolationCacheMisses = InterpolationData::getCacheMisses();
+			InterpolationData::resetCacheStats();
+			if (modelRenderer != NULL) {
+				modelDrawCallCount = modelRenderer->getDrawCallCount();
+				modelMeshSetupCount = modelRenderer->getMeshSetupCount();
+				modelRenderer->resetStats();
+			}
+			if (particleRenderer != NULL) {
+				particleDrawCallCount = particleRenderer->getDrawCallCount();
+				particleRenderer->resetStats();
+			}
+			fontMetricsCacheStats = FontMetrics::getCacheStats();
+			FontMetrics::resetCacheStats();
 			assertGl();
 		}
 
@@ -699,6 +723,8 @@ namespace Glest {
 			this->gameCamera = NULL;
 			Config &config = Config::getInstance();
 
+			cleanupInterpolationPool();
+
 			try {
 				quadCache = VisibleQuadContainerCache();
 				quadCache.clearFrustumData();
@@ -706,7 +732,7 @@ namespace Glest {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096, "In [%s::%s Line: %d]\nError [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, e.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				abort();
 			}
@@ -819,7 +845,7 @@ namespace Glest {
 			if (rs == rsGlobal) {
 				std::map<string, Texture2D *> &crcFactionPreviewTextureCache = CacheManager::getCachedItem< std::map<string, Texture2D *> >(GameConstants::factionPreviewTextureCacheLookupKey);
 				if (crcFactionPreviewTextureCache.find(textureFilename) != crcFactionPreviewTextureCache.end()) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] textureFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, textureFilename.c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] textureFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, textureFilename.c_str());
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] free texture from cache [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, textureFilename.c_str());
 
 					crcFactionPreviewTextureCache.erase(textureFilename);
@@ -2203,6 +2229,9 @@ namespace Glest {
 				str += gamePerfStats + "\n";
 			}
 
+			snprintf(szBuf, 200, "Model draw calls: %u mesh setups: %u particle draw calls: %u", modelDrawCallCount, modelMeshSetupCount, particleDrawCallCount);
+			str += string(szBuf) + string("\n");
+
 			if (renderText3DEnabled == true) {
 				renderTextShadow3D(
 					str, CoreData::getInstance().getDisplayFontSmall3D(),
@@ -3198,7 +3227,7 @@ namespace Glest {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096, "In [%s::%s Line: %d]\nError [%s] For Control [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, e.what(), label->getInstanceName().c_str());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				throw megaglest_runtime_error(szBuf);
 			}
@@ -3345,7 +3374,7 @@ namespace Glest {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096, "In [%s::%s Line: %d]\nError [%s] For Control container [%s] name [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, e.what(), button->getContainerName().c_str(), button->getInstanceName().c_str());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				throw megaglest_runtime_error(szBuf);
 			}
@@ -3850,7 +3879,7 @@ namespace Glest {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096, "In [%s::%s Line: %d]\nError [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, e.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 
 				throw megaglest_runtime_error(szBuf);
 			}
@@ -4745,6 +4774,45 @@ namespace Glest {
 			)
 		}
 
+		// per object state for tileset objects drawn through renderInstances
+		class ObjectInstanceCallback : public ModelInstanceCallback {
+		private:
+			const vector<Object *> &objectList;
+			const vector<int> &itemList;
+			const Pixmap2D *fowTexPixmap;
+			Vec3f baseFogColor;
+			float ambFactor;
+
+		public:
+			ObjectInstanceCallback(const vector<Object *> &objectList, const vector<int> &itemList,
+				const Pixmap2D *fowTexPixmap, const Vec3f &baseFogColor, float ambFactor) :
+				objectList(objectList), itemList(itemList) {
+				this->fowTexPixmap = fowTexPixmap;
+				this->baseFogColor = baseFogColor;
+				this->ambFactor = ambFactor;
+			}
+
+			virtual void beginInstance(int instanceIndex) {
+				Object *o = objectList[itemList[instanceIndex]];
+				const Vec3f v = o->getConstPos();
+
+				float fowFactor = fowTexPixmap->getPixelf(o->getMapPos().x / Map::cellScale, o->getMapPos().y / Map::cellScale);
+				Vec4f color = Vec4f(Vec3f(fowFactor), 1.f);
+				glColor4fv(color.ptr());
+				glMaterialfv(GL_FRONT_AND_BACK, GL_AMBIENT, (color * ambFactor).ptr());
+				glFogfv(GL_FOG_COLOR, (baseFogColor * fowFactor).ptr());
+
+				glMatrixMode(GL_MODELVIEW);
+				glPushMatrix();
+				glTranslatef(v.x, v.y, v.z);
+				glRotatef(o->getRotation(), 0.f, 1.f, 0.f);
+			}
+
+			virtual void endInstance(int instanceIndex) {
+				glPopMatrix();
+			}
+		};
+
 		void Renderer::renderObjects(const int renderFps) {
 			if (GlobalStaticFlags::getIsNonGraphicalModeEnabled() == true) {
 				return;
@@ -4755,6 +4823,7 @@ namespace Glest {
 
 			Config &config = Config::getInstance();
 			int tilesetObjectsToAnimate = config.getInt("AnimatedTilesetObjects", "-1");
+			bool batchObjects = config.getBool("BatchTilesetObjects", "true");
 
 			assertGl();
 
@@ -4763,6 +4832,9 @@ namespace Glest {
 			Vec3f baseFogColor = world->getTileset()->getFogColor() * world->getTimeFlow()->computeLightColor();
 
 			bool modelRenderStarted = false;
+			// static models drawn once per model after the loop, in first seen order
+			vector<Object *> batchObjectList;
+			ModelInstanceBatch objectBatch;
 
 			VisibleQuadContainerCache &qCache = getQuadCache();
 
@@ -4800,6 +4872,12 @@ namespace Glest {
 
 					modelRenderer->begin(true, true, false, false);
 				}
+
+				if (batchObjects == true && modelRenderer->canRenderInstances(objModel) == true) {
+					objectBatch.add(objModel, (int) batchObjectList.size());
+					batchObjectList.push_back(o);
+					continue;
+				}
 				//ambient and diffuse color is taken from cell color
 
 				float fowFactor = fowTexPixmap->getPixelf(o->getMapPos().x / Map::cellScale, o->getMapPos().y / Map::cellScale);
@@ -4841,6 +4919,17 @@ namespace Glest {
 				glPopMatrix();
 			}
 
+			for (int modelIndex = 0; modelIndex < objectBatch.getModelCount(); ++modelIndex) {
+				Model *objModel = objectBatch.getModel(modelIndex);
+				const vector<int> &itemList = objectBatch.getItemList(modelIndex);
+
+				ObjectInstanceCallback instanceCallback(batchObjectList, itemList, fowTexPixmap, baseFogColor, ambFactor);
+				modelRenderer->renderInstances(objModel, (int) itemList.size(), &instanceCallback);
+
+				triangleCount += objModel->getTriangleCount() * (int) itemList.size();
+				pointCount += objModel->getVertexCount() * (int) itemList.size();
+			}
+
 			if (modelRenderStarted == true) {
 				modelRenderer->end();
 				glPopAttrib();
@@ -5153,6 +5242,42 @@ namespace Glest {
 			glPopMatrix();
 		}
 
+		void Renderer::cleanupInterpolationPool() {
+			delete interpolationPool;
+			interpolationPool = NULL;
+		}
+
+		void Renderer::prepareUnitInterpolation() {
+			if (GlobalStaticFlags::getIsNonGraphicalModeEnabled() == true) {
+				return;
+			}
+
+			VisibleQuadContainerCache &qCache = getQuadCache();
+			if (qCache.visibleQuadUnitList.empty() == true) {
+				return;
+			}
+
+			if (interpolationPool == NULL) {
+				int threadCount = Config::getInstance().getInt("RenderInterpolationThreads", "-1");
+				if (threadCount < 0) {
+					threadCount = InterpolationPool::getDefaultThreadCount();
+				}
+				interpolationPool = new InterpolationPool(threadCount);
+			}
+
+			// same model and animation arguments the unit passes use, so
+			// those find their poses already in the mesh caches
+			for (int visibleUnitIndex = 0;
+				visibleUnitIndex < (int) qCache.visibleQuadUnitList.size(); ++visibleUnitIndex) {
+				Unit *unit = qCache.visibleQuadUnitList[visibleUnitIndex];
+				Model *model = unit->getCurrentModelPtr();
+				if (model != NULL) {
+					interpolationPool->addModel(model, unit->getAnimProgressAsFloat(), unit->isAlive() && !unit->isAnimProgressBound());
+				}
+			}
+			interpolationPool->run();
+		}
+
 		void Renderer::renderUnits(bool airUnits, const int renderFps) {
 			if (GlobalStaticFlags::getIsNonGraphicalModeEnabled() == true) {
 				return;
@@ -7540,16 +7665,16 @@ namespace Glest {
 		void Renderer::saveScreen(const string &path, int w, int h) {
 			const Metrics &sm = Metrics::getInstance();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			Pixmap2D *pixmapScreenShot = new Pixmap2D(sm.getScreenW(), sm.getScreenH(), 3);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			//glFinish();
 
 			glPixelStorei(GL_PACK_ALIGNMENT, 1);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			glReadPixels(0, 0, pixmapScreenShot->getW(), pixmapScreenShot->getH(),
 				GL_RGB, GL_UNSIGNED_BYTE, pixmapScreenShot->getPixels());
 
@@ -7559,20 +7684,20 @@ namespace Glest {
 			} else {
 				pixmapScreenShot->Scale(GL_RGB, w, h);
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
 			// Signal the threads queue to add a screenshot save request
-			MutexSafeWrapper safeMutex(saveScreenShotThreadAccessor, string(extractFileFromDirectoryPath(__FILE__).c_str()) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutex(saveScreenShotThreadAccessor, CODE_AT_LINE);
 			saveScreenQueue.push_back(make_pair(path, pixmapScreenShot));
 			safeMutex.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		unsigned int Renderer::getSaveScreenQueueSize() {
-			MutexSafeWrapper safeMutex(saveScreenShotThreadAccessor, string(extractFileFromDirectoryPath(__FILE__).c_str()) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutex(saveScreenShotThreadAccessor, CODE_AT_LINE);
 			int queueSize = (int) saveScreenQueue.size();
 			safeMutex.ReleaseLock();
 
@@ -7927,7 +8052,7 @@ namespace Glest {
 			}
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			render3dSetup();
 
@@ -9668,7 +9793,7 @@ namespace Glest {
 		}
 
 		Texture2D * Renderer::preloadTexture(string logoFilename) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] logoFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] logoFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
 
 			Texture2D *result = NULL;
 			if (logoFilename != "") {
@@ -9677,13 +9802,13 @@ namespace Glest {
 				std::map<string, Texture2D *> &crcFactionPreviewTextureCache = CacheManager::getCachedItem< std::map<string, Texture2D *> >(GameConstants::factionPreviewTextureCacheLookupKey);
 
 				if (crcFactionPreviewTextureCache.find(logoFilename) != crcFactionPreviewTextureCache.end()) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] logoFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] logoFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
 
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] load texture from cache [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
 
 					result = crcFactionPreviewTextureCache[logoFilename];
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] logoFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] logoFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
 					Renderer &renderer = Renderer::getInstance();
 					result = renderer.newTexture2D(rsGlobal);
 					if (result) {
@@ -9702,7 +9827,7 @@ namespace Glest {
 		}
 
 		Texture2D * Renderer::findTexture(string logoFilename) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] logoFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] logoFilename [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, logoFilename.c_str());
 
 			Texture2D *result = preloadTexture(logoFilename);
 			if (result != NULL && result->getInited() == false) {
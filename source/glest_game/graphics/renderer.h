@@ -72,6 +72,7 @@ namespace Glest {
 		class ConsoleLineInfo;
 		class SurfaceCell;
 		class Program;
+		class InterpolationPool;
 
 		// ===========================================================
 		// 	class Renderer
@@ -257,6 +258,16 @@ namespace Glest {
 			//misc
 			int triangleCount;
 			int pointCount;
+			// interpolation cache use of the last 3d frame
+			uint64 interpolationCacheHits;
+			uint64 interpolationCacheMisses;
+			InterpolationPool *interpolationPool;
+			// model renderer work of the last 3d frame
+			uint32 modelDrawCallCount;
+			uint32 modelMeshSetupCount;
+			uint32 particleDrawCallCount;
+			// font metrics lookups between the last two 3d frames
+			string fontMetricsCacheStats;
 			Quad2i visibleQuad;
 			Quad2i visibleQuadFromCamera;
 			Vec4f nearestLightPos;
@@ -455,6 +466,15 @@ namespace Glest {
 			inline int getPointCount() const {
 				return pointCount;
 			}
+			inline uint64 getInterpolationCacheHits() const {
+				return interpolationCacheHits;
+			}
+			inline uint64 getInterpolationCacheMisses() const {
+				return interpolationCacheMisses;
+			}
+			inline string getFontMetricsCacheStats() const {
+				return fontMetricsCacheStats;
+			}
 
 			//misc
 			//void reloadResources();
@@ -554,6 +574,9 @@ namespace Glest {
 			void renderObjects(const int renderFps);
 
 			void renderWater();
+			// interpolates the visible units on worker threads ahead of the unit passes
+			void prepareUnitInterpolation();
+			void cleanupInterpolationPool();
 			void renderUnits(bool airUnits, const int renderFps);
 			void renderUnitsToBuild(const int renderFps);
 
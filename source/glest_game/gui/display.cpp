@@ -27,7 +27,7 @@ namespace Glest {
 		// =====================================================
 
 		Display::Display() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			colors[0] = Vec4f(1.f, 1.f, 1.f, 1.0f);
 			colors[1] = Vec4f(1.f, 0.5f, 0.5f, 1.0f);
@@ -42,7 +42,7 @@ namespace Glest {
 			currentColor = 0;
 			clear();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void Display::calculateUpDimensions(int index) {
@@ -95,7 +95,7 @@ namespace Glest {
 
 		//constructor
 		Gui::Gui() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] START\n", __FILE__, __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] START\n", __FILE__, __FUNCTION__);
 
 			lastGroupRecall = -1;
 			posObjWorld = Vec2i(54, 14);
@@ -122,7 +122,7 @@ namespace Glest {
 			console = NULL;
 			choosenBuildingType = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] END\n", __FILE__, __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] END\n", __FILE__, __FUNCTION__);
 		}
 
 		void Gui::init(Game *game) {
@@ -347,7 +347,7 @@ namespace Glest {
 
 		void Gui::groupKey(int groupIndex) {
 			if (isKeyDown(vkControl)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] groupIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, groupIndex);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] groupIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, groupIndex);
 				//		bool allAssigned=true;
 				bool clearGroup = !isKeyDown(vkShift);
 				//		if(!clearGroup){
@@ -361,7 +361,7 @@ namespace Glest {
 					console->addStdMessage("GroupAssignFailed");
 				}
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] groupIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, groupIndex);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] groupIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, groupIndex);
 
 				int recallGroupCenterCameraTimeout = Config::getInstance().getInt("RecallGroupCenterCameraTimeoutMilliseconds", "1500");
 
@@ -381,7 +381,7 @@ namespace Glest {
 		}
 
 		void Gui::hotKey(SDL_KeyboardEvent key) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] key = [%c][%d]\n", __FILE__, __FUNCTION__, key, key);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] key = [%c][%d]\n", __FILE__, __FUNCTION__, key, key);
 
 			Config &configKeys = Config::getInstance(std::pair<ConfigType, ConfigType>(cfgMainKeys, cfgUserKeys));
 
@@ -400,7 +400,7 @@ namespace Glest {
 			//else if(key == configKeys.getCharKey("HotKeyDumpWorldToLog")) {
 			else if (isKeyPressed(configKeys.getSDLKey("HotKeyDumpWorldToLog"), key) == true) {
 				std::string worldLog = world->DumpWorldToLog();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] worldLog dumped to [%s]\n", __FILE__, __FUNCTION__, __LINE__, worldLog.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] worldLog dumped to [%s]\n", __FILE__, __FUNCTION__, __LINE__, worldLog.c_str());
 			}
 			//else if(key == configKeys.getCharKey("HotKeyRotateUnitDuringPlacement")){
 			else if (isKeyPressed(configKeys.getSDLKey("HotKeyRotateUnitDuringPlacement"), key) == true) {
@@ -111,7 +111,7 @@ namespace Glest {
 					clear();
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unit selected [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unit selected [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
 
 				unit->addObserver(this);
 
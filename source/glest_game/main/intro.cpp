@@ -101,8 +101,7 @@ namespace Glest {
 
 		Intro::Intro(Program * program) :
 			ProgramState(program) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -181,8 +180,7 @@ namespace Glest {
 				const XmlNode *
 					introNode = menuNode->getChild("intro");
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -45,6 +45,7 @@
 #include <curl/curl.h>
 #include "menu_state_masterserver.h"
 #include "checksum.h"
+#include "xml_binary.h"
 #include <algorithm>
 #include "sound_renderer.h"
 #include "font_gl.h"
@@ -56,6 +57,8 @@
 #include <locale.h>
 #include "string_utils.h"
 #include "auto_test.h"
+#include "simulation_benchmark.h"
+#include "profiler.h"
 #include "lua_script.h"
 #include "interpolation.h"
 #include "common_scoped_ptr.h"
@@ -240,8 +243,7 @@ namespace
 						printf("D - shutting down crc threads\n");
 
 					if (preCacheThread->canShutdown(false) == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n", __FILE__,
 								__FUNCTION__, __LINE__);
@@ -282,8 +284,7 @@ namespace
 			if (ircClient != NULL) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("#2 IRCCLient Cache SHUTDOWN\n");
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -297,6 +298,7 @@ namespace
 				printf("#4 IRCCLient Cache SHUTDOWN\n");
 
 			cleanupCRCThread();
+			Checksum::closeFileIndex();
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
@@ -2165,28 +2167,25 @@ namespace
 		void
 			setupLogging(Config & config, bool haveSpecialOutputCommandLineOption) {
 
-			SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled =
-				config.getBool("DebugMode", "false");
-			SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled =
-				config.getBool("DebugNetwork", "false");
-			SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).
-				enabled = config.getBool("DebugPerformance", "false");
-			SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-				enabled = config.getBool("DebugWorldSynch", "false");
-			SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).
-				enabled = config.getBool("DebugUnitCommands", "false");
-			SystemFlags::getSystemSettingType(SystemFlags::debugPathFinder).
-				enabled = config.getBool("DebugPathFinder", "false");
-			SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled =
-				config.getBool("DebugLUA", "false");
-			LuaScript::setDebugModeEnabled(SystemFlags::
-				getSystemSettingType(SystemFlags::
-					debugLUA).
-				enabled);
-			SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled =
-				config.getBool("DebugSound", "false");
-			SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled =
-				config.getBool("DebugError", "true");
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugSystem,
+				config.getBool("DebugMode", "false"));
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugNetwork,
+				config.getBool("DebugNetwork", "false"));
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugPerformance,
+				config.getBool("DebugPerformance", "false"));
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugWorldSynch,
+				config.getBool("DebugWorldSynch", "false"));
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugUnitCommands,
+				config.getBool("DebugUnitCommands", "false"));
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugPathFinder,
+				config.getBool("DebugPathFinder", "false"));
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugLUA,
+				config.getBool("DebugLUA", "false"));
+			LuaScript::setDebugModeEnabled(DEBUG_TYPE_ENABLED(SystemFlags::debugLUA));
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugSound,
+				config.getBool("DebugSound", "false"));
+			SystemFlags::setDebugTypeEnabled(SystemFlags::debugError,
+				config.getBool("DebugError", "true"));
 
 			string
 				userData = config.getString("UserData_Root", "");
@@ -2364,26 +2363,17 @@ namespace
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf
 					("--- Startup log settings are ---\ndebugSystem [%d][%s]\ndebugNetwork [%d][%s]\ndebugPerformance [%d][%s]\ndebugWorldSynch [%d][%s]\ndebugUnitCommands[%d][%s]\ndebugPathFinder[%d][%s]\ndebugLUA [%d][%s]\ndebugSound [%d][%s]\ndebugError [%d][%s]\n",
-						SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled, debugLogFile.c_str(),
-						SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).
-						enabled, debugNetworkLogFile.c_str(),
-						SystemFlags::getSystemSettingType(SystemFlags::
-							debugPerformance).enabled,
+						DEBUG_TYPE_ENABLED(SystemFlags::debugSystem), debugLogFile.c_str(),
+						DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork), debugNetworkLogFile.c_str(),
+						DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance),
 						debugPerformanceLogFile.c_str(),
-						SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-						enabled, debugWorldSynchLogFile.c_str(),
-						SystemFlags::getSystemSettingType(SystemFlags::
-							debugUnitCommands).enabled,
+						DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch), debugWorldSynchLogFile.c_str(),
+						DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands),
 						debugUnitCommandsLogFile.c_str(),
-						SystemFlags::getSystemSettingType(SystemFlags::debugPathFinder).
-						enabled, debugPathFinderLogFile.c_str(),
-						SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled, debugLUALogFile.c_str(),
-						SystemFlags::getSystemSettingType(SystemFlags::debugSound).
-						enabled, debugSoundLogFile.c_str(),
-						SystemFlags::getSystemSettingType(SystemFlags::debugError).
-						enabled, debugErrorLogFile.c_str());
+						DEBUG_TYPE_ENABLED(SystemFlags::debugPathFinder), debugPathFinderLogFile.c_str(),
+						DEBUG_TYPE_ENABLED(SystemFlags::debugLUA), debugLUALogFile.c_str(),
+						DEBUG_TYPE_ENABLED(SystemFlags::debugSound), debugSoundLogFile.c_str(),
+						DEBUG_TYPE_ENABLED(SystemFlags::debugError), debugErrorLogFile.c_str());
 			}
 		}
 
@@ -5049,6 +5039,69 @@ namespace
 			return return_value;
 		}
 
+		int
+			handleConvertSavedGameCommand(int argc, char **argv) {
+			int
+				foundParamIndIndex = -1;
+			hasCommandArgument(argc, argv,
+				string(GAME_ARGS[GAME_ARG_CONVERT_SAVED_GAME]) + string("="),
+				&foundParamIndIndex);
+			if (foundParamIndIndex < 0) {
+				hasCommandArgument(argc, argv,
+					string(GAME_ARGS[GAME_ARG_CONVERT_SAVED_GAME]),
+					&foundParamIndIndex);
+			}
+			string
+				paramValue = argv[foundParamIndIndex];
+			vector < string > paramPartTokens;
+			Tokenize(paramValue, paramPartTokens, "=");
+			if (paramPartTokens.size() < 2 || paramPartTokens[1].length() == 0) {
+				printf("\nInvalid saved game specified on commandline [%s]\n\n",
+					argv[foundParamIndIndex]);
+				printParameterHelp(argv[0], false);
+				return 1;
+			}
+
+			string
+				inFile = paramPartTokens[1];
+			string
+				outFile = inFile;
+			if (paramPartTokens.size() >= 3 && paramPartTokens[2].length() > 0) {
+				outFile = paramPartTokens[2];
+			}
+			if (fileExists(inFile) == false) {
+				printf("Saved game [%s] was NOT FOUND\n", inFile.c_str());
+				return 1;
+			}
+
+			try {
+				bool
+					toBinary = (XmlBinaryReader::isBinaryFile(inFile) == false);
+
+				// no tag replacements, values are copied over as stored
+				XmlTree
+					xmlTree(XML_RAPIDXML_ENGINE);
+				xmlTree.load(inFile, std::map < string, string > (), true, false,
+					true);
+				if (toBinary == true) {
+					xmlTree.saveBinary(outFile,
+						Config::getInstance().
+						getInt("SaveGameBinaryCompressionLevel", "1"));
+				} else {
+					xmlTree.save(outFile);
+				}
+
+				printf("Converted saved game [%s] to %s format in [%s]\n",
+					inFile.c_str(), (toBinary == true ? "binary" : "xml"),
+					outFile.c_str());
+			} catch (const exception & ex) {
+				printf("ERROR converting saved game [%s] message [%s]\n",
+					inFile.c_str(), ex.what());
+				return 1;
+			}
+			return 0;
+		}
+
 		int
 			handleShowCRCValuesCommand(int argc, char **argv) {
 			int
@@ -5759,6 +5812,20 @@ namespace
 				return 2;
 			}
 
+			if (hasCommandArgument
+			(argc, argv,
+				string(GAME_ARGS[GAME_ARG_SIMULATION_BENCHMARK])) == true) {
+				if (hasCommandArgument
+				(argc, argv, string(GAME_ARGS[GAME_ARG_LOADSCENARIO])) == false) {
+					printf("\n%s requires %s=name to be specified.\n",
+						GAME_ARGS[GAME_ARG_SIMULATION_BENCHMARK],
+						GAME_ARGS[GAME_ARG_LOADSCENARIO]);
+					return 1;
+				}
+				// the benchmark never draws, so no window or GL context either
+				GlobalStaticFlags::setIsNonGraphicalModeEnabled(true);
+			}
+
 			if (hasCommandArgument
 			(argc, argv,
 				string(GAME_ARGS[GAME_ARG_MASTERSERVER_MODE])) == true) {
@@ -6294,6 +6361,17 @@ namespace
 					(Socket::getBroadCastPort
 					()).c_str()));
 
+				if (config.getBool("EnableMutexProfiler", "false") == true) {
+					printf("*NOTE: lock contention profiling is enabled.\n");
+					MutexProfiler::setEnabled(true);
+				}
+				if (config.getBool("EnableTraceProfiler", "false") == true) {
+					printf("*NOTE: trace profiling is enabled.\n");
+					TraceProfiler::setThreadEventCount(config.getInt("TraceProfilerThreadEvents", "32768"));
+					TraceProfiler::setEnabled(true);
+					TraceProfiler::setThreadName("main");
+				}
+
 				Socket::disableNagle = config.getBool("DisableNagle", "false");
 				if (Socket::disableNagle) {
 					printf
@@ -6360,6 +6438,9 @@ namespace
 					createDirectoryPaths(crcCachePath);
 				}
 				setCRCCacheFilePath(crcCachePath);
+				if (config.getBool("DisableFileCRCIndex", "false") == false) {
+					Checksum::openFileIndex(crcCachePath + "CRC_FILE_INDEX");
+				}
 
 				string
 					savedGamePath = userData + "saved/";
@@ -6897,6 +6978,12 @@ namespace
 					if (SystemFlags::VERBOSE_MODE_ENABLED)
 						printf("**INFO** Disabling Interpolation\n");
 				}
+				InterpolationData::setCacheSteps(config.getInt
+					("VertexInterpolationCacheSteps", "64"));
+				InterpolationData::setMaxCacheEntries(config.getInt
+					("VertexInterpolationCacheEntries", "8"));
+				FontMetrics::setMaxCacheEntries(config.getInt
+					("FontMetricsCacheEntries", "256"));
 
 
 				if (config.getBool("EnableVSynch", "false") == true) {
@@ -7048,6 +7135,48 @@ namespace
 					}
 				}
 
+				if (hasCommandArgument
+				(argc, argv, string(GAME_ARGS[GAME_ARG_SIMULATION_BENCHMARK])) == true) {
+					SimulationBenchmark::setEnabled(true);
+
+					int
+						foundParamIndIndex = -1;
+					hasCommandArgument(argc, argv,
+						string(GAME_ARGS[GAME_ARG_SIMULATION_BENCHMARK]) +
+						string("="), &foundParamIndIndex);
+					if (foundParamIndIndex < 0) {
+						hasCommandArgument(argc, argv,
+							string(GAME_ARGS[GAME_ARG_SIMULATION_BENCHMARK]),
+							&foundParamIndIndex);
+					}
+					string
+						paramValue = argv[foundParamIndIndex];
+					vector < string > paramPartTokens;
+					Tokenize(paramValue, paramPartTokens, "=");
+					if (paramPartTokens.size() >= 2
+						&& paramPartTokens[1].length() > 0) {
+						vector < string > paramPartTokens2;
+						Tokenize(paramPartTokens[1], paramPartTokens2, ",");
+						if (paramPartTokens2.empty() == false
+							&& paramPartTokens2[0].length() > 0) {
+							int
+								newMaxFrames = strToInt(paramPartTokens2[0]);
+							if (newMaxFrames <= 0) {
+								printf("\nInvalid simulation benchmark frame count [%s]\n",
+									paramPartTokens2[0].c_str());
+								return 1;
+							}
+							SimulationBenchmark::setMaxFrames(newMaxFrames);
+						}
+						if (paramPartTokens2.size() >= 2
+							&& paramPartTokens2[1].length() > 0) {
+							SimulationBenchmark::setOutputFile(paramPartTokens2[1]);
+						}
+					}
+					printf("Running simulation benchmark for %d frames\n",
+						SimulationBenchmark::getMaxFrames());
+				}
+
 				Renderer & renderer = Renderer::getInstance();
 				lang.loadGameStrings(language, false, true);
 
@@ -7157,6 +7286,11 @@ namespace
 					return handleCreateDataArchivesCommand(argc, argv);
 				}
 
+				if (hasCommandArgument
+				(argc, argv, GAME_ARGS[GAME_ARG_CONVERT_SAVED_GAME]) == true) {
+					return handleConvertSavedGameCommand(argc, argv);
+				}
+
 				if (hasCommandArgument(argc, argv, GAME_ARGS[GAME_ARG_SHOW_MAP_CRC])
 					== true
 					|| hasCommandArgument(argc, argv,
@@ -7192,18 +7326,12 @@ namespace
 				mainProgram = program;
 				renderer.setProgram(program);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPathFinder).
-					enabled == true) {
-					renderer.setAllowRenderUnitTitles(SystemFlags::getSystemSettingType
-					(SystemFlags::debugPathFinder).
-						enabled);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPathFinder) == true) {
+					renderer.setAllowRenderUnitTitles(DEBUG_TYPE_ENABLED(SystemFlags::debugPathFinder));
 					SystemFlags::OutputDebug(SystemFlags::debugPathFinder,
 						"In [%s::%s Line: %d] renderer.setAllowRenderUnitTitles = %d\n",
 						__FILE__, __FUNCTION__, __LINE__,
-						SystemFlags::
-						getSystemSettingType(SystemFlags::
-							debugPathFinder).
-						enabled);
+						DEBUG_TYPE_ENABLED(SystemFlags::debugPathFinder));
 				}
 				renderer.setAllowRenderUnitTitles(true);
 
@@ -7771,10 +7899,7 @@ namespace
 				if (startCRCPrecacheThread == true
 					&& GlobalStaticFlags::getIsNonGraphicalModeEnabled() == false) {
 					static
-						string
-						mutexOwnerId =
-						string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-						string("_") + intToStr(__LINE__);
+						const char *mutexOwnerId = CODE_AT_LINE;
 					vector < string > techDataPaths =
 						config.getPathListForType(ptTechs);
 
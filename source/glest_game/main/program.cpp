@@ -196,8 +196,7 @@ namespace Glest {
 
 		void
 			Program::ShowMessageProgramState::keyPress(SDL_KeyboardEvent c) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d] c = [%d]\n",
 					extractFileFromDirectoryPath
@@ -255,8 +254,7 @@ namespace Glest {
 
 		void
 			Program::initNormal(WindowGl * window) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -265,8 +263,7 @@ namespace Glest {
 			Config & config = Config::getInstance();
 			init(window);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -276,8 +273,7 @@ namespace Glest {
 			setState(new Intro(this));
 			showCursor(config.getBool("No2DMouseRendering", "false"));
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -455,8 +451,7 @@ namespace Glest {
 			Program::keyDown(SDL_KeyboardEvent key) {
 			if (msgBox.getEnabled()) {
 				//SDL_keysym keystate = Window::getKeystate();
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -468,8 +463,7 @@ namespace Glest {
 				if (isKeyPressed(SDLK_ESCAPE, key) == true
 					|| ((isKeyPressed(SDLK_RETURN, key) == true)
 						&& !(key.keysym.mod & (KMOD_LALT | KMOD_RALT)))) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -532,14 +526,15 @@ namespace Glest {
 
 		void
 			Program::loopWorker() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] ================================= MAIN LOOP START ================================= \n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__,
 					__LINE__);
 
+			TraceScope traceLoop("Program::loop");
+
 			//Renderer &renderer= Renderer::getInstance();
 			if (GlobalStaticFlags::getIsNonGraphicalModeEnabled() == false
 				&& window) {
@@ -568,16 +563,14 @@ namespace Glest {
 			Chrono chronoLoop;
 
 #ifdef DEBUG
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chronoLoop.start();
 #endif
 
 			Chrono chrono;
 
 #ifdef DEBUG
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 #endif
 
@@ -586,8 +579,7 @@ namespace Glest {
 
 			if (this->programState->quitTriggered() == true) {
 #ifdef DEBUG
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -597,8 +589,7 @@ namespace Glest {
 
 				Stats endStats = this->programState->quitAndToggleState();
 #ifdef DEBUG
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -609,8 +600,7 @@ namespace Glest {
 
 				Game::exitGameState(this, endStats);
 #ifdef DEBUG
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -635,7 +625,10 @@ namespace Glest {
 
 			chronoPerformanceCounts.start();
 
-			programState->render();
+			{
+				TraceScope traceRender("ProgramState::render");
+				programState->render();
+			}
 
 			programState->addPerformanceCount(ProgramState::
 				MAIN_PROGRAM_RENDER_KEY,
@@ -650,28 +643,26 @@ namespace Glest {
 				perfList.push_back(perfBuf);
 			}
 #ifdef DEBUG
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d programState->render took msecs: %lld ==============> MAIN LOOP RENDERING\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//update camera
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 #endif
 
 			chronoPerformanceCounts.start();
 
 			while (updateCameraTimer.isTime()) {
+				TraceScope traceCamera("ProgramState::updateCamera");
 				programState->updateCamera();
 			}
 
@@ -688,23 +679,20 @@ namespace Glest {
 			}
 
 #ifdef DEBUG
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d programState->render took msecs: %lld ==============> MAIN LOOP CAMERA UPDATING\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 
 			//update world
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 #endif
 			int
@@ -713,8 +701,7 @@ namespace Glest {
 				Chrono chronoUpdateLoop;
 
 #ifdef DEBUG
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 					chronoUpdateLoop.start();
 #endif
 				if (showPerfStats) {
@@ -727,12 +714,12 @@ namespace Glest {
 					perfList.push_back(perfBuf);
 				}
 
+				TraceScope traceUpdate("Program::update");
 				GraphicComponent::update();
 				programState->update();
 
 #ifdef DEBUG
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chronoUpdateLoop.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] programState->update took msecs: %lld, updateCount = %d\n",
@@ -740,8 +727,7 @@ namespace Glest {
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chronoUpdateLoop.getMillis(),
 						updateCount);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chronoUpdateLoop.getMillis() > 0)
 					chronoUpdateLoop.start();
 #endif
@@ -764,8 +750,7 @@ namespace Glest {
 						if (soundThreadManager != NULL) {
 
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s %d] ERROR / WARNING soundThreadManager->isThreadExecutionLagging is TRUE\n",
 									extractFileFromDirectoryPath
@@ -779,8 +764,7 @@ namespace Glest {
 						}
 						SoundRenderer::getInstance().update();
 #ifdef DEBUG
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chronoUpdateLoop.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] SoundRenderer::getInstance().update() took msecs: %lld, updateCount = %d\n",
@@ -789,8 +773,7 @@ namespace Glest {
 								__LINE__,
 								chronoUpdateLoop.getMillis(),
 								updateCount);
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chronoUpdateLoop.getMillis() > 0)
 							chronoUpdateLoop.start();
 #endif
@@ -819,8 +802,7 @@ namespace Glest {
 					("NetworkManager::getInstance().update()",
 						chronoPerformanceCounts.getMillis());
 #ifdef DEBUG
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chronoUpdateLoop.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] NetworkManager::getInstance().update() took msecs: %lld, updateCount = %d\n",
@@ -828,8 +810,7 @@ namespace Glest {
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chronoUpdateLoop.getMillis(),
 							updateCount);
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chronoUpdateLoop.getMillis() > 0)
 						chronoUpdateLoop.start();
 #endif
@@ -849,21 +830,18 @@ namespace Glest {
 			}
 
 #ifdef DEBUG
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d AFTER programState->update took msecs: %lld ==============> MAIN LOOP BODY LOGIC, updateCount = %d\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					chrono.getMillis(), updateCount);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 #endif
@@ -897,22 +875,19 @@ namespace Glest {
 					perfList.push_back(perfBuf);
 				}
 #ifdef DEBUG
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d programState->render took msecs: %lld ==============> MAIN LOOP TICKING\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
 				//if(SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugSystem,"In [%s::%s] Line: %d programState->render took msecs: %lld ==============> MAIN LOOP TICKING\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 #endif
@@ -925,8 +900,7 @@ namespace Glest {
 				}
 			}
 #ifdef DEBUG
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] ------------------------------- MAIN LOOP END, stats: loop took msecs: %lld -------------------------------\n",
 					extractFileFromDirectoryPath
@@ -973,8 +947,7 @@ namespace Glest {
 		void
 			Program::setState(ProgramState * programStateNew, bool cleanupOldState) {
 			try {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -985,8 +958,7 @@ namespace Glest {
 				bool msgBoxEnabled = msgBox.getEnabled();
 
 				if (dynamic_cast <Game *>(programStateNew) != NULL) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -1008,8 +980,7 @@ namespace Glest {
 					showCursor(true);
 					SDL_PumpEvents();
 					sleep(0);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -1019,8 +990,7 @@ namespace Glest {
 
 				if (cleanupOldState == true) {
 					if (this->programState != programStateNew) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -1030,8 +1000,7 @@ namespace Glest {
 						this->programStateOldSystemError = NULL;
 						delete this->programState;
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -1040,8 +1009,7 @@ namespace Glest {
 
 						this->programState = NULL;
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -1050,8 +1018,7 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1074,8 +1041,7 @@ namespace Glest {
 				}
 				programStateNew->load();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1084,8 +1050,7 @@ namespace Glest {
 
 				programStateNew->init();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1105,8 +1070,7 @@ namespace Glest {
 				}
 
 				this->programStateOldSystemError = NULL;
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -1120,8 +1084,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, e.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 				//abort();
 				//printf("44444444a ex.wantStackTrace() = %d\n",e.wantStackTrace());
@@ -1153,8 +1116,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, e.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, szBuf);
 				//abort();
 
@@ -1208,8 +1170,7 @@ namespace Glest {
 
 		void
 			Program::init(WindowGl * window, bool initSound, bool toggleFullScreen) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1219,8 +1180,7 @@ namespace Glest {
 			this->window = window;
 			Config & config = Config::getInstance();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1232,8 +1192,7 @@ namespace Glest {
 				setDisplaySettings();
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1249,8 +1208,7 @@ namespace Glest {
 				config.getInt("ScreenHeight"));
 			window->create();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1262,8 +1220,7 @@ namespace Glest {
 			updateTimer.init(GameConstants::updateFps, maxTimes);
 			updateCameraTimer.init(GameConstants::cameraFps, maxTimes);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1289,8 +1246,7 @@ namespace Glest {
 			logger.setFile(logFile);
 			logger.clear();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1301,8 +1257,7 @@ namespace Glest {
 			//Lang &lang= Lang::getInstance();
 			Lang::getInstance();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1312,8 +1267,7 @@ namespace Glest {
 			//render
 			Renderer & renderer = Renderer::getInstance();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1327,8 +1281,7 @@ namespace Glest {
 				config.getBool("FullScreenAntiAliasing", "false"),
 				config.getFloat("GammaValue", "0.0"));
 			window->setText(config.getString("WindowTitle", "ZetaGlest"));
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1338,8 +1291,7 @@ namespace Glest {
 			window->makeCurrentGl();
 			initResolution();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1350,8 +1302,7 @@ namespace Glest {
 			CoreData & coreData = CoreData::getInstance();
 			coreData.load();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1364,8 +1315,7 @@ namespace Glest {
 			tryingRendererInit = false;
 			rendererInitOk = true;
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1377,8 +1327,7 @@ namespace Glest {
 				SoundRenderer & soundRenderer = SoundRenderer::getInstance();
 				bool initOk = soundRenderer.init(window);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] initOk = %d\n",
 						extractFileFromDirectoryPath
@@ -1400,10 +1349,7 @@ namespace Glest {
 						delete soundThreadManager;
 					}
 					static
-						string
-						mutexOwnerId =
-						string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-						string("_") + intToStr(__LINE__);
+						const char *mutexOwnerId = CODE_AT_LINE;
 					soundThreadManager =
 						new SimpleTaskThread(&SoundRenderer::getInstance(), 0,
 							SOUND_THREAD_UPDATE_MILLISECONDS);
@@ -1421,8 +1367,7 @@ namespace Glest {
 				("AllowDownloadDataSynch",
 					"false"));
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -1478,8 +1423,7 @@ namespace Glest {
 
 		void
 			Program::showMessage(const char *msg) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d] msg [%s]\n",
 					extractFileFromDirectoryPath
@@ -1514,10 +1458,7 @@ namespace Glest {
 			stopSoundSystem();
 			if (SoundRenderer::getInstance().runningThreaded() == true) {
 				static
-					string
-					mutexOwnerId =
-					string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-					string("_") + intToStr(__LINE__);
+					const char *mutexOwnerId = CODE_AT_LINE;
 				soundThreadManager =
 					new SimpleTaskThread(&SoundRenderer::getInstance(), 0,
 						SOUND_THREAD_UPDATE_MILLISECONDS);
@@ -58,8 +58,7 @@ namespace
 		MainMenu::MainMenu(Program * program) :
 			ProgramState(program),
 			menuBackgroundVideo(NULL) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -73,8 +72,7 @@ namespace
 			this->
 				program = program;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -91,8 +89,7 @@ namespace
 
 			setState(new MenuStateRoot(program, this));
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -106,8 +103,7 @@ namespace
 		}
 
 		MainMenu::~MainMenu() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -127,16 +123,14 @@ namespace
 				oldstate;
 			oldstate = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
 
 			Renderer::getInstance().endMenu();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -144,8 +138,7 @@ namespace
 			//SoundRenderer &soundRenderer= SoundRenderer::getInstance();
 			//soundRenderer.stopAllSounds();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -380,8 +373,7 @@ namespace
 
 		MenuState::MenuState(Program * program, MainMenu * mainMenu,
 			const string & stateName) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -390,8 +382,7 @@ namespace
 			this->mainMenu = mainMenu;
 			console.registerGraphicComponent(containerName, "menuStateConsole");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -417,8 +408,7 @@ namespace
 			const XmlNode *
 				cameraNode = menuNode->getChild("camera");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -433,8 +423,7 @@ namespace
 			startPosition.z = positionNode->getAttribute("z")->getFloatValue();
 			camera.setPosition(startPosition);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -454,22 +443,19 @@ namespace
 					degToRad(startRotation.y),
 					degToRad(startRotation.z))));
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
 		}
 
 		MenuState::~MenuState() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
 			GraphicComponent::clearRegisteredComponents(this->containerName);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s %d]\n", __FILE__, __FUNCTION__,
 					__LINE__);
@@ -443,8 +443,7 @@ namespace Glest {
 			checkBoxScenario.setValue(false);
 			checkBoxScenario.setEditable(false);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -599,8 +598,7 @@ namespace Glest {
 
 				labelNetStatus[i].setText("V");
 			}
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -689,8 +687,7 @@ namespace Glest {
 						extractFileFromDirectoryPath(__FILE__).c_str(),
 						__FUNCTION__, __LINE__, scenario.c_str(), ex.what());
 					SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 					showMessageBox(szBuf, "Error", false);
 					//throw megaglest_runtime_error(szBuf);
@@ -709,8 +706,7 @@ namespace Glest {
 				int
 					portNumber = clientInterface->getServerFTPPort();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d] Using FTP port #: %d\n",
 						extractFileFromDirectoryPath
@@ -795,10 +791,7 @@ namespace Glest {
 			}
 			// Start http meta data thread
 			static
-				string
-				mutexOwnerId =
-				string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-				string("_") + intToStr(__LINE__);
+				const char *mutexOwnerId = CODE_AT_LINE;
 			modHttpServerThread = new SimpleTaskThread(this, 0, 200);
 			modHttpServerThread->setUniqueID(mutexOwnerId);
 			modHttpServerThread->start();
@@ -839,8 +832,7 @@ namespace Glest {
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -937,8 +929,7 @@ namespace Glest {
 			playerstatusItems.push_back(lang.getString("PlayerStatusReady"));
 			listBoxPlayerStatus.setItems(playerstatusItems);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -982,8 +973,7 @@ namespace Glest {
 				labelPlayers[i].setText(intToStr(i + 1));
 				listBoxControls[i].setItems(controlItems);
 			}
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1050,8 +1040,7 @@ namespace Glest {
 			if (modHttpServerThread != NULL) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1062,8 +1051,7 @@ namespace Glest {
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1093,8 +1081,7 @@ namespace Glest {
 
 					if (SystemFlags::VERBOSE_MODE_ENABLED)
 						printf("%s", szBuf);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 				}
 
@@ -1272,8 +1259,7 @@ namespace Glest {
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			static
-				string
-				mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+				const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper
 				safeMutexThreadOwner(callingThread->getMutexThreadOwnerValid(),
 					mutexOwnerId);
@@ -1441,7 +1427,7 @@ namespace Glest {
 
 			MutexSafeWrapper
 				safeMutex(callingThread->getMutexThreadObjectAccessor(),
-					string(__FILE__) + "_" + intToStr(__LINE__));
+					CODE_AT_LINE);
 			tilesetListRemote.clear();
 			Tokenize(tilesetsMetaData, tilesetListRemote, "\n");
 			safeMutex.ReleaseLock(true);
@@ -1564,8 +1550,7 @@ namespace Glest {
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -1913,8 +1898,7 @@ namespace Glest {
 							__FUNCTION__, __LINE__);
 						if (SystemFlags::VERBOSE_MODE_ENABLED)
 							printf("%s", szBuf);
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s",
 								szBuf);
 					}
@@ -1950,8 +1934,7 @@ namespace Glest {
 					int
 						portNumber = clientInterface->getServerFTPPort();
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d] Using FTP port #: %d\n",
 							extractFileFromDirectoryPath
@@ -2065,8 +2048,7 @@ namespace Glest {
 					}
 				}
 			} else if (buttonDisconnect.mouseClick(x, y)) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -2190,8 +2172,7 @@ namespace Glest {
 								clientInterface->setGameSettingsReceived(false);
 								settingsReceivedFromServer = false;
 
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line %d] sending a switchSlot request from %d to %d\n",
 										extractFileFromDirectoryPath
@@ -2242,16 +2223,14 @@ namespace Glest {
 					}
 
 				if (listBoxPlayerStatus.mouseClick(x, y)) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__);
 					soundRenderer.playFx(coreData.getClickSoundC());
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath
@@ -2303,8 +2282,7 @@ namespace Glest {
 							printf("In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath(__FILE__).c_str(),
 								__FUNCTION__, __LINE__);
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -2334,8 +2312,7 @@ namespace Glest {
 					}
 				}
 			}
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -2468,8 +2445,7 @@ namespace Glest {
 						printf("In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).c_str(),
 							__FUNCTION__, __LINE__);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath
@@ -2502,8 +2478,7 @@ namespace Glest {
 						printf("In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).c_str(),
 							__FUNCTION__, __LINE__);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 							getCurrentMapFile().c_str());
 
@@ -2565,8 +2540,7 @@ namespace Glest {
 				}
 
 				else if (listBoxMapFilter.mouseClick(x, y)) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 							getCurrentMapFile().c_str());
 					switchToNextMapGroup(listBoxMapFilter.getSelectedItemIndex() -
@@ -2631,8 +2605,7 @@ namespace Glest {
 								printf("In [%s::%s Line %d]\n",
 									extractFileFromDirectoryPath(__FILE__).c_str(),
 									__FUNCTION__, __LINE__);
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d]\n",
 									extractFileFromDirectoryPath
@@ -2717,15 +2690,13 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				showMessageBox(szBuf, "Error", false);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -2752,8 +2723,7 @@ namespace Glest {
 			SoundRenderer & soundRenderer = SoundRenderer::getInstance();
 			soundRenderer.playFx(coreData.getClickSoundC());
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -2890,8 +2860,7 @@ namespace Glest {
 				}
 				//printf("FACTIONS i = %d results [%s]\n",i,results[i].c_str());
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"Tech [%s] has faction [%s]\n",
 						techTreeFiles
@@ -2948,8 +2917,7 @@ namespace Glest {
 
 		void
 			MenuStateConnectedGame::loadGameSettings(GameSettings * gameSettings) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d\n",
 					extractFileFromDirectoryPath
@@ -2959,8 +2927,7 @@ namespace Glest {
 			int
 				factionCount = 0;
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -3211,8 +3178,7 @@ namespace Glest {
 							());
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] i = %d, factionFiles[listBoxFactions[i].getSelectedItemIndex()] [%s]\n",
 							extractFileFromDirectoryPath
@@ -3247,8 +3213,7 @@ namespace Glest {
 						}
 					} else if (listBoxControls[i].getSelectedItemIndex() != ctHuman) {
 						AIPlayerCount++;
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d] i = %d, playername is AI (blank)\n",
 								extractFileFromDirectoryPath
@@ -3288,8 +3253,7 @@ namespace Glest {
 
 					gameSettings->setResourceMultiplierIndex(slotIndex, 5);
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] i = %d, factionFiles[listBoxFactions[i].getSelectedItemIndex()] [%s]\n",
 							extractFileFromDirectoryPath
@@ -3417,8 +3381,7 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -3428,8 +3391,7 @@ namespace Glest {
 
 		void
 			MenuStateConnectedGame::returnToJoinMenu() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -3439,8 +3401,7 @@ namespace Glest {
 			if (modHttpServerThread != NULL) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -3451,8 +3412,7 @@ namespace Glest {
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -3482,16 +3442,14 @@ namespace Glest {
 						__FUNCTION__, __LINE__);
 					if (SystemFlags::VERBOSE_MODE_ENABLED)
 						printf("%s", szBuf);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 				}
 				ftpClientThread = NULL;
 			}
 
 			if (returnMenuInfo == jmSimple) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -3502,8 +3460,7 @@ namespace Glest {
 				disconnectFromServer();
 				mainMenu->setState(new MenuStateJoinGame(program, mainMenu));
 			} else {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -3956,8 +3913,7 @@ namespace Glest {
 		void
 			MenuStateConnectedGame::update() {
 			Chrono chrono;
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
 			Lang & lang = Lang::getInstance();
@@ -3980,16 +3936,14 @@ namespace Glest {
 				//printf("#2 admin key [%d] client key [%d]\n",settings->getMasterserver_admin(),clientInterface->getSessionKey());
 				broadCastGameSettingsToHeadlessServer(false);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -4098,23 +4052,20 @@ namespace Glest {
 					labelWaitingForPlayers.setVisible(false);
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
 				if (difftime((long int) time(NULL), lastNetworkSendPing) >=
 					GameConstants::networkPingInterval) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] about to sendPingMessage...\n",
 							extractFileFromDirectoryPath
@@ -4126,8 +4077,7 @@ namespace Glest {
 						networkPingInterval,
 						(int64) time(NULL));
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] pingCount = %d, clientInterface->getLastPingLag() = %f, GameConstants::networkPingInterval = %d\n",
 							extractFileFromDirectoryPath
@@ -4141,39 +4091,34 @@ namespace Glest {
 						pingCount >= MAX_PING_LAG_COUNT
 						&& clientInterface->getLastPingLag() >=
 						(GameConstants::networkPingInterval * MAX_PING_LAG_COUNT)) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__);
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
 						clientInterface->updateLobby();
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -4213,8 +4158,7 @@ namespace Glest {
 					}
 
 					pingCount++;
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -4222,16 +4166,14 @@ namespace Glest {
 							__LINE__);
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -4246,16 +4188,14 @@ namespace Glest {
 
 					label = label + ", " + clientInterface->getVersionString();
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -4270,8 +4210,7 @@ namespace Glest {
 								NULL ?
 								ftpClientThread->getProgressMutex() :
 								NULL,
-								string(__FILE__) + "_" +
-								intToStr(__LINE__));
+								CODE_AT_LINE);
 
 						uint32 tilesetCRC = lastCheckedCRCTilesetValue;
 						if (lastCheckedCRCTilesetName !=
@@ -4298,16 +4237,14 @@ namespace Glest {
 							lastCheckedCRCTilesetName = displayedGamesettings.getTileset();
 						}
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -4362,16 +4299,14 @@ namespace Glest {
 								}
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -4382,16 +4317,14 @@ namespace Glest {
 
 							loadFactions(&displayedGamesettings, false);
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -4467,31 +4400,27 @@ namespace Glest {
 								}
 							}
 							//console.addLine("Found factions: " + intToStr(factionCRCList.size()));
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
 						}
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -4514,16 +4443,14 @@ namespace Glest {
 						}
 						safeMutexFTPProgress.ReleaseLock();
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -4646,8 +4573,7 @@ namespace Glest {
 											languageList[i]);
 									}
 
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugPerformance).enabled
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 										&& chrono.getMillis() > 0)
 										SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 											"In [%s::%s Line: %d] took msecs: %lld\n",
@@ -4655,8 +4581,7 @@ namespace Glest {
 											(__FILE__).c_str(),
 											__FUNCTION__, __LINE__,
 											chrono.getMillis());
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugPerformance).enabled
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 										&& chrono.getMillis() > 0)
 										chrono.start();
 
@@ -4834,8 +4759,7 @@ namespace Glest {
 										}
 									}
 
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugPerformance).enabled
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 										&& chrono.getMillis() > 0)
 										SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 											"In [%s::%s Line: %d] took msecs: %lld\n",
@@ -4843,8 +4767,7 @@ namespace Glest {
 											(__FILE__).c_str(),
 											__FUNCTION__, __LINE__,
 											chrono.getMillis());
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugPerformance).enabled
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 										&& chrono.getMillis() > 0)
 										chrono.start();
 								}
@@ -4857,16 +4780,14 @@ namespace Glest {
 						}
 					}
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -4889,16 +4810,14 @@ namespace Glest {
 							}
 						}
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -4916,16 +4835,14 @@ namespace Glest {
 							}
 						}
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -4945,8 +4862,7 @@ namespace Glest {
 									lastTechtreeDataSynchError =
 										"techtree CRC mismatch" + report;
 
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::debugSystem,
 											"In [%s::%s Line: %d] report: %s\n",
 											extractFileFromDirectoryPath
@@ -4969,16 +4885,14 @@ namespace Glest {
 							}
 						}
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -4991,16 +4905,14 @@ namespace Glest {
 
 					labelStatus.setText(label);
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -5011,16 +4923,14 @@ namespace Glest {
 						label = label + " " + clientInterface->getServerName();
 					}
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -5046,21 +4956,18 @@ namespace Glest {
 					labelStatus.setText(label);
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 			} else {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -5069,8 +4976,7 @@ namespace Glest {
 
 				if (clientInterface != NULL
 					&& clientInterface->isConnected() == true) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -5079,21 +4985,18 @@ namespace Glest {
 					clientInterface->close();
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -5103,31 +5006,27 @@ namespace Glest {
 				return;
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s Line: %d] took msecs: %lld\n",
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					chrono.getMillis());
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				chrono.start();
 
 			//process network messages
 			if (clientInterface != NULL && clientInterface->isConnected()) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -5145,16 +5044,14 @@ namespace Glest {
 						const GameSettings *
 							receivedGameSettings = clientInterface->getGameSettings();
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -5166,16 +5063,14 @@ namespace Glest {
 							// copy my current settings in UI to displayedSettings;
 							loadGameSettings(&displayedGamesettings);
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -5250,16 +5145,14 @@ namespace Glest {
 
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -5267,16 +5160,14 @@ namespace Glest {
 								errorOnMissingData);
 						} else {
 							// do nothing
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -5284,16 +5175,14 @@ namespace Glest {
 								errorOnMissingData);
 						}
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -5301,16 +5190,14 @@ namespace Glest {
 						(needToBroadcastServerSettings);
 					}
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -5320,16 +5207,14 @@ namespace Glest {
 						clientInterface->getReadyForInGameJoin() == true &&
 						ftpClientThread != NULL) {
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -5382,16 +5267,14 @@ namespace Glest {
 								gameSettings = *clientInterface->getGameSettings();
 							loadGameSettings(&gameSettings);
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -5400,16 +5283,14 @@ namespace Glest {
 						}
 					}
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -5417,45 +5298,39 @@ namespace Glest {
 					clientInterface =
 						NetworkManager::getInstance().getClientInterface();
 					if (clientInterface != NULL && clientInterface->isConnected()) {
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
 						clientInterface->updateLobby();
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 					}
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -5466,8 +5341,7 @@ namespace Glest {
 							clientInterface->getIntroDone() == true &&
 							(switchSetupRequestFlagType & ssrft_NetworkPlayerName) ==
 							ssrft_NetworkPlayerName) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d] getHumanPlayerName() = [%s], clientInterface->getGameSettings()->getThisFactionIndex() = %d\n",
 									extractFileFromDirectoryPath
@@ -5488,16 +5362,14 @@ namespace Glest {
 							switchSetupRequestFlagType = ssrft_None;
 						}
 
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 								"In [%s::%s Line: %d] took msecs: %lld\n",
 								extractFileFromDirectoryPath
 								(__FILE__).c_str(), __FUNCTION__,
 								__LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType
-						(SystemFlags::debugPerformance).enabled
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 							&& chrono.getMillis() > 0)
 							chrono.start();
 
@@ -5513,8 +5385,7 @@ namespace Glest {
 
 						//launch
 						if (clientInterface->getLaunchGame()) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -5523,8 +5394,7 @@ namespace Glest {
 
 							assert(clientInterface != NULL);
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -5535,8 +5405,7 @@ namespace Glest {
 								if (SystemFlags::VERBOSE_MODE_ENABLED)
 									printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__,
 										__LINE__);
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line %d]\n", __FILE__,
 										__FUNCTION__, __LINE__);
@@ -5546,8 +5415,7 @@ namespace Glest {
 								if (SystemFlags::VERBOSE_MODE_ENABLED)
 									printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__,
 										__LINE__);
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line %d]\n", __FILE__,
 										__FUNCTION__, __LINE__);
@@ -5561,16 +5429,14 @@ namespace Glest {
 								modHttpServerThread = NULL;
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -5590,32 +5456,28 @@ namespace Glest {
 										__FUNCTION__, __LINE__);
 									if (SystemFlags::VERBOSE_MODE_ENABLED)
 										printf("%s", szBuf);
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s",
 											szBuf);
 								}
 								ftpClientThread = NULL;
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__);
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -5642,16 +5504,14 @@ namespace Glest {
 								(scenarioInfo.defaultVictoryConditions);
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 									"In [%s::%s Line: %d] took msecs: %lld\n",
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(), __FUNCTION__,
 									__LINE__, chrono.getMillis());
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugPerformance).enabled
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 								&& chrono.getMillis() > 0)
 								chrono.start();
 
@@ -5663,16 +5523,14 @@ namespace Glest {
 					//call the chat manager
 					chatManager.updateNetwork();
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -5706,16 +5564,14 @@ namespace Glest {
 						soundConnectionCount = currentConnectionCount;
 					}
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 				} catch (const runtime_error & ex) {
@@ -5729,8 +5585,7 @@ namespace Glest {
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, ex.what());
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d] %s\n",
 							extractFileFromDirectoryPath
@@ -5739,16 +5594,14 @@ namespace Glest {
 					showMessageBox(szBuf, "Error", false);
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 			}
@@ -5757,8 +5610,7 @@ namespace Glest {
 		bool
 			MenuStateConnectedGame::loadFactions(const GameSettings * gameSettings,
 				bool errorOnNoFactions) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -5789,8 +5641,7 @@ namespace Glest {
 				}
 
 				if (results.empty() == true) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -5807,8 +5658,7 @@ namespace Glest {
 								("(2)There are no factions for the tech tree [" +
 									gameSettings->getTech() + "]");
 						}
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d] (2)There are no factions for the tech tree [%s]\n",
 								extractFileFromDirectoryPath
@@ -5875,8 +5725,7 @@ namespace Glest {
 					}
 
 					foundFactions = false;
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -5929,8 +5778,7 @@ namespace Glest {
 					foundFactions = (results.empty() == false);
 				}
 			}
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -5982,8 +5830,7 @@ namespace Glest {
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d] %s\n",
 						extractFileFromDirectoryPath
@@ -6157,8 +6004,7 @@ namespace Glest {
 
 		void
 			MenuStateConnectedGame::loadFactionTexture(string filepath) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -6169,16 +6015,14 @@ namespace Glest {
 				if (filepath == "") {
 					factionTexture = NULL;
 				} else {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] filepath = [%s]\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, filepath.c_str());
 					factionTexture = Renderer::findTexture(filepath);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -6193,8 +6037,7 @@ namespace Glest {
 				bool loadMapPreview) {
 			bool mapLoaded = false;
 			try {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] map [%s]\n",
 						extractFileFromDirectoryPath
@@ -6202,8 +6045,7 @@ namespace Glest {
 						__LINE__, file.c_str());
 
 				if (file != "") {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -6220,8 +6062,7 @@ namespace Glest {
 
 						// Not painting properly so this is on hold
 						if (loadMapPreview == true) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -6247,8 +6088,7 @@ namespace Glest {
 						gameSettings = clientInterface->getGameSettings();
 
 					if (lastMissingMap != gameSettings->getMap()) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -6292,8 +6132,7 @@ namespace Glest {
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					e.what());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] error [%s]\n",
 						extractFileFromDirectoryPath
@@ -6360,8 +6199,7 @@ namespace Glest {
 
 		void
 			MenuStateConnectedGame::cleanupMapPreviewTexture() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -6369,8 +6207,7 @@ namespace Glest {
 					__LINE__);
 
 			if (mapPreviewTexture != NULL) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -6379,8 +6216,7 @@ namespace Glest {
 
 				mapPreviewTexture->end();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -6389,8 +6225,7 @@ namespace Glest {
 				delete mapPreviewTexture;
 				mapPreviewTexture = NULL;
 			}
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -6412,8 +6247,7 @@ namespace Glest {
 				FTP_Client_ResultType,
 				string > result,
 				void *userdata) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -6490,8 +6324,7 @@ namespace Glest {
 									getHumanPlayerName().c_str(), itemName.c_str(),
 									fileProgress);
 							}
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d] szMsg [%s] lastProgress.first = %d, fileProgress = %d\n",
 									extractFileFromDirectoryPath
@@ -6537,8 +6370,7 @@ namespace Glest {
 								"Please wait, player: %s is extracting: %s",
 								getHumanPlayerName().c_str(), itemName.c_str());
 						}
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d] szMsg [%s]\n",
 								extractFileFromDirectoryPath
@@ -7297,8 +7129,7 @@ namespace Glest {
 					if (lastMissingTileSet != gameSettings->getTileset()) {
 						lastMissingTileSet = gameSettings->getTileset();
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -7415,8 +7246,7 @@ namespace Glest {
 					if (lastMissingTechtree != gameSettings->getTech()) {
 						lastMissingTechtree = gameSettings->getTech();
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -7472,8 +7302,7 @@ namespace Glest {
 			bool hasFactions = true;
 			if (currentFactionName != gameSettings->getTech()
 				&& gameSettings->getTech() != "") {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] hasFactions = %d, currentFactionName [%s]\n",
 						extractFileFromDirectoryPath
@@ -7923,8 +7752,7 @@ namespace Glest {
 				getInstance().loadGameSettingsFromFile(HEADLESS_SAVED_GAME_FILENAME,
 					&gameSettings);
 			if (gameSettings.getMap() == "") {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -8044,8 +7872,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -8099,8 +7926,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -8135,8 +7961,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -222,8 +222,7 @@ namespace Glest {
 				this->autostart = autostart;
 				this->autoStartSettings = settings;
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d] autostart = %d\n",
 						extractFileFromDirectoryPath
@@ -289,8 +288,7 @@ namespace Glest {
 				//initialize network interface
 				NetworkManager::getInstance().end();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -307,16 +305,14 @@ namespace Glest {
 						extractFileFromDirectoryPath(__FILE__).c_str(),
 						__FUNCTION__, __LINE__, ex.what());
 					SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 					showGeneralError = true;
 					generalErrorToShow = szBuf;
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -597,8 +593,7 @@ namespace Glest {
 							extractFileFromDirectoryPath(__FILE__).c_str(),
 							__FUNCTION__, __LINE__, scenario.c_str(), ex.what());
 						SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-						if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 							showMessageBox(szBuf, "Error", false);
 							//throw megaglest_runtime_error(szBuf);
@@ -910,8 +905,7 @@ namespace Glest {
 					true);
 				labelMapInfo.setText(mapInfo.desc);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -945,8 +939,7 @@ namespace Glest {
 					updateControllers();
 					updateNetworkSlots();
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -958,8 +951,7 @@ namespace Glest {
 
 					serverInterface->setGameSettings(&gameSettings, false);
 				}
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -980,17 +972,13 @@ namespace Glest {
 
 				GraphicComponent::applyAllCustomProperties(containerName);
 
-				static string mutexOwnerId =
-					string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-					string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				publishToMasterserverThread =
 					new SimpleTaskThread(this, 0, 300, false,
 					(void *) tnt_MASTERSERVER);
 				publishToMasterserverThread->setUniqueID(mutexOwnerId);
 
-				static string mutexOwnerId2 =
-					string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-					string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId2 = CODE_AT_LINE;
 				publishToClientsThread =
 					new SimpleTaskThread(this, 0, 200, false, (void *) tnt_CLIENTS,
 						false);
@@ -1012,8 +1000,7 @@ namespace Glest {
 					if (fileExists(data_path + DEFAULT_GAME_FILENAME) == true)
 						loadGameSettings(data_path + DEFAULT_GAME_FILENAME);
 				}
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -1026,8 +1013,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -1201,8 +1187,7 @@ namespace Glest {
 			labelFallbackCpuMultiplier.setText(lang.getString
 			("FallbackCpuMultiplier"));
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1244,8 +1229,7 @@ namespace Glest {
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("\n\n#1 cleanupThread callingThread [%p]\n", *thread);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -1265,8 +1249,7 @@ namespace Glest {
 				lastNetworkPing = time(NULL);
 				threadPtr->setThreadOwnerValid(false);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -1316,8 +1299,7 @@ namespace Glest {
 						//SystemFlags::OutputDebug(SystemFlags::debugError,szBuf);
 						if (SystemFlags::VERBOSE_MODE_ENABLED)
 							printf("%s", szBuf);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s",
 								szBuf);
 
@@ -1352,8 +1334,7 @@ namespace Glest {
 						//SystemFlags::OutputDebug(SystemFlags::debugError,szBuf);
 						if (SystemFlags::VERBOSE_MODE_ENABLED)
 							printf("%s", szBuf);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s",
 								szBuf);
 
@@ -1374,8 +1355,7 @@ namespace Glest {
 		}
 
 		void MenuStateCustomGame::cleanup() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1393,8 +1373,7 @@ namespace Glest {
 
 			//printf("LINE: %d\n",__LINE__);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1413,8 +1392,7 @@ namespace Glest {
 				NetworkManager::getInstance().end();
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1430,8 +1408,7 @@ namespace Glest {
 
 			cleanup();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1444,8 +1421,7 @@ namespace Glest {
 		}
 
 		void MenuStateCustomGame::returnToParentMenu() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1457,8 +1433,7 @@ namespace Glest {
 			lastNetworkPing = time(NULL);
 			ParentMenuState parentMenuState = this->parentMenuState;
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1467,8 +1442,7 @@ namespace Glest {
 
 			forceWaitForShutdown = false;
 			if (parentMenuState == pMasterServer) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -1477,8 +1451,7 @@ namespace Glest {
 				cleanup();
 				mainMenu->setState(new MenuStateMasterserver(program, mainMenu));
 			} else if (parentMenuState == pLanGame) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -1487,8 +1460,7 @@ namespace Glest {
 				cleanup();
 				mainMenu->setState(new MenuStateJoinGame(program, mainMenu));
 			} else {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -1498,8 +1470,7 @@ namespace Glest {
 				mainMenu->setState(new MenuStateNewGame(program, mainMenu));
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -1592,8 +1563,7 @@ namespace Glest {
 						setActiveInputLabel(NULL);
 					}
 					if (buttonReturn.mouseClick(x, y) || serverInitError == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -1620,8 +1590,7 @@ namespace Glest {
 						safeMutex.ReleaseLock();
 						safeMutexCLI.ReleaseLock();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -1632,8 +1601,7 @@ namespace Glest {
 						return;
 					} else if (buttonPlayNow.mouseClick(x, y)
 						&& buttonPlayNow.getEnabled()) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -1648,8 +1616,7 @@ namespace Glest {
 
 						RestoreLastGameSettings();
 					} else if (listBoxMap.mouseClick(x, y, advanceToItemStartingWith)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 								getCurrentMapFile().c_str());
 
@@ -1944,8 +1911,7 @@ namespace Glest {
 							switchToNextMapGroup(listBoxMapFilter.getSelectedItemIndex() -
 								oldListBoxMapfilterIndex);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-								enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s\n",
 									getCurrentMapFile().c_str());
 
@@ -2090,8 +2056,7 @@ namespace Glest {
 									if (selectedControlItemIndex != ctHuman &&
 										checkControTypeClicked == true &&
 										listBoxControls[i].mouseClick(x, y)) {
-										if (SystemFlags::getSystemSettingType
-										(SystemFlags::debugSystem).enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 											SystemFlags::OutputDebug(SystemFlags::debugSystem,
 												"In [%s::%s Line %d]\n",
 												extractFileFromDirectoryPath
@@ -2143,8 +2108,7 @@ namespace Glest {
 												}
 											}
 
-											if (SystemFlags::getSystemSettingType
-											(SystemFlags::debugSystem).enabled)
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 												SystemFlags::OutputDebug(SystemFlags::debugSystem,
 													"In [%s::%s Line %d] humanIndex1 = %d, humanIndex2 = %d\n",
 													extractFileFromDirectoryPath
@@ -2155,8 +2119,7 @@ namespace Glest {
 											//no human
 											if (humanIndex1 == -1 && humanIndex2 == -1) {
 												setSlotHuman(index);
-												if (SystemFlags::getSystemSettingType
-												(SystemFlags::debugSystem).enabled)
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 													SystemFlags::OutputDebug(SystemFlags::debugSystem,
 														"In [%s::%s Line %d] i = %d, labelPlayerNames[i].getText() [%s]\n",
 														extractFileFromDirectoryPath
@@ -2178,8 +2141,7 @@ namespace Glest {
 												string origPlayName =
 													labelPlayerNames[closeSlotIndex].getText();
 
-												if (SystemFlags::getSystemSettingType
-												(SystemFlags::debugSystem).enabled)
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 													SystemFlags::OutputDebug(SystemFlags::debugSystem,
 														"In [%s::%s Line %d] closeSlotIndex = %d, origPlayName [%s]\n",
 														extractFileFromDirectoryPath
@@ -2330,8 +2292,7 @@ namespace Glest {
 
 				if (hasNetworkGameSettings() == true
 					&& listBoxPlayerStatus.mouseClick(x, y)) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -2349,8 +2310,7 @@ namespace Glest {
 						listBoxPlayerStatus.setLighted(false);
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -2371,16 +2331,14 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				showGeneralError = true;
 				generalErrorToShow = szBuf;
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -2392,8 +2350,7 @@ namespace Glest {
 			// Ensure we have set the gamesettings at least once
 			GameSettings gameSettings = loadGameSettingsFromFile(fileName);
 			if (gameSettings.getMap() == "") {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -2510,8 +2467,7 @@ namespace Glest {
 			SoundRenderer & soundRenderer = SoundRenderer::getInstance();
 			soundRenderer.playFx(coreData.getClickSoundC());
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -2521,8 +2477,7 @@ namespace Glest {
 			std::vector < string > randomFactionSelectionList;
 			int RandomCount = 0;
 			for (int i = 0; i < mapInfo.players; ++i) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -2534,8 +2489,7 @@ namespace Glest {
 					if (listBoxFactions[i].getSelectedItem() ==
 						formatString(GameConstants::RANDOMFACTION_SLOTNAME)
 						&& listBoxFactions[i].getItemCount() > 1) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d] i = %d\n",
 								extractFileFromDirectoryPath
@@ -2553,8 +2507,7 @@ namespace Glest {
 							string selectedFactionName =
 								listBoxFactions[i].getItem(selectedFactionIndex);
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d] selectedFactionName [%s] selectedFactionIndex = %d, findRandomFaction = %d\n",
 									extractFileFromDirectoryPath
@@ -2573,8 +2526,7 @@ namespace Glest {
 									selectedFactionName) ==
 								randomFactionSelectionList.end()) {
 
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line %d]\n",
 										extractFileFromDirectoryPath
@@ -2588,8 +2540,7 @@ namespace Glest {
 
 						if (listBoxFactions[i].getSelectedItem() ==
 							formatString(GameConstants::RANDOMFACTION_SLOTNAME)) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d] RandomCount = %d\n",
 									extractFileFromDirectoryPath
@@ -2615,8 +2566,7 @@ namespace Glest {
 							(factionIndexToUse));
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d] i = %d, listBoxFactions[i].getSelectedItem() [%s]\n",
 								extractFileFromDirectoryPath
@@ -2639,8 +2589,7 @@ namespace Glest {
 			GameSettings gameSettings;
 			loadGameSettings(&gameSettings, true);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -2703,8 +2652,7 @@ namespace Glest {
 			}
 
 			if (dataSynchCheckOk == false) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -2719,8 +2667,7 @@ namespace Glest {
 				safeMutexCLI.ReleaseLock();
 				return;
 			} else {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -2728,8 +2675,7 @@ namespace Glest {
 						__LINE__);
 				if ((hasNetworkGameSettings() == true
 					&& needToSetChangedGameSettings == true) || (RandomCount > 0)) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -2741,8 +2687,7 @@ namespace Glest {
 					lastSetChangedGameSettings = time(NULL);
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -2753,8 +2698,7 @@ namespace Glest {
 				if (isMasterserverMode() == false) {
 					bool hasHuman = false;
 					for (int i = 0; i < mapInfo.players; ++i) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -2795,8 +2739,7 @@ namespace Glest {
 				serverInterface->setNeedToRepublishToMasterserver
 				(checkBoxPublishServer.getValue() == true);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -2804,8 +2747,7 @@ namespace Glest {
 						__LINE__);
 				bool bOkToStart = serverInterface->launchGame(&gameSettings);
 				if (bOkToStart == true) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -2814,8 +2756,7 @@ namespace Glest {
 					if (checkBoxPublishServer.getEditable() &&
 						checkBoxPublishServer.getValue() == true) {
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -2825,8 +2766,7 @@ namespace Glest {
 						needToRepublishToMasterserver = true;
 						lastMasterserverPublishing = 0;
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -2839,8 +2779,7 @@ namespace Glest {
 					safeMutex.ReleaseLock();
 					safeMutexCLI.ReleaseLock();
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -2848,8 +2787,7 @@ namespace Glest {
 
 					assert(program != NULL);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -3208,8 +3146,7 @@ namespace Glest {
 				//throw megaglest_runtime_error(szBuf);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 				showGeneralError = true;
 				generalErrorToShow = szBuf;
@@ -3227,8 +3164,7 @@ namespace Glest {
 				if (switchSetupRequests[i] != NULL) {
 					//printf("Switch slot = %d control = %d newIndex = %d currentindex = %d onlyNetworkUnassigned = %d\n",i,listBoxControls[i].getSelectedItemIndex(),switchSetupRequests[i]->getToFactionIndex(),switchSetupRequests[i]->getCurrentFactionIndex(),onlyNetworkUnassigned);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] switchSetupRequests[i]->getSwitchFlags() = %d\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -3250,8 +3186,7 @@ namespace Glest {
 					if (listBoxControls[i].getSelectedItemIndex() == ctNetwork
 						|| listBoxControls[i].getSelectedItemIndex() ==
 						ctNetworkUnassigned) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d] switchSetupRequests[i]->getToFactionIndex() = %d\n",
 								extractFileFromDirectoryPath
@@ -3304,8 +3239,7 @@ namespace Glest {
 										}
 									}
 									if (switchSetupRequests[i]->getNetworkPlayerName() != "") {
-										if (SystemFlags::getSystemSettingType
-										(SystemFlags::debugSystem).enabled)
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 											SystemFlags::OutputDebug(SystemFlags::debugSystem,
 												"In [%s::%s Line %d] i = %d, labelPlayerNames[newFactionIdx].getText() [%s] switchSetupRequests[i]->getNetworkPlayerName() [%s]\n",
 												extractFileFromDirectoryPath
@@ -3347,8 +3281,7 @@ namespace Glest {
 										(__FILE__).c_str(),
 										__FUNCTION__, __LINE__,
 										e.what());
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::debugSystem,
 											"In [%s::%s Line: %d] caught exception error = [%s]\n",
 											extractFileFromDirectoryPath
@@ -3385,8 +3318,7 @@ namespace Glest {
 
 								if ((switchSetupRequests[i]->getSwitchFlags() &
 									ssrft_NetworkPlayerName) == ssrft_NetworkPlayerName) {
-									if (SystemFlags::getSystemSettingType
-									(SystemFlags::debugSystem).enabled)
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 										SystemFlags::OutputDebug(SystemFlags::debugSystem,
 											"In [%s::%s Line: %d] i = %d, switchSetupRequests[i]->getSwitchFlags() = %d, switchSetupRequests[i]->getNetworkPlayerName() [%s], labelPlayerNames[i].getText() [%s]\n",
 											extractFileFromDirectoryPath
@@ -3415,8 +3347,7 @@ namespace Glest {
 									extractFileFromDirectoryPath
 									(__FILE__).c_str(),
 									__FUNCTION__, __LINE__, e.what());
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line: %d] caught exception error = [%s]\n",
 										extractFileFromDirectoryPath
@@ -3551,8 +3482,7 @@ namespace Glest {
 		}
 
 		void MenuStateCustomGame::publishToMasterserver() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -3578,8 +3508,7 @@ namespace Glest {
 
 			publishToServerInfo.clear();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -3652,8 +3581,7 @@ namespace Glest {
 			}
 
 			publishToServerInfo["gameUUID"] = gameSettings.getGameUUID();
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -3741,8 +3669,7 @@ namespace Glest {
 
 				MutexSafeWrapper
 					safeMutexThreadOwner(callingThread->getMutexThreadOwnerValid(),
-						string(__FILE__) + "_" +
-						intToStr(__LINE__));
+						CODE_AT_LINE);
 				if (callingThread->getQuitStatus() == true
 					|| safeMutexThreadOwner.isValidMutex() == false) {
 					return;
@@ -3752,7 +3679,7 @@ namespace Glest {
 
 				MutexSafeWrapper
 					safeMutex(callingThread->getMutexThreadObjectAccessor(),
-						string(__FILE__) + "_" + intToStr(__LINE__));
+						CODE_AT_LINE);
 				bool republish = (needToRepublishToMasterserver == true
 					&& publishToServerInfo.empty() == false);
 				needToRepublishToMasterserver = false;
@@ -3769,8 +3696,7 @@ namespace Glest {
 				//printf("-=-=-=-=- IN MenuStateCustomGame simpleTask - C\n");
 
 				if (republish == true) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -3803,8 +3729,7 @@ namespace Glest {
 					if (SystemFlags::VERBOSE_MODE_ENABLED)
 						printf("The Lobby request is:\n%s\n", request.c_str());
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d] the request is:\n%s\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -3818,8 +3743,7 @@ namespace Glest {
 
 					MutexSafeWrapper
 						safeMutexThreadOwner2(callingThread->getMutexThreadOwnerValid(),
-							string(__FILE__) + "_" +
-							intToStr(__LINE__));
+							CODE_AT_LINE);
 					if (callingThread->getQuitStatus() == true
 						|| safeMutexThreadOwner2.isValidMutex() == false) {
 						return;
@@ -3827,8 +3751,7 @@ namespace Glest {
 					safeMutex.Lock();
 
 					//printf("the result is:\n'%s'\n",serverInfo.c_str());
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d] the result is:\n'%s'\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -3872,8 +3795,7 @@ namespace Glest {
 					safeMutexThreadOwner.ReleaseLock();
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -3891,8 +3813,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				if (callingThread->getQuitStatus() == false) {
@@ -3902,8 +3823,7 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -3918,8 +3838,7 @@ namespace Glest {
 
 				MutexSafeWrapper
 					safeMutexThreadOwner(callingThread->getMutexThreadOwnerValid(),
-						string(__FILE__) + "_" +
-						intToStr(__LINE__));
+						CODE_AT_LINE);
 				if (callingThread->getQuitStatus() == true
 					|| safeMutexThreadOwner.isValidMutex() == false) {
 					return;
@@ -3929,7 +3848,7 @@ namespace Glest {
 
 				MutexSafeWrapper
 					safeMutex(callingThread->getMutexThreadObjectAccessor(),
-						string(__FILE__) + "_" + intToStr(__LINE__));
+						CODE_AT_LINE);
 				bool broadCastSettings = needToBroadcastServerSettings;
 
 				//printf("simpleTask broadCastSettings = %d\n",broadCastSettings);
@@ -3956,8 +3875,7 @@ namespace Glest {
 
 				safeMutexThreadOwner.ReleaseLock();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
@@ -3969,15 +3887,13 @@ namespace Glest {
 				if (broadCastSettings == true) {
 					MutexSafeWrapper
 						safeMutexThreadOwner2(callingThread->getMutexThreadOwnerValid(),
-							string(__FILE__) + "_" +
-							intToStr(__LINE__));
+							CODE_AT_LINE);
 					if (callingThread->getQuitStatus() == true
 						|| safeMutexThreadOwner2.isValidMutex() == false) {
 						return;
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -4000,8 +3916,7 @@ namespace Glest {
 
 							//printf("\n\n\n\n=====#2 got settings [%d] [%d]:\n%s\n",lastMasterServerSettingsUpdateCount,serverInterface->getGameSettingsUpdateCount(),gameSettings.toString().c_str());
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d]\n",
 									extractFileFromDirectoryPath
@@ -4013,8 +3928,7 @@ namespace Glest {
 								serverInterface->getGameSettingsUpdateCount();
 
 							if (hasClientConnection == true) {
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line %d]\n",
 										extractFileFromDirectoryPath
@@ -4031,8 +3945,7 @@ namespace Glest {
 				if (needPing == true) {
 					MutexSafeWrapper
 						safeMutexThreadOwner2(callingThread->getMutexThreadOwnerValid(),
-							string(__FILE__) + "_" +
-							intToStr(__LINE__));
+							CODE_AT_LINE);
 					if (callingThread->getQuitStatus() == true
 						|| safeMutexThreadOwner2.isValidMutex() == false) {
 						return;
@@ -4040,8 +3953,7 @@ namespace Glest {
 
 					lastNetworkPing = time(NULL);
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d] Sending nmtPing to clients\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -4050,8 +3962,7 @@ namespace Glest {
 					ServerInterface *serverInterface =
 						NetworkManager::getInstance().getServerInterface(false);
 					if (serverInterface != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -4062,8 +3973,7 @@ namespace Glest {
 								time(NULL));
 						//serverInterface->broadcastPing(&msg);
 						serverInterface->queueBroadcastMessage(msg);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -4080,8 +3990,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				if (callingThread->getQuitStatus() == false) {
@@ -4091,8 +4000,7 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n",
 					extractFileFromDirectoryPath
@@ -4102,8 +4010,7 @@ namespace Glest {
 
 		void MenuStateCustomGame::loadGameSettings(GameSettings * gameSettings,
 			bool forceCloseUnusedSlots) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d\n",
 					extractFileFromDirectoryPath
@@ -4114,8 +4021,7 @@ namespace Glest {
 			ServerInterface *serverInterface =
 				NetworkManager::getInstance().getServerInterface();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -4269,6 +4175,23 @@ namespace Glest {
 				gameSettings->setFlagTypes1(valueFlags1);
 
 			}
+			// the host decides the pathfinder so every peer finds the same paths
+			if (Config::getInstance().getBool("EnableHierarchicalPathfinder",
+				"false") == true) {
+				valueFlags1 |= ft1_hierarchical_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			} else {
+				valueFlags1 &= ~ft1_hierarchical_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			}
+			if (Config::getInstance().getBool("EnableGroupFlowFieldPathfinder",
+				"false") == true) {
+				valueFlags1 |= ft1_group_flow_field_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			} else {
+				valueFlags1 &= ~ft1_group_flow_field_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			}
 
 			gameSettings->setNetworkAllowNativeLanguageTechtree
 			(checkBoxAllowNativeLanguageTechtree.getValue());
@@ -4524,8 +4447,7 @@ namespace Glest {
 					//printf("Test multiplier = %s\n",listBoxRMultiplier[i].getSelectedItem().c_str());
 
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] i = %d, factionFiles[listBoxFactions[i].getSelectedItemIndex()] [%s]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -4691,8 +4613,7 @@ namespace Glest {
 					if (listBoxControls[i].getSelectedItemIndex() == ctNetwork
 						|| listBoxControls[i].getSelectedItemIndex() ==
 						ctNetworkUnassigned) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -4701,8 +4622,7 @@ namespace Glest {
 
 						if (serverInterface->getSlot(i, true) != NULL
 							&& serverInterface->getSlot(i, true)->isConnected()) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d]\n",
 									extractFileFromDirectoryPath
@@ -4744,8 +4664,7 @@ namespace Glest {
 
 						if (serverInterface->getSlot(i, true) != NULL
 							&& serverInterface->getSlot(i, true)->isConnected()) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d]\n",
 									extractFileFromDirectoryPath
@@ -4785,8 +4704,7 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -4795,8 +4713,7 @@ namespace Glest {
 		}
 
 		void MenuStateCustomGame::saveGameSettingsToFile(std::string fileName) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -4810,8 +4727,7 @@ namespace Glest {
 				checkBoxAdvanced.getValue
 				());
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -4864,8 +4780,7 @@ namespace Glest {
 
 		GameSettings MenuStateCustomGame::loadGameSettingsFromFile(std::string
 			fileName) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -4897,8 +4812,7 @@ namespace Glest {
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] ERROR = [%s]\n",
 						extractFileFromDirectoryPath
@@ -4911,8 +4825,7 @@ namespace Glest {
 				gameSettings = originalGameSettings;
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -5008,8 +4921,7 @@ namespace Glest {
 				listBoxTechTree.setSelectedItem(techtreeFile);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -5085,8 +4997,7 @@ namespace Glest {
 
 			//listBoxNetworkFramePeriod.setSelectedItem(intToStr(gameSettings.getNetworkFramePeriod()/10*10));
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -5096,8 +5007,7 @@ namespace Glest {
 			checkBoxNetworkPauseGameForLaggedClients.
 				setValue(gameSettings.getNetworkPauseGameForLaggedClients());
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d\n",
 					extractFileFromDirectoryPath
@@ -5111,8 +5021,7 @@ namespace Glest {
 					: ""));
 			//reloadFactions(true);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] Line: %d] gameSettings.getFactionCount() = %d\n",
 					extractFileFromDirectoryPath
@@ -5149,8 +5058,7 @@ namespace Glest {
 
 				//printf("\n\n\n*** setupUIFromGameSettings A, i = %d, startLoc = %d, factioncontrol = %d, factionName [%s]\n",i,gameSettings.getStartLocationIndex(i),gameSettings.getFactionControl(i),factionName.c_str());
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] factionName = [%s]\n",
 						extractFileFromDirectoryPath
@@ -5165,8 +5073,7 @@ namespace Glest {
 						RANDOMFACTION_SLOTNAME));
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] i = %d, gameSettings.getNetworkPlayerName(i) [%s]\n",
 						extractFileFromDirectoryPath
@@ -5275,8 +5182,7 @@ namespace Glest {
 					extractFileFromDirectoryPath
 					(__FILE__).c_str(), __FUNCTION__, __LINE__,
 					ex.what());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				showGeneralError = true;
@@ -5322,8 +5228,7 @@ namespace Glest {
 
 					// Not painting properly so this is on hold
 					if (loadMapPreview == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -5635,8 +5540,7 @@ namespace Glest {
 		}
 
 		void MenuStateCustomGame::loadFactionTexture(string filepath) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -5647,8 +5551,7 @@ namespace Glest {
 				if (filepath == "") {
 					factionTexture = NULL;
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] filepath = [%s]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -5657,8 +5560,7 @@ namespace Glest {
 
 					factionTexture = Renderer::findTexture(filepath);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -5668,8 +5570,7 @@ namespace Glest {
 		}
 
 		void MenuStateCustomGame::cleanupMapPreviewTexture() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -5679,8 +5580,7 @@ namespace Glest {
 			//printf("CLEANUP map preview texture\n");
 
 			if (mapPreviewTexture != NULL) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -5689,8 +5589,7 @@ namespace Glest {
 
 				mapPreviewTexture->end();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -5699,8 +5598,7 @@ namespace Glest {
 				delete mapPreviewTexture;
 				mapPreviewTexture = NULL;
 			}
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath
@@ -5806,8 +5704,7 @@ namespace Glest {
 
 							listBoxControls[i].
 								setSelectedItemIndex(scenarioInfo.factionControls[i]);
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d]\n",
 									extractFileFromDirectoryPath
@@ -5836,8 +5733,7 @@ namespace Glest {
 								}
 							}
 
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line %d] humanIndex1 = %d, humanIndex2 = %d\n",
 									extractFileFromDirectoryPath
@@ -5847,8 +5743,7 @@ namespace Glest {
 							//no human
 							if (humanIndex1 == -1 && humanIndex2 == -1) {
 								setSlotHuman(i);
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line %d] i = %d, labelPlayerNames[i].getText() [%s]\n",
 										extractFileFromDirectoryPath
@@ -5869,8 +5764,7 @@ namespace Glest {
 								string origPlayName =
 									labelPlayerNames[closeSlotIndex].getText();
 
-								if (SystemFlags::getSystemSettingType
-								(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line %d] closeSlotIndex = %d, origPlayName [%s]\n",
 										extractFileFromDirectoryPath
@@ -6000,8 +5894,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				mainMessageBoxState = 1;
@@ -6060,8 +5953,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -6161,8 +6053,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -6213,8 +6104,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -6295,8 +6185,7 @@ namespace Glest {
 					}
 					//printf("FACTIONS i = %d results [%s]\n",i,results[i].c_str());
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"Tech [%s] has faction [%s]\n",
 							techTreeFiles
@@ -6353,8 +6242,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -6397,8 +6285,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
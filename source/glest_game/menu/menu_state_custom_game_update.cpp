@@ -37,8 +37,7 @@ namespace Glest {
 
 		void MenuStateCustomGame::update() {
 			Chrono chrono;
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
 			// Test openal buffer underrun issue
@@ -60,16 +59,14 @@ namespace Glest {
 
 			try {
 				if (serverInitError == true) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
 							c_str(), __FUNCTION__, __LINE__);
 
 					if (showGeneralError) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line %d]\n",
 								extractFileFromDirectoryPath
@@ -82,8 +79,7 @@ namespace Glest {
 						showMessageBox(generalErrorToShow, "Error", false);
 					}
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -152,22 +148,19 @@ namespace Glest {
 
 				bool masterServerErr = showMasterserverError;
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
 				if (masterServerErr) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -199,8 +192,7 @@ namespace Glest {
 					serverInterface->
 						setPublishEnabled(checkBoxPublishServer.getValue() == true);
 				} else if (showGeneralError) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -211,16 +203,14 @@ namespace Glest {
 					showMessageBox(generalErrorToShow, "Error", false);
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -268,16 +258,14 @@ namespace Glest {
 					mapInfo.players, GameConstants::maxPlayers,
 					true);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -474,8 +462,7 @@ namespace Glest {
 												lastTechtreeDataSynchError =
 													"techtree CRC mismatch" + report;
 
-												if (SystemFlags::getSystemSettingType
-												(SystemFlags::debugSystem).enabled)
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 													SystemFlags::OutputDebug(SystemFlags::debugSystem,
 														"In [%s::%s Line: %d] report: %s\n",
 														extractFileFromDirectoryPath
@@ -521,16 +508,14 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -609,16 +594,14 @@ namespace Glest {
 							BROADCAST_SETTINGS_SECONDS)
 							|| (this->headlessServerMode == true)));
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -628,16 +611,14 @@ namespace Glest {
 					needToSetChangedGameSettings = false;
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -707,16 +688,14 @@ namespace Glest {
 					checkBoxPublishServer.getValue() == true &&
 					needToRepublishToMasterserver == true);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -759,16 +738,14 @@ namespace Glest {
 						lastSetChangedGameSettings = time(NULL);
 					}
 
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 							"In [%s::%s Line: %d] took msecs: %lld\n",
 							extractFileFromDirectoryPath
 							(__FILE__).c_str(), __FUNCTION__,
 							__LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugPerformance).enabled
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 						&& chrono.getMillis() > 0)
 						chrono.start();
 
@@ -788,24 +765,21 @@ namespace Glest {
 				//console
 				console.update();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -821,16 +795,14 @@ namespace Glest {
 				}
 				soundConnectionCount = currentConnectionCount;
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -849,16 +821,14 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s Line: %d] took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					chrono.start();
 
@@ -886,8 +856,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				//printf("2222222bbbb ex.wantStackTrace() = %d\n",ex.wantStackTrace());
@@ -900,8 +869,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				showGeneralError = true;
@@ -1015,8 +983,7 @@ namespace Glest {
 								extractFileFromDirectoryPath(__FILE__).c_str(),
 								__FUNCTION__, __LINE__, ex.what());
 							SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s",
 									szBuf);
 							showGeneralError = true;
@@ -1066,8 +1033,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 				//throw megaglest_runtime_error(szBuf);
 				showGeneralError = true;
@@ -61,8 +61,7 @@ namespace Glest {
 
 			if (autoFindHost != NULL && *autoFindHost == true) {
 				//if(clientInterface->isConnected() == false) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -312,8 +311,7 @@ namespace Glest {
 
 		void MenuStateJoinGame::DiscoveredServers(std::vector < string >
 			serverList) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -359,8 +357,7 @@ namespace Glest {
 
 					bestIPMatch = serverList[idx];
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] bestIPMatch = [%s]\n",
 							__FILE__, __FUNCTION__, __LINE__,
@@ -371,8 +368,7 @@ namespace Glest {
 								__LINE__);
 						break;
 					}
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d] bestIPMatch = [%s] localIPList[0] = [%s]\n",
 							__FILE__, __FUNCTION__, __LINE__,
@@ -406,8 +402,7 @@ namespace Glest {
 					autoConnectToServer = true;
 				}
 			}
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -416,8 +411,7 @@ namespace Glest {
 		}
 
 		void MenuStateJoinGame::mouseClick(int x, int y, MouseButton mouseButton) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] START\n", __FILE__,
 					__FUNCTION__);
@@ -502,8 +496,7 @@ namespace Glest {
 					}
 				}
 			} else if (buttonCreateGame.mouseClick(x, y)) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -522,8 +515,7 @@ namespace Glest {
 
 			else if (buttonAutoFindServers.mouseClick(x, y)
 				&& buttonAutoFindServers.getEnabled() == true) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -535,8 +527,7 @@ namespace Glest {
 				// Triggers a thread which calls back into MenuStateJoinGame::DiscoveredServers
 				// with the results
 				if (clientInterface->isConnected() == false) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -545,15 +536,13 @@ namespace Glest {
 					buttonConnect.setEnabled(false);
 					clientInterface->discoverServers(this);
 				}
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] END\n", __FILE__,
 					__FUNCTION__);
@@ -716,16 +705,14 @@ namespace Glest {
 
 					//launch
 					if (clientInterface->getLaunchGame()) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s] clientInterface->getLaunchGame() - A\n",
 								__FILE__, __FUNCTION__);
 
 						servers.save(serversSavedFile);
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugSystem).enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s] clientInterface->getLaunchGame() - B\n",
 								__FILE__, __FUNCTION__);
@@ -747,8 +734,7 @@ namespace Glest {
 			}
 
 			if (clientInterface != NULL && clientInterface->getLaunchGame())
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s] clientInterface->getLaunchGame() - D\n",
 						__FILE__, __FUNCTION__);
@@ -762,8 +748,7 @@ namespace Glest {
 		}
 
 		void MenuStateJoinGame::keyDown(SDL_KeyboardEvent key) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] key = [%c][%d]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -772,8 +757,7 @@ namespace Glest {
 			ClientInterface *clientInterface =
 				NetworkManager::getInstance().getClientInterface();
 			if (clientInterface->isConnected() == false) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -784,8 +768,7 @@ namespace Glest {
 
 				string text = labelServerIp.getText();
 				if (isKeyPressed(SDLK_BACKSPACE, key) == true && text.length() > 0) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugSystem).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -811,8 +794,7 @@ namespace Glest {
 							getString("Yes") : lang.getString("No")) + "]");
 				}
 			} else {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -902,8 +884,7 @@ namespace Glest {
 		}
 
 		bool MenuStateJoinGame::connectToServer() {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] START\n", __FILE__,
 					__FUNCTION__);
@@ -926,8 +907,7 @@ namespace Glest {
 				NetworkManager::getInstance().getClientInterface();
 			clientInterface->connect(serverIp, port);
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] server - [%s]\n", __FILE__,
 					__FUNCTION__,
@@ -963,8 +943,7 @@ namespace Glest {
 				servers.setString(clientInterface->getServerName(), saveHost);
 				servers.save(serversSavedFile);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d] Using FTP port #: %d\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -974,8 +953,7 @@ namespace Glest {
 				mainMenu->setState(new MenuStateConnectedGame(program, mainMenu));
 				return true;
 			}
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] END\n", __FILE__,
 					__FUNCTION__);
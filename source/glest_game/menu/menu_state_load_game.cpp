@@ -143,8 +143,7 @@ namespace Glest {
 		}
 
 		MenuStateLoadGame::~MenuStateLoadGame() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -153,8 +152,7 @@ namespace Glest {
 
 			cleanupTexture(&previewTexture);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] END\n",
 					extractFileFromDirectoryPath(__FILE__).
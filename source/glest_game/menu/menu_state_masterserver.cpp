@@ -67,8 +67,7 @@ namespace Glest {
 			updateFromMasterserverThread = NULL;
 			ircClient = NULL;
 			serverInfoString = "empty";
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -287,8 +286,7 @@ namespace Glest {
 				userButtonsLineHeight - 20);
 			ircOnlinePeopleStatusLabel.setText("");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -326,9 +324,7 @@ namespace Glest {
 
 			needUpdateFromServer = true;
 
-			static string mutexOwnerId =
-				string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-				string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			updateFromMasterserverThread = new SimpleTaskThread(this, 0, 100);
 			updateFromMasterserverThread->setUniqueID(mutexOwnerId);
 			updateFromMasterserverThread->start();
@@ -374,8 +370,7 @@ namespace Glest {
 
 			// Playername changed so restart the IRC Thread
 			if (ircThread != NULL && netPlayerName != ircThread->getPlayerName()) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -383,8 +378,7 @@ namespace Glest {
 				ircThread->leaveChannel();
 				ircThread->setCallbackObj(NULL);
 				ircThread->signalQuit();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -396,9 +390,7 @@ namespace Glest {
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("#2 IRCCLient Cache check\n");
 
-				static string mutexOwnerId =
-					string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-					string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				ircThread = new IRCThread(ircArgs, this);
 				ircClient = ircThread;
 				ircClient->setUniqueID(mutexOwnerId);
@@ -419,8 +411,7 @@ namespace Glest {
 			}
 			//showMessageBox("Go back and set your name in the game options!\n\nAt the moment you are just called >>newbie<< !","Player name not set!",false);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -534,8 +525,7 @@ namespace Glest {
 		}
 
 		void MenuStateMasterserver::cleanup() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -550,8 +540,7 @@ namespace Glest {
 			needUpdateFromServer = false;
 			safeMutex.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -572,14 +561,12 @@ namespace Glest {
 				&& updateFromMasterserverThread->getRunningStatus() == false) {
 				//printf("#2 Ending client SLOT: %d\n",playerIndex);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork))
 					SystemFlags::OutputDebug(SystemFlags::debugNetwork,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 				delete updateFromMasterserverThread;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork))
 					SystemFlags::OutputDebug(SystemFlags::debugNetwork,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -589,14 +576,12 @@ namespace Glest {
 				&& updateFromMasterserverThread->canShutdown(true) == true) {
 				if (updateFromMasterserverThread->getRunningStatus() == false) {
 					//printf("#3 Ending client SLOT: %d\n",playerIndex);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork))
 						SystemFlags::OutputDebug(SystemFlags::debugNetwork,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
 					delete updateFromMasterserverThread;
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork))
 						SystemFlags::OutputDebug(SystemFlags::debugNetwork,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -608,8 +593,7 @@ namespace Glest {
 			//printf("#4 Ending client SLOT: %d\n",playerIndex);
 			updateFromMasterserverThread = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -623,8 +607,7 @@ namespace Glest {
 				(__FILE__).c_str()) + "_" +
 				intToStr(__LINE__));
 			if (ircClient != NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -633,8 +616,7 @@ namespace Glest {
 				ircClient->leaveChannel();
 				ircClient->setCallbackObj(NULL);
 				//ircClient->signalQuit();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -642,8 +624,7 @@ namespace Glest {
 				ircClient = NULL;
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] END\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -651,8 +632,7 @@ namespace Glest {
 		}
 
 		MenuStateMasterserver::~MenuStateMasterserver() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -663,8 +643,7 @@ namespace Glest {
 			delete mutexIRCClient;
 			mutexIRCClient = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] END\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -687,8 +666,7 @@ namespace Glest {
 
 		void MenuStateMasterserver::mouseClick(int x, int y,
 			MouseButton mouseButton) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -706,36 +684,31 @@ namespace Glest {
 					}
 				}
 			} else if (userScrollBar.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
 						c_str(), __FUNCTION__, __LINE__);
 				soundRenderer.playFx(coreData.getClickSoundA());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
 						c_str(), __FUNCTION__, __LINE__);
 			} else if (serverScrollBar.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
 						c_str(), __FUNCTION__, __LINE__);
 				soundRenderer.playFx(coreData.getClickSoundA());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
 						c_str(), __FUNCTION__, __LINE__);
 			} else if (buttonRefresh.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -750,15 +723,13 @@ namespace Glest {
 				soundRenderer.playFx(coreData.getClickSoundB());
 				needUpdateFromServer = true;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
 						c_str(), __FUNCTION__, __LINE__);
 			} else if (buttonReturn.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -766,8 +737,7 @@ namespace Glest {
 
 				soundRenderer.playFx(coreData.getClickSoundA());
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -780,8 +750,7 @@ namespace Glest {
 				}
 				cleanup();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -789,15 +758,13 @@ namespace Glest {
 
 				mainMenu->setState(new MenuStateNewGame(program, mainMenu));
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
 						c_str(), __FUNCTION__, __LINE__);
 			} else if (buttonCreateGame.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -813,8 +780,7 @@ namespace Glest {
 				needUpdateFromServer = false;
 				safeMutex.ReleaseLock();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -826,8 +792,7 @@ namespace Glest {
 					sleep(30);
 				}
 				cleanup();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -838,8 +803,7 @@ namespace Glest {
 						MenuStateCustomGame(program, mainMenu, true,
 							pMasterServer));
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -865,8 +829,7 @@ namespace Glest {
 					for (int i = serverScrollBar.getVisibleStart();
 						i <= serverScrollBar.getVisibleEnd(); ++i) {
 						if (serverLines[i]->buttonMouseClick(x, y)) {
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -881,8 +844,7 @@ namespace Glest {
 								getExternalConnectPort();
 							bool connected =
 								connectToServer(connectServerIP, connectServerPort);
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -902,8 +864,7 @@ namespace Glest {
 									sleep(30);
 								}
 								cleanup();
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::debugSystem).enabled)
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 									SystemFlags::OutputDebug(SystemFlags::debugSystem,
 										"In [%s::%s Line: %d]\n",
 										extractFileFromDirectoryPath
@@ -1387,8 +1348,7 @@ namespace Glest {
 						extractFileFromDirectoryPath(__FILE__).
 						c_str(), __FUNCTION__, __LINE__,
 						e.what());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s] Line: %d, error [%s]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -1407,8 +1367,7 @@ namespace Glest {
 				if (serverInfo != "") {
 					if (SystemFlags::VERBOSE_MODE_ENABLED)
 						printf("--------------> serverInfo [%s]\n", serverInfo.c_str());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -1474,8 +1433,7 @@ namespace Glest {
 								masterServerInfo->getServerTitle().c_str());
 							masterServerInfo->setServerTitle(szBuf);
 
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -1488,8 +1446,7 @@ namespace Glest {
 										serverLinesLineHeight, containerName));
 							delete masterServerInfo;
 						} else {
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n",
 									extractFileFromDirectoryPath
@@ -1513,8 +1470,7 @@ namespace Glest {
 							}
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n",
 								extractFileFromDirectoryPath
@@ -1522,8 +1478,7 @@ namespace Glest {
 								__LINE__);
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath(__FILE__).
@@ -1547,8 +1502,7 @@ namespace Glest {
 
 
 		bool MenuStateMasterserver::connectToServer(string ipString, int port) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] START  ipString='%s'\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1561,8 +1515,7 @@ namespace Glest {
 
 			//int serverPort = Config::getInstance().getInt("PortServer",intToStr(GameConstants::serverPort).c_str());
 			int serverPort = port;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s] try to connect to [%s] serverPort = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1581,8 +1534,7 @@ namespace Glest {
 
 				//if(SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem,"In [%s::%s] connection failed\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__);
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s] connected to [%s]\n",
 						extractFileFromDirectoryPath(__FILE__).
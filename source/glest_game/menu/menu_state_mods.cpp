@@ -273,8 +273,7 @@ namespace Glest {
 			buttonRemoveScenario.init(scenarioInfoXPos + 45, buttonLineDownY, 125);
 			buttonRemoveScenario.setText(lang.getString("Remove"));
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -318,9 +317,7 @@ namespace Glest {
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			// Start http meta data thread
-			static string mutexOwnerId =
-				string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-				string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			modHttpServerThread = new SimpleTaskThread(this, 0, 200);
 			modHttpServerThread->setUniqueID(mutexOwnerId);
 			modHttpServerThread->start();
@@ -415,8 +412,7 @@ namespace Glest {
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -501,8 +497,7 @@ namespace Glest {
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutexThreadOwner(callingThread->
 				getMutexThreadOwnerValid(),
 				mutexOwnerId);
@@ -942,8 +937,7 @@ namespace Glest {
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -1025,8 +1019,7 @@ namespace Glest {
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -1424,16 +1417,14 @@ namespace Glest {
 		void MenuStateMods::cleanUp() {
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
 			if (modHttpServerThread != NULL) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1442,8 +1433,7 @@ namespace Glest {
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1475,8 +1465,7 @@ namespace Glest {
 					//SystemFlags::OutputDebug(SystemFlags::debugError,szBuf);
 					if (SystemFlags::VERBOSE_MODE_ENABLED)
 						printf("%s", szBuf);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 					//publishToMasterserverThread->cleanup();
@@ -1563,8 +1552,7 @@ namespace Glest {
 			Lang & lang = Lang::getInstance();
 
 			if (buttonReturn.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -1643,8 +1631,7 @@ namespace Glest {
 									string mapURL = mapCacheList[mapName].url;
 									if (ftpClientThread != NULL)
 										ftpClientThread->addMapToRequests(mapName, mapURL);
-									static string mutexOwnerId =
-										string(__FILE__) + string("_") + intToStr(__LINE__);
+									static const char *mutexOwnerId = CODE_AT_LINE;
 									MutexSafeWrapper
 										safeMutexFTPProgress((ftpClientThread !=
 											NULL ? ftpClientThread->
@@ -1696,8 +1683,7 @@ namespace Glest {
 										}
 									}
 								}
-								static string mutexOwnerId =
-									string(__FILE__) + string("_") + intToStr(__LINE__);
+								static const char *mutexOwnerId = CODE_AT_LINE;
 								MutexSafeWrapper
 									safeMutexFTPProgress((ftpClientThread !=
 										NULL ? ftpClientThread->
@@ -1732,8 +1718,7 @@ namespace Glest {
 									ftpClientThread->addTilesetToRequests(tilesetName,
 										tilesetURL);
 
-								static string mutexOwnerId =
-									string(__FILE__) + string("_") + intToStr(__LINE__);
+								static const char *mutexOwnerId = CODE_AT_LINE;
 								MutexSafeWrapper
 									safeMutexFTPProgress((ftpClientThread !=
 										NULL ? ftpClientThread->
@@ -1784,8 +1769,7 @@ namespace Glest {
 									}
 								}
 
-								static string mutexOwnerId =
-									string(__FILE__) + string("_") + intToStr(__LINE__);
+								static const char *mutexOwnerId = CODE_AT_LINE;
 								MutexSafeWrapper
 									safeMutexFTPProgress((ftpClientThread !=
 										NULL ? ftpClientThread->
@@ -1820,8 +1804,7 @@ namespace Glest {
 								if (ftpClientThread != NULL)
 									ftpClientThread->addTechtreeToRequests(techName, techURL);
 
-								static string mutexOwnerId =
-									string(__FILE__) + string("_") + intToStr(__LINE__);
+								static const char *mutexOwnerId = CODE_AT_LINE;
 								MutexSafeWrapper
 									safeMutexFTPProgress((ftpClientThread !=
 										NULL ? ftpClientThread->
@@ -1873,8 +1856,7 @@ namespace Glest {
 									}
 								}
 
-								static string mutexOwnerId =
-									string(__FILE__) + string("_") + intToStr(__LINE__);
+								static const char *mutexOwnerId = CODE_AT_LINE;
 								MutexSafeWrapper
 									safeMutexFTPProgress((ftpClientThread !=
 										NULL ? ftpClientThread->
@@ -1909,8 +1891,7 @@ namespace Glest {
 									ftpClientThread->addScenarioToRequests(scenarioName,
 										scenarioURL);
 
-								static string mutexOwnerId =
-									string(__FILE__) + string("_") + intToStr(__LINE__);
+								static const char *mutexOwnerId = CODE_AT_LINE;
 								MutexSafeWrapper
 									safeMutexFTPProgress((ftpClientThread !=
 										NULL ? ftpClientThread->
@@ -1929,50 +1910,42 @@ namespace Glest {
 					}
 				}
 			} else if (keyTechScrollBar.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 				soundRenderer.playFx(coreData.getClickSoundA());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 			} else if (keyTilesetScrollBar.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 				soundRenderer.playFx(coreData.getClickSoundA());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 			} else if (keyMapScrollBar.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 				soundRenderer.playFx(coreData.getClickSoundA());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 			} else if (keyScenarioScrollBar.mouseClick(x, y)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
 				soundRenderer.playFx(coreData.getClickSoundA());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -2038,8 +2011,7 @@ namespace Glest {
 						if (ftpClientThread != NULL)
 							ftpClientThread->addTechtreeToRequests(techName, techURL);
 
-						static string mutexOwnerId =
-							string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId = CODE_AT_LINE;
 						MutexSafeWrapper
 							safeMutexFTPProgress((ftpClientThread !=
 								NULL ? ftpClientThread->
@@ -2156,8 +2128,7 @@ namespace Glest {
 						if (ftpClientThread != NULL)
 							ftpClientThread->addTilesetToRequests(tilesetName, tilesetURL);
 
-						static string mutexOwnerId =
-							string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId = CODE_AT_LINE;
 						MutexSafeWrapper
 							safeMutexFTPProgress((ftpClientThread !=
 								NULL ? ftpClientThread->
@@ -2248,8 +2219,7 @@ namespace Glest {
 						if (ftpClientThread != NULL)
 							ftpClientThread->addMapToRequests(mapName, mapURL);
 
-						static string mutexOwnerId =
-							string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId = CODE_AT_LINE;
 						MutexSafeWrapper
 							safeMutexFTPProgress((ftpClientThread !=
 								NULL ? ftpClientThread->
@@ -2367,8 +2337,7 @@ namespace Glest {
 							ftpClientThread->addScenarioToRequests(scenarioName,
 								scenarioURL);
 
-						static string mutexOwnerId =
-							string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId = CODE_AT_LINE;
 						MutexSafeWrapper
 							safeMutexFTPProgress((ftpClientThread !=
 								NULL ? ftpClientThread->
@@ -2528,8 +2497,7 @@ namespace Glest {
 				}
 
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -2594,8 +2562,7 @@ namespace Glest {
 			mapPath += mapName;
 			MapInfo mapInfo = loadMapInfo(mapPath);
 			if (enableMapPreview == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -2636,8 +2603,7 @@ namespace Glest {
 					if (ftpClientThread != NULL)
 						ftpClientThread->addFileToRequests(tempImage, modInfo->imageUrl);
 
-					static string mutexOwnerId =
-						string(__FILE__) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					MutexSafeWrapper
 						safeMutexFTPProgress((ftpClientThread !=
 							NULL ? ftpClientThread->
@@ -2649,8 +2615,7 @@ namespace Glest {
 					safeMutexFTPProgress.ReleaseLock();
 
 				} else {
-					static string mutexOwnerId =
-						string(__FILE__) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					MutexSafeWrapper
 						safeMutexFTPProgress((ftpClientThread !=
 							NULL ? ftpClientThread->
@@ -2744,8 +2709,7 @@ namespace Glest {
 		}
 
 		void MenuStateMods::cleanupMapPreviewTexture() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -2753,8 +2717,7 @@ namespace Glest {
 
 			//printf("CLEANUP map preview texture\n");
 			if (mapPreviewTexture != NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -2762,8 +2725,7 @@ namespace Glest {
 
 				mapPreviewTexture->end();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -2771,8 +2733,7 @@ namespace Glest {
 				delete mapPreviewTexture;
 				mapPreviewTexture = NULL;
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -3049,8 +3010,7 @@ namespace Glest {
 				}
 				renderer.renderScrollBar(&keyScenarioScrollBar);
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutexFTPProgress((ftpClientThread !=
 						NULL ? ftpClientThread->
@@ -3288,8 +3248,7 @@ namespace Glest {
 			pair < FTP_Client_ResultType,
 			string > result,
 			void *userdata) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -3306,8 +3265,7 @@ namespace Glest {
 					}
 					//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("Got FTP Callback for [%s] current file [%s] fileProgress = %d [now = %f, total = %f]\n",itemName.c_str(),stats->currentFilename.c_str(), fileProgress,stats->download_now,stats->download_total);
 
-					static string mutexOwnerId =
-						string(__FILE__) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					MutexSafeWrapper
 						safeMutexFTPProgress((ftpClientThread !=
 							NULL ? ftpClientThread->
@@ -3343,8 +3301,7 @@ namespace Glest {
 					printf("Got FTP Callback for [%s] result = %d [%s]\n",
 						itemName.c_str(), result.first, result.second.c_str());
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutexFTPProgress((ftpClientThread !=
 						NULL ? ftpClientThread->
@@ -3367,8 +3324,7 @@ namespace Glest {
 					printf("Got FTP Callback for [%s] result = %d [%s]\n",
 						itemName.c_str(), result.first, result.second.c_str());
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutexFTPProgress((ftpClientThread !=
 						NULL ? ftpClientThread->
@@ -3404,8 +3360,7 @@ namespace Glest {
 					printf("Got FTP Callback for [%s] result = %d [%s]\n",
 						itemName.c_str(), result.first, result.second.c_str());
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutexFTPProgress((ftpClientThread !=
 						NULL ? ftpClientThread->
@@ -3444,8 +3399,7 @@ namespace Glest {
 					printf("Got FTP Callback for [%s] result = %d [%s]\n",
 						itemName.c_str(), result.first, result.second.c_str());
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutexFTPProgress((ftpClientThread !=
 						NULL ? ftpClientThread->
@@ -3509,8 +3463,7 @@ namespace Glest {
 					printf("Got FTP Callback for [%s] result = %d [%s]\n",
 						itemName.c_str(), result.first, result.second.c_str());
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutexFTPProgress((ftpClientThread !=
 						NULL ? ftpClientThread->
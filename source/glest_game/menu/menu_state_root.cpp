@@ -147,8 +147,7 @@ namespace Glest {
 			if (updatesHttpServerThread != NULL) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -159,8 +158,7 @@ namespace Glest {
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED)
 					printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -189,8 +187,7 @@ namespace Glest {
 					//SystemFlags::OutputDebug(SystemFlags::debugError,szBuf);
 					if (SystemFlags::VERBOSE_MODE_ENABLED)
 						printf("%s", szBuf);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 					//publishToMasterserverThread->cleanup();
@@ -255,16 +252,14 @@ namespace Glest {
 					int button = 0;
 					if (mainMessageBox.mouseClick(x, y, button)) {
 						if (button == 0) {
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n", __FILE__,
 									__FUNCTION__, __LINE__);
 							soundRenderer.playFx(coreData.getClickSoundA());
 							program->exit();
 						} else {
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugSystem).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 								SystemFlags::OutputDebug(SystemFlags::debugSystem,
 									"In [%s::%s Line: %d]\n", __FILE__,
 									__FUNCTION__, __LINE__);
@@ -277,8 +272,7 @@ namespace Glest {
 				else if (errorMessageBox.getEnabled()) {
 					int button = 0;
 					if (mainMessageBox.mouseClick(x, y, button)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"In [%s::%s Line: %d]\n", __FILE__,
 								__FUNCTION__, __LINE__);
@@ -305,8 +299,7 @@ namespace Glest {
 								ftpClientThread->addTempFileToRequests(ftpFileName,
 									ftpFileURL);
 
-							static string mutexOwnerId =
-								string(__FILE__) + string("_") + intToStr(__LINE__);
+							static const char *mutexOwnerId = CODE_AT_LINE;
 							MutexSafeWrapper
 								safeMutexFTPProgress((ftpClientThread !=
 									NULL ? ftpClientThread->
@@ -460,8 +453,7 @@ namespace Glest {
 			pair < FTP_Client_ResultType,
 			string > result,
 			void *userdata) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -478,8 +470,7 @@ namespace Glest {
 					}
 					//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("Got FTP Callback for [%s] current file [%s] fileProgress = %d [now = %f, total = %f]\n",itemName.c_str(),stats->currentFilename.c_str(), fileProgress,stats->download_now,stats->download_total);
 
-					static string mutexOwnerId =
-						string(__FILE__) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					MutexSafeWrapper
 						safeMutexFTPProgress((ftpClientThread !=
 							NULL ? ftpClientThread->
@@ -527,8 +518,7 @@ namespace Glest {
 					printf("Got FTP Callback for [%s] result = %d [%s]\n",
 						itemName.c_str(), result.first, result.second.c_str());
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper
 					safeMutexFTPProgress((ftpClientThread !=
 						NULL ? ftpClientThread->
@@ -756,9 +746,7 @@ namespace Glest {
 				string updateCheckURL =
 					Config::getInstance().getString("UpdateCheckURL", "");
 				if (updateCheckURL != "") {
-					static string mutexOwnerId =
-						string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-						string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					updatesHttpServerThread = new SimpleTaskThread(this, 1, 200);
 					updatesHttpServerThread->setUniqueID(mutexOwnerId);
 					updatesHttpServerThread->start();
@@ -773,8 +761,7 @@ namespace Glest {
 			if (SystemFlags::VERBOSE_MODE_ENABLED)
 				printf("In [%s::%s Line %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutexThreadOwner(callingThread->
 				getMutexThreadOwnerValid(),
 				mutexOwnerId);
@@ -897,8 +884,7 @@ namespace Glest {
 
 		void MenuStateRoot::keyDown(SDL_KeyboardEvent key) {
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] key = [%c] [%d]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -924,8 +910,7 @@ namespace Glest {
 				&& isKeyPressed(SDLK_RETURN, key) == true) {
 				//SDL_keysym keystate = Window::getKeystate();
 				SDL_keysym keystate = key.keysym;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] keystate.mod [%d]\n",
 						__FILE__, __FUNCTION__, __LINE__,
@@ -19,6 +19,7 @@
 #include "network_manager.h"
 #include "config.h"
 #include "auto_test.h"
+#include "simulation_benchmark.h"
 #include "game.h"
 
 #include "leak_dumper.h"
@@ -59,8 +60,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				mainMessageBoxState = 1;
@@ -176,8 +176,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				mainMessageBoxState = 1;
@@ -311,8 +310,7 @@ namespace Glest {
 						extractFileFromDirectoryPath(__FILE__).c_str(),
 						__FUNCTION__, __LINE__, ex.what());
 					SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 					mainMessageBoxState = 1;
@@ -446,8 +444,7 @@ namespace Glest {
 							extractFileFromDirectoryPath(__FILE__).c_str(),
 							__FUNCTION__, __LINE__, ex.what());
 						SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s",
 								szBuf);
 
@@ -504,7 +501,12 @@ namespace Glest {
 
 					return;
 				}
-				program->setState(new Game(program, &gameSettings, false));
+				// a benchmark run has nobody at the controls
+				bool headlessBenchmark = SimulationBenchmark::isEnabled();
+				if (headlessBenchmark == true) {
+					SimulationBenchmark::getInstance().prepareGameSettings(&gameSettings);
+				}
+				program->setState(new Game(program, &gameSettings, headlessBenchmark));
 				return;
 			}
 		}
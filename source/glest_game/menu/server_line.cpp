@@ -102,8 +102,7 @@ namespace Glest {
 
 			string logoFile =
 				countryLogoPath + toLower(masterServerInfo.getCountry()) + ".png";
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] logoFile [%s]\n",
 					__FILE__, __FUNCTION__, __LINE__,
@@ -115,16 +114,14 @@ namespace Glest {
 				//loadingTexture = renderer.newTexture2D(rsGlobal);
 				countryTexture->setMipmap(true);
 				//loadingTexture->getPixmap()->load(filepath);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] logoFile [%s]\n",
 						__FILE__, __FUNCTION__, __LINE__,
 						logoFile.c_str());
 				countryTexture->load(logoFile);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -231,8 +228,7 @@ namespace Glest {
 			//delete masterServerInfo;
 
 			if (countryTexture != NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -240,8 +236,7 @@ namespace Glest {
 				countryTexture->end();
 				delete countryTexture;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n", __FILE__,
 						__FUNCTION__, __LINE__);
@@ -69,11 +69,11 @@ namespace Glest {
 		}
 
 		void ClientInterfaceThread::setQuitStatus(bool value) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d value = %d\n", __FILE__, __FUNCTION__, __LINE__, value);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d value = %d\n", __FILE__, __FUNCTION__, __LINE__, value);
 
 			BaseThread::setQuitStatus(value);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		bool ClientInterfaceThread::canShutdown(bool deleteSelfIfShutdownDelayed) {
@@ -90,7 +90,7 @@ namespace Glest {
 		void ClientInterfaceThread::execute() {
 			RunningStatusSafeWrapper runningStatus(this);
 			try {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] ****************** STARTING worker thread this = %p\n", __FILE__, __FUNCTION__, __LINE__, this);
 
 				// Set socket to non blocking
@@ -105,7 +105,7 @@ namespace Glest {
 				for (; this->clientInterface != NULL;) {
 
 					if (getQuitStatus() == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						break;
 					}
 
@@ -158,7 +158,7 @@ namespace Glest {
 					//printf("ClientInterfaceThread::exec Line: %d\n",__LINE__);
 
 					if (getQuitStatus() == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						break;
 					}
 
@@ -166,12 +166,12 @@ namespace Glest {
 				}
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("ClientInterfaceThread::exec Line: %d\n", __LINE__);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] ****************** ENDING worker thread this = %p\n", __FILE__, __FUNCTION__, __LINE__, this);
 			} catch (const exception &ex) {
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				if (clientInterface == NULL || clientInterface->getSocket(true) == NULL || clientInterface->getSocket(true)->isConnected() == true) {
 					throw megaglest_runtime_error(ex.what());
@@ -183,7 +183,7 @@ namespace Glest {
 				throw megaglest_runtime_error(szBuf);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		// =====================================================
@@ -191,7 +191,7 @@ namespace Glest {
 		// =====================================================
 
 		ClientInterface::ClientInterface() : GameNetworkInterface() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] constructor for %p\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] constructor for %p\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this);
 
 			networkCommandListThreadAccessor = new Mutex(CODE_AT_LINE);
 			networkCommandListThread = NULL;
@@ -286,7 +286,7 @@ namespace Glest {
 		}
 
 		ClientInterface::~ClientInterface() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] destructor for %p\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] destructor for %p\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this);
 			//printf("START === Client destructor\n");
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("%s Line: %d\n", __FUNCTION__, __LINE__);
@@ -303,7 +303,7 @@ namespace Glest {
 			if (clientSocket != NULL &&
 				clientSocket->isConnected() == true) {
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("%s Line: %d\n", __FUNCTION__, __LINE__);
 
@@ -326,11 +326,11 @@ namespace Glest {
 
 			//printf("B === Client destructor\n");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			close(false);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("%s Line: %d\n", __FUNCTION__, __LINE__);
 
@@ -351,7 +351,7 @@ namespace Glest {
 			quitThreadAccessor = NULL;
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("%s Line: %d\n", __FUNCTION__, __LINE__);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		bool ClientInterface::getQuitThread() {
@@ -392,7 +392,7 @@ namespace Glest {
 		}
 
 		void ClientInterface::connect(const Ip &ip, int port) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] START\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] START\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 			this->ip = ip;
 			this->port = port;
@@ -411,7 +411,7 @@ namespace Glest {
 			connectedTime = time(NULL);
 			//clientSocket->setBlock(true);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END - socket = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, clientSocket->getSocketId());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END - socket = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, clientSocket->getSocketId());
 		}
 
 		void ClientInterface::reset() {
@@ -494,7 +494,7 @@ namespace Glest {
 				// Possible cause of out of synch since we have more commands that need
 				// to be sent in this frame
 				if (requestedCommands.empty() == false) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING / ERROR, requestedCommands.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, requestedCommands.size());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING / ERROR, requestedCommands.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, requestedCommands.size());
 
 					string sMsg = "may go out of synch: client requestedCommands.size() = " + intToStr(requestedCommands.size());
 					sendTextMessage(sMsg, -1, true, "");
@@ -532,12 +532,12 @@ namespace Glest {
 
 		void ClientInterface::updateLobby() {
 			Chrono chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 			NetworkMessageType networkMessageType = getNextMessageType();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 			switch (networkMessageType) {
 				case nmtInvalid:
@@ -547,8 +547,8 @@ namespace Glest {
 				{
 					NetworkMessageIntro networkMessageIntro;
 					if (receiveMessage(&networkMessageIntro)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						gotIntro = true;
 						sessionKey = networkMessageIntro.getSessionId();
@@ -570,15 +570,15 @@ namespace Glest {
 
 						//printf("Client got intro playerIndex = %d\n",playerIndex);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got NetworkMessageIntro, networkMessageIntro.getGameState() = %d, versionString [%s], sessionKey = %d, playerIndex = %d, serverFTPPort = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageIntro.getGameState(), versionString.c_str(), sessionKey, playerIndex, serverFTPPort);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got NetworkMessageIntro, networkMessageIntro.getGameState() = %d, versionString [%s], sessionKey = %d, playerIndex = %d, serverFTPPort = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageIntro.getGameState(), versionString.c_str(), sessionKey, playerIndex, serverFTPPort);
 
 						//check consistency
 						bool compatible = checkVersionComptability(networkMessageIntro.getVersionString(), getNetworkVersionGITString());
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got NetworkMessageIntro, networkMessageIntro.getGameState() = %d, versionString [%s], sessionKey = %d, playerIndex = %d, serverFTPPort = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageIntro.getGameState(), versionString.c_str(), sessionKey, playerIndex, serverFTPPort);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got NetworkMessageIntro, networkMessageIntro.getGameState() = %d, versionString [%s], sessionKey = %d, playerIndex = %d, serverFTPPort = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageIntro.getGameState(), versionString.c_str(), sessionKey, playerIndex, serverFTPPort);
 
 						if (compatible == false) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 							bool versionMatched = false;
 							string platformFreeVersion = getNetworkPlatformFreeVersionString();
@@ -615,13 +615,13 @@ namespace Glest {
 							}
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 						if (networkMessageIntro.getGameState() == nmgstOk) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 							//send intro message
 							Lang &lang = Lang::getInstance();
@@ -638,24 +638,33 @@ namespace Glest {
 								getPlatformNameString());
 							sendMessage(&sendNetworkMessageIntro);
 
+							// older servers do not know the message, so optional wire
+							// features are only offered to our own version
+							setProtocolFeatures(0);
+							if (getSupportedProtocolFeatures() != 0 &&
+								networkMessageIntro.getVersionString() == getNetworkVersionGITString()) {
+								NetworkMessageProtocolFeatures networkMessageProtocolFeatures(getSupportedProtocolFeatures());
+								sendMessage(&networkMessageProtocolFeatures);
+							}
+
 							//printf("Got intro sending client details to server\n");
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 							if (clientSocket == NULL ||
 								clientSocket->isConnected() == false) {
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 								string sErr = "Disconnected from server during intro handshake.";
 								DisplayErrorMessage(sErr);
 								setQuit(true);
 								close();
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 								return;
 							} else {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 								introDone = true;
 							}
@@ -664,32 +673,32 @@ namespace Glest {
 							DisplayErrorMessage(sErr);
 							setQuit(true);
 							close();
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 							return;
 						} else {
 							string sErr = "Unknown response from server: " + intToStr(networkMessageIntro.getGameState());
 							DisplayErrorMessage(sErr);
 							setQuit(true);
 							close();
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 							return;
 						}
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 					}
 				}
 				break;
 
 				case nmtPing:
 				{
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtPing\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtPing\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 					NetworkMessagePing networkMessagePing;
 					if (receiveMessage(&networkMessagePing)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 						this->setLastPingInfo(networkMessagePing);
 					}
 				}
@@ -700,10 +709,10 @@ namespace Glest {
 					NetworkMessageSynchNetworkGameData networkMessageSynchNetworkGameData;
 
 					if (receiveMessage(&networkMessageSynchNetworkGameData)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got NetworkMessageSynchNetworkGameData, getTechCRCFileCount() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageSynchNetworkGameData.getTechCRCFileCount());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got NetworkMessageSynchNetworkGameData, getTechCRCFileCount() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageSynchNetworkGameData.getTechCRCFileCount());
 
 						this->setLastPingInfoToNow();
 
@@ -729,7 +738,7 @@ namespace Glest {
 									scenarioDir = scenarioDir.erase(scenarioDir.size() - gameSettings.getScenario().size(), gameSettings.getScenario().size() + 1);
 								}
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, gameSettings.getScenarioDir().c_str(), gameSettings.getScenario().c_str(), scenarioDir.c_str());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, gameSettings.getScenarioDir().c_str(), gameSettings.getScenario().c_str(), scenarioDir.c_str());
 							}
 
 							// check the checksum's
@@ -737,7 +746,7 @@ namespace Glest {
 
 							this->setNetworkGameDataSynchCheckOkTile((tilesetCRC == networkMessageSynchNetworkGameData.getTilesetCRC()));
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] tilesetCRC info, local = %d, remote = %d, networkMessageSynchNetworkGameData.getTileset() = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, tilesetCRC, networkMessageSynchNetworkGameData.getTilesetCRC(), networkMessageSynchNetworkGameData.getTileset().c_str());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] tilesetCRC info, local = %d, remote = %d, networkMessageSynchNetworkGameData.getTileset() = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, tilesetCRC, networkMessageSynchNetworkGameData.getTilesetCRC(), networkMessageSynchNetworkGameData.getTileset().c_str());
 
 							//tech, load before map because of resources
 							techCRC = getFolderTreeContentsCheckSumRecursively(config.getPathListForType(ptTechs, scenarioDir), string("/") + networkMessageSynchNetworkGameData.getTech() + string("/*"), ".xml", NULL);
@@ -746,18 +755,18 @@ namespace Glest {
 
 							if (this->getNetworkGameDataSynchCheckOkTech() == false) {
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 								string pathSearchString = "/" + networkMessageSynchNetworkGameData.getTech() + "/*";
 								vctFileList = getFolderTreeContentsCheckSumListRecursively(config.getPathListForType(ptTechs, scenarioDir), pathSearchString, ".xml", NULL);
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 								string report = networkMessageSynchNetworkGameData.getTechCRCFileMismatchReport(vctFileList);
 								this->setNetworkGameDataSynchCheckTechMismatchReport(report);
 
 							}
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] techCRC info, local = %d, remote = %d, networkMessageSynchNetworkGameData.getTech() = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, techCRC, networkMessageSynchNetworkGameData.getTechCRC(), networkMessageSynchNetworkGameData.getTech().c_str());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] techCRC info, local = %d, remote = %d, networkMessageSynchNetworkGameData.getTech() = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, techCRC, networkMessageSynchNetworkGameData.getTechCRC(), networkMessageSynchNetworkGameData.getTech().c_str());
 
 							//map
 							Checksum checksum;
@@ -769,17 +778,17 @@ namespace Glest {
 							this->setNetworkGameDataSynchCheckOkMap((mapCRC == networkMessageSynchNetworkGameData.getMapCRC()));
 							this->setReceivedDataSynchCheck(true);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] mapCRC info, local = %d, remote = %d, file = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, mapCRC, networkMessageSynchNetworkGameData.getMapCRC(), file.c_str());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] mapCRC info, local = %d, remote = %d, file = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, mapCRC, networkMessageSynchNetworkGameData.getMapCRC(), file.c_str());
 						} catch (const runtime_error &ex) {
 							SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
 							string sErr = ex.what();
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error during processing, sErr = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, sErr.c_str());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error during processing, sErr = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, sErr.c_str());
 
 							DisplayErrorMessage(sErr);
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						NetworkMessageSynchNetworkGameDataStatus sendNetworkMessageSynchNetworkGameDataStatus(mapCRC, tilesetCRC, techCRC, vctFileList);
 						sendMessage(&sendNetworkMessageSynchNetworkGameDataStatus);
@@ -791,8 +800,8 @@ namespace Glest {
 				{
 					NetworkMessageSynchNetworkGameDataFileCRCCheck networkMessageSynchNetworkGameDataFileCRCCheck;
 					if (receiveMessage(&networkMessageSynchNetworkGameDataFileCRCCheck)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
 
@@ -802,7 +811,7 @@ namespace Glest {
 						uint32 fileCRC = checksum.getSum();
 
 						if (fileCRC != networkMessageSynchNetworkGameDataFileCRCCheck.getFileCRC()) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtSynchNetworkGameDataFileCRCCheck localCRC = %d, remoteCRC = %d, file [%s]\n",
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtSynchNetworkGameDataFileCRCCheck localCRC = %d, remoteCRC = %d, file [%s]\n",
 								extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, fileCRC,
 								networkMessageSynchNetworkGameDataFileCRCCheck.getFileCRC(),
 								networkMessageSynchNetworkGameDataFileCRCCheck.getFileName().c_str());
@@ -831,8 +840,8 @@ namespace Glest {
 							sendMessage(&sendNetworkMessageSynchNetworkGameDataFileCRCCheck);
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 					}
 				}
 				break;
@@ -841,12 +850,12 @@ namespace Glest {
 				{
 					NetworkMessageText networkMessageText;
 					if (receiveMessage(&networkMessageText)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtText\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtText\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 						ChatMsgInfo msg(networkMessageText.getText().c_str(), networkMessageText.getTeamIndex(), networkMessageText.getPlayerIndex(), networkMessageText.getTargetLanguage());
 						this->addChatInfo(msg);
@@ -858,11 +867,11 @@ namespace Glest {
 				{
 					NetworkMessageMarkCell networkMessageMarkCell;
 					if (receiveMessage(&networkMessageMarkCell)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 						MarkedCell msg(networkMessageMarkCell.getTarget(),
 							networkMessageMarkCell.getFactionIndex(),
@@ -876,11 +885,11 @@ namespace Glest {
 				{
 					NetworkMessageUnMarkCell networkMessageMarkCell;
 					if (receiveMessage(&networkMessageMarkCell)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 						UnMarkedCell msg(networkMessageMarkCell.getTarget(),
 							networkMessageMarkCell.getFactionIndex());
@@ -892,11 +901,11 @@ namespace Glest {
 				{
 					NetworkMessageHighlightCell networkMessageHighlightCell;
 					if (receiveMessage(&networkMessageHighlightCell)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtHighlightCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtHighlightCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 						MarkedCell msg(networkMessageHighlightCell.getTarget(),
 							networkMessageHighlightCell.getFactionIndex(),
@@ -913,17 +922,17 @@ namespace Glest {
 
 					NetworkMessageLaunch networkMessageLaunch;
 					if (receiveMessage(&networkMessageLaunch, networkMessageType)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
 
 						if (networkMessageLaunch.getMessageType() == nmtLaunch) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtLaunch\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtLaunch\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 						} else if (networkMessageLaunch.getMessageType() == nmtBroadCastSetup) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtBroadCastSetup\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtBroadCastSetup\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 						} else {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
 
 							char szBuf[1024] = "";
 							snprintf(szBuf, 1023, "In [%s::%s Line: %d] Invalid networkMessageLaunch.getMessageType() = %d", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
@@ -932,12 +941,12 @@ namespace Glest {
 
 						networkMessageLaunch.buildGameSettings(&gameSettings);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						//printf("Client got game settings playerIndex = %d lookingfor match...\n",playerIndex);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
 						//replace server player by network
 						for (int factionIndex = 0; factionIndex < gameSettings.getFactionCount(); ++factionIndex) {
 
@@ -957,7 +966,7 @@ namespace Glest {
 								gameSettings.setThisFactionIndex(factionIndex);
 
 								//printf("Client got game settings playerIndex = %d factionIndex = %d control = %d name = %s\n",playerIndex,factionIndex,gameSettings.getFactionControl(factionIndex),gameSettings.getFactionTypeName(i).c_str());
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getThisFactionIndex(factionIndex) = %d, playerIndex = %d, factionIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, gameSettings.getThisFactionIndex(), playerIndex, factionIndex);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getThisFactionIndex(factionIndex) = %d, playerIndex = %d, factionIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, gameSettings.getThisFactionIndex(), playerIndex, factionIndex);
 							}
 						}
 
@@ -967,8 +976,8 @@ namespace Glest {
 							setGameSettingsReceived(true);
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 					}
 				}
 				break;
@@ -976,13 +985,13 @@ namespace Glest {
 				{
 					PlayerIndexMessage playerIndexMessage(-1);
 					if (receiveMessage(&playerIndexMessage)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
 						playerIndex = playerIndexMessage.getPlayerIndex();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtPlayerIndexMessage, playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, playerIndex);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtPlayerIndexMessage, playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, playerIndex);
 					}
 
 					//printf("Got player index changed msg: %d\n",playerIndex);
@@ -993,8 +1002,8 @@ namespace Glest {
 				{
 					NetworkMessageReady networkMessageReady;
 					if (receiveMessage(&networkMessageReady)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
 						MutexSafeWrapper safeMutexFlags(flagAccessor, CODE_AT_LINE);
@@ -1015,8 +1024,8 @@ namespace Glest {
 					if (gotCmd == false) {
 						throw megaglest_runtime_error("error retrieving nmtCommandList returned false!");
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 					this->setLastPingInfoToNow();
 				}
@@ -1030,8 +1039,8 @@ namespace Glest {
 					if (gotCmd == false) {
 						throw megaglest_runtime_error("error retrieving nmtQuit returned false!");
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 					this->setLastPingInfoToNow();
 					setQuit(true);
@@ -1043,11 +1052,11 @@ namespace Glest {
 				{
 					NetworkMessageLoadingStatus networkMessageLoadingStatus(nmls_NONE);
 					if (receiveMessage(&networkMessageLoadingStatus)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						this->setLastPingInfoToNow();
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					}
 				}
 				break;
@@ -1065,12 +1074,12 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 			if (clientSocket != NULL && clientSocket->isConnected() == true &&
 				gotIntro == false && difftime((long int) time(NULL), connectedTime) > GameConstants::maxClientConnectHandshakeSecs) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] difftime(time(NULL),connectedTime) = %f\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, difftime((long int) time(NULL), connectedTime));
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] difftime(time(NULL),connectedTime) = %f\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, difftime((long int) time(NULL), connectedTime));
 				close();
 			}
 
@@ -1199,11 +1208,11 @@ namespace Glest {
 
 						case nmtPing:
 						{
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtPing\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtPing\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 							NetworkMessagePing networkMessagePing;
 							if (receiveMessage(&networkMessagePing)) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 								this->setLastPingInfo(networkMessagePing);
 							}
 						}
@@ -1256,7 +1265,7 @@ namespace Glest {
 						{
 							NetworkMessageMarkCell networkMessageMarkCell;
 							if (receiveMessage(&networkMessageMarkCell)) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 								MarkedCell msg(networkMessageMarkCell.getTarget(),
 									networkMessageMarkCell.getFactionIndex(),
@@ -1271,7 +1280,7 @@ namespace Glest {
 						{
 							NetworkMessageUnMarkCell networkMessageMarkCell;
 							if (receiveMessage(&networkMessageMarkCell)) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 								UnMarkedCell msg(networkMessageMarkCell.getTarget(),
 									networkMessageMarkCell.getFactionIndex());
@@ -1283,7 +1292,7 @@ namespace Glest {
 						{
 							NetworkMessageHighlightCell networkMessageHighlightCell;
 							if (receiveMessage(&networkMessageHighlightCell)) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtHighlightCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtHighlightCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 								MarkedCell msg(networkMessageHighlightCell.getTarget(),
 									networkMessageHighlightCell.getFactionIndex(),
@@ -1303,11 +1312,11 @@ namespace Glest {
 							if (receiveMessage(&networkMessageLaunch, networkMessageType)) {
 
 								if (networkMessageLaunch.getMessageType() == nmtLaunch) {
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtLaunch\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtLaunch\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 								} else if (networkMessageLaunch.getMessageType() == nmtBroadCastSetup) {
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtBroadCastSetup\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtBroadCastSetup\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 								} else {
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
 
 									char szBuf[1024] = "";
 									snprintf(szBuf, 1023, "In [%s::%s Line: %d] Invalid networkMessageLaunch.getMessageType() = %d", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
@@ -1316,7 +1325,7 @@ namespace Glest {
 
 								networkMessageLaunch.buildGameSettings(&gameSettings);
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
 								//replace server player by network
 								for (int i = 0; i < gameSettings.getFactionCount(); ++i) {
 									//replace by network
@@ -1331,7 +1340,7 @@ namespace Glest {
 										//printf("Setting my factionindex to: %d for playerIndex: %d\n",i,playerIndex);
 
 										gameSettings.setThisFactionIndex(i);
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getThisFactionIndex(i) = %d, playerIndex = %d, i = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, gameSettings.getThisFactionIndex(), playerIndex, i);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getThisFactionIndex(i) = %d, playerIndex = %d, i = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, gameSettings.getThisFactionIndex(), playerIndex, i);
 									}
 								}
 							}
@@ -1496,7 +1505,7 @@ namespace Glest {
 
 			if (getQuit() == false && getQuitThread() == false) {
 				if (networkCommandListThread == NULL) {
-					static string mutexOwnerId = string(extractFileFromDirectoryPath(__FILE__).c_str()) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					networkCommandListThread = new ClientInterfaceThread(this);
 					networkCommandListThread->setUniqueID(mutexOwnerId);
 					networkCommandListThread->start();
@@ -1513,7 +1522,7 @@ namespace Glest {
 		}
 
 		void ClientInterface::waitUntilReady(Checksum* checksum) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			MutexSafeWrapper safeMutexFlags(flagAccessor, CODE_AT_LINE);
 			bool signalServerWhenReadyToStartJoinedGame = this->readyForInGameJoin;
@@ -1533,7 +1542,7 @@ namespace Glest {
 			NetworkMessageReady networkMessageReady;
 			sendMessage(&networkMessageReady);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			NetworkMessageLoadingStatus networkMessageLoadingStatus(nmls_NONE);
 
@@ -1561,17 +1570,17 @@ namespace Glest {
 				}
 
 				if (isConnected() == false) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 					string sErr = "Error, Server has disconnected!";
 					DisplayErrorMessage(sErr);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 					setQuit(true);
 					close();
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					return;
 				}
 				NetworkMessageType networkMessageType = getNextMessageType();
@@ -1581,26 +1590,26 @@ namespace Glest {
 				if (discarded == false) {
 					if (networkMessageType == nmtReady) {
 						if (receiveMessage(&networkMessageReady)) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 							break;
 						}
 					} else if (networkMessageType == nmtLoadingStatusMessage) {
 						if (receiveMessage(&networkMessageLoadingStatus)) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 						}
 					} else if (networkMessageType == nmtQuit) {
 						NetworkMessageQuit networkMessageQuit;
 						if (receiveMessage(&networkMessageQuit)) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 							DisplayErrorMessage(lang.getString("GameCancelledByUser"));
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 							setQuit(true);
 							close();
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 							return;
 
 						}
@@ -1613,7 +1622,7 @@ namespace Glest {
 						}
 					} else if (networkMessageType == nmtInvalid) {
 						if (chrono.getMillis() > readyWaitTimeout) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 							Lang &lang = Lang::getInstance();
 							const vector<string> languageList = this->gameSettings.getUniqueNetworkPlayerLanguages();
@@ -1630,13 +1639,13 @@ namespace Glest {
 								}
 							}
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 							sleep(1);
 							setQuit(true);
 							close();
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 							return;
 						} else {
 							if (chrono.getMillis() % 100 == 0) {
@@ -1748,20 +1757,20 @@ namespace Glest {
 							}
 						}
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 						sendTextMessage("Unexpected network message: " + intToStr(networkMessageType), -1, true, "");
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 						DisplayErrorMessage(string(extractFileFromDirectoryPath(__FILE__).c_str()) + "::" + string(__FUNCTION__) + " Unexpected network message: " + intToStr(networkMessageType));
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 						sleep(1);
 						setQuit(true);
 						close();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 						return;
 					}
 
@@ -1771,13 +1780,13 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			//check checksum
 			if (getJoinGameInProgress() == false &&
 				networkMessageReady.getChecksum() != checksum->getSum()) {
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				Lang &lang = Lang::getInstance();
 				const vector<string> languageList = this->gameSettings.getUniqueNetworkPlayerLanguages();
@@ -1809,12 +1818,12 @@ namespace Glest {
 					}
 					sendTextMessage(sErr2, -1, echoLocal, languageList[langIndex]);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d %s %s %s\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, sErr.c_str(), sErr1.c_str(), sErr2.c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d %s %s %s\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, sErr.c_str(), sErr1.c_str(), sErr2.c_str());
 
 					if (echoLocal == true) {
 						if (Config::getInstance().getBool("NetworkConsistencyChecks")) {
 							// error message and disconnect only if checked
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 							string niceError = sErr + string("\n") + sErr1 + string("\n") + sErr2;
 							DisplayErrorMessage(niceError);
@@ -1824,12 +1833,12 @@ namespace Glest {
 
 				if (Config::getInstance().getBool("NetworkConsistencyChecks")) {
 					// error message and disconnect only if checked
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 					sleep(1);
 					setQuit(true);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 					close();
 				}
@@ -1874,7 +1883,7 @@ namespace Glest {
 			// This triggers LAG update packets to begin as required
 			lastNetworkCommandListSendTime = time(NULL);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 		}
 
 		void ClientInterface::sendResumeGameMessage() {
@@ -1886,7 +1895,7 @@ namespace Glest {
 			string targetLanguage) {
 
 			string humanPlayerName = getHumanPlayerName();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] humanPlayerName = [%s] playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, humanPlayerName.c_str(), playerIndex);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] humanPlayerName = [%s] playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, humanPlayerName.c_str(), playerIndex);
 
 			NetworkMessageText networkMessageText(text, teamIndex, playerIndex, targetLanguage);
 			sendMessage(&networkMessageText);
@@ -1899,14 +1908,14 @@ namespace Glest {
 
 		void ClientInterface::sendMarkCellMessage(Vec2i targetPos, int factionIndex, string note, int playerIndex) {
 			string humanPlayerName = getHumanPlayerName();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] humanPlayerName = [%s] playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, humanPlayerName.c_str(), playerIndex);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] humanPlayerName = [%s] playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, humanPlayerName.c_str(), playerIndex);
 
 			NetworkMessageMarkCell networkMessageMarkCell(targetPos, factionIndex, note, playerIndex);
 			sendMessage(&networkMessageMarkCell);
 		}
 
 		void ClientInterface::sendHighlightCellMessage(Vec2i targetPos, int factionIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, playerIndex);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, playerIndex);
 
 			NetworkMessageHighlightCell networkMessageHighlightCell(targetPos, factionIndex);
 			sendMessage(&networkMessageHighlightCell);
@@ -1914,7 +1923,7 @@ namespace Glest {
 
 		void ClientInterface::sendUnMarkCellMessage(Vec2i targetPos, int factionIndex) {
 			string humanPlayerName = getHumanPlayerName();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] humanPlayerName = [%s] playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, humanPlayerName.c_str(), playerIndex);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] humanPlayerName = [%s] playerIndex = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, humanPlayerName.c_str(), playerIndex);
 
 			NetworkMessageUnMarkCell networkMessageMarkCell(targetPos, factionIndex);
 			sendMessage(&networkMessageMarkCell);
@@ -1971,7 +1980,7 @@ namespace Glest {
 					}
 
 					if (chrono.getMillis() > messageWaitTimeout) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 						Lang &lang = Lang::getInstance();
 						const vector<string> languageList = this->gameSettings.getUniqueNetworkPlayerLanguages();
@@ -2012,16 +2021,16 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 1) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] waiting took %lld msecs, msg = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis(), msg);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 1) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] waiting took %lld msecs, msg = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis(), msg);
 
 			return msg;
 		}
 
 		void ClientInterface::quitGame(bool userManuallyQuit) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] userManuallyQuit = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, userManuallyQuit);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] userManuallyQuit = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, userManuallyQuit);
 
 			if (clientSocket != NULL && userManuallyQuit == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				Lang &lang = Lang::getInstance();
 				const vector<string> languageList = this->gameSettings.getUniqueNetworkPlayerLanguages();
@@ -2038,11 +2047,11 @@ namespace Glest {
 				close();
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		void ClientInterface::close(bool lockMutex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] START, clientSocket = %p\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, clientSocket);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] START, clientSocket = %p\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, clientSocket);
 
 			MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 			if (lockMutex == true) {
@@ -2063,7 +2072,7 @@ namespace Glest {
 			this->joinGameInProgressLaunch = false;
 			this->readyForInGameJoin = false;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		void ClientInterface::close() {
@@ -2071,30 +2080,30 @@ namespace Glest {
 		}
 
 		void ClientInterface::discoverServers(DiscoveredServersInterface *cb) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			ClientSocket::discoverServers(cb);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 		void ClientInterface::stopServerDiscovery() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			ClientSocket::stopBroadCastClientThread();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		void ClientInterface::sendSwitchSetupRequest(string selectedFactionName, int8 currentSlotIndex,
 			int8 toSlotIndex, int8 toTeam, string networkPlayerName,
 			int8 networkPlayerStatus, int8 flags,
 			string language) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] networkPlayerName [%s] flags = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkPlayerName.c_str(), flags);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] networkPlayerName [%s] flags = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkPlayerName.c_str(), flags);
 			SwitchSetupRequest message = SwitchSetupRequest(selectedFactionName,
 				currentSlotIndex, toSlotIndex, toTeam, networkPlayerName,
 				networkPlayerStatus, flags, language);
 			sendMessage(&message);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		bool ClientInterface::shouldDiscardNetworkMessage(NetworkMessageType networkMessageType) {
@@ -2125,7 +2134,7 @@ namespace Glest {
 				break;
 				case nmtText:
 				{
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtText\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtText\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					discard = true;
 					NetworkMessageText netMsg = NetworkMessageText();
 					this->receiveMessage(&netMsg);
@@ -2245,24 +2254,24 @@ namespace Glest {
 		}
 
 		void ClientInterface::setGameSettings(GameSettings *serverGameSettings) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] START\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] START\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 			gameSettings = *serverGameSettings;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 		}
 
 		void ClientInterface::broadcastGameSetup(const GameSettings *gameSettings) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			NetworkMessageLaunch networkMessageLaunch(gameSettings, nmtBroadCastSetup);
 			sendMessage(&networkMessageLaunch);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		void ClientInterface::broadcastGameStart(const GameSettings *gameSettings) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			MutexSafeWrapper safeMutexFlags(flagAccessor, CODE_AT_LINE);
 			if (this->joinGameInProgress == true) {
@@ -2275,7 +2284,7 @@ namespace Glest {
 			NetworkMessageLaunch networkMessageLaunch(gameSettings, nmtLaunch);
 			sendMessage(&networkMessageLaunch);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		void ClientInterface::setGameSettingsReceived(bool value) {
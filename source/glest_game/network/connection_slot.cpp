@@ -26,6 +26,7 @@
 #include "server_interface.h"
 #include "network_message.h"
 #include "platform_util.h"
+#include "profiler.h"
 #include <stdexcept>
 
 #include "leak_dumper.h"
@@ -36,6 +37,11 @@ using namespace Shared::Util;
 namespace Glest {
 	namespace Game {
 
+		// upper bound for a reactor wait, new in game slots get picked up after it
+		static const int reactorWaitMilliseconds = 150;
+		// how often the reactor looks for in game connections on open slots
+		static const int openSlotCheckMilliseconds = 100;
+
 		// =====================================================
 		//	class ConnectionSlotThread
 		// =====================================================
@@ -74,14 +80,14 @@ namespace Glest {
 		}
 
 		void ConnectionSlotThread::setQuitStatus(bool value) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d value = %d\n", __FILE__, __FUNCTION__, __LINE__, value);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d value = %d\n", __FILE__, __FUNCTION__, __LINE__, value);
 
 			BaseThread::setQuitStatus(value);
 			if (value == true) {
 				signalUpdate(NULL);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void ConnectionSlotThread::signalUpdate(ConnectionSlotEvent *event) {
@@ -162,8 +168,10 @@ namespace Glest {
 		void ConnectionSlotThread::slotUpdateTask(ConnectionSlotEvent *event) {
 			if (event != NULL && event->connectionSlot != NULL) {
 				if (event->eventType == eSendSocketData) {
+					TraceScope traceScope("ConnectionSlot::sendMessage");
 					event->connectionSlot->sendMessage(event->networkMessage);
 				} else if (event->eventType == eReceiveSocketData) {
+					TraceScope traceScope("ConnectionSlot::updateSlot");
 					event->connectionSlot->updateSlot(event);
 				}
 			}
@@ -193,8 +201,11 @@ namespace Glest {
 		void ConnectionSlotThread::execute() {
 			RunningStatusSafeWrapper runningStatus(this);
 			try {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				//printf("Starting client SLOT thread: %d\n",slotIndex);
+				if (TraceProfiler::isEnabled() == true) {
+					TraceProfiler::setThreadName("ConnectionSlotThread slot " + intToStr(slotIndex));
+				}
 
 				for (; this->slotInterface != NULL;) {
 					if (getQuitStatus() == true) {
@@ -210,7 +221,7 @@ namespace Glest {
 						sleep(100);
 
 						if (getQuitStatus() == true) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							break;
 						}
 
@@ -221,7 +232,7 @@ namespace Glest {
 						eventCopy.connectionSlot = this->slotInterface->getSlot(slotIndex, true);
 
 						if (getQuitStatus() == true) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							break;
 						}
 
@@ -233,12 +244,10 @@ namespace Glest {
 							//printf("#A Checking action for slot: %d\n",slotIndex);
 
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								break;
 							}
 
-							ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
-
 							// If the slot or socket are NULL the connection was lost
 							// so exit the thread
 							MutexSafeWrapper safeMutex(this->slotInterface->getSlotMutex(slotIndex), CODE_AT_LINE);
@@ -254,12 +263,20 @@ namespace Glest {
 							PLATFORM_SOCKET socketId = socket->getSocketId();
 							safeMutex.ReleaseLock();
 
+							if (this->slotInterface->isSocketReactorActive() == true) {
+								// the reactor thread owns this slot for the rest of the game
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] slot: %d handed to the socket reactor\n", __FILE__, __FUNCTION__, __LINE__, slotIndex);
+								break;
+							}
+
+							ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
+
 							// Avoid mutex locking
 							//bool socketHasReadData = Socket::hasDataToRead(socket->getSocketId());
 							bool socketHasReadData = Socket::hasDataToReadWithWait(socketId, 150000);
 
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								break;
 							}
 
@@ -270,7 +287,7 @@ namespace Glest {
 							eventCopy.socketTriggered = socketHasReadData;
 
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								break;
 							}
 
@@ -296,7 +313,7 @@ namespace Glest {
 							static string masterSlaveOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
 							MasterSlaveThreadControllerSafeWrapper safeMasterController(masterController, 20000, masterSlaveOwnerId);
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								break;
 							}
 
@@ -304,7 +321,7 @@ namespace Glest {
 							int eventCount = (int) eventList.size();
 
 							//printf("Slot thread slotIndex: %d eventCount: %d\n",slotIndex,eventCount);
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Slot thread slotIndex: %d eventCount: %d\n", __FILE__, __FUNCTION__, __LINE__, slotIndex, eventCount);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Slot thread slotIndex: %d eventCount: %d\n", __FILE__, __FUNCTION__, __LINE__, slotIndex, eventCount);
 
 							if (eventCount > 0) {
 								ConnectionSlotEvent eventCopy;
@@ -318,14 +335,14 @@ namespace Glest {
 								safeMutex.ReleaseLock();
 
 								if (getQuitStatus() == true) {
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 									break;
 								}
 
 								if (eventCopy.eventId > 0) {
 									ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Slot thread slotIndex: %d eventCount: %d eventCopy.eventId: %d\n", __FILE__, __FUNCTION__, __LINE__, slotIndex, eventCount, (int) eventCopy.eventId);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Slot thread slotIndex: %d eventCount: %d eventCopy.eventId: %d\n", __FILE__, __FUNCTION__, __LINE__, slotIndex, eventCount, (int) eventCopy.eventId);
 									//printf("#1 Slot thread slotIndex: %d eventCount: %d eventCopy.eventId: %d\n",slotIndex,eventCount,(int)eventCopy.eventId);
 
 									this->slotUpdateTask(&eventCopy);
@@ -338,22 +355,272 @@ namespace Glest {
 					}
 
 					if (getQuitStatus() == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						break;
 					}
 				}
 
 				//printf("Ending client SLOT thread: %d\n",slotIndex);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			} catch (const exception &ex) {
+
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+
+				throw megaglest_runtime_error(ex.what());
+			}
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
+		}
+
+		// =====================================================
+		//	class ConnectionSlotReactorThread
+		// =====================================================
+
+		ConnectionSlotReactorThread::ConnectionSlotReactorThread(ConnectionSlotCallbackInterface *slotInterface) : BaseThread() {
+			this->slotInterface = slotInterface;
+			this->reactor = new SocketReactor();
+			this->openSlotCheckTimer.start();
+			uniqueID = "ConnectionSlotReactorThread";
+
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				slotSocketIds[index] = 0;
+				slotSockets[index] = NULL;
+			}
+		}
+
+		ConnectionSlotReactorThread::~ConnectionSlotReactorThread() {
+			delete reactor;
+			reactor = NULL;
+		}
+
+		void ConnectionSlotReactorThread::setQuitStatus(bool value) {
+			BaseThread::setQuitStatus(value);
+			if (value == true) {
+				wakeup();
+			}
+		}
+
+		void ConnectionSlotReactorThread::wakeup() {
+			if (reactor != NULL) {
+				reactor->wakeup();
+			}
+		}
+
+		bool ConnectionSlotReactorThread::canShutdown(bool deleteSelfIfShutdownDelayed) {
+			bool ret = (getExecutingTask() == false);
+			if (ret == false && deleteSelfIfShutdownDelayed == true) {
+				setDeleteSelfOnExecutionDone(deleteSelfIfShutdownDelayed);
+				deleteSelfIfRequired();
+				signalQuit();
+			}
+
+			return ret;
+		}
+
+		void ConnectionSlotReactorThread::syncSlotSockets() {
+			PLATFORM_SOCKET currentSocketIds[GameConstants::maxPlayers];
+			Socket *currentSockets[GameConstants::maxPlayers];
+			bool changedSockets[GameConstants::maxPlayers];
+
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				currentSocketIds[index] = 0;
+				currentSockets[index] = NULL;
+
+				MutexSafeWrapper safeMutex(this->slotInterface->getSlotMutex(index), CODE_AT_LINE_X(index));
+				ConnectionSlot *slot = this->slotInterface->getSlot(index, false);
+				// slots still in the lobby are serviced by their own thread
+				if (slot != NULL && slot->getGameStarted() == true && slot->isConnected() == true) {
+					Socket *socket = slot->getSocket(true);
+					if (socket != NULL) {
+						currentSocketIds[index] = socket->getSocketId();
+						currentSockets[index] = socket;
+					}
+				}
+				// a new connection can get both the address and the descriptor
+				// of the one it replaced, but it starts out unbuffered
+				changedSockets[index] = (currentSocketIds[index] != slotSocketIds[index] ||
+					currentSockets[index] != slotSockets[index] ||
+					(currentSockets[index] != NULL && currentSockets[index]->getBuffered() == false));
+			}
+
+			// drop stale registrations first, a closed descriptor may already
+			// be back in use by another slot's new connection
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				if (changedSockets[index] == true) {
+					if (Socket::isSocketValid(&slotSocketIds[index]) == true) {
+						reactor->removeSocket(slotSocketIds[index]);
+					}
+
+					releaseSlotSocket(index);
+				}
+			}
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				if (changedSockets[index] == true) {
+					if (Socket::isSocketValid(&currentSocketIds[index]) == true) {
+						// reads and writes on this thread must never block, a slow
+						// client would stall every other slot
+						MutexSafeWrapper safeMutex(this->slotInterface->getSlotMutex(index), CODE_AT_LINE_X(index));
+						ConnectionSlot *slot = this->slotInterface->getSlot(index, false);
+						if (slot != NULL && slot->getSocket(true) == currentSockets[index]) {
+							currentSockets[index]->setBuffered(true);
+						}
+						safeMutex.ReleaseLock();
+
+						reactor->addSocket(currentSocketIds[index], index);
+					}
+					slotSocketIds[index] = currentSocketIds[index];
+					slotSockets[index] = currentSockets[index];
+
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] slot: %d socket: " PLATFORM_SOCKET_FORMAT_TYPE "\n", __FILE__, __FUNCTION__, __LINE__, index, currentSocketIds[index]);
+				}
+			}
+		}
+
+		void ConnectionSlotReactorThread::releaseSlotSocket(int index) {
+			// only a socket the slot still holds is alive to go back to
+			// blocking, a replaced one may already be deleted
+			MutexSafeWrapper safeMutex(this->slotInterface->getSlotMutex(index), CODE_AT_LINE_X(index));
+			ConnectionSlot *slot = this->slotInterface->getSlot(index, false);
+			if (slotSockets[index] != NULL && slot != NULL &&
+				slot->getSocket(true) == slotSockets[index]) {
+				slotSockets[index]->setBuffered(false);
+			}
+		}
+
+		void ConnectionSlotReactorThread::socketReadReady(PLATFORM_SOCKET socket, int userId) {
+			if (getQuitStatus() == true) {
+				return;
+			}
+
+			// take everything the kernel has, the slot update only reads
+			// whole messages from it
+			MutexSafeWrapper safeMutex(this->slotInterface->getSlotMutex(userId), CODE_AT_LINE_X(userId));
+			ConnectionSlot *slotToFill = this->slotInterface->getSlot(userId, false);
+			Socket *slotSocket = (slotToFill != NULL ? slotToFill->getSocket(true) : NULL);
+			if (slotSocket == NULL || slotSocket->getSocketId() != socket ||
+				slotSocket->getBuffered() == false) {
+				return;
+			}
+			slotSocket->fillReceiveBuffer();
+			safeMutex.ReleaseLock(true);
+
+			ConnectionSlotEvent eventCopy;
+			eventCopy.eventType = eReceiveSocketData;
+			eventCopy.connectionSlot = this->slotInterface->getSlot(userId, true);
+			eventCopy.eventId = userId;
+			eventCopy.socketTriggered = true;
+
+			if (eventCopy.connectionSlot == NULL) {
+				return;
+			}
+			eventCopy.connectionSlot->updateSlot(&eventCopy);
+
+			// a slot update stops after text and cell marker messages, whatever
+			// complete messages are left raise no new edge so ask to be called
+			// again. A partial message waits for the rest to arrive
+			safeMutex.Lock();
+			ConnectionSlot *slot = this->slotInterface->getSlot(userId, false);
+			Socket *slotSocketAfter = (slot != NULL ? slot->getSocket(true) : NULL);
+			if (slotSocketAfter != NULL && slotSocketAfter->getSocketId() == socket) {
+				slotSocketAfter->flushSendBuffer();
+				if (slot->isConnected() == true && slot->hasDataToRead() == true &&
+					slotSocketAfter->getReceiveIncomplete() == false) {
+					reactor->setReadPending(socket, true);
+				}
+			}
+		}
+
+		void ConnectionSlotReactorThread::socketWriteReady(PLATFORM_SOCKET socket, int userId) {
+			if (getQuitStatus() == true) {
+				return;
+			}
+
+			MutexSafeWrapper safeMutex(this->slotInterface->getSlotMutex(userId), CODE_AT_LINE_X(userId));
+			ConnectionSlot *slot = this->slotInterface->getSlot(userId, false);
+			Socket *slotSocket = (slot != NULL ? slot->getSocket(true) : NULL);
+			if (slotSocket != NULL && slotSocket->getSocketId() == socket) {
+				slotSocket->flushSendBuffer();
+			}
+		}
+
+		void ConnectionSlotReactorThread::updateSendInterest() {
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				if (slotSockets[index] == NULL) {
+					continue;
+				}
+				MutexSafeWrapper safeMutex(this->slotInterface->getSlotMutex(index), CODE_AT_LINE_X(index));
+				ConnectionSlot *slot = this->slotInterface->getSlot(index, false);
+				if (slot != NULL && slot->getSocket(true) == slotSockets[index]) {
+					reactor->setWantWrite(slotSocketIds[index], slotSockets[index]->hasPendingSend());
+				}
+			}
+		}
+
+		void ConnectionSlotReactorThread::updateOpenSlots() {
+			if (this->slotInterface->getAllowInGameConnections() == false ||
+				openSlotCheckTimer.getMillis() < openSlotCheckMilliseconds) {
+				return;
+			}
+			openSlotCheckTimer.start();
+
+			// a slot whose thread retired and whose client left takes the
+			// next in game connection from here
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				if (getQuitStatus() == true) {
+					return;
+				}
+
+				MutexSafeWrapper safeMutex(this->slotInterface->getSlotMutex(index), CODE_AT_LINE_X(index));
+				ConnectionSlot *slot = this->slotInterface->getSlot(index, false);
+				if (slot == NULL || slot->isConnected() == true ||
+					(slot->getWorkerThread() != NULL && slot->getWorkerThread()->getRunningStatus() == true)) {
+					continue;
+				}
+				safeMutex.ReleaseLock();
+
+				ConnectionSlotEvent eventCopy;
+				eventCopy.eventType = eReceiveSocketData;
+				eventCopy.connectionSlot = slot;
+				eventCopy.eventId = index;
+				eventCopy.socketTriggered = false;
+				slot->updateSlot(&eventCopy);
+			}
+		}
+
+		void ConnectionSlotReactorThread::execute() {
+			RunningStatusSafeWrapper runningStatus(this);
+			try {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+
+				for (; this->slotInterface != NULL;) {
+					if (getQuitStatus() == true) {
+						break;
+					}
+
+					ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
+					syncSlotSockets();
+					updateSendInterest();
+					reactor->waitForEvents(reactorWaitMilliseconds, this);
+					updateOpenSlots();
+				}
+
+				// whoever reads the slots next expects blocking sockets
+				ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
+				for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+					releaseSlotSocket(index);
+					slotSockets[index] = NULL;
+				}
+
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			} catch (const exception &ex) {
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		// =====================================================
@@ -361,13 +628,15 @@ namespace Glest {
 		// =====================================================
 
 		ConnectionSlot::ConnectionSlot(ServerInterface* serverInterface, int playerIndex) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d\n", __FILE__, __FUNCTION__, __LINE__);
 
 			this->mutexSocket = new Mutex(CODE_AT_LINE);
 			this->socket = NULL;
 			this->mutexCloseConnection = new Mutex(CODE_AT_LINE);
 			this->mutexPendingNetworkCommandList = new Mutex(CODE_AT_LINE);
 			this->socketSynchAccessor = new Mutex(CODE_AT_LINE);
+			// the server flushes the command lists of all keyframes of a game update together
+			this->deferCommandLists = true;
 			this->connectedRemoteIPAddress = 0;
 			this->sessionKey = 0;
 			this->serverInterface = serverInterface;
@@ -406,7 +675,7 @@ namespace Glest {
 
 			this->setSocket(NULL);
 			this->slotThreadWorker = NULL;
-			static string mutexOwnerId = string(extractFileFromDirectoryPath(__FILE__).c_str()) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			this->slotThreadWorker = new ConnectionSlotThread(this->serverInterface, playerIndex);
 			this->slotThreadWorker->setUniqueID(mutexOwnerId);
 			this->slotThreadWorker->start();
@@ -415,12 +684,12 @@ namespace Glest {
 		ConnectionSlot::~ConnectionSlot() {
 			//printf("===> Destructor for ConnectionSlot = %d\n",playerIndex);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] START\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] START\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//printf("Deleting connection slot\n");
 			close();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//printf("#1 Ending client SLOT: %d slotThreadWorker: %p\n",playerIndex,slotThreadWorker);
 			if (slotThreadWorker != NULL) {
@@ -431,21 +700,21 @@ namespace Glest {
 				slotThreadWorker->getRunningStatus() == false) {
 				//printf("#2 Ending client SLOT: %d\n",playerIndex);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				delete slotThreadWorker;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			} else if (slotThreadWorker != NULL &&
 				slotThreadWorker->canShutdown(true) == true) {
 
 				if (slotThreadWorker->getRunningStatus() == false) {
 					//printf("#3 Ending client SLOT: %d\n",playerIndex);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 					delete slotThreadWorker;
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				} else {
 					slotThreadWorker->setDeleteSelfOnExecutionDone(true);
 					slotThreadWorker->setDeleteAfterExecute(true);
@@ -466,7 +735,7 @@ namespace Glest {
 			delete mutexSocket;
 			mutexSocket = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END\n", __FILE__, __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END\n", __FILE__, __FUNCTION__);
 		}
 
 		int ConnectionSlot::getAutoPauseGameCountForLag() {
@@ -524,7 +793,7 @@ namespace Glest {
 				}
 				//}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		string ConnectionSlot::getIpAddress(bool mutexLock) {
@@ -554,7 +823,7 @@ namespace Glest {
 					// Is the listener socket ready to be read?
 					if (checkForNewClients == true && this->canAcceptConnections == true) {
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] BEFORE accept new client connection, serverInterface->getOpenSlotCount() = %d\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getOpenSlotCount());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] BEFORE accept new client connection, serverInterface->getOpenSlotCount() = %d\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getOpenSlotCount());
 
 						//printf("Checking for new connections...\n");
 						bool hasData = (serverInterface->getServerSocket() != NULL &&
@@ -562,13 +831,13 @@ namespace Glest {
 						//printf("Server socket hasData: %d\n",hasData);
 
 						if (hasData == true) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to accept new client connection playerIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, playerIndex);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to accept new client connection playerIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, playerIndex);
 
 							Socket *newSocket = serverInterface->getServerSocket()->accept(false);
 
 							//printf("Server socket newSocket: %p\n",newSocket);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] called accept new client connection playerIndex = %d newSocket = %p\n", __FILE__, __FUNCTION__, __LINE__, playerIndex, newSocket);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] called accept new client connection playerIndex = %d newSocket = %p\n", __FILE__, __FUNCTION__, __LINE__, playerIndex, newSocket);
 							if (newSocket != NULL) {
 								// Set Socket as non-blocking
 								newSocket->setBlock(false);
@@ -598,9 +867,10 @@ namespace Glest {
 								this->lastReceiveCommandListTime = 0;
 								this->gotLagCountWarning = false;
 								this->versionString = "";
+								setProtocolFeatures(0);
 
 								serverInterface->updateListen();
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] playerIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, playerIndex);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] playerIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, playerIndex);
 							} else {
 								close();
 								return;
@@ -615,8 +885,8 @@ namespace Glest {
 
 								sessionKey = rand() % 1000000;
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] accepted new client connection, serverInterface->getOpenSlotCount() = %d, sessionKey = %d\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getOpenSlotCount(), sessionKey);
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] client will be assigned to the next open slot\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] accepted new client connection, serverInterface->getOpenSlotCount() = %d, sessionKey = %d\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getOpenSlotCount(), sessionKey);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] client will be assigned to the next open slot\n", __FILE__, __FUNCTION__, __LINE__);
 
 								NetworkMessageIntro networkMessageIntro(
 									sessionKey,
@@ -639,7 +909,7 @@ namespace Glest {
 						}
 					}
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 					if (socketInfo.first == true) {
 						this->clearChatInfo();
@@ -648,21 +918,24 @@ namespace Glest {
 						bool gotCellMarkerMsg = true;
 						bool waitForLaggingClient = false;
 						bool waitedForLaggingClient = false;
+						// nothing new arrives on a reactor buffered socket while we spin,
+						// the reactor calls back once the lagging client sends
+						bool bufferedSocket = socketInfo.second->getBuffered();
 
 						//printf("Update slot: %d this->hasDataToRead(): %d\n",this->playerIndex,this->hasDataToRead());
 
-						for (; waitForLaggingClient == true ||
+						for (; (waitForLaggingClient == true && bufferedSocket == false) ||
 							(this->hasDataToRead() == true &&
 							(gotTextMsg == true || gotCellMarkerMsg == true));) {
 
 							//printf("Server slot checking for waitForLaggingClient = %d this->hasDataToRead() = %d gotTextMsg = %d gotCellMarkerMsg = %d\n",waitForLaggingClient,this->hasDataToRead(),gotTextMsg,gotCellMarkerMsg);
 
 							waitForLaggingClient = false;
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] polling for networkMessageType...\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] polling for networkMessageType...\n", __FILE__, __FUNCTION__, __LINE__);
 
 							NetworkMessageType networkMessageType = getNextMessageType();
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] networkMessageType = %d\n", __FILE__, __FUNCTION__, __LINE__, networkMessageType);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] networkMessageType = %d\n", __FILE__, __FUNCTION__, __LINE__, networkMessageType);
 
 							gotTextMsg = false;
 							gotCellMarkerMsg = false;
@@ -670,21 +943,21 @@ namespace Glest {
 							switch (networkMessageType) {
 
 								case nmtInvalid:
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtInvalid\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtInvalid\n", __FILE__, __FUNCTION__, __LINE__);
 									break;
 
 								case nmtPing:
 								{
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtPing\n", __FILE__, __FUNCTION__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtPing\n", __FILE__, __FUNCTION__);
 
 									// client REQUIRES a ping before completing intro
 									// authentication
 									NetworkMessagePing networkMessagePing;
 									if (receiveMessage(&networkMessagePing)) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 										lastPingInfo = networkMessagePing;
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -694,7 +967,7 @@ namespace Glest {
 
 								case nmtText:
 								{
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtText gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtText gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
 
 									if (gotIntro == true) {
 										NetworkMessageText networkMessageText;
@@ -703,13 +976,13 @@ namespace Glest {
 											this->addChatInfo(msg);
 											gotTextMsg = true;
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -719,7 +992,7 @@ namespace Glest {
 
 								case nmtMarkCell:
 								{
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtMarkCell gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtMarkCell gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
 
 									if (gotIntro == true) {
 										NetworkMessageMarkCell networkMessageMarkCell;
@@ -732,13 +1005,13 @@ namespace Glest {
 											this->addMarkedCell(msg);
 											gotCellMarkerMsg = true;
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -748,7 +1021,7 @@ namespace Glest {
 
 								case nmtUnMarkCell:
 								{
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtUnMarkCell gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtUnMarkCell gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
 
 									if (gotIntro == true) {
 										NetworkMessageUnMarkCell networkMessageMarkCell;
@@ -759,13 +1032,13 @@ namespace Glest {
 											this->addUnMarkedCell(msg);
 											gotCellMarkerMsg = true;
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -775,7 +1048,7 @@ namespace Glest {
 
 								case nmtHighlightCell:
 								{
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtMarkCell gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtMarkCell gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
 
 									if (gotIntro == true) {
 										NetworkMessageHighlightCell networkMessageHighlightCell;
@@ -786,13 +1059,13 @@ namespace Glest {
 											this->setHighlightedCell(msg);
 											gotCellMarkerMsg = true;
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -803,7 +1076,7 @@ namespace Glest {
 								//command list
 								case nmtCommandList: {
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtCommandList gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtCommandList gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
 
 									if (gotIntro == true) {
 										NetworkMessageCommandList networkMessageCommandList;
@@ -811,7 +1084,7 @@ namespace Glest {
 											currentFrameCount = networkMessageCommandList.getFrameCount();
 											lastReceiveCommandListTime = time(NULL);
 
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] currentFrameCount = %d\n", __FILE__, __FUNCTION__, __LINE__, currentFrameCount);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] currentFrameCount = %d\n", __FILE__, __FUNCTION__, __LINE__, currentFrameCount);
 
 											MutexSafeWrapper safeMutexSlot(mutexPendingNetworkCommandList, CODE_AT_LINE);
 											for (int i = 0; i < networkMessageCommandList.getCommandCount(); ++i) {
@@ -821,13 +1094,13 @@ namespace Glest {
 
 											//printf("#2 Server slot got currentFrameCount = %d\n",currentFrameCount);
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -838,7 +1111,7 @@ namespace Glest {
 													 //process intro messages
 								case nmtIntro:
 								{
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtIntro\n", __FILE__, __FUNCTION__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtIntro\n", __FILE__, __FUNCTION__);
 
 									NetworkMessageIntro networkMessageIntro;
 									if (receiveMessage(&networkMessageIntro)) {
@@ -851,13 +1124,13 @@ namespace Glest {
 										this->platform = networkMessageIntro.getPlayerPlatform();
 
 										//printf("Got uuid from client [%s]\n",this->playerUUID.c_str());
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got name [%s] versionString [%s], msgSessionId = %d\n", __FILE__, __FUNCTION__, name.c_str(), versionString.c_str(), msgSessionId);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got name [%s] versionString [%s], msgSessionId = %d\n", __FILE__, __FUNCTION__, name.c_str(), versionString.c_str(), msgSessionId);
 
 										if (msgSessionId != sessionKey) {
 											string playerNameStr = name;
 											string sErr = "Client gave invalid sessionid for player [" + playerNameStr + "] actual [" + intToStr(msgSessionId) + "] expected [" + intToStr(sessionKey) + "]";
 											printf("%s\n", sErr.c_str());
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
 
 											close();
 											return;
@@ -865,20 +1138,20 @@ namespace Glest {
 											string playerNameStr = name;
 											string sErr = "Client gave an invalid UUID for player [" + playerNameStr + "]";
 											printf("%s\n", sErr.c_str());
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
 
 											close();
 											return;
 										} else {
 											//check consistency
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 											bool compatible = checkVersionComptability(getNetworkVersionGITString(), networkMessageIntro.getVersionString());
 
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 											if (compatible == false) {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 												bool versionMatched = false;
 												string platformFreeVersion = getNetworkPlatformFreeVersionString();
@@ -901,19 +1174,19 @@ namespace Glest {
 													sErr = "Warning, Server and client are using the same version but different platforms.\n\nServer: " + getNetworkVersionGITString() +
 														"\nClient: " + networkMessageIntro.getVersionString() + " player [" + playerNameStr + "]";
 													//printf("%s\n",sErr.c_str());
-													if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
+													if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
 												}
 
 												if (Config::getInstance().getBool("PlatformConsistencyChecks", "true") &&
 													versionMatched == false) { // error message and disconnect only if checked
-													if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
+													if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
 													close();
-													if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
+													if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
 													return;
 												}
 											}
 
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 											gotIntro = true;
 
 											int factionIndex = this->serverInterface->gameSettings.getFactionIndexForStartLocation(playerIndex);
@@ -928,7 +1201,7 @@ namespace Glest {
 											}
 
 											if (getAllowGameDataSynchCheck() == true && serverInterface->getGameSettings() != NULL) {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sending NetworkMessageSynchNetworkGameData\n", __FILE__, __FUNCTION__, __LINE__);
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sending NetworkMessageSynchNetworkGameData\n", __FILE__, __FUNCTION__, __LINE__);
 
 												NetworkMessageSynchNetworkGameData networkMessageSynchNetworkGameData(serverInterface->getGameSettings());
 												sendMessage(&networkMessageSynchNetworkGameData);
@@ -955,7 +1228,7 @@ namespace Glest {
 											}
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -972,7 +1245,7 @@ namespace Glest {
 											string playerNameStr = name;
 											string sErr = "Client has invalid admin sessionid for player [" + playerNameStr + "]";
 											printf("%s\n", sErr.c_str());
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, sErr.c_str());
 
 											close();
 											return;
@@ -981,12 +1254,12 @@ namespace Glest {
 										NetworkMessageLaunch networkMessageLaunch;
 										if (receiveMessage(&networkMessageLaunch, networkMessageType)) {
 											if (networkMessageLaunch.getMessageType() == nmtLaunch) {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtLaunch\n", __FILE__, __FUNCTION__, __LINE__);
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtLaunch\n", __FILE__, __FUNCTION__, __LINE__);
 												//printf("Got launch request from client joinGameInProgress = %d joinGameInProgress = %d!\n",joinGameInProgress,joinGameInProgress);
 											} else if (networkMessageLaunch.getMessageType() == nmtBroadCastSetup) {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtBroadCastSetup\n", __FILE__, __FUNCTION__, __LINE__);
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got nmtBroadCastSetup\n", __FILE__, __FUNCTION__, __LINE__);
 											} else {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", __FILE__, __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Lined: %d] got networkMessageLaunch.getMessageType() = %d\n", __FILE__, __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
 
 												char szBuf[1024] = "";
 												snprintf(szBuf, 1023, "In [%s::%s Line: %d] Invalid networkMessageLaunch.getMessageType() = %d", __FILE__, __FUNCTION__, __LINE__, networkMessageLaunch.getMessageType());
@@ -1012,7 +1285,7 @@ namespace Glest {
 #else
 													snprintf(szBuf, 4095, msgTemplate.c_str(), minHeadLessPlayersRequired);
 #endif
-													if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, szBuf);
+													if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, szBuf);
 
 													string sMsg = szBuf;
 													bool echoLocal = lang.isLanguageLocal(languageList[index]);
@@ -1053,13 +1326,13 @@ namespace Glest {
 												}
 											}
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -1070,10 +1343,10 @@ namespace Glest {
 								//process datasynch messages
 								case nmtSynchNetworkGameDataStatus:
 								{
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtSynchNetworkGameDataStatus, gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtSynchNetworkGameDataStatus, gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
 
 									if (gotIntro == true) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 										NetworkMessageSynchNetworkGameDataStatus networkMessageSynchNetworkGameDataStatus;
 										if (receiveMessage(&networkMessageSynchNetworkGameDataStatus)) {
@@ -1089,7 +1362,7 @@ namespace Glest {
 													scenarioDir = scenarioDir.erase(scenarioDir.size() - serverInterface->getGameSettings()->getScenario().size(), serverInterface->getGameSettings()->getScenario().size() + 1);
 												}
 
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getGameSettings()->getScenarioDir().c_str(), serverInterface->getGameSettings()->getScenario().c_str(), scenarioDir.c_str());
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getGameSettings()->getScenarioDir().c_str(), serverInterface->getGameSettings()->getScenario().c_str(), scenarioDir.c_str());
 											}
 
 											//tileset
@@ -1110,11 +1383,11 @@ namespace Glest {
 											if (networkGameDataSynchCheckOkMap == true &&
 												networkGameDataSynchCheckOkTile == true &&
 												networkGameDataSynchCheckOkTech == true) {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] client data synch ok\n", __FILE__, __FUNCTION__);
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] client data synch ok\n", __FILE__, __FUNCTION__);
 											} else {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] mapCRC = %d, remote = %d\n", __FILE__, __FUNCTION__, mapCRC, networkMessageSynchNetworkGameDataStatus.getMapCRC());
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] tilesetCRC = %d, remote = %d\n", __FILE__, __FUNCTION__, tilesetCRC, networkMessageSynchNetworkGameDataStatus.getTilesetCRC());
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] techCRC = %d, remote = %d\n", __FILE__, __FUNCTION__, techCRC, networkMessageSynchNetworkGameDataStatus.getTechCRC());
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] mapCRC = %d, remote = %d\n", __FILE__, __FUNCTION__, mapCRC, networkMessageSynchNetworkGameDataStatus.getMapCRC());
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] tilesetCRC = %d, remote = %d\n", __FILE__, __FUNCTION__, tilesetCRC, networkMessageSynchNetworkGameDataStatus.getTilesetCRC());
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] techCRC = %d, remote = %d\n", __FILE__, __FUNCTION__, techCRC, networkMessageSynchNetworkGameDataStatus.getTechCRC());
 
 												if (allowDownloadDataSynch == true) {
 													// Now get all filenames with their CRC values and send to the client
@@ -1129,7 +1402,7 @@ namespace Glest {
 															scenarioDir = scenarioDir.erase(scenarioDir.size() - serverInterface->getGameSettings()->getScenario().size(), serverInterface->getGameSettings()->getScenario().size() + 1);
 														}
 
-														if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getGameSettings()->getScenarioDir().c_str(), serverInterface->getGameSettings()->getScenario().c_str(), scenarioDir.c_str());
+														if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getGameSettings()->getScenarioDir().c_str(), serverInterface->getGameSettings()->getScenario().c_str(), scenarioDir.c_str());
 													}
 
 													if (networkGameDataSynchCheckOkTile == false) {
@@ -1167,15 +1440,15 @@ namespace Glest {
 
 											this->setReceivedDataSynchCheck(true);
 											receivedNetworkGameStatus = true;
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -1186,7 +1459,7 @@ namespace Glest {
 								case nmtSynchNetworkGameDataFileCRCCheck:
 								{
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtSynchNetworkGameDataFileCRCCheck\n", __FILE__, __FUNCTION__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtSynchNetworkGameDataFileCRCCheck\n", __FILE__, __FUNCTION__);
 
 									if (gotIntro == true) {
 										NetworkMessageSynchNetworkGameDataFileCRCCheck networkMessageSynchNetworkGameDataFileCRCCheck;
@@ -1195,13 +1468,13 @@ namespace Glest {
 											NetworkMessageSynchNetworkGameDataFileCRCCheck networkMessageSynchNetworkGameDataFileCRCCheck((int) vctFileList.size(), fileIndex, vctFileList[fileIndex - 1].second, vctFileList[fileIndex - 1].first);
 											sendMessage(&networkMessageSynchNetworkGameDataFileCRCCheck);
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -1212,7 +1485,7 @@ namespace Glest {
 								case nmtSynchNetworkGameDataFileGet:
 								{
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtSynchNetworkGameDataFileGet\n", __FILE__, __FUNCTION__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] got nmtSynchNetworkGameDataFileGet\n", __FILE__, __FUNCTION__);
 
 									if (gotIntro == true) {
 										NetworkMessageSynchNetworkGameDataFileGet networkMessageSynchNetworkGameDataFileGet;
@@ -1226,13 +1499,13 @@ namespace Glest {
 											FileTransferSocketThread *fileXferThread = new FileTransferSocketThread(fileInfo);
 											fileXferThread->start();
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -1243,7 +1516,7 @@ namespace Glest {
 								case nmtSwitchSetupRequest:
 								{
 									//printf("Got nmtSwitchSetupRequest A gotIntro = %d\n",gotIntro);
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtSwitchSetupRequest gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtSwitchSetupRequest gotIntro = %d\n", __FILE__, __FUNCTION__, __LINE__, gotIntro);
 
 									if (gotIntro == true) {
 										//printf("Got nmtSwitchSetupRequest B\n");
@@ -1271,15 +1544,15 @@ namespace Glest {
 											//printf("In [%s::%s Line %d] networkPlayerName [%s]\n",__FILE__,__FUNCTION__,__LINE__,serverInterface->getSwitchSetupRequests()[factionIdx]->getNetworkPlayerName().c_str());
 
 											if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line %d] networkPlayerName [%s]\n", __FILE__, __FUNCTION__, __LINE__, serverInterface->getSwitchSetupRequests()[slotIdx]->getNetworkPlayerName().c_str());
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] factionIdx = %d, switchSetupRequest.getNetworkPlayerName() [%s] switchSetupRequest.getNetworkPlayerStatus() = %d, switchSetupRequest.getSwitchFlags() = %d\n", __FILE__, __FUNCTION__, __LINE__, slotIdx, switchSetupRequest.getNetworkPlayerName().c_str(), switchSetupRequest.getNetworkPlayerStatus(), switchSetupRequest.getSwitchFlags());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] factionIdx = %d, switchSetupRequest.getNetworkPlayerName() [%s] switchSetupRequest.getNetworkPlayerStatus() = %d, switchSetupRequest.getSwitchFlags() = %d\n", __FILE__, __FUNCTION__, __LINE__, slotIdx, switchSetupRequest.getNetworkPlayerName().c_str(), switchSetupRequest.getNetworkPlayerStatus(), switchSetupRequest.getSwitchFlags());
 										} else {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 											this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 											close();
 											return;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -1319,7 +1592,7 @@ namespace Glest {
 
 								default:
 								{
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] networkMessageType = %d\n", __FILE__, __FUNCTION__, __LINE__, networkMessageType);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] networkMessageType = %d\n", __FILE__, __FUNCTION__, __LINE__, networkMessageType);
 
 									if (gotIntro == true) {
 										//throw megaglest_runtime_error("Unexpected message in connection slot: " + intToStr(networkMessageType));
@@ -1329,9 +1602,9 @@ namespace Glest {
 										threadErrorList.push_back(sErr);
 										return;
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got invalid message type before intro, disconnecting socket.\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got invalid message type before intro, disconnecting socket.\n", __FILE__, __FUNCTION__, __LINE__);
 
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d]\nInvalid message type before intro handshake [%d]\nDisconnecting socket for slot: %d [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, networkMessageType, this->playerIndex, this->getIpAddress().c_str());
 										this->serverInterface->notifyBadClientConnectAttempt(this->getIpAddress());
 										close();
 										return;
@@ -1391,7 +1664,7 @@ namespace Glest {
 
 						//if(chrono.getMillis() > 1) printf("In [%s::%s Line: %d] action running for msecs: %lld\n",__FILE__,__FUNCTION__,__LINE__,(long long int)chrono.getMillis());
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] calling close...\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] calling close...\n", __FILE__, __FUNCTION__, __LINE__);
 
 						//printf("Closing connection slot socketInfo.first = %d\n",socketInfo.first);
 
@@ -1400,11 +1673,20 @@ namespace Glest {
 						//if(chrono.getMillis() > 1) printf("In [%s::%s Line: %d] action running for msecs: %lld\n",__FILE__,__FUNCTION__,__LINE__,(long long int)chrono.getMillis());
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				}
+			} catch (const socket_receive_incomplete &ex) {
+				// the rest of the message is still on its way, read it again
+				// from its start once the reactor has it
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+
+				MutexSafeWrapper safeMutexSlot(mutexSocket, CODE_AT_LINE);
+				if (this->socket != NULL) {
+					this->socket->rewindReceive();
 				}
 			} catch (const exception &ex) {
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error detected [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error detected [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
 
 				threadErrorList.push_back(ex.what());
 
@@ -1441,7 +1723,7 @@ namespace Glest {
 		}
 
 		void ConnectionSlot::close() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s LINE: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s LINE: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//printf("Closing slot for playerIndex = %d\n",playerIndex);
 			//if(serverInterface->getAllowInGameConnections() == true) {
@@ -1459,12 +1741,12 @@ namespace Glest {
 			this->connectedTime = 0;
 
 			if (this->slotThreadWorker != NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				this->slotThreadWorker->setAllEventsCompleted();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//printf("ConnectionSlot::close() #2 this->getSocket() = %p\n",this->getSocket());
 
@@ -1476,15 +1758,15 @@ namespace Glest {
 			this->deleteSocket();
 			safeMutex.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s LINE: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s LINE: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			//printf("Closing slot for playerIndex = %d updateServerListener = %d ready = %d\n",playerIndex,updateServerListener,ready);
 
 			if (updateServerListener == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s LINE: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s LINE: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				serverInterface->updateListen();
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END\n", __FILE__, __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END\n", __FILE__, __FUNCTION__);
 		}
 
 		Mutex * ConnectionSlot::getServerSynchAccessor() {
@@ -1522,6 +1804,21 @@ namespace Glest {
 			NetworkInterface::sendMessage(networkMessage);
 		}
 
+		void ConnectionSlot::flushCommandLists() {
+			MutexSafeWrapper safeMutex(socketSynchAccessor, CODE_AT_LINE);
+			NetworkInterface::flushCommandLists();
+		}
+
+		void ConnectionSlot::protocolFeaturesReceived(uint8 value) {
+			// answer with what both sides support and use it from now on, the
+			// game thread sends command lists through this slot meanwhile
+			MutexSafeWrapper safeMutex(socketSynchAccessor, CODE_AT_LINE);
+			uint8 commonProtocolFeatures = value & getSupportedProtocolFeatures();
+			NetworkMessageProtocolFeatures networkMessageProtocolFeatures(commonProtocolFeatures);
+			NetworkInterface::sendMessage(&networkMessageProtocolFeatures);
+			setProtocolFeatures(commonProtocolFeatures);
+		}
+
 		string ConnectionSlot::getHumanPlayerName(int index) {
 			return serverInterface->getHumanPlayerName(index);
 		}
@@ -1610,6 +1907,12 @@ namespace Glest {
 			if (socket != NULL && socket->hasDataToRead() == true) {
 				result = true;
 			}
+			safeMutexSlot.ReleaseLock();
+
+			// lists decoded from a batch wait here, not in the socket
+			if (result == false && receivedCommandListQueue.empty() == false) {
+				result = true;
+			}
 
 			return result;
 		}
@@ -22,6 +22,7 @@
 #define _GLEST_GAME_CONNECTIONSLOT_H_
 
 #include "socket.h"
+#include "socket_reactor.h"
 #include "network_interface.h"
 #include "base_thread.h"
 #include <time.h>
@@ -31,6 +32,8 @@
 
 using Shared::Platform::ServerSocket;
 using Shared::Platform::Socket;
+using Shared::Platform::SocketReactor;
+using Shared::Platform::SocketReactorEventInterface;
 using std::vector;
 
 namespace Glest {
@@ -80,6 +83,7 @@ namespace Glest {
 			virtual bool getAllowInGameConnections() const = 0;
 			virtual ConnectionSlot *getSlot(int index, bool lockMutex) = 0;
 			virtual Mutex *getSlotMutex(int index) = 0;
+			virtual bool isSocketReactorActive() = 0;
 
 			virtual void slotUpdateTask(ConnectionSlotEvent *event) = 0;
 			virtual ~ConnectionSlotCallbackInterface() {
@@ -135,6 +139,43 @@ namespace Glest {
 			virtual bool canShutdown(bool deleteSelfIfShutdownDelayed = false);
 		};
 
+		// =====================================================
+		//	class ConnectionSlotReactorThread
+		//
+		///	Reads and writes the sockets of all in game slots from
+		///	a single thread woken by a SocketReactor. The sockets
+		///	are switched to buffered non-blocking mode while it owns
+		///	them and the slot threads exit once the game started.
+		// =====================================================
+
+		class ConnectionSlotReactorThread : public BaseThread, public SocketReactorEventInterface {
+		protected:
+
+			ConnectionSlotCallbackInterface * slotInterface;
+			SocketReactor *reactor;
+			PLATFORM_SOCKET slotSocketIds[GameConstants::maxPlayers];
+			Socket *slotSockets[GameConstants::maxPlayers];
+			Chrono openSlotCheckTimer;
+
+			virtual void setQuitStatus(bool value);
+			void syncSlotSockets();
+			void releaseSlotSocket(int index);
+			void updateSendInterest();
+			void updateOpenSlots();
+
+		public:
+			explicit ConnectionSlotReactorThread(ConnectionSlotCallbackInterface *slotInterface);
+			virtual ~ConnectionSlotReactorThread();
+
+			virtual void execute();
+			void wakeup();
+
+			virtual void socketReadReady(PLATFORM_SOCKET socket, int userId);
+			virtual void socketWriteReady(PLATFORM_SOCKET socket, int userId);
+
+			virtual bool canShutdown(bool deleteSelfIfShutdownDelayed = false);
+		};
+
 		// =====================================================
 		//	class ConnectionSlot
 		// =====================================================
@@ -297,6 +338,7 @@ namespace Glest {
 			bool updateCompleted(ConnectionSlotEvent *event);
 
 			virtual void sendMessage(NetworkMessage* networkMessage);
+			virtual void flushCommandLists();
 			int getCurrentFrameCount() const {
 				return currentFrameCount;
 			}
@@ -348,6 +390,7 @@ namespace Glest {
 			virtual bool isConnected();
 
 			PLATFORM_SOCKET getSocketId();
+			bool hasDataToRead();
 
 			void setCanAcceptConnections(bool value) {
 				canAcceptConnections = value;
@@ -372,8 +415,7 @@ namespace Glest {
 			void deleteSocket();
 			virtual void update() {
 			}
-
-			bool hasDataToRead();
+			virtual void protocolFeaturesReceived(uint8 value);
 		};
 
 	}
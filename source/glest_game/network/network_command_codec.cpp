@@ -0,0 +1,128 @@
+//
+//	network_command_codec.cpp:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#include "network_command_codec.h"
+
+#include "platform_util.h"
+#include "conversion.h"
+#include "leak_dumper.h"
+
+using namespace Shared::Platform;
+using namespace Shared::Util;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		//	class NetworkCommandListCodec
+		// =====================================================
+
+		const uint32 NetworkCommandListCodec::maxCommandCount;
+
+		NetworkCommandListCodec::NetworkCommandListCodec() {
+			reset();
+		}
+
+		void NetworkCommandListCodec::reset() {
+			lastFrameCount = 0;
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				lastNetworkPlayerFactionCRC[index] = 0;
+			}
+			lastCommand = NetworkCommand();
+		}
+
+		void NetworkCommandListCodec::encode(int32 frameCount, const uint32 *networkPlayerFactionCRC,
+			const std::vector<NetworkCommand> &commands, VarintWriter &writer) {
+			if (commands.size() > maxCommandCount) {
+				throw megaglest_runtime_error("Too many commands in command list: " + uIntToStr((uint32) commands.size()));
+			}
+
+			writer.writeDelta(frameCount, lastFrameCount);
+			lastFrameCount = frameCount;
+
+			// CRCs look random, so only the changed ones are sent in full
+			writer.writeChangedWords(networkPlayerFactionCRC, lastNetworkPlayerFactionCRC, GameConstants::maxPlayers);
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				lastNetworkPlayerFactionCRC[index] = networkPlayerFactionCRC[index];
+			}
+
+			writer.writeUInt32((uint32) commands.size());
+			for (unsigned int index = 0; index < commands.size(); ++index) {
+				const NetworkCommand &command = commands[index];
+				writer.writeDelta(command.networkCommandType, lastCommand.networkCommandType);
+				writer.writeDelta(command.unitId, lastCommand.unitId);
+				writer.writeDelta(command.unitTypeId, lastCommand.unitTypeId);
+				writer.writeDelta(command.commandTypeId, lastCommand.commandTypeId);
+				writer.writeDelta(command.positionX, lastCommand.positionX);
+				writer.writeDelta(command.positionY, lastCommand.positionY);
+				writer.writeDelta(command.targetId, lastCommand.targetId);
+				writer.writeDelta(command.wantQueue, lastCommand.wantQueue);
+				writer.writeDelta(command.fromFactionIndex, lastCommand.fromFactionIndex);
+				writer.writeDelta(command.unitFactionUnitCount, lastCommand.unitFactionUnitCount);
+				writer.writeDelta(command.unitFactionIndex, lastCommand.unitFactionIndex);
+				writer.writeDelta(command.commandStateType, lastCommand.commandStateType);
+				writer.writeDelta(command.commandStateValue, lastCommand.commandStateValue);
+				writer.writeDelta(command.unitCommandGroupId, lastCommand.unitCommandGroupId);
+				lastCommand = command;
+			}
+		}
+
+		void NetworkCommandListCodec::decode(VarintReader &reader, int32 &frameCount, uint32 *networkPlayerFactionCRC,
+			std::vector<NetworkCommand> &commands) {
+			lastFrameCount = reader.readDelta(lastFrameCount);
+			frameCount = lastFrameCount;
+
+			reader.readChangedWords(lastNetworkPlayerFactionCRC, lastNetworkPlayerFactionCRC, GameConstants::maxPlayers);
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				networkPlayerFactionCRC[index] = lastNetworkPlayerFactionCRC[index];
+			}
+
+			uint32 commandCount = reader.readUInt32();
+			if (commandCount > maxCommandCount) {
+				throw megaglest_runtime_error("Invalid command list command count: " + uIntToStr(commandCount));
+			}
+			commands.clear();
+			commands.reserve(commandCount);
+			for (uint32 index = 0; index < commandCount; ++index) {
+				NetworkCommand command;
+				command.networkCommandType = static_cast<int16>(reader.readDelta(lastCommand.networkCommandType));
+				command.unitId = reader.readDelta(lastCommand.unitId);
+				command.unitTypeId = static_cast<int16>(reader.readDelta(lastCommand.unitTypeId));
+				command.commandTypeId = static_cast<int16>(reader.readDelta(lastCommand.commandTypeId));
+				command.positionX = static_cast<int16>(reader.readDelta(lastCommand.positionX));
+				command.positionY = static_cast<int16>(reader.readDelta(lastCommand.positionY));
+				command.targetId = reader.readDelta(lastCommand.targetId);
+				command.wantQueue = static_cast<int8>(reader.readDelta(lastCommand.wantQueue));
+				command.fromFactionIndex = static_cast<int8>(reader.readDelta(lastCommand.fromFactionIndex));
+				command.unitFactionUnitCount = static_cast<uint16>(reader.readDelta(lastCommand.unitFactionUnitCount));
+				command.unitFactionIndex = static_cast<int8>(reader.readDelta(lastCommand.unitFactionIndex));
+				command.commandStateType = static_cast<int8>(reader.readDelta(lastCommand.commandStateType));
+				command.commandStateValue = reader.readDelta(lastCommand.commandStateValue);
+				command.unitCommandGroupId = reader.readDelta(lastCommand.unitCommandGroupId);
+
+				commands.push_back(command);
+				lastCommand = command;
+			}
+		}
+
+	}
+}//end namespace
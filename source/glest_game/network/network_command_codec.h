@@ -0,0 +1,69 @@
+//
+//	network_command_codec.h:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#ifndef _GLEST_GAME_NETWORKCOMMANDCODEC_H_
+#define _GLEST_GAME_NETWORKCOMMANDCODEC_H_
+
+#include <vector>
+#include "game_constants.h"
+#include "network_types.h"
+#include "varint_codec.h"
+#include "leak_dumper.h"
+
+using Shared::Util::VarintWriter;
+using Shared::Util::VarintReader;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		//	class NetworkCommandListCodec
+		//
+		//	Varint encoding of command lists for one direction of
+		//	one connection. The frame count, CRCs and every command
+		//	field are written as deltas against what was sent last,
+		//	so both ends must see the lists in the same order.
+		// =====================================================
+
+		class NetworkCommandListCodec {
+		private:
+			int32 lastFrameCount;
+			uint32 lastNetworkPlayerFactionCRC[GameConstants::maxPlayers];
+			NetworkCommand lastCommand;
+
+		public:
+			// the command count of a list travels as a uint16 on the old wire format
+			static const uint32 maxCommandCount = 0xFFFF;
+
+			NetworkCommandListCodec();
+
+			void reset();
+			void encode(int32 frameCount, const uint32 *networkPlayerFactionCRC,
+				const std::vector<NetworkCommand> &commands, VarintWriter &writer);
+			void decode(VarintReader &reader, int32 &frameCount, uint32 *networkPlayerFactionCRC,
+				std::vector<NetworkCommand> &commands);
+		};
+
+	}
+}//end namespace
+
+#endif
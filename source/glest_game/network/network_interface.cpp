@@ -20,6 +20,7 @@
 #include <fstream>
 #include "util.h"
 #include "network_protocol.h"
+#include "config.h"
 #include "leak_dumper.h"
 
 using namespace Shared::Platform;
@@ -34,6 +35,7 @@ namespace Glest {
 		// =====================================================
 
 		const int NetworkInterface::readyWaitTimeout = 99000;	// 99 seconds to 0 looks good on the screen
+		const int NetworkInterface::maxCommandListBatchSize = 16;
 
 		bool NetworkInterface::allowGameDataSynchCheck = false;
 		bool NetworkInterface::allowDownloadDataSynch = false;
@@ -53,6 +55,9 @@ namespace Glest {
 			for (unsigned int index = 0; index < (unsigned int) GameConstants::maxPlayers; ++index) {
 				networkPlayerFactionCRC[index] = 0;
 			}
+
+			protocolFeatures = 0;
+			deferCommandLists = false;
 		}
 
 		void NetworkInterface::init() {
@@ -69,6 +74,9 @@ namespace Glest {
 			for (unsigned int index = 0; index < (unsigned int) GameConstants::maxPlayers; ++index) {
 				networkPlayerFactionCRC[index] = 0;
 			}
+
+			protocolFeatures = 0;
+			deferCommandLists = false;
 		}
 
 		NetworkInterface::~NetworkInterface() {
@@ -80,45 +88,102 @@ namespace Glest {
 		}
 
 		uint32 NetworkInterface::getNetworkPlayerFactionCRC(int index) {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkPlayerFactionCRCMutex, mutexOwnerId);
 
 			return networkPlayerFactionCRC[index];
 		}
 		void NetworkInterface::setNetworkPlayerFactionCRC(int index, uint32 crc) {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkPlayerFactionCRCMutex, mutexOwnerId);
 
 			networkPlayerFactionCRC[index] = crc;
 		}
 
 		void NetworkInterface::addChatInfo(const ChatMsgInfo &msg) {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			chatTextList.push_back(msg);
 		}
 
 		void NetworkInterface::addMarkedCell(const MarkedCell &msg) {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			markedCellList.push_back(msg);
 		}
 		void NetworkInterface::addUnMarkedCell(const UnMarkedCell &msg) {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			unmarkedCellList.push_back(msg);
 		}
 
+		uint8 NetworkInterface::getSupportedProtocolFeatures() {
+			uint8 result = 0;
+			if (Config::getInstance().getBool("NetworkCommandListBatching", "true") == true) {
+				result |= npfCommandListBatch;
+			}
+			return result;
+		}
+
+		void NetworkInterface::setProtocolFeatures(uint8 value) {
+			protocolFeatures = value;
+			commandListEncoder.reset();
+			commandListDecoder.reset();
+			sendCommandListQueue.clear();
+			receivedCommandListQueue.clear();
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] protocolFeatures = %u\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, protocolFeatures);
+		}
+
+		void NetworkInterface::protocolFeaturesReceived(uint8 value) {
+			// the answer of the server, it never has bits we did not offer
+			setProtocolFeatures(value & getSupportedProtocolFeatures());
+		}
+
 		void NetworkInterface::sendMessage(NetworkMessage* networkMessage) {
 			Socket* socket = getSocket(false);
 
+			if ((protocolFeatures & npfCommandListBatch) != 0) {
+				if (networkMessage->getNetworkMessageType() == nmtCommandList) {
+					sendCommandListQueue.push_back(*static_cast<NetworkMessageCommandList *>(networkMessage));
+					if (deferCommandLists == false ||
+						(int) sendCommandListQueue.size() >= maxCommandListBatchSize) {
+						sendQueuedCommandLists();
+					}
+					return;
+				}
+				// keep the order of the stream for everything else
+				sendQueuedCommandLists();
+			}
+
 			networkMessage->send(socket);
 		}
 
+		void NetworkInterface::flushCommandLists() {
+			sendQueuedCommandLists();
+		}
+
+		void NetworkInterface::sendQueuedCommandLists() {
+			if (sendCommandListQueue.empty() == true) {
+				return;
+			}
+
+			NetworkMessageCommandListBatch networkMessageCommandListBatch;
+			networkMessageCommandListBatch.encode(sendCommandListQueue, commandListEncoder);
+			sendCommandListQueue.clear();
+
+			networkMessageCommandListBatch.send(getSocket(false));
+		}
+
 		NetworkMessageType NetworkInterface::getNextMessageType(int waitMilliseconds) {
+			// lists of an already received batch come first
+			if (receivedCommandListQueue.empty() == false) {
+				return nmtCommandList;
+			}
+
 			Socket* socket = getSocket(false);
 			int8 messageType = nmtInvalid;
 
@@ -129,14 +194,14 @@ namespace Glest {
 					//peek message type
 					int dataSize = socket->getDataToRead();
 					if(dataSize >= (int)sizeof(messageType)) {
-						if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] socket->getDataToRead() dataSize = %d\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,dataSize);
+						if(DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] socket->getDataToRead() dataSize = %d\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,dataSize);
 
 						int iPeek = socket->peek(&messageType, sizeof(messageType));
 
-						if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] socket->getDataToRead() iPeek = %d, messageType = %d [size = %d]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,iPeek,messageType,sizeof(messageType));
+						if(DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] socket->getDataToRead() iPeek = %d, messageType = %d [size = %d]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,iPeek,messageType,sizeof(messageType));
 					}
 					else {
-						if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] PEEK WARNING, socket->getDataToRead() messageType = %d [size = %d], dataSize = %d\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,messageType,sizeof(messageType),dataSize);
+						if(DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] PEEK WARNING, socket->getDataToRead() messageType = %d [size = %d], dataSize = %d\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,messageType,sizeof(messageType),dataSize);
 					}
 
 					//sanity check new message type
@@ -145,7 +210,7 @@ namespace Glest {
 							throw megaglest_runtime_error("Invalid message type: " + intToStr(messageType));
 						}
 						else {
-							if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] Invalid message type = %d (no packet handshake yet so ignored)\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,messageType);
+							if(DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] Invalid message type = %d (no packet handshake yet so ignored)\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,messageType);
 						}
 					}
 				}
@@ -159,7 +224,7 @@ namespace Glest {
 
 			/*
 			int bytesReceived = socket->receive(&messageType, sizeof(messageType), true);
-			if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] socket->getDataToRead() iPeek = %d, messageType = %d [size = %d]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,bytesReceived,messageType,sizeof(messageType));
+			if(DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] socket->getDataToRead() iPeek = %d, messageType = %d [size = %d]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,bytesReceived,messageType,sizeof(messageType));
 
 			return static_cast<NetworkMessageType>(messageType);
 			*/
@@ -168,17 +233,20 @@ namespace Glest {
 			if (socket != NULL &&
 				((waitMilliseconds <= 0 && socket->hasDataToRead() == true) ||
 				(waitMilliseconds > 0 && socket->hasDataToReadWithWait(waitMilliseconds) == true))) {
+				// a buffered socket goes back here if the message is not all there yet
+				socket->markReceive();
+
 				//peek message type
 				int dataSize = socket->getDataToRead();
 				if (dataSize >= (int)sizeof(messageType)) {
 					//if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] socket->getDataToRead() dataSize = %d\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,dataSize);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] before recv\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] before recv\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 					//			int iPeek = socket->peek(&messageType, sizeof(messageType));
 					//			if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] socket->getDataToRead() iPeek = %d, messageType = %d [size = %d]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,iPeek,messageType,sizeof(messageType));
 					//			if(iPeek > 0) {
 					int bytesReceived = socket->receive(&messageType, sizeof(messageType), true);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket->getDataToRead() iPeek = %d, messageType = %d [size = %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, bytesReceived, messageType, sizeof(messageType));
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket->getDataToRead() iPeek = %d, messageType = %d [size = %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, bytesReceived, messageType, sizeof(messageType));
 					//}
 				}
 				//else {
@@ -193,8 +261,29 @@ namespace Glest {
 					if (getConnectHasHandshaked() == true) {
 						throw megaglest_runtime_error("Invalid message type: " + intToStr(messageType));
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Invalid message type = %d (no packet handshake yet so ignored)\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, messageType);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Invalid message type = %d (no packet handshake yet so ignored)\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, messageType);
+					}
+				} else if (messageType == nmtCommandListBatch) {
+					if ((protocolFeatures & npfCommandListBatch) == 0) {
+						throw megaglest_runtime_error("Received a command list batch that was not negotiated");
+					}
+
+					// hand the lists out one by one as plain nmtCommandList messages
+					NetworkMessageCommandListBatch networkMessageCommandListBatch;
+					if (networkMessageCommandListBatch.receive(socket) == false) {
+						return nmtInvalid;
 					}
+					std::vector<NetworkMessageCommandList> commandLists;
+					networkMessageCommandListBatch.decode(commandLists, commandListDecoder);
+					receivedCommandListQueue.insert(receivedCommandListQueue.end(), commandLists.begin(), commandLists.end());
+					messageType = nmtCommandList;
+				} else if (messageType == nmtProtocolFeatures) {
+					// negotiated here so every message loop of the game handles it
+					NetworkMessageProtocolFeatures networkMessageProtocolFeatures;
+					if (networkMessageProtocolFeatures.receive(socket) == true) {
+						protocolFeaturesReceived(networkMessageProtocolFeatures.getProtocolFeatures());
+					}
+					messageType = nmtInvalid;
 				}
 			}
 
@@ -203,7 +292,14 @@ namespace Glest {
 		}
 
 		bool NetworkInterface::receiveMessage(NetworkMessage* networkMessage) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+
+			if (receivedCommandListQueue.empty() == false &&
+				networkMessage->getNetworkMessageType() == nmtCommandList) {
+				*static_cast<NetworkMessageCommandList *>(networkMessage) = receivedCommandListQueue.front();
+				receivedCommandListQueue.pop_front();
+				return true;
+			}
 
 			Socket* socket = getSocket(false);
 
@@ -211,7 +307,7 @@ namespace Glest {
 		}
 
 		bool NetworkInterface::receiveMessage(NetworkMessage* networkMessage, NetworkMessageType type) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__);
 
 			Socket* socket = getSocket(false);
 
@@ -224,34 +320,34 @@ namespace Glest {
 		}
 
 		void NetworkInterface::setLastPingInfo(const NetworkMessagePing &ping) {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			this->lastPingInfo = ping;
 		}
 
 		void NetworkInterface::setLastPingInfoToNow() {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			this->lastPingInfo.setPingReceivedLocalTime(time(NULL));
 		}
 
 		NetworkMessagePing NetworkInterface::getLastPingInfo() {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			return lastPingInfo;
 		}
 		double NetworkInterface::getLastPingLag() {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			return difftime((long int) time(NULL), lastPingInfo.getPingReceivedLocalTime());
 		}
 
 		void NetworkInterface::DisplayErrorMessage(string sErr, bool closeSocket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sErr [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, sErr.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sErr [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, sErr.c_str());
 			//SystemFlags::OutputDebug(SystemFlags::debugError,"In [%s::%s Line: %d] sErr [%s]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,sErr.c_str());
 			SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] sErr [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, sErr.c_str());
 
@@ -269,7 +365,7 @@ namespace Glest {
 		std::vector<ChatMsgInfo> NetworkInterface::getChatTextList(bool clearList) {
 			std::vector<ChatMsgInfo> result;
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			if (chatTextList.empty() == false) {
@@ -283,11 +379,11 @@ namespace Glest {
 		}
 
 		void NetworkInterface::clearChatInfo() {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			if (chatTextList.empty() == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] chatTextList.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chatTextList.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] chatTextList.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chatTextList.size());
 				chatTextList.clear();
 			}
 		}
@@ -295,7 +391,7 @@ namespace Glest {
 		std::vector<MarkedCell> NetworkInterface::getMarkedCellList(bool clearList) {
 			std::vector<MarkedCell> result;
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			if (markedCellList.empty() == false) {
@@ -309,11 +405,11 @@ namespace Glest {
 		}
 
 		void NetworkInterface::clearMarkedCellList() {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			if (markedCellList.empty() == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] markedCellList.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, markedCellList.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] markedCellList.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, markedCellList.size());
 				markedCellList.clear();
 			}
 		}
@@ -321,7 +417,7 @@ namespace Glest {
 		std::vector<UnMarkedCell> NetworkInterface::getUnMarkedCellList(bool clearList) {
 			std::vector<UnMarkedCell> result;
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			if (unmarkedCellList.empty() == false) {
@@ -335,11 +431,11 @@ namespace Glest {
 		}
 
 		void NetworkInterface::clearUnMarkedCellList() {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			if (unmarkedCellList.empty() == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] unmarkedCellList.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, unmarkedCellList.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] unmarkedCellList.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, unmarkedCellList.size());
 				unmarkedCellList.clear();
 			}
 		}
@@ -347,7 +443,7 @@ namespace Glest {
 		std::vector<MarkedCell> NetworkInterface::getHighlightedCellList(bool clearList) {
 			std::vector<MarkedCell> result;
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			if (highlightedCellList.empty() == false) {
@@ -361,17 +457,17 @@ namespace Glest {
 		}
 
 		void NetworkInterface::clearHighlightedCellList() {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			if (highlightedCellList.empty() == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] markedCellList.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, markedCellList.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] markedCellList.size() = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, markedCellList.size());
 				highlightedCellList.clear();
 			}
 		}
 
 		void NetworkInterface::setHighlightedCell(const MarkedCell &msg) {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(networkAccessMutex, mutexOwnerId);
 
 			for (int idx = 0; idx < (int) highlightedCellList.size(); idx++) {
@@ -406,10 +502,10 @@ namespace Glest {
 			Mutex *mutex = getServerSynchAccessor();
 
 			if (insertAtStart == false) {
-				MutexSafeWrapper safeMutex(mutex, string(__FILE__) + "_" + intToStr(__LINE__));
+				MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
 				requestedCommands.push_back(*networkCommand);
 			} else {
-				MutexSafeWrapper safeMutex(mutex, string(__FILE__) + "_" + intToStr(__LINE__));
+				MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
 				requestedCommands.insert(requestedCommands.begin(), *networkCommand);
 			}
 		}
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <vector>
+#include <deque>
 #include "checksum.h"
 #include "network_message.h"
 #include "network_types.h"
@@ -234,8 +235,23 @@ namespace Glest {
 			Mutex *networkPlayerFactionCRCMutex;
 			uint32 networkPlayerFactionCRC[GameConstants::maxPlayers];
 
+			//negotiated NetworkProtocolFeature bits of this connection
+			uint8 protocolFeatures;
+			//queue command lists until flushCommandLists instead of sending each
+			bool deferCommandLists;
+			NetworkCommandListCodec commandListEncoder;
+			NetworkCommandListCodec commandListDecoder;
+			std::vector<NetworkMessageCommandList> sendCommandListQueue;
+			std::deque<NetworkMessageCommandList> receivedCommandListQueue;
+
+			void setProtocolFeatures(uint8 value);
+			static uint8 getSupportedProtocolFeatures();
+			void sendQueuedCommandLists();
+			virtual void protocolFeaturesReceived(uint8 value);
+
 		public:
 			static const int readyWaitTimeout;
+			static const int maxCommandListBatchSize;
 			GameSettings gameSettings;
 
 		public:
@@ -254,6 +270,10 @@ namespace Glest {
 			uint32 getNetworkPlayerFactionCRC(int index);
 			void setNetworkPlayerFactionCRC(int index, uint32 crc);
 
+			uint8 getProtocolFeatures() const {
+				return protocolFeatures;
+			}
+
 			virtual Socket* getSocket(bool mutexLock = true) = 0;
 
 			virtual void close() = 0;
@@ -276,6 +296,7 @@ namespace Glest {
 			}
 
 			virtual void sendMessage(NetworkMessage* networkMessage);
+			virtual void flushCommandLists();
 			NetworkMessageType getNextMessageType(int waitMilliseconds = 0);
 			bool receiveMessage(NetworkMessage* networkMessage);
 			bool receiveMessage(NetworkMessage* networkMessage, NetworkMessageType type);
@@ -61,16 +61,16 @@ namespace Glest {
 			if (socket != NULL) {
 				int dataReceived = socket->receive(data, dataSize, tryReceiveUntilDataSizeMet);
 				if (dataReceived != dataSize) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING, dataReceived = %d dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, dataReceived, dataSize);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING, dataReceived = %d dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, dataReceived, dataSize);
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("\nIn [%s::%s Line: %d] WARNING, dataReceived = %d dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, dataReceived, dataSize);
 
 					if (socket != NULL && socket->isSocketValid() == true) {
 						throw megaglest_runtime_error("Error receiving NetworkMessage, dataReceived = " + intToStr(dataReceived) + ", dataSize = " + intToStr(dataSize));
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket has been disconnected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket has been disconnected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					}
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] dataSize = %d, dataReceived = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, dataSize, dataReceived);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] dataSize = %d, dataReceived = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, dataSize, dataReceived);
 
 					dump_packet("\nINCOMING PACKET:\n", data, dataSize, false);
 					return true;
@@ -81,7 +81,7 @@ namespace Glest {
 		}
 
 		void NetworkMessage::send(Socket* socket, const void* data, int dataSize) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket = %p, data = %p, dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, socket, data, dataSize);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket = %p, data = %p, dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, socket, data, dataSize);
 
 			if (socket != NULL) {
 				dump_packet("\nOUTGOING PACKET:\n", data, dataSize, true);
@@ -92,14 +92,14 @@ namespace Glest {
 						snprintf(szBuf, 8096, "Error sending NetworkMessage, sendResult = %d, dataSize = %d", sendResult, dataSize);
 						throw megaglest_runtime_error(szBuf);
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d socket has been disconnected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d socket has been disconnected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					}
 				}
 			}
 		}
 
 		void NetworkMessage::send(Socket* socket, const void* data, int dataSize, int8 messageType) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket = %p, data = %p, dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, socket, data, dataSize);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket = %p, data = %p, dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, socket, data, dataSize);
 
 			if (socket != NULL) {
 				int msgTypeSize = sizeof(messageType);
@@ -118,7 +118,7 @@ namespace Glest {
 						snprintf(szBuf, 8096, "Error sending NetworkMessage, sendResult = %d, dataSize = %d", sendResult, fullMsgSize);
 						throw megaglest_runtime_error(szBuf);
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d socket has been disconnected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d socket has been disconnected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					}
 				} else {
 					delete[] out_buffer;
@@ -127,7 +127,7 @@ namespace Glest {
 		}
 
 		void NetworkMessage::send(Socket* socket, const void* data, int dataSize, int8 messageType, uint32 compressedLength) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket = %p, data = %p, dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, socket, data, dataSize);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] socket = %p, data = %p, dataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, socket, data, dataSize);
 
 			if (socket != NULL) {
 				int msgTypeSize = sizeof(messageType);
@@ -148,7 +148,7 @@ namespace Glest {
 						snprintf(szBuf, 8096, "Error sending NetworkMessage, sendResult = %d, dataSize = %d", sendResult, fullMsgSize);
 						throw megaglest_runtime_error(szBuf);
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d socket has been disconnected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d socket has been disconnected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					}
 				} else {
 					delete[] out_buffer;
@@ -453,12 +453,12 @@ namespace Glest {
 			data.playerUUID.nullTerminate();
 			data.platform.nullTerminate();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] get nmtIntro, data.playerIndex = %d, data.sessionId = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.playerIndex, data.sessionId);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] get nmtIntro, data.playerIndex = %d, data.sessionId = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.playerIndex, data.sessionId);
 			return result;
 		}
 
 		void NetworkMessageIntro::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sending nmtIntro, data.playerIndex = %d, data.sessionId = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.playerIndex, data.sessionId);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sending nmtIntro, data.playerIndex = %d, data.sessionId = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.playerIndex, data.sessionId);
 			assert(messageType == nmtIntro);
 			toEndian();
 
@@ -576,7 +576,7 @@ namespace Glest {
 		}
 
 		void NetworkMessagePing::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtPing\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtPing\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			assert(messageType == nmtPing);
 			toEndian();
 
@@ -675,7 +675,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageReady::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtReady\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtReady\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			assert(messageType == nmtReady);
 			toEndian();
 
@@ -705,6 +705,96 @@ namespace Glest {
 			}
 		}
 
+		// =====================================================
+		//	class NetworkMessageProtocolFeatures
+		// =====================================================
+
+		NetworkMessageProtocolFeatures::NetworkMessageProtocolFeatures() {
+			messageType = nmtProtocolFeatures;
+			data.protocolFeatures = 0;
+		}
+
+		NetworkMessageProtocolFeatures::NetworkMessageProtocolFeatures(uint8 protocolFeatures) {
+			messageType = nmtProtocolFeatures;
+			data.protocolFeatures = protocolFeatures;
+		}
+
+		const char * NetworkMessageProtocolFeatures::getPackedMessageFormat() const {
+			return "cC";
+		}
+
+		unsigned int NetworkMessageProtocolFeatures::getPackedSize() {
+			static unsigned int result = 0;
+			if (result == 0) {
+				Data packedData;
+				packedData.protocolFeatures = 0;
+				messageType = 0;
+				unsigned char *buf = new unsigned char[sizeof(packedData) * 3];
+				result = pack(buf, getPackedMessageFormat(),
+					messageType,
+					packedData.protocolFeatures);
+				delete[] buf;
+			}
+			return result;
+		}
+		void NetworkMessageProtocolFeatures::unpackMessage(unsigned char *buf) {
+			unpack(buf, getPackedMessageFormat(),
+				&messageType,
+				&data.protocolFeatures);
+		}
+
+		unsigned char * NetworkMessageProtocolFeatures::packMessage() {
+			unsigned char *buf = new unsigned char[getPackedSize() + 1];
+			pack(buf, getPackedMessageFormat(),
+				messageType,
+				data.protocolFeatures);
+			return buf;
+		}
+
+		bool NetworkMessageProtocolFeatures::receive(Socket* socket) {
+			bool result = false;
+			if (useOldProtocol == true) {
+				result = NetworkMessage::receive(socket, &data, sizeof(data), true);
+				if (result == true) {
+					messageType = this->getNetworkMessageType();
+				}
+			} else {
+				unsigned char *buf = new unsigned char[getPackedSize() + 1];
+				result = NetworkMessage::receive(socket, buf, getPackedSize(), true);
+				unpackMessage(buf);
+				delete[] buf;
+			}
+			fromEndian();
+			return result;
+		}
+
+		void NetworkMessageProtocolFeatures::send(Socket* socket) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtProtocolFeatures, protocolFeatures = %u\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.protocolFeatures);
+			assert(messageType == nmtProtocolFeatures);
+			toEndian();
+
+			if (useOldProtocol == true) {
+				NetworkMessage::send(socket, &data, sizeof(data), messageType);
+			} else {
+				unsigned char *buf = packMessage();
+				NetworkMessage::send(socket, buf, getPackedSize());
+				delete[] buf;
+			}
+		}
+
+		void NetworkMessageProtocolFeatures::toEndian() {
+			static bool bigEndianSystem = Shared::PlatformByteOrder::isBigEndian();
+			if (bigEndianSystem == true) {
+				messageType = Shared::PlatformByteOrder::toCommonEndian(messageType);
+			}
+		}
+		void NetworkMessageProtocolFeatures::fromEndian() {
+			static bool bigEndianSystem = Shared::PlatformByteOrder::isBigEndian();
+			if (bigEndianSystem == true) {
+				messageType = Shared::PlatformByteOrder::fromCommonEndian(messageType);
+			}
+		}
+
 		// =====================================================
 		//	class NetworkMessageLaunch
 		// =====================================================
@@ -1379,19 +1469,19 @@ namespace Glest {
 			bool result = false;
 
 			Chrono chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 			if (useOldProtocol == true) {
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 				//printf("UnCompressed launch packet before read compressed size\n");
 				result = NetworkMessage::receive(socket, &compressedLength, sizeof(compressedLength), true);
 				//printf("UnCompressed launch packet after read compressed size: %d\n",compressedLength);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 				if (result == true && compressedLength > 0 && socket != NULL && socket->isSocketValid()) {
 					//printf("UnCompressed launch packet before: %u after: %d\n",compressedLength,(int)getDataSize());
@@ -1402,8 +1492,8 @@ namespace Glest {
 					result = NetworkMessage::receive(socket, compressedMessage, compressedLength, true);
 					//printf("UnCompressed launch packet READ returned: %d\n",result);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 					if (result == true && socket != NULL && socket->isSocketValid()) {
 						//printf("UnCompressed launch packet before decompress\n");
@@ -1422,28 +1512,28 @@ namespace Glest {
 						std::pair<unsigned char *, unsigned long> decompressedBuffer =
 							Shared::CompressionUtil::extractMemoryToMemory(compressedMessage, buffer_size, maxNetworkMessageSize);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						unsigned char *decompressed_buffer = decompressedBuffer.first;
 						memcpy(&data, decompressed_buffer, decompressedBuffer.second);
 						delete[] decompressed_buffer;
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 						//printf("SUCCESS UnCompressed launch packet before: %u after: %lu\n",compressedLength,decompressedBuffer.second);
 					}
 					delete[] compressedMessage;
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 				} else if (result == true) {
 					//printf("Normal launch packet detected (uncompressed)\n");
 					result = NetworkMessage::receive(socket, &data, sizeof(data), true);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 				}
 			} else {
 				unsigned char *buf = new unsigned char[getPackedSize() + 1];
@@ -1454,8 +1544,8 @@ namespace Glest {
 			}
 			fromEndian();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) chrono.start();
 
 			data.description.nullTerminate();
 			data.map.nullTerminate();
@@ -1477,7 +1567,7 @@ namespace Glest {
 
 			data.gameUUID.nullTerminate();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
 
 			//for(int i= 0; i < GameConstants::maxPlayers; ++i){
 			//	printf("Receive index: %d resource multiplier index: %d sizeof(data): %d\n",i,data.resourceMultiplierIndex[i],sizeof(data));
@@ -1508,9 +1598,9 @@ namespace Glest {
 			//}
 
 			if (messageType == nmtLaunch) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtLaunch\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtLaunch\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] messageType = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, messageType);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] messageType = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, messageType);
 			}
 			toEndian();
 
@@ -1795,7 +1885,7 @@ namespace Glest {
 		}
 
 		bool NetworkMessageCommandList::receive(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			unsigned char *buf = NULL;
 			bool result = false;
@@ -1816,7 +1906,7 @@ namespace Glest {
 			fromEndianHeader();
 
 			if (result == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got header, messageType = %d, commandCount = %u, frameCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.messageType, data.header.commandCount, data.header.frameCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got header, messageType = %d, commandCount = %u, frameCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.messageType, data.header.commandCount, data.header.frameCount);
 
 				//printf("!!! =====> IN Network cmd get frame: %d data.header.commandCount: %u\n",data.header.frameCount,data.header.commandCount);
 
@@ -1847,7 +1937,7 @@ namespace Glest {
 					//	        }
 
 					if (result == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled == true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork) == true) {
 							for (int idx = 0; idx < data.header.commandCount; ++idx) {
 								const NetworkCommand &cmd = data.commands[idx];
 
@@ -1860,7 +1950,7 @@ namespace Glest {
 					}
 				}
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR header not received as expected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR header not received as expected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] ERROR header not received as expected\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			}
 			return result;
@@ -1880,7 +1970,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageCommandList::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtCommandList, frameCount = %d, data.header.commandCount = %d, data.header.messageType = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.frameCount, data.header.commandCount, data.messageType);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtCommandList, frameCount = %d, data.header.commandCount = %d, data.header.messageType = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.frameCount, data.header.commandCount, data.messageType);
 
 			assert(data.messageType == nmtCommandList);
 			uint16 totalCommand = data.header.commandCount;
@@ -1936,7 +2026,7 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled == true) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork) == true) {
 				SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] messageType = %d, frameCount = %d, data.commandCount = %d\n",
 					extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.messageType, data.header.frameCount, data.header.commandCount);
 
@@ -2000,6 +2090,93 @@ namespace Glest {
 			}
 		}
 
+		// =====================================================
+		//	class NetworkMessageCommandListBatch
+		// =====================================================
+
+		NetworkMessageCommandListBatch::NetworkMessageCommandListBatch() {
+			messageType = nmtCommandListBatch;
+			payloadSize = 0;
+		}
+
+		void NetworkMessageCommandListBatch::encode(const std::vector<NetworkMessageCommandList> &commandLists, NetworkCommandListCodec &codec) {
+			VarintWriter writer;
+			writer.writeUInt32((uint32) commandLists.size());
+			std::vector<NetworkCommand> commands;
+			uint32 networkPlayerFactionCRC[GameConstants::maxPlayers];
+			for (unsigned int index = 0; index < commandLists.size(); ++index) {
+				const NetworkMessageCommandList &commandList = commandLists[index];
+				commands.clear();
+				for (int commandIndex = 0; commandIndex < commandList.getCommandCount(); ++commandIndex) {
+					commands.push_back(*commandList.getCommand(commandIndex));
+				}
+				for (int factionIndex = 0; factionIndex < GameConstants::maxPlayers; ++factionIndex) {
+					networkPlayerFactionCRC[factionIndex] = commandList.getNetworkPlayerFactionCRC(factionIndex);
+				}
+				codec.encode(commandList.getFrameCount(), networkPlayerFactionCRC, commands, writer);
+			}
+			payload = writer.getBuffer();
+			payloadSize = writer.getSize();
+		}
+
+		void NetworkMessageCommandListBatch::decode(std::vector<NetworkMessageCommandList> &commandLists, NetworkCommandListCodec &codec) const {
+			if (payload.empty() == true) {
+				throw megaglest_runtime_error("Empty command list batch");
+			}
+			VarintReader reader(&payload[0], (uint32) payload.size());
+			uint32 listCount = reader.readUInt32();
+			if (listCount == 0 || listCount > payload.size()) {
+				throw megaglest_runtime_error("Invalid command list batch count: " + uIntToStr(listCount));
+			}
+			std::vector<NetworkCommand> commands;
+			uint32 networkPlayerFactionCRC[GameConstants::maxPlayers];
+			for (uint32 index = 0; index < listCount; ++index) {
+				int32 frameCount = 0;
+				codec.decode(reader, frameCount, networkPlayerFactionCRC, commands);
+
+				NetworkMessageCommandList commandList(frameCount);
+				for (int factionIndex = 0; factionIndex < GameConstants::maxPlayers; ++factionIndex) {
+					commandList.setNetworkPlayerFactionCRC(factionIndex, networkPlayerFactionCRC[factionIndex]);
+				}
+				for (unsigned int commandIndex = 0; commandIndex < commands.size(); ++commandIndex) {
+					commandList.addCommand(&commands[commandIndex]);
+				}
+				commandLists.push_back(commandList);
+			}
+			if (reader.isAtEnd() == false) {
+				throw megaglest_runtime_error("Command list batch has " + uIntToStr((uint32) payload.size() - reader.getPosition()) + " trailing bytes");
+			}
+		}
+
+		bool NetworkMessageCommandListBatch::receive(Socket* socket) {
+			bool result = NetworkMessage::receive(socket, &payloadSize, sizeof(payloadSize), true);
+			if (result == true) {
+				payloadSize = Shared::PlatformByteOrder::fromCommonEndian(payloadSize);
+				if (payloadSize == 0 || payloadSize > maxPayloadSize) {
+					throw megaglest_runtime_error("Invalid command list batch size: " + uIntToStr(payloadSize));
+				}
+				payload.resize(payloadSize);
+				result = NetworkMessage::receive(socket, &payload[0], payloadSize, true);
+			}
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got nmtCommandListBatch, payloadSize = %u result = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, payloadSize, result);
+			return result;
+		}
+
+		void NetworkMessageCommandListBatch::send(Socket* socket) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sending nmtCommandListBatch, payloadSize = %u\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, payloadSize);
+			assert(messageType == nmtCommandListBatch);
+
+			// type, size and payload go out in a single send
+			uint32 commonPayloadSize = Shared::PlatformByteOrder::toCommonEndian(payloadSize);
+			std::vector<uint8> buffer(sizeof(commonPayloadSize) + payload.size());
+			memcpy(&buffer[0], &commonPayloadSize, sizeof(commonPayloadSize));
+			if (payload.empty() == false) {
+				memcpy(&buffer[sizeof(commonPayloadSize)], &payload[0], payload.size());
+			}
+			NetworkMessage::send(socket, &buffer[0], (int) buffer.size(), messageType);
+		}
+
 		// =====================================================
 		//	class NetworkMessageText
 		// =====================================================
@@ -2010,7 +2187,7 @@ namespace Glest {
 		NetworkMessageText::NetworkMessageText(const string &text, int teamIndex, int playerIndex,
 			const string targetLanguage) {
 			if ((int) text.length() >= maxTextStringSize) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING / ERROR - text [%s] length = %d, max = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, text.c_str(), text.length(), maxTextStringSize);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING / ERROR - text [%s] length = %d, max = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, text.c_str(), text.length(), maxTextStringSize);
 			}
 
 			messageType = nmtText;
@@ -2091,7 +2268,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageText::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtText\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtText\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			assert(messageType == nmtText);
 			toEndian();
@@ -2178,7 +2355,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageQuit::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtQuit\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtQuit\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			assert(messageType == nmtQuit);
 			toEndian();
@@ -2229,25 +2406,25 @@ namespace Glest {
 					scenarioDir = scenarioDir.erase(scenarioDir.size() - gameSettings->getScenario().size(), gameSettings->getScenario().size() + 1);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, gameSettings->getScenarioDir().c_str(), gameSettings->getScenario().c_str(), scenarioDir.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] gameSettings.getScenarioDir() = [%s] gameSettings.getScenario() = [%s] scenarioDir = [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, gameSettings->getScenarioDir().c_str(), gameSettings->getScenario().c_str(), scenarioDir.c_str());
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			data.header.tilesetCRC = getFolderTreeContentsCheckSumRecursively(config.getPathListForType(ptTilesets, scenarioDir), string("/") + gameSettings->getTileset() + string("/*"), ".xml", NULL);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] data.tilesetCRC = %d, [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.tilesetCRC, gameSettings->getTileset().c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] data.tilesetCRC = %d, [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.tilesetCRC, gameSettings->getTileset().c_str());
 
 			//tech, load before map because of resources
 			data.header.techCRC = getFolderTreeContentsCheckSumRecursively(config.getPathListForType(ptTechs, scenarioDir), string("/") + gameSettings->getTech() + string("/*"), ".xml", NULL);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] data.techCRC = %d, [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.techCRC, gameSettings->getTech().c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] data.techCRC = %d, [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.techCRC, gameSettings->getTech().c_str());
 
 			vector<std::pair<string, uint32> > vctFileList;
 			vctFileList = getFolderTreeContentsCheckSumListRecursively(config.getPathListForType(ptTechs, scenarioDir), string("/") + gameSettings->getTech() + string("/*"), ".xml", &vctFileList);
 			data.header.techCRCFileCount = min((int) vctFileList.size(), (int) maxFileCRCCount);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] vctFileList.size() = %d, maxFileCRCCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, vctFileList.size(), maxFileCRCCount);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] vctFileList.size() = %d, maxFileCRCCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, vctFileList.size(), maxFileCRCCount);
 
 			for (int idx = 0; idx < (int) data.header.techCRCFileCount; ++idx) {
 				const std::pair<string, uint32> &fileInfo = vctFileList[idx];
@@ -2261,7 +2438,7 @@ namespace Glest {
 			checksum.addFile(file);
 			data.header.mapCRC = checksum.getSum();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] data.mapCRC = %d, [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.mapCRC, gameSettings->getMap().c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] data.mapCRC = %d, [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.mapCRC, gameSettings->getMap().c_str());
 		}
 
 		string NetworkMessageSynchNetworkGameData::getTechCRCFileMismatchReport(vector<std::pair<string, uint32> > &vctFileList) {
@@ -2422,7 +2599,7 @@ namespace Glest {
 
 
 		bool NetworkMessageSynchNetworkGameData::receive(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to get nmtSynchNetworkGameData\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to get nmtSynchNetworkGameData\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			data.header.techCRCFileCount = 0;
 			bool result = NetworkMessage::receive(socket, &data.header, HeaderSize, true);
@@ -2436,7 +2613,7 @@ namespace Glest {
 				data.header.tileset.nullTerminate();
 				data.header.tech.nullTerminate();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] messageType = %d, data.techCRCFileCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.messageType, data.header.techCRCFileCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] messageType = %d, data.techCRCFileCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.messageType, data.header.techCRCFileCount);
 
 
 
@@ -2449,7 +2626,7 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoopCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, packetLoopCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoopCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, packetLoopCount);
 
 				for (int iPacketLoop = 0; result == true && iPacketLoop < packetLoopCount; ++iPacketLoop) {
 
@@ -2459,7 +2636,7 @@ namespace Glest {
 					int packetDetail1DataSize = (DetailSize1 * packetFileCount);
 					int packetDetail2DataSize = (DetailSize2 * packetFileCount);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] iPacketLoop = %d, packetIndex = %d, maxFileCountPerPacket = %d, packetFileCount = %d, packetDetail1DataSize = %d, packetDetail2DataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, iPacketLoop, packetIndex, maxFileCountPerPacket, packetFileCount, packetDetail1DataSize, packetDetail2DataSize);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] iPacketLoop = %d, packetIndex = %d, maxFileCountPerPacket = %d, packetFileCount = %d, packetDetail1DataSize = %d, packetDetail2DataSize = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, iPacketLoop, packetIndex, maxFileCountPerPacket, packetFileCount, packetDetail1DataSize, packetDetail2DataSize);
 
 					// Wait a max of x seconds for this message
 					result = NetworkMessage::receive(socket, &data.detail.techCRCFileList[packetIndex], packetDetail1DataSize, true);
@@ -2478,7 +2655,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageSynchNetworkGameData::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to send nmtSynchNetworkGameData\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to send nmtSynchNetworkGameData\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			assert(data.messageType == nmtSynchNetworkGameData);
 			uint32 totalFileCount = data.header.techCRCFileCount;
@@ -2494,7 +2671,7 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoopCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, packetLoopCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoopCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, packetLoopCount);
 
 				for (int iPacketLoop = 0; iPacketLoop < packetLoopCount; ++iPacketLoop) {
 
@@ -2620,7 +2797,7 @@ namespace Glest {
 		}
 
 		bool NetworkMessageSynchNetworkGameDataStatus::receive(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to get nmtSynchNetworkGameDataStatus\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to get nmtSynchNetworkGameDataStatus\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			data.header.techCRCFileCount = 0;
 
@@ -2636,7 +2813,7 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoopCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, packetLoopCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoopCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, packetLoopCount);
 
 				for (uint32 iPacketLoop = 0; iPacketLoop < packetLoopCount; ++iPacketLoop) {
 
@@ -2644,7 +2821,7 @@ namespace Glest {
 					uint32 maxFileCountPerPacket = maxFileCRCPacketCount;
 					uint32 packetFileCount = min((uint32) maxFileCountPerPacket, data.header.techCRCFileCount - packetIndex);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] iPacketLoop = %u, packetIndex = %u, packetFileCount = %u\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, iPacketLoop, packetIndex, packetFileCount);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] iPacketLoop = %u, packetIndex = %u, packetFileCount = %u\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, iPacketLoop, packetIndex, packetFileCount);
 
 					result = NetworkMessage::receive(socket, &data.detail.techCRCFileList[packetIndex], ((uint32) DetailSize1 * packetFileCount), true);
 					if (result == true) {
@@ -2659,13 +2836,13 @@ namespace Glest {
 				fromEndianDetail();
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] result = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, result);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] result = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, result);
 
 			return result;
 		}
 
 		void NetworkMessageSynchNetworkGameDataStatus::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to send nmtSynchNetworkGameDataStatus, data.header.techCRCFileCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.techCRCFileCount);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] about to send nmtSynchNetworkGameDataStatus, data.header.techCRCFileCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, data.header.techCRCFileCount);
 
 			assert(data.messageType == nmtSynchNetworkGameDataStatus);
 			uint32 totalFileCount = data.header.techCRCFileCount;
@@ -2681,7 +2858,7 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoopCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, packetLoopCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoopCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, packetLoopCount);
 
 				toEndianDetail(totalFileCount);
 				for (int iPacketLoop = 0; iPacketLoop < packetLoopCount; ++iPacketLoop) {
@@ -2690,7 +2867,7 @@ namespace Glest {
 					int maxFileCountPerPacket = maxFileCRCPacketCount;
 					int packetFileCount = min((uint32) maxFileCountPerPacket, totalFileCount - packetIndex);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoop = %d, packetIndex = %d, packetFileCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, iPacketLoop, packetIndex, packetFileCount);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] packetLoop = %d, packetIndex = %d, packetFileCount = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, iPacketLoop, packetIndex, packetFileCount);
 
 					NetworkMessage::send(socket, &data.detail.techCRCFileList[packetIndex], (DetailSize1 * packetFileCount));
 					NetworkMessage::send(socket, &data.detail.techCRCFileCRCList[packetIndex], (DetailSize2 * packetFileCount));
@@ -2817,7 +2994,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageSynchNetworkGameDataFileCRCCheck::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtSynchNetworkGameDataFileCRCCheck\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtSynchNetworkGameDataFileCRCCheck\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			assert(messageType == nmtSynchNetworkGameDataFileCRCCheck);
 			toEndian();
@@ -2912,7 +3089,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageSynchNetworkGameDataFileGet::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtSynchNetworkGameDataFileGet\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtSynchNetworkGameDataFileGet\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			assert(messageType == nmtSynchNetworkGameDataFileGet);
 			toEndian();
@@ -3289,7 +3466,7 @@ namespace Glest {
 
 		NetworkMessageMarkCell::NetworkMessageMarkCell(Vec2i target, int factionIndex, const string &text, int playerIndex) {
 			if ((int) text.length() >= maxTextStringSize) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING / ERROR - text [%s] length = %d, max = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, text.c_str(), text.length(), maxTextStringSize);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING / ERROR - text [%s] length = %d, max = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, text.c_str(), text.length(), maxTextStringSize);
 			}
 
 			messageType = nmtMarkCell;
@@ -3377,7 +3554,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageMarkCell::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			assert(messageType == nmtMarkCell);
 			toEndian();
@@ -3500,7 +3677,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageUnMarkCell::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtUnMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtUnMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			assert(messageType == nmtUnMarkCell);
 			toEndian();
@@ -3614,7 +3791,7 @@ namespace Glest {
 		}
 
 		void NetworkMessageHighlightCell::send(Socket* socket) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] nmtMarkCell\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			assert(messageType == nmtHighlightCell);
 			toEndian();
@@ -27,6 +27,7 @@
 #include "game_constants.h"
 #include "network_types.h"
 #include "byte_order.h"
+#include "network_command_codec.h"
 #include <map>
 #include "common_scoped_ptr.h"
 #include "leak_dumper.h"
@@ -62,6 +63,8 @@ namespace Glest {
 			nmtUnMarkCell,
 			nmtHighlightCell,
 			//	nmtCompressedPacket,
+			nmtCommandListBatch,
+			nmtProtocolFeatures,
 
 			nmtCount
 		};
@@ -74,6 +77,13 @@ namespace Glest {
 			nmgstCount
 		};
 
+		// Optional wire format features. A client of the same version as the
+		// server offers the ones it supports in NetworkMessageProtocolFeatures
+		// after the intro handshake, the server answers with the common ones.
+		enum NetworkProtocolFeature {
+			npfCommandListBatch = 0x01
+		};
+
 		static const int maxLanguageStringSize = 60;
 		static const int maxNetworkMessageSize = 20000;
 
@@ -355,6 +365,53 @@ namespace Glest {
 		};
 #pragma pack(pop)
 
+		// =====================================================
+		//	class NetworkMessageProtocolFeatures
+		//
+		//	NetworkProtocolFeature bits offered by the client and
+		//	answered by the server, never sent to older versions
+		// =====================================================
+
+#pragma pack(push, 1)
+		class NetworkMessageProtocolFeatures : public NetworkMessage {
+		private:
+			int8 messageType;
+			struct Data {
+				uint8 protocolFeatures;
+			};
+			void toEndian();
+			void fromEndian();
+
+		private:
+			Data data;
+
+		protected:
+			virtual const char * getPackedMessageFormat() const;
+			virtual unsigned int getPackedSize();
+			virtual void unpackMessage(unsigned char *buf);
+			virtual unsigned char * packMessage();
+
+		public:
+			NetworkMessageProtocolFeatures();
+			explicit NetworkMessageProtocolFeatures(uint8 protocolFeatures);
+
+			virtual size_t getDataSize() const {
+				return sizeof(Data);
+			}
+
+			virtual NetworkMessageType getNetworkMessageType() const {
+				return nmtProtocolFeatures;
+			}
+
+			uint8 getProtocolFeatures() const {
+				return data.protocolFeatures;
+			}
+
+			virtual bool receive(Socket* socket);
+			virtual void send(Socket* socket);
+		};
+#pragma pack(pop)
+
 		// =====================================================
 		//	class NetworkMessageLaunch
 		//
@@ -574,6 +631,52 @@ namespace Glest {
 		};
 #pragma pack(pop)
 
+		// =====================================================
+		//	class NetworkMessageCommandListBatch
+		//
+		//	Several frames of command lists sent as one message,
+		//	only used when both sides announced npfCommandListBatch
+		// =====================================================
+
+		class NetworkMessageCommandListBatch : public NetworkMessage {
+		private:
+			static const uint32 maxPayloadSize = 1024 * 1024;
+
+			int8 messageType;
+			uint32 payloadSize;
+			std::vector<uint8> payload;
+
+		protected:
+			virtual const char * getPackedMessageFormat() const {
+				return NULL;
+			}
+			virtual unsigned int getPackedSize() {
+				return 0;
+			}
+			virtual void unpackMessage(unsigned char *buf) {
+			};
+			virtual unsigned char * packMessage() {
+				return NULL;
+			}
+
+		public:
+			NetworkMessageCommandListBatch();
+
+			virtual size_t getDataSize() const {
+				return sizeof(payloadSize) + payload.size();
+			}
+
+			virtual NetworkMessageType getNetworkMessageType() const {
+				return nmtCommandListBatch;
+			}
+
+			void encode(const std::vector<NetworkMessageCommandList> &commandLists, NetworkCommandListCodec &codec);
+			void decode(std::vector<NetworkMessageCommandList> &commandLists, NetworkCommandListCodec &codec) const;
+
+			virtual bool receive(Socket* socket);
+			virtual void send(Socket* socket);
+		};
+
 		// =====================================================
 		//	class NetworkMessageText
 		//
@@ -60,14 +60,14 @@ namespace Glest {
 					//const UnitType *unitType= world->findUnitTypeById(unit->getFaction()->getType(), this->unitTypeId);
 					const CommandType *ct = unit->getType()->findCommandTypeById(this->commandTypeId);
 					if (ct != NULL && ct->getClass() == ccBuild) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, toString().c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, toString().c_str());
 						CardinalDir::assertDirValid(facing);
 						assert(targetId == -1);
 					}
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Created NetworkCommand as follows:\n%s\n", __FILE__, __FUNCTION__, __LINE__, toString().c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Created NetworkCommand as follows:\n%s\n", __FILE__, __FUNCTION__, __LINE__, toString().c_str());
 		}
 
 		void NetworkCommand::preprocessNetworkCommand(World *world) {
@@ -82,7 +82,7 @@ namespace Glest {
 						CardinalDir::assertDirValid(targetId);
 					}
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] (unit == NULL) %s\n", __FILE__, __FUNCTION__, __LINE__, toString().c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] (unit == NULL) %s\n", __FILE__, __FUNCTION__, __LINE__, toString().c_str());
 				}
 			}
 		}
@@ -88,6 +88,7 @@ namespace Glest {
 			bool needToRepublishToMasterserver;
 
 			::Shared::PlatformCommon::FTPServerThread *ftpServer;
+			ConnectionSlotReactorThread *slotReactorThread;
 			bool exitServer;
 			int64 nextEventId;
 
@@ -167,6 +168,7 @@ namespace Glest {
 			virtual void setKeyframe(int frameCount) {
 				currentFrameCount = frameCount;
 			}
+			virtual void flushCommandLists();
 
 			virtual void waitUntilReady(Checksum *checksum);
 			virtual void sendTextMessage(const string & text, int teamIndex, bool echoLocal, string targetLanguage);
@@ -201,6 +203,7 @@ namespace Glest {
 			void removeSlot(int playerIndex, int lockedSlotIndex = -1);
 			virtual ConnectionSlot *getSlot(int playerIndex, bool lockMutex);
 			virtual Mutex *getSlotMutex(int playerIndex);
+			virtual bool isSocketReactorActive();
 			int getSlotCount();
 			int getConnectedSlotCount(bool authenticated);
 
@@ -320,6 +323,7 @@ namespace Glest {
 			void dispatchPendingHighlightCellMessages(std::vector <string> &errorMsgList);
 
 			void shutdownMasterserverPublishThread();
+			void shutdownSlotReactorThread();
 
 
 		};
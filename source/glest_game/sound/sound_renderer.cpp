@@ -32,7 +32,7 @@ namespace Glest {
 		// =====================================================
 
 		SoundRenderer::SoundRenderer() : mutex(new Mutex(CODE_AT_LINE)) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			soundPlayer = NULL;
 			loadConfig();
@@ -40,23 +40,23 @@ namespace Glest {
 			Config &config = Config::getInstance();
 			runThreadSafe = config.getBool("ThreadedSoundStream", "true");
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] runThreadSafe = %d\n", __FILE__, __FUNCTION__, __LINE__, runThreadSafe);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] runThreadSafe = %d\n", __FILE__, __FUNCTION__, __LINE__, runThreadSafe);
 		}
 
 		bool SoundRenderer::init(Window *window) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			SoundInterface &si = SoundInterface::getInstance();
 			FactoryRepository &fr = FactoryRepository::getInstance();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			Config &config = Config::getInstance();
 			si.setFactory(fr.getSoundFactory(config.getString("FactorySound")));
 
 			cleanup();
 			stopAllSounds();
 
-			MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 			if (runThreadSafe == true) {
 				safeMutex.setMutex(mutex);
 			}
@@ -70,26 +70,26 @@ namespace Glest {
 			}
 			safeMutex.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			return wasInitOk();
 		}
 
 		void SoundRenderer::cleanup() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			stopAllSounds();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
-			MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 			if (runThreadSafe == true) {
 				safeMutex.setMutex(mutex);
 			}
 			delete soundPlayer;
 			soundPlayer = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		bool SoundRenderer::wasInitOk() const {
@@ -107,14 +107,14 @@ namespace Glest {
 		}
 
 		SoundRenderer::~SoundRenderer() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			cleanup();
 
 			delete mutex;
 			mutex = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		SoundRenderer &SoundRenderer::getInstance() {
@@ -124,7 +124,7 @@ namespace Glest {
 
 		void SoundRenderer::update() {
 			if (wasInitOk() == true && soundPlayer != NULL) {
-				MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+				MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 				if (runThreadSafe == true) {
 					safeMutex.setMutex(mutex);
 				}
@@ -141,7 +141,7 @@ namespace Glest {
 				strSound->setVolume(musicVolume);
 				strSound->restart();
 				if (soundPlayer != NULL) {
-					MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+					MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 					if (runThreadSafe == true) {
 						safeMutex.setMutex(mutex);
 					}
@@ -161,7 +161,7 @@ namespace Glest {
 
 		void SoundRenderer::stopMusic(StrSound *strSound) {
 			if (soundPlayer != NULL) {
-				MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+				MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 				if (runThreadSafe == true) {
 					safeMutex.setMutex(mutex);
 				}
@@ -190,7 +190,7 @@ namespace Glest {
 					staticSound->setVolume(correctedVol);
 
 					if (soundPlayer != NULL) {
-						MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+						MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 						if (runThreadSafe == true) {
 							safeMutex.setMutex(mutex);
 						}
@@ -207,7 +207,7 @@ namespace Glest {
 			if (staticSound != NULL) {
 				staticSound->setVolume(fxVolume);
 				if (soundPlayer != NULL) {
-					MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+					MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 					if (runThreadSafe == true) {
 						safeMutex.setMutex(mutex);
 					}
@@ -225,7 +225,7 @@ namespace Glest {
 			if (strSound != NULL) {
 				strSound->setVolume(ambientVolume);
 				if (soundPlayer != NULL) {
-					MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+					MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 					if (runThreadSafe == true) {
 						safeMutex.setMutex(mutex);
 					}
@@ -239,7 +239,7 @@ namespace Glest {
 
 		void SoundRenderer::stopAmbient(StrSound *strSound) {
 			if (soundPlayer != NULL) {
-				MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+				MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 				if (runThreadSafe == true) {
 					safeMutex.setMutex(mutex);
 				}
@@ -254,7 +254,7 @@ namespace Glest {
 
 		void SoundRenderer::stopAllSounds(int64 fadeOff) {
 			if (soundPlayer != NULL) {
-				MutexSafeWrapper safeMutex(NULL, string(__FILE__) + "_" + intToStr(__LINE__));
+				MutexSafeWrapper safeMutex(NULL, CODE_AT_LINE);
 				if (runThreadSafe == true) {
 					safeMutex.setMutex(mutex);
 				}
@@ -166,8 +166,7 @@ namespace Glest {
 
 		void Faction::sortUnitsByCommandGroups() {
 			MutexSafeWrapper safeMutex(unitsMutex,
-				string(__FILE__) + "_" +
-				intToStr(__LINE__));
+				CODE_AT_LINE);
 			//printf("====== sortUnitsByCommandGroups for faction # %d [%s] unitCount = %d\n",this->getIndex(),this->getType()->getName().c_str(),units.size());
 			//for(unsigned int i = 0; i < units.size(); ++i) {
 			//      printf("%d / %d [%p] <>",i,units.size(),&units[i]);
@@ -227,365 +226,6 @@ namespace Glest {
 			//assert(originalUnitSize == units.size());
 		}
 
-		// =====================================================
-		//      class FactionThread
-		// =====================================================
-
-		FactionThread::FactionThread(Faction * faction) :BaseThread() {
-			this->triggerIdMutex = new Mutex(CODE_AT_LINE);
-			this->faction = faction;
-			this->masterController = NULL;
-			uniqueID = "FactionThread";
-		}
-
-		FactionThread::~FactionThread() {
-			this->faction = NULL;
-			this->masterController = NULL;
-			delete this->triggerIdMutex;
-			this->triggerIdMutex = NULL;
-		}
-
-		void FactionThread::setQuitStatus(bool value) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
-				SystemFlags::OutputDebug(SystemFlags::debugSystem,
-					"In [%s::%s] Line: %d value = %d\n",
-					__FILE__, __FUNCTION__, __LINE__, value);
-
-			BaseThread::setQuitStatus(value);
-			if (value == true) {
-				signalPathfinder(-1);
-			}
-
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
-				SystemFlags::OutputDebug(SystemFlags::debugSystem,
-					"In [%s::%s] Line: %d\n", __FILE__,
-					__FUNCTION__, __LINE__);
-		}
-
-		void FactionThread::signalPathfinder(int frameIndex) {
-			if (frameIndex >= 0) {
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
-				MutexSafeWrapper safeMutex(triggerIdMutex, mutexOwnerId);
-				this->frameIndex.first = frameIndex;
-				this->frameIndex.second = false;
-
-				safeMutex.ReleaseLock();
-			}
-			semTaskSignalled.signal();
-		}
-
-		void FactionThread::setTaskCompleted(int frameIndex) {
-			if (frameIndex >= 0) {
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
-				MutexSafeWrapper safeMutex(triggerIdMutex, mutexOwnerId);
-				if (this->frameIndex.first == frameIndex) {
-					this->frameIndex.second = true;
-				}
-				safeMutex.ReleaseLock();
-			}
-		}
-
-		bool FactionThread::canShutdown(bool deleteSelfIfShutdownDelayed) {
-			bool ret = (getExecutingTask() == false);
-			if (ret == false && deleteSelfIfShutdownDelayed == true) {
-				setDeleteSelfOnExecutionDone(deleteSelfIfShutdownDelayed);
-				deleteSelfIfRequired();
-				signalQuit();
-			}
-
-			return ret;
-		}
-
-		bool FactionThread::isSignalPathfinderCompleted(int frameIndex) {
-			if (getRunningStatus() == false) {
-				return true;
-			}
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
-			MutexSafeWrapper safeMutex(triggerIdMutex, mutexOwnerId);
-			//bool result = (event != NULL ? event->eventCompleted : true);
-			bool result = (this->frameIndex.first == frameIndex
-				&& this->frameIndex.second == true);
-
-			//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] worker thread this = %p, this->frameIndex.first = %d, this->frameIndex.second = %d\n",__FILE__,__FUNCTION__,__LINE__,this,this->frameIndex.first,this->frameIndex.second);
-
-			safeMutex.ReleaseLock();
-			return result;
-		}
-
-		void FactionThread::execute() {
-			string codeLocation = "1";
-			RunningStatusSafeWrapper runningStatus(this);
-			try {
-				//setRunningStatus(true);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
-					SystemFlags::OutputDebug(SystemFlags::debugSystem,
-						"In [%s::%s Line: %d]\n", __FILE__,
-						__FUNCTION__, __LINE__);
-				if (SystemFlags::VERBOSE_MODE_ENABLED)
-					printf
-					("In [%s::%s Line: %d] ****************** STARTING worker thread this = %p\n",
-						__FILE__, __FUNCTION__, __LINE__, this);
-
-				bool minorDebugPerformance = false;
-				Chrono chrono;
-
-				codeLocation = "2";
-				//unsigned int idx = 0;
-				for (; this->faction != NULL;) {
-					if (getQuitStatus() == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
-							SystemFlags::OutputDebug(SystemFlags::debugSystem,
-								"In [%s::%s Line: %d]\n", __FILE__,
-								__FUNCTION__, __LINE__);
-						break;
-					}
-
-					semTaskSignalled.waitTillSignalled();
-
-					codeLocation = "3";
-					//printf("In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
-					static string masterSlaveOwnerId =
-						string(__FILE__) + string("_") + intToStr(__LINE__);
-					MasterSlaveThreadControllerSafeWrapper
-						safeMasterController(masterController, 20000,
-							masterSlaveOwnerId);
-					//printf("In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
-
-					if (getQuitStatus() == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
-							SystemFlags::OutputDebug(SystemFlags::debugSystem,
-								"In [%s::%s Line: %d]\n", __FILE__,
-								__FUNCTION__, __LINE__);
-						break;
-					}
-
-					static string mutexOwnerId =
-						string(__FILE__) + string("_") + intToStr(__LINE__);
-					MutexSafeWrapper safeMutex(triggerIdMutex, mutexOwnerId);
-					bool executeTask = (this->frameIndex.first >= 0);
-					int currentTriggeredFrameIndex = this->frameIndex.first;
-
-					//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] frameIndex = %d this = %p executeTask = %d\n",__FILE__,__FUNCTION__,__LINE__,frameIndex.first, this, executeTask);
-
-					safeMutex.ReleaseLock();
-
-					codeLocation = "5";
-					//printf("In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
-
-					if (executeTask == true) {
-						codeLocation = "6";
-						ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
-
-						if (this->faction == NULL) {
-							throw megaglest_runtime_error("this->faction == NULL");
-						}
-						World *world = this->faction->getWorld();
-						if (world == NULL) {
-							throw megaglest_runtime_error("world == NULL");
-						}
-
-						codeLocation = "7";
-						//Config &config= Config::getInstance();
-						//bool sortedUnitsAllowed = config.getBool("AllowGroupedUnitCommands","true");
-						//bool sortedUnitsAllowed = false;
-						//if(sortedUnitsAllowed == true) {
-
-						/// TODO: Why does this cause and OOS?
-						//this->faction->sortUnitsByCommandGroups ();
-
-						//}
-
-						codeLocation = "8";
-						static string mutexOwnerId2 =
-							string(__FILE__) + string("_") + intToStr(__LINE__);
-						MutexSafeWrapper safeMutex(faction->getUnitMutex(),
-							mutexOwnerId2);
-
-						//if(SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
-						if (minorDebugPerformance)
-							chrono.start();
-
-						//printf("In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
-
-						codeLocation = "9";
-						int unitCount = this->faction->getUnitCount();
-						for (int j = 0; j < unitCount; ++j) {
-							codeLocation = "10";
-							Unit *unit = this->faction->getUnit(j);
-							if (unit == NULL) {
-								throw megaglest_runtime_error("unit == NULL");
-							}
-
-							codeLocation = "11";
-							int64 elapsed1 = 0;
-							if (minorDebugPerformance)
-								elapsed1 = chrono.getMillis();
-
-							bool update = unit->needToUpdate();
-
-							codeLocation = "12";
-							if (minorDebugPerformance
-								&& (chrono.getMillis() - elapsed1) >= 1)
-								printf
-								("Faction [%d - %s] #1-unit threaded updates on frame: %d for [%d] unit # %d, unitCount = %d, took [%lld] msecs\n",
-									faction->getStartLocationIndex(),
-									faction->getType()->getName(false).c_str(),
-									currentTriggeredFrameIndex,
-									faction->getUnitPathfindingListCount(), j, unitCount,
-									(long long int) chrono.getMillis() - elapsed1);
-
-							//update = true;
-							if (update == true) {
-								codeLocation = "13";
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::debugWorldSynch).
-									enabled == true) {
-									int64 updateProgressValue = unit->getUpdateProgress();
-									int64 speed =
-										unit->getCurrSkill()->getTotalSpeed(unit->
-											getTotalUpgrade());
-									int64 df = unit->getDiagonalFactor();
-									int64 hf = unit->getHeightFactor();
-									bool changedActiveCommand = unit->isChangedActiveCommand();
-
-									char szBuf[8096] = "";
-									snprintf(szBuf, 8096,
-										"unit->needToUpdate() returned: %d updateProgressValue: %lld speed: %lld changedActiveCommand: %d df: %lld hf: %lld",
-										update, (long long int) updateProgressValue,
-										(long long int) speed, changedActiveCommand,
-										(long long int) df, (long long int) hf);
-									unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
-								}
-
-								int64 elapsed2 = 0;
-								if (minorDebugPerformance)
-									elapsed2 = chrono.getMillis();
-
-								if (world->getUnitUpdater() == NULL) {
-									throw
-										megaglest_runtime_error
-										("world->getUnitUpdater() == NULL");
-								}
-
-								world->getUnitUpdater()->updateUnitCommand(unit,
-									currentTriggeredFrameIndex);
-
-								codeLocation = "15";
-								if (minorDebugPerformance
-									&& (chrono.getMillis() - elapsed2) >= 1)
-									printf
-									("Faction [%d - %s] #2-unit threaded updates on frame: %d for [%d] unit # %d, unitCount = %d, took [%lld] msecs\n",
-										faction->getStartLocationIndex(),
-										faction->getType()->getName(false).c_str(),
-										currentTriggeredFrameIndex,
-										faction->getUnitPathfindingListCount(), j, unitCount,
-										(long long int) chrono.getMillis() - elapsed2);
-							} else {
-								codeLocation = "16";
-								if (SystemFlags::
-									getSystemSettingType(SystemFlags::debugWorldSynch).
-									enabled == true) {
-									int64 updateProgressValue = unit->getUpdateProgress();
-									int64 speed =
-										unit->getCurrSkill()->getTotalSpeed(unit->
-											getTotalUpgrade());
-									int64 df = unit->getDiagonalFactor();
-									int64 hf = unit->getHeightFactor();
-									bool changedActiveCommand = unit->isChangedActiveCommand();
-
-									char szBuf[8096] = "";
-									snprintf(szBuf, 8096,
-										"unit->needToUpdate() returned: %d updateProgressValue: %lld speed: %lld changedActiveCommand: %d df: %lld hf: %lld",
-										update, (long long int) updateProgressValue,
-										(long long int) speed, changedActiveCommand,
-										(long long int) df, (long long int) hf);
-									unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
-								}
-							}
-						}
-
-						codeLocation = "17";
-						if (minorDebugPerformance && chrono.getMillis() >= 1)
-							printf
-							("Faction [%d - %s] threaded updates on frame: %d for [%d] units took [%lld] msecs\n",
-								faction->getStartLocationIndex(),
-								faction->getType()->getName(false).c_str(),
-								currentTriggeredFrameIndex,
-								faction->getUnitPathfindingListCount(),
-								(long long int) chrono.getMillis());
-
-						//printf("In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
-
-						safeMutex.ReleaseLock();
-
-						codeLocation = "18";
-						//printf("In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
-
-						setTaskCompleted(currentTriggeredFrameIndex);
-
-						//printf("In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
-					}
-
-					//printf("In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
-
-					codeLocation = "19";
-					if (getQuitStatus() == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
-							SystemFlags::OutputDebug(SystemFlags::debugSystem,
-								"In [%s::%s Line: %d]\n", __FILE__,
-								__FUNCTION__, __LINE__);
-						break;
-					}
-				}
-
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
-					SystemFlags::OutputDebug(SystemFlags::debugSystem,
-						"In [%s::%s Line: %d]\n", __FILE__,
-						__FUNCTION__, __LINE__);
-				if (SystemFlags::VERBOSE_MODE_ENABLED)
-					printf
-					("In [%s::%s Line: %d] ****************** ENDING worker thread this = %p\n",
-						__FILE__, __FUNCTION__, __LINE__, this);
-			} catch (const exception & ex) {
-				//setRunningStatus(false);
-
-				SystemFlags::OutputDebug(SystemFlags::debugError,
-					"In [%s::%s Line: %d] Loc [%s] Error [%s]\n",
-					__FILE__, __FUNCTION__, __LINE__,
-					codeLocation.c_str(), ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
-					SystemFlags::OutputDebug(SystemFlags::debugSystem,
-						"In [%s::%s Line: %d]\n", __FILE__,
-						__FUNCTION__, __LINE__);
-
-				throw megaglest_runtime_error(ex.what());
-			} catch (...) {
-				char szBuf[8096] = "";
-				snprintf(szBuf, 8096, "In [%s::%s %d] UNKNOWN error Loc [%s]\n",
-					__FILE__, __FUNCTION__, __LINE__, codeLocation.c_str());
-				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				throw megaglest_runtime_error(szBuf);
-			}
-
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
-				SystemFlags::OutputDebug(SystemFlags::debugSystem,
-					"In [%s::%s] Line: %d\n", __FILE__,
-					__FUNCTION__, __LINE__);
-		}
-
-
 		// =====================================================
 		//      class Faction
 		// =====================================================
@@ -600,7 +240,6 @@ namespace Glest {
 			//lastResourceTargettListPurge = 0;
 			cachingDisabled = false;
 			factionDisconnectHandled = false;
-			workerThread = NULL;
 
 			world = NULL;
 			scriptManager = NULL;
@@ -623,39 +262,27 @@ namespace Glest {
 		}
 
 		Faction::~Faction() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
 
 			//Renderer &renderer= Renderer::getInstance();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
 
 			//renderer.endTexture(rsGame,texture);
 			//texture->end();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
 
-			if (workerThread != NULL) {
-				workerThread->signalQuit();
-				if (workerThread->shutdownAndWait() == true) {
-					delete workerThread;
-				}
-				workerThread = NULL;
-			}
-
 			MutexSafeWrapper safeMutex(unitsMutex,
-				string(__FILE__) + "_" +
-				intToStr(__LINE__));
+				CODE_AT_LINE);
 			deleteValues(units.begin(), units.end());
 			units.clear();
 
@@ -663,8 +290,7 @@ namespace Glest {
 
 			//delete texture;
 			texture = NULL;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -672,38 +298,26 @@ namespace Glest {
 			delete unitsMutex;
 			unitsMutex = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
 		}
 
 		void Faction::end() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
 
-			if (workerThread != NULL) {
-				workerThread->signalQuit();
-				if (workerThread->shutdownAndWait() == true) {
-					delete workerThread;
-				}
-				workerThread = NULL;
-			}
-
 			MutexSafeWrapper safeMutex(unitsMutex,
-				string(__FILE__) + "_" +
-				intToStr(__LINE__));
+				CODE_AT_LINE);
 			deleteValues(units.begin(), units.end());
 			units.clear();
 
 			safeMutex.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -841,27 +455,64 @@ namespace Glest {
 
 		}
 
-		void Faction::signalWorkerThread(int frameIndex) {
-			if (workerThread != NULL) {
-				workerThread->signalPathfinder(frameIndex);
+		// Pathfinding pre-computation for a range of this faction's units, run
+		// from the world's thread pool. Units are always processed in index
+		// order because the pathfinder's per faction state is order dependent.
+		void Faction::precomputeUnitCommands(int frameIndex, int unitIndexBegin,
+			int unitIndexEnd) {
+			if (world == NULL) {
+				throw megaglest_runtime_error("world == NULL");
+			}
+			if (world->getUnitUpdater() == NULL) {
+				throw megaglest_runtime_error("world->getUnitUpdater() == NULL");
 			}
-		}
 
-		bool Faction::isWorkerThreadSignalCompleted(int frameIndex) {
-			if (workerThread != NULL) {
-				return workerThread->isSignalPathfinderCompleted(frameIndex);
+			static const char *mutexOwnerId = CODE_AT_LINE;
+			MutexSafeWrapper safeMutex(unitsMutex, mutexOwnerId);
+
+			int unitCount = getUnitCount();
+			if (unitIndexEnd > unitCount) {
+				unitIndexEnd = unitCount;
+			}
+			for (int j = unitIndexBegin; j < unitIndexEnd; ++j) {
+				Unit *unit = getUnit(j);
+				if (unit == NULL) {
+					throw megaglest_runtime_error("unit == NULL");
+				}
+
+				bool update = unit->needToUpdate();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
+					int64 updateProgressValue = unit->getUpdateProgress();
+					int64 speed =
+						unit->getCurrSkill()->getTotalSpeed(unit->
+							getTotalUpgrade());
+					int64 df = unit->getDiagonalFactor();
+					int64 hf = unit->getHeightFactor();
+					bool changedActiveCommand = unit->isChangedActiveCommand();
+
+					char szBuf[8096] = "";
+					snprintf(szBuf, 8096,
+						"unit->needToUpdate() returned: %d updateProgressValue: %lld speed: %lld changedActiveCommand: %d df: %lld hf: %lld",
+						update, (long long int) updateProgressValue,
+						(long long int) speed, changedActiveCommand,
+						(long long int) df, (long long int) hf);
+					unit->logSynchDataThreaded(__FILE__, __LINE__, szBuf);
+				}
+
+				if (update == true) {
+					world->getUnitUpdater()->updateUnitCommand(unit, frameIndex);
+				}
 			}
-			return true;
-		}
 
+			safeMutex.ReleaseLock();
+		}
 
 		void Faction::init(FactionType * factionType, ControlType control,
 			TechTree * techTree, Game * game, int factionIndex,
 			int teamIndex, int startLocationIndex,
 			bool thisFaction, bool giveResources,
 			const XmlNode * loadWorldNode) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -916,24 +567,7 @@ namespace Glest {
 					game->getWorld());
 			}
 
-			if (game->getGameSettings()->getPathFinderType() == pfBasic) {
-				if (workerThread != NULL) {
-					workerThread->signalQuit();
-					if (workerThread->shutdownAndWait() == true) {
-						delete workerThread;
-					}
-					workerThread = NULL;
-				}
-				static string mutexOwnerId =
-					string(extractFileFromDirectoryPath(__FILE__).c_str()) +
-					string("_") + intToStr(__LINE__);
-				this->workerThread = new FactionThread(this);
-				this->workerThread->setUniqueID(mutexOwnerId);
-				this->workerThread->start();
-			}
-
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n", __FILE__,
 					__FUNCTION__, __LINE__);
@@ -1101,8 +735,7 @@ namespace Glest {
 					}
 				}
 				if (found == false) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -1113,8 +746,7 @@ namespace Glest {
 			//required upgrades
 			for (int i = 0; i < rt->getUpgradeReqCount(); ++i) {
 				if (upgradeManager.isUpgraded(rt->getUpgradeReq(i)) == false) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"In [%s::%s Line: %d]\n", __FILE__,
 							__FUNCTION__, __LINE__);
@@ -1129,8 +761,7 @@ namespace Glest {
 					&& producedUnitType->getMaxUnitCount() > 0) {
 					if (producedUnitType->getMaxUnitCount() <=
 						getCountForMaxUnitCount(producedUnitType)) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 							SystemFlags::OutputDebug(SystemFlags::debugLUA,
 								"In [%s::%s Line: %d]\n", __FILE__,
 								__FUNCTION__, __LINE__);
@@ -1169,7 +800,7 @@ namespace Glest {
 			}
 
 			if (ct->getProduced() != NULL && reqsOk(ct->getProduced()) == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 					SystemFlags::OutputDebug(SystemFlags::debugLUA,
 						"In [%s::%s Line: %d] reqsOk FAILED\n",
 						__FILE__, __FUNCTION__, __LINE__);
@@ -1180,8 +811,7 @@ namespace Glest {
 				const UpgradeCommandType *uct =
 					static_cast <const UpgradeCommandType *>(ct);
 				if (upgradeManager.isUpgradingOrUpgraded(uct->getProducedUpgrade())) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).
-						enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"In [%s::%s Line: %d] upgrade check FAILED\n",
 							__FILE__, __FUNCTION__, __LINE__);
@@ -1595,16 +1225,14 @@ namespace Glest {
 
 		void Faction::addUnit(Unit * unit) {
 			MutexSafeWrapper safeMutex(unitsMutex,
-				string(__FILE__) + "_" +
-				intToStr(__LINE__));
+				CODE_AT_LINE);
 			units.push_back(unit);
 			unitMap[unit->getId()] = unit;
 		}
 
 		void Faction::removeUnit(Unit * unit) {
 			MutexSafeWrapper safeMutex(unitsMutex,
-				string(__FILE__) + "_" +
-				intToStr(__LINE__));
+				CODE_AT_LINE);
 
 			assert(units.size() == unitMap.size());
 
@@ -1725,9 +1353,7 @@ namespace Glest {
 				if (duplicateEntry == false) {
 					cacheResourceTargetList[pos] = 1;
 
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096,
 							"[addResourceTargetToCache] pos [%s]cacheResourceTargetList.size() ["
@@ -1761,9 +1387,7 @@ namespace Glest {
 					if (iter != cacheResourceTargetList.end()) {
 						cacheResourceTargetList.erase(pos);
 
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-							true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 							char szBuf[8096] = "";
 							snprintf(szBuf, 8096,
 								"[removeResourceTargetFromCache] pos [%s]cacheResourceTargetList.size() ["
@@ -1826,9 +1450,7 @@ namespace Glest {
 
 			if (cachingDisabled == false) {
 				if (cacheResourceTargetList.empty() == false) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-						true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096,
 							"cacheResourceTargetList.size() [" MG_SIZE_T_SPECIFIER
@@ -1961,9 +1583,7 @@ namespace Glest {
 					}
 
 					if (deleteList.empty() == false) {
-						if (SystemFlags::
-							getSystemSettingType(SystemFlags::debugWorldSynch).enabled ==
-							true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 							char szBuf[8096] = "";
 							snprintf(szBuf, 8096,
 								"[cleaning old resource targets] deleteList.size() ["
@@ -2145,9 +1765,7 @@ namespace Glest {
 						}
 
 						if (deleteList.empty() == false) {
-							if (SystemFlags::
-								getSystemSettingType(SystemFlags::debugWorldSynch).
-								enabled == true) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096,
 									"[cleaning old resource targets] deleteList.size() ["
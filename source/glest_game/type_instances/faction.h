@@ -88,36 +88,6 @@ namespace Glest {
 			bool operator () (const int l, const int r);
 		};
 
-		class FactionThread :public BaseThread,
-			public SlaveThreadControllerInterface {
-		protected:
-
-			Faction * faction;
-			Semaphore semTaskSignalled;
-			Mutex *triggerIdMutex;
-			std::pair < int, bool > frameIndex;
-			MasterSlaveThreadController *masterController;
-
-			virtual void setQuitStatus(bool value);
-			virtual void setTaskCompleted(int frameIndex);
-			virtual bool canShutdown(bool deleteSelfIfShutdownDelayed = false);
-
-		public:
-			explicit FactionThread(Faction * faction);
-			virtual ~FactionThread();
-			virtual void execute();
-
-			virtual void setMasterController(MasterSlaveThreadController * master) {
-				masterController = master;
-			}
-			virtual void signalSlave(void *userdata) {
-				signalPathfinder(*((int *) (userdata)));
-			}
-
-			void signalPathfinder(int frameIndex);
-			bool isSignalPathfinderCompleted(int frameIndex);
-		};
-
 		class SwitchTeamVote {
 		public:
 
@@ -168,7 +138,6 @@ namespace Glest {
 			std::map < Vec2i, bool > cachedCloseResourceTargetLookupList;
 
 			RandomGen random;
-			FactionThread *workerThread;
 
 			std::map < int, SwitchTeamVote > switchTeamVotes;
 			int currentSwitchTeamVoteFactionIndex;
@@ -217,20 +186,17 @@ namespace Glest {
 				bool filterBuiltUnits) const;
 
 			inline void addWorldSynchThreadedLogList(const string & data) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 					worldSynchThreadedLogList.push_back(data);
 				}
 			}
 			inline void clearWorldSynchThreadedLogList() {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 					worldSynchThreadedLogList.clear();
 				}
 			}
 			inline void dumpWorldSynchThreadedLogList() {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).
-					enabled == true) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 					if (worldSynchThreadedLogList.empty() == false) {
 						for (unsigned int index = 0;
 							index < worldSynchThreadedLogList.size(); ++index) {
@@ -443,11 +409,7 @@ namespace Glest {
 			}
 			int getFrameCount();
 
-			void signalWorkerThread(int frameIndex);
-			bool isWorkerThreadSignalCompleted(int frameIndex);
-			FactionThread *getWorkerThread() {
-				return workerThread;
-			}
+			void precomputeUnitCommands(int frameIndex, int unitIndexBegin, int unitIndexEnd);
 
 			void limitResourcesToStore();
 
@@ -779,7 +779,7 @@ namespace Glest {
 			calculateFogOfWarRadius();
 
 			//      if(isUnitDeleted(this) == true) {
-			//              MutexSafeWrapper safeMutex(&mutexDeletedUnits,string(__FILE__) + "_" + intToStr(__LINE__));
+			//              MutexSafeWrapper safeMutex(&mutexDeletedUnits,CODE_AT_LINE);
 			//              deletedUnits.erase(this);
 			//      }
 
@@ -794,8 +794,7 @@ namespace Glest {
 			this->faction->deleteLivingUnitsp(this);
 
 			//remove commands
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 			changedActiveCommand = false;
@@ -835,7 +834,7 @@ namespace Glest {
 				game->removeUnitFromSelection(this);
 			}
 
-			//MutexSafeWrapper safeMutex1(&mutexDeletedUnits,string(__FILE__) + "_" + intToStr(__LINE__));
+			//MutexSafeWrapper safeMutex1(&mutexDeletedUnits,CODE_AT_LINE);
 			//deletedUnits[this]=true;
 
 			delete mutexCommands;
@@ -1000,7 +999,7 @@ namespace Glest {
 
 		//bool Unit::isUnitDeleted(void *unit) {
 		//      bool result = false;
-		//      MutexSafeWrapper safeMutex(&mutexDeletedUnits,string(__FILE__) + "_" + intToStr(__LINE__));
+		//      MutexSafeWrapper safeMutex(&mutexDeletedUnits,CODE_AT_LINE);
 		//      if(deletedUnits.find(unit) != deletedUnits.end()) {
 		//              result = true;
 		//      }
@@ -1026,8 +1025,7 @@ namespace Glest {
 		// ====================================== get ======================================
 
 		Vec2i Unit::getCenteredPos() const {
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 			if (type == NULL) {
@@ -1043,8 +1041,7 @@ namespace Glest {
 		}
 
 		Vec2f Unit::getFloatCenteredPos() const {
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 			if (type == NULL) {
@@ -1607,8 +1604,7 @@ namespace Glest {
 					pos.getString());
 			}
 
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 			if (threaded) {
@@ -1695,8 +1691,7 @@ namespace Glest {
 			if (game->getWorld()->getFogOfWar() == true) {
 				if (forceRefresh || this->pos != this->cachedFowPos) {
 					cachedFow = getFogOfWarRadius(false);
-					static string mutexOwnerId =
-						string(__FILE__) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 					this->cachedFowPos = this->pos;
 				}
@@ -2032,8 +2027,7 @@ namespace Glest {
 
 		//return current command, assert that there is always one command
 		Command *Unit::getCurrrentCommandThreadSafe() {
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 			if (commands.empty() == false) {
@@ -2044,8 +2038,7 @@ namespace Glest {
 		}
 
 		void Unit::replaceCurrCommand(Command * cmd) {
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 			assert(commands.empty() == false);
@@ -2084,8 +2077,7 @@ namespace Glest {
 		//give one command (clear, and push back)
 		std::pair < CommandResult, string > Unit::giveCommand(Command * command,
 			bool tryQueue) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugUnitCommands).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands))
 				SystemFlags::OutputDebug(SystemFlags::debugUnitCommands,
 					"\n======================\nUnit Command tryQueue = %d\nUnit Info:\n%s\nCommand Info:\n%s\n",
 					tryQueue, this->toString().c_str(),
@@ -2095,8 +2087,7 @@ namespace Glest {
 			changedActiveCommand = false;
 
 			Chrono chrono;
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance))
 				chrono.start();
 
 			if (command == NULL) {
@@ -2108,8 +2099,7 @@ namespace Glest {
 
 			const int command_priority = command->getPriority();
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2121,16 +2111,14 @@ namespace Glest {
 
 
 			if (command->getCommandType()->isQueuable(tryQueue)) {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld\n",
 						extractFileFromDirectoryPath
 						(__FILE__).c_str(), __FUNCTION__,
 						__LINE__, chrono.getMillis());
-				if (SystemFlags::getSystemSettingType
-				(SystemFlags::debugUnitCommands).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands))
 					SystemFlags::OutputDebug(SystemFlags::debugUnitCommands,
 						"In [%s::%s Line: %d] Command is Queable\n",
 						extractFileFromDirectoryPath
@@ -2147,8 +2135,7 @@ namespace Glest {
 					for (list < Command * >::iterator i = commands.begin();
 						i != commands.end();) {
 						if ((*i)->getPriority() < command_priority) {
-							if (SystemFlags::getSystemSettingType
-							(SystemFlags::debugUnitCommands).enabled)
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands))
 								SystemFlags::OutputDebug(SystemFlags::debugUnitCommands,
 									"In [%s::%s Line: %d] Deleting lower priority command [%s]\n",
 									extractFileFromDirectoryPath
@@ -2156,8 +2143,7 @@ namespace Glest {
 									__LINE__,
 									(*i)->toString(false).c_str());
 
-							static string mutexOwnerId =
-								string(__FILE__) + string("_") + intToStr(__LINE__);
+							static const char *mutexOwnerId = CODE_AT_LINE;
 							MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 							deleteQueuedCommand(*i);
@@ -2169,8 +2155,7 @@ namespace Glest {
 						}
 					}
 				}
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2182,8 +2167,7 @@ namespace Glest {
 				if (commands.empty() == false &&
 					commands.back()->getCommandType()->isQueueAppendable() ==
 					false) {
-					if (SystemFlags::getSystemSettingType
-					(SystemFlags::debugUnitCommands).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands))
 						SystemFlags::OutputDebug(SystemFlags::debugUnitCommands,
 							"In [%s::%s Line: %d] Cancel command because last one is NOT queable [%s]\n",
 							extractFileFromDirectoryPath
@@ -2195,8 +2179,7 @@ namespace Glest {
 					cancelCommand();
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2205,8 +2188,7 @@ namespace Glest {
 						__LINE__, chrono.getMillis());
 			} else {
 				//empty command queue
-				if (SystemFlags::getSystemSettingType
-				(SystemFlags::debugUnitCommands).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands))
 					SystemFlags::OutputDebug(SystemFlags::debugUnitCommands,
 						"In [%s::%s Line: %d] Clear commands because current is NOT queable.\n",
 						extractFileFromDirectoryPath
@@ -2246,8 +2228,7 @@ namespace Glest {
 
 				//printf("In [%s::%s] Line: %d cleared existing commands\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugPerformance).enabled
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 					&& chrono.getMillis() > 0)
 					SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 						"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2256,8 +2237,7 @@ namespace Glest {
 						__LINE__, chrono.getMillis());
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2267,8 +2247,7 @@ namespace Glest {
 
 			//check command
 			result = checkCommand(command);
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugUnitCommands).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands))
 				SystemFlags::OutputDebug(SystemFlags::debugUnitCommands,
 					"In [%s::%s Line: %d] checkCommand returned: [%d]\n",
 					extractFileFromDirectoryPath
@@ -2277,8 +2256,7 @@ namespace Glest {
 
 			//printf("In [%s::%s] Line: %d check command returned %d, commands.size() = %d\n[%s]\n\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,result,commands.size(),command->toString().c_str());
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2290,8 +2268,7 @@ namespace Glest {
 				applyCommand(command);
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2301,8 +2278,7 @@ namespace Glest {
 
 			//push back command
 			if (result.first == crSuccess) {
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 				commands.push_back(command);
@@ -2313,8 +2289,7 @@ namespace Glest {
 				changedActiveCommand = false;
 			}
 
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugPerformance).enabled
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)
 				&& chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance,
 					"In [%s::%s] Line: %d took msecs: %lld\n",
@@ -2334,7 +2309,7 @@ namespace Glest {
 			this->setCurrentUnitTitle("");
 			//is empty?
 			if (commands.empty()) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 					SystemFlags::OutputDebug(SystemFlags::debugLUA,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -2344,8 +2319,7 @@ namespace Glest {
 			}
 
 			//pop front
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 			delete commands.front();
@@ -2381,7 +2355,7 @@ namespace Glest {
 
 			//is empty?
 			if (commands.empty()) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 					SystemFlags::OutputDebug(SystemFlags::debugLUA,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -2394,8 +2368,7 @@ namespace Glest {
 			undoCommand(commands.back());
 
 			//delete ans pop command
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 			delete commands.back();
@@ -2509,8 +2482,7 @@ namespace Glest {
 
 		void Unit::undertake() {
 			try {
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] about to undertake unit id = %d [%s] [%s]\n",
 						extractFileFromDirectoryPath
@@ -2542,8 +2514,7 @@ namespace Glest {
 					currentAttackBoostOriginatorEffect.currentAttackBoostUnits.clear();
 				}
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -2552,8 +2523,7 @@ namespace Glest {
 
 				UnitUpdater *unitUpdater = game->getWorld()->getUnitUpdater();
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -2563,8 +2533,7 @@ namespace Glest {
 				//unitUpdater->clearUnitPrecache(this);
 				unitUpdater->removeUnitPrecache(this);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -2574,8 +2543,7 @@ namespace Glest {
 				this->faction->deleteLivingUnits(id);
 				this->faction->deleteLivingUnitsp(this);
 
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -3520,6 +3488,10 @@ namespace Glest {
 				} else {
 					progress = PROGRESS_SPEED_MULTIPLIER;
 					deadCount++;
+					if (deadCount == 1) {
+						//putrefacting units no longer block their cells
+						map->invalidateWalkability(pos, type->getSize());
+					}
 					if (deadCount >= maxDeadCount) {
 						toBeUndertaken = true;
 						return_value = false;
@@ -4660,8 +4632,7 @@ namespace Glest {
 			while (commands.empty() == false) {
 				undoCommand(commands.back());
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 
 				delete commands.back();
@@ -4701,7 +4672,7 @@ namespace Glest {
 				(ignoreCheckCommand == false
 					&& this->getFaction()->reqsOk(command->getCommandType()) ==
 					false)) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 					SystemFlags::OutputDebug(SystemFlags::debugLUA,
 						"In [%s::%s Line: %d] isOperative() = %d, command->getUnit() = %p, getType()->hasCommandType(command->getCommandType()) = %d, this->getFaction()->reqsOk(command->getCommandType()) = %d\n",
 						extractFileFromDirectoryPath
@@ -4730,7 +4701,7 @@ namespace Glest {
 
 			//if pos is not inside the world (if comand has not a pos, pos is (0, 0) and is inside world
 			if (map->isInside(command->getPos()) == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 					SystemFlags::OutputDebug(SystemFlags::debugLUA,
 						"In [%s::%s Line: %d]\n",
 						extractFileFromDirectoryPath
@@ -4841,8 +4812,7 @@ namespace Glest {
 					getUpgradeManager()->isUpgradingOrUpgraded(uct->
 						getProducedUpgrade
 						())) {
-					if (SystemFlags::
-						getSystemSettingType(SystemFlags::debugLUA).enabled)
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA))
 						SystemFlags::OutputDebug(SystemFlags::debugLUA,
 							"In [%s::%s Line: %d]\n",
 							extractFileFromDirectoryPath
@@ -5513,8 +5483,7 @@ namespace Glest {
 		}
 		void Unit::logSynchDataCommon(string file, int line, string source,
 			bool threadedMode) {
-			if (SystemFlags::
-				getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096,
 					"FrameCount [%d] Unit = %d [%s][%s] pos = %s, lastPos = %s, targetPos = %s, targetVec = %s, meetingPos = %s, progress ["
@@ -5727,8 +5696,7 @@ namespace Glest {
 		Vec2i Unit::getPos() {
 			Vec2i result;
 
-			static string mutexOwnerId =
-				string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexCommands, mutexOwnerId);
 			result = this->pos;
 			safeMutex.ReleaseLock();
@@ -6629,8 +6597,7 @@ namespace Glest {
 				XmlNode *node = commandNodeList[i];
 				Command *command = Command::loadGame(node, ut, world);
 
-				static string mutexOwnerId =
-					string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper safeMutex(result->mutexCommands, mutexOwnerId);
 				result->commands.push_back(command);
 				safeMutex.ReleaseLock();
@@ -618,6 +618,9 @@ namespace Glest {
 			const FowAlphaCellsLookupItem & getCachedFow() const {
 				return cachedFow;
 			}
+			const ExploredCellsLookupItem & getCachedExploredCells() const {
+				return cacheExploredCells;
+			}
 			FowAlphaCellsLookupItem getFogOfWarRadius(bool useCache) const;
 			void calculateFogOfWarRadius(bool forceRefresh = false);
 
@@ -54,8 +54,7 @@ namespace Glest {
 			vector < pair < string,
 			string > > >&loadedFileList, bool validationMode) {
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -98,8 +97,7 @@ namespace Glest {
 					const XmlNode *rootNode = xmlTree.getRootNode();
 
 					if (rootNode->getName() == "link") {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"Faction [%s] is a linked faction\n",
 								name.c_str());
@@ -127,8 +125,7 @@ namespace Glest {
 							push_back(make_pair(linkedCurrentPath, linkedCurrentPath));
 						loadedFileList[tmppath].
 							push_back(make_pair(currentPath, currentPath));
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-							enabled)
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"techTreePath [%s] techTreeName [%s]\n",
 								techTreePath.c_str(),
@@ -159,8 +156,7 @@ namespace Glest {
 			Logger::getInstance().add(szBuf, true);
 
 			if (personalityType == fpt_Normal) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"Loading faction [%s] currentPath [%s]\n",
 						path.c_str(), currentPath.c_str());
@@ -284,8 +280,7 @@ namespace Glest {
 
 				string tmppath = currentPath + factionName + ".xml";
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"Loading faction xml [%s]\n",
 						tmppath.c_str());
@@ -572,8 +567,7 @@ namespace Glest {
 					}
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -1204,16 +1198,14 @@ namespace Glest {
 					unitTypes[i].getName(false).c_str());
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] scanning [%s] size = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
 					c_str(), __FUNCTION__, __LINE__,
 					name.c_str(), unitTypes.size());
 			for (int i = 0; i < (int) unitTypes.size(); i++) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] scanning [%s] idx = %d [%s]\n",
 						extractFileFromDirectoryPath(__FILE__).
@@ -1264,16 +1256,14 @@ namespace Glest {
 					upgradeTypes[i].getName().c_str());
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d] scanning [%s] size = %d\n",
 					extractFileFromDirectoryPath(__FILE__).
 					c_str(), __FUNCTION__, __LINE__,
 					name.c_str(), unitTypes.size());
 			for (int i = 0; i < (int) upgradeTypes.size(); i++) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-					enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem,
 						"In [%s::%s Line: %d] scanning [%s] idx = %d [%s]\n",
 						extractFileFromDirectoryPath(__FILE__).
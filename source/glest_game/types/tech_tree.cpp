@@ -16,7 +16,9 @@
 #include "util.h"
 #include "resource.h"
 #include "faction_type.h"
+#include "tech_tree_preloader.h"
 #include "logger.h"
+#include "config.h"
 #include "xml_parser.h"
 #include "platform_util.h"
 #include "game_util.h"
@@ -224,8 +226,7 @@ namespace Glest {
 			Checksum * checksum, Checksum * techtreeChecksum,
 			std::map < string, vector < pair < string,
 			string > > >&loadedFileList, bool validationMode) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -401,6 +402,17 @@ namespace Glest {
 			//SDL_PumpEvents();
 
 			//load factions
+			// worker threads parse and hash the faction files ahead of the
+			// loop below, which still builds each faction type in order
+			TechTreePreloader preloader;
+			if (Config::getInstance().getBool("ParallelTechTreeLoading", "true") == true) {
+				for (set < string >::iterator it = factions.begin();
+					it != factions.end(); ++it) {
+					preloader.addFaction(treePath, *it);
+				}
+				preloader.start(TechTreePreloader::getDefaultThreadCount());
+			}
+
 			try {
 				factionTypes.resize(factions.size());
 
@@ -433,6 +445,7 @@ namespace Glest {
 					Window::handleEvent();
 					SDL_PumpEvents();
 				}
+				preloader.stop();
 			} catch (megaglest_runtime_error & ex) {
 				SystemFlags::OutputDebug(SystemFlags::debugError,
 					"In [%s::%s Line: %d] Error [%s]\n",
@@ -458,8 +471,7 @@ namespace Glest {
 				*techtreeChecksum = checksumValue;
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -467,8 +479,7 @@ namespace Glest {
 		}
 
 		TechTree::~TechTree() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -555,8 +566,7 @@ namespace Glest {
 					return &factionTypes[i];
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
@@ -570,8 +580,7 @@ namespace Glest {
 					return &factionTypes[i];
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).
-				enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem,
 					"In [%s::%s Line: %d]\n",
 					extractFileFromDirectoryPath(__FILE__).
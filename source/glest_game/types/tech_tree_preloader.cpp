@@ -0,0 +1,221 @@
+//
+//	tech_tree_preloader.cpp:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#include "tech_tree_preloader.h"
+
+#include <SDL.h>
+#include "checksum.h"
+#include "properties.h"
+#include "xml_parser.h"
+#include "conversion.h"
+#include "platform_common.h"
+#include "platform_util.h"
+#include "util.h"
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::Util;
+using namespace Shared::Xml;
+using namespace Shared::PlatformCommon;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		//	class TechTreePreloadThread
+		// =====================================================
+
+		TechTreePreloadThread::TechTreePreloadThread(TechTreePreloader *preloader) : BaseThread() {
+			this->preloader = preloader;
+			uniqueID = "TechTreePreloadThread";
+		}
+
+		TechTreePreloadThread::~TechTreePreloadThread() {
+			preloader = NULL;
+		}
+
+		bool TechTreePreloadThread::canShutdown(bool deleteSelfIfShutdownDelayed) {
+			bool ret = (getExecutingTask() == false);
+			if (ret == false && deleteSelfIfShutdownDelayed == true) {
+				setDeleteSelfOnExecutionDone(deleteSelfIfShutdownDelayed);
+				deleteSelfIfRequired();
+				signalQuit();
+			}
+
+			return ret;
+		}
+
+		void TechTreePreloadThread::execute() {
+			RunningStatusSafeWrapper runningStatus(this);
+			// an error only costs the head start, the main thread
+			// loads whatever is missing itself
+			try {
+				ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
+				preloader->runJobs(this);
+			} catch (const exception &ex) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
+			} catch (...) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			}
+		}
+
+		// =====================================================
+		//	class TechTreePreloader
+		// =====================================================
+
+		TechTreePreloader::TechTreePreloader() : mutexJobs(new Mutex(CODE_AT_LINE)) {
+			nextJobIndex = 0;
+		}
+
+		TechTreePreloader::~TechTreePreloader() {
+			stop();
+
+			delete mutexJobs;
+			mutexJobs = NULL;
+		}
+
+		int TechTreePreloader::getDefaultThreadCount() {
+			int threadCount = SDL_GetCPUCount() - 1;
+			if (threadCount < 0) {
+				threadCount = 0;
+			}
+			return min(threadCount, 8);
+		}
+
+		void TechTreePreloader::addJob(const string &path, const std::map<string, string> &mapExtraTagReplacementValues, bool checksumFile) {
+			// the replacement values have to be the ones the loading code
+			// builds, otherwise XmlTree::load does not take the tree
+			std::map<string, string> mapExtraTagReplacementValuesCopy = mapExtraTagReplacementValues;
+
+			TechTreePreloadJob job;
+			job.path = path;
+			job.mapTagReplacementValues = Properties::getTagReplacementValues(&mapExtraTagReplacementValuesCopy);
+			job.checksumFile = checksumFile;
+			jobList.push_back(job);
+		}
+
+		void TechTreePreloader::addFaction(const string &techTreePath, const string &factionName) {
+			string currentPath = techTreePath + "factions/" + factionName;
+			endPathWithSlash(currentPath);
+
+			string factionPath = currentPath + factionName + ".xml";
+			if (fileExists(factionPath) == false) {
+				return;
+			}
+
+			std::map<string, string> mapExtraTagReplacementValues;
+			// FactionType::load reads the faction xml once without the
+			// common data path to look for a link, then again with it
+			addJob(factionPath, mapExtraTagReplacementValues, false);
+			mapExtraTagReplacementValues["$COMMONDATAPATH"] = techTreePath + "/commondata/";
+			addJob(factionPath, mapExtraTagReplacementValues, true);
+
+			vector<string> unitFilenames;
+			findDirs(currentPath + "units/", unitFilenames, false, false);
+			for (unsigned int index = 0; index < unitFilenames.size(); ++index) {
+				string unitPath = currentPath + "units/" + unitFilenames[index];
+				endPathWithSlash(unitPath);
+				string unitFile = unitPath + unitFilenames[index] + ".xml";
+				addJob(unitFile, mapExtraTagReplacementValues, true);
+
+				// particle systems mostly sit next to the unit xml
+				vector<string> xmlFilenames;
+				findAll(unitPath + "*.xml", xmlFilenames, false, false);
+				for (unsigned int xmlIndex = 0; xmlIndex < xmlFilenames.size(); ++xmlIndex) {
+					if (unitPath + xmlFilenames[xmlIndex] != unitFile) {
+						addJob(unitPath + xmlFilenames[xmlIndex], mapExtraTagReplacementValues, false);
+					}
+				}
+			}
+
+			vector<string> upgradeFilenames;
+			findDirs(currentPath + "upgrades/", upgradeFilenames, false, false);
+			for (unsigned int index = 0; index < upgradeFilenames.size(); ++index) {
+				string upgradePath = currentPath + "upgrades/" + upgradeFilenames[index];
+				endPathWithSlash(upgradePath);
+				addJob(upgradePath + upgradeFilenames[index] + ".xml", mapExtraTagReplacementValues, true);
+			}
+		}
+
+		void TechTreePreloader::start(int threadCount) {
+			if (threadCount <= 0 || jobList.empty() == true) {
+				return;
+			}
+			nextJobIndex = 0;
+			XmlPreloadCache::enable();
+
+			for (int index = 0; index < threadCount; ++index) {
+				TechTreePreloadThread *workerThread = new TechTreePreloadThread(this);
+				workerThread->setUniqueID("TechTreePreloadThread_" + intToStr(index));
+				workerThread->start();
+				threadList.push_back(workerThread);
+			}
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] preloading %d files on %d threads\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, (int) jobList.size(), threadCount);
+		}
+
+		void TechTreePreloader::stop() {
+			if (threadList.empty() == true) {
+				return;
+			}
+
+			for (unsigned int index = 0; index < threadList.size(); ++index) {
+				threadList[index]->signalQuit();
+			}
+			// a worker is at most one file away from its next quit check,
+			// it has to be gone before the job list and mutex are
+			for (unsigned int index = 0; index < threadList.size(); ++index) {
+				TechTreePreloadThread *workerThread = threadList[index];
+				while (workerThread->shutdownAndWait() == false) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] still waiting for [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, workerThread->getUniqueID().c_str());
+				}
+				delete workerThread;
+			}
+			threadList.clear();
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] preloaded xml hits = %u misses = %u\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, XmlPreloadCache::getHits(), XmlPreloadCache::getMisses());
+
+			XmlPreloadCache::disable();
+			jobList.clear();
+			nextJobIndex = 0;
+		}
+
+		void TechTreePreloader::runJobs(BaseThread *thread) {
+			static const char *mutexOwnerId = CODE_AT_LINE;
+			for (; thread->getQuitStatus() == false;) {
+				MutexSafeWrapper safeMutex(mutexJobs, mutexOwnerId);
+				if (nextJobIndex >= jobList.size()) {
+					return;
+				}
+				// a copy, the parse runs without the lock
+				TechTreePreloadJob job = jobList[nextJobIndex++];
+				safeMutex.ReleaseLock();
+
+				XmlPreloadCache::preload(job.path, job.mapTagReplacementValues);
+				if (job.checksumFile == true) {
+					Checksum::precacheFile(job.path);
+				}
+			}
+		}
+
+	}
+}//end namespace
@@ -0,0 +1,111 @@
+//
+//	tech_tree_preloader.h:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#ifndef _GLEST_GAME_TECHTREEPRELOADER_H_
+#define _GLEST_GAME_TECHTREEPRELOADER_H_
+
+#ifdef WIN32
+#include <winsock2.h>
+#include <winsock.h>
+#endif
+
+#include <map>
+#include <string>
+#include <vector>
+#include "base_thread.h"
+#include "leak_dumper.h"
+
+using std::map;
+using std::string;
+using std::vector;
+using Shared::PlatformCommon::BaseThread;
+
+namespace Glest {
+	namespace Game {
+
+		class TechTreePreloader;
+
+		// one xml file the faction loading is going to ask for
+		class TechTreePreloadJob {
+		public:
+			string path;
+			std::map<string, string> mapTagReplacementValues;
+			// the file is part of the techtree checksum
+			bool checksumFile;
+		};
+
+		// =====================================================
+		//	class TechTreePreloadThread
+		// =====================================================
+
+		class TechTreePreloadThread : public BaseThread {
+		protected:
+			TechTreePreloader *preloader;
+
+		public:
+			explicit TechTreePreloadThread(TechTreePreloader *preloader);
+			virtual ~TechTreePreloadThread();
+			virtual void execute();
+			virtual bool canShutdown(bool deleteSelfIfShutdownDelayed = false);
+		};
+
+		// =====================================================
+		//	class TechTreePreloader
+		//
+		///	Parses and hashes the xml files of the factions on
+		///	worker threads while the main thread loads them one
+		///	after the other. The main thread takes the finished
+		///	trees from XmlPreloadCache and still creates all
+		///	textures, models and sounds itself, so the loaded
+		///	tech tree and its checksums are the same as before.
+		// =====================================================
+
+		class TechTreePreloader {
+		private:
+			::Shared::Platform::Mutex *mutexJobs;
+			vector<TechTreePreloadJob> jobList;
+			unsigned int nextJobIndex;
+			vector<TechTreePreloadThread *> threadList;
+
+			void addJob(const string &path, const std::map<string, string> &mapExtraTagReplacementValues, bool checksumFile);
+
+		public:
+			TechTreePreloader();
+			~TechTreePreloader();
+
+			// a worker for each spare core, at most eight
+			static int getDefaultThreadCount();
+
+			// queues the files FactionType::load reads, in the same order
+			void addFaction(const string &techTreePath, const string &factionName);
+			void start(int threadCount);
+			// stops the workers and drops what was not used
+			void stop();
+
+			// called by the workers, takes jobs until none are left
+			void runJobs(BaseThread *thread);
+		};
+
+	}
+}//end namespace
+
+#endif
@@ -36,6 +36,7 @@
 #include "faction.h"
 #include "command.h"
 #include "map_preview.h"
+#include "path_abstraction.h"
 #include "world.h"
 #include "byte_order.h"
 #include "leak_dumper.h"
@@ -130,6 +131,34 @@ namespace Glest {
 			}
 		}
 
+		// =====================================================
+		// 	class VisibilityPlanes
+		// =====================================================
+
+		void VisibilityPlanes::init(int cellCount) {
+			for (int teamIndex = 0; teamIndex < teamCount; ++teamIndex) {
+				visible[teamIndex].assign(cellCount, 0);
+				explored[teamIndex].assign(cellCount, 0);
+				visibleCount[teamIndex].assign(cellCount, 0);
+			}
+		}
+
+		void VisibilityPlanes::resetVisible(int teamIndex) {
+			vector<uint8> &plane = visible[teamIndex];
+			if (plane.empty() == false) {
+				memset(&plane[0], 0, plane.size());
+			}
+		}
+
+		void VisibilityPlanes::setVisibleFromCounts(int teamIndex) {
+			vector<uint8> &plane = visible[teamIndex];
+			const vector<uint16> &counts = visibleCount[teamIndex];
+			const int cellCount = (int) plane.size();
+			for (int index = 0; index < cellCount; ++index) {
+				plane[index] = (counts[index] != 0);
+			}
+		}
+
 		// =====================================================
 		// 	class SurfaceCell
 		// =====================================================
@@ -142,11 +171,8 @@ namespace Glest {
 			surfaceTexture = NULL;
 			nearSubmerged = false;
 			cellChangedFromOriginalMapLoad = false;
-
-			for (int index = 0; index < GameConstants::maxPlayers + GameConstants::specialFactions; ++index) {
-				setVisible(index, false);
-				setExplored(index, false);
-			}
+			visibilityPlanes = NULL;
+			visibilityIndex = -1;
 		}
 
 		SurfaceCell::~SurfaceCell() {
@@ -188,7 +214,7 @@ namespace Glest {
 				throw megaglest_runtime_error(szBuf);
 			}
 
-			this->explored[teamIndex] = explored;
+			visibilityPlanes->explored[teamIndex][visibilityIndex] = explored;
 			//printf("Setting explored to %d for teamIndex %d\n",explored,teamIndex);
 		}
 
@@ -200,10 +226,10 @@ namespace Glest {
 				throw megaglest_runtime_error(szBuf);
 			}
 
-			this->visible[teamIndex] = visible;
+			visibilityPlanes->visible[teamIndex][visibilityIndex] = visible;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-				SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+				DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096, "In setVisible() teamIndex %d visible %d", teamIndex, visible);
 
@@ -226,17 +252,22 @@ namespace Glest {
 
 		}
 
+		void SurfaceCell::bindVisibilityPlanes(VisibilityPlanes *visibilityPlanes, int visibilityIndex) {
+			this->visibilityPlanes = visibilityPlanes;
+			this->visibilityIndex = visibilityIndex;
+		}
+
 		string SurfaceCell::isVisibleString() const {
 			string result = "isVisibleList = ";
 			for (int index = 0; index < GameConstants::maxPlayers + GameConstants::specialFactions; ++index) {
-				result += string(visible[index] ? "true" : "false");
+				result += string(isVisible(index) ? "true" : "false");
 			}
 			return result;
 		}
 		string SurfaceCell::isExploredString() const {
 			string result = "isExploredList = ";
 			for (int index = 0; index < GameConstants::maxPlayers + GameConstants::specialFactions; ++index) {
-				result += string(explored[index] ? "true" : "false");
+				result += string(isExplored(index) ? "true" : "false");
 			}
 			return result;
 		}
@@ -363,6 +394,14 @@ namespace Glest {
 			surfaceSize = (surfaceW * surfaceH);
 			maxPlayers = 0;
 			maxMapHeight = 0;
+			pathAbstraction = new PathAbstraction(this);
+			for (int field = 0; field < fieldCount; ++field) {
+				walkabilityCache[field] = NULL;
+			}
+			walkabilityCacheSize = 0;
+			walkabilityCacheStatsEnabled = false;
+			walkabilityCacheHits = 0;
+			walkabilityCacheMisses = 0;
 		}
 
 		Map::~Map() {
@@ -374,10 +413,16 @@ namespace Glest {
 			surfaceCells = NULL;
 			delete[] startLocations;
 			startLocations = NULL;
+			delete pathAbstraction;
+			pathAbstraction = NULL;
+			for (int field = 0; field < fieldCount; ++field) {
+				delete[] walkabilityCache[field];
+				walkabilityCache[field] = NULL;
+			}
 		}
 
 		void Map::end() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			Logger::getInstance().add(Lang::getInstance().getString("LogScreenGameUnLoadingMap", "", true), true);
 			//read heightmap
 			for (int j = 0; j < surfaceH; ++j) {
@@ -385,7 +430,7 @@ namespace Glest {
 					getSurfaceCell(i, j)->end();
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		Vec2i Map::getStartLocation(int locationIndex) const {
@@ -494,6 +539,11 @@ namespace Glest {
 					//cells
 					cells = new Cell[getCellArraySize()];
 					surfaceCells = new SurfaceCell[getSurfaceCellArraySize()];
+					visibilityPlanes.init(getSurfaceCellArraySize());
+					unitSpatialIndex.init(w, h);
+					for (int i = 0; i < getSurfaceCellArraySize(); ++i) {
+						surfaceCells[i].bindVisibilityPlanes(&visibilityPlanes, i);
+					}
 
 					//read heightmap
 					for (int j = 0; j < surfaceH; ++j) {
@@ -581,6 +631,7 @@ namespace Glest {
 			computeInterpolatedHeights();
 			computeNearSubmerged();
 			computeCellColors();
+			resetWalkabilityCache();
 		}
 
 
@@ -672,7 +723,7 @@ namespace Glest {
 					if (result.x >= 0) {
 						resourcePos = result;
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 							char szBuf[8096] = "";
 							snprintf(szBuf, 8096, "[found peer harvest pos] pos [%s] resourcePos [%s] unit->getFaction()->getCacheResourceTargetListSize() [%d]",
 								pos.getString().c_str(), resourcePos.getString().c_str(), unit->getFaction()->getCacheResourceTargetListSize());
@@ -776,9 +827,7 @@ namespace Glest {
 			return
 				isInside(pos) &&
 				isInsideSurface(toSurfCoords(pos)) &&
-				getCell(pos)->isFree(field) &&
-				(field == fAir || getSurfaceCell(toSurfCoords(pos))->isFree()) &&
-				(field != fLand || getDeepSubmerged(getCell(pos)) == false);
+				(getWalkabilityFlags(pos, field) & wfCellFree) != 0;
 		}
 
 
@@ -837,7 +886,7 @@ namespace Glest {
 				if (sc->isVisible(teamIndex)) {
 					return isFreeCell(pos, field);
 				} else if (sc->isExplored(teamIndex)) {
-					return field == fLand ? sc->isFree() && !getDeepSubmerged(getCell(pos)) : true;
+					return (getWalkabilityFlags(pos, field) & wfTerrainFree) != 0;
 				} else {
 					return true;
 				}
@@ -935,44 +984,19 @@ namespace Glest {
 		// ==================== unit placement ====================
 
 		//checks if a unit can move from between 2 cells
-		bool Map::canMove(const Unit *unit, const Vec2i &pos1, const Vec2i &pos2, std::map<Vec2i, std::map<Vec2i, std::map<int, std::map<Field, bool> > > > *lookupCache) const {
+		bool Map::canMove(const Unit *unit, const Vec2i &pos1, const Vec2i &pos2) const {
 			int size = unit->getType()->getSize();
 			Field field = unit->getCurrField();
 
-			if (lookupCache != NULL) {
-				std::map<Vec2i, std::map<Vec2i, std::map<int, std::map<Field, bool> > > >::const_iterator iterFind1 = lookupCache->find(pos1);
-				if (iterFind1 != lookupCache->end()) {
-					std::map<Vec2i, std::map<int, std::map<Field, bool> > >::const_iterator iterFind2 = iterFind1->second.find(pos2);
-					if (iterFind2 != iterFind1->second.end()) {
-						std::map<int, std::map<Field, bool> >::const_iterator iterFind3 = iterFind2->second.find(size);
-						if (iterFind3 != iterFind2->second.end()) {
-							std::map<Field, bool>::const_iterator iterFind4 = iterFind3->second.find(field);
-							if (iterFind4 != iterFind3->second.end()) {
-								// Found this result in the cache
-								return iterFind4->second;
-							}
-						}
-					}
-				}
-			}
-
 			for (int i = pos2.x; i < pos2.x + size; ++i) {
 				for (int j = pos2.y; j < pos2.y + size; ++j) {
 					if (isInside(i, j) && isInsideSurface(toSurfCoords(Vec2i(i, j)))) {
 						if (getCell(i, j)->getUnit(field) != unit) {
 							if (isFreeCell(Vec2i(i, j), field) == false) {
-								if (lookupCache != NULL) {
-									(*lookupCache)[pos1][pos2][size][field] = false;
-								}
-
 								return false;
 							}
 						}
 					} else {
-						if (lookupCache != NULL) {
-							(*lookupCache)[pos1][pos2][size][field] = false;
-						}
-
 						return false;
 					}
 				}
@@ -990,22 +1014,14 @@ namespace Glest {
 			//}
 
 			if (isBadHarvestPos == true) {
-				if (lookupCache != NULL) {
-					(*lookupCache)[pos1][pos2][size][field] = false;
-				}
-
 				return false;
 			}
 
-			if (lookupCache != NULL) {
-				(*lookupCache)[pos1][pos2][size][field] = true;
-			}
-
 			return true;
 		}
 
 		//checks if a unit can move from between 2 cells using only visible cells (for pathfinding)
-		bool Map::aproxCanMove(const Unit *unit, const Vec2i &pos1, const Vec2i &pos2, std::map<Vec2i, std::map<Vec2i, std::map<int, std::map<int, std::map<Field, bool> > > > > *lookupCache) const {
+		bool Map::aproxCanMove(const Unit *unit, const Vec2i &pos1, const Vec2i &pos2) const {
 			if (isInside(pos1) == false || isInsideSurface(toSurfCoords(pos1)) == false ||
 				isInside(pos2) == false || isInsideSurface(toSurfCoords(pos2)) == false) {
 
@@ -1020,45 +1036,14 @@ namespace Glest {
 			int teamIndex = unit->getTeam();
 			Field field = unit->getCurrField();
 
-			if (lookupCache != NULL) {
-				std::map<Vec2i, std::map<Vec2i, std::map<int, std::map<int, std::map<Field, bool> > > > >::const_iterator iterFind1 = lookupCache->find(pos1);
-				if (iterFind1 != lookupCache->end()) {
-					std::map<Vec2i, std::map<int, std::map<int, std::map<Field, bool> > > >::const_iterator iterFind2 = iterFind1->second.find(pos2);
-					if (iterFind2 != iterFind1->second.end()) {
-						std::map<int, std::map<int, std::map<Field, bool> > >::const_iterator iterFind3 = iterFind2->second.find(teamIndex);
-						if (iterFind3 != iterFind2->second.end()) {
-							std::map<int, std::map<Field, bool> >::const_iterator iterFind4 = iterFind3->second.find(size);
-							if (iterFind4 != iterFind3->second.end()) {
-								std::map<Field, bool>::const_iterator iterFind5 = iterFind4->second.find(field);
-								if (iterFind5 != iterFind4->second.end()) {
-									// Found this result in the cache
-									if (iterFind5->second == false) {
-										//printf("[%s] Line: %d returning false\n",__FUNCTION__,__LINE__);
-									}
-									return iterFind5->second;
-								}
-							}
-						}
-					}
-				}
-			}
-
 			//single cell units
 			if (size == 1) {
 				if (isAproxFreeCell(pos2, field, teamIndex) == false) {
-					if (lookupCache != NULL) {
-						(*lookupCache)[pos1][pos2][teamIndex][size][field] = false;
-					}
-
 					//printf("[%s] Line: %d returning false\n",__FUNCTION__,__LINE__);
 					return false;
 				}
 				if (pos1.x != pos2.x && pos1.y != pos2.y) {
 					if (isAproxFreeCell(Vec2i(pos1.x, pos2.y), field, teamIndex) == false) {
-						if (lookupCache != NULL) {
-							(*lookupCache)[pos1][pos2][teamIndex][size][field] = false;
-						}
-
 						//Unit *cellUnit = getCell(Vec2i(pos1.x, pos2.y))->getUnit(field);
 						//Object * obj = getSurfaceCell(toSurfCoords(Vec2i(pos1.x, pos2.y)))->getObject();
 
@@ -1067,10 +1052,6 @@ namespace Glest {
 						return false;
 					}
 					if (isAproxFreeCell(Vec2i(pos2.x, pos1.y), field, teamIndex) == false) {
-						if (lookupCache != NULL) {
-							(*lookupCache)[pos1][pos2][teamIndex][size][field] = false;
-						}
-
 						//printf("[%s] Line: %d returning false\n",__FUNCTION__,__LINE__);
 						return false;
 					}
@@ -1088,18 +1069,10 @@ namespace Glest {
 				//}
 
 				if (unit == NULL || isBadHarvestPos == true) {
-					if (lookupCache != NULL) {
-						(*lookupCache)[pos1][pos2][teamIndex][size][field] = false;
-					}
-
 					//printf("[%s] Line: %d returning false\n",__FUNCTION__,__LINE__);
 					return false;
 				}
 
-				if (lookupCache != NULL) {
-					(*lookupCache)[pos1][pos2][teamIndex][size][field] = true;
-				}
-
 				return true;
 			}
 			//multi cell units
@@ -1111,20 +1084,12 @@ namespace Glest {
 						if (isInside(cellPos) && isInsideSurface(toSurfCoords(cellPos))) {
 							if (getCell(cellPos)->getUnit(unit->getCurrField()) != unit) {
 								if (isAproxFreeCell(cellPos, field, teamIndex) == false) {
-									if (lookupCache != NULL) {
-										(*lookupCache)[pos1][pos2][teamIndex][size][field] = false;
-									}
-
 									//printf("[%s] Line: %d returning false\n",__FUNCTION__,__LINE__);
 									return false;
 								}
 							}
 						} else {
 
-							if (lookupCache != NULL) {
-								(*lookupCache)[pos1][pos2][teamIndex][size][field] = false;
-							}
-
 							//printf("[%s] Line: %d returning false\n",__FUNCTION__,__LINE__);
 							return false;
 						}
@@ -1141,17 +1106,10 @@ namespace Glest {
 				}
 
 				if (isBadHarvestPos == true) {
-					if (lookupCache != NULL) {
-						(*lookupCache)[pos1][pos2][teamIndex][size][field] = false;
-					}
-
 					//printf("[%s] Line: %d returning false\n",__FUNCTION__,__LINE__);
 					return false;
 				}
 
-				if (lookupCache != NULL) {
-					(*lookupCache)[pos1][pos2][teamIndex][size][field] = true;
-				}
 			}
 			return true;
 		}
@@ -1422,11 +1380,11 @@ namespace Glest {
 							getCell(currPos)->getUnit(field) == unit) {
 							if (isMorph) {
 								// unit is beeing morphed to another unit with maybe other field.
-								getCell(currPos)->setUnit(field, unit);
+								setCellUnit(currPos, field, unit);
 								canPutInCell = false;
 							}
 							if (canPutInCell == true) {
-								getCell(currPos)->setUnit(unit->getCurrField(), unit);
+								setCellUnit(currPos, unit->getCurrField(), unit);
 							}
 						} else if (canPutInCell == true) {
 							char szBuf[8096] = "";
@@ -1448,6 +1406,26 @@ namespace Glest {
 			if (canPutInCell == true) {
 				unit->setPos(pos, false, threaded);
 			}
+			invalidateWalkability(pos, ut->getSize());
+			if (ut->isMobile() == false) {
+				pathAbstraction->markCellsDirty(pos, ut->getSize());
+			}
+		}
+
+		//sets the unit of a cell field and keeps the unit spatial index in step
+		void Map::setCellUnit(const Vec2i &pos, int field, Unit *unit) {
+			Cell *cell = getCell(pos);
+			Unit *oldUnit = cell->getUnit(field);
+			if (oldUnit == unit) {
+				return;
+			}
+			if (oldUnit != NULL) {
+				unitSpatialIndex.removeUnitCell(pos, field);
+			}
+			cell->setUnit(field, unit);
+			if (unit != NULL) {
+				unitSpatialIndex.addUnitCell(unit, pos, field);
+			}
 		}
 
 		//removes a unit from cells
@@ -1498,7 +1476,7 @@ namespace Glest {
 
 						// Only clear the cell if its the unit we expect to clear out of it
 						if (getCell(currPos)->getUnit(currentField) == unit) {
-							getCell(currPos)->setUnit(currentField, NULL);
+							setCellUnit(currPos, currentField, NULL);
 						}
 					} else if (ut->hasCellMap() == true &&
 						ut->getAllowEmptyCellMap() == true &&
@@ -1512,6 +1490,38 @@ namespace Glest {
 					}
 				}
 			}
+			invalidateWalkability(pos, ut->getSize());
+			if (ut->isMobile() == false) {
+				pathAbstraction->markCellsDirty(pos, ut->getSize());
+			}
+		}
+
+		void Map::invalidateWalkability(const Vec2i &pos, int size) {
+			if (walkabilityCacheSize == 0) {
+				return;
+			}
+			for (int field = 0; field < fieldCount; ++field) {
+				std::atomic<uint8> *cache = walkabilityCache[field];
+				for (int j = std::max(pos.y, 0); j < pos.y + size && j < h; ++j) {
+					for (int i = std::max(pos.x, 0); i < pos.x + size && i < w; ++i) {
+						cache[j * w + i].store(0, std::memory_order_relaxed);
+					}
+				}
+			}
+		}
+
+		void Map::resetWalkabilityCache() {
+			int size = w * h;
+			for (int field = 0; field < fieldCount; ++field) {
+				if (size != walkabilityCacheSize) {
+					delete[] walkabilityCache[field];
+					walkabilityCache[field] = (size > 0 ? new std::atomic<uint8>[size] : NULL);
+				}
+				for (int index = 0; index < size; ++index) {
+					walkabilityCache[field][index].store(0, std::memory_order_relaxed);
+				}
+			}
+			walkabilityCacheSize = size;
 		}
 
 		// ==================== misc ====================
@@ -1586,19 +1596,21 @@ namespace Glest {
 
 		void Map::prepareTerrain(const Unit *unit) {
 			Chrono chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 			flatternTerrain(unit);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			computeNormals();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			computeInterpolatedHeights();
+			//cell heights decide deep water
+			resetWalkabilityCache();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 		}
 
 		// ==================== PRIVATE ====================
@@ -1888,6 +1900,8 @@ namespace Glest {
 				SurfaceCell &surfaceCell = surfaceCells[i];
 				surfaceCell.loadGame(mapNode, i, world);
 			}
+			pathAbstraction->markAllDirty();
+			resetWalkabilityCache();
 
 			int surfaceCellIndexExplored = 0;
 			int surfaceCellIndexVisible = 0;
@@ -36,9 +36,11 @@
 #include "game_constants.h"
 #include "selection.h"
 #include <cassert>
+#include <atomic>
 #include "unit_type.h"
 #include "command.h"
 #include "checksum.h"
+#include "unit_spatial_index.h"
 #include "leak_dumper.h"
 
 
@@ -59,6 +61,7 @@ namespace Glest {
 		class TechTree;
 		class GameSettings;
 		class World;
+		class PathAbstraction;
 
 		// =====================================================
 		// 	class Cell
@@ -138,6 +141,28 @@ namespace Glest {
 			void loadGame(const XmlNode *rootNode, int index, World *world);
 		};
 
+		// =====================================================
+		// 	class VisibilityPlanes
+		//
+		///	Per team visible / explored flags of every surface cell,
+		///	stored one plane per team so a team resets in one pass
+		// =====================================================
+
+		class VisibilityPlanes {
+		public:
+			static const int teamCount = GameConstants::maxPlayers + GameConstants::specialFactions;
+
+			//one byte per surface cell, row major like the surface cells
+			vector<uint8> visible[teamCount];
+			vector<uint8> explored[teamCount];
+			//number of unit sight circles covering each cell (incremental fog of war)
+			vector<uint16> visibleCount[teamCount];
+
+			void init(int cellCount);
+			void resetVisible(int teamIndex);
+			void setVisibleFromCounts(int teamIndex);
+		};
+
 		// =====================================================
 		// 	class SurfaceCell
 		//
@@ -162,9 +187,9 @@ namespace Glest {
 			//object & resource
 			Object *object;
 
-			//visibility
-			bool visible[GameConstants::maxPlayers + GameConstants::specialFactions];
-			bool explored[GameConstants::maxPlayers + GameConstants::specialFactions];
+			//visibility, kept by the map in per team planes
+			VisibilityPlanes *visibilityPlanes;
+			int visibilityIndex;
 
 			//cache
 			bool nearSubmerged;
@@ -211,10 +236,13 @@ namespace Glest {
 			}
 
 			inline bool isVisible(int teamIndex) const {
-				return visible[teamIndex];
+				return visibilityPlanes->visible[teamIndex][visibilityIndex] != 0;
 			}
 			inline bool isExplored(int teamIndex) const {
-				return explored[teamIndex];
+				return visibilityPlanes->explored[teamIndex][visibilityIndex] != 0;
+			}
+			inline int getVisibilityIndex() const {
+				return visibilityIndex;
 			}
 			string isVisibleString() const;
 			string isExploredString() const;
@@ -247,6 +275,7 @@ namespace Glest {
 			}
 			void setExplored(int teamIndex, bool explored);
 			void setVisible(int teamIndex, bool visible);
+			void bindVisibilityPlanes(VisibilityPlanes *visibilityPlanes, int visibilityIndex);
 			inline void setNearSubmerged(bool nearSubmerged) {
 				this->nearSubmerged = nearSubmerged;
 			}
@@ -277,15 +306,6 @@ namespace Glest {
 		///	Represents the game map (and loads it from a gbm file)
 		// =====================================================
 
-		class FastAINodeCache {
-		public:
-			explicit FastAINodeCache(Unit *unit) {
-				this->unit = unit;
-			}
-			Unit *unit;
-			std::map<Vec2i, std::map<Vec2i, bool> > cachedCanMoveSoonList;
-		};
-
 		class Map {
 		public:
 			static const int cellScale;	//number of cells per surfaceCell
@@ -311,6 +331,25 @@ namespace Glest {
 			Checksum checksumValue;
 			float maxMapHeight;
 			string mapFile;
+			PathAbstraction *pathAbstraction;
+			VisibilityPlanes visibilityPlanes;
+			UnitSpatialIndex unitSpatialIndex;
+
+			// walkability of each cell per field, filled on first use and
+			// invalidated when units, objects or heights change. Faction
+			// threads fill it at the same time, so each cell is an atomic
+			// byte; all of them write the same value for a cell
+			enum WalkabilityFlag {
+				wfKnown = 1,
+				wfTerrainFree = 2,
+				wfCellFree = 4
+			};
+			mutable std::atomic<uint8> *walkabilityCache[fieldCount];
+			int walkabilityCacheSize;
+			// only counted while enabled, the shared counters are not free
+			bool walkabilityCacheStatsEnabled;
+			mutable std::atomic<int64> walkabilityCacheHits;
+			mutable std::atomic<int64> walkabilityCacheMisses;
 
 		private:
 			Map(Map&);
@@ -323,6 +362,30 @@ namespace Glest {
 			Checksum * getChecksumValue() {
 				return &checksumValue;
 			}
+			PathAbstraction * getPathAbstraction() const {
+				return pathAbstraction;
+			}
+			VisibilityPlanes * getVisibilityPlanes() {
+				return &visibilityPlanes;
+			}
+			const UnitSpatialIndex * getUnitSpatialIndex() const {
+				return &unitSpatialIndex;
+			}
+			inline int64 getWalkabilityCacheHits() const {
+				return walkabilityCacheHits.load(std::memory_order_relaxed);
+			}
+			inline int64 getWalkabilityCacheMisses() const {
+				return walkabilityCacheMisses.load(std::memory_order_relaxed);
+			}
+			void setWalkabilityCacheStatsEnabled(bool value) {
+				walkabilityCacheStatsEnabled = value;
+			}
+			void resetWalkabilityCacheStats() {
+				walkabilityCacheHits.store(0, std::memory_order_relaxed);
+				walkabilityCacheMisses.store(0, std::memory_order_relaxed);
+			}
+			void invalidateWalkability(const Vec2i &pos, int size);
+			void resetWalkabilityCache();
 
 			void init(Tileset *tileset);
 			Checksum load(const string &path, TechTree *techTree, Tileset *tileset);
@@ -442,8 +505,8 @@ namespace Glest {
 			//bool canOccupy(const Vec2i &pos, Field field, const UnitType *ut, CardinalDir facing);
 
 			//unit placement
-			bool aproxCanMove(const Unit *unit, const Vec2i &pos1, const Vec2i &pos2, std::map<Vec2i, std::map<Vec2i, std::map<int, std::map<int, std::map<Field, bool> > > > > *lookupCache = NULL) const;
-			bool canMove(const Unit *unit, const Vec2i &pos1, const Vec2i &pos2, std::map<Vec2i, std::map<Vec2i, std::map<int, std::map<Field, bool> > > > *lookupCache = NULL) const;
+			bool aproxCanMove(const Unit *unit, const Vec2i &pos1, const Vec2i &pos2) const;
+			bool canMove(const Unit *unit, const Vec2i &pos1, const Vec2i &pos2) const;
 			void putUnitCells(Unit *unit, const Vec2i &pos, bool ignoreSkill = false, bool threaded = false);
 			void clearUnitCells(Unit *unit, const Vec2i &pos, bool ignoreSkill = false);
 
@@ -476,13 +539,44 @@ namespace Glest {
 				return surfPos * cellScale;
 			}
 
+			//pos must be inside the map and its surface
+			inline uint8 getWalkabilityFlags(const Vec2i &pos, Field field) const {
+				std::atomic<uint8> *cache = walkabilityCache[field];
+				int index = pos.y * w + pos.x;
+				if (index < walkabilityCacheSize) {
+					uint8 cachedFlags = cache[index].load(std::memory_order_relaxed);
+					if ((cachedFlags & wfKnown) != 0) {
+						if (walkabilityCacheStatsEnabled == true) {
+							walkabilityCacheHits.fetch_add(1, std::memory_order_relaxed);
+						}
+						return cachedFlags;
+					}
+				}
+				if (walkabilityCacheStatsEnabled == true) {
+					walkabilityCacheMisses.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				const Cell *cell = getCell(pos);
+				uint8 flags = wfKnown;
+				if ((field == fAir || getSurfaceCell(toSurfCoords(pos))->isFree()) &&
+					(field != fLand || getDeepSubmerged(cell) == false)) {
+					flags |= wfTerrainFree;
+					if (cell->isFree(field) == true) {
+						flags |= wfCellFree;
+					}
+				}
+				if (index < walkabilityCacheSize) {
+					cache[index].store(flags, std::memory_order_relaxed);
+				}
+				return flags;
+			}
+
 			inline bool isFreeCellOrMightBeFreeSoon(Vec2i originPos, const Vec2i &pos, Field field) const {
 				return
 					isInside(pos) &&
 					isInsideSurface(toSurfCoords(pos)) &&
-					getCell(pos)->isFreeOrMightBeFreeSoon(originPos, pos, field) &&
-					(field == fAir || getSurfaceCell(toSurfCoords(pos))->isFree()) &&
-					(field != fLand || getDeepSubmerged(getCell(pos)) == false);
+					(getWalkabilityFlags(pos, field) & wfTerrainFree) != 0 &&
+					getCell(pos)->isFreeOrMightBeFreeSoon(originPos, pos, field);
 			}
 
 			inline bool isAproxFreeCellOrMightBeFreeSoon(Vec2i originPos, const Vec2i &pos, Field field, int teamIndex) const {
@@ -492,7 +586,7 @@ namespace Glest {
 					if (sc->isVisible(teamIndex)) {
 						return isFreeCellOrMightBeFreeSoon(originPos, pos, field);
 					} else if (sc->isExplored(teamIndex)) {
-						return field == fLand ? sc->isFree() && !getDeepSubmerged(getCell(pos)) : true;
+						return (getWalkabilityFlags(pos, field) & wfTerrainFree) != 0;
 					} else {
 						return true;
 					}
@@ -508,8 +602,8 @@ namespace Glest {
 					isInside(pos2) == false || isInsideSurface(toSurfCoords(pos2)) == false) {
 
 					//printf("[%s] Line: %d returning false\n",__FUNCTION__,__LINE__);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-						SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+						DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "In aproxCanMoveSoon() return false");
 						if (Thread::isCurrentThreadMainThread() == false) {
@@ -534,8 +628,8 @@ namespace Glest {
 				if (size == 1) {
 					bool tryPosResult = isAproxFreeCellOrMightBeFreeSoon(unit->getPosNotThreadSafe(), pos2, field, teamIndex);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-						SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+						DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 						string extraInfo = (string("tryPosResult = ") + (tryPosResult ? string("true") : string("false")));
 						const SurfaceCell *sc = getSurfaceCell(toSurfCoords(pos2));
 						if (sc->isVisible(teamIndex)) {
@@ -562,8 +656,8 @@ namespace Glest {
 						Vec2i tryPos = Vec2i(pos1.x, pos2.y);
 						bool tryPosResult = isAproxFreeCellOrMightBeFreeSoon(unit->getPosNotThreadSafe(), tryPos, field, teamIndex);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-							SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+							DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 							string extraInfo = (string("tryPosResult = ") + (tryPosResult ? string("true") : string("false")));
 							const SurfaceCell *sc = getSurfaceCell(toSurfCoords(tryPos));
 							if (sc->isVisible(teamIndex)) {
@@ -590,8 +684,8 @@ namespace Glest {
 						tryPos = Vec2i(pos2.x, pos1.y);
 						tryPosResult = isAproxFreeCellOrMightBeFreeSoon(unit->getPosNotThreadSafe(), tryPos, field, teamIndex);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-							SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+							DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 							string extraInfo = (string("tryPosResult = ") + (tryPosResult ? string("true") : string("false")));
 							const SurfaceCell *sc = getSurfaceCell(toSurfCoords(tryPos));
 							if (sc->isVisible(teamIndex)) {
@@ -627,8 +721,8 @@ namespace Glest {
 					}
 
 					if (unit == NULL || isBadHarvestPos == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-							SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+							DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 							char szBuf[8096] = "";
 							snprintf(szBuf, 8096, "In aproxCanMoveSoon() return false");
 							if (Thread::isCurrentThreadMainThread() == false) {
@@ -652,8 +746,8 @@ namespace Glest {
 							if (isInside(cellPos) && isInsideSurface(toSurfCoords(cellPos))) {
 								if (getCell(cellPos)->getUnit(unit->getCurrField()) != unit) {
 									if (isAproxFreeCellOrMightBeFreeSoon(unit->getPosNotThreadSafe(), cellPos, field, teamIndex) == false) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-											SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+											DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 											char szBuf[8096] = "";
 											snprintf(szBuf, 8096, "In aproxCanMoveSoon() return false");
 											if (Thread::isCurrentThreadMainThread() == false) {
@@ -667,8 +761,8 @@ namespace Glest {
 									}
 								}
 							} else {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-									SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+									DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 									char szBuf[8096] = "";
 									snprintf(szBuf, 8096, "In aproxCanMoveSoon() return false");
 									if (Thread::isCurrentThreadMainThread() == false) {
@@ -693,8 +787,8 @@ namespace Glest {
 					}
 
 					if (isBadHarvestPos == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-							SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+							DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 							char szBuf[8096] = "";
 							snprintf(szBuf, 8096, "In aproxCanMoveSoon() return false");
 							if (Thread::isCurrentThreadMainThread() == false) {
@@ -724,6 +818,7 @@ namespace Glest {
 			void computeNearSubmerged();
 			void computeCellColors();
 			void putUnitCellsPrivate(Unit *unit, const Vec2i &pos, const UnitType *ut, bool isMorph, bool threaded);
+			void setCellUnit(const Vec2i &pos, int field, Unit *unit);
 		};
 
 
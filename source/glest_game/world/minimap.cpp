@@ -46,19 +46,19 @@ namespace Glest {
 		}
 
 		void Minimap::init(int w, int h, const World *world, bool fogOfWar) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			int scaledW = w / Map::cellScale;
 			int scaledH = h / Map::cellScale;
 			int potW = next2Power(scaledW);
 			int potH = next2Power(scaledH);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scaledW = %d, scaledH = %d, potW = %d, potH = %d\n", __FILE__, __FUNCTION__, __LINE__, scaledW, scaledH, potW, potH);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scaledW = %d, scaledH = %d, potW = %d, potH = %d\n", __FILE__, __FUNCTION__, __LINE__, scaledW, scaledH, potW, potH);
 
 			this->fogOfWar = fogOfWar;
 			this->gameSettings = world->getGameSettings();
 			Renderer &renderer = Renderer::getInstance();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			//fow pixmaps
 			float f = 0.f;
 
@@ -70,7 +70,7 @@ namespace Glest {
 				fowPixmap1Copy = new Pixmap2D(potW, potH, 1);
 				fowPixmap1Copy_default = new Pixmap2D(potW, potH, 1);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				fowPixmap0->setPixels(&f, 1);
 				if ((this->gameSettings->getFlagTypes1() & ft1_show_map_resources) == ft1_show_map_resources) {
@@ -87,7 +87,7 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//fow tex
 			fowTex = renderer.newTexture2D(rsGame);
@@ -96,13 +96,13 @@ namespace Glest {
 				fowTex->setPixmapInit(false);
 				fowTex->setFormat(Texture::fAlpha);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scaledW = %d, scaledH = %d, potW = %d, potH = %d\n", __FILE__, __FUNCTION__, __LINE__, scaledW, scaledH, potW, potH);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scaledW = %d, scaledH = %d, potW = %d, potH = %d\n", __FILE__, __FUNCTION__, __LINE__, scaledW, scaledH, potW, potH);
 
 				fowTex->getPixmap()->init(potW, potH, 1);
 				fowTex->getPixmap()->setPixels(&f, 1);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//tex
 			tex = renderer.newTexture2D(rsGame);
@@ -111,7 +111,7 @@ namespace Glest {
 				tex->setMipmap(false);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			computeTexture(world);
 		}
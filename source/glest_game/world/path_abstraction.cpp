@@ -0,0 +1,501 @@
+//
+//	path_abstraction.cpp:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#include "path_abstraction.h"
+
+#include <algorithm>
+#include <functional>
+
+#include "map.h"
+#include "unit.h"
+#include "unit_type.h"
+#include "platform_common.h"
+#include "thread.h"
+#include "leak_dumper.h"
+
+using namespace Shared::PlatformCommon;
+using Shared::Platform::Thread;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		// 	class PathAbstraction
+		// =====================================================
+
+		const int PathAbstraction::clusterSize = 16;
+		const int PathAbstraction::straightCost = 10;
+		const int PathAbstraction::diagonalCost = 14;
+
+		//border runs at least this long get an entrance at each end
+		static const int longEntranceLength = 6;
+
+		PathAbstraction::PathAbstraction(const Map *map) {
+			this->map = map;
+			w = 0;
+			h = 0;
+			clusterW = 0;
+			clusterH = 0;
+			for (int field = 0; field < fieldCount; ++field) {
+				anyDirty[field] = true;
+			}
+		}
+
+		void PathAbstraction::init() {
+			w = map->getW();
+			h = map->getH();
+			clusterW = (w + clusterSize - 1) / clusterSize;
+			clusterH = (h + clusterSize - 1) / clusterSize;
+
+			for (int field = 0; field < fieldCount; ++field) {
+				clusters[field].clear();
+				clusters[field].resize(clusterW * clusterH);
+				nodeAtCell[field].assign(w * h, -1);
+				anyDirty[field] = true;
+			}
+		}
+
+		void PathAbstraction::markCellsDirty(const Vec2i &pos, int size) {
+			if (w == 0 || h == 0) {
+				//nothing built yet
+				return;
+			}
+
+			for (int i = pos.x; i < pos.x + size; ++i) {
+				for (int j = pos.y; j < pos.y + size; ++j) {
+					if (i >= 0 && j >= 0 && i < w && j < h) {
+						int clusterIndex = getClusterIndex(Vec2i(i, j));
+						for (int field = 0; field < fieldCount; ++field) {
+							clusters[field][clusterIndex].dirty = true;
+							anyDirty[field] = true;
+						}
+					}
+				}
+			}
+		}
+
+		void PathAbstraction::markAllDirty() {
+			for (int field = 0; field < fieldCount; ++field) {
+				for (unsigned int index = 0; index < clusters[field].size(); ++index) {
+					clusters[field][index].dirty = true;
+				}
+				anyDirty[field] = true;
+			}
+		}
+
+		// Rebuilds whatever changed since the last call. The world calls this
+		// before the faction pathfinding threads start so they never see a
+		// graph that is being repaired.
+		void PathAbstraction::update() {
+			if (w != map->getW() || h != map->getH()) {
+				init();
+			}
+			for (int field = 0; field < fieldCount; ++field) {
+				repair(static_cast<Field>(field));
+			}
+		}
+
+		//mobile units are ignored, the local search steers around them
+		bool PathAbstraction::isWalkable(int x, int y, Field field) const {
+			if (map->isInside(x, y) == false) {
+				return false;
+			}
+			Vec2i pos(x, y);
+			Vec2i surfPos = Map::toSurfCoords(pos);
+			if (map->isInsideSurface(surfPos) == false) {
+				return false;
+			}
+
+			const Cell *cell = map->getCell(pos);
+			if (field == fLand) {
+				if (map->getSurfaceCell(surfPos)->isFree() == false ||
+					map->getDeepSubmerged(cell) == true) {
+					return false;
+				}
+			}
+			const Unit *unit = cell->getUnit(field);
+			return (unit == NULL || unit->getType()->isMobile() == true);
+		}
+
+		void PathAbstraction::getClusterBounds(int clusterIndex, int &x0, int &y0, int &x1, int &y1) const {
+			x0 = (clusterIndex % clusterW) * clusterSize;
+			y0 = (clusterIndex / clusterW) * clusterSize;
+			x1 = std::min(x0 + clusterSize, w) - 1;
+			y1 = std::min(y0 + clusterSize, h) - 1;
+		}
+
+		// Finds the open runs along the border of two neighbour clusters. Always
+		// called with the top / left cluster first so both sides see the same runs.
+		void PathAbstraction::addBorderEntrances(Field field, int clusterIndex, int neighbourIndex, bool vertical,
+			vector<pair<Vec2i, Vec2i> > &entrances) const {
+			int x0, y0, x1, y1;
+			getClusterBounds(clusterIndex, x0, y0, x1, y1);
+
+			int start = (vertical ? x0 : y0);
+			int end = (vertical ? x1 : y1);
+			int runStart = -1;
+			for (int k = start; k <= end + 1; ++k) {
+				bool open = false;
+				if (k <= end) {
+					if (vertical) {
+						open = isWalkable(k, y1, field) && isWalkable(k, y1 + 1, field);
+					} else {
+						open = isWalkable(x1, k, field) && isWalkable(x1 + 1, k, field);
+					}
+				}
+
+				if (open == true) {
+					if (runStart < 0) {
+						runStart = k;
+					}
+				} else if (runStart >= 0) {
+					int runEnd = k - 1;
+					vector<int> transitions;
+					if (runEnd - runStart + 1 >= longEntranceLength) {
+						transitions.push_back(runStart);
+						transitions.push_back(runEnd);
+					} else {
+						transitions.push_back((runStart + runEnd) / 2);
+					}
+					for (unsigned int index = 0; index < transitions.size(); ++index) {
+						int t = transitions[index];
+						if (vertical) {
+							entrances.push_back(make_pair(Vec2i(t, y1), Vec2i(t, y1 + 1)));
+						} else {
+							entrances.push_back(make_pair(Vec2i(x1, t), Vec2i(x1 + 1, t)));
+						}
+					}
+					runStart = -1;
+				}
+			}
+		}
+
+		int PathAbstraction::addNode(Field field, int clusterIndex, const Vec2i &pos) {
+			int cellIndex = pos.y * w + pos.x;
+			int nodeIndex = nodeAtCell[field][cellIndex];
+			if (nodeIndex < 0) {
+				vector<AbstractNode> &nodes = clusters[field][clusterIndex].nodes;
+				nodeIndex = (int) nodes.size();
+				nodes.push_back(AbstractNode());
+				nodes.back().pos = pos;
+				nodeAtCell[field][cellIndex] = nodeIndex;
+			}
+			return nodeIndex;
+		}
+
+		void PathAbstraction::repair(Field field) {
+			if (anyDirty[field] == false) {
+				return;
+			}
+
+			vector<Cluster> &clusterList = clusters[field];
+			int clusterCount = (int) clusterList.size();
+
+			//a dirty cluster changes the border nodes of its neighbours too
+			vector<bool> rebuild(clusterCount, false);
+			for (int index = 0; index < clusterCount; ++index) {
+				if (clusterList[index].dirty == true) {
+					int cx = index % clusterW;
+					int cy = index / clusterW;
+					rebuild[index] = true;
+					if (cx > 0) rebuild[index - 1] = true;
+					if (cx < clusterW - 1) rebuild[index + 1] = true;
+					if (cy > 0) rebuild[index - clusterW] = true;
+					if (cy < clusterH - 1) rebuild[index + clusterW] = true;
+				}
+			}
+
+			for (int index = 0; index < clusterCount; ++index) {
+				if (rebuild[index] == true) {
+					vector<AbstractNode> &nodes = clusterList[index].nodes;
+					for (unsigned int nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+						nodeAtCell[field][nodes[nodeIndex].pos.y * w + nodes[nodeIndex].pos.x] = -1;
+					}
+					nodes.clear();
+				}
+			}
+
+			// Each rebuilt cluster only adds its own side of a border, the other
+			// side is either rebuilt the same way or still holds its old nodes.
+			for (int index = 0; index < clusterCount; ++index) {
+				if (rebuild[index] == false) {
+					continue;
+				}
+				int cx = index % clusterW;
+				int cy = index / clusterW;
+
+				vector<pair<Vec2i, Vec2i> > entrances;
+				vector<bool> ownSideFirst;
+				if (cx > 0) {
+					addBorderEntrances(field, index - 1, index, false, entrances);
+					ownSideFirst.resize(entrances.size(), false);
+				}
+				if (cy > 0) {
+					addBorderEntrances(field, index - clusterW, index, true, entrances);
+					ownSideFirst.resize(entrances.size(), false);
+				}
+				if (cx < clusterW - 1) {
+					addBorderEntrances(field, index, index + 1, false, entrances);
+					ownSideFirst.resize(entrances.size(), true);
+				}
+				if (cy < clusterH - 1) {
+					addBorderEntrances(field, index, index + clusterW, true, entrances);
+					ownSideFirst.resize(entrances.size(), true);
+				}
+
+				for (unsigned int entranceIndex = 0; entranceIndex < entrances.size(); ++entranceIndex) {
+					const Vec2i &ownPos = (ownSideFirst[entranceIndex] ? entrances[entranceIndex].first : entrances[entranceIndex].second);
+					const Vec2i &otherPos = (ownSideFirst[entranceIndex] ? entrances[entranceIndex].second : entrances[entranceIndex].first);
+					int nodeIndex = addNode(field, index, ownPos);
+					clusterList[index].nodes[nodeIndex].links.push_back(otherPos.y * w + otherPos.x);
+				}
+			}
+
+			for (int index = 0; index < clusterCount; ++index) {
+				if (rebuild[index] == true) {
+					computeClusterEdges(field, index);
+					clusterList[index].dirty = false;
+				}
+			}
+			anyDirty[field] = false;
+		}
+
+		void PathAbstraction::computeClusterEdges(Field field, int clusterIndex) {
+			vector<AbstractNode> &nodes = clusters[field][clusterIndex].nodes;
+			for (unsigned int nodeIndex = 0; nodeIndex < nodes.size(); ++nodeIndex) {
+				nodes[nodeIndex].edges.clear();
+				searchCluster(field, clusterIndex, nodes[nodeIndex].pos, repairSearch);
+
+				for (unsigned int otherIndex = 0; otherIndex < nodes.size(); ++otherIndex) {
+					if (otherIndex != nodeIndex) {
+						int cost = getLocalCost(clusterIndex, nodes[otherIndex].pos, repairSearch);
+						if (cost >= 0) {
+							nodes[nodeIndex].edges.push_back(make_pair((int) otherIndex, cost));
+						}
+					}
+				}
+			}
+		}
+
+		inline int PathAbstraction::getLocalCost(int clusterIndex, const Vec2i &pos, const SearchState &search) const {
+			int x0 = (clusterIndex % clusterW) * clusterSize;
+			int y0 = (clusterIndex / clusterW) * clusterSize;
+			return search.localCost[(pos.y - y0) * clusterSize + (pos.x - x0)];
+		}
+
+		// Dijkstra from fromPos limited to one cluster, moving the same way a single
+		// cell unit does (diagonals need both orthogonal cells free). The start cell
+		// itself may be blocked, e.g. when it is the target building.
+		void PathAbstraction::searchCluster(Field field, int clusterIndex, const Vec2i &fromPos, SearchState &search) const {
+			int x0, y0, x1, y1;
+			getClusterBounds(clusterIndex, x0, y0, x1, y1);
+
+			vector<int> &localCost = search.localCost;
+			vector<pair<int, int> > &localHeap = search.localHeap;
+			localCost.assign(clusterSize * clusterSize, -1);
+			localHeap.clear();
+
+			int startIndex = (fromPos.y - y0) * clusterSize + (fromPos.x - x0);
+			localCost[startIndex] = 0;
+			localHeap.push_back(make_pair(0, startIndex));
+
+			while (localHeap.empty() == false) {
+				std::pop_heap(localHeap.begin(), localHeap.end(), std::greater<pair<int, int> >());
+				pair<int, int> current = localHeap.back();
+				localHeap.pop_back();
+				if (current.first != localCost[current.second]) {
+					continue;
+				}
+
+				int x = x0 + current.second % clusterSize;
+				int y = y0 + current.second / clusterSize;
+				for (int i = -1; i <= 1; ++i) {
+					for (int j = -1; j <= 1; ++j) {
+						int nx = x + i;
+						int ny = y + j;
+						if ((i == 0 && j == 0) || nx < x0 || ny < y0 || nx > x1 || ny > y1) {
+							continue;
+						}
+						if (isWalkable(nx, ny, field) == false) {
+							continue;
+						}
+						if (i != 0 && j != 0 &&
+							(isWalkable(x, ny, field) == false || isWalkable(nx, y, field) == false)) {
+							continue;
+						}
+
+						int cost = current.first + (i != 0 && j != 0 ? diagonalCost : straightCost);
+						int index = (ny - y0) * clusterSize + (nx - x0);
+						if (localCost[index] < 0 || cost < localCost[index]) {
+							localCost[index] = cost;
+							localHeap.push_back(make_pair(cost, index));
+							std::push_heap(localHeap.begin(), localHeap.end(), std::greater<pair<int, int> >());
+						}
+					}
+				}
+			}
+		}
+
+		// Searches the abstract graph and returns the entrance cells to cross from
+		// fromPos to toPos, ending with toPos. Returns false when both positions are
+		// in the same cluster or no route exists through the abstract graph.
+		// Only the main thread repairs the graph here, the pathfinding threads
+		// rely on the world having updated it before they started.
+		bool PathAbstraction::findAbstractPath(Field field, const Vec2i &fromPos, const Vec2i &toPos, vector<Vec2i> &waypoints, SearchState &search) {
+			waypoints.clear();
+
+			if (Thread::isCurrentThreadMainThread() == true) {
+				update();
+			}
+			if (w != map->getW() || h != map->getH() || anyDirty[field] == true) {
+				return false;
+			}
+			if (map->isInside(fromPos) == false || map->isInside(toPos) == false) {
+				return false;
+			}
+
+			int fromCluster = getClusterIndex(fromPos);
+			int toCluster = getClusterIndex(toPos);
+			if (fromCluster == toCluster) {
+				return false;
+			}
+
+			//one extra slot for the goal of the abstract search
+			vector<uint32> &cellGeneration = search.cellGeneration;
+			vector<int> &cellCost = search.cellCost;
+			vector<int> &cellParent = search.cellParent;
+			vector<pair<int, int> > &openHeap = search.openHeap;
+			if (cellGeneration.size() != (size_t) (w * h + 1)) {
+				search.searchGeneration = 0;
+				cellGeneration.assign(w * h + 1, 0);
+				cellCost.assign(w * h + 1, 0);
+				cellParent.assign(w * h + 1, -1);
+			}
+
+			search.searchGeneration++;
+			if (search.searchGeneration == 0) {
+				std::fill(cellGeneration.begin(), cellGeneration.end(), 0);
+				search.searchGeneration = 1;
+			}
+			const uint32 searchGeneration = search.searchGeneration;
+
+			const vector<Cluster> &clusterList = clusters[field];
+			const vector<AbstractNode> &goalNodes = clusterList[toCluster].nodes;
+			searchCluster(field, toCluster, toPos, search);
+			vector<int> goalCosts(goalNodes.size(), -1);
+			for (unsigned int nodeIndex = 0; nodeIndex < goalNodes.size(); ++nodeIndex) {
+				goalCosts[nodeIndex] = getLocalCost(toCluster, goalNodes[nodeIndex].pos, search);
+			}
+
+			const int goalSlot = w * h;
+			openHeap.clear();
+
+			const vector<AbstractNode> &startNodes = clusterList[fromCluster].nodes;
+			searchCluster(field, fromCluster, fromPos, search);
+			for (unsigned int nodeIndex = 0; nodeIndex < startNodes.size(); ++nodeIndex) {
+				const Vec2i &pos = startNodes[nodeIndex].pos;
+				int cost = getLocalCost(fromCluster, pos, search);
+				if (cost >= 0) {
+					int cellIndex = pos.y * w + pos.x;
+					cellGeneration[cellIndex] = searchGeneration;
+					cellCost[cellIndex] = cost;
+					cellParent[cellIndex] = -1;
+
+					int dx = abs(pos.x - toPos.x);
+					int dy = abs(pos.y - toPos.y);
+					int estimate = straightCost * abs(dx - dy) + diagonalCost * std::min(dx, dy);
+					openHeap.push_back(make_pair(cost + estimate, cellIndex));
+					std::push_heap(openHeap.begin(), openHeap.end(), std::greater<pair<int, int> >());
+				}
+			}
+
+			bool found = false;
+			while (openHeap.empty() == false) {
+				std::pop_heap(openHeap.begin(), openHeap.end(), std::greater<pair<int, int> >());
+				pair<int, int> current = openHeap.back();
+				openHeap.pop_back();
+
+				int cellIndex = current.second;
+				if (cellIndex == goalSlot) {
+					found = true;
+					break;
+				}
+
+				Vec2i pos(cellIndex % w, cellIndex / w);
+				int dx = abs(pos.x - toPos.x);
+				int dy = abs(pos.y - toPos.y);
+				int estimate = straightCost * abs(dx - dy) + diagonalCost * std::min(dx, dy);
+				if (current.first != cellCost[cellIndex] + estimate) {
+					//stale heap entry
+					continue;
+				}
+
+				int clusterIndex = getClusterIndex(pos);
+				int nodeIndex = nodeAtCell[field][cellIndex];
+				const AbstractNode &node = clusterList[clusterIndex].nodes[nodeIndex];
+
+				vector<pair<int, int> > successors;
+				if (clusterIndex == toCluster && goalCosts[nodeIndex] >= 0) {
+					successors.push_back(make_pair(goalSlot, goalCosts[nodeIndex]));
+				}
+				for (unsigned int edgeIndex = 0; edgeIndex < node.edges.size(); ++edgeIndex) {
+					const Vec2i &edgePos = clusterList[clusterIndex].nodes[node.edges[edgeIndex].first].pos;
+					successors.push_back(make_pair(edgePos.y * w + edgePos.x, node.edges[edgeIndex].second));
+				}
+				for (unsigned int linkIndex = 0; linkIndex < node.links.size(); ++linkIndex) {
+					successors.push_back(make_pair(node.links[linkIndex], straightCost));
+				}
+
+				for (unsigned int index = 0; index < successors.size(); ++index) {
+					int nextIndex = successors[index].first;
+					int nextCost = cellCost[cellIndex] + successors[index].second;
+					if (cellGeneration[nextIndex] != searchGeneration || nextCost < cellCost[nextIndex]) {
+						cellGeneration[nextIndex] = searchGeneration;
+						cellCost[nextIndex] = nextCost;
+						cellParent[nextIndex] = cellIndex;
+
+						int nextEstimate = 0;
+						if (nextIndex != goalSlot) {
+							int ndx = abs(nextIndex % w - toPos.x);
+							int ndy = abs(nextIndex / w - toPos.y);
+							nextEstimate = straightCost * abs(ndx - ndy) + diagonalCost * std::min(ndx, ndy);
+						}
+						openHeap.push_back(make_pair(nextCost + nextEstimate, nextIndex));
+						std::push_heap(openHeap.begin(), openHeap.end(), std::greater<pair<int, int> >());
+					}
+				}
+			}
+
+			if (found == false) {
+				return false;
+			}
+
+			waypoints.push_back(toPos);
+			for (int cellIndex = cellParent[goalSlot]; cellIndex >= 0; cellIndex = cellParent[cellIndex]) {
+				waypoints.push_back(Vec2i(cellIndex % w, cellIndex / w));
+			}
+			std::reverse(waypoints.begin(), waypoints.end());
+			return true;
+		}
+
+	}
+} //end namespace
@@ -0,0 +1,147 @@
+//
+//	path_abstraction.h:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#ifndef _GLEST_GAME_PATH_ABSTRACTION_H_
+#define _GLEST_GAME_PATH_ABSTRACTION_H_
+
+#ifdef WIN32
+#include <winsock2.h>
+#include <winsock.h>
+#endif
+
+#include <vector>
+#include "vec.h"
+#include "data_types.h"
+#include "skill_type.h"
+#include "leak_dumper.h"
+
+using std::vector;
+using std::pair;
+using Shared::Graphics::Vec2i;
+using Shared::Platform::uint32;
+
+namespace Glest {
+	namespace Game {
+
+		class Map;
+
+		// =====================================================
+		// 	class PathAbstraction
+		//
+		///	Hierarchical (HPA*) view of the map for long unit paths.
+		///	The map is split in clusters, the entrances between
+		///	neighbour clusters become the nodes of an abstract graph
+		///	which is repaired per cluster when cells change.
+		// =====================================================
+
+		class PathAbstraction {
+		public:
+			static const int clusterSize;
+			static const int straightCost;
+			static const int diagonalCost;
+
+			// Scratch of one abstract search. Each caller that may search at
+			// the same time as another one owns its own.
+			class SearchState {
+			public:
+				SearchState() {
+					searchGeneration = 0;
+				}
+
+				//stamped per search so nothing is cleared
+				uint32 searchGeneration;
+				vector<uint32> cellGeneration;
+				vector<int> cellCost;
+				vector<int> cellParent;
+				vector<pair<int, int> > openHeap;
+
+				//cluster local search
+				vector<int> localCost;
+				vector<pair<int, int> > localHeap;
+			};
+
+		private:
+			class AbstractNode {
+			public:
+				Vec2i pos;
+				//cell indexes of the entrances on the other side of a border
+				vector<int> links;
+				//local node index and cost within the same cluster
+				vector<pair<int, int> > edges;
+			};
+
+			class Cluster {
+			public:
+				Cluster() {
+					dirty = true;
+				}
+				vector<AbstractNode> nodes;
+				bool dirty;
+			};
+
+			const Map *map;
+			int w;
+			int h;
+			int clusterW;
+			int clusterH;
+			bool anyDirty[fieldCount];
+
+			vector<Cluster> clusters[fieldCount];
+			//local node index per cell or -1
+			vector<int> nodeAtCell[fieldCount];
+
+			SearchState repairSearch;
+
+		private:
+			PathAbstraction(const PathAbstraction &);
+			void operator=(const PathAbstraction &);
+
+			void init();
+			bool isWalkable(int x, int y, Field field) const;
+			inline int getClusterIndex(const Vec2i &pos) const {
+				return (pos.y / clusterSize) * clusterW + (pos.x / clusterSize);
+			}
+			void getClusterBounds(int clusterIndex, int &x0, int &y0, int &x1, int &y1) const;
+
+			void repair(Field field);
+			void addBorderEntrances(Field field, int clusterIndex, int neighbourIndex, bool vertical, vector<pair<Vec2i, Vec2i> > &entrances) const;
+			int addNode(Field field, int clusterIndex, const Vec2i &pos);
+			void computeClusterEdges(Field field, int clusterIndex);
+			void searchCluster(Field field, int clusterIndex, const Vec2i &fromPos, SearchState &search) const;
+			inline int getLocalCost(int clusterIndex, const Vec2i &pos, const SearchState &search) const;
+
+		public:
+			PathAbstraction(const Map *map);
+
+			// The graph is only changed from the main thread, the faction
+			// pathfinding threads search it while it stays unchanged.
+			void markCellsDirty(const Vec2i &pos, int size);
+			void markAllDirty();
+			void update();
+
+			bool findAbstractPath(Field field, const Vec2i &fromPos, const Vec2i &toPos, vector<Vec2i> &waypoints, SearchState &search);
+		};
+
+	}
+} //end namespace
+
+#endif
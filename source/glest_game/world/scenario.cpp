@@ -113,8 +113,7 @@ namespace Glest {
 					extractFileFromDirectoryPath(__FILE__).c_str(),
 					__FUNCTION__, __LINE__, path.c_str(), ex.what());
 				SystemFlags::OutputDebug(SystemFlags::debugError, szBuf);
-				if (SystemFlags::
-					getSystemSettingType(SystemFlags::debugSystem).enabled)
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 
 				throw megaglest_runtime_error(szBuf);
@@ -705,6 +704,23 @@ Please contact the ZetaGlest team for more info.";
 				gameSettings->setFlagTypes1(valueFlags1);
 			}
 
+			if (Config::getInstance().
+				getBool("EnableHierarchicalPathfinder", "false") == true) {
+				valueFlags1 |= ft1_hierarchical_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			} else {
+				valueFlags1 &= ~ft1_hierarchical_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			}
+			if (Config::getInstance().
+				getBool("EnableGroupFlowFieldPathfinder", "false") == true) {
+				valueFlags1 |= ft1_group_flow_field_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			} else {
+				valueFlags1 &= ~ft1_group_flow_field_pathfinder;
+				gameSettings->setFlagTypes1(valueFlags1);
+			}
+
 			gameSettings->setPathFinderType(static_cast <PathFinderType>
 				(Config::
 					getInstance().getInt
@@ -48,7 +48,7 @@ namespace Glest {
 			timeInc = 24.f * (1.f / config.getFloat("DayTime")) / GameConstants::updateFps;
 			//printf("#1 timeInc = %f\n",timeInc);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line %d] timeInc = %f\n", __FILE__, __FUNCTION__, __LINE__, timeInc);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line %d] timeInc = %f\n", __FILE__, __FUNCTION__, __LINE__, timeInc);
 		}
 
 		void TimeFlow::update() {
@@ -0,0 +1,156 @@
+//
+//	unit_spatial_index.cpp:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#include "unit_spatial_index.h"
+
+#include <algorithm>
+
+#include "unit.h"
+#include "conversion.h"
+#include "platform_util.h"
+#include "leak_dumper.h"
+
+using namespace Shared::Util;
+
+namespace Glest {
+	namespace Game {
+
+		// =====================================================
+		// 	class UnitSpatialIndex
+		// =====================================================
+
+		const int UnitSpatialIndex::bucketSize = 8;
+
+		UnitSpatialIndex::UnitSpatialIndex() {
+			w = 0;
+			h = 0;
+			bucketW = 0;
+			bucketH = 0;
+			for (int factionIndex = 0; factionIndex < factionCount; ++factionIndex) {
+				unitCellCount[factionIndex] = 0;
+			}
+		}
+
+		void UnitSpatialIndex::init(int w, int h) {
+			this->w = w;
+			this->h = h;
+			bucketW = (w + bucketSize - 1) / bucketSize;
+			bucketH = (h + bucketSize - 1) / bucketSize;
+			clear();
+		}
+
+		void UnitSpatialIndex::clear() {
+			for (int factionIndex = 0; factionIndex < factionCount; ++factionIndex) {
+				buckets[factionIndex].clear();
+				buckets[factionIndex].resize(bucketW * bucketH);
+				unitCellCount[factionIndex] = 0;
+			}
+		}
+
+		void UnitSpatialIndex::checkFactionIndex(int factionIndex) const {
+			if (factionIndex < 0 || factionIndex >= factionCount) {
+				throw megaglest_runtime_error("Invalid faction index: " + intToStr(factionIndex));
+			}
+		}
+
+		void UnitSpatialIndex::addUnitCell(Unit *unit, const Vec2i &pos, int field) {
+			int factionIndex = unit->getFactionIndex();
+			checkFactionIndex(factionIndex);
+
+			Bucket &bucket = getBucket(factionIndex, pos.x, pos.y);
+			bucket.units.push_back(unit);
+			bucket.cellKeys.push_back(getCellKey(pos.x, pos.y, field));
+			unitCellCount[factionIndex]++;
+		}
+
+		void UnitSpatialIndex::removeUnitCell(const Vec2i &pos, int field) {
+			// a cell field holds one unit so its key is unique across factions,
+			// which spares reading the faction of a unit that may be going away
+			uint32 cellKey = getCellKey(pos.x, pos.y, field);
+			for (int factionIndex = 0; factionIndex < factionCount; ++factionIndex) {
+				if (unitCellCount[factionIndex] == 0) {
+					continue;
+				}
+				Bucket &bucket = getBucket(factionIndex, pos.x, pos.y);
+				for (unsigned int index = 0; index < bucket.cellKeys.size(); ++index) {
+					if (bucket.cellKeys[index] == cellKey) {
+						bucket.units[index] = bucket.units.back();
+						bucket.units.pop_back();
+						bucket.cellKeys[index] = bucket.cellKeys.back();
+						bucket.cellKeys.pop_back();
+						unitCellCount[factionIndex]--;
+						return;
+					}
+				}
+			}
+		}
+
+		void UnitSpatialIndex::findUnitCells(int factionIndex, int x0, int y0, int x1, int y1, vector<UnitCell> &result) const {
+			checkFactionIndex(factionIndex);
+			if (unitCellCount[factionIndex] == 0) {
+				return;
+			}
+
+			x0 = std::max(x0, 0);
+			y0 = std::max(y0, 0);
+			x1 = std::min(x1, w);
+			y1 = std::min(y1, h);
+			if (x0 >= x1 || y0 >= y1) {
+				return;
+			}
+
+			const vector<Bucket> &factionBuckets = buckets[factionIndex];
+			for (int bucketY = y0 / bucketSize; bucketY <= (y1 - 1) / bucketSize; ++bucketY) {
+				for (int bucketX = x0 / bucketSize; bucketX <= (x1 - 1) / bucketSize; ++bucketX) {
+					const Bucket &bucket = factionBuckets[bucketY * bucketW + bucketX];
+					for (unsigned int index = 0; index < bucket.cellKeys.size(); ++index) {
+						Vec2i pos = getCellKeyPos(bucket.cellKeys[index]);
+						if (pos.x >= x0 && pos.x < x1 && pos.y >= y0 && pos.y < y1) {
+							UnitCell unitCell;
+							unitCell.unit = bucket.units[index];
+							unitCell.cellKey = bucket.cellKeys[index];
+							result.push_back(unitCell);
+						}
+					}
+				}
+			}
+		}
+
+		string UnitSpatialIndex::getStats() const {
+			int totalUnitCells = 0;
+			int usedBuckets = 0;
+			for (int factionIndex = 0; factionIndex < factionCount; ++factionIndex) {
+				totalUnitCells += unitCellCount[factionIndex];
+				for (unsigned int index = 0; index < buckets[factionIndex].size(); ++index) {
+					if (buckets[factionIndex][index].cellKeys.empty() == false) {
+						usedBuckets++;
+					}
+				}
+			}
+
+			char szBuf[8096] = "";
+			snprintf(szBuf, 8096, "unit cells [%d] used buckets [%d] bucket size [%d]", totalUnitCells, usedBuckets, bucketSize);
+			return szBuf;
+		}
+
+	}
+} //end namespace
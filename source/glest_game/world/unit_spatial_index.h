@@ -0,0 +1,126 @@
+//
+//	unit_spatial_index.h:
+//
+//	This file is part of ZetaGlest <https://github.com/ZetaGlest>
+//
+//	Copyright (C) 2018  The ZetaGlest team
+//
+//	ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//	This program is free software: you can redistribute it and/or modify
+//	it under the terms of the GNU General Public License as published by
+//	the Free Software Foundation, either version 3 of the License, or
+//	(at your option) any later version.
+
+//	This program is distributed in the hope that it will be useful,
+//	but WITHOUT ANY WARRANTY; without even the implied warranty of
+//	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//	GNU General Public License for more details.
+//
+//	You should have received a copy of the GNU General Public License
+//	along with this program.  If not, see <https://www.gnu.org/licenses/>
+
+#ifndef _GLEST_GAME_UNIT_SPATIAL_INDEX_H_
+#define _GLEST_GAME_UNIT_SPATIAL_INDEX_H_
+
+#ifdef WIN32
+#include <winsock2.h>
+#include <winsock.h>
+#endif
+
+#include <vector>
+#include <string>
+#include "vec.h"
+#include "data_types.h"
+#include "game_constants.h"
+#include "skill_type.h"
+#include "leak_dumper.h"
+
+using std::vector;
+using std::string;
+using Shared::Graphics::Vec2i;
+using Shared::Platform::uint32;
+
+namespace Glest {
+	namespace Game {
+
+		class Unit;
+
+		// =====================================================
+		// 	class UnitSpatialIndex
+		//
+		///	Per faction uniform grid of the cells occupied by
+		///	units. Mirrors Map cell occupancy so range queries
+		///	only visit the units close to the queried area.
+		// =====================================================
+
+		class UnitSpatialIndex {
+		public:
+			static const int bucketSize;
+			static const int factionCount = GameConstants::maxPlayers;
+
+			// a cell occupied by a unit in one field, cellKey orders cells the
+			// way a column by column scan of the map (then field) visits them
+			class UnitCell {
+			public:
+				Unit *unit;
+				uint32 cellKey;
+
+				bool operator<(const UnitCell &other) const {
+					return cellKey < other.cellKey;
+				}
+			};
+
+		private:
+			class Bucket {
+			public:
+				vector<Unit *> units;
+				vector<uint32> cellKeys;
+			};
+
+			int w;
+			int h;
+			int bucketW;
+			int bucketH;
+			vector<Bucket> buckets[factionCount];
+			int unitCellCount[factionCount];
+
+			inline Bucket & getBucket(int factionIndex, int x, int y) {
+				return buckets[factionIndex][(y / bucketSize) * bucketW + (x / bucketSize)];
+			}
+			void checkFactionIndex(int factionIndex) const;
+
+		public:
+			UnitSpatialIndex();
+
+			void init(int w, int h);
+			void clear();
+
+			void addUnitCell(Unit *unit, const Vec2i &pos, int field);
+			void removeUnitCell(const Vec2i &pos, int field);
+
+			inline uint32 getCellKey(int x, int y, int field) const {
+				return (uint32) (x * h + y) * fieldCount + field;
+			}
+			inline Vec2i getCellKeyPos(uint32 cellKey) const {
+				int cellIndex = cellKey / fieldCount;
+				return Vec2i(cellIndex / h, cellIndex % h);
+			}
+			inline int getCellKeyField(uint32 cellKey) const {
+				return cellKey % fieldCount;
+			}
+
+			inline int getUnitCellCount(int factionIndex) const {
+				return unitCellCount[factionIndex];
+			}
+			// appends the cells of a faction's units inside [x0,x1) x [y0,y1),
+			// in bucket order, callers sort when they need the scan order
+			void findUnitCells(int factionIndex, int x0, int y0, int x1, int y1, vector<UnitCell> &result) const;
+
+			string getStats() const;
+		};
+
+	}
+} //end namespace
+
+#endif
@@ -35,6 +35,7 @@
 #include "particle_type.h"
 #include "projectile_type.h"
 #include "path_finder.h"
+#include "path_abstraction.h"
 #include "renderer.h"
 #include "sound.h"
 #include "sound_renderer.h"
@@ -53,12 +54,18 @@ namespace Glest {
 		// 	class UnitUpdater
 		// =====================================================
 
-		time_t UnitRangeCellsLookupItem::lastDebug = 0;
+		//same test the cell scans around a unit always used for "cell in range"
+		static inline bool isCellInRange(const Vec2f &floatCenter, int x, int y, int range) {
+#ifdef USE_STREFLOP
+			return streflop::floor(static_cast<streflop::Simple>(floatCenter.dist(Vec2f((float) x, (float) y)))) <= (range + 1);
+#else
+			return floor(floatCenter.dist(Vec2f((float) x, (float) y))) <= (range + 1);
+#endif
+		}
 
 		// ===================== PUBLIC ========================
 
-		UnitUpdater::UnitUpdater() : mutexAttackWarnings(new Mutex(CODE_AT_LINE)),
-			mutexUnitRangeCellsLookupItemCache(new Mutex(CODE_AT_LINE)) {
+		UnitUpdater::UnitUpdater() : mutexAttackWarnings(new Mutex(CODE_AT_LINE)) {
 			this->game = NULL;
 			this->gui = NULL;
 			this->gameCamera = NULL;
@@ -67,7 +74,6 @@ namespace Glest {
 			this->console = NULL;
 			this->scriptManager = NULL;
 			this->pathFinder = NULL;
-			//UnitRangeCellsLookupItemCacheTimerCount = 0;
 			attackWarnRange = 0;
 		}
 
@@ -82,12 +88,11 @@ namespace Glest {
 			this->scriptManager = game->getScriptManager();
 			this->pathFinder = NULL;
 			attackWarnRange = Config::getInstance().getFloat("AttackWarnRange", "50.0");
-			//UnitRangeCellsLookupItemCacheTimerCount = 0;
 
 			switch (this->game->getGameSettings()->getPathFinderType()) {
 				case pfBasic:
 					pathFinder = new PathFinder();
-					pathFinder->init(map);
+					pathFinder->init(map, this->game->getGameSettings());
 					break;
 				default:
 					throw megaglest_runtime_error("detected unsupported pathfinder type!");
@@ -107,12 +112,10 @@ namespace Glest {
 		}
 
 		UnitUpdater::~UnitUpdater() {
-			//UnitRangeCellsLookupItemCache.clear();
-
 			delete pathFinder;
 			pathFinder = NULL;
 
-			MutexSafeWrapper safeMutex(mutexAttackWarnings, string(__FILE__) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutex(mutexAttackWarnings, CODE_AT_LINE);
 			while (attackWarnings.empty() == false) {
 				AttackWarningData* awd = attackWarnings.back();
 				attackWarnings.pop_back();
@@ -123,9 +126,6 @@ namespace Glest {
 
 			delete mutexAttackWarnings;
 			mutexAttackWarnings = NULL;
-
-			delete mutexUnitRangeCellsLookupItemCache;
-			mutexUnitRangeCellsLookupItemCache = NULL;
 		}
 
 		// ==================== progress skills ====================
@@ -135,9 +135,9 @@ namespace Glest {
 			bool processUnitCommand = false;
 
 			Chrono chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [START OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [START OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			SoundRenderer &soundRenderer = SoundRenderer::getInstance();
 
@@ -191,11 +191,11 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after playsound]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after playsound]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			unit->updateTimedParticles();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after playsound]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after playsound]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 
 			//start attack particle system
@@ -245,11 +245,11 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after attack particle system]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after attack particle system]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			bool update = unit->update();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after unit->update()]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after unit->update()]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			//printf("Update Unit [%d - %s] = %d\n",unit->getId(),unit->getType()->getName().c_str(),update);
 
@@ -260,7 +260,7 @@ namespace Glest {
 				processUnitCommand = true;
 				updateUnitCommand(unit, -1);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after updateUnitCommand()]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after updateUnitCommand()]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 				//if unit is out of EP, it stops
 				if (unit->computeEp() == true) {
@@ -283,7 +283,7 @@ namespace Glest {
 							if (ct != NULL && ct->getClass() == ccAttackStopped) {
 								const AttackStoppedCommandType *act = static_cast<const AttackStoppedCommandType*>(ct);
 								if (act != NULL && act->getName(false) == holdPositionName) {
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 									//printf("Re-Queing hold pos = %d, ep = %d skillep = %d skillname [%s]\n ",unit->getFaction()->reqsOk(act),unit->getEp(),act->getAttackSkillType()->getEpCost(),act->getName().c_str());
 									if (unit->getFaction()->reqsOk(act) == true &&
@@ -291,7 +291,7 @@ namespace Glest {
 										unit->giveCommand(new Command(act), true);
 									}
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 									break;
 								}
 							}
@@ -321,7 +321,7 @@ namespace Glest {
 				if (unit->getCurrSkill()->getClass() == scMove) {
 					world->moveUnitCells(unit, true);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after world->moveUnitCells()]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after world->moveUnitCells()]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 					//play water sound
 					if (map->getCell(unit->getPos())->getHeight() < map->getWaterLevel() && unit->getCurrField() == fLand) {
@@ -332,20 +332,20 @@ namespace Glest {
 								gameCamera->getPos()
 							);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after soundFx()]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld [after soundFx()]\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 						}
 					}
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			//unit death
 			if (unit->isDead() && unit->getCurrSkill()->getClass() != scDie) {
 				unit->kill();
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			return processUnitCommand;
 		}
@@ -398,7 +398,7 @@ namespace Glest {
 							ct = spawned->computeCommandType(targetPos, map->getCell(targetPos)->getUnit(unit->getTargetField()));
 						}
 						if (ct != NULL) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							spawned->giveCommand(new Command(ct, targetPos));
 						}
 					}
@@ -455,7 +455,7 @@ namespace Glest {
 			try {
 				bool minorDebugPerformance = false;
 				Chrono chrono;
-				if ((minorDebugPerformance == true && frameIndex > 0) || SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if ((minorDebugPerformance == true && frameIndex > 0) || DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				//  If the unit has a command, process it.
 				bool hasCommand = (unit->anyCommand());
@@ -466,7 +466,7 @@ namespace Glest {
 				if (minorDebugPerformance && frameIndex > 0) elapsed1 = chrono.getMillis();
 
 				if (hasCommand == true) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit [%s] has command [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString(false).c_str(), unit->getCurrCommand()->toString(false).c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit [%s] has command [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString(false).c_str(), unit->getCurrCommand()->toString(false).c_str());
 
 					bool commandUsesPathFinder = (frameIndex < 0);
 					if (frameIndex > 0) {
@@ -491,12 +491,12 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 				if (frameIndex < 0) {
 					//if no commands stop and add stop command
 					if (unit->anyCommand() == false && unit->isOperative()) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						if (unit->getType()->hasSkillClass(scStop)) {
 							unit->setCurrSkill(scStop);
 						}
@@ -505,14 +505,14 @@ namespace Glest {
 						}
 					}
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 				if ((minorDebugPerformance && frameIndex > 0) && chrono.getMillis() >= 1) printf("UnitUpdate [%d - %s] #3-unit threaded updates on frame: %d took [%lld] msecs\n", unit->getId(), unit->getType()->getName(false).c_str(), frameIndex, (long long int)chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -535,7 +535,7 @@ namespace Glest {
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -547,7 +547,7 @@ namespace Glest {
 
 				unit->setCurrSkill(sct->getStopSkillType());
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 
 				//we can attack any unit => attack it
@@ -577,29 +577,29 @@ namespace Glest {
 							}
 						}
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 				}
 				//see any unit and cant attack it => run
 				else if (unit->getType()->hasCommandClass(ccMove)) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 					if (attackerOnSight(unit, &sighted, (frameIndex >= 0))) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 						Vec2i escapePos = unit->getPos() * 2 - sighted->getPos();
 						//SystemFlags::OutputDebug(SystemFlags::debugUnitCommands,"In [%s::%s Line: %d]\n",__FILE__,__FUNCTION__,__LINE__);
 						unit->giveCommand(new Command(unit->getType()->getFirstCtOfClass(ccMove), escapePos));
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -615,7 +615,7 @@ namespace Glest {
 		void UnitUpdater::updateMove(Unit *unit, int frameIndex) {
 			try {
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -626,13 +626,13 @@ namespace Glest {
 
 				Vec2i pos = command->getUnit() != NULL ? command->getUnit()->getCenteredPos() : command->getPos();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateMove] pos [%s] unit [%d - %s] cmd [%s]", pos.getString().c_str(), unit->getId(), unit->getFullName(false).c_str(), command->toString(false).c_str());
 					unit->logSynchData(__FILE__, __LINE__, szBuf);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 
 				TravelState tsValue = tsImpossible;
@@ -644,7 +644,7 @@ namespace Glest {
 						throw megaglest_runtime_error("detected unsupported pathfinder type!");
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 
 				if (frameIndex < 0) {
@@ -667,19 +667,19 @@ namespace Glest {
 				}
 
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateMove] tsValue [%d]", tsValue);
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -697,19 +697,19 @@ namespace Glest {
 		void UnitUpdater::updateAttack(Unit *unit, int frameIndex) {
 			try {
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateAttack]");
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "[updateAttack]");
 						unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -720,7 +720,7 @@ namespace Glest {
 				const AttackCommandType *act = static_cast<const AttackCommandType*>(command->getCommandType());
 				if (act == NULL) {
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "[updateAttack]");
 						unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -730,14 +730,14 @@ namespace Glest {
 				}
 				Unit *target = NULL;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 				if ((command->getUnit() == NULL || !(command->getUnit()->isAlive())) && unit->getCommandSize() > 1) {
 
 					if (frameIndex < 0) {
 						unit->finishCommand(); // all queued "ground attacks" are skipped if somthing else is queued after them.
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 							char szBuf[8096] = "";
 							snprintf(szBuf, 8096, "[updateAttack]");
 							unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -758,13 +758,13 @@ namespace Glest {
 								unit->setCurrSkill(scStop);
 							}
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096, "[updateAttack]");
 								unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 							}
 						}
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 					} else {
 						//compute target pos
 						Vec2i pos;
@@ -776,13 +776,13 @@ namespace Glest {
 							pos = command->getPos();
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 							char szBuf[8096] = "";
 							snprintf(szBuf, 8096, "[updateAttack] pos [%s] unit->getPos() [%s]", pos.getString().c_str(), unit->getPos().getString().c_str());
 							unit->logSynchData(__FILE__, __LINE__, szBuf);
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 						TravelState tsValue = tsImpossible;
 						//if(frameIndex < 0) {
@@ -800,22 +800,22 @@ namespace Glest {
 							//fflush(stdout);
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 						if (frameIndex < 0) {
 							if (command->getUnit() != NULL && !command->getUnit()->isAlive() && unit->getCommandSize() > 1) {
 								// don't run over to dead body if there is still something to do in the queue
 								unit->finishCommand();
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 									char szBuf[8096] = "";
 									snprintf(szBuf, 8096, "[updateAttack]");
 									unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 								}
 							} else {
 								//if unit arrives destPos order has ended
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0 &&
-									SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0 &&
+									DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 									char szBuf[8096] = "";
 									snprintf(szBuf, 8096, "#1 [updateAttack] tsValue = %d", tsValue);
 									unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -875,8 +875,8 @@ namespace Glest {
 												}
 								*/
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0 &&
-									SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0 &&
+									DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 									char szBuf[8096] = "";
 									snprintf(szBuf, 8096, "#2 [updateAttack] tsValue = %d", tsValue);
 									unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -885,17 +885,17 @@ namespace Glest {
 							}
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Loc [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -915,7 +915,7 @@ namespace Glest {
 
 				// Nothing to do
 				if (frameIndex >= 0) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex >= 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex >= 0) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "[updateAttackStopped]");
 						unit->logSynchDataThreaded(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -925,7 +925,7 @@ namespace Glest {
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -937,7 +937,7 @@ namespace Glest {
 
 
 				if (unit->getCommandSize() > 1) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "[updateAttackStopped]");
 						unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -957,7 +957,7 @@ namespace Glest {
 					unit->setCurrSkill(asct->getAttackSkillType());
 					unit->setTarget(result.second);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "[updateAttackStopped]");
 						unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -966,7 +966,7 @@ namespace Glest {
 					unit->setCurrSkill(asct->getAttackSkillType());
 					unit->setTarget(enemy);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "[updateAttackStopped]");
 						unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -974,20 +974,20 @@ namespace Glest {
 				} else {
 					unit->setCurrSkill(asct->getStopSkillType());
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "[updateAttackStopped]");
 						unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -1055,16 +1055,16 @@ namespace Glest {
 		void UnitUpdater::updateBuild(Unit *unit, int frameIndex) {
 			try {
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateBuild]");
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit [%s] will build using command [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString(false).c_str(), unit->getCurrCommand()->toString(false).c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit [%s] will build using command [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString(false).c_str(), unit->getCurrCommand()->toString(false).c_str());
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -1074,12 +1074,12 @@ namespace Glest {
 				const BuildCommandType *bct = static_cast<const BuildCommandType*>(command->getCommandType());
 
 				if (unit->getCurrSkill() != NULL && unit->getCurrSkill()->getClass() != scBuild) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 					//if not building
 					const UnitType *ut = command->getUnitType();
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 					TravelState tsValue = tsImpossible;
 					switch (this->game->getGameSettings()->getPathFinderType()) {
@@ -1087,7 +1087,7 @@ namespace Glest {
 						{
 							Vec2i buildPos = map->findBestBuildApproach(unit, command->getPos(), ut);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096, "[updateBuild] unit->getPos() [%s] command->getPos() [%s] buildPos [%s]",
 									unit->getPos().getString().c_str(), command->getPos().getString().c_str(), buildPos.getString().c_str());
@@ -1096,7 +1096,7 @@ namespace Glest {
 
 							tsValue = pathFinder->findPath(unit, buildPos, NULL, frameIndex);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096, "[updateBuild] tsValue: %d", tsValue);
 								unit->logSynchData(__FILE__, __LINE__, szBuf);
@@ -1108,19 +1108,19 @@ namespace Glest {
 							throw megaglest_runtime_error("detected unsupported pathfinder type!");
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsValue = %d\n", __FILE__, __FUNCTION__, __LINE__, tsValue);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsValue = %d\n", __FILE__, __FUNCTION__, __LINE__, tsValue);
 
 					if (frameIndex < 0) {
 						switch (tsValue) {
 							case tsMoving:
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsMoving\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsMoving\n", __FILE__, __FUNCTION__, __LINE__);
 
 								unit->setCurrSkill(bct->getMoveSkillType());
 								break;
 
 							case tsArrived:
 							{
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsArrived:\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsArrived:\n", __FILE__, __FUNCTION__, __LINE__);
 
 								//if arrived destination
 								assert(ut);
@@ -1131,14 +1131,14 @@ namespace Glest {
 								bool canOccupyCell = false;
 								switch (this->game->getGameSettings()->getPathFinderType()) {
 									case pfBasic:
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsArrived about to call map->isFreeCells() for command->getPos() = %s, ut->getSize() = %d\n", __FILE__, __FUNCTION__, __LINE__, command->getPos().getString().c_str(), ut->getSize());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsArrived about to call map->isFreeCells() for command->getPos() = %s, ut->getSize() = %d\n", __FILE__, __FUNCTION__, __LINE__, command->getPos().getString().c_str(), ut->getSize());
 										canOccupyCell = map->isFreeCells(command->getPos(), ut->getSize(), fLand);
 										break;
 									default:
 										throw megaglest_runtime_error("detected unsupported pathfinder type!");
 								}
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] canOccupyCell = %d\n", __FILE__, __FUNCTION__, __LINE__, canOccupyCell);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] canOccupyCell = %d\n", __FILE__, __FUNCTION__, __LINE__, canOccupyCell);
 
 								if (canOccupyCell == true) {
 									const UnitType *builtUnitType = command->getUnitType();
@@ -1156,7 +1156,7 @@ namespace Glest {
 									Vec2i buildPos = command->getPos();
 									Unit *builtUnit = new Unit(world->getNextUnitId(unit->getFaction()), newpath, buildPos, builtUnitType, unit->getFaction(), world->getMap(), facing);
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 									builtUnit->create();
 
@@ -1172,7 +1172,7 @@ namespace Glest {
 
 									map->prepareTerrain(builtUnit);
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 									switch (this->game->getGameSettings()->getPathFinderType()) {
 										case pfBasic:
@@ -1193,7 +1193,7 @@ namespace Glest {
 											gameCamera->getPos());
 									}
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, builtUnit->toString(false).c_str());
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, builtUnit->toString(false).c_str());
 								} else {
 									//if there are no free cells
 									unit->cancelCommand();
@@ -1203,7 +1203,7 @@ namespace Glest {
 										console->addStdMessage("BuildingNoPlace");
 									}
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] got BuildingNoPlace\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] got BuildingNoPlace\n", __FILE__, __FUNCTION__, __LINE__);
 								}
 							}
 							break;
@@ -1212,14 +1212,14 @@ namespace Glest {
 								if (unit->getPath()->isBlocked()) {
 									unit->cancelCommand();
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] got tsBlocked\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] got tsBlocked\n", __FILE__, __FUNCTION__, __LINE__);
 								}
 								break;
 						}
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsArrived unit = %s\n", __FILE__, __FUNCTION__, __LINE__, unit->toString(false).c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsArrived unit = %s\n", __FILE__, __FUNCTION__, __LINE__, unit->toString(false).c_str());
 
 					if (frameIndex < 0) {
 						//if building
@@ -1229,16 +1229,16 @@ namespace Glest {
 						}
 
 						if (builtUnit != NULL) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] builtUnit = %s\n", __FILE__, __FUNCTION__, __LINE__, builtUnit->toString(false).c_str());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] builtUnit = %s\n", __FILE__, __FUNCTION__, __LINE__, builtUnit->toString(false).c_str());
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] builtUnit = [%p]\n", __FILE__, __FUNCTION__, __LINE__, builtUnit);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] builtUnit = [%p]\n", __FILE__, __FUNCTION__, __LINE__, builtUnit);
 
 						//if unit is killed while building then u==NULL;
 						if (builtUnit != NULL && builtUnit != command->getUnit()) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] builtUnit is not the command's unit!\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] builtUnit is not the command's unit!\n", __FILE__, __FUNCTION__, __LINE__);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096, "[updateBuild]");
 								unit->logSynchData(__FILE__, __LINE__, szBuf);
@@ -1246,9 +1246,9 @@ namespace Glest {
 
 							unit->setCurrSkill(scStop);
 						} else if (builtUnit == NULL || builtUnit->isBuilt()) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] builtUnit is NULL or ALREADY built\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] builtUnit is NULL or ALREADY built\n", __FILE__, __FUNCTION__, __LINE__);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096, "[updateBuild]");
 								unit->logSynchData(__FILE__, __LINE__, szBuf);
@@ -1258,9 +1258,9 @@ namespace Glest {
 							unit->setCurrSkill(scStop);
 
 						} else if (builtUnit == NULL || builtUnit->repair()) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096, "[updateBuild]");
 								unit->logSynchData(__FILE__, __LINE__, szBuf);
@@ -1282,16 +1282,16 @@ namespace Glest {
 							}
 						}
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -1311,7 +1311,7 @@ namespace Glest {
 					return;
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateHarvestEmergencyReturn]");
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -1347,7 +1347,7 @@ namespace Glest {
 										NetworkCommand networkCommand(this->world, nctGiveCommand, unit->getId(), previousHarvestCmd->getId(), unit->getLastHarvestedResourcePos(),
 											-1, Unit::invalidId, -1, false, cst_None, -1, -1);
 
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 										Command* new_command = this->game->getCommander()->buildCommand(&networkCommand);
 										new_command->setStateType(cst_EmergencyReturnResource);
@@ -1356,14 +1356,14 @@ namespace Glest {
 										if (cr.first == crSuccess) {
 											//printf("\n\n#1b return harvested resources\n\n");
 
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 											unit->replaceCurrCommand(new_command);
 
 											unit->setCurrSkill(previousHarvestCmd->getStopLoadedSkillType()); // make sure we use the right harvest animation
 										} else {
 											//printf("\n\n#1c return harvested resources\n\n");
 
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 											delete new_command;
 
 											unit->setCurrSkill(scStop);
@@ -1380,7 +1380,7 @@ namespace Glest {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -1395,14 +1395,14 @@ namespace Glest {
 		void UnitUpdater::updateHarvest(Unit *unit, int frameIndex) {
 			try {
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateHarvest]");
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -1418,7 +1418,7 @@ namespace Glest {
 				//TravelState tsValue = tsImpossible;
 				//UnitPathInterface *path= unit->getPath();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 				//printf("In UpdateHarvest [%d - %s] unit->getCurrSkill()->getClass() = %d\n",unit->getId(),unit->getType()->getName().c_str(),unit->getCurrSkill()->getClass());
 
 				Resource *harvestResource = NULL;
@@ -1444,7 +1444,7 @@ namespace Glest {
 								//if can harvest dest. pos
 								bool canHarvestDestPos = false;
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 								switch (this->game->getGameSettings()->getPathFinderType()) {
 									case pfBasic:
@@ -1466,7 +1466,7 @@ namespace Glest {
 												//printf("%%----------- unit [%s - %d] CHANGING RESOURCE POS from [%s] to [%s]\n",unit->getFullName().c_str(),unit->getId(),command->getOriginalPos().getString().c_str(),clickPos.getString().c_str());
 
 												if (frameIndex < 0) {
-													if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+													if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 														char szBuf[8096] = "";
 														snprintf(szBuf, 8096, "[updateHarvest] clickPos [%s]", clickPos.getString().c_str());
 														unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -1482,11 +1482,11 @@ namespace Glest {
 										throw megaglest_runtime_error("detected unsupported pathfinder type!");
 								}
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 								if (canHarvestDestPos == true) {
 									if (frameIndex < 0) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 											char szBuf[8096] = "";
 											snprintf(szBuf, 8096, "[updateHarvest]");
 											unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -1519,18 +1519,18 @@ namespace Glest {
 													throw megaglest_runtime_error("detected unsupported pathfinder type!");
 											}
 
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 												char szBuf[8096] = "";
 												snprintf(szBuf, 8096, "[updateHarvest] targetPos [%s]", targetPos.getString().c_str());
 												unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 											}
 										}
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 									}
 								}
 								if (canHarvestDestPos == false) {
 									if (frameIndex < 0) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 											char szBuf[8096] = "";
 											snprintf(szBuf, 8096, "[updateHarvest] targetPos [%s]", targetPos.getString().c_str());
 											unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
@@ -1539,9 +1539,9 @@ namespace Glest {
 										unit->setLastHarvestResourceTarget(&targetPos);
 									}
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 										char szBuf[8096] = "";
 										snprintf(szBuf, 8096, "[updateHarvest] unit->getPos() [%s] command->getPos() [%s]",
 											unit->getPos().getString().c_str(), command->getPos().getString().c_str());
@@ -1562,7 +1562,7 @@ namespace Glest {
 											throw megaglest_runtime_error("detected unsupported pathfinder type!");
 									}
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 									// If the unit is blocked or Even worse 'stuck' then try to
 									// find the same resource type elsewhere, but close by
@@ -1611,7 +1611,7 @@ namespace Glest {
 												}
 											}
 
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 										}
 
 										if (canHarvestDestPos == false) {
@@ -1622,7 +1622,7 @@ namespace Glest {
 											if (targetPos.x >= 0) {
 												//if not continue walking
 
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 													char szBuf[8096] = "";
 													snprintf(szBuf, 8096, "[updateHarvest #2] unit->getPos() [%s] command->getPos() [%s] targetPos [%s]",
 														unit->getPos().getString().c_str(), command->getPos().getString().c_str(), targetPos.getString().c_str());
@@ -1644,7 +1644,7 @@ namespace Glest {
 												}
 											}
 
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 											if (wasStuck == true && frameIndex < 0) {
 												//if can't harvest, search for another resource
@@ -1664,18 +1664,18 @@ namespace Glest {
 										unit->finishCommand();
 									}
 								}
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 							}
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 						//if loaded, return to store
 						Unit *store = world->nearestStore(unit->getPos(), unit->getFaction()->getIndex(), unit->getLoadType());
 						if (store != NULL) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096, "[updateHarvest #3] unit->getPos() [%s] store->getCenteredPos() [%s]",
 									unit->getPos().getString().c_str(), store->getCenteredPos().getString().c_str());
@@ -1691,7 +1691,7 @@ namespace Glest {
 									throw megaglest_runtime_error("detected unsupported pathfinder type!");
 							}
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 							if (frameIndex < 0) {
 								switch (tsValue) {
@@ -1737,7 +1737,7 @@ namespace Glest {
 									command->setPosToOriginalPos();
 								}
 							}
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 						} else {
 							if (frameIndex < 0) {
 								unit->finishCommand();
@@ -1749,7 +1749,7 @@ namespace Glest {
 						//if working
 						//unit->setLastHarvestResourceTarget(NULL);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 						const Vec2i unitTargetPos = unit->getTargetPos();
 						SurfaceCell *sc = map->getSurfaceCell(Map::toSurfCoords(unitTargetPos));
@@ -1783,7 +1783,7 @@ namespace Glest {
 								}
 								unit->getPath()->clear();
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 							} else {
 								// if there is a resource, continue working, until loaded
 								unit->update2();
@@ -1800,9 +1800,11 @@ namespace Glest {
 											//const ResourceType *rt = r->getType();
 											sc->deleteResource();
 											world->removeResourceTargetFromCache(unitTargetPos);
+											map->invalidateWalkability(Map::toUnitCoords(Map::toSurfCoords(unitTargetPos)), Map::cellScale);
 
 											switch (this->game->getGameSettings()->getPathFinderType()) {
 												case pfBasic:
+													map->getPathAbstraction()->markCellsDirty(Map::toUnitCoords(Map::toSurfCoords(unitTargetPos)), Map::cellScale);
 													break;
 												default:
 													throw megaglest_runtime_error("detected unsupported pathfinder type!");
@@ -1820,7 +1822,7 @@ namespace Glest {
 									}
 								}
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 							}
 						} else {
 							//if there is no resource, just stop
@@ -1830,13 +1832,13 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -1849,23 +1851,23 @@ namespace Glest {
 		}
 
 		void UnitUpdater::SwapActiveCommand(Unit *unitSrc, Unit *unitDest) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			if (unitSrc->getCommandSize() > 0 && unitDest->getCommandSize() > 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				Command *cmd1 = unitSrc->getCurrCommand();
 				Command *cmd2 = unitDest->getCurrCommand();
 				unitSrc->replaceCurrCommand(cmd2);
 				unitDest->replaceCurrCommand(cmd1);
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void UnitUpdater::SwapActiveCommandState(Unit *unit, CommandStateType commandStateType,
 			const CommandType *commandType,
 			int originalValue, int newValue) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			if (commandStateType == cst_linkedUnit) {
 				if (dynamic_cast<const BuildCommandType *>(commandType) != NULL) {
@@ -1874,18 +1876,18 @@ namespace Glest {
 						Unit *peerUnit = unit->getFaction()->getUnit(i);
 						if (peerUnit != NULL) {
 							if (peerUnit->getCommandSize() > 0) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 								Command *peerCommand = peerUnit->getCurrCommand();
 								//const BuildCommandType *bct = dynamic_cast<const BuildCommandType*>(peerCommand->getCommandType());
 								//if(bct != NULL) {
 								if (peerCommand != NULL) {
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 									//if(command->getPos() == peerCommand->getPos()) {
 									if (peerCommand->getStateType() == commandStateType &&
 										peerCommand->getStateValue() == originalValue) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 										peerCommand->setStateValue(newValue);
 									}
@@ -1897,11 +1899,11 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		Unit * UnitUpdater::findPeerUnitBuilder(Unit *unit) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			Unit *foundUnitBuilder = NULL;
 			if (unit->getCommandSize() > 0) {
@@ -1909,7 +1911,7 @@ namespace Glest {
 				if (command != NULL) {
 					const RepairCommandType *rct = dynamic_cast<const RepairCommandType*>(command->getCommandType());
 					if (rct != NULL && command->getStateType() == cst_linkedUnit) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] looking for command->getStateValue() = %d\n", __FILE__, __FUNCTION__, __LINE__, command->getStateValue());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] looking for command->getStateValue() = %d\n", __FILE__, __FUNCTION__, __LINE__, command->getStateValue());
 
 						Unit *firstLinkedPeerRepairer = NULL;
 
@@ -1917,29 +1919,29 @@ namespace Glest {
 							Unit *peerUnit = unit->getFaction()->getUnit(i);
 							if (peerUnit != NULL) {
 								if (peerUnit->getCommandSize() > 0) {
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 									Command *peerCommand = peerUnit->getCurrCommand();
 									const BuildCommandType *bct = dynamic_cast<const BuildCommandType*>(peerCommand->getCommandType());
 									if (bct != NULL) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 										if (command->getStateValue() == peerUnit->getId()) {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 											foundUnitBuilder = peerUnit;
 											break;
 										}
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] **peer NOT building**, peerUnit = [%s]\n", __FILE__, __FUNCTION__, __LINE__, peerUnit->toString(false).c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] **peer NOT building**, peerUnit = [%s]\n", __FILE__, __FUNCTION__, __LINE__, peerUnit->toString(false).c_str());
 
 										if (firstLinkedPeerRepairer == NULL) {
 											const RepairCommandType *prct = dynamic_cast<const RepairCommandType*>(peerCommand->getCommandType());
 											if (prct != NULL) {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 												if (unit->getId() != peerUnit->getId() && command->getStateValue() == peerUnit->getId()) {
-													if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+													if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 													firstLinkedPeerRepairer = peerUnit;
 												}
@@ -1957,7 +1959,7 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] returning foundUnitBuilder = [%s]\n", __FILE__, __FUNCTION__, __LINE__, (foundUnitBuilder != NULL ? foundUnitBuilder->toString(false).c_str() : "null"));
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] returning foundUnitBuilder = [%s]\n", __FILE__, __FUNCTION__, __LINE__, (foundUnitBuilder != NULL ? foundUnitBuilder->toString(false).c_str() : "null"));
 
 			return foundUnitBuilder;
 		}
@@ -1972,19 +1974,19 @@ namespace Glest {
 					clearUnitPrecache(unit);
 					return;
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateRepair]");
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit = %p\n", __FILE__, __FUNCTION__, __LINE__, unit);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit = %p\n", __FILE__, __FUNCTION__, __LINE__, unit);
 
 				//if(unit != NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit doing the repair [%s] - %d\n", __FILE__, __FUNCTION__, __LINE__, unit->getFullName(false).c_str(), unit->getId());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit doing the repair [%s] - %d\n", __FILE__, __FUNCTION__, __LINE__, unit->getFullName(false).c_str(), unit->getId());
 				//}
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -1994,7 +1996,7 @@ namespace Glest {
 				const RepairCommandType *rct = static_cast<const RepairCommandType*>(command->getCommandType());
 				const CommandType *ct = (command != NULL ? command->getCommandType() : NULL);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] rct = %p\n", __FILE__, __FUNCTION__, __LINE__, rct);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] rct = %p\n", __FILE__, __FUNCTION__, __LINE__, rct);
 
 				Unit *repaired = (command != NULL ? map->getCell(command->getPos())->getUnitWithEmptyCellMap(fLand) : NULL);
 				if (repaired == NULL && command != NULL) {
@@ -2002,7 +2004,7 @@ namespace Glest {
 				}
 
 				if (repaired != NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit to repair [%s] - %d\n", __FILE__, __FUNCTION__, __LINE__, repaired->getFullName(false).c_str(), repaired->getId());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit to repair [%s] - %d\n", __FILE__, __FUNCTION__, __LINE__, repaired->getFullName(false).c_str(), repaired->getId());
 				}
 
 				if (chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
@@ -2014,65 +2016,65 @@ namespace Glest {
 					SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit peer [%s] - %d\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder->getFullName(false).c_str(), peerUnitBuilder->getId());
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 				// Ensure we have the right unit to repair
 				if (peerUnitBuilder != NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerUnitBuilder = %p\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerUnitBuilder = %p\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder);
 
 					if (peerUnitBuilder->getCurrCommand()->getUnit() != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerbuilder's unitid = %d\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder->getCurrCommand()->getUnit()->getId());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerbuilder's unitid = %d\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder->getCurrCommand()->getUnit()->getId());
 						repaired = peerUnitBuilder->getCurrCommand()->getUnit();
 					}
 				}
 
 				bool nextToRepaired = repaired != NULL && map->isNextTo(unit, repaired);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 				peerUnitBuilder = NULL;
 				if (repaired == NULL) {
 					peerUnitBuilder = findPeerUnitBuilder(unit);
 					if (peerUnitBuilder != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerUnitBuilder = %p\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerUnitBuilder = %p\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder);
 
 						if (peerUnitBuilder->getCurrCommand()->getUnit() != NULL) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerbuilder's unitid = %d\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder->getCurrCommand()->getUnit()->getId());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerbuilder's unitid = %d\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder->getCurrCommand()->getUnit()->getId());
 							repaired = peerUnitBuilder->getCurrCommand()->getUnit();
 							nextToRepaired = repaired != NULL && map->isNextTo(unit, repaired);
 						} else if (peerUnitBuilder->getCurrCommand()->getUnitType() != NULL) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							Vec2i buildPos = map->findBestBuildApproach(unit, command->getPos(), peerUnitBuilder->getCurrCommand()->getUnitType());
 
 							//nextToRepaired= (unit->getPos() == (command->getPos()-Vec2i(1)));
 							nextToRepaired = (unit->getPos() == buildPos);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerUnitBuilder = %p, nextToRepaired = %d\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder, nextToRepaired);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] peerUnitBuilder = %p, nextToRepaired = %d\n", __FILE__, __FUNCTION__, __LINE__, peerUnitBuilder, nextToRepaired);
 
 							if (nextToRepaired == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								Command *peerCommand = peerUnitBuilder->getCurrCommand();
 								const RepairCommandType *rct = dynamic_cast<const RepairCommandType*>(peerCommand->getCommandType());
 								// If the peer is also scheduled to do a repair we CANNOT swap their commands or
 								// it will result in a stack overflow as each swaps the others repair command.
 								// We must convert this unit's repair into a build right now!
 								if (rct != NULL) {
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 									const CommandType *ctbuild = unit->getType()->getFirstCtOfClass(ccBuild);
 									NetworkCommand networkCommand(this->world, nctGiveCommand, unit->getId(), ctbuild->getId(), command->getPos(),
 										command->getUnitType()->getId(), -1, CardinalDir(CardinalDir::NORTH), true, command->getStateType(),
 										command->getStateValue());
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 									Command* command = this->game->getCommander()->buildCommand(&networkCommand);
 									std::pair<CommandResult, string> cr = unit->checkCommand(command);
 									if (cr.first == crSuccess) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 										unit->replaceCurrCommand(command);
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 										delete command;
 
 										unit->setCurrSkill(scStop);
@@ -2094,13 +2096,13 @@ namespace Glest {
 								return;
 							}
 						}
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 					}
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit to repair[%s]\n", __FILE__, __FUNCTION__, __LINE__, repaired->getFullName(false).c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit to repair[%s]\n", __FILE__, __FUNCTION__, __LINE__, repaired->getFullName(false).c_str());
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] repaired = %p, nextToRepaired = %d, unit->getCurrSkill()->getClass() = %d\n", __FILE__, __FUNCTION__, __LINE__, repaired, nextToRepaired, unit->getCurrSkill()->getClass());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] repaired = %p, nextToRepaired = %d, unit->getCurrSkill()->getClass() = %d\n", __FILE__, __FUNCTION__, __LINE__, repaired, nextToRepaired, unit->getCurrSkill()->getClass());
 
 				//UnitPathInterface *path= unit->getPath();
 				if (unit->getCurrSkill()->getClass() != scRepair ||
@@ -2120,10 +2122,10 @@ namespace Glest {
 			//			}
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] repairPos = %s, startRepairing = %d\n", __FILE__, __FUNCTION__, __LINE__, repairPos.getString().c_str(), startRepairing);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] repairPos = %s, startRepairing = %d\n", __FILE__, __FUNCTION__, __LINE__, repairPos.getString().c_str(), startRepairing);
 
 					if (startRepairing == false && peerUnitBuilder != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						startRepairing = true;
 						// Since the unit to be built is not yet existing we need to tell the
 						// other units to move to the build position or else they get in the way
@@ -2134,22 +2136,22 @@ namespace Glest {
 
 					//if not repairing
 					if (startRepairing == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 						if (nextToRepaired == true) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							unit->setTarget(repaired);
 							unit->setCurrSkill(rct->getRepairSkillType());
 						} else {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 								char szBuf[8096] = "";
 								snprintf(szBuf, 8096, "[updateRepair] unit->getPos() [%s] command->getPos()() [%s] repairPos [%s]", unit->getPos().getString().c_str(), command->getPos().getString().c_str(), repairPos.getString().c_str());
 								unit->logSynchData(__FILE__, __LINE__, szBuf);
 							}
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 							// If the repair command has no move skill and we are not next to
 							// the unit we cannot repair it
@@ -2168,7 +2170,7 @@ namespace Glest {
 								TravelState ts;
 								switch (this->game->getGameSettings()->getPathFinderType()) {
 									case pfBasic:
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 										ts = pathFinder->findPath(unit, repairPos, NULL, frameIndex);
 										break;
@@ -2176,22 +2178,22 @@ namespace Glest {
 										throw megaglest_runtime_error("detected unsupported pathfinder type!");
 								}
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] ts = %d\n", __FILE__, __FUNCTION__, __LINE__, ts);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] ts = %d\n", __FILE__, __FUNCTION__, __LINE__, ts);
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 								switch (ts) {
 									case tsMoving:
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsMoving\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsMoving\n", __FILE__, __FUNCTION__, __LINE__);
 										unit->setCurrSkill(rct->getMoveSkillType());
 										break;
 									case tsBlocked:
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsBlocked\n", __FILE__, __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] tsBlocked\n", __FILE__, __FUNCTION__, __LINE__);
 										if (unit->getPath()->isBlocked()) {
-											if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] about to call [scStop]\n", __FILE__, __FUNCTION__, __LINE__);
+											if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] about to call [scStop]\n", __FILE__, __FUNCTION__, __LINE__);
 
 											if (unit->getRetryCurrCommandCount() > 0) {
-												if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] will retry command, unit->getRetryCurrCommandCount() = %d\n", __FILE__, __FUNCTION__, __LINE__, unit->getRetryCurrCommandCount());
+												if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] will retry command, unit->getRetryCurrCommandCount() = %d\n", __FILE__, __FUNCTION__, __LINE__, unit->getRetryCurrCommandCount());
 												unit->setRetryCurrCommandCount(0);
 												unit->getPath()->clear();
 												updateUnitCommand(unit, -1);
@@ -2206,19 +2208,19 @@ namespace Glest {
 							}
 						}
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] about to call [scStop]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] about to call [scStop]\n", __FILE__, __FUNCTION__, __LINE__);
 
 						//console->addStdMessage("InvalidPosition");
 						unit->setCurrSkill(scStop);
 						unit->finishCommand();
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 					}
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 					bool cancelRepair = false;
 					//if repairing
 					if (repaired != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						// Check if we can still repair the unit (may have morphed, etc)
 						bool canStillRepair = rct->isRepairableUnitType(repaired->getType());
 						if (canStillRepair == true) {
@@ -2235,32 +2237,32 @@ namespace Glest {
 							cancelRepair = true;
 						}
 					} else if (peerUnitBuilder != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						unit->setTargetPos(command->getPos());
 					}
 
 					if (cancelRepair == false && (repaired == NULL || repaired->repair()) &&
 						peerUnitBuilder == NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] about to call [scStop]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] about to call [scStop]\n", __FILE__, __FUNCTION__, __LINE__);
 
 						unit->setCurrSkill(scStop);
 						unit->finishCommand();
 
 						if (repaired != NULL && repaired->isBuilt() == false) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							repaired->born(ct);
 							scriptManager->onUnitCreated(repaired);
 						}
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 					}
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -2282,14 +2284,14 @@ namespace Glest {
 					clearUnitPrecache(unit);
 					return;
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateProduce]");
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -2307,7 +2309,7 @@ namespace Glest {
 
 					unit->update2();
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 					if (unit->getProgress2() > pct->getProduced()->getProductionTime()) {
 						// finish producing/ upgrading if complete.
@@ -2326,13 +2328,13 @@ namespace Glest {
 
 						produced = new Unit(world->getNextUnitId(unit->getFaction()), newpath, Vec2i(0), pct->getProducedUnit(), unit->getFaction(), world->getMap(), CardinalDir(CardinalDir::NORTH));
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] about to place unit for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, produced->toString(false).c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] about to place unit for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, produced->toString(false).c_str());
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 						//place unit creates the unit
 						if (!world->placeUnit(unit->getCenteredPos(), 10, produced, false, frameIndex < 0)) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] COULD NOT PLACE UNIT for unitID [%d]\n", __FILE__, __FUNCTION__, __LINE__, produced->getId());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] COULD NOT PLACE UNIT for unitID [%d]\n", __FILE__, __FUNCTION__, __LINE__, produced->getId());
 							delete produced;
 						} else {
 							produced->create();
@@ -2341,23 +2343,23 @@ namespace Glest {
 							world->getStats()->produce(unit->getFactionIndex(), produced->getType()->getCountUnitProductionInStats());
 							const CommandType *ct = produced->computeCommandType(unit->getMeetingPos());
 							if (ct != NULL) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								produced->giveCommand(new Command(ct, unit->getMeetingPos()));
 							}
 							scriptManager->onUnitCreated(produced);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 						}
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -2380,14 +2382,14 @@ namespace Glest {
 					clearUnitPrecache(unit);
 					return;
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateUpgrade]");
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -2409,13 +2411,13 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -2437,14 +2439,14 @@ namespace Glest {
 					clearUnitPrecache(unit);
 					return;
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true && frameIndex < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true && frameIndex < 0) {
 					char szBuf[8096] = "";
 					snprintf(szBuf, 8096, "[updateMorph]");
 					unit->logSynchData(extractFileFromDirectoryPath(__FILE__).c_str(), __LINE__, szBuf);
 				}
 
 				Chrono chrono;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 				Command *command = unit->getCurrCommand();
 				if (command == NULL) {
@@ -2503,13 +2505,13 @@ namespace Glest {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld --------------------------- [END OF METHOD] ---------------------------\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis());
 
 			} catch (const exception &ex) {
 				//setRunningStatus(false);
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				throw megaglest_runtime_error(ex.what());
 			} catch (...) {
@@ -2784,82 +2786,97 @@ namespace Glest {
 			return unitOnRange(unit, range, rangedPtr, ast, evalMode);
 		}
 
-		bool UnitUpdater::findCachedCellsEnemies(Vec2i center, int range, int size, vector<Unit*> &enemies,
-			const AttackSkillType *ast, const Unit *unit,
-			const Unit *commandTarget) {
-			bool result = false;
-			MutexSafeWrapper safeMutex(mutexUnitRangeCellsLookupItemCache, string(__FILE__) + "_" + intToStr(__LINE__));
-			std::map<Vec2i, std::map<int, std::map<int, UnitRangeCellsLookupItem > > >::iterator iterFind = UnitRangeCellsLookupItemCache.find(center);
-
-			if (iterFind != UnitRangeCellsLookupItemCache.end()) {
-				std::map<int, std::map<int, UnitRangeCellsLookupItem > >::iterator iterFind3 = iterFind->second.find(size);
-				if (iterFind3 != iterFind->second.end()) {
-					std::map<int, UnitRangeCellsLookupItem>::iterator iterFind4 = iterFind3->second.find(range);
-					if (iterFind4 != iterFind3->second.end()) {
-						result = true;
-
-						std::vector<Cell *> &cellList = iterFind4->second.rangeCellList;
-						for (int idx = 0; idx < (int) cellList.size(); ++idx) {
-							Cell *cell = cellList[idx];
-
-							findEnemiesForCell(ast, cell, unit, commandTarget, enemies);
-						}
+		// Enemies of unit on the cells in range of center, in the order a column
+		// by column scan of those cells (then by field) finds them. Target
+		// selection keeps the first of equally good candidates so the order
+		// has to match between network players.
+		void UnitUpdater::findEnemiesInRange(const Unit *unit, const Vec2i &center,
+			const Vec2f &floatCenter, int size, int range,
+			const AttackSkillType *ast, const Unit *commandTarget,
+			vector<Unit*> &enemies) const {
+			const UnitSpatialIndex *unitSpatialIndex = map->getUnitSpatialIndex();
+
+			vector<UnitSpatialIndex::UnitCell> unitCells;
+			for (int factionIndex = 0; factionIndex < world->getFactionCount(); ++factionIndex) {
+				if (commandTarget != NULL) {
+					if (commandTarget->getFactionIndex() != factionIndex) {
+						continue;
 					}
+				} else if (unit->getFaction()->isAlly(world->getFaction(factionIndex)) == true) {
+					continue;
 				}
+				unitSpatialIndex->findUnitCells(factionIndex,
+					center.x - range, center.y - range,
+					center.x + range + size, center.y + range + size, unitCells);
 			}
+			std::sort(unitCells.begin(), unitCells.end());
 
-			return result;
-		}
-
-		void UnitUpdater::findEnemiesForCell(const AttackSkillType *ast, Cell *cell, const Unit *unit,
-			const Unit *commandTarget, vector<Unit*> &enemies) {
-			//all fields
-			for (int k = 0; k < fieldCount; k++) {
-				Field f = static_cast<Field>(k);
+			for (unsigned int index = 0; index < unitCells.size(); ++index) {
+				const UnitSpatialIndex::UnitCell &unitCell = unitCells[index];
+				Field f = static_cast<Field>(unitSpatialIndex->getCellKeyField(unitCell.cellKey));
 
 				//check field
-				if ((ast == NULL || ast->getAttackField(f))) {
-					Unit *possibleEnemy = cell->getUnit(f);
+				if (ast != NULL && ast->getAttackField(f) == false) {
+					continue;
+				}
+				Vec2i pos = unitSpatialIndex->getCellKeyPos(unitCell.cellKey);
+				if (isCellInRange(floatCenter, pos.x, pos.y, range) == false) {
+					continue;
+				}
 
-					//check enemy
-					if (possibleEnemy != NULL && possibleEnemy->isAlive()) {
-						if ((unit->isAlly(possibleEnemy) == false && commandTarget == NULL) ||
-							commandTarget == possibleEnemy) {
+				//check enemy
+				Unit *possibleEnemy = unitCell.unit;
+				if (possibleEnemy->isAlive()) {
+					if ((unit->isAlly(possibleEnemy) == false && commandTarget == NULL) ||
+						commandTarget == possibleEnemy) {
 
-							enemies.push_back(possibleEnemy);
-						}
+						enemies.push_back(possibleEnemy);
 					}
 				}
 			}
 		}
 
+		// Enemies of faction in the square around pos, ordered by field and then
+		// like a column by column scan of the square
+		static bool compareUnitCellsByField(const std::pair<int, UnitSpatialIndex::UnitCell> &l,
+			const std::pair<int, UnitSpatialIndex::UnitCell> &r) {
+			if (l.first != r.first) {
+				return l.first < r.first;
+			}
+			return l.second.cellKey < r.second.cellKey;
+		}
+
 		void UnitUpdater::findEnemiesForCell(const Vec2i pos, int size, int sightRange, const Faction *faction, vector<Unit*> &enemies, bool attackersOnly) const {
-			//all fields
-			for (int k = 0; k < fieldCount; k++) {
-				Field f = static_cast<Field>(k);
-
-				for (int i = pos.x - sightRange; i < pos.x + size + sightRange; ++i) {
-					for (int j = pos.y - sightRange; j < pos.y + size + sightRange; ++j) {
-						Vec2i testPos(i, j);
-						if (map->isInside(testPos) &&
-							map->isInsideSurface(map->toSurfCoords(testPos))) {
-							Cell *cell = map->getCell(testPos);
-							//check field
-							Unit *possibleEnemy = cell->getUnit(f);
-
-							//check enemy
-							if (possibleEnemy != NULL && possibleEnemy->isAlive()) {
-								if (faction->getTeam() != possibleEnemy->getTeam()) {
-									if (attackersOnly == true) {
-										if (possibleEnemy->getType()->hasCommandClass(ccAttack) || possibleEnemy->getType()->hasCommandClass(ccAttackStopped)) {
-											enemies.push_back(possibleEnemy);
-										}
-									} else {
-										enemies.push_back(possibleEnemy);
-									}
-								}
-							}
+			const UnitSpatialIndex *unitSpatialIndex = map->getUnitSpatialIndex();
+
+			vector<UnitSpatialIndex::UnitCell> unitCells;
+			for (int factionIndex = 0; factionIndex < world->getFactionCount(); ++factionIndex) {
+				if (world->getFaction(factionIndex)->getTeam() == faction->getTeam()) {
+					continue;
+				}
+				unitSpatialIndex->findUnitCells(factionIndex,
+					pos.x - sightRange, pos.y - sightRange,
+					pos.x + size + sightRange, pos.y + size + sightRange, unitCells);
+			}
+
+			vector<std::pair<int, UnitSpatialIndex::UnitCell> > fieldUnitCells;
+			fieldUnitCells.reserve(unitCells.size());
+			for (unsigned int index = 0; index < unitCells.size(); ++index) {
+				fieldUnitCells.push_back(std::make_pair(unitSpatialIndex->getCellKeyField(unitCells[index].cellKey), unitCells[index]));
+			}
+			std::sort(fieldUnitCells.begin(), fieldUnitCells.end(), compareUnitCellsByField);
+
+			for (unsigned int index = 0; index < fieldUnitCells.size(); ++index) {
+				Unit *possibleEnemy = fieldUnitCells[index].second.unit;
+
+				//check enemy
+				if (possibleEnemy->isAlive() && faction->getTeam() != possibleEnemy->getTeam()) {
+					if (attackersOnly == true) {
+						if (possibleEnemy->getType()->hasCommandClass(ccAttack) || possibleEnemy->getType()->hasCommandClass(ccAttackStopped)) {
+							enemies.push_back(possibleEnemy);
 						}
+					} else {
+						enemies.push_back(possibleEnemy);
 					}
 				}
 			}
@@ -2887,37 +2904,9 @@ namespace Glest {
 				Vec2i center = unit->getPos();
 				Vec2f floatCenter = unit->getFloatCenteredPos();
 
-				//bool foundInCache = true;
-				if (findCachedCellsEnemies(center, range, size, enemies, ast,
-					unit, commandTarget) == false) {
-
-					//foundInCache = false;
-					//nearby cells
-					UnitRangeCellsLookupItem cacheItem;
-					for (int i = center.x - range; i < center.x + range + size; ++i) {
-						for (int j = center.y - range; j < center.y + range + size; ++j) {
-							//cells inside map and in range
-#ifdef USE_STREFLOP
-							if (map->isInside(i, j) && streflop::floor(static_cast<streflop::Simple>(floatCenter.dist(Vec2f((float) i, (float) j)))) <= (range + 1)) {
-#else
-							if (map->isInside(i, j) && floor(floatCenter.dist(Vec2f((float) i, (float) j))) <= (range + 1)) {
-#endif
-								Cell *cell = map->getCell(i, j);
-								findEnemiesForCell(ast, cell, unit, commandTarget, enemies);
-
-								cacheItem.rangeCellList.push_back(cell);
-							}
-							}
-						}
-
-
-					// Ok update our caches with the latest info
-					if (cacheItem.rangeCellList.empty() == false) {
-						MutexSafeWrapper safeMutex(mutexUnitRangeCellsLookupItemCache, string(__FILE__) + "_" + intToStr(__LINE__));
-
-						UnitRangeCellsLookupItemCache[center][size][range] = cacheItem;
-					}
-					}
+				//nearby units
+				findEnemiesInRange(unit, center, floatCenter, size, range, ast,
+					commandTarget, enemies);
 
 				//attack enemies that can attack first
 				float distToUnit = -1;
@@ -3014,7 +3003,7 @@ namespace Glest {
 						float nearestDistance = 0.f;
 
 
-						MutexSafeWrapper safeMutex(mutexAttackWarnings, string(__FILE__) + "_" + intToStr(__LINE__));
+						MutexSafeWrapper safeMutex(mutexAttackWarnings, CODE_AT_LINE);
 						for (int i = (int) attackWarnings.size() - 1; i >= 0; --i) {
 							if (world->getFrameCount() - attackWarnings[i]->lastFrameCount > 200) { //after 200 frames attack break we warn again
 								AttackWarningData *toDelete = attackWarnings[i];
@@ -3060,7 +3049,7 @@ namespace Glest {
 							awd->attackPosition.x = enemyFloatCenter.x;
 							awd->attackPosition.y = enemyFloatCenter.y;
 
-							MutexSafeWrapper safeMutex(mutexAttackWarnings, string(__FILE__) + "_" + intToStr(__LINE__));
+							MutexSafeWrapper safeMutex(mutexAttackWarnings, CODE_AT_LINE);
 							attackWarnings.push_back(awd);
 
 							if (world->getAttackWarningsEnabled() == true) {
@@ -3077,7 +3066,7 @@ namespace Glest {
 					//setRunningStatus(false);
 
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 					throw megaglest_runtime_error(ex.what());
 				} catch (...) {
@@ -3118,42 +3107,15 @@ namespace Glest {
 				Vec2i center = unit->getPosNotThreadSafe();
 				Vec2f floatCenter = unit->getFloatCenteredPos();
 
-				//bool foundInCache = true;
-				if (findCachedCellsEnemies(center, range, size, enemies, ast,
-					unit, commandTarget) == false) {
-
-					//foundInCache = false;
-					//nearby cells
-					UnitRangeCellsLookupItem cacheItem;
-					for (int i = center.x - range; i < center.x + range + size; ++i) {
-						for (int j = center.y - range; j < center.y + range + size; ++j) {
-							//cells inside map and in range
-#ifdef USE_STREFLOP
-							if (map->isInside(i, j) && streflop::floor(static_cast<streflop::Simple>(floatCenter.dist(Vec2f((float) i, (float) j)))) <= (range + 1)) {
-#else
-							if (map->isInside(i, j) && floor(floatCenter.dist(Vec2f((float) i, (float) j))) <= (range + 1)) {
-#endif
-								Cell *cell = map->getCell(i, j);
-								findEnemiesForCell(ast, cell, unit, commandTarget, enemies);
-
-								cacheItem.rangeCellList.push_back(cell);
-							}
-							}
-						}
-
-					// Ok update our caches with the latest info
-					if (cacheItem.rangeCellList.empty() == false) {
-						MutexSafeWrapper safeMutex(mutexUnitRangeCellsLookupItemCache, string(__FILE__) + "_" + intToStr(__LINE__));
-
-						UnitRangeCellsLookupItemCache[center][size][range] = cacheItem;
-					}
-					}
+				//nearby units
+				findEnemiesInRange(unit, center, floatCenter, size, range, ast,
+					commandTarget, enemies);
 
 				} catch (const exception &ex) {
 					//setRunningStatus(false);
 
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 					throw megaglest_runtime_error(ex.what());
 				} catch (...) {
@@ -3167,36 +3129,6 @@ namespace Glest {
 			}
 
 
-		void UnitUpdater::findUnitsForCell(Cell *cell, vector<Unit*> &units) {
-			//all fields
-			if (cell != NULL) {
-				for (int k = 0; k < fieldCount; k++) {
-					Field f = static_cast<Field>(k);
-
-					//check field
-					Unit *cellUnit = cell->getUnit(f);
-
-					if (cellUnit != NULL && cellUnit->isAlive()) {
-						// check if unit already is in list
-						bool found = false;
-						//printf("---- search for cellUnit=%d\n",cellUnit->getId());
-						for (unsigned int i = 0; i < units.size(); ++i) {
-							Unit *unitInList = units[i];
-							//printf("compare unitInList=%d cellUnit=%d\n",unitInList->getId(),cellUnit->getId());
-							if (unitInList->getId() == cellUnit->getId()) {
-								found = true;
-								break;
-							}
-						}
-						if (found == false) {
-							//printf(">>> adding cellUnit=%d\n",cellUnit->getId());
-							units.push_back(cellUnit);
-						}
-					}
-				}
-			}
-		}
-
 		vector<Unit*> UnitUpdater::findUnitsInRange(const Unit *unit, int radius) {
 			int range = radius;
 			vector<Unit*> units;
@@ -3206,58 +3138,33 @@ namespace Glest {
 			Vec2i center = unit->getPosNotThreadSafe();
 			Vec2f floatCenter = unit->getFloatCenteredPos();
 
-			//nearby cells
-			//UnitRangeCellsLookupItem cacheItem;
-			for (int i = center.x - range; i < center.x + range + size; ++i) {
-				for (int j = center.y - range; j < center.y + range + size; ++j) {
-					//cells inside map and in range
-#ifdef USE_STREFLOP
-					if (map->isInside(i, j) && streflop::floor(static_cast<streflop::Simple>(floatCenter.dist(Vec2f((float) i, (float) j)))) <= (range + 1)) {
-#else
-					if (map->isInside(i, j) && floor(floatCenter.dist(Vec2f((float) i, (float) j))) <= (range + 1)) {
-#endif
-						Cell *cell = map->getCell(i, j);
-						findUnitsForCell(cell, units);
-					}
-					}
-				}
-
-			return units;
+			//nearby units of every faction, in cell scan order
+			const UnitSpatialIndex *unitSpatialIndex = map->getUnitSpatialIndex();
+			vector<UnitSpatialIndex::UnitCell> unitCells;
+			for (int factionIndex = 0; factionIndex < world->getFactionCount(); ++factionIndex) {
+				unitSpatialIndex->findUnitCells(factionIndex,
+					center.x - range, center.y - range,
+					center.x + range + size, center.y + range + size, unitCells);
 			}
+			std::sort(unitCells.begin(), unitCells.end());
 
-		string UnitUpdater::getUnitRangeCellsLookupItemCacheStats() {
-			string result = "";
-
-			int posCount = 0;
-			int sizeCount = 0;
-			int rangeCount = 0;
-			int rangeCountCellCount = 0;
-
-			MutexSafeWrapper safeMutex(mutexUnitRangeCellsLookupItemCache, string(__FILE__) + "_" + intToStr(__LINE__));
-			for (std::map<Vec2i, std::map<int, std::map<int, UnitRangeCellsLookupItem > > >::iterator iterMap1 = UnitRangeCellsLookupItemCache.begin();
-				iterMap1 != UnitRangeCellsLookupItemCache.end(); ++iterMap1) {
-				posCount++;
-
-				for (std::map<int, std::map<int, UnitRangeCellsLookupItem > >::iterator iterMap2 = iterMap1->second.begin();
-					iterMap2 != iterMap1->second.end(); ++iterMap2) {
-					sizeCount++;
-
-					for (std::map<int, UnitRangeCellsLookupItem>::iterator iterMap3 = iterMap2->second.begin();
-						iterMap3 != iterMap2->second.end(); ++iterMap3) {
-						rangeCount++;
-
-						rangeCountCellCount += (int) iterMap3->second.rangeCellList.size();
+			for (unsigned int index = 0; index < unitCells.size(); ++index) {
+				const UnitSpatialIndex::UnitCell &unitCell = unitCells[index];
+				Vec2i pos = unitSpatialIndex->getCellKeyPos(unitCell.cellKey);
+				if (isCellInRange(floatCenter, pos.x, pos.y, range) == true) {
+					Unit *cellUnit = unitCell.unit;
+					if (cellUnit->isAlive() &&
+						std::find(units.begin(), units.end(), cellUnit) == units.end()) {
+						units.push_back(cellUnit);
 					}
 				}
 			}
 
-			uint64 totalBytes = rangeCountCellCount * sizeof(Cell *);
-			totalBytes /= 1000;
+			return units;
+		}
 
-			char szBuf[8096] = "";
-			snprintf(szBuf, 8096, "pos [%d] size [%d] range [%d][%d] total KB: %s", posCount, sizeCount, rangeCount, rangeCountCellCount, formatNumber(totalBytes).c_str());
-			result = szBuf;
-			return result;
+		string UnitUpdater::getUnitSpatialIndexStats() {
+			return map->getUnitSpatialIndex()->getStats();
 		}
 
 		void UnitUpdater::saveGame(XmlNode *rootNode) {
@@ -57,15 +57,6 @@ namespace Glest {
 		class ParticleDamager;
 		class Cell;
 
-		class UnitRangeCellsLookupItem {
-		public:
-
-			//int UnitRangeCellsLookupItemCacheTimerCountIndex;
-			std::vector<Cell *> rangeCellList;
-
-			static time_t lastDebug;
-		};
-
 		class AttackWarningData {
 		public:
 			Vec2f attackPosition;
@@ -97,17 +88,10 @@ namespace Glest {
 			float attackWarnRange;
 			AttackWarnings attackWarnings;
 
-			Mutex *mutexUnitRangeCellsLookupItemCache;
-			std::map<Vec2i, std::map<int, std::map<int, UnitRangeCellsLookupItem > > > UnitRangeCellsLookupItemCache;
-			//std::map<int,ExploredCellsLookupKey> ExploredCellsLookupItemCacheTimer;
-			//int UnitRangeCellsLookupItemCacheTimerCount;
-
-			bool findCachedCellsEnemies(Vec2i center, int range,
-				int size, vector<Unit*> &enemies,
-				const AttackSkillType *ast, const Unit *unit,
-				const Unit *commandTarget);
-			void findEnemiesForCell(const AttackSkillType *ast, Cell *cell, const Unit *unit,
-				const Unit *commandTarget, vector<Unit*> &enemies);
+			void findEnemiesInRange(const Unit *unit, const Vec2i &center,
+				const Vec2f &floatCenter, int size, int range,
+				const AttackSkillType *ast, const Unit *commandTarget,
+				vector<Unit*> &enemies) const;
 
 		public:
 			UnitUpdater();
@@ -145,7 +129,7 @@ namespace Glest {
 
 			vector<Unit*> findUnitsInRange(const Unit *unit, int radius);
 
-			string getUnitRangeCellsLookupItemCacheStats();
+			string getUnitSpatialIndexStats();
 
 			void saveGame(XmlNode *rootNode);
 			void loadGame(const XmlNode *rootNode);
@@ -176,7 +160,6 @@ namespace Glest {
 			void SwapActiveCommandState(Unit *unit, CommandStateType commandStateType,
 				const CommandType *commandType,
 				int originalValue, int newValue);
-			void findUnitsForCell(Cell *cell, vector<Unit*> &units);
 
 		};
 
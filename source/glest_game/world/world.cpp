@@ -33,6 +33,8 @@
 #include "sound_renderer.h"
 #include "game_settings.h"
 #include "cache_manager.h"
+#include "simulation_benchmark.h"
+#include "path_abstraction.h"
 #include <iostream>
 #include "sound.h"
 #include "sound_renderer.h"
@@ -57,7 +59,7 @@ namespace Glest {
 		// ===================== PUBLIC ========================
 
 		World::World() : mutexFactionNextUnitId(new Mutex(CODE_AT_LINE)) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			Config &config = Config::getInstance();
 
 			unitParticlesEnabled = config.getBool("UnitParticles", "true");
@@ -75,6 +77,8 @@ namespace Glest {
 
 			fogOfWarSmoothing = config.getBool("FogOfWarSmoothing");
 			fogOfWarSmoothingFrameSkip = config.getInt("FogOfWarSmoothingFrameSkip");
+			incrementalFogOfWar = config.getBool("EnableIncrementalFogOfWar", "false");
+			fogOfWarPassIndex = 0;
 
 			frameCount = 0;
 
@@ -91,29 +95,30 @@ namespace Glest {
 			disableAttackEffects = false;
 
 			loadWorldNode = NULL;
+			unitTaskPool = NULL;
 			cacheFowAlphaTexture = false;
 			cacheFowAlphaTextureFogOfWarValue = false;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::cleanup() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			animatedTilesetObjectPosListLoaded = false;
 
 			ExploredCellsLookupItemCache.clear();
 			ExploredCellsLookupItemCacheTimer.clear();
 			//FowAlphaCellsLookupItemCache.clear();
+			fogOfWarContributions.clear();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			for (int i = 0; i < (int) factions.size(); ++i) {
 				factions[i]->end();
 			}
 
-			masterController.clearSlaves(true);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			for (int i = 0; i < (int) factions.size(); ++i) {
 				delete factions[i];
 			}
@@ -125,12 +130,12 @@ namespace Glest {
 			UnitPathBasic::dumpMemoryList();
 #endif
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			delete techTree;
 			techTree = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			for (std::map<string, ::Shared::Sound::StaticSound *>::iterator iterMap = staticSoundList.begin();
 				iterMap != staticSoundList.end(); ++iterMap) {
@@ -144,24 +149,27 @@ namespace Glest {
 			}
 			streamSoundList.clear();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		World::~World() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			cleanup();
 
+			delete unitTaskPool;
+			unitTaskPool = NULL;
+
 			delete mutexFactionNextUnitId;
 			mutexFactionNextUnitId = NULL;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::endScenario() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			Logger::getInstance().add(Lang::getInstance().getString("LogScreenGameUnLoadingWorld", "", true), true);
 
 			animatedTilesetObjectPosListLoaded = false;
@@ -178,11 +186,11 @@ namespace Glest {
 			map.end();
 
 			//stats will be deleted by BattleEnd
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::end() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			Logger::getInstance().add(Lang::getInstance().getString("LogScreenGameUnLoadingWorld", "", true), true);
 
 			animatedTilesetObjectPosListLoaded = false;
@@ -194,7 +202,6 @@ namespace Glest {
 				factions[i]->end();
 			}
 
-			masterController.clearSlaves(true);
 			for (int i = 0; i < (int) factions.size(); ++i) {
 				delete factions[i];
 			}
@@ -215,7 +222,7 @@ namespace Glest {
 			cacheFowAlphaTextureFogOfWarValue = false;
 
 			//stats will be deleted by BattleEnd
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		// ========================== init ===============================================
@@ -334,7 +341,7 @@ namespace Glest {
 
 		void World::init(Game *game, bool createUnits, bool initFactions) {
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			ExploredCellsLookupItemCache.clear();
 			ExploredCellsLookupItemCacheTimer.clear();
@@ -435,7 +442,7 @@ namespace Glest {
 				throw megaglest_runtime_error(sErrBuf, !skipStackTrace);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		//load tileset
@@ -443,12 +450,12 @@ namespace Glest {
 			Checksum* checksum, std::map<string, vector<pair<string, string> > > &loadedFileList) {
 			Checksum tilsetChecksum;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			tilsetChecksum = tileset.loadTileset(pathList, tilesetName, checksum, loadedFileList);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			timeFlow.init(&tileset);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			return tilsetChecksum;
 		}
@@ -456,11 +463,11 @@ namespace Glest {
 		Checksum World::loadTileset(const string &dir, Checksum *checksum, std::map<string, vector<pair<string, string> > > &loadedFileList) {
 			Checksum tilesetChecksum;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			tileset.load(dir, checksum, &tilesetChecksum, loadedFileList);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			timeFlow.init(&tileset);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			return tilesetChecksum;
 		}
@@ -472,7 +479,7 @@ namespace Glest {
 			bool validationMode) {
 			Checksum techtreeChecksum;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			techTree = new TechTree(pathList);
 			techtreeChecksum = techTree->loadTech(techName, factions,
@@ -497,11 +504,11 @@ namespace Glest {
 		//load map
 		Checksum World::loadMap(const string &path, Checksum *checksum) {
 			Checksum mapChecksum;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			checksum->addFile(path);
 			mapChecksum = map.load(path, techTree, &tileset);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			return mapChecksum;
 		}
 
@@ -510,7 +517,7 @@ namespace Glest {
 			//printf("[%s:%s] Line: %d path [%s]\n",__FILE__,__FUNCTION__,__LINE__,path.c_str());
 
 			Checksum scenarioChecksum;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			checksum->addFile(path);
 
 			//printf("[%s:%s] Line: %d\n",__FILE__,__FUNCTION__,__LINE__);
@@ -521,7 +528,7 @@ namespace Glest {
 			}
 
 			scenarioChecksum = scenario.load(path);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			return scenarioChecksum;
 		}
 
@@ -590,6 +597,7 @@ namespace Glest {
 			if (showPerfStats) chronoPerf.start();
 			char perfBuf[8096] = "";
 			std::vector<string> perfList;
+			map.setWalkabilityCacheStatsEnabled(showPerfStats);
 
 			if (scriptManager) scriptManager->onTimerTriggerEvent();
 
@@ -628,23 +636,41 @@ namespace Glest {
 			Chrono chrono;
 			chrono.start();
 
-			const bool newThreadManager = Config::getInstance().getBool("EnableNewThreadManager", "false");
-			if (newThreadManager == true) {
-				masterController.signalSlaves(&frameCount);
-				bool slavesCompleted = masterController.waitTillSlavesTrigger(20000);
-
-				if (SystemFlags::VERBOSE_MODE_ENABLED && chrono.getMillis() >= 10) printf("In [%s::%s Line: %d] *** Faction thread preprocessing took [%lld] msecs for %d factions for frameCount = %d slavesCompleted = %d.\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), factionCount, frameCount, slavesCompleted);
-
-				if (showPerfStats) {
-					sprintf(perfBuf, "In [%s::%s] Line: %d took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chronoPerf.getMillis());
-					perfList.push_back(perfBuf);
+			// Let the thread pool do any pathfinding pre-processing. Each faction's
+			// units are split in batches chained in unit order, so the results
+			// only depend on the frame and not on which thread ran them
+			if (getGameSettings()->getPathFinderType() == pfBasic) {
+				if (unitTaskPool == NULL) {
+					int workerCount = Config::getInstance().getInt("PathfinderThreadCount", "0");
+					if (workerCount <= 0) {
+						workerCount = WorkStealingThreadPool::getDefaultWorkerCount();
+					}
+					static const char *mutexOwnerId = CODE_AT_LINE;
+					unitTaskPool = new WorkStealingThreadPool(workerCount, mutexOwnerId);
 				}
 
-			} else {
-				// Signal the faction threads to do any pre-processing
+				unitPathfindingTasks.clear();
+				unitPathfindingChains.clear();
 				for (int i = 0; i < factionCount; ++i) {
 					Faction *faction = getFaction(i);
-					faction->signalWorkerThread(frameCount);
+					int unitCount = faction->getUnitCount();
+					for (int j = 0; j < unitCount; j += unitPathfindingBatchSize) {
+						UnitPathfindingTask task;
+						task.faction = faction;
+						task.frameIndex = frameCount;
+						task.unitIndexBegin = j;
+						task.unitIndexEnd = j + unitPathfindingBatchSize;
+						unitPathfindingTasks.push_back(task);
+					}
+				}
+				// link the chains once the task list stopped growing
+				for (unsigned int i = 0; i < unitPathfindingTasks.size(); ++i) {
+					UnitPathfindingTask &task = unitPathfindingTasks[i];
+					if (task.unitIndexBegin == 0) {
+						unitPathfindingChains.push_back(&task);
+					} else {
+						unitPathfindingTasks[i - 1].setNextTask(&task);
+					}
 				}
 
 				if (showPerfStats) {
@@ -652,34 +678,15 @@ namespace Glest {
 					perfList.push_back(perfBuf);
 				}
 
-				Chrono chrono;
-				chrono.start();
+				// the threads only read the abstract graph, so repair it first
+				map.getPathAbstraction()->update();
 
 				const int MAX_FACTION_THREAD_WAIT_MILLISECONDS = 20000;
-				for (; chrono.getMillis() < MAX_FACTION_THREAD_WAIT_MILLISECONDS;) {
-					bool workThreadsFinished = true;
-					for (int i = 0; i < factionCount; ++i) {
-						Faction *faction = getFaction(i);
-						if (faction->isWorkerThreadSignalCompleted(frameCount) == false) {
-							workThreadsFinished = false;
-							break;
-						}
-					}
-					if (workThreadsFinished == true) {
-						break;
-					}
-					// WARNING... Sleep in here causes the server to lag a bit
-					//if(chrono.getMillis() % 5 == 0) {
-					//	sleep(0);
-					//}
-				}
+				SimulationBenchmarkTimer benchmarkPrecomputeTimer(sbsPathfindingPrecompute);
+				bool tasksCompleted = unitTaskPool->runTasks(unitPathfindingChains, MAX_FACTION_THREAD_WAIT_MILLISECONDS);
+				benchmarkPrecomputeTimer.stop();
 
-				if (showPerfStats) {
-					sprintf(perfBuf, "In [%s::%s] Line: %d took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chronoPerf.getMillis());
-					perfList.push_back(perfBuf);
-				}
-
-				if (SystemFlags::VERBOSE_MODE_ENABLED && chrono.getMillis() >= 10) printf("In [%s::%s Line: %d] *** Faction thread preprocessing took [%lld] msecs for %d factions for frameCount = %d.\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), factionCount, frameCount);
+				if (SystemFlags::VERBOSE_MODE_ENABLED && chrono.getMillis() >= 10) printf("In [%s::%s Line: %d] *** Faction thread preprocessing took [%lld] msecs for %d factions %d tasks for frameCount = %d tasksCompleted = %d.\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), factionCount, (int) unitPathfindingTasks.size(), frameCount, tasksCompleted);
 			}
 
 			if (showPerfStats) {
@@ -688,6 +695,7 @@ namespace Glest {
 			}
 
 			//units
+			SimulationBenchmarkTimer benchmarkUnitsTimer(sbsUnitUpdates);
 			Chrono chronoPerfUnit;
 			int totalUnitsChecked = 0;
 			int totalUnitsProcessed = 0;
@@ -766,10 +774,17 @@ namespace Glest {
 				}
 			}
 
+			benchmarkUnitsTimer.stop();
+
 			if (showPerfStats) {
 				sprintf(perfBuf, "In [%s::%s] Line: %d took msecs: " MG_I64_SPECIFIER " totalUnitsProcessed = %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chronoPerf.getMillis(), totalUnitsProcessed);
 				perfList.push_back(perfBuf);
+
+				int64 walkabilityLookups = map.getWalkabilityCacheHits() + map.getWalkabilityCacheMisses();
+				sprintf(perfBuf, "Walkability cache hits = " MG_I64_SPECIFIER " misses = " MG_I64_SPECIFIER " hit rate = %.1f%%\n", map.getWalkabilityCacheHits(), map.getWalkabilityCacheMisses(), (walkabilityLookups > 0 ? map.getWalkabilityCacheHits() * 100.0 / walkabilityLookups : 0.0));
+				perfList.push_back(perfBuf);
 			}
+			map.resetWalkabilityCacheStats();
 
 			if (showPerfStats && chronoPerf.getMillis() >= 50) {
 				for (unsigned int x = 0; x < perfList.size(); ++x) {
@@ -781,17 +796,17 @@ namespace Glest {
 		}
 
 		void World::underTakeDeadFactionUnits() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			int factionCount = getFactionCount();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] factionCount = %d\n", __FILE__, __FUNCTION__, __LINE__, factionCount);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] factionCount = %d\n", __FILE__, __FUNCTION__, __LINE__, factionCount);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			//undertake the dead
 			for (int i = 0; i < factionCount; ++i) {
 				Faction *faction = getFaction(i);
 				int unitCount = faction->getUnitCount();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] i = %d, unitCount = %d\n", __FILE__, __FUNCTION__, __LINE__, i, unitCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] i = %d, unitCount = %d\n", __FILE__, __FUNCTION__, __LINE__, i, unitCount);
 
 				for (int j = unitCount - 1; j >= 0; j--) {
 					Unit *unit = faction->getUnit(j);
@@ -801,17 +816,17 @@ namespace Glest {
 					}
 
 					if (unit->getToBeUndertaken() == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 						unit->undertake();
 						delete unit;
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					}
 				}
 
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		void World::updateAllFactionConsumableCosts() {
@@ -835,7 +850,7 @@ namespace Glest {
 
 		void World::update() {
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			bool showPerfStats = Config::getInstance().getBool("ShowPerfStats", "false");
 			Chrono chronoPerf;
@@ -844,6 +859,7 @@ namespace Glest {
 			if (showPerfStats) chronoPerf.start();
 
 			Chrono chronoGamePerformanceCounts;
+			SimulationBenchmarkTimer benchmarkTimer(sbsWorldUpdate);
 
 			++frameCount;
 
@@ -866,7 +882,7 @@ namespace Glest {
 				perfList.push_back(perfBuf);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			// objects on the map from tilesets
 			if (this->game) chronoGamePerformanceCounts.start();
 
@@ -904,7 +920,7 @@ namespace Glest {
 					perfList.push_back(perfBuf);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				//food costs
 				if (this->game) chronoGamePerformanceCounts.start();
@@ -918,7 +934,7 @@ namespace Glest {
 					perfList.push_back(perfBuf);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 				//fow smoothing
 				if (fogOfWarSmoothing && ((frameCount + 1) % (fogOfWarSmoothingFrameSkip + 1)) == 0) {
 					if (this->game) chronoGamePerformanceCounts.start();
@@ -934,7 +950,7 @@ namespace Glest {
 					perfList.push_back(perfBuf);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 				//tick
 				bool needToTick = canTickWorld();
 
@@ -945,7 +961,7 @@ namespace Glest {
 
 				if (needToTick == true) {
 					//printf("=========== World is about to be updated, current frameCount = %d\n",frameCount);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 					if (this->game) chronoGamePerformanceCounts.start();
 
@@ -965,7 +981,7 @@ namespace Glest {
 					printf("%s", perfList[x].c_str());
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 		}
 
 		bool World::canTickWorld() const {
@@ -981,6 +997,8 @@ namespace Glest {
 			std::vector<string> perfList;
 			if (showPerfStats) chronoPerf.start();
 
+			SimulationBenchmarkTimer benchmarkTimer(sbsWorldTick);
+
 			if (showPerfStats) {
 				sprintf(perfBuf, "In [%s::%s] Line: %d took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chronoPerf.getMillis());
 				perfList.push_back(perfBuf);
@@ -1280,50 +1298,50 @@ namespace Glest {
 		}
 
 		void World::morphToUnit(int unitId, const string &morphName, bool ignoreRequirements) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d] morphName [%s] forceUpgradesIfRequired = %d\n", __FILE__, __FUNCTION__, __LINE__, unitId, morphName.c_str(), ignoreRequirements);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d] morphName [%s] forceUpgradesIfRequired = %d\n", __FILE__, __FUNCTION__, __LINE__, unitId, morphName.c_str(), ignoreRequirements);
 			Unit* unit = findUnitById(unitId);
 			if (unit != NULL) {
 				for (int i = 0; i < unit->getType()->getCommandTypeCount(); ++i) {
 					const CommandType *ct = unit->getType()->getCommandType(i);
 					const MorphCommandType *mct = dynamic_cast<const MorphCommandType *>(ct);
 					if (mct != NULL && mct->getName(false) == morphName) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d] morphName [%s] comparing mct [%s]\n", __FILE__, __FUNCTION__, __LINE__, unitId, morphName.c_str(), mct->getName(false).c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d] morphName [%s] comparing mct [%s]\n", __FILE__, __FUNCTION__, __LINE__, unitId, morphName.c_str(), mct->getName(false).c_str());
 
 						std::pair<CommandResult, string> cr(crFailUndefined, "");
 						try {
 							if (unit->getFaction()->reqsOk(mct) == false && ignoreRequirements == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d] morphName [%s] comparing mct [%s] mct->getUpgradeReqCount() = %d\n", __FILE__, __FUNCTION__, __LINE__, unitId, morphName.c_str(), mct->getName(false).c_str(), mct->getUpgradeReqCount());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d] morphName [%s] comparing mct [%s] mct->getUpgradeReqCount() = %d\n", __FILE__, __FUNCTION__, __LINE__, unitId, morphName.c_str(), mct->getName(false).c_str(), mct->getUpgradeReqCount());
 								unit->setIgnoreCheckCommand(true);
 							}
 
 							const UnitType* unitType = mct->getMorphUnit();
 							cr = this->game->getCommander()->tryGiveCommand(unit, mct, unit->getPos(), unitType, CardinalDir(CardinalDir::NORTH));
 						} catch (const exception &ex) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							unit->setIgnoreCheckCommand(false);
 
 							throw megaglest_runtime_error(ex.what());
 						}
 
 						if (cr.first == crSuccess) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						} else {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d] morphName [%s] comparing mct [%s] returned = %d\n", __FILE__, __FUNCTION__, __LINE__, unitId, morphName.c_str(), mct->getName(false).c_str(), cr.first);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d] morphName [%s] comparing mct [%s] returned = %d\n", __FILE__, __FUNCTION__, __LINE__, unitId, morphName.c_str(), mct->getName(false).c_str(), cr.first);
 
 						break;
 					}
 				}
 
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 		}
 
 		void World::createUnit(const string &unitName, int factionIndex, const Vec2i &pos, bool spaciated) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unitName [%s] factionIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, unitName.c_str(), factionIndex);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unitName [%s] factionIndex = %d\n", __FILE__, __FUNCTION__, __LINE__, unitName.c_str(), factionIndex);
 
 			if (factionIndex < (int) factions.size()) {
 				Faction* faction = factions[factionIndex];
@@ -1346,7 +1364,7 @@ namespace Glest {
 
 				Unit* unit = new Unit(getNextUnitId(faction), newpath, pos, ut, faction, &map, CardinalDir(CardinalDir::NORTH));
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
 
 				if (placeUnit(pos, generationArea, unit, spaciated)) {
 					unit->create(true);
@@ -1365,12 +1383,12 @@ namespace Glest {
 					throw megaglest_runtime_error("Unit cant be placed", true);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
 			} else {
 				throw megaglest_runtime_error("Invalid faction index in createUnitAtPosition: " + intToStr(factionIndex), true);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::giveResource(const string &resourceName, int factionIndex, int amount) {
@@ -1385,7 +1403,7 @@ namespace Glest {
 
 		int World::getUnitCurrentField(int unitId) {
 			int field = -1;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d]\n", __FILE__, __FUNCTION__, __LINE__, unitId);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d]\n", __FILE__, __FUNCTION__, __LINE__, unitId);
 			Unit* unit = findUnitById(unitId);
 			if (unit != NULL) {
 				field = unit->getCurrField();
@@ -1396,7 +1414,7 @@ namespace Glest {
 
 		bool World::getIsUnitAlive(int unitId) {
 			bool result = false;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d]\n", __FILE__, __FUNCTION__, __LINE__, unitId);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] unit [%d]\n", __FILE__, __FUNCTION__, __LINE__, unitId);
 			Unit* unit = findUnitById(unitId);
 			if (unit != NULL) {
 				result = unit->isAlive();
@@ -1463,9 +1481,9 @@ namespace Glest {
 				if (unit->getType()->getFirstCtOfClass(cc) == NULL) {
 					throw megaglest_runtime_error("Invalid command: [" + commandName + "] for unit: [" + unit->getType()->getName(false) + "] id [" + intToStr(unit->getId()) + "]", true);
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] cc = %d Unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, cc, unit->getFullName(false).c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] cc = %d Unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, cc, unit->getFullName(false).c_str());
 				unit->giveCommand(new Command(unit->getType()->getFirstCtOfClass(cc), pos));
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			} else {
 				throw megaglest_runtime_error("Invalid unitId index in givePositionCommand: " + intToStr(unitId) + " commandName = " + commandName, true);
 			}
@@ -1476,10 +1494,10 @@ namespace Glest {
 			if (unit != NULL) {
 				const CommandType *ct = unit->getType()->getFirstCtOfClass(ccStop);
 				if (ct != NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] Unit [%s] will stop\n", __FILE__, __FUNCTION__, __LINE__, unit->getFullName(false).c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] Unit [%s] will stop\n", __FILE__, __FUNCTION__, __LINE__, unit->getFullName(false).c_str());
 					unit->giveCommand(new Command(ct));
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				} else {
 					throw megaglest_runtime_error("Invalid ct in giveStopCommand: " + intToStr(unitId), true);
 				}
@@ -1544,9 +1562,9 @@ namespace Glest {
 				if (targetUnit != NULL) {
 					const CommandType *ct = unit->getType()->getFirstAttackCommand(targetUnit->getCurrField());
 					if (ct != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] Unit [%s] is attacking [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->getFullName(false).c_str(), targetUnit->getFullName(false).c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] Unit [%s] is attacking [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->getFullName(false).c_str(), targetUnit->getFullName(false).c_str());
 						unit->giveCommand(new Command(ct, targetUnit));
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 					} else {
 						throw megaglest_runtime_error("Invalid ct in giveAttackCommand: " + intToStr(unitId) + " unitToAttackId = " + intToStr(unitToAttackId), true);
 					}
@@ -1577,13 +1595,13 @@ namespace Glest {
 						const ProduceCommandType *pct = dynamic_cast<const ProduceCommandType*>(ct);
 						if (pct != NULL && pct->getProducedUnit() != NULL &&
 							pct->getProducedUnit()->getName(false) == producedName) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 							//printf("File: %s line: %d\n",extractFileFromDirectoryPath(__FILE__).c_str(),__LINE__);
 							unit->giveCommand(new Command(pct));
 							//printf("File: %s line: %d\n",extractFileFromDirectoryPath(__FILE__).c_str(),__LINE__);
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							break;
 						}
 					}
@@ -1607,25 +1625,25 @@ namespace Glest {
 						const AttackStoppedCommandType *act = static_cast<const AttackStoppedCommandType*>(ct);
 						if (act != NULL && act->getName(false) == itemName) {
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 							try {
 								if (unit->getFaction()->reqsOk(act) == false && ignoreRequirements == true) {
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 									unit->setIgnoreCheckCommand(true);
 								}
 
 								unit->giveCommand(new Command(act));
 							} catch (const exception &ex) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								unit->setIgnoreCheckCommand(false);
 
 								throw megaglest_runtime_error(ex.what());
 							}
 
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							break;
 						}
 					}
@@ -1636,7 +1654,7 @@ namespace Glest {
 		}
 
 		void World::playStaticSound(const string &playSound) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] playSound [%s]\n", __FILE__, __FUNCTION__, __LINE__, playSound.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] playSound [%s]\n", __FILE__, __FUNCTION__, __LINE__, playSound.c_str());
 
 			string calculatedFilePath = playSound;
 			bool changed = Properties::applyTagsToValue(calculatedFilePath);
@@ -1654,7 +1672,7 @@ namespace Glest {
 		}
 
 		void World::playStreamingSound(const string &playSound) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] playSound [%s]\n", __FILE__, __FUNCTION__, __LINE__, playSound.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] playSound [%s]\n", __FILE__, __FUNCTION__, __LINE__, playSound.c_str());
 
 			string calculatedFilePath = playSound;
 			bool changed = Properties::applyTagsToValue(calculatedFilePath);
@@ -1673,7 +1691,7 @@ namespace Glest {
 		}
 
 		void World::stopStreamingSound(const string &playSound) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] playSound [%s]\n", __FILE__, __FUNCTION__, __LINE__, playSound.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] playSound [%s]\n", __FILE__, __FUNCTION__, __LINE__, playSound.c_str());
 
 			string calculatedFilePath = playSound;
 			bool changed = Properties::applyTagsToValue(calculatedFilePath);
@@ -1687,7 +1705,7 @@ namespace Glest {
 		}
 
 		void World::stopAllSound() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			SoundRenderer &soundRenderer = SoundRenderer::getInstance();
 			soundRenderer.stopAllSounds();
 		}
@@ -1696,12 +1714,12 @@ namespace Glest {
 			Unit* unit = findUnitById(unitId);
 			if (unit != NULL) {
 				CommandClass cc = ccMove;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] cc = %d Unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, cc, unit->getFullName(false).c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] cc = %d Unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, cc, unit->getFullName(false).c_str());
 				Unit* destUnit = findUnitById(destUnitId);
 				if (destUnit != NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] cc = %d Unit [%s] destUnit [%s]\n", __FILE__, __FUNCTION__, __LINE__, cc, unit->getFullName(false).c_str(), destUnit->getFullName(false).c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d] cc = %d Unit [%s] destUnit [%s]\n", __FILE__, __FUNCTION__, __LINE__, cc, unit->getFullName(false).c_str(), destUnit->getFullName(false).c_str());
 					unit->giveCommand(new Command(unit->getType()->getFirstCtOfClass(cc), destUnit));
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				}
 			} else {
 				throw megaglest_runtime_error("Invalid unitId index in followUnit: " + intToStr(unitId), true);
@@ -1768,11 +1786,11 @@ namespace Glest {
 					if (ct != NULL && ct->getClass() == ccUpgrade) {
 						const UpgradeCommandType *uct = static_cast<const UpgradeCommandType*>(ct);
 						if (uct != NULL && uct->getProducedUpgrade()->getName() == upgradeName) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 							unit->giveCommand(new Command(uct));
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands)) SystemFlags::OutputDebug(SystemFlags::debugUnitCommands, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							break;
 						}
 					}
@@ -1947,7 +1965,7 @@ namespace Glest {
 
 		//init basic cell state
 		void World::initCells(bool fogOfWar) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			Logger::getInstance().add(Lang::getInstance().getString("LogScreenGameLoadingStateCells", "", true), true);
 			for (int i = 0; i < map.getSurfaceW(); ++i) {
@@ -1974,7 +1992,7 @@ namespace Glest {
 						sc->setVisible(k, true);
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true) {
 						char szBuf[8096] = "";
 						snprintf(szBuf, 8096, "In initCells() x = %d y = %d %s %s", i, j, sc->isVisibleString().c_str(), sc->isExploredString().c_str());
 						if (Thread::isCurrentThreadMainThread()) {
@@ -1984,12 +2002,12 @@ namespace Glest {
 					}
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		//init surface textures
 		void World::initSplattedTextures() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			for (int i = 0; i < map.getSurfaceW() - 1; ++i) {
 				for (int j = 0; j < map.getSurfaceH() - 1; ++j) {
 					Vec2f coord;
@@ -2021,12 +2039,12 @@ namespace Glest {
 					sc00->setSurfaceTexture(texture);
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		//creates each faction looking at each faction name contained in GameSettings
 		void World::initFactionTypes(GameSettings *gs) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			Logger::getInstance().add(Lang::getInstance().getString("LogScreenGameLoadingFactionTypes", "", true), true);
 
 			if (gs == NULL) {
@@ -2053,7 +2071,7 @@ namespace Glest {
 
 			stats.init(gs->getFactionCount(), this->thisFactionIndex, gs->getDescription(), gs->getTech());
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//create factions
 			//printf("this->thisFactionIndex = %d\n",this->thisFactionIndex);
@@ -2064,7 +2082,7 @@ namespace Glest {
 				factions.push_back(newFaction);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] factions.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, factions.size());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] factions.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, factions.size());
 
 			for (int i = 0; i < (int) factions.size(); ++i) {
 				FactionType *ft = techTree->getTypeByName(gs->getFactionTypeName(i));
@@ -2086,15 +2104,6 @@ namespace Glest {
 				}
 			}
 
-			if (Config::getInstance().getBool("EnableNewThreadManager", "false") == true) {
-				std::vector<SlaveThreadControllerInterface *> slaveThreadList;
-				for (unsigned int i = 0; i < factions.size(); ++i) {
-					Faction *faction = factions[i];
-					slaveThreadList.push_back(faction->getWorkerThread());
-				}
-				masterController.setSlaves(slaveThreadList);
-			}
-
 			if (loadWorldNode != NULL) {
 				stats.loadGame(loadWorldNode);
 				random.setLastNumber(loadWorldNode->getAttribute("random")->getIntValue());
@@ -2107,7 +2116,7 @@ namespace Glest {
 
 				//printf("**LOAD World thisFactionIndex = %d\n",thisFactionIndex);
 
-				MutexSafeWrapper safeMutex(mutexFactionNextUnitId, string(__FILE__) + "_" + intToStr(__LINE__));
+				MutexSafeWrapper safeMutex(mutexFactionNextUnitId, CODE_AT_LINE);
 				//	std::map<int,int> mapFactionNextUnitId;
 			//		for(std::map<int,int>::iterator iterMap = mapFactionNextUnitId.begin();
 			//				iterMap != mapFactionNextUnitId.end(); ++iterMap) {
@@ -2157,7 +2166,7 @@ namespace Glest {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			if (factions.empty() == false) {
 				if (this->game->isMasterserverMode() == true) {
@@ -2166,20 +2175,20 @@ namespace Glest {
 					thisTeamIndex = getFaction(thisFactionIndex)->getTeam();
 				}
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::initMinimap() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			minimap.init(map.getW(), map.getH(), this, game->getGameSettings()->getFogOfWar());
 			Logger::getInstance().add(Lang::getInstance().getString("LogScreenGameLoadingMinimapSurface", "", true), true);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::initUnitsForScenario() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			Logger::getInstance().add(Lang::getInstance().getString("LogScreenGameLoadingGenerateGameElements", "", true), true);
 
 			//put starting units
@@ -2207,7 +2216,7 @@ namespace Glest {
 					if (unit->getType()->hasSkillClass(scBeBuilt)) {
 						map.flatternTerrain(unit);
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
 				}
 
 				// Ensure Starting Resource Amount are adjusted to max store levels
@@ -2215,7 +2224,7 @@ namespace Glest {
 			}
 			map.computeNormals();
 			map.computeInterpolatedHeights();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::placeUnitAtLocation(const Vec2i &location, int radius, Unit *unit, bool spaciated) {
@@ -2238,13 +2247,13 @@ namespace Glest {
 			if (unit->getType()->hasSkillClass(scBeBuilt)) {
 				map.flatternTerrain(unit);
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unit created for unit [%s]\n", __FILE__, __FUNCTION__, __LINE__, unit->toString().c_str());
 
 		}
 
 		//place units randomly aroud start location
 		void World::initUnits() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			Logger::getInstance().add(Lang::getInstance().getString("LogScreenGameLoadingGenerateGameElements", "", true), true);
 
 			bool gotError = false;
@@ -2313,7 +2322,7 @@ namespace Glest {
 			if (gotError == true) {
 				throw megaglest_runtime_error(sErrBuf, !skipStackTrace);
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::refreshAllUnitExplorations() {
@@ -2328,9 +2337,9 @@ namespace Glest {
 		}
 
 		void World::initMap() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			map.init(&tileset);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void World::exploreCells(int teamIndex, ExploredCellsLookupItem &exploredCellsCache) {
@@ -2353,8 +2362,8 @@ namespace Glest {
 			if (MaxExploredCellsLookupItemCache > 0) {
 				if (difftime(time(NULL), ExploredCellsLookupItem::lastDebug) >= 10) {
 					ExploredCellsLookupItem::lastDebug = time(NULL);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] ExploredCellsLookupItemCache.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, ExploredCellsLookupItemCache.size());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] ExploredCellsLookupItemCache.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, ExploredCellsLookupItemCache.size());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] ExploredCellsLookupItemCache.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, ExploredCellsLookupItemCache.size());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] ExploredCellsLookupItemCache.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, ExploredCellsLookupItemCache.size());
 				}
 
 				// Ok we limit the cache size due to possible RAM constraints when
@@ -2431,8 +2440,8 @@ namespace Glest {
 						bool updateExplored = (posLength < surfSightRange + indirectSightRange + 1);
 						bool updateVisible = (posLength < surfSightRange);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true &&
-							SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true &&
+							DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
 							char szBuf[8096] = "";
 							snprintf(szBuf, 8096, "In exploreCells() currRelPos = %s currPos = %s posLength = %f updateExplored = %d updateVisible = %d sightRange = %d teamIndex = %d",
 								currRelPos.getString().c_str(), currPos.getString().c_str(), posLength, updateExplored, updateVisible, sightRange, teamIndex);
@@ -2529,6 +2538,7 @@ namespace Glest {
 		//computes the fog of war texture, contained in the minimap
 		void World::computeFow() {
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s] Line: %d in frame: %d\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, getFrameCount());
+			SimulationBenchmarkTimer benchmarkTimer(sbsFogOfWar);
 
 			Chrono chronoGamePerformanceCounts;
 			if (this->game) chronoGamePerformanceCounts.start();
@@ -2563,13 +2573,8 @@ namespace Glest {
 				//			++indexTeamFaction) {
 
 						// If fog of war enabled set cell visible to false and later set those close to units to true
-				if (fogOfWar) {
-					for (int indexSurfaceW = 0; indexSurfaceW < map.getSurfaceW(); ++indexSurfaceW) {
-						for (int indexSurfaceH = 0; indexSurfaceH < map.getSurfaceH(); ++indexSurfaceH) {
-							// set all cells to not visible
-							map.getSurfaceCell(indexSurfaceW, indexSurfaceH)->setVisible(faction->getTeam(), false);
-						}
-					}
+				if (fogOfWar && incrementalFogOfWar == false) {
+					map.getVisibilityPlanes()->resetVisible(faction->getTeam());
 				}
 
 				// Remove fog of war for factions NOT on my team which i can see
@@ -2657,6 +2662,10 @@ namespace Glest {
 			//compute cells
 			if (this->game) chronoGamePerformanceCounts.start();
 
+			if (incrementalFogOfWar == true) {
+				updateFogOfWarContributions();
+			}
+
 			for (int factionIndex = 0; factionIndex < getFactionCount(); ++factionIndex) {
 				Faction *faction = getFaction(factionIndex);
 				bool cellVisibleForFaction = showWorldForPlayer(thisFactionIndex);
@@ -2666,7 +2675,9 @@ namespace Glest {
 				for (int unitIndex = 0; unitIndex < unitCount; ++unitIndex) {
 					Unit *unit = faction->getUnit(unitIndex);
 					// exploration
-					unit->exploreCells();
+					if (incrementalFogOfWar == false) {
+						unit->exploreCells();
+					}
 
 					// fire particle visible
 					ParticleSystem *fire = unit->getFire();
@@ -2705,6 +2716,83 @@ namespace Glest {
 			if (this->game) this->game->addPerformanceCount("world compute cells", chronoGamePerformanceCounts.getMillis());
 		}
 
+		// Keeps per team counts of the unit sight circles covering each surface
+		// cell. Only units that moved, changed sight or team, died or were
+		// removed since the last pass touch the counts, then each team's visible
+		// plane is rebuilt from them in one linear pass.
+		void World::updateFogOfWarContributions() {
+			VisibilityPlanes *planes = map.getVisibilityPlanes();
+			fogOfWarPassIndex++;
+
+			for (int factionIndex = 0; factionIndex < getFactionCount(); ++factionIndex) {
+				Faction *faction = getFaction(factionIndex);
+				int unitCount = faction->getUnitCount();
+				for (int unitIndex = 0; unitIndex < unitCount; ++unitIndex) {
+					Unit *unit = faction->getUnit(unitIndex);
+					if (unit->isOperative() == false) {
+						continue;
+					}
+
+					FogOfWarContribution &contribution = fogOfWarContributions[unit->getId()];
+					contribution.passIndex = fogOfWarPassIndex;
+
+					const Vec2i pos = unit->getCenteredPos();
+					int sightRange = unit->getType()->getTotalSight(unit->getTotalUpgrade());
+					int teamIndex = unit->getTeam();
+					if (contribution.teamIndex == teamIndex &&
+						contribution.sightRange == sightRange &&
+						contribution.pos == pos) {
+						continue;
+					}
+
+					if (contribution.teamIndex >= 0) {
+						vector<uint16> &counts = planes->visibleCount[contribution.teamIndex];
+						for (unsigned int index = 0; index < contribution.visibleCells.size(); ++index) {
+							counts[contribution.visibleCells[index]]--;
+						}
+					}
+
+					// reveals the new circle and marks it explored
+					unit->exploreCells();
+
+					const std::vector<SurfaceCell *> &cellList = unit->getCachedExploredCells().visibleCellList;
+					vector<uint16> &counts = planes->visibleCount[teamIndex];
+					contribution.visibleCells.resize(cellList.size());
+					for (unsigned int index = 0; index < cellList.size(); ++index) {
+						int cellIndex = cellList[index]->getVisibilityIndex();
+						contribution.visibleCells[index] = cellIndex;
+						counts[cellIndex]++;
+					}
+					contribution.teamIndex = teamIndex;
+					contribution.sightRange = sightRange;
+					contribution.pos = pos;
+				}
+			}
+
+			// units that died or left the game since the last pass
+			for (std::map<int, FogOfWarContribution>::iterator iterMap = fogOfWarContributions.begin();
+				iterMap != fogOfWarContributions.end();) {
+				FogOfWarContribution &contribution = iterMap->second;
+				if (contribution.passIndex != fogOfWarPassIndex) {
+					if (contribution.teamIndex >= 0) {
+						vector<uint16> &counts = planes->visibleCount[contribution.teamIndex];
+						for (unsigned int index = 0; index < contribution.visibleCells.size(); ++index) {
+							counts[contribution.visibleCells[index]]--;
+						}
+					}
+					fogOfWarContributions.erase(iterMap++);
+				} else {
+					++iterMap;
+				}
+			}
+
+			if (fogOfWar) {
+				for (int factionIndex = 0; factionIndex < getFactionCount(); ++factionIndex) {
+					planes->setVisibleFromCounts(getFaction(factionIndex)->getTeam());
+				}
+			}
+		}
+
 		GameSettings * World::getGameSettingsPtr() {
 			return (game != NULL ? game->getGameSettings() : NULL);
 		}
@@ -2720,7 +2808,7 @@ namespace Glest {
 		// Calculates the unit unit ID for each faction
 		//
 		int World::getNextUnitId(Faction *faction) {
-			MutexSafeWrapper safeMutex(mutexFactionNextUnitId, string(__FILE__) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutex(mutexFactionNextUnitId, CODE_AT_LINE);
 			if (mapFactionNextUnitId.find(faction->getIndex()) == mapFactionNextUnitId.end()) {
 				mapFactionNextUnitId[faction->getIndex()] = faction->getIndex() * 100000;
 			}
@@ -3066,7 +3154,7 @@ namespace Glest {
 			worldNode->addAttribute("frameCount", intToStr(frameCount), mapTagReplacements);
 			//	//int nextUnitId;
 			//	Mutex mutexFactionNextUnitId;
-			MutexSafeWrapper safeMutex(mutexFactionNextUnitId, string(__FILE__) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutex(mutexFactionNextUnitId, CODE_AT_LINE);
 			//	std::map<int,int> mapFactionNextUnitId;
 			for (std::map<int, int>::iterator iterMap = mapFactionNextUnitId.begin();
 				iterMap != mapFactionNextUnitId.end(); ++iterMap) {
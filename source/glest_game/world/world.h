@@ -46,6 +46,7 @@
 #include "unit_updater.h"
 #include "randomgen.h"
 #include "game_constants.h"
+#include "thread_pool.h"
 #include "leak_dumper.h"
 
 namespace Glest {
@@ -94,6 +95,7 @@ namespace Glest {
 		public:
 			static const int generationArea = 100;
 			static const int indirectSightRange = 5;
+			static const int unitPathfindingBatchSize = 16;
 
 		private:
 
@@ -138,6 +140,25 @@ namespace Glest {
 
 			uint32 nextCommandGroupId;
 
+			// incremental fog of war: the sight circle each unit currently adds
+			// to its team's visibility counts, keyed by unit id
+			class FogOfWarContribution {
+			public:
+				FogOfWarContribution() {
+					teamIndex = -1;
+					sightRange = -1;
+					passIndex = 0;
+				}
+				int teamIndex;
+				Vec2i pos;
+				int sightRange;
+				uint32 passIndex;
+				vector<int> visibleCells;
+			};
+			bool incrementalFogOfWar;
+			uint32 fogOfWarPassIndex;
+			std::map<int, FogOfWarContribution> fogOfWarContributions;
+
 			string queuedScenarioName;
 			bool queuedScenarioKeepFactions;
 
@@ -145,7 +166,22 @@ namespace Glest {
 
 			const XmlNode *loadWorldNode;
 
-			MasterSlaveThreadController masterController;
+			// pathfinding pre-computation for a batch of one faction's units,
+			// the batches of a faction are chained so they run in unit order
+			class UnitPathfindingTask : public ThreadPoolTask {
+			public:
+				Faction *faction;
+				int frameIndex;
+				int unitIndexBegin;
+				int unitIndexEnd;
+
+				virtual void runTask() {
+					faction->precomputeUnitCommands(frameIndex, unitIndexBegin, unitIndexEnd);
+				}
+			};
+			WorkStealingThreadPool *unitTaskPool;
+			std::vector<UnitPathfindingTask> unitPathfindingTasks;
+			std::vector<ThreadPoolTask *> unitPathfindingChains;
 
 			bool originalGameFogOfWar;
 			std::map<int, std::pair<const Unit *, const FogOfWarSkillType *> > mapFogOfWarUnitList;
@@ -416,6 +452,7 @@ namespace Glest {
 			//misc
 			void tick();
 			void computeFow();
+			void updateFogOfWarContributions();
 
 			void updateAllTilesetObjects();
 			void updateAllFactionUnits();
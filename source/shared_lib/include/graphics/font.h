@@ -14,7 +14,10 @@
 
 #include <string>
 #include <vector>
+#include <list>
+#include <map>
 #include "font_text.h"
+#include "data_types.h"
 #include "leak_dumper.h"
 
 using std::string;
@@ -24,8 +27,55 @@ using std::string;
 namespace Shared {
 	namespace Graphics {
 
+		using Platform::uint64;
+
+		// measured values of one font, the most recently used first
+		template<typename T> class FontMeasureCache {
+		private:
+			typedef std::pair<string, T> Entry;
+			typedef std::list<Entry> EntryList;
+
+			EntryList entries;
+			std::map<string, typename EntryList::iterator> lookup;
+
+		public:
+			bool get(const string &key, T &value) {
+				typename std::map<string, typename EntryList::iterator>::iterator iterFind = lookup.find(key);
+				if (iterFind == lookup.end()) {
+					return false;
+				}
+				entries.splice(entries.begin(), entries, iterFind->second);
+				value = iterFind->second->second;
+				return true;
+			}
+			void add(const string &key, const T &value, unsigned int maxEntries) {
+				if (maxEntries == 0 || lookup.find(key) != lookup.end()) {
+					return;
+				}
+				while (entries.size() >= maxEntries) {
+					lookup.erase(entries.back().first);
+					entries.pop_back();
+				}
+				entries.push_front(Entry(key, value));
+				lookup[key] = entries.begin();
+			}
+			void clear() {
+				lookup.clear();
+				entries.clear();
+			}
+			size_t size() const {
+				return lookup.size();
+			}
+		};
+
 		// =====================================================
 		//	class FontMetrics
+		//
+		///	Text widths of a font. With a text handler the
+		///	printable ascii glyphs are measured once into a
+		///	table. Widths of other texts and word wrapped
+		///	texts are kept so the HUD and menus do not have
+		///	them measured again every frame.
 		// =====================================================
 
 		class FontMetrics {
@@ -37,6 +87,27 @@ namespace Shared {
 			//float yOffsetFactor;
 			Text *textHandler;
 
+			// advances of the printable ascii glyphs and of the kerning between
+			// each pair of them, allocated on first use and filled as asked for
+			float *glyphAdvances;
+			float *kerningAdvances;
+
+			FontMeasureCache<float> textAdvanceCache;
+			FontMeasureCache<string> wrappedTextCache;
+			float wrappedTextScale;
+
+			static unsigned int maxCacheEntries;
+			static uint64 textAdvanceCacheHits;
+			static uint64 textAdvanceCacheMisses;
+			static uint64 glyphTableMeasures;
+			static uint64 wrappedTextCacheHits;
+			static uint64 wrappedTextCacheMisses;
+
+			float getGlyphAdvance(int glyph);
+			float getKerningAdvance(int glyph, int nextGlyph);
+			bool measureWithGlyphTable(const char *text, size_t length, float &advance);
+			float getLineAdvance(const char *text, size_t length);
+
 		public:
 			//static float DEFAULT_Y_OFFSET_FACTOR;
 
@@ -51,16 +122,46 @@ namespace Shared {
 
 			void setWidth(int i, float width) {
 				this->widths[i] = width;
+				clearCaches();
 			}
 			void setHeight(float height) {
 				this->height = height;
 			}
 
+			// unscaled advance of the text handler for the whole text
+			float getTextAdvance(const string &str);
 			float getTextWidth(const string &str);
 			float getHeight(const string &str) const;
 
 			string wordWrapText(string text, int maxWidth);
 
+			// to be called whenever the face or size of the text handler changes
+			void clearCaches();
+
+			// text widths and wrapped texts kept per font, 0 turns the caches off
+			static void setMaxCacheEntries(unsigned int entries) {
+				maxCacheEntries = entries;
+			}
+			static unsigned int getMaxCacheEntries() {
+				return maxCacheEntries;
+			}
+			static uint64 getTextAdvanceCacheHits() {
+				return textAdvanceCacheHits;
+			}
+			static uint64 getTextAdvanceCacheMisses() {
+				return textAdvanceCacheMisses;
+			}
+			static uint64 getGlyphTableMeasures() {
+				return glyphTableMeasures;
+			}
+			static uint64 getWrappedTextCacheHits() {
+				return wrappedTextCacheHits;
+			}
+			static uint64 getWrappedTextCacheMisses() {
+				return wrappedTextCacheMisses;
+			}
+			static string getCacheStats();
+			static void resetCacheStats();
 		};
 
 		// =====================================================
@@ -58,6 +58,7 @@ namespace Shared {
 				virtual void end();
 				virtual void render(Model *model, int renderMode = rmNormal, float alpha = 1.0f);
 				virtual void renderNormalsOnly(Model *model);
+				virtual bool canRenderInstances(const Model *model) const;
 
 				void setDuplicateTexCoords(bool duplicateTexCoords) {
 					this->duplicateTexCoords = duplicateTexCoords;
@@ -66,6 +67,12 @@ namespace Shared {
 					this->secondaryTexCoordUnit = secondaryTexCoordUnit;
 				}
 
+			protected:
+				// renderMesh in three steps, so instances can share the setup
+				virtual void setupMesh(Mesh *mesh, int renderMode, float alpha);
+				virtual void drawMesh(Mesh *mesh);
+				virtual void finishMesh(Mesh *mesh, int renderMode);
+
 			private:
 
 				void renderMesh(Mesh *mesh, int renderMode = rmNormal, float alpha = 1.0f);
@@ -29,9 +29,20 @@ namespace Shared {
 
 			private:
 				bool rendering;
-				Vec3f vertexBuffer[bufferSize];
-				Vec2f texCoordBuffer[bufferSize];
-				Vec4f colorBuffer[bufferSize];
+				vector<Vec3f> vertexBuffer;
+				vector<Vec2f> texCoordBuffer;
+				vector<Vec4f> colorBuffer;
+
+				// billboard axes of the current modelview
+				Vec3f rightVector;
+				Vec3f upVector;
+
+				// quads of consecutive systems sharing blend mode and
+				// texture are collected and drawn with one call
+				bool quadBatchStarted;
+				int quadBatchVertexCount;
+				ParticleSystem::BlendMode quadBatchBlendMode;
+				Texture *quadBatchTexture;
 
 			public:
 				//particles
@@ -45,6 +56,8 @@ namespace Shared {
 			protected:
 				void renderBufferQuads(int quadCount);
 				void renderBufferLines(int lineCount);
+				void flushQuadBatch();
+				void reserveBuffers(int vertexCount);
 				void setBlendMode(ParticleSystem::BlendMode blendMode);
 			};
 
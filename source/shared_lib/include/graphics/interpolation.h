@@ -15,27 +15,56 @@
 #include "vec.h"
 #include "model.h"
 #include <map>
+#include <vector>
+#include "data_types.h"
 #include "leak_dumper.h"
 
 namespace Shared {
 	namespace Graphics {
 
+		// one interpolated pose of a mesh, kept for reuse
+		class InterpolationCacheEntry {
+		public:
+			uint64 key;
+			uint32 lastUsed;
+			Vec3f *data;
+		};
+
 		// =====================================================
 		//	class InterpolationData
+		//
+		///	Interpolates the keyframes of a mesh. Animation
+		///	progress is quantized so units showing the same
+		///	pose share one interpolated buffer instead of each
+		///	redoing the same lerp every rendered frame.
 		// =====================================================
 
 		class InterpolationData {
 		private:
 			const Mesh *mesh;
 
+			// point into the caches below, never owned directly
 			Vec3f *vertices;
 			Vec3f *normals;
 
 			int raw_frame_ofs;
 
+			std::vector<InterpolationCacheEntry> vertexCache;
+			std::vector<InterpolationCacheEntry> normalCache;
+			uint32 useCounter;
+
 			static bool enableInterpolation;
+			static uint32 cacheSteps;
+			static uint32 maxCacheEntries;
+			static const uint32 maxPreparedCacheEntries;
+			static uint64 cacheHits;
+			static uint64 cacheMisses;
 
-			void update(const Vec3f* src, Vec3f* &dest, float t, bool cycle);
+			bool getFrames(float t, bool cycle, uint32 &prevFrame, uint32 &nextFrame, float &localT) const;
+			void update(const Vec3f* src, Vec3f* &dest, std::vector<InterpolationCacheEntry> &cache, float t, bool cycle);
+			Vec3f *getPose(std::vector<InterpolationCacheEntry> &cache, const Vec3f* src, uint32 prevFrame, uint32 nextFrame,
+				float localT, uint32 entryLimit, uint64 &hits, uint64 &misses);
+			void trimCache(std::vector<InterpolationCacheEntry> &cache, uint32 entryLimit);
 
 		public:
 			InterpolationData(const Mesh *mesh);
@@ -44,6 +73,31 @@ namespace Shared {
 			static void setEnableInterpolation(bool enabled) {
 				enableInterpolation = enabled;
 			}
+			// poses per keyframe interval, 0 turns the cache off
+			static void setCacheSteps(uint32 steps) {
+				cacheSteps = steps;
+			}
+			// poses kept per mesh for vertices and for normals
+			static void setMaxCacheEntries(uint32 entries) {
+				maxCacheEntries = (entries > 0 ? entries : 1);
+			}
+			static uint64 getCacheHits() {
+				return cacheHits;
+			}
+			static uint64 getCacheMisses() {
+				return cacheMisses;
+			}
+			static void resetCacheStats() {
+				cacheHits = 0;
+				cacheMisses = 0;
+			}
+			static void addCacheStats(uint64 hits, uint64 misses) {
+				cacheHits += hits;
+				cacheMisses += misses;
+			}
+
+			// dest[i] = prev[i] + (next[i] - prev[i]) * t, vectorized where the build allows
+			static void lerpVertices(const Vec3f *prev, const Vec3f *next, Vec3f *dest, uint32 count, float t);
 
 			const Vec3f *getVertices() const {
 				return !vertices || !enableInterpolation ? mesh->getVertices() + raw_frame_ofs : vertices;
@@ -55,6 +109,13 @@ namespace Shared {
 			void update(float t, bool cycle);
 			void updateVertices(float t, bool cycle);
 			void updateNormals(float t, bool cycle);
+
+			// Interpolates every pose in the list into the cache ahead of
+			// rendering so the update calls that follow only pick them up.
+			// Safe to run on a worker thread as long as no other thread
+			// touches this object meanwhile. Counts go to hits and misses
+			// instead of the shared totals.
+			void preparePoses(const std::vector<std::pair<float, bool> > &poses, uint64 &hits, uint64 &misses);
 		};
 
 	}
@@ -197,6 +197,9 @@ namespace Shared {
 			const InterpolationData *getInterpolationData() const {
 				return interpolationData;
 			}
+			InterpolationData *getInterpolationDataPtr() {
+				return interpolationData;
+			}
 
 			//interpolation
 			void buildInterpolationData();
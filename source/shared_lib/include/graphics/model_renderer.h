@@ -13,6 +13,7 @@
 #ifndef _SHARED_GRAPHICS_MODELRENDERER_H_
 #define _SHARED_GRAPHICS_MODELRENDERER_H_
 
+#include <map>
 #include "model.h"
 #include "leak_dumper.h"
 
@@ -30,6 +31,56 @@ namespace Shared {
 
 		class Texture;
 
+		// =====================================================
+		//	class ModelInstanceCallback
+		//
+		///	Sets up the per instance state (matrix, colors) around
+		///	each draw of ModelRenderer::renderInstances
+		// =====================================================
+
+		class ModelInstanceCallback {
+		public:
+			virtual ~ModelInstanceCallback() {
+			}
+			virtual void beginInstance(int instanceIndex) = 0;
+			virtual void endInstance(int instanceIndex) = 0;
+		};
+
+		// =====================================================
+		//	class ModelInstanceBatch
+		//
+		///	Collects the items drawn with each model in first
+		///	seen order, so every model takes one renderInstances
+		// =====================================================
+
+		class ModelInstanceBatch {
+		private:
+			vector<Model *> modelList;
+			std::map<Model *, vector<int> > itemMap;
+
+		public:
+			void add(Model *model, int itemIndex) {
+				vector<int> &itemList = itemMap[model];
+				if (itemList.empty() == true) {
+					modelList.push_back(model);
+				}
+				itemList.push_back(itemIndex);
+			}
+			void clear() {
+				modelList.clear();
+				itemMap.clear();
+			}
+			int getModelCount() const {
+				return (int) modelList.size();
+			}
+			Model *getModel(int modelIndex) const {
+				return modelList[modelIndex];
+			}
+			const vector<int> &getItemList(int modelIndex) const {
+				return itemMap.find(modelList[modelIndex])->second;
+			}
+		};
+
 		// =====================================================
 		//	class ModelRenderer
 		// =====================================================
@@ -41,6 +92,8 @@ namespace Shared {
 			bool renderColors;
 			bool colorPickingMode;
 			Gl::MeshCallback *meshCallback;
+			uint32 drawCallCount;
+			uint32 meshSetupCount;
 
 		public:
 			ModelRenderer() {
@@ -50,6 +103,8 @@ namespace Shared {
 				colorPickingMode = false;
 
 				meshCallback = NULL;
+				drawCallCount = 0;
+				meshSetupCount = 0;
 			}
 
 			virtual ~ModelRenderer() {
@@ -59,6 +114,69 @@ namespace Shared {
 			virtual void end() = 0;
 			virtual void render(Model *model, int renderMode = rmNormal, float alpha = 1.0f) = 0;
 			virtual void renderNormalsOnly(Model *model) = 0;
+
+			// true if renderInstances can bind each mesh of model only once
+			virtual bool canRenderInstances(const Model *model) const {
+				return false;
+			}
+			// draws model instanceCount times, instanceCallback sets up each one
+			void renderInstances(Model *model, int instanceCount, ModelInstanceCallback *instanceCallback,
+				int renderMode = rmNormal, float alpha = 1.0f) {
+				if (canRenderInstances(model) == false) {
+					for (int instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex) {
+						instanceCallback->beginInstance(instanceIndex);
+						render(model, renderMode, alpha);
+						instanceCallback->endInstance(instanceIndex);
+					}
+					return;
+				}
+
+				// mesh by mesh, so the buffers and texture of a mesh are set
+				// up once and only the per instance state changes between draws
+				for (uint32 i = 0; i < model->getMeshCount(); ++i) {
+					Mesh *mesh = model->getMeshPtr(i);
+					if (renderMode == rmSelection && mesh->getNoSelect() == true) {
+						continue;
+					}
+					setupMesh(mesh, renderMode, alpha);
+					for (int instanceIndex = 0; instanceIndex < instanceCount; ++instanceIndex) {
+						instanceCallback->beginInstance(instanceIndex);
+						drawMesh(mesh);
+						instanceCallback->endInstance(instanceIndex);
+					}
+					finishMesh(mesh, renderMode);
+				}
+			}
+
+			uint32 getDrawCallCount() const {
+				return drawCallCount;
+			}
+			uint32 getMeshSetupCount() const {
+				return meshSetupCount;
+			}
+			void resetStats() {
+				drawCallCount = 0;
+				meshSetupCount = 0;
+			}
+
+		protected:
+			// only models without animation can share one setup per mesh
+			static bool isStaticModel(const Model *model) {
+				for (uint32 i = 0; i < model->getMeshCount(); ++i) {
+					if (model->getMesh(i)->getFrameCount() != 1) {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			// the steps of drawing a mesh, for renderers that can render instances
+			virtual void setupMesh(Mesh *mesh, int renderMode, float alpha) {
+			}
+			virtual void drawMesh(Mesh *mesh) {
+			}
+			virtual void finishMesh(Mesh *mesh, int renderMode) {
+			}
 		};
 	}
 }//end namespace
@@ -90,6 +90,34 @@ namespace Shared {
 			void loadGame(const XmlNode *rootNode);
 		};
 
+		// =====================================================
+		//	class ParticleBufferPool
+		//
+		///	Keeps the particle arrays of finished systems so the
+		///	next system of the same size can reuse them, battles
+		///	start and end hundreds of projectile and splash
+		///	systems that would otherwise allocate each time
+		// =====================================================
+
+		class ParticleBufferPool {
+		private:
+			static int maxBuffersPerSize;
+
+		public:
+			// hands out particleCount default particles in particles
+			static void acquire(std::vector<Particle> &particles, int particleCount);
+			// takes over the memory of particles, which is left empty
+			static void release(std::vector<Particle> &particles);
+			static void clear();
+
+			static void setMaxBuffersPerSize(int value) {
+				maxBuffersPerSize = value;
+			}
+			static int getMaxBuffersPerSize() {
+				return maxBuffersPerSize;
+			}
+		};
+
 		// =====================================================
 		//	class ParticleObserver
 		// =====================================================
@@ -305,6 +333,29 @@ namespace Shared {
 			virtual void initParticle(Particle *p, int particleIndex);
 			virtual void updateParticle(Particle *p);
 			virtual bool deathTest(Particle *p);
+
+			// updates and kills the alive particles, every system type
+			// overrides this with updateAliveParticles(this) so that the
+			// per particle calls are not virtual
+			virtual void updateParticles();
+
+			template<typename SystemType>
+			void updateAliveParticles(SystemType *system) {
+				for (int i = 0; i < aliveParticleCount; ++i) {
+					system->SystemType::updateParticle(&particles[i]);
+
+					if (system->SystemType::deathTest(&particles[i])) {
+
+						//kill the particle
+						killParticle(&particles[i]);
+
+						//maintain alive particles at front of the array
+						if (aliveParticleCount > 0) {
+							particles[i] = particles[aliveParticleCount];
+						}
+					}
+				}
+			}
 		};
 
 		// =====================================================
@@ -337,6 +388,11 @@ namespace Shared {
 			virtual string toString() const;
 
 			virtual Checksum getCRC();
+
+		protected:
+			virtual void updateParticles() {
+				updateAliveParticles(this);
+			}
 		};
 
 		// =====================================================
@@ -579,6 +635,11 @@ namespace Shared {
 			virtual string toString() const;
 
 			virtual Checksum getCRC();
+
+		protected:
+			virtual void updateParticles() {
+				updateAliveParticles(this);
+			}
 		};
 
 		// =====================================================
@@ -608,6 +669,11 @@ namespace Shared {
 			virtual string toString() const;
 
 			virtual Checksum getCRC();
+
+		protected:
+			virtual void updateParticles() {
+				updateAliveParticles(this);
+			}
 		};
 
 		// =====================================================
@@ -635,6 +701,11 @@ namespace Shared {
 			virtual string toString() const;
 
 			virtual Checksum getCRC();
+
+		protected:
+			virtual void updateParticles() {
+				updateAliveParticles(this);
+			}
 		};
 
 		// ===========================================================================
@@ -746,6 +817,11 @@ namespace Shared {
 			virtual string toString() const;
 
 			virtual Checksum getCRC();
+
+		protected:
+			virtual void updateParticles() {
+				updateAliveParticles(this);
+			}
 		};
 
 		// =====================================================
@@ -799,6 +875,11 @@ namespace Shared {
 			virtual string toString() const;
 
 			virtual Checksum getCRC();
+
+		protected:
+			virtual void updateParticles() {
+				updateAliveParticles(this);
+			}
 		};
 
 		// =====================================================
@@ -25,7 +25,13 @@ namespace Shared {
 		// =====================================================
 
 		class ParticleRenderer {
+		protected:
+			uint32 drawCallCount;
+
 		public:
+			ParticleRenderer() {
+				drawCallCount = 0;
+			}
 			//particles
 			virtual ~ParticleRenderer() {
 			};
@@ -34,6 +40,13 @@ namespace Shared {
 			virtual void renderSystemLine(ParticleSystem *ps) = 0;
 			virtual void renderSystemLineAlpha(ParticleSystem *ps) = 0;
 			virtual void renderModel(GameParticleSystem *ps, ModelRenderer *mr) = 0;
+
+			uint32 getDrawCallCount() const {
+				return drawCallCount;
+			}
+			void resetStats() {
+				drawCallCount = 0;
+			}
 		};
 
 	}
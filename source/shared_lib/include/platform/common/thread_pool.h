@@ -0,0 +1,148 @@
+//      thread_pool.h:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _SHARED_PLATFORMCOMMON_THREADPOOL_H_
+#define _SHARED_PLATFORMCOMMON_THREADPOOL_H_
+
+#include "base_thread.h"
+#include <vector>
+#include <deque>
+#include <string>
+#include "leak_dumper.h"
+
+using namespace std;
+
+namespace Shared {
+	namespace PlatformCommon {
+
+		// =====================================================
+		//	class ThreadPoolTask
+		//
+		///	A unit of work for WorkStealingThreadPool. Tasks linked
+		///	through nextTask form a chain that always runs in order,
+		///	separate chains may run in parallel.
+		// =====================================================
+
+		class ThreadPoolTask {
+		protected:
+			ThreadPoolTask *nextTask;
+
+		public:
+			ThreadPoolTask() {
+				nextTask = NULL;
+			}
+			virtual ~ThreadPoolTask() {
+			}
+
+			virtual void runTask() = 0;
+
+			void setNextTask(ThreadPoolTask *task) {
+				nextTask = task;
+			}
+			ThreadPoolTask * getNextTask() const {
+				return nextTask;
+			}
+		};
+
+		class WorkStealingThreadPool;
+
+		// =====================================================
+		//	class ThreadPoolWorker
+		// =====================================================
+
+		class ThreadPoolWorker : public BaseThread {
+		protected:
+			WorkStealingThreadPool *pool;
+			int queueIndex;
+			Semaphore semTaskSignalled;
+
+			virtual void setQuitStatus(bool value);
+
+		public:
+			ThreadPoolWorker(WorkStealingThreadPool *pool, int queueIndex);
+			virtual ~ThreadPoolWorker();
+			virtual void execute();
+			virtual bool canShutdown(bool deleteSelfIfShutdownDelayed = false);
+
+			void signalWork();
+		};
+
+		// =====================================================
+		//	class WorkStealingThreadPool
+		//
+		///	Fixed set of worker threads, each with its own task
+		///	queue. A worker runs the newest task of its own queue
+		///	and steals the oldest task of another queue when idle.
+		///	The thread calling runTasks works as queue 0 until no
+		///	task is left, then waits on a condition for the rest.
+		// =====================================================
+
+		class WorkStealingThreadPool {
+			friend class ThreadPoolWorker;
+
+		protected:
+			class TaskQueue {
+			public:
+				TaskQueue();
+				~TaskQueue();
+
+				Mutex *mutex;
+				std::deque<ThreadPoolTask *> tasks;
+			};
+
+			std::vector<ThreadPoolWorker *> workers;
+			std::vector<TaskQueue *> queues;
+
+			Mutex *mutexPendingTasks;
+			Trigger *triggerTasksCompleted;
+			int pendingTaskCount;
+			bool tasksCancelled;
+			string taskErrorText;
+
+			static int getChainLength(ThreadPoolTask *task);
+			bool popTask(int queueIndex, ThreadPoolTask *&task);
+			bool stealTask(int queueIndex, ThreadPoolTask *&task);
+			void pushTask(int queueIndex, ThreadPoolTask *task);
+			void runQueuedTasks(int queueIndex);
+			void cancelQueuedTasks();
+
+		public:
+			WorkStealingThreadPool(int workerCount, string uniqueID);
+			~WorkStealingThreadPool();
+
+			int getWorkerCount() const {
+				return (int) workers.size();
+			}
+
+			// Runs every chain starting at chainHeads and returns once all
+			// of them completed (true) or waitMilliseconds expired (false).
+			// On a timeout the tasks not started yet are dropped and the
+			// running ones are waited for, so no task is used after this
+			// returns. The first error thrown by a task is rethrown here.
+			bool runTasks(const std::vector<ThreadPoolTask *> &chainHeads, int waitMilliseconds = -1);
+
+			static int getDefaultWorkerCount();
+		};
+
+	}
+}//end namespace
+
+#endif
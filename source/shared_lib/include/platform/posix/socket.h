@@ -46,6 +46,7 @@ typedef int PLATFORM_SOCKET;
 #include "base_thread.h"
 #include "simple_threads.h"
 #include "data_types.h"
+#include "platform_util.h"
 
 using std::string;
 
@@ -120,6 +121,20 @@ namespace Shared {
 			string getString() const;
 		};
 
+		// =====================================================
+		//	class socket_receive_incomplete
+		//
+		///	Thrown by receive on a buffered socket when the rest
+		///	of a message has not arrived yet. The reader rewinds
+		///	to its mark and tries again once more data is in.
+		// =====================================================
+
+		class socket_receive_incomplete : public megaglest_runtime_error {
+		public:
+			explicit socket_receive_incomplete(const string &message) : megaglest_runtime_error(message, true) {
+			}
+		};
+
 		// =====================================================
 		//	class Socket
 		// =====================================================
@@ -158,6 +173,16 @@ namespace Shared {
 			bool isSocketBlocking;
 			time_t lastSocketError;
 
+			// set while a SocketReactor drives the socket, see setBuffered
+			bool isSocketBuffered;
+			bool bufferedWasBlocking;
+			bool receiveIncomplete;
+			bool receiveClosed;
+			std::vector<char> receiveBuffer;
+			int receiveBufferStart;
+			int receiveBufferMark;
+			std::vector<char> sendBuffer;
+
 			static string host_name;
 			static std::vector<string> intfTypes;
 
@@ -208,6 +233,23 @@ namespace Shared {
 			static void setBlock(bool block, PLATFORM_SOCKET socket);
 			bool getBlock();
 
+			// A buffered socket never blocks its owner. fillReceiveBuffer takes in
+			// whatever arrived and receive only reads from there, sends the kernel
+			// can't take right away wait in order for flushSendBuffer.
+			void setBuffered(bool value);
+			bool getBuffered() const {
+				return isSocketBuffered;
+			}
+			int fillReceiveBuffer();
+			int flushSendBuffer();
+			bool hasPendingSend();
+			// true after a receive ran out of buffered data, until more arrives
+			bool getReceiveIncomplete();
+			// where a reader starts a message and goes back to when
+			// socket_receive_incomplete was thrown
+			void markReceive();
+			void rewindReceive();
+
 			bool isReadable(bool lockMutex = false);
 			bool isWritable(struct timeval *timeVal = NULL, bool lockMutex = false);
 			bool isConnected();
@@ -230,6 +272,12 @@ namespace Shared {
 		protected:
 			static void throwException(string str);
 			static void getLocalIPAddressListForPlatform(std::vector<std::string> &ipList);
+
+			int getReceiveBufferedBytes() const {
+				return (int) receiveBuffer.size() - receiveBufferStart;
+			}
+			int receiveBuffered(void *data, int dataSize, bool tryReceiveUntilDataSizeMet);
+			int sendBuffered(const void *data, int dataSize);
 		};
 
 		class SafeSocketBlockToggleWrapper {
@@ -0,0 +1,121 @@
+//      socket_reactor.h:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _SHARED_PLATFORM_SOCKETREACTOR_H_
+#define _SHARED_PLATFORM_SOCKETREACTOR_H_
+
+#include "socket.h"
+#include <map>
+#include <vector>
+
+#include "leak_dumper.h"
+
+namespace Shared {
+	namespace Platform {
+
+		//
+		// This interface describes the methods a socket reactor callback object must implement
+		//
+		class SocketReactorEventInterface {
+		public:
+			virtual void socketReadReady(PLATFORM_SOCKET socket, int userId) = 0;
+			virtual void socketWriteReady(PLATFORM_SOCKET socket, int userId) = 0;
+
+			virtual ~SocketReactorEventInterface() {
+			}
+		};
+
+		// =====================================================
+		//	class SocketReactor
+		//
+		///	Waits on a set of sockets at once and reports which
+		///	of them became readable, hung up or writable again.
+		///	On linux this is an edge triggered epoll set, elsewhere
+		///	it falls back to select. Since edges are only reported
+		///	once, a consumer that did not drain a socket must mark
+		///	it with setReadPending so it is reported again.
+		// =====================================================
+
+		class SocketReactor {
+		private:
+			class Entry {
+			public:
+				Entry() {
+					userId = -1;
+					readPending = false;
+					writePending = false;
+					wantWrite = false;
+				}
+
+				int userId;
+				bool readPending;
+				bool writePending;
+				// only select needs to be told, epoll reports writes by edge
+				bool wantWrite;
+			};
+
+			class ReadyEvent {
+			public:
+				PLATFORM_SOCKET socket;
+				int userId;
+				bool read;
+				bool write;
+			};
+
+			Mutex *mutex;
+			std::map<PLATFORM_SOCKET, Entry> entries;
+
+#if defined(__linux__)
+			int epollId;
+			int wakeupId;
+#endif
+
+			bool hasPendingEvents();
+			void waitForReadiness(int waitMilliseconds);
+
+		public:
+			SocketReactor();
+			~SocketReactor();
+
+			void addSocket(PLATFORM_SOCKET socket, int userId);
+			void removeSocket(PLATFORM_SOCKET socket);
+			bool hasSocket(PLATFORM_SOCKET socket);
+			int getSocketCount();
+
+			void setReadPending(PLATFORM_SOCKET socket, bool value);
+			// set while the consumer has data queued that the socket would not take
+			void setWantWrite(PLATFORM_SOCKET socket, bool value);
+			// interrupts a waitForEvents call in progress, a no-op with select
+			void wakeup();
+
+			// waits up to waitMilliseconds for readiness on any registered socket
+			// and calls back for each one outside the internal lock, reads
+			// before writes, returns the number of sockets reported. Only one
+			// thread may wait at a time
+			int waitForEvents(int waitMilliseconds, SocketReactorEventInterface *callback);
+
+			static bool isEdgeTriggered();
+		};
+
+	}
+}//end namespace
+
+#endif
@@ -28,6 +28,7 @@ const char  *GAME_ARGS[] = {
 	"--autostart-lastgame",
 	"--load-saved-game",
 	"--auto-test",
+	"--simulation-benchmark",
 	"--connect",
 	"--connecthost",
 	"--starthost",
@@ -66,6 +67,7 @@ const char  *GAME_ARGS[] = {
 	"--font-path",
 	"--show-ini-settings",
 	"--convert-models",
+	"--convert-saved-game",
 	"--use-language",
 	"--show-map-crc",
 	"--show-tileset-crc",
@@ -112,6 +114,7 @@ enum GAME_ARG_TYPE {
 	GAME_ARG_AUTOSTART_LASTGAME,
 	GAME_ARG_AUTOSTART_LAST_SAVED_GAME,
 	GAME_ARG_AUTO_TEST,
+	GAME_ARG_SIMULATION_BENCHMARK,
 	GAME_ARG_CONNECT,
 	GAME_ARG_CLIENT,
 	GAME_ARG_SERVER,
@@ -150,6 +153,7 @@ enum GAME_ARG_TYPE {
 	GAME_ARG_FONT_PATH,
 	GAME_ARG_SHOW_INI_SETTINGS,
 	GAME_ARG_CONVERT_MODELS,
+	GAME_ARG_CONVERT_SAVED_GAME,
 	GAME_ARG_USE_LANGUAGE,
 
 	GAME_ARG_SHOW_MAP_CRC,
@@ -222,6 +226,14 @@ void printParameterHelp(const char *argv0, bool foundInvalidArgs) {
 	printf("\n\n                     \tafter the game is finished or the time runs out. If z is");
 	printf("\n\n                     \tnot specified (or is empty) then auto test continues to cycle.");
 
+	printf("\n\n%s=x,y  \tRun a headless simulation benchmark.", GAME_ARGS[GAME_ARG_SIMULATION_BENCHMARK]);
+	printf("\n\n                     \tMust be combined with %s=name, every player slot", GAME_ARGS[GAME_ARG_LOADSCENARIO]);
+	printf("\n\n                     \tof the scenario is played by the AI.");
+	printf("\n\n                     \tWhere x is an optional # of world frames to simulate.");
+	printf("\n\n                     \tIf x is not specified the default is 2000 frames.");
+	printf("\n\n                     \tWhere y is an optional file to write the JSON timings to.");
+	printf("\n\n                     \tIf y is not specified (or is empty) the timings are printed.");
+
 	printf("\n\n%s=x:y  \t\tAuto connect to host server at IP or hostname x using", GAME_ARGS[GAME_ARG_CONNECT]);
 	printf("\n\n                     \t    port y. Shortcut version of using %s and %s.", GAME_ARGS[GAME_ARG_CLIENT], GAME_ARGS[GAME_ARG_USE_PORTS]);
 	printf("\n\n                     \t*NOTE: to automatically connect to the first LAN host you may");
@@ -383,6 +395,14 @@ void printParameterHelp(const char *argv0, bool foundInvalidArgs) {
 	printf("\n\n                     \t%s %s=techs/megapack/factions/tech/", extractFileFromDirectoryPath(argv0).c_str(), GAME_ARGS[GAME_ARG_CONVERT_MODELS]);
 	printf("\n\n                     \tunits/castle/models/castle.g3d=png=keepsmallest");
 
+	printf("\n\n%s=x=y  \tConvert a saved game file between the xml and the binary", GAME_ARGS[GAME_ARG_CONVERT_SAVED_GAME]);
+	printf("\n\n                     \t    format, whichever it is not stored in yet.");
+	printf("\n\n                     \tWhere x is the saved game file to convert.");
+	printf("\n\n                     \tWhere y is an optional file to write the converted game to.");
+	printf("\n\n                     \t    If y is not specified x is converted in place.");
+	printf("\n\n                     \texample:");
+	printf("\n\n                     \t%s %s=saved/zetaglest-saved.xml", extractFileFromDirectoryPath(argv0).c_str(), GAME_ARGS[GAME_ARG_CONVERT_SAVED_GAME]);
+
 	printf("\n\n%s=x  \tForce the language to be the language specified", GAME_ARGS[GAME_ARG_USE_LANGUAGE]);
 	printf("\n\n                     \t    by x. Where x is a language filename or ISO639-1 code.");
 	printf("\n\n                     \texample: %s %s=english", extractFileFromDirectoryPath(argv0).c_str(), GAME_ARGS[GAME_ARG_USE_LANGUAGE]);
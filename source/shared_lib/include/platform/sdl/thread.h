@@ -17,6 +17,7 @@
 
 #include <SDL_thread.h>
 #include <SDL_mutex.h>
+#include <SDL_timer.h>
 #include <string>
 #include <memory>
 #include "common_scoped_ptr.h"
@@ -185,40 +186,125 @@ namespace Shared {
 			}
 		};
 
+		// =====================================================
+		//	class MutexProfiler
+		//
+		///	Optional lock contention statistics. Every lock taken
+		///	through MutexSafeWrapper adds its wait and hold time to
+		///	the lock site, the owner id it was given. Costs a flag
+		///	check per lock while disabled.
+		// =====================================================
+
+		class MutexProfiler {
+		public:
+			class SiteStats {
+			public:
+				string site;
+				uint64 acquisitions;
+				// acquisitions that did not get the lock right away
+				uint64 contended;
+				int64 waitMicros;
+				int64 maxWaitMicros;
+				int64 holdMicros;
+				int64 maxHoldMicros;
+
+				SiteStats();
+			};
+
+		private:
+			static bool enabled;
+
+		public:
+			static bool isEnabled() {
+				return enabled;
+			}
+			static void setEnabled(bool value);
+
+			static Uint64 getCounter() {
+				return SDL_GetPerformanceCounter();
+			}
+			// site has to stay valid for good, a literal like CODE_AT_LINE
+			static void addSample(const char *site, bool contended, Uint64 waitCount, Uint64 holdCount);
+			// a stable copy of a site id that was built at runtime
+			static const char * internSite(const string &site);
+
+			// sites sorted by total wait time, longest first
+			static vector<SiteStats> getSiteStats();
+			static string getReport();
+			static void reset();
+		};
+
+		// =====================================================
+		//	class MutexSafeWrapper
+		//
+		///	Holds a Mutex for its scope. The owner id should be a
+		///	literal such as CODE_AT_LINE, it is kept as a pointer so
+		///	taking the lock allocates nothing.
+		// =====================================================
+
 		class MutexSafeWrapper {
 		protected:
 			Mutex *mutex;
-			string ownerId;
+			const char *ownerId;
+			// only used for owner ids that were built at runtime
+			string ownerIdText;
+			Uint64 lockedCounter;
+			Uint64 waitCount;
+			bool contended;
 #ifdef DEBUG_PERFORMANCE_MUTEXES
 			Chrono chrono;
 #endif
 
+			inline void setOwnerId(const char *ownerId) {
+				this->ownerId = ownerId;
+				if (this->ownerIdText.empty() == false) {
+					this->ownerIdText.clear();
+				}
+			}
+			inline void setOwnerId(const string &ownerId) {
+				this->ownerIdText = ownerId;
+				this->ownerId = this->ownerIdText.c_str();
+			}
+			inline const char * getOwnerId() const {
+				return (this->ownerId != NULL ? this->ownerId : "");
+			}
+
 		public:
 
-			MutexSafeWrapper(Mutex *mutex, string ownerId = "") {
+			MutexSafeWrapper(Mutex *mutex, const char *ownerId = NULL) {
 				this->mutex = mutex;
-				if (this->ownerId != ownerId) {
-					this->ownerId = ownerId;
-				}
+				this->lockedCounter = 0;
+				this->waitCount = 0;
+				this->contended = false;
+				setOwnerId(ownerId);
+				Lock();
+			}
+			MutexSafeWrapper(Mutex *mutex, const string &ownerId) {
+				this->mutex = mutex;
+				this->lockedCounter = 0;
+				this->waitCount = 0;
+				this->contended = false;
+				setOwnerId(ownerId);
 				Lock();
 			}
 			~MutexSafeWrapper() {
 				ReleaseLock();
 			}
 
-			inline void setMutex(Mutex *mutex, string ownerId = "") {
+			inline void setMutex(Mutex *mutex, const char *ownerId = NULL) {
 				this->mutex = mutex;
-				if (this->ownerId != ownerId) {
-					this->ownerId = ownerId;
-				}
+				setOwnerId(ownerId);
 				Lock();
 			}
-			inline int setMutexAndTryLock(Mutex *mutex, string ownerId = "") {
+			inline void setMutex(Mutex *mutex, const string &ownerId) {
 				this->mutex = mutex;
-				if (this->ownerId != ownerId) {
-					this->ownerId = ownerId;
-				}
-				return this->mutex->TryLock();
+				setOwnerId(ownerId);
+				Lock();
+			}
+			inline int setMutexAndTryLock(Mutex *mutex, const char *ownerId = NULL) {
+				this->mutex = mutex;
+				setOwnerId(ownerId);
+				return TryLock();
 			}
 
 			inline bool isValidMutex() const {
@@ -228,8 +314,8 @@ namespace Shared {
 			inline void Lock() {
 				if (this->mutex != NULL) {
 #ifdef DEBUG_MUTEXES
-					if (this->ownerId != "") {
-						printf("Locking Mutex [%s] refCount: %d\n", this->ownerId.c_str(), this->mutex->getRefCount());
+					if (this->ownerId != NULL) {
+						printf("Locking Mutex [%s] refCount: %d\n", getOwnerId(), this->mutex->getRefCount());
 					}
 #endif
 
@@ -237,19 +323,26 @@ namespace Shared {
 					chrono.start();
 #endif
 
-					this->mutex->p();
-					if (this->mutex != NULL) {
-						this->mutex->setOwnerId(ownerId);
+					if (MutexProfiler::isEnabled() == true) {
+						Uint64 startCounter = MutexProfiler::getCounter();
+						this->contended = (this->mutex->TryLock() != 0);
+						if (this->contended == true) {
+							this->mutex->p();
+						}
+						this->lockedCounter = MutexProfiler::getCounter();
+						this->waitCount = this->lockedCounter - startCounter;
+					} else {
+						this->mutex->p();
 					}
 
 #ifdef DEBUG_PERFORMANCE_MUTEXES
-					if (chrono.getMillis() > 5) printf("In [%s::%s Line: %d] MUTEX LOCK took msecs: %lld, this->mutex->getRefCount() = %d ownerId [%s]\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), this->mutex->getRefCount(), ownerId.c_str());
+					if (chrono.getMillis() > 5) printf("In [%s::%s Line: %d] MUTEX LOCK took msecs: %lld, this->mutex->getRefCount() = %d ownerId [%s]\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), this->mutex->getRefCount(), getOwnerId());
 					chrono.start();
 #endif
 
 #ifdef DEBUG_MUTEXES
-					if (this->ownerId != "") {
-						printf("Locked Mutex [%s] refCount: %d\n", this->ownerId.c_str(), this->mutex->getRefCount());
+					if (this->ownerId != NULL) {
+						printf("Locked Mutex [%s] refCount: %d\n", getOwnerId(), this->mutex->getRefCount());
 					}
 #endif
 				}
@@ -258,8 +351,8 @@ namespace Shared {
 			inline int TryLock(int millisecondsToWait = 0) {
 				if (this->mutex != NULL) {
 #ifdef DEBUG_MUTEXES
-					if (this->ownerId != "") {
-						printf("TryLocking Mutex [%s] refCount: %d\n", this->ownerId.c_str(), this->mutex->getRefCount());
+					if (this->ownerId != NULL) {
+						printf("TryLocking Mutex [%s] refCount: %d\n", getOwnerId(), this->mutex->getRefCount());
 					}
 #endif
 
@@ -268,18 +361,20 @@ namespace Shared {
 #endif
 
 					int result = this->mutex->TryLock(millisecondsToWait);
-					if (result == 0 && this->mutex != NULL) {
-						this->mutex->setOwnerId(ownerId);
+					if (result == 0 && MutexProfiler::isEnabled() == true) {
+						this->lockedCounter = MutexProfiler::getCounter();
+						this->waitCount = 0;
+						this->contended = false;
 					}
 
 #ifdef DEBUG_PERFORMANCE_MUTEXES
-					if (chrono.getMillis() > 5) printf("In [%s::%s Line: %d] MUTEX LOCK took msecs: %lld, this->mutex->getRefCount() = %d ownerId [%s]\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), this->mutex->getRefCount(), ownerId.c_str());
+					if (chrono.getMillis() > 5) printf("In [%s::%s Line: %d] MUTEX LOCK took msecs: %lld, this->mutex->getRefCount() = %d ownerId [%s]\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), this->mutex->getRefCount(), getOwnerId());
 					chrono.start();
 #endif
 
 #ifdef DEBUG_MUTEXES
-					if (this->ownerId != "") {
-						printf("Locked Mutex [%s] refCount: %d\n", this->ownerId.c_str(), this->mutex->getRefCount());
+					if (this->ownerId != NULL) {
+						printf("Locked Mutex [%s] refCount: %d\n", getOwnerId(), this->mutex->getRefCount());
 					}
 #endif
 
@@ -291,20 +386,27 @@ namespace Shared {
 			inline void ReleaseLock(bool keepMutex = false, bool deleteMutexOnRelease = false) {
 				if (this->mutex != NULL) {
 #ifdef DEBUG_MUTEXES
-					if (this->ownerId != "") {
-						printf("UnLocking Mutex [%s] refCount: %d\n", this->ownerId.c_str(), this->mutex->getRefCount());
+					if (this->ownerId != NULL) {
+						printf("UnLocking Mutex [%s] refCount: %d\n", getOwnerId(), this->mutex->getRefCount());
 					}
 #endif
 
+					Uint64 holdCount = (this->lockedCounter != 0 ? MutexProfiler::getCounter() - this->lockedCounter : 0);
 					this->mutex->v();
 
+					if (this->lockedCounter != 0) {
+						const char *site = (this->ownerIdText.empty() == true ? this->ownerId : MutexProfiler::internSite(this->ownerIdText));
+						MutexProfiler::addSample(site, this->contended, this->waitCount, holdCount);
+						this->lockedCounter = 0;
+					}
+
 #ifdef DEBUG_PERFORMANCE_MUTEXES
-					if (chrono.getMillis() > 100) printf("In [%s::%s Line: %d] MUTEX UNLOCKED and held locked for msecs: %lld, this->mutex->getRefCount() = %d ownerId [%s]\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), this->mutex->getRefCount(), ownerId.c_str());
+					if (chrono.getMillis() > 100) printf("In [%s::%s Line: %d] MUTEX UNLOCKED and held locked for msecs: %lld, this->mutex->getRefCount() = %d ownerId [%s]\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis(), this->mutex->getRefCount(), getOwnerId());
 #endif
 
 #ifdef DEBUG_MUTEXES
-					if (this->ownerId != "") {
-						printf("UnLocked Mutex [%s] refCount: %d\n", this->ownerId.c_str(), this->mutex->getRefCount());
+					if (this->ownerId != NULL) {
+						printf("UnLocked Mutex [%s] refCount: %d\n", getOwnerId(), this->mutex->getRefCount());
 					}
 #endif
 
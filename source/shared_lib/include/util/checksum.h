@@ -16,6 +16,7 @@
 #include <map>
 #include "data_types.h"
 #include "thread.h"
+#include "file_crc_index.h"
 #include "leak_dumper.h"
 
 using std::string;
@@ -38,9 +39,11 @@ namespace Shared {
 
 			static Mutex fileListCacheSynchAccessor;
 			static std::map<string, uint32> fileListCache;
+			static FileCRCIndex fileIndex;
 
 			void addSum(uint32 value);
 			bool addFileToSum(const string &path);
+			static uint32 getCachedFileCRC(const string &path);
 
 		public:
 			Checksum();
@@ -60,6 +63,17 @@ namespace Shared {
 
 			static void removeFileFromCache(const string file);
 			static void clearFileCache();
+			// hashes path into the file cache ahead of getSum, safe to
+			// call from several threads at once
+			static void precacheFile(const string &path);
+
+			// keeps file crcs across runs in the index file at path,
+			// only changed files are read again
+			static bool openFileIndex(const string &path);
+			static void closeFileIndex();
+
+			// continues the crc32 crc over size bytes of data, pass 0 to start
+			static uint32 updateCrc(uint32 crc, const void *data, size_t size);
 		};
 
 	}
@@ -0,0 +1,151 @@
+//      file_crc_index.h:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _SHARED_UTIL_FILECRCINDEX_H_
+#define _SHARED_UTIL_FILECRCINDEX_H_
+
+#include <string>
+#include "data_types.h"
+#include "leak_dumper.h"
+
+using std::string;
+using namespace Shared::Platform;
+
+namespace Shared {
+	namespace Util {
+
+		// what a file looked like when its crc was taken, times are in
+		// nanoseconds where the platform has them
+		class FileStamp {
+		public:
+			uint64 size;
+			int64 modifiedTime;
+			int64 changeTime;
+			uint64 inode;
+
+			FileStamp() {
+				size = 0;
+				modifiedTime = 0;
+				changeTime = 0;
+				inode = 0;
+			}
+		};
+
+		// =====================================================
+		//	class FileCRCIndex
+		//
+		///	Remembers the crc of every hashed file together with
+		///	its size, modification and change time and inode. The
+		///	index is a hash table in one memory mapped file, so it
+		///	survives restarts and a file is only read again once it
+		///	changed. Files changed in the last few seconds are not
+		///	stored, another write could still follow within the
+		///	same timestamp. Not thread safe, the caller serializes
+		///	access.
+		// =====================================================
+
+		class FileCRCIndex {
+		public:
+			static const uint32 formatVersion = 2;
+			static const uint32 initialSlotCount = 4096;
+			static const int64 recentChangeNanoseconds = 3000000000LL;
+
+		private:
+			struct Header {
+				char magic[8];
+				uint32 byteOrderMark;
+				uint32 version;
+				uint32 slotCount;
+				uint32 usedCount;
+			};
+
+			struct Slot {
+				uint64 pathHash;
+				uint64 size;
+				int64 modifiedTime;
+				int64 changeTime;
+				uint64 inode;
+				uint32 crc;
+				// 0 for an empty slot, guards against torn writes
+				uint32 check;
+			};
+
+			string path;
+#ifdef WIN32
+			void *fileHandle;
+			void *mappingHandle;
+#else
+			int fileDescriptor;
+#endif
+			void *mapping;
+			uint64 mappingSize;
+			Header *header;
+			Slot *slots;
+
+			uint32 hits;
+			uint32 misses;
+
+			static uint64 hashPath(const string &file);
+			static uint32 slotCheck(const Slot &slot);
+			static uint64 fileSizeFor(uint32 slotCount);
+
+			bool resizeFile(uint64 size);
+			bool mapFile(uint64 size);
+			void unmapFile();
+			bool isValid(uint64 fileSize) const;
+			void reset(uint32 slotCount);
+			Slot *findSlot(uint64 pathHash);
+			bool grow();
+
+		public:
+			FileCRCIndex();
+			~FileCRCIndex();
+
+			// maps the index at path, creating it when missing or unreadable.
+			// Fails when another process has it open.
+			bool open(const string &path);
+			void close();
+			bool isOpen() const {
+				return mapping != NULL;
+			}
+
+			// crc of file if the index has it for exactly this stamp
+			bool lookup(const string &file, const FileStamp &stamp, uint32 &crc);
+			// now is the current time in nanoseconds, -1 takes the clock
+			void store(const string &file, const FileStamp &stamp, uint32 crc, int64 now = -1);
+
+			uint32 getHits() const {
+				return hits;
+			}
+			uint32 getMisses() const {
+				return misses;
+			}
+			uint32 getEntryCount() const {
+				return (header != NULL ? header->usedCount : 0);
+			}
+
+			static bool getFileStamp(const string &file, FileStamp &stamp);
+		};
+
+	}
+}//end namespace
+
+#endif
@@ -93,6 +93,76 @@ namespace Shared {
 
 #endif //SL_PROFILE
 
+		class TraceThreadBuffer;
+
+		// =====================================================
+		//	class TraceProfiler
+		//
+		///	Records timed scopes of every thread into a ring buffer
+		///	owned by that thread and writes them as a Chrome trace,
+		///	which chrome://tracing and ui.perfetto.dev can open.
+		///	Scopes cost a flag check while it is disabled.
+		// =====================================================
+
+		class TraceProfiler {
+		private:
+			static bool enabled;
+			static int threadEventCount;
+			static Uint64 startCounter;
+
+			static TraceThreadBuffer * getThreadBuffer();
+			static void releaseThreadBuffer(void *buffer);
+
+		public:
+			static bool isEnabled() {
+				return enabled;
+			}
+			static void setEnabled(bool value);
+			// events kept per thread, the oldest are overwritten first
+			static int getThreadEventCount() {
+				return threadEventCount;
+			}
+			static void setThreadEventCount(int value);
+
+			static Uint64 getCounter() {
+				return SDL_GetPerformanceCounter();
+			}
+			// name has to stay valid for good, a literal or internName()
+			static void addScope(const char *name, Uint64 beginCounter, Uint64 endCounter);
+			static const char * internName(const string &name);
+			// the name the calling thread gets in the trace
+			static void setThreadName(const string &name);
+
+			// the events recorded since the last call, as Chrome trace JSON
+			static string getChromeTrace();
+			static void saveChromeTrace(const string &file);
+			// drops everything recorded so far
+			static void reset();
+		};
+
+		// =====================================================
+		//	class TraceScope
+		//
+		///	Records its own scope under a literal name.
+		// =====================================================
+
+		class TraceScope {
+		private:
+			const char *name;
+			Uint64 beginCounter;
+
+		public:
+			explicit TraceScope(const char *name) {
+				this->name = name;
+				this->beginCounter = (TraceProfiler::isEnabled() == true ? TraceProfiler::getCounter() : 0);
+			}
+			~TraceScope() {
+				if (this->beginCounter != 0) {
+					TraceProfiler::addScope(this->name, this->beginCounter, TraceProfiler::getCounter());
+				}
+			}
+		};
+
 		// =====================================================
 		//	class funtions
 		// =====================================================
@@ -16,6 +16,7 @@
 #include <vector>
 #include <fstream>
 #include <map>
+#include <atomic>
 #include "thread.h"
 #include <curl/curl.h>
 #include <cstdio>
@@ -152,6 +153,9 @@ namespace Shared {
 			static int lockFileCountIndex;
 
 			static std::map<DebugType, SystemFlagsType> *debugLogFileList;
+			// one bit per DebugType, mirrors SystemFlagsType::enabled so hot
+			// code can test it without the map lookup
+			static std::atomic<uint32> enabledDebugTypes;
 			static bool haveSpecialOutputCommandLineOption;
 			static bool curl_global_init_called;
 
@@ -183,6 +187,25 @@ namespace Shared {
 				return (*debugLogFileList)[type];
 			}
 
+			// false for the types this build left out, lets the compiler
+			// drop their checks when type is a constant
+			inline static bool isDebugTypeCompiled(DebugType type) {
+#if defined(UNDEF_DEBUG)
+				return false;
+#elif defined(STRIP_SIMULATION_DEBUG_LOG)
+				return (type != debugWorldSynch && type != debugWorldSynchMax &&
+					type != debugPathFinder && type != debugLUA);
+#else
+				return true;
+#endif
+			}
+			inline static bool isDebugTypeEnabled(DebugType type) {
+				return (isDebugTypeCompiled(type) == true &&
+					(enabledDebugTypes.load(std::memory_order_relaxed) & (1u << type)) != 0);
+			}
+			// use this instead of setting SystemFlagsType::enabled
+			static void setDebugTypeEnabled(DebugType type, bool value);
+
 			static size_t httpWriteMemoryCallback(void *ptr, size_t size, size_t nmemb, void *data);
 			static std::string getHTTP(std::string URL, CURL *handle = NULL, int timeOut = -1, CURLcode *savedResult = NULL);
 			static std::string escapeURL(std::string URL, CURL *handle = NULL);
@@ -226,6 +249,14 @@ namespace Shared {
 			static void Close();
 		};
 
+		// cheap test for the log checks in hot code, the same as
+		// SystemFlags::getSystemSettingType(type).enabled
+#if defined(__GNUC__)
+#define DEBUG_TYPE_ENABLED(type) (__builtin_expect(SystemFlags::isDebugTypeEnabled(type), 0) != 0)
+#else
+#define DEBUG_TYPE_ENABLED(type) SystemFlags::isDebugTypeEnabled(type)
+#endif
+
 		const string sharedLibVersionString = "v0.4.1";
 
 		//string fcs
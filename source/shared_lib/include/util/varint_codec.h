@@ -0,0 +1,110 @@
+//      varint_codec.h:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _SHARED_UTIL_VARINTCODEC_H_
+#define _SHARED_UTIL_VARINTCODEC_H_
+
+#include <vector>
+#include <string>
+#include "data_types.h"
+#include "leak_dumper.h"
+
+using std::string;
+using namespace Shared::Platform;
+
+namespace Shared {
+	namespace Util {
+
+		// =====================================================
+		//	class VarintWriter
+		//
+		///	Appends LEB128 style variable length integers to a
+		///	byte buffer. Signed values are zigzag mapped so small
+		///	negative numbers (and deltas) stay short too.
+		// =====================================================
+
+		class VarintWriter {
+		private:
+			std::vector<uint8> buffer;
+
+		public:
+			void clear() {
+				buffer.clear();
+			}
+
+			void writeUInt32(uint32 value);
+			void writeInt32(int32 value);
+			// writes value - previousValue, wrapping like unsigned arithmetic
+			void writeDelta(int32 value, int32 previousValue);
+			// fixed 4 bytes in little endian order, for values that look random
+			void writeFixed32(uint32 value);
+			// writes a mask of the words that differ from previousValues
+			// followed by those words, count must not exceed 32
+			void writeChangedWords(const uint32 *values, const uint32 *previousValues, int count);
+			// length prefixed raw bytes
+			void writeString(const string &value);
+
+			const std::vector<uint8> & getBuffer() const {
+				return buffer;
+			}
+			uint32 getSize() const {
+				return (uint32) buffer.size();
+			}
+		};
+
+		// =====================================================
+		//	class VarintReader
+		//
+		///	Reads back what VarintWriter wrote, throws on truncated
+		///	or malformed input instead of reading past the end.
+		// =====================================================
+
+		class VarintReader {
+		private:
+			const uint8 *data;
+			uint32 size;
+			uint32 position;
+
+			uint8 readByte();
+
+		public:
+			VarintReader(const uint8 *data, uint32 size);
+
+			uint32 readUInt32();
+			int32 readInt32();
+			int32 readDelta(int32 previousValue);
+			uint32 readFixed32();
+			// updates values in place, previousValues may be values itself
+			void readChangedWords(uint32 *values, const uint32 *previousValues, int count);
+			string readString();
+
+			bool isAtEnd() const {
+				return position >= size;
+			}
+			uint32 getPosition() const {
+				return position;
+			}
+		};
+
+	}
+}//end namespace
+
+#endif
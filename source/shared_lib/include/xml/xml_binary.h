@@ -0,0 +1,111 @@
+//      xml_binary.h:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef _SHARED_XML_XMLBINARY_H_
+#define _SHARED_XML_XMLBINARY_H_
+
+#include <cstdio>
+#include <string>
+#include <map>
+#include <vector>
+#include "data_types.h"
+#include "varint_codec.h"
+#include "leak_dumper.h"
+
+using std::string;
+using Shared::Platform::uint8;
+using Shared::Platform::uint32;
+using Shared::Util::VarintWriter;
+
+namespace Shared {
+	namespace Xml {
+
+		class XmlNode;
+
+		// Binary chunked layout, all integers little endian:
+		//
+		//	header:	"ZGXB" format version(fixed32)
+		//	chunk:	type(byte) raw size(fixed32) stored size(fixed32) payload
+		//
+		// A data chunk payload is a run of varint encoded tokens, deflated
+		// with miniz when stored size differs from raw size. Element and
+		// attribute names are sent once and referenced by index after that,
+		// the name table carries over from chunk to chunk. Tokens never
+		// straddle two chunks. The file ends with an empty end chunk.
+
+		// =====================================================
+		//	class XmlBinaryWriter
+		//
+		///	Streams elements straight to a file without building
+		///	a document first, a chunk is flushed (and optionally
+		///	compressed) whenever enough tokens have piled up.
+		// =====================================================
+
+		class XmlBinaryWriter {
+		private:
+			FILE *file;
+			string path;
+			int compressionLevel;
+			int depth;
+			VarintWriter chunk;
+			std::map<string, uint32> nameIndexes;
+
+			void writeName(const string &name);
+			void flushChunk(bool force);
+			void writeChunk(uint8 chunkType, const uint8 *data, uint32 rawSize);
+
+		public:
+			static const uint32 formatVersion;
+			static const uint32 chunkFlushSize;
+
+			// compressionLevel 0 stores chunks as they are, 1 - 9 deflates them
+			XmlBinaryWriter(const string &path, int compressionLevel = 1);
+			~XmlBinaryWriter();
+
+			void beginElement(const string &name, const string &text = "");
+			void addAttribute(const string &name, const string &value);
+			void endElement();
+			// writes node and everything below it
+			void writeNode(const XmlNode *node);
+			void close();
+		};
+
+		// =====================================================
+		//	class XmlBinaryReader
+		//
+		///	Reads a file written by XmlBinaryWriter one chunk at
+		///	a time and builds the XmlNode tree from the tokens.
+		// =====================================================
+
+		class XmlBinaryReader {
+		public:
+			static bool isBinaryFile(const string &path);
+			static bool hasBinaryHeader(const char *data, size_t size);
+
+			// returns the root node, the caller owns it
+			static XmlNode *load(const string &path, const std::map<string, string> &mapTagReplacementValues,
+				bool skipUpdatePathClimbingParts = false);
+		};
+
+	}
+}//end namespace
+
+#endif
@@ -65,6 +65,7 @@ namespace Shared {
 		class XmlTree;
 		class XmlNode;
 		class XmlAttribute;
+		class XmlArena;
 
 #if defined(WANT_XERCES)
 		// =====================================================
@@ -125,7 +126,9 @@ namespace Shared {
 			static bool isInitialized();
 			void cleanup();
 
-			XmlNode *load(const string &path, const std::map<string, string> &mapTagReplacementValues, bool noValidation = false, bool skipStackTrace = false, bool skipUpdatePathClimbingParts = false);
+			// with useArena the whole tree is placed in one XmlArena
+			// owned by the returned root node
+			XmlNode *load(const string &path, const std::map<string, string> &mapTagReplacementValues, bool noValidation = false, bool skipStackTrace = false, bool skipUpdatePathClimbingParts = false, bool useArena = false);
 			void save(const string &path, const XmlNode *node);
 		};
 
@@ -140,6 +143,9 @@ namespace Shared {
 			xml_engine_parser_type engine_type;
 			bool skipStackCheck;
 			bool skipUpdatePathClimbingParts;
+			bool useArena;
+
+			static bool arenaDefault;
 		private:
 			XmlTree(XmlTree&);
 			void operator =(XmlTree&);
@@ -150,15 +156,55 @@ namespace Shared {
 			~XmlTree();
 
 			void setSkipUpdatePathClimbingParts(bool value);
+			// rapidxml loads put all nodes and attributes in one arena
+			void setUseArena(bool value) {
+				useArena = value;
+			}
+			static void setArenaDefault(bool value) {
+				arenaDefault = value;
+			}
+			static bool getArenaDefault() {
+				return arenaDefault;
+			}
 			void init(const string &name);
 			void load(const string &path, const std::map<string, string> &mapTagReplacementValues, bool noValidation = false, bool skipStackCheck = false, bool skipStackTrace = false);
 			void save(const string &path);
+			// writes the tree in the chunked binary format of xml_binary.h,
+			// load() tells both formats apart on its own
+			void saveBinary(const string &path, int compressionLevel = 1);
 
 			XmlNode *getRootNode() const {
 				return rootNode;
 			}
 		};
 
+		// =====================================================
+		//	class XmlPreloadCache
+		//
+		///	Trees parsed ahead of time by loader threads. While
+		///	enabled, XmlTree::load takes a tree from here when path
+		///	and tag replacement values match exactly, otherwise it
+		///	parses the file itself as before.
+		// =====================================================
+
+		class XmlPreloadCache {
+		public:
+			static void enable();
+			// drops the trees nobody asked for
+			static void disable();
+			static bool isEnabled();
+
+			// parses path into the cache unless it is there already or was
+			// loaded meanwhile, errors are left to the regular load to report
+			static bool preload(const string &path, const std::map<string, string> &mapTagReplacementValues, bool skipUpdatePathClimbingParts = false);
+			// the tree parsed for exactly this load or NULL, waits for it
+			// when a loader thread is parsing it right now
+			static XmlNode *take(const string &path, const std::map<string, string> &mapTagReplacementValues, bool skipUpdatePathClimbingParts = false);
+
+			static Shared::Platform::uint32 getHits();
+			static Shared::Platform::uint32 getMisses();
+		};
+
 		// =====================================================
 		//	class XmlNode
 		// =====================================================
@@ -170,13 +216,23 @@ namespace Shared {
 			vector<XmlNode*> children;
 			vector<XmlAttribute*> attributes;
 			mutable const XmlNode* superNode;
+			// placed in the arena of its tree rather than on the heap
+			bool arenaAllocated;
+			// set on the root node of an arena tree only
+			XmlArena *ownedArena;
 
 		private:
 			XmlNode(XmlNode&);
 			void operator =(XmlNode&);
+			XmlNode(xml_node<> *node, const std::map<string, string> &mapTagReplacementValues, bool skipUpdatePathClimbingParts, XmlArena *arena);
 
 			string getTreeString() const;
 			bool hasChildNoSuper(const string& childName) const;
+			static void deleteNode(XmlNode *node);
+
+			friend class XmlBinaryReader;
+			friend class XmlIoRapid;
+			friend class XmlArena;
 
 		public:
 
@@ -235,13 +291,25 @@ namespace Shared {
 		private:
 			string value;
 			string name;
+			// in arena trees name and value point into the parse buffer
+			// for as long as they are the same as in the file
+			const char *nameRef;
+			const char *valueRef;
+			bool arenaAllocated;
 			bool skipRestrictionCheck;
 			bool usesCommondata;
-			std::map<string, string> mapTagReplacementValues;
 
 		private:
 			XmlAttribute(XmlAttribute&);
 			void operator =(XmlAttribute&);
+			XmlAttribute(xml_attribute<> *attribute, const std::map<string, string> &mapTagReplacementValues, XmlArena *arena);
+
+			const string getRawValue() const {
+				return (valueRef != NULL ? string(valueRef) : value);
+			}
+
+			friend class XmlNode;
+			friend class XmlArena;
 
 		public:
 
@@ -256,7 +324,7 @@ namespace Shared {
 
 		public:
 			const string getName() const {
-				return name;
+				return (nameRef != NULL ? string(nameRef) : name);
 			}
 			const string getValue(string prefixValue = "", bool trimValueWithStartingSlash = false) const;
 
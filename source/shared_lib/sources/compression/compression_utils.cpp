@@ -326,7 +326,7 @@ namespace Shared {
 
 		std::pair<unsigned char *, unsigned long> compressMemoryToMemory(unsigned char *input, unsigned long input_len, int compressionLevel) {
 			// Like compress() but with more control, level may range from 0 (storing) to 9 (max. compression)
-			unsigned long compressed_buffer_len = input_len + 100;
+			unsigned long compressed_buffer_len = compressBound(input_len);
 			unsigned char *compressed_buffer = new unsigned char[compressed_buffer_len + 1];
 			memset(compressed_buffer, 0, compressed_buffer_len + 1);
 
@@ -12,6 +12,7 @@
 #include "font.h"
 #include <stdexcept>
 #include <string.h>
+#include <algorithm>
 #include "conversion.h"
 
 #ifdef USE_FTGL
@@ -98,11 +99,27 @@ namespace Shared {
 		//	class FontMetrics
 		// =====================================================
 
+		// the glyph table holds printable ascii
+		static const int glyphTableFirst = 32;
+		static const int glyphTableSize = 95;
+		// marks glyph table entries not measured yet, kerning can be negative
+		static const float unmeasuredAdvance = -1.0e9f;
+
+		unsigned int FontMetrics::maxCacheEntries = 256;
+		uint64 FontMetrics::textAdvanceCacheHits = 0;
+		uint64 FontMetrics::textAdvanceCacheMisses = 0;
+		uint64 FontMetrics::glyphTableMeasures = 0;
+		uint64 FontMetrics::wrappedTextCacheHits = 0;
+		uint64 FontMetrics::wrappedTextCacheMisses = 0;
+
 		FontMetrics::FontMetrics(Text *textHandler) {
 			this->textHandler = textHandler;
 			//SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] this->textHandler = [%p] Owner = [%p]\n", __FILE__, __FUNCTION__, __LINE__, this->textHandler,this);
 			this->widths = new float[Font::charCount];
 			this->height = 0;
+			this->glyphAdvances = NULL;
+			this->kerningAdvances = NULL;
+			this->wrappedTextScale = Font::scaleFontValue;
 
 			for (int i = 0; i < Font::charCount; ++i) {
 				widths[i] = 0;
@@ -112,10 +129,12 @@ namespace Shared {
 		FontMetrics::~FontMetrics() {
 			delete[] widths;
 			widths = NULL;
+			clearCaches();
 		}
 
 		void FontMetrics::setTextHandler(Text *textHandler) {
 			this->textHandler = textHandler;
+			clearCaches();
 			//SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] this->textHandler = [%p] Owner = [%p]\n", __FILE__, __FUNCTION__, __LINE__, this->textHandler, this);
 		}
 
@@ -123,31 +142,115 @@ namespace Shared {
 			return this->textHandler;
 		}
 
+		void FontMetrics::clearCaches() {
+			delete[] glyphAdvances;
+			glyphAdvances = NULL;
+			delete[] kerningAdvances;
+			kerningAdvances = NULL;
+
+			textAdvanceCache.clear();
+			wrappedTextCache.clear();
+		}
+
+		float FontMetrics::getGlyphAdvance(int glyph) {
+			float &advance = glyphAdvances[glyph - glyphTableFirst];
+			if (advance == unmeasuredAdvance) {
+				char text[2] = { (char) glyph, '\0' };
+				advance = textHandler->Advance(text);
+			}
+			return advance;
+		}
+
+		float FontMetrics::getKerningAdvance(int glyph, int nextGlyph) {
+			float &advance = kerningAdvances[(glyph - glyphTableFirst) * glyphTableSize + (nextGlyph - glyphTableFirst)];
+			if (advance == unmeasuredAdvance) {
+				// whatever the text handler adds between the two glyphs
+				char text[3] = { (char) glyph, (char) nextGlyph, '\0' };
+				advance = textHandler->Advance(text) - getGlyphAdvance(glyph) - getGlyphAdvance(nextGlyph);
+			}
+			return advance;
+		}
+
+		bool FontMetrics::measureWithGlyphTable(const char *text, size_t length, float &advance) {
+			for (size_t i = 0; i < length; ++i) {
+				int glyph = (unsigned char) text[i];
+				if (glyph < glyphTableFirst || glyph >= glyphTableFirst + glyphTableSize) {
+					return false;
+				}
+			}
+
+			if (glyphAdvances == NULL) {
+				glyphAdvances = new float[glyphTableSize];
+				kerningAdvances = new float[glyphTableSize * glyphTableSize];
+				std::fill(glyphAdvances, glyphAdvances + glyphTableSize, unmeasuredAdvance);
+				std::fill(kerningAdvances, kerningAdvances + glyphTableSize * glyphTableSize, unmeasuredAdvance);
+			}
+
+			advance = 0;
+			for (size_t i = 0; i < length; ++i) {
+				int glyph = (unsigned char) text[i];
+				if (i > 0) {
+					advance += getKerningAdvance((unsigned char) text[i - 1], glyph);
+				}
+				advance += getGlyphAdvance(glyph);
+			}
+			return true;
+		}
+
+		float FontMetrics::getLineAdvance(const char *text, size_t length) {
+			float advance = 0;
+			if (measureWithGlyphTable(text, length, advance) == true) {
+				glyphTableMeasures++;
+				return advance;
+			}
+
+			// multibyte and control characters are left to the text handler
+			string line(text, length);
+			if (textAdvanceCache.get(line, advance) == true) {
+				textAdvanceCacheHits++;
+				return advance;
+			}
+			textAdvanceCacheMisses++;
+
+			advance = textHandler->Advance(line.c_str());
+			textAdvanceCache.add(line, advance, maxCacheEntries);
+			return advance;
+		}
+
+		float FontMetrics::getTextAdvance(const string &str) {
+			if (textHandler == NULL) {
+				return getTextWidth(str);
+			}
+			return getLineAdvance(str.c_str(), str.size());
+		}
+
 		float FontMetrics::getTextWidth(const string &str) {
-			string longestLine = "";
+			size_t longestStart = 0;
+			size_t longestLength = 0;
 			size_t found = str.find("\n");
 			if (found == string::npos) {
-				longestLine = str;
+				longestLength = str.size();
 			} else {
-				vector<string> lineTokens;
-				Tokenize(str, lineTokens, "\n");
-				if (lineTokens.empty() == false) {
-					for (unsigned int i = 0; i < lineTokens.size(); ++i) {
-						string currentStr = lineTokens[i];
-						if (currentStr.length() > longestLine.length()) {
-							longestLine = currentStr;
-						}
+				for (size_t lineStart = 0; lineStart <= str.size(); lineStart = found + 1) {
+					found = str.find("\n", lineStart);
+					if (found == string::npos) {
+						found = str.size();
+					}
+					if (found - lineStart > longestLength) {
+						longestStart = lineStart;
+						longestLength = found - lineStart;
 					}
 				}
 			}
+			const char *longestLine = str.c_str() + longestStart;
 
 			if (textHandler != NULL) {
-				return (textHandler->Advance(longestLine.c_str()) * Font::scaleFontValue);
+				return (getLineAdvance(longestLine, longestLength) * Font::scaleFontValue);
 			} else {
 				float width = 0.f;
-				for (unsigned int i = 0; i < longestLine.size() && (int) i < Font::charCount; ++i) {
+				for (unsigned int i = 0; i < longestLength && (int) i < Font::charCount; ++i) {
 					if (longestLine[i] >= Font::charCount) {
-						string sError = "str[i] >= Font::charCount, [" + longestLine + "] i = " + uIntToStr(i);
+						string sError = "str[i] >= Font::charCount, [" + string(longestLine, longestLength) + "] i = " + uIntToStr(i);
 						throw megaglest_runtime_error(sError);
 					}
 					//Treat 2 byte characters as spaces
@@ -170,6 +273,20 @@ namespace Shared {
 		}
 
 		string FontMetrics::wordWrapText(string text, int maxWidth) {
+			// widths of wrapped texts were taken at the old scale
+			if (wrappedTextScale != Font::scaleFontValue) {
+				wrappedTextCache.clear();
+				wrappedTextScale = Font::scaleFontValue;
+			}
+
+			string cacheKey = intToStr(maxWidth) + ":" + text;
+			string wrappedText = "";
+			if (wrappedTextCache.get(cacheKey, wrappedText) == true) {
+				wrappedTextCacheHits++;
+				return wrappedText;
+			}
+			wrappedTextCacheMisses++;
+
 			// Strip newlines from source
 			replaceAll(text, "\n", " \n ");
 
@@ -177,11 +294,10 @@ namespace Shared {
 			vector<string> words;
 			Tokenize(text, words, " ");
 
-			string wrappedText = "";
 			float lineWidth = 0.0f;
 
 			for (unsigned int i = 0; i < words.size(); ++i) {
-				string word = words[i];
+				const string &word = words[i];
 				if (word == "\n") {
 					wrappedText += word;
 					lineWidth = 0;
@@ -191,14 +307,36 @@ namespace Shared {
 						wrappedText += "\n";
 						lineWidth = 0;
 					}
-					lineWidth += this->getTextWidth(word + " ");
-					wrappedText += word + " ";
+					// measure the word and its space where they were appended
+					size_t wordStart = wrappedText.size();
+					wrappedText += word;
+					wrappedText += " ";
+					if (textHandler != NULL) {
+						lineWidth += getLineAdvance(wrappedText.c_str() + wordStart, word.size() + 1) * Font::scaleFontValue;
+					} else {
+						lineWidth += this->getTextWidth(wrappedText.substr(wordStart));
+					}
 				}
 			}
 
+			wrappedTextCache.add(cacheKey, wrappedText, maxCacheEntries);
 			return wrappedText;
 		}
 
+		string FontMetrics::getCacheStats() {
+			return "glyph table measures: " + uIntToStr(glyphTableMeasures) +
+				" text widths hits: " + uIntToStr(textAdvanceCacheHits) + " misses: " + uIntToStr(textAdvanceCacheMisses) +
+				" wrapped texts hits: " + uIntToStr(wrappedTextCacheHits) + " misses: " + uIntToStr(wrappedTextCacheMisses);
+		}
+
+		void FontMetrics::resetCacheStats() {
+			textAdvanceCacheHits = 0;
+			textAdvanceCacheMisses = 0;
+			glyphTableMeasures = 0;
+			wrappedTextCacheHits = 0;
+			wrappedTextCacheMisses = 0;
+		}
+
 		// ===============================================
 		//	class Font
 		// ===============================================
@@ -290,7 +428,8 @@ namespace Shared {
 		}
 		void Font::setSize(int size) {
 			if (textHandler) {
-				return textHandler->SetFaceSize(size);
+				textHandler->SetFaceSize(size);
+				metrics.clearCaches();
 			} else {
 				this->size = size;
 			}
@@ -270,8 +270,20 @@ namespace Shared {
 				if (renderMode == rmSelection && mesh->getNoSelect() == true) {// don't render this and do nothing
 					return;
 				}
+				setupMesh(mesh, renderMode, alpha);
+				drawMesh(mesh);
+				finishMesh(mesh, renderMode);
+			}
+
+			bool ModelRendererGl::canRenderInstances(const Model *model) const {
+				// animated meshes are interpolated per instance, so they can't share buffers
+				return (getVBOSupported() == true && isStaticModel(model) == true);
+			}
+
+			void ModelRendererGl::setupMesh(Mesh *mesh, int renderMode, float alpha) {
 				//assertions
 				assertGl();
+				meshSetupCount++;
 
 				//glPolygonOffset(0.05f, 0.0f);
 				//set cull face
@@ -320,10 +332,6 @@ namespace Shared {
 					}
 				}
 
-				//misc vars
-				uint32 vertexCount = mesh->getVertexCount();
-				uint32 indexCount = mesh->getIndexCount();
-
 				//assertions
 				assertGl();
 
@@ -375,6 +383,8 @@ namespace Shared {
 						glActiveTexture(GL_TEXTURE0);
 						glDisableClientState(GL_TEXTURE_COORD_ARRAY);
 					}
+
+					glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, mesh->getVBOIndexes());
 				} else {
 					//printf("Rendering Mesh WITHOUT VBO's\n");
 
@@ -412,23 +422,33 @@ namespace Shared {
 					}
 				}
 
-				if (getVBOSupported() == true && mesh->getFrameCount() == 1) {
-					assertGl();
+				//assertions
+				assertGl();
+			}
 
-					glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, mesh->getVBOIndexes());
+			void ModelRendererGl::drawMesh(Mesh *mesh) {
+				//misc vars
+				uint32 vertexCount = mesh->getVertexCount();
+				uint32 indexCount = mesh->getIndexCount();
+
+				assertGl();
+				if (getVBOSupported() == true && mesh->getFrameCount() == 1) {
 					glDrawRangeElements(GL_TRIANGLES, 0, vertexCount - 1, indexCount, GL_UNSIGNED_INT, (char *) NULL);
-					glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
-					glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
 
 					//glDrawRangeElements(GL_TRIANGLES, 0, vertexCount-1, indexCount, GL_UNSIGNED_INT, mesh->getIndices());
-
-					assertGl();
 				} else {
 					//draw model
-					assertGl();
-
 					glDrawRangeElements(GL_TRIANGLES, 0, vertexCount - 1, indexCount, GL_UNSIGNED_INT, mesh->getIndices());
 				}
+				drawCallCount++;
+				assertGl();
+			}
+
+			void ModelRendererGl::finishMesh(Mesh *mesh, int renderMode) {
+				if (getVBOSupported() == true && mesh->getFrameCount() == 1) {
+					glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, 0);
+					glBindBufferARB(GL_ARRAY_BUFFER_ARB, 0);
+				}
 
 				// glow
 				if (renderMode == rmNormal && mesh->getGlow() == true) {
@@ -31,14 +31,12 @@ namespace Shared {
 				assert(bufferSize % 4 == 0);
 
 				rendering = false;
+				quadBatchStarted = false;
+				quadBatchVertexCount = 0;
+				quadBatchBlendMode = ParticleSystem::bmOne;
+				quadBatchTexture = NULL;
 
-				// init texture coordinates for quads
-				for (int i = 0; i < bufferSize; i += 4) {
-					texCoordBuffer[i] = Vec2f(0.0f, 1.0f);
-					texCoordBuffer[i + 1] = Vec2f(0.0f, 0.0f);
-					texCoordBuffer[i + 2] = Vec2f(1.0f, 0.0f);
-					texCoordBuffer[i + 3] = Vec2f(1.0f, 1.0f);
-				}
+				reserveBuffers(bufferSize);
 			}
 
 			void ParticleRendererGl::renderManager(ParticleManager *pm, ModelRenderer *mr) {
@@ -61,9 +59,16 @@ namespace Shared {
 				glDepthMask(GL_FALSE);
 				glEnable(GL_BLEND);
 
+				// particles are billboards facing the camera
+				float modelview[16];
+				glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
+				rightVector = Vec3f(modelview[0], modelview[4], modelview[8]);
+				upVector = Vec3f(modelview[1], modelview[5], modelview[9]);
+
 				//render
 				rendering = true;
 				pm->render(this, mr);
+				flushQuadBatch();
 				rendering = false;
 
 				// blend mode back to normal
@@ -81,34 +86,38 @@ namespace Shared {
 				assertGl();
 				assert(rendering);
 
-				Vec3f rightVector;
-				Vec3f upVector;
-				float modelview[16];
+				if (quadBatchStarted == true &&
+					(quadBatchBlendMode != ps->getBlendMode() || quadBatchTexture != ps->getTexture())) {
+					flushQuadBatch();
+				}
 
-				//render particles
-				setBlendMode(ps->getBlendMode());
+				if (quadBatchStarted == false) {
+					//render particles
+					setBlendMode(ps->getBlendMode());
 
-				// get the current modelview state
-				glGetFloatv(GL_MODELVIEW_MATRIX, modelview);
-				rightVector = Vec3f(modelview[0], modelview[4], modelview[8]);
-				upVector = Vec3f(modelview[1], modelview[5], modelview[9]);
+					// set state
+					if (ps->getTexture() != NULL) {
+						glBindTexture(GL_TEXTURE_2D, static_cast<Texture2DGl*>(ps->getTexture())->getHandle());
+					} else {
+						glBindTexture(GL_TEXTURE_2D, 0);
+					}
+					glDisable(GL_ALPHA_TEST);
+					glDisable(GL_FOG);
+					glAlphaFunc(GL_GREATER, 0.0f);
+					glEnable(GL_TEXTURE_2D);
+					glEnableClientState(GL_VERTEX_ARRAY);
+					glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+					glEnableClientState(GL_COLOR_ARRAY);
 
-				// set state
-				if (ps->getTexture() != NULL) {
-					glBindTexture(GL_TEXTURE_2D, static_cast<Texture2DGl*>(ps->getTexture())->getHandle());
-				} else {
-					glBindTexture(GL_TEXTURE_2D, 0);
+					quadBatchStarted = true;
+					quadBatchVertexCount = 0;
+					quadBatchBlendMode = ps->getBlendMode();
+					quadBatchTexture = ps->getTexture();
 				}
-				glDisable(GL_ALPHA_TEST);
-				glDisable(GL_FOG);
-				glAlphaFunc(GL_GREATER, 0.0f);
-				glEnable(GL_TEXTURE_2D);
-				glEnableClientState(GL_VERTEX_ARRAY);
-				glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-				glEnableClientState(GL_COLOR_ARRAY);
 
 				//fill vertex buffer with billboards
-				int bufferIndex = 0;
+				int bufferIndex = quadBatchVertexCount;
+				reserveBuffers(bufferIndex + ps->getAliveParticleCount() * 4);
 
 				for (int i = 0; i < ps->getAliveParticleCount(); ++i) {
 					const Particle *particle = ps->getParticle(i);
@@ -127,13 +136,8 @@ namespace Shared {
 					colorBuffer[bufferIndex + 3] = color;
 
 					bufferIndex += 4;
-
-					if (bufferIndex >= bufferSize) {
-						bufferIndex = 0;
-						renderBufferQuads(bufferSize);
-					}
 				}
-				renderBufferQuads(bufferIndex);
+				quadBatchVertexCount = bufferIndex;
 
 				assertGl();
 			}
@@ -142,6 +146,7 @@ namespace Shared {
 
 				assertGl();
 				assert(rendering);
+				flushQuadBatch();
 
 				if (!ps->isEmpty()) {
 					const Particle *particle = ps->getParticle(0);
@@ -186,6 +191,7 @@ namespace Shared {
 
 				assertGl();
 				assert(rendering);
+				flushQuadBatch();
 
 				if (!ps->isEmpty()) {
 					const Particle *particle = ps->getParticle(0);
@@ -231,6 +237,7 @@ namespace Shared {
 				//render model
 				Model *model = ps->getModel();
 				if (model != NULL) {
+					flushQuadBatch();
 
 					//init
 					glEnable(GL_LIGHTING);
@@ -277,18 +284,58 @@ namespace Shared {
 			// ============== PRIVATE =====================================
 
 			void ParticleRendererGl::renderBufferQuads(int quadCount) {
-				glVertexPointer(3, GL_FLOAT, 0, vertexBuffer);
-				glTexCoordPointer(2, GL_FLOAT, 0, texCoordBuffer);
-				glColorPointer(4, GL_FLOAT, 0, colorBuffer);
+				if (quadCount <= 0) {
+					return;
+				}
+				glVertexPointer(3, GL_FLOAT, 0, &vertexBuffer[0]);
+				glTexCoordPointer(2, GL_FLOAT, 0, &texCoordBuffer[0]);
+				glColorPointer(4, GL_FLOAT, 0, &colorBuffer[0]);
 
 				glDrawArrays(GL_QUADS, 0, quadCount);
+				drawCallCount++;
 			}
 
 			void ParticleRendererGl::renderBufferLines(int lineCount) {
-				glVertexPointer(3, GL_FLOAT, 0, vertexBuffer);
-				glColorPointer(4, GL_FLOAT, 0, colorBuffer);
+				if (lineCount <= 0) {
+					return;
+				}
+				glVertexPointer(3, GL_FLOAT, 0, &vertexBuffer[0]);
+				glColorPointer(4, GL_FLOAT, 0, &colorBuffer[0]);
 
 				glDrawArrays(GL_LINES, 0, lineCount);
+				drawCallCount++;
+			}
+
+			void ParticleRendererGl::flushQuadBatch() {
+				if (quadBatchStarted == true) {
+					renderBufferQuads(quadBatchVertexCount);
+					quadBatchStarted = false;
+					quadBatchVertexCount = 0;
+					quadBatchTexture = NULL;
+				}
+			}
+
+			void ParticleRendererGl::reserveBuffers(int vertexCount) {
+				int oldSize = (int) vertexBuffer.size();
+				if (vertexCount <= oldSize) {
+					return;
+				}
+				// grow in whole quads and never shrink, the buffers settle
+				// at the size of the busiest frame
+				int newSize = max(vertexCount, oldSize * 2);
+				newSize += (4 - newSize % 4) % 4;
+
+				vertexBuffer.resize(newSize);
+				colorBuffer.resize(newSize);
+				texCoordBuffer.resize(newSize);
+
+				// init texture coordinates for quads
+				for (int i = oldSize; i < newSize; i += 4) {
+					texCoordBuffer[i] = Vec2f(0.0f, 1.0f);
+					texCoordBuffer[i + 1] = Vec2f(0.0f, 0.0f);
+					texCoordBuffer[i + 2] = Vec2f(1.0f, 0.0f);
+					texCoordBuffer[i + 3] = Vec2f(1.0f, 1.0f);
+				}
 			}
 
 			void ParticleRendererGl::setBlendMode(ParticleSystem::BlendMode blendMode) {
@@ -76,7 +76,7 @@ namespace Shared {
 					//delete [] utfStr;
 
 					if (centered) {
-						rasterPos.x = x - font->getTextHandler()->Advance(renderText.c_str()) / 2.f;
+						rasterPos.x = x - font->getMetrics()->getTextAdvance(renderText) / 2.f;
 						rasterPos.y = y + font->getTextHandler()->LineHeight(renderText.c_str()) / 2;
 						//printf("text [%s] x = %f, y = %f rasterPos [%s]\n",text.c_str(),x,y,rasterPos.getString().c_str());
 					} else {
@@ -483,7 +483,7 @@ namespace Shared {
 			//			translatePos.x = x - scale * font->getTextHandler()->Advance(text.c_str()) / 2.f;
 			//			translatePos.y = y - scale * font->getTextHandler()->LineHeight(text.c_str()) / font->getYOffsetFactor();
 						//assertGl();
-						translatePos.x = x - (font->getTextHandler()->Advance(renderText.c_str()) / 2.f);
+						translatePos.x = x - (metrics->getTextAdvance(renderText) / 2.f);
 						//assertGl();
 						//translatePos.y = y - (font->getTextHandler()->LineHeight(text.c_str()) / font->getYOffsetFactor());
 						translatePos.y = y - ((font->getTextHandler()->LineHeight(renderText.c_str()) * Font::scaleFontValue) / 2.f);
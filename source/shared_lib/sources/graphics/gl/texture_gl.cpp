@@ -314,12 +314,12 @@ namespace Shared {
 				}
 
 				if (Texture::useTextureCompression == true) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "------------------------------------------------\n");
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** getSupportCompressedTextureFormats() result.size() = %d, count = %d\n", (int) result.size(), count);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "------------------------------------------------\n");
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** getSupportCompressedTextureFormats() result.size() = %d, count = %d\n", (int) result.size(), count);
 					for (unsigned int i = 0; i < result.size(); ++i) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "Texture Compression #i = %d, result[i] = %d [%s]\n", i, result[i], getSupportCompressedTextureFormatString(result[i]).c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "Texture Compression #i = %d, result[i] = %d [%s]\n", i, result[i], getSupportCompressedTextureFormatString(result[i]).c_str());
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "------------------------------------------------\n");
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "------------------------------------------------\n");
 				}
 				return result;
 			}
@@ -588,7 +588,7 @@ namespace Shared {
 					// Does the GPU support current FBO configuration?
 					GLenum status = glCheckFramebufferStatusEXT(GL_FRAMEBUFFER_EXT);
 					if (status != GL_FRAMEBUFFER_COMPLETE_EXT) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "checkFrameBufferStatus() status = %d [%X]\n", status, status);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "checkFrameBufferStatus() status = %d [%X]\n", status, status);
 						return false;
 					}
 					return true;
@@ -1262,13 +1262,13 @@ namespace Shared {
 				if (Texture::useTextureCompression == true) {
 					GLint glFormat = toFormatGl(format, components);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** Texture filename: [%s] format = %d components = %d, glFormat = %d, rawSize = %llu\n", path.c_str(), format, components, glFormat, (long long unsigned int)rawSize);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** Texture filename: [%s] format = %d components = %d, glFormat = %d, rawSize = %llu\n", path.c_str(), format, components, glFormat, (long long unsigned int)rawSize);
 
 					GLint compressed = 0;
 					glGetTexLevelParameteriv(texType, 0, GL_TEXTURE_COMPRESSED, &compressed);
 					int error = glGetError();
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** Texture compressed status: %d, error [%d] (%X)\n", compressed, error, error);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** Texture compressed status: %d, error [%d] (%X)\n", compressed, error, error);
 
 					bool isCompressed = (compressed == 1);
 					compressed = 0;
@@ -1280,12 +1280,12 @@ namespace Shared {
 						percent = ((double) compressed / (double) rawSize) * (double)100.0;
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** Texture image size in video RAM: %d [%.2f%%], error [%d] (%X)\n", compressed, percent, error, error);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** Texture image size in video RAM: %d [%.2f%%], error [%d] (%X)\n", compressed, percent, error, error);
 
 					compressed = 0;
 					glGetTexLevelParameteriv(texType, 0, GL_TEXTURE_INTERNAL_FORMAT, &compressed);
 					error = glGetError();
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** Texture image compression format used: %d, error [%d] (%X)\n", compressed, error, error);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "**** Texture image compression format used: %d, error [%d] (%X)\n", compressed, error, error);
 				}
 			}
 
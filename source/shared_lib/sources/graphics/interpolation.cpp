@@ -19,6 +19,16 @@
 #include "util.h"
 #include <stdexcept>
 #include "platform_util.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define INTERPOLATION_USE_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define INTERPOLATION_USE_SSE2
+#endif
+
 #include "leak_dumper.h"
 
 using namespace std;
@@ -32,6 +42,11 @@ namespace Shared {
 		// =====================================================
 
 		bool InterpolationData::enableInterpolation = true;
+		uint32 InterpolationData::cacheSteps = 64;
+		uint32 InterpolationData::maxCacheEntries = 8;
+		const uint32 InterpolationData::maxPreparedCacheEntries = 256;
+		uint64 InterpolationData::cacheHits = 0;
+		uint64 InterpolationData::cacheMisses = 0;
 
 		InterpolationData::InterpolationData(const Mesh *mesh) {
 			if (GlobalStaticFlags::getIsNonGraphicalModeEnabled() == true) {
@@ -42,14 +57,22 @@ namespace Shared {
 			normals = NULL;
 
 			raw_frame_ofs = 0;
+			useCounter = 0;
 
 			this->mesh = mesh;
 		}
 
 		InterpolationData::~InterpolationData() {
-			delete[] vertices;
+			for (unsigned int i = 0; i < vertexCache.size(); ++i) {
+				delete[] vertexCache[i].data;
+			}
+			vertexCache.clear();
+			for (unsigned int i = 0; i < normalCache.size(); ++i) {
+				delete[] normalCache[i].data;
+			}
+			normalCache.clear();
+
 			vertices = NULL;
-			delete[] normals;
 			normals = NULL;
 		}
 
@@ -59,14 +82,123 @@ namespace Shared {
 		}
 
 		void InterpolationData::updateVertices(float t, bool cycle) {
-			update(mesh->getVertices(), vertices, t, cycle);
+			update(mesh->getVertices(), vertices, vertexCache, t, cycle);
 		}
 
 		void InterpolationData::updateNormals(float t, bool cycle) {
-			update(mesh->getNormals(), normals, t, cycle);
+			update(mesh->getNormals(), normals, normalCache, t, cycle);
+		}
+
+		void InterpolationData::lerpVertices(const Vec3f *prev, const Vec3f *next, Vec3f *dest, uint32 count, float t) {
+			// Vec3f is three packed floats, so the arrays are lerped as flat float runs
+			const float *a = &prev[0].x;
+			const float *b = &next[0].x;
+			float *d = &dest[0].x;
+			uint32 floatCount = count * 3;
+			uint32 i = 0;
+
+#if defined(INTERPOLATION_USE_AVX2)
+			__m256 t8 = _mm256_set1_ps(t);
+			for (; i + 8 <= floatCount; i += 8) {
+				__m256 va = _mm256_loadu_ps(a + i);
+				__m256 vb = _mm256_loadu_ps(b + i);
+				_mm256_storeu_ps(d + i, _mm256_add_ps(va, _mm256_mul_ps(_mm256_sub_ps(vb, va), t8)));
+			}
+#endif
+#if defined(INTERPOLATION_USE_SSE2)
+			__m128 t4 = _mm_set1_ps(t);
+			for (; i + 4 <= floatCount; i += 4) {
+				__m128 va = _mm_loadu_ps(a + i);
+				__m128 vb = _mm_loadu_ps(b + i);
+				_mm_storeu_ps(d + i, _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), t4)));
+			}
+#endif
+			for (; i < floatCount; ++i) {
+				d[i] = a[i] + (b[i] - a[i]) * t;
+			}
+		}
+
+		Vec3f *InterpolationData::getPose(std::vector<InterpolationCacheEntry> &cache, const Vec3f* src,
+			uint32 prevFrame, uint32 nextFrame, float localT, uint32 entryLimit, uint64 &hits, uint64 &misses) {
+			uint32 vertexCount = mesh->getVertexCount();
+
+			// without steps every call interpolates into a single buffer, like it always did
+			uint64 key = 0xFFFFFFFFFFFFFFFFULL;
+			if (cacheSteps > 0) {
+				uint32 step = min<uint32>(static_cast<uint32>(localT * cacheSteps + 0.5f), cacheSteps);
+				localT = static_cast<float>(step) / static_cast<float>(cacheSteps);
+				key = (static_cast<uint64>(prevFrame) << 42) | (static_cast<uint64>(nextFrame) << 21) | step;
+
+				for (unsigned int i = 0; i < cache.size(); ++i) {
+					if (cache[i].key == key) {
+						cache[i].lastUsed = ++useCounter;
+						hits++;
+						return cache[i].data;
+					}
+				}
+				misses++;
+			} else {
+				entryLimit = 1;
+			}
+
+			InterpolationCacheEntry *entry = NULL;
+			if (cache.size() < entryLimit) {
+				InterpolationCacheEntry newEntry;
+				newEntry.data = new Vec3f[vertexCount];
+				cache.push_back(newEntry);
+				entry = &cache.back();
+			} else {
+				// reuse the pose that went the longest without being asked for
+				entry = &cache[0];
+				for (unsigned int i = 1; i < cache.size(); ++i) {
+					if (cache[i].lastUsed < entry->lastUsed) {
+						entry = &cache[i];
+					}
+				}
+			}
+			entry->key = key;
+			entry->lastUsed = ++useCounter;
+			lerpVertices(&src[prevFrame * vertexCount], &src[nextFrame * vertexCount], entry->data, vertexCount, localT);
+			return entry->data;
+		}
+
+		void InterpolationData::trimCache(std::vector<InterpolationCacheEntry> &cache, uint32 entryLimit) {
+			while (cache.size() > entryLimit) {
+				unsigned int oldest = 0;
+				for (unsigned int i = 1; i < cache.size(); ++i) {
+					if (cache[i].lastUsed < cache[oldest].lastUsed) {
+						oldest = i;
+					}
+				}
+				delete[] cache[oldest].data;
+				cache.erase(cache.begin() + oldest);
+			}
 		}
 
-		void InterpolationData::update(const Vec3f* src, Vec3f* &dest, float t, bool cycle) {
+		bool InterpolationData::getFrames(float t, bool cycle, uint32 &prevFrame, uint32 &nextFrame, float &localT) const {
+			uint32 frameCount = mesh->getFrameCount();
+			if (frameCount <= 1) {
+				return false;
+			}
+
+			if (cycle == true) {
+				prevFrame = min<uint32>(static_cast<uint32>(t*frameCount), frameCount - 1);
+				nextFrame = (prevFrame + 1) % frameCount;
+				localT = t*frameCount - prevFrame;
+			} else {
+				prevFrame = min<uint32>(static_cast<uint32> (t * (frameCount - 1)), frameCount - 2);
+				nextFrame = min(prevFrame + 1, frameCount - 1);
+				localT = t * (frameCount - 1) - prevFrame;
+				//printf(" prevFrame=%d nextFrame=%d localT=%f\n",prevFrame,nextFrame,localT);
+			}
+
+			//assertions
+			assert(prevFrame < frameCount);
+			assert(nextFrame < frameCount);
+			return true;
+		}
+
+		void InterpolationData::update(const Vec3f* src, Vec3f* &dest, std::vector<InterpolationCacheEntry> &cache, float t, bool cycle) {
 
 			if (t <0.0f || t>1.0f) {
 				printf("ERROR t = [%f] for cycle [%d] f [%d] v [%d]\n", t, cycle, mesh->getFrameCount(), mesh->getVertexCount());
@@ -78,43 +210,42 @@ namespace Shared {
 				assert(t >= 0.f && t <= 1.f);
 			}
 
-			uint32 frameCount = mesh->getFrameCount();
-			uint32 vertexCount = mesh->getVertexCount();
-
-			if (frameCount > 1) {
-				//misc vars
-				uint32 prevFrame;
-				uint32 nextFrame;
-				float localT;
-
-				if (cycle == true) {
-					prevFrame = min<uint32>(static_cast<uint32>(t*frameCount), frameCount - 1);
-					nextFrame = (prevFrame + 1) % frameCount;
-					localT = t*frameCount - prevFrame;
+			uint32 prevFrame;
+			uint32 nextFrame;
+			float localT;
+			if (getFrames(t, cycle, prevFrame, nextFrame, localT) == true) {
+				if (enableInterpolation) {
+					dest = getPose(cache, src, prevFrame, nextFrame, localT, maxCacheEntries, cacheHits, cacheMisses);
 				} else {
-					prevFrame = min<uint32>(static_cast<uint32> (t * (frameCount - 1)), frameCount - 2);
-					nextFrame = min(prevFrame + 1, frameCount - 1);
-					localT = t * (frameCount - 1) - prevFrame;
-					//printf(" prevFrame=%d nextFrame=%d localT=%f\n",prevFrame,nextFrame,localT);
+					raw_frame_ofs = prevFrame*mesh->getVertexCount();
 				}
+			}
+		}
 
-				uint32 prevFrameBase = prevFrame*vertexCount;
-				uint32 nextFrameBase = nextFrame*vertexCount;
+		void InterpolationData::preparePoses(const std::vector<std::pair<float, bool> > &poses, uint64 &hits, uint64 &misses) {
+			if (enableInterpolation == false || cacheSteps == 0 || poses.empty() == true) {
+				return;
+			}
 
-				//assertions
-				assert(prevFrame < frameCount);
-				assert(nextFrame < frameCount);
+			// room for every pose asked for, so none is pushed out before it is drawn
+			uint32 entryLimit = max<uint32>(maxCacheEntries, min<uint32>((uint32) poses.size(), maxPreparedCacheEntries));
+			trimCache(vertexCache, entryLimit);
+			trimCache(normalCache, entryLimit);
 
-				if (enableInterpolation) {
-					if (!dest) { // not previously allocated
-						dest = new Vec3f[vertexCount];
-					}
-					for (uint32 j = 0; j < vertexCount; ++j) {
-						dest[j] = src[prevFrameBase + j].lerp(localT, src[nextFrameBase + j]);
-					}
-				} else {
-					raw_frame_ofs = prevFrameBase;
+			for (unsigned int i = 0; i < poses.size(); ++i) {
+				float t = poses[i].first;
+				if (t < 0.0f || t > 1.0f) {
+					// left for update() to report on the render thread
+					continue;
+				}
+				uint32 prevFrame;
+				uint32 nextFrame;
+				float localT;
+				if (getFrames(t, poses[i].second, prevFrame, nextFrame, localT) == false) {
+					return;
 				}
+				getPose(vertexCache, mesh->getVertices(), prevFrame, nextFrame, localT, entryLimit, hits, misses);
+				getPose(normalCache, mesh->getNormals(), prevFrame, nextFrame, localT, entryLimit, hits, misses);
 			}
 		}
 
@@ -88,6 +88,86 @@ namespace Shared {
 			energy = particleNode->getAttribute("energy")->getIntValue();
 		}
 
+		// =====================================================
+		//	class ParticleBufferPool
+		// =====================================================
+
+		int ParticleBufferPool::maxBuffersPerSize = 32;
+
+		// the pool outlives most systems but not all of them, systems
+		// deleted during static cleanup just free their own memory
+		class ParticleBufferStore {
+		public:
+			Mutex mutex;
+			std::map<size_t, vector<vector<Particle> *> > buffers;
+			bool destroyed;
+
+			ParticleBufferStore() : mutex(CODE_AT_LINE) {
+				destroyed = false;
+			}
+			~ParticleBufferStore() {
+				clear();
+				destroyed = true;
+			}
+			void clear() {
+				for (std::map<size_t, vector<vector<Particle> *> >::iterator iterMap = buffers.begin();
+					iterMap != buffers.end(); ++iterMap) {
+					for (unsigned int index = 0; index < iterMap->second.size(); ++index) {
+						delete iterMap->second[index];
+					}
+				}
+				buffers.clear();
+			}
+		};
+		static ParticleBufferStore particleBufferStore;
+
+		void ParticleBufferPool::acquire(std::vector<Particle> &particles, int particleCount) {
+			if (particleBufferStore.destroyed == false && maxBuffersPerSize > 0 && particleCount > 0) {
+				static const char *mutexOwnerId = CODE_AT_LINE;
+				MutexSafeWrapper safeMutex(&particleBufferStore.mutex, mutexOwnerId);
+				vector<vector<Particle> *> &bufferList = particleBufferStore.buffers[particleCount];
+				if (bufferList.empty() == false) {
+					vector<Particle> *buffer = bufferList.back();
+					bufferList.pop_back();
+					safeMutex.ReleaseLock();
+
+					particles.swap(*buffer);
+					delete buffer;
+					std::fill(particles.begin(), particles.end(), Particle());
+					return;
+				}
+			}
+			particles.clear();
+			particles.resize(particleCount);
+		}
+
+		void ParticleBufferPool::release(std::vector<Particle> &particles) {
+			if (particleBufferStore.destroyed == false && maxBuffersPerSize > 0 && particles.empty() == false) {
+				static const char *mutexOwnerId = CODE_AT_LINE;
+				MutexSafeWrapper safeMutex(&particleBufferStore.mutex, mutexOwnerId);
+				vector<vector<Particle> *> &bufferList = particleBufferStore.buffers[particles.size()];
+				if ((int) bufferList.size() < maxBuffersPerSize) {
+					vector<Particle> *buffer = new vector<Particle>();
+					buffer->swap(particles);
+					bufferList.push_back(buffer);
+					return;
+				}
+			}
+			particles.clear();
+		}
+
+		void ParticleBufferPool::clear() {
+			if (particleBufferStore.destroyed == false) {
+				static const char *mutexOwnerId = CODE_AT_LINE;
+				MutexSafeWrapper safeMutex(&particleBufferStore.mutex, mutexOwnerId);
+				particleBufferStore.clear();
+			}
+		}
+
+		// =====================================================
+		//	class ParticleSystem
+		// =====================================================
+
 		ParticleSystem::ParticleSystem(int particleCount) {
 			if (checkMemory) {
 				printf("++ Create ParticleSystem [%p]\n", this);
@@ -102,9 +182,7 @@ namespace Shared {
 			//init particle vector
 			blendMode = bmOne;
 			//particles= new Particle[particleCount];
-			particles.clear();
-			//particles.reserve(particleCount);
-			particles.resize(particleCount);
+			ParticleBufferPool::acquire(particles, particleCount);
 
 			state = sPlay;
 			aliveParticleCount = 0;
@@ -146,7 +224,7 @@ namespace Shared {
 			}
 
 			//delete [] particles;
-			particles.clear();
+			ParticleBufferPool::release(particles);
 
 			delete particleObserver;
 			particleObserver = NULL;
@@ -205,20 +283,7 @@ namespace Shared {
 			if (particleSystemStartDelay > 0) {
 				particleSystemStartDelay--;
 			} else if (state != sPause) {
-				for (int i = 0; i < aliveParticleCount; ++i) {
-					updateParticle(&particles[i]);
-
-					if (deathTest(&particles[i])) {
-
-						//kill the particle
-						killParticle(&particles[i]);
-
-						//maintain alive particles at front of the array
-						if (aliveParticleCount > 0) {
-							particles[i] = particles[aliveParticleCount];
-						}
-					}
-				}
+				updateParticles();
 
 				if (state != ParticleSystem::sFade) {
 					emissionState = emissionState + emissionRate;
@@ -623,6 +688,10 @@ namespace Shared {
 			return p->energy <= 0;
 		}
 
+		void ParticleSystem::updateParticles() {
+			updateAliveParticles(this);
+		}
+
 		void ParticleSystem::killParticle(Particle *p) {
 			aliveParticleCount--;
 		}
@@ -2406,7 +2475,7 @@ namespace Shared {
 
 		void ParticleManager::update(int renderFps) {
 			Chrono chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) chrono.start();
 
 			size_t particleSystemCount = particleSystems.size();
 			int currentParticleCount = 0;
@@ -2433,7 +2502,7 @@ namespace Shared {
 			//particleSystems.remove(NULL);
 			cleanupParticleSystems(cleanupParticleSystemsList);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled && chrono.getMillis() > 0)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance) && chrono.getMillis() > 0)
 				SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s] Line: %d took msecs: %lld, particleSystemCount = %d, currentParticleCount = %d\n", __FILE__, __FUNCTION__, __LINE__, chrono.getMillis(), particleSystemCount, currentParticleCount);
 		}
 
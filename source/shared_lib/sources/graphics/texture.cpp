@@ -64,7 +64,7 @@ namespace Shared {
 
 		void Texture1D::load(const string &path) {
 			this->path = path;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] this->path = [%s]\n", __FILE__, __FUNCTION__, __LINE__, this->path.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] this->path = [%s]\n", __FILE__, __FUNCTION__, __LINE__, this->path.c_str());
 
 			if (pixmap.getComponents() == -1) {
 				pixmap.init(defaultComponents);
@@ -220,7 +220,7 @@ namespace Shared {
 
 		void Texture2D::load(const string &path) {
 			this->path = path;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] this->path = [%s]\n", __FILE__, __FUNCTION__, __LINE__, this->path.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] this->path = [%s]\n", __FILE__, __FUNCTION__, __LINE__, this->path.c_str());
 
 			if (pixmap.getComponents() == -1) {
 				pixmap.init(defaultComponents);
@@ -244,7 +244,7 @@ namespace Shared {
 
 		void Texture3D::loadSlice(const string &path, int slice) {
 			this->path = path;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] this->path = [%s]\n", __FILE__, __FUNCTION__, __LINE__, this->path.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] this->path = [%s]\n", __FILE__, __FUNCTION__, __LINE__, this->path.c_str());
 
 			if (pixmap.getComponents() == -1) {
 				pixmap.init(defaultComponents);
@@ -268,7 +268,7 @@ namespace Shared {
 
 		void TextureCube::loadFace(const string &path, int face) {
 			this->path = path;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] this->path = [%s]\n", __FILE__, __FUNCTION__, __LINE__, this->path.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] this->path = [%s]\n", __FILE__, __FUNCTION__, __LINE__, this->path.c_str());
 
 			if (pixmap.getFace(0)->getComponents() == -1) {
 				pixmap.init(defaultComponents);
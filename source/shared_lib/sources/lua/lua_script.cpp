@@ -546,7 +546,7 @@ namespace Shared {
 				throw megaglest_runtime_error("Error loading lua code: " + errorToString(errorCode), true);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] name [%s], errorCode = %d\n", __FILE__, __FUNCTION__, __LINE__, name.c_str(), errorCode);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] name [%s], errorCode = %d\n", __FILE__, __FUNCTION__, __LINE__, name.c_str(), errorCode);
 
 			//run code
 			errorCode = lua_pcall(luaState, 0, 0, 0);
@@ -562,7 +562,7 @@ namespace Shared {
 
 			//printf("END of call to Name [%s]\n",name.c_str());
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] name [%s], errorCode = %d\n", __FILE__, __FUNCTION__, __LINE__, name.c_str(), errorCode);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] name [%s], errorCode = %d\n", __FILE__, __FUNCTION__, __LINE__, name.c_str(), errorCode);
 		}
 
 		void LuaScript::setSandboxWrapperFunctionName(string name) {
@@ -585,8 +585,8 @@ namespace Shared {
 
 			currentLuaFunction = functionName;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] functionName [%s]\n", __FILE__, __FUNCTION__, __LINE__, functionName.c_str());
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugPerformance).enabled) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] functionName [%s]\n", __FILE__, __FUNCTION__, __LINE__, functionName.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] functionName [%s]\n", __FILE__, __FUNCTION__, __LINE__, functionName.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugPerformance)) SystemFlags::OutputDebug(SystemFlags::debugPerformance, "In [%s::%s Line: %d] functionName [%s]\n", __FILE__, __FUNCTION__, __LINE__, functionName.c_str());
 
 			//string funcLuaFunction = functionName;
 		//	if(sandboxWrapperFunctionName != "" && sandboxCode != "") {
@@ -607,7 +607,7 @@ namespace Shared {
 		void LuaScript::endCall() {
 			Lua_STREFLOP_Wrapper streflopWrapper;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] currentLuaFunction [%s], currentLuaFunctionIsValid = %d\n", __FILE__, __FUNCTION__, __LINE__, currentLuaFunction.c_str(), currentLuaFunctionIsValid);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] currentLuaFunction [%s], currentLuaFunctionIsValid = %d\n", __FILE__, __FUNCTION__, __LINE__, currentLuaFunction.c_str(), currentLuaFunctionIsValid);
 
 			if (currentLuaFunctionIsValid == true) {
 				if (sandboxWrapperFunctionName != "" && sandboxCode != "") {
@@ -644,7 +644,7 @@ namespace Shared {
 		void LuaScript::registerFunction(LuaFunction luaFunction, string functionName) {
 			Lua_STREFLOP_Wrapper streflopWrapper;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugLUA).enabled) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] functionName [%s]\n", __FILE__, __FUNCTION__, __LINE__, functionName.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugLUA)) SystemFlags::OutputDebug(SystemFlags::debugLUA, "In [%s::%s Line: %d] functionName [%s]\n", __FILE__, __FUNCTION__, __LINE__, functionName.c_str());
 
 			lua_pushcfunction(luaState, luaFunction);
 			lua_setglobal(luaState, functionName.c_str());
@@ -36,7 +36,7 @@ namespace Shared {
 			mutexStarted(new Mutex(CODE_AT_LINE)),
 			ptr(NULL), genericData(NULL) {
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			ptr = this;
 			MutexSafeWrapper safeMutexMasterList(&mutexMasterThreadList);
@@ -53,7 +53,7 @@ namespace Shared {
 			setDeleteSelfOnExecutionDone(false);
 			setThreadOwnerValid(true);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		Mutex * BaseThread::getMutexThreadObjectAccessor() {
@@ -63,7 +63,7 @@ namespace Shared {
 		BaseThread::~BaseThread() {
 
 			//printf("In ~BaseThread Line: %d uniqueID [%s]\n",__LINE__,uniqueID.c_str());
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 
 			//BaseThread *base_thread = dynamic_cast<BaseThread *>(this);
 			if (this->getStarted() == false) {
@@ -74,9 +74,9 @@ namespace Shared {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 			bool ret = shutdownAndWait();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
 
 			//printf("In ~BaseThread Line: %d uniqueID [%s]\n",__LINE__,uniqueID.c_str());
 
@@ -84,33 +84,33 @@ namespace Shared {
 
 			//printf("In ~BaseThread Line: %d uniqueID [%s]\n",__LINE__,uniqueID.c_str());
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
 
 			//printf("In ~BaseThread Line: %d uniqueID [%s]\n",__LINE__,uniqueID.c_str());
 
 			if (masterThreadList.find(this) == masterThreadList.end()) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
 
 				printf("invalid thread delete for ptr: %p", this);
 				//throw megaglest_runtime_error(szBuf);
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
 
 			//printf("In ~BaseThread Line: %d uniqueID [%s]\n",__LINE__,uniqueID.c_str());
 
 			masterThreadList[this]--;
 			if (masterThreadList[this] <= 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
 				masterThreadList.erase(this);
 			}
 
 			//printf("In ~BaseThread Line: %d uniqueID [%s]\n",__LINE__,uniqueID.c_str());
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
 
 			safeMutexMasterList.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
 
 
 			delete mutexRunning;
@@ -134,7 +134,7 @@ namespace Shared {
 		}
 
 		bool BaseThread::getStarted() {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexStarted, mutexOwnerId);
 			mutexStarted->setOwnerId(mutexOwnerId);
 			bool retval = started;
@@ -144,15 +144,15 @@ namespace Shared {
 		}
 
 		void BaseThread::setStarted(bool value) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexStarted, mutexOwnerId);
 			mutexStarted->setOwnerId(mutexOwnerId);
 			started = value;
 			safeMutex.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 		}
 
 		bool BaseThread::isThreadDeleted(void *ptr) {
@@ -173,7 +173,7 @@ namespace Shared {
 		}
 
 		void BaseThread::setThreadOwnerValid(bool value) {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexThreadOwnerValid, mutexOwnerId);
 			mutexThreadOwnerValid->setOwnerId(mutexOwnerId);
 			threadOwnerValid = value;
@@ -182,7 +182,7 @@ namespace Shared {
 
 		bool BaseThread::getThreadOwnerValid() {
 			//bool ret = false;
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexThreadOwnerValid, mutexOwnerId);
 			//mutexThreadOwnerValid.setOwnerId(mutexOwnerId);
 			bool ret = threadOwnerValid;
@@ -196,20 +196,20 @@ namespace Shared {
 		}
 
 		void BaseThread::setQuitStatus(bool value) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexQuit, mutexOwnerId);
 			mutexQuit->setOwnerId(mutexOwnerId);
 			quit = value;
 			safeMutex.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 		}
 
 		bool BaseThread::getQuitStatus() {
 			//bool retval = false;
-			//static string mutexOwnerId = CODE_AT_LINE;
+			//static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexQuit, CODE_AT_LINE);
 			//mutexQuit.setOwnerId(mutexOwnerId);
 			bool retval = quit;
@@ -220,7 +220,7 @@ namespace Shared {
 
 		bool BaseThread::getHasBeginExecution() {
 			//bool retval = false;
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexBeginExecution, mutexOwnerId);
 			//mutexBeginExecution.setOwnerId(mutexOwnerId);
 			bool retval = hasBeginExecution;
@@ -230,21 +230,21 @@ namespace Shared {
 		}
 
 		void BaseThread::setHasBeginExecution(bool value) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexBeginExecution, mutexOwnerId);
 			mutexBeginExecution->setOwnerId(mutexOwnerId);
 			hasBeginExecution = value;
 			safeMutex.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 		}
 
 		bool BaseThread::getRunningStatus() {
 			//bool retval = false;
 
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexRunning, mutexOwnerId);
 			bool retval = running;
 			safeMutex.ReleaseLock();
@@ -257,7 +257,7 @@ namespace Shared {
 		}
 
 		void BaseThread::setRunningStatus(bool value) {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexRunning, mutexOwnerId);
 			mutexRunning->setOwnerId(mutexOwnerId);
 			running = value;
@@ -268,7 +268,7 @@ namespace Shared {
 		}
 
 		void BaseThread::setExecutingTask(bool value) {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexExecutingTask, mutexOwnerId);
 			mutexExecutingTask->setOwnerId(mutexOwnerId);
 			executingTask = value;
@@ -277,7 +277,7 @@ namespace Shared {
 
 		bool BaseThread::getExecutingTask() {
 			//bool retval = false;
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexExecutingTask, mutexOwnerId);
 			bool retval = executingTask;
 			safeMutex.ReleaseLock();
@@ -287,7 +287,7 @@ namespace Shared {
 
 		bool BaseThread::getDeleteSelfOnExecutionDone() {
 			//bool retval = false;
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexDeleteSelfOnExecutionDone, mutexOwnerId);
 			bool retval = deleteSelfOnExecutionDone;
 			safeMutex.ReleaseLock();
@@ -296,7 +296,7 @@ namespace Shared {
 		}
 
 		void BaseThread::setDeleteSelfOnExecutionDone(bool value) {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexDeleteSelfOnExecutionDone, mutexOwnerId);
 			mutexDeleteSelfOnExecutionDone->setOwnerId(mutexOwnerId);
 			deleteSelfOnExecutionDone = value;
@@ -329,11 +329,11 @@ namespace Shared {
 			BaseThread *pThread = this;
 			//string uniqueID = (pThread != NULL ? pThread->getUniqueID() : "?");
 			string uniqueID = pThread->getUniqueID();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 
 			//if(pThread != NULL) {
 			if (pThread->getRunningStatus() == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 
 				pThread->signalQuit();
 				sleep(0);
@@ -352,11 +352,11 @@ namespace Shared {
 
 					sleep(0);
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str());
 				sleep(0);
 			}
 			//}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] ret [%d] END\n", __FILE__, __FUNCTION__, __LINE__, uniqueID.c_str(), ret);
 			return ret;
 		}
 
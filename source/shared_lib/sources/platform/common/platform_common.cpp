@@ -371,7 +371,7 @@ namespace Shared {
 				mypath += "*";
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s]\n", __FILE__, __FUNCTION__, mypath.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s]\n", __FILE__, __FUNCTION__, mypath.c_str());
 
 			glob_t globbuf;
 
@@ -394,7 +394,7 @@ namespace Shared {
 					if (!(strcmp(".", begin) == 0 || strcmp("..", begin) == 0 || strcmp(".git", begin) == 0)) {
 						results.push_back(begin);
 					} else {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] SKIPPED SPECIAL FILENAME [%s]\n", __FILE__, __FUNCTION__, __LINE__, begin);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] SKIPPED SPECIAL FILENAME [%s]\n", __FILE__, __FUNCTION__, __LINE__, begin);
 					}
 				}
 
@@ -473,16 +473,16 @@ namespace Shared {
 		}
 
 		void removeFolder(const string &path) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] path [%s]\n", __FILE__, __FUNCTION__, __LINE__, path.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] path [%s]\n", __FILE__, __FUNCTION__, __LINE__, path.c_str());
 
 			string deletePath = path;
 			endPathWithSlash(deletePath);
 			deletePath += "{,.}*";
 			vector<string> results = getFolderTreeContentsListRecursively(deletePath, "", true);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] path [%s] results.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, path.c_str(), results.size());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] path [%s] results.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, path.c_str(), results.size());
 
 			// First delete files
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] DELETE FILES\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] DELETE FILES\n", __FILE__, __FUNCTION__, __LINE__);
 
 			for (int i = (int) results.size() - 1; i >= 0; --i) {
 				string item = results[i];
@@ -493,15 +493,15 @@ namespace Shared {
 
 				if (isdir(item.c_str()) == false) {
 					bool result = removeFile(item);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, item.c_str(), result);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, item.c_str(), result);
 				}
 			}
 			// Now delete folders
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] DELETE FOLDERS\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] DELETE FOLDERS\n", __FILE__, __FUNCTION__, __LINE__);
 
 			for (int i = (int) results.size() - 1; i >= 0; --i) {
 				string item = results[i];
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] item [%s] isdir(item.c_str()) = %d\n", __FILE__, __FUNCTION__, __LINE__, item.c_str(), isdir(item.c_str()));
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] item [%s] isdir(item.c_str()) = %d\n", __FILE__, __FUNCTION__, __LINE__, item.c_str(), isdir(item.c_str()));
 				if (isdir(item.c_str()) == true) {
 
 					//printf("~~~~~ REMOVE FOLDER [%s] in [%s]\n",item.c_str(),path.c_str());
@@ -512,7 +512,7 @@ namespace Shared {
 #else
 					int result = rmdir(item.c_str());
 #endif
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] item [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, item.c_str(), result);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] item [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, item.c_str(), result);
 
 					if (result != 0 && item != path) {
 						printf("CANNOT REMOVE FOLDER [%s] in [%s]\n", item.c_str(), path.c_str());
@@ -528,7 +528,7 @@ namespace Shared {
 			int result = rmdir(path.c_str());
 #endif
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] path [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, path.c_str(), result);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] path [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, path.c_str(), result);
 		}
 
 		bool StartsWith(const std::string &str, const std::string &key) {
@@ -704,7 +704,7 @@ namespace Shared {
 		string getFormattedCRCCacheFileName(std::pair<string, string> cacheKeys) {
 			string crcCacheFile = getCRCCacheFileName(cacheKeys);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] cacheKeys.first = [%s] cacheKeys.second [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, cacheKeys.first.c_str(), cacheKeys.second.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] cacheKeys.first = [%s] cacheKeys.second [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, cacheKeys.first.c_str(), cacheKeys.second.c_str());
 
 			Checksum checksum;
 			checksum.addString(crcCacheFile);
@@ -725,7 +725,7 @@ namespace Shared {
 		pair<bool, time_t> hasCachedFileCRCValue(string crcCacheFile, uint32 &value) {
 			//bool result = false;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) {
 				SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d for Cache file [%s]\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str());
 			}
 
@@ -741,7 +741,7 @@ namespace Shared {
 					uint32 crcValue = 0;
 					time_t lastUpdateDate = 0;
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) {
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d for Cache file [%s]\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str());
 					}
 
@@ -764,7 +764,7 @@ namespace Shared {
 
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("CRC readGameVer [%s] [%s]\n%s\n", readGameVer.c_str(), readGitVer.c_str(), readActualFilePath.c_str());
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) {
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d for Cache file [%s] readbytes = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), readbytes);
 					}
 
@@ -793,7 +793,7 @@ namespace Shared {
 						result.first = true;
 						value = crcValue;
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) {
 							//struct tm *loctime = localtime (&refreshDate);
 							struct tm loctime = threadsafe_localtime(refreshDate);
 							char szBuf1[100] = "";
@@ -814,19 +814,19 @@ namespace Shared {
 						char szBuf2[100] = "";
 						strftime(szBuf2, 100, "%Y-%m-%d %H:%M:%S", &loctime);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) {
 							SystemFlags::OutputDebug(SystemFlags::debugSystem,
 								"=-=-=-=- NEED TO CALCULATE CRC for Cache file [%s] now = %ld [%s], refreshDate = %ld [%s], crcValue = %u\n",
 								crcCacheFile.c_str(), systemtime_now(), szBuf1, refreshDate, szBuf2, crcValue);
 						}
 					}
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) {
 						SystemFlags::OutputDebug(SystemFlags::debugSystem, "FILE NOT FOUND(1) for Cache file [%s]\n", crcCacheFile.c_str());
 					}
 				}
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) {
 					SystemFlags::OutputDebug(SystemFlags::debugSystem, "FILE NOT FOUND(2) for Cache file [%s]\n", crcCacheFile.c_str());
 				}
 			}
@@ -893,12 +893,12 @@ namespace Shared {
 			if (fileExists(crcCacheFile) == true) {
 
 				bool result = removeFile(crcCacheFile);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), result);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), result);
 			}
 		}
 
 		time_t getFolderTreeContentsCheckSumRecursivelyLastGenerated(const vector<string> &paths, string pathSearchString, const string &filterFileExt) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] Calculating CRC for [%s] -----------\n", __FILE__, __FUNCTION__, __LINE__, pathSearchString.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] Calculating CRC for [%s] -----------\n", __FILE__, __FUNCTION__, __LINE__, pathSearchString.c_str());
 
 			std::pair<string, string> cacheKeys = getFolderTreeContentsCheckSumCacheKey(paths, pathSearchString, filterFileExt);
 			//string cacheLookupId =  cacheKeys.first;
@@ -906,7 +906,7 @@ namespace Shared {
 
 			string cacheKey = cacheKeys.second;
 			string crcCacheFile = getFormattedCRCCacheFileName(cacheKeys);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] looking for cached CRC file [%s] for [%s] -----------\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), pathSearchString.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] looking for cached CRC file [%s] for [%s] -----------\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), pathSearchString.c_str());
 
 			uint32 crcValue = 0;
 			pair<bool, time_t> crcResult = hasCachedFileCRCValue(crcCacheFile, crcValue);
@@ -916,12 +916,12 @@ namespace Shared {
 				char szBuf1[100] = "";
 				strftime(szBuf1, 100, "%Y-%m-%d %H:%M:%S", &loctime);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED FILE for cacheKey [%s] last updated [%s]\n", __FILE__, __FUNCTION__, __LINE__, cacheKey.c_str(), szBuf1);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED FILE for cacheKey [%s] last updated [%s]\n", __FILE__, __FUNCTION__, __LINE__, cacheKey.c_str(), szBuf1);
 				//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("\n-------------- In [%s::%s Line: %d] scanning folders found CACHED FILE for cacheKey [%s] last updated [%s]\n",__FILE__,__FUNCTION__,__LINE__,cacheKey.c_str(),szBuf1);
 
 				return crcResult.second;
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s]\n", __FILE__, __FUNCTION__, cacheKey.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s]\n", __FILE__, __FUNCTION__, cacheKey.c_str());
 				//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("\n-------------- In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s]\n",__FILE__,__FUNCTION__,cacheKey.c_str());
 			}
 
@@ -930,7 +930,7 @@ namespace Shared {
 
 		//finds all filenames like path and gets their checksum of all files combined
 		uint32 getFolderTreeContentsCheckSumRecursively(vector<string> paths, string pathSearchString, const string &filterFileExt, Checksum *recursiveChecksum, bool forceNoCache) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] Calculating CRC for [%s] -----------\n", __FILE__, __FUNCTION__, __LINE__, pathSearchString.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] Calculating CRC for [%s] -----------\n", __FILE__, __FUNCTION__, __LINE__, pathSearchString.c_str());
 
 			std::pair<string, string> cacheKeys = getFolderTreeContentsCheckSumCacheKey(paths, pathSearchString, filterFileExt);
 			string cacheLookupId = cacheKeys.first;
@@ -938,7 +938,7 @@ namespace Shared {
 
 			string cacheKey = cacheKeys.second;
 			if (forceNoCache == false && crcTreeCache.find(cacheKey) != crcTreeCache.end()) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED checksum = %d for cacheKey [%s]\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED checksum = %d for cacheKey [%s]\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str());
 				//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("\n-------------- In [%s::%s Line: %d] scanning folders found CACHED checksum = %d for cacheKey [%s]\n",__FILE__,__FUNCTION__,__LINE__,crcTreeCache[cacheKey],cacheKey.c_str());
 				return crcTreeCache[cacheKey];
 			}
@@ -947,22 +947,22 @@ namespace Shared {
 			//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("Looking for CRC Cache file [%s]\n",crcCacheFile.c_str());
 
 			if (recursiveChecksum == NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] looking for cached CRC file [%s] for [%s] forceNoCache = %d -----------\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), pathSearchString.c_str(), forceNoCache);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] looking for cached CRC file [%s] for [%s] forceNoCache = %d -----------\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), pathSearchString.c_str(), forceNoCache);
 			}
 
 			uint32 crcValue = 0;
 			if (forceNoCache == false && hasCachedFileCRCValue(crcCacheFile, crcValue).first == true) {
 				crcTreeCache[cacheKey] = crcValue;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED FILE checksum = %d for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str(), forceNoCache);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED FILE checksum = %d for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str(), forceNoCache);
 				if (recursiveChecksum == NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] scanning folders found CACHED FILE checksum = %d for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str(), forceNoCache);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] scanning folders found CACHED FILE checksum = %d for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str(), forceNoCache);
 				}
 
 				return crcTreeCache[cacheKey];
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, cacheKey.c_str(), forceNoCache);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, cacheKey.c_str(), forceNoCache);
 				if (recursiveChecksum == NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, cacheKey.c_str(), forceNoCache);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, cacheKey.c_str(), forceNoCache);
 				}
 			}
 
@@ -977,7 +977,7 @@ namespace Shared {
 				*recursiveChecksum = checksum;
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] Final CRC file count: %d\n", __FILE__, __FUNCTION__, __LINE__, checksum.getFileCount());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] Final CRC file count: %d\n", __FILE__, __FUNCTION__, __LINE__, checksum.getFileCount());
 
 			uint32 result = checksum.getFinalFileListSum();
 			//if(forceNoCache == false) {
@@ -1005,7 +1005,7 @@ namespace Shared {
 			string crcCacheFile = getFormattedCRCCacheFileName(cacheKeys);
 			if (fileExists(crcCacheFile) == true) {
 				bool result = removeFile(crcCacheFile);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), result);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), result);
 			}
 		}
 
@@ -1018,7 +1018,7 @@ namespace Shared {
 
 			string cacheKey = cacheKeys.second;
 			if (forceNoCache == false && crcTreeCache.find(cacheKey) != crcTreeCache.end()) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning [%s] found CACHED checksum = %d for cacheKey [%s]\n", __FILE__, __FUNCTION__, __LINE__, path.c_str(), crcTreeCache[cacheKey], cacheKey.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning [%s] found CACHED checksum = %d for cacheKey [%s]\n", __FILE__, __FUNCTION__, __LINE__, path.c_str(), crcTreeCache[cacheKey], cacheKey.c_str());
 				//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("\n-------------- In [%s::%s Line: %d] scanning [%s] found CACHED checksum = %d for cacheKey [%s]\n",__FILE__,__FUNCTION__,__LINE__,path.c_str(),crcTreeCache[cacheKey],cacheKey.c_str());
 				return crcTreeCache[cacheKey];
 			}
@@ -1027,22 +1027,22 @@ namespace Shared {
 			//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("Looking for CRC Cache file [%s]\n",crcCacheFile.c_str());
 
 			if (recursiveChecksum == NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] looking for cached CRC file [%s] for [%s] forceNoCache = %d -----------\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), path.c_str(), forceNoCache);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] looking for cached CRC file [%s] for [%s] forceNoCache = %d -----------\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), path.c_str(), forceNoCache);
 			}
 
 			uint32 crcValue = 0;
 			if (forceNoCache == false && hasCachedFileCRCValue(crcCacheFile, crcValue).first == true) {
 				crcTreeCache[cacheKey] = crcValue;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED FILE checksum = %d for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str(), forceNoCache);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED FILE checksum = %d for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str(), forceNoCache);
 				if (recursiveChecksum == NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] scanning folders found CACHED FILE checksum = %d for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str(), forceNoCache);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s Line: %d] scanning folders found CACHED FILE checksum = %d for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, __LINE__, crcTreeCache[cacheKey], cacheKey.c_str(), forceNoCache);
 				}
 
 				return crcTreeCache[cacheKey];
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, cacheKey.c_str(), forceNoCache);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, cacheKey.c_str(), forceNoCache);
 				if (recursiveChecksum == NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, cacheKey.c_str(), forceNoCache);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "-------------- In [%s::%s] scanning folders DID NOT FIND CACHED FILE checksum for cacheKey [%s] forceNoCache = %d\n", __FILE__, __FUNCTION__, cacheKey.c_str(), forceNoCache);
 				}
 			}
 
@@ -1133,12 +1133,12 @@ namespace Shared {
 
 			if (topLevelCaller == true) {
 				//printf("In [%s::%s Line: %d] Final CRC file count for [%s]: %d\n",__FILE__,__FUNCTION__,__LINE__,path.c_str(),checksum.getFileCount());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] Final CRC file count for [%s]: %d\n", __FILE__, __FUNCTION__, __LINE__, path.c_str(), checksum.getFileCount());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] Final CRC file count for [%s]: %d\n", __FILE__, __FUNCTION__, __LINE__, path.c_str(), checksum.getFileCount());
 
 				uint32 result = checksum.getFinalFileListSum();
 				//if(forceNoCache == false) {
 				crcTreeCache[cacheKey] = result;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s] ending checksum = %d for cacheKey [%s] fileMatchCount = %d, fileLoopCount = %d\n", __FILE__, __FUNCTION__, path.c_str(), crcTreeCache[cacheKey], cacheKey.c_str(), fileMatchCount, fileLoopCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s] ending checksum = %d for cacheKey [%s] fileMatchCount = %d, fileLoopCount = %d\n", __FILE__, __FUNCTION__, path.c_str(), crcTreeCache[cacheKey], cacheKey.c_str(), fileMatchCount, fileLoopCount);
 				writeCachedFileCRCValue(crcCacheFile, crcTreeCache[cacheKey], getCRCCacheFileName(cacheKeys));
 				//}
 
@@ -1175,7 +1175,7 @@ namespace Shared {
 			string crcCacheFile = getFormattedCRCCacheFileName(cacheKeys);
 			if (fileExists(crcCacheFile) == true) {
 				bool result = removeFile(crcCacheFile);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), result);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), result);
 			}
 		}
 
@@ -1186,10 +1186,10 @@ namespace Shared {
 
 			string cacheKey = cacheKeys.second;
 			if (crcTreeCache.find(cacheKey) != crcTreeCache.end()) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED result for cacheKey [%s]\n", __FILE__, __FUNCTION__, __LINE__, cacheKey.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders found CACHED result for cacheKey [%s]\n", __FILE__, __FUNCTION__, __LINE__, cacheKey.c_str());
 				return crcTreeCache[cacheKey];
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders, NO CACHE found result for cacheKey [%s]\n", __FILE__, __FUNCTION__, __LINE__, cacheKey.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] scanning folders, NO CACHE found result for cacheKey [%s]\n", __FILE__, __FUNCTION__, __LINE__, cacheKey.c_str());
 			}
 
 			bool topLevelCaller = (recursiveMap == NULL);
@@ -1200,10 +1200,10 @@ namespace Shared {
 				checksumFiles = getFolderTreeContentsCheckSumListRecursively(path, filterFileExt, &checksumFiles);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] checksumFiles.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, checksumFiles.size());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] checksumFiles.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, checksumFiles.size());
 
 			if (topLevelCaller == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] EXITING TOP LEVEL RECURSION, checksumFiles.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, checksumFiles.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] EXITING TOP LEVEL RECURSION, checksumFiles.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, checksumFiles.size());
 			}
 
 			crcTreeCache[cacheKey] = checksumFiles;
@@ -1249,7 +1249,7 @@ namespace Shared {
 				const char* p = globbuf.gl_pathv[i];
 
 				bool skipItem = (EndsWith(p, ".") == true || EndsWith(p, "..") == true);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "~~~~~~~~~~~ Glob file [%s] skipItem = %d\n", p, skipItem);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "~~~~~~~~~~~ Glob file [%s] skipItem = %d\n", p, skipItem);
 
 				if (skipItem == false) {
 					if (isdir(p) == false) {
@@ -1296,7 +1296,7 @@ namespace Shared {
 				const char* p = globbuf.gl_pathv[i];
 
 				bool skipItem = (EndsWith(p, ".") == true || EndsWith(p, "..") == true);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "~~~~~~~~~~~ Glob folder [%s] skipItem = %d\n", p, skipItem);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "~~~~~~~~~~~ Glob folder [%s] skipItem = %d\n", p, skipItem);
 
 				if (skipItem == false) {
 					if (includeFolders == true) {
@@ -1317,10 +1317,10 @@ namespace Shared {
 
 			globfree(&globbuf);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s]\n", __FILE__, __FUNCTION__, path.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s]\n", __FILE__, __FUNCTION__, path.c_str());
 
 			if (topLevelCaller == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] EXITING TOP LEVEL RECURSION\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] EXITING TOP LEVEL RECURSION\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
 			return resultFiles;
@@ -1344,7 +1344,7 @@ namespace Shared {
 			string crcCacheFile = getFormattedCRCCacheFileName(cacheKeys);
 			if (fileExists(crcCacheFile) == true) {
 				bool result = removeFile(crcCacheFile);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), result);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileitem [%s] result = %d\n", __FILE__, __FUNCTION__, __LINE__, crcCacheFile.c_str(), result);
 			}
 		}
 
@@ -1356,7 +1356,7 @@ namespace Shared {
 
 			string cacheKey = cacheKeys.second;
 			if (crcTreeCache.find(cacheKey) != crcTreeCache.end()) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s] FOUND CACHED result for cacheKey [%s]\n", __FILE__, __FUNCTION__, path.c_str(), cacheKey.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s] FOUND CACHED result for cacheKey [%s]\n", __FILE__, __FUNCTION__, path.c_str(), cacheKey.c_str());
 				return crcTreeCache[cacheKey];
 			}
 
@@ -1441,10 +1441,10 @@ namespace Shared {
 
 			crcTreeCache[cacheKey] = checksumFiles;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s] cacheKey [%s] checksumFiles.size() = %d\n", __FILE__, __FUNCTION__, path.c_str(), cacheKey.c_str(), checksumFiles.size());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] scanning [%s] cacheKey [%s] checksumFiles.size() = %d\n", __FILE__, __FUNCTION__, path.c_str(), cacheKey.c_str(), checksumFiles.size());
 
 			if (topLevelCaller == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] EXITING TOP LEVEL RECURSION, checksumFiles.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, checksumFiles.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] EXITING TOP LEVEL RECURSION, checksumFiles.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, checksumFiles.size());
 			}
 
 			return crcTreeCache[cacheKey];
@@ -1515,7 +1515,7 @@ namespace Shared {
 #else
 #error "Your compiler needs to support mkdir!"
 #endif
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] DirName [%s] result = %d, errno = %d\n", __FILE__, __FUNCTION__, __LINE__, DirName, result, errno);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] DirName [%s] result = %d, errno = %d\n", __FILE__, __FUNCTION__, __LINE__, DirName, result, errno);
 					}
 				}
 				*dirName++ = *path++;
@@ -1529,7 +1529,7 @@ namespace Shared {
 #else
 #error "Your compiler needs to support mkdir!"
 #endif
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] DirName [%s] result = %d, errno = %d\n", __FILE__, __FUNCTION__, __LINE__, DirName, result, errno);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] DirName [%s] result = %d, errno = %d\n", __FILE__, __FUNCTION__, __LINE__, DirName, result, errno);
 		}
 
 		void getFullscreenVideoInfo(int &colorBits, int &screenWidth, int &screenHeight, bool isFullscreen) {
@@ -1611,7 +1611,7 @@ namespace Shared {
 			//screenWidth    = vidInfo->current_w;
 			//screenHeight   = vidInfo->current_h;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled)
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem))
 				SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//SDL_PixelFormat format;
@@ -1632,7 +1632,7 @@ namespace Shared {
 					Uint32 Bmask;
 					Uint32 Amask;
 					SDL_PixelFormatEnumToMasks(mode.format, &bpp, &Rmask, &Gmask, &Bmask, &Amask);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "%d x %d\n", allResoltuions[i].first, allResoltuions[i].second, bpp);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "%d x %d\n", allResoltuions[i].first, allResoltuions[i].second, bpp);
 					string lookupKey = intToStr(mode.w) + "_" + intToStr(mode.h) + "_" + intToStr(bpp);
 					if (uniqueResList.find(lookupKey) == uniqueResList.end()) {
 						uniqueResList[lookupKey] = true;
@@ -1705,10 +1705,10 @@ namespace Shared {
 			char key = static_cast<char> (virtualKey);
 			const Uint8* keystate = SDL_GetKeyboardState(0);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] key = %d\n", __FILE__, __FUNCTION__, __LINE__, key);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] key = %d\n", __FILE__, __FUNCTION__, __LINE__, key);
 
 			if (key >= 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] keystate[key] = %d\n", __FILE__, __FUNCTION__, __LINE__, keystate[(unsigned char) key]);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] keystate[key] = %d\n", __FILE__, __FUNCTION__, __LINE__, keystate[(unsigned char) key]);
 
 				return (keystate[(unsigned char) key] != 0);
 			}
@@ -1747,7 +1747,7 @@ namespace Shared {
 					std::cerr << "isKeyDown called with unknown key.\n";
 					break;
 			}
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] returning false\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] returning false\n", __FILE__, __FUNCTION__, __LINE__);
 			return false;
 		}
 
@@ -1905,7 +1905,7 @@ namespace Shared {
 
 		bool executeShellCommand(string cmd, int expectedResult, ShellCommandOutputCallbackInterface *cb) {
 			bool result = false;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "About to run [%s]", cmd.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "About to run [%s]", cmd.c_str());
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("About to run [%s]", cmd.c_str());
 
 #ifdef WIN32
@@ -1914,14 +1914,14 @@ namespace Shared {
 			FILE *file = popen(cmd.c_str(), "r");
 #endif
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "file = [%p]", file);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "file = [%p]", file);
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("file = [%p]", file);
 
 			if (file != NULL) {
 				char szBuf[4096] = "";
 				while (feof(file) == false) {
 					if (fgets(szBuf, 4095, file) != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "%s", szBuf);
 						if (SystemFlags::VERBOSE_MODE_ENABLED) printf("%s", szBuf);
 
 						if (cb != NULL) {
@@ -1936,7 +1936,7 @@ namespace Shared {
 #endif
 
 				/* Close pipe and print return value. */
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "Process returned %d\n", cmdRet);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "Process returned %d\n", cmdRet);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("Process returned %d\n", cmdRet);
 				result = (expectedResult == IGNORE_CMD_RESULT_VALUE || expectedResult == cmdRet);
 			}
@@ -66,7 +66,7 @@ namespace Shared {
 		}
 
 		void FileCRCPreCacheThread::setPauseForGame(bool pauseForGame) {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexPauseForGame, mutexOwnerId);
 			this->pauseForGame = pauseForGame;
 
@@ -79,7 +79,7 @@ namespace Shared {
 		}
 
 		bool FileCRCPreCacheThread::getPauseForGame() {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexPauseForGame, mutexOwnerId);
 			return this->pauseForGame;
 		}
@@ -98,7 +98,7 @@ namespace Shared {
 		void FileCRCPreCacheThread::execute() {
 			{
 				RunningStatusSafeWrapper runningStatus(this);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				if (getQuitStatus() == true) {
 					deleteSelfIfRequired();
@@ -108,7 +108,7 @@ namespace Shared {
 				bool threadControllerMode = (workerThreadTechPaths.size() == 0);
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("FILE CRC PreCache thread is running threadControllerMode = %d\n", threadControllerMode);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "FILE CRC PreCache thread is running threadControllerMode = %d\n", threadControllerMode);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "FILE CRC PreCache thread is running threadControllerMode = %d\n", threadControllerMode);
 
 				try {
 					if (threadControllerMode == true) {
@@ -140,7 +140,7 @@ namespace Shared {
 								unsigned int consumedWorkers = 0;
 								for (unsigned int workerIdx = 0; workerIdx < (unsigned int) MAX_FileCRCPreCacheThread_WORKER_THREADS; ++workerIdx) {
 									if (getQuitStatus() == true) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 										break;
 									}
 
@@ -169,7 +169,7 @@ namespace Shared {
 										sleep(25);
 									}
 									if (getQuitStatus() == true) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 										break;
 									}
 
@@ -179,10 +179,10 @@ namespace Shared {
 										new FileCRCPreCacheThread(techDataPaths,
 											workerTechList,
 											this->processTechCB);
-									static string mutexOwnerId = string(extractFileFromDirectoryPath(__FILE__).c_str()) + string("_") + intToStr(__LINE__);
+									static const char *mutexOwnerId = CODE_AT_LINE;
 									workerThread->setUniqueID(mutexOwnerId);
 									workerThread->setPauseForGame(this->getPauseForGame());
-									static string mutexOwnerId2 = CODE_AT_LINE;
+									static const char *mutexOwnerId2 = CODE_AT_LINE;
 									MutexSafeWrapper safeMutexPause(mutexPauseForGame, mutexOwnerId2);
 									preCacheWorkerThreadList.push_back(workerThread);
 									safeMutexPause.ReleaseLock();
@@ -199,10 +199,10 @@ namespace Shared {
 								}
 							} catch (const exception &ex) {
 								SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
 							} catch (...) {
 								SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unknown error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unknown error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 							}
 
 							sleep(0);
@@ -226,7 +226,7 @@ namespace Shared {
 											} else if (workerThread->getRunningStatus() == false) {
 												sleep(25);
 
-												static string mutexOwnerId2 = CODE_AT_LINE;
+												static const char *mutexOwnerId2 = CODE_AT_LINE;
 												MutexSafeWrapper safeMutexPause(mutexPauseForGame, mutexOwnerId2);
 
 												delete workerThread;
@@ -251,10 +251,10 @@ namespace Shared {
 								}
 							} catch (const exception &ex) {
 								SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
 							} catch (...) {
 								SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unknown error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unknown error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 							}
 
 							if (SystemFlags::VERBOSE_MODE_ENABLED) printf("********************** CRC Controller thread took %.2f seconds END **********************\n", difftime(time(NULL), elapsedTime));
@@ -270,7 +270,7 @@ namespace Shared {
 								}
 								//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("--------------------- CRC worker thread START for tech [%s] ---------------------------\n",techName.c_str());
 								//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] caching CRC value for Tech [%s]\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,techName.c_str());
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] caching CRC value for Tech [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, techName.c_str());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] caching CRC value for Tech [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, techName.c_str());
 
 								time_t elapsedTime = time(NULL);
 								// Clear existing CRC to force a CRC refresh
@@ -303,7 +303,7 @@ namespace Shared {
 									uint32 techCRC = getFolderTreeContentsCheckSumRecursively(techDataPaths, string("/") + techName + string("/*"), ".xml", NULL, true);
 
 									//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] cached CRC value for Tech [%s] is [%d] took %.3f seconds.\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,techName.c_str(),techCRC,difftime(time(NULL),elapsedTime));
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] cached CRC value for Tech [%s] is [%u] took %.3f seconds.\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, techName.c_str(), techCRC, difftime(time(NULL), elapsedTime));
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] cached CRC value for Tech [%s] is [%u] took %.3f seconds.\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, techName.c_str(), techCRC, difftime(time(NULL), elapsedTime));
 
 									vector<string> results;
 									for (unsigned int idx = 0; idx < techDataPaths.size(); idx++) {
@@ -343,7 +343,7 @@ namespace Shared {
 									}
 
 									//if(SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] cached CRC value for Tech [%s] is [%d] took %.3f seconds.\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,techName.c_str(),techCRC,difftime(time(NULL),elapsedTime));
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] cached CRC value for Tech [%s] is [%d] took %.3f seconds.\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, techName.c_str(), techCRC, difftime(time(NULL), elapsedTime));
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] cached CRC value for Tech [%s] is [%d] took %.3f seconds.\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, techName.c_str(), techCRC, difftime(time(NULL), elapsedTime));
 								}
 
 								if (SystemFlags::VERBOSE_MODE_ENABLED) printf("--------------------- CRC worker thread END for tech [%s] ---------------------------\n", techName.c_str());
@@ -354,21 +354,21 @@ namespace Shared {
 							}
 						} catch (const exception &ex) {
 							SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
 						} catch (...) {
 							SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unknown error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unknown error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 						}
 					}
 				} catch (const exception &ex) {
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
 				} catch (...) {
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unknown error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] unknown error\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] FILE CRC PreCache thread is exiting...\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] FILE CRC PreCache thread is exiting...\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] FILE CRC PreCache thread is exiting...\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 			}
 			deleteSelfIfRequired();
@@ -400,13 +400,13 @@ namespace Shared {
 
 			setTaskSignalled(false);
 
-			string mutexOwnerId = CODE_AT_LINE;
+			const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexLastExecuteTimestamp, mutexOwnerId);
 			mutexLastExecuteTimestamp->setOwnerId(mutexOwnerId);
 			lastExecuteTimestamp = time(NULL);
 
 			if (this->wantSetupAndShutdown == true) {
-				string mutexOwnerId1 = CODE_AT_LINE;
+				const char *mutexOwnerId1 = CODE_AT_LINE;
 				MutexSafeWrapper safeMutex1(mutexSimpleTaskInterfaceValid, mutexOwnerId1);
 				if (this->simpleTaskInterfaceValid == true) {
 					safeMutex1.ReleaseLock();
@@ -431,7 +431,7 @@ namespace Shared {
 
 			} catch (const exception &ex) {
 				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
 
 				//throw megaglest_runtime_error(ex.what());
 				//abort();
@@ -448,7 +448,7 @@ namespace Shared {
 					this->overrideShutdownTask = NULL;
 				} else if (this->simpleTaskInterface != NULL) {
 					//printf("~SimpleTaskThread LINE: %d this = %p\n",__LINE__,this);
-					string mutexOwnerId1 = CODE_AT_LINE;
+					const char *mutexOwnerId1 = CODE_AT_LINE;
 					MutexSafeWrapper safeMutex1(mutexSimpleTaskInterfaceValid, mutexOwnerId1);
 					//printf("~SimpleTaskThread LINE: %d this = %p\n",__LINE__,this);
 					if (this->simpleTaskInterfaceValid == true) {
@@ -469,7 +469,7 @@ namespace Shared {
 		}
 
 		bool SimpleTaskThread::isThreadExecutionLagging() {
-			string mutexOwnerId = CODE_AT_LINE;
+			const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexLastExecuteTimestamp, mutexOwnerId);
 			mutexLastExecuteTimestamp->setOwnerId(mutexOwnerId);
 			bool result = (difftime(time(NULL), lastExecuteTimestamp) >= 5.0);
@@ -490,13 +490,13 @@ namespace Shared {
 		}
 
 		bool SimpleTaskThread::getSimpleTaskInterfaceValid() {
-			string mutexOwnerId1 = CODE_AT_LINE;
+			const char *mutexOwnerId1 = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex1(mutexSimpleTaskInterfaceValid, mutexOwnerId1);
 
 			return this->simpleTaskInterfaceValid;
 		}
 		void SimpleTaskThread::setSimpleTaskInterfaceValid(bool value) {
-			string mutexOwnerId1 = CODE_AT_LINE;
+			const char *mutexOwnerId1 = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex1(mutexSimpleTaskInterfaceValid, mutexOwnerId1);
 
 			this->simpleTaskInterfaceValid = value;
@@ -516,11 +516,11 @@ namespace Shared {
 						}
 
 						if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
 
 						unsigned int idx = 0;
 						for (; this->simpleTaskInterface != NULL;) {
-							string mutexOwnerId1 = CODE_AT_LINE;
+							const char *mutexOwnerId1 = CODE_AT_LINE;
 							MutexSafeWrapper safeMutex1(mutexSimpleTaskInterfaceValid, mutexOwnerId1);
 							if (this->simpleTaskInterfaceValid == false) {
 								break;
@@ -536,7 +536,7 @@ namespace Shared {
 							}
 
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
 								break;
 							} else if (runTask == true) {
 								if (getQuitStatus() == false) {
@@ -548,7 +548,7 @@ namespace Shared {
 									if (getQuitStatus() == true) {
 										break;
 									}
-									string mutexOwnerId = CODE_AT_LINE;
+									const char *mutexOwnerId = CODE_AT_LINE;
 									MutexSafeWrapper safeMutex(mutexLastExecuteTimestamp, mutexOwnerId);
 									mutexLastExecuteTimestamp->setOwnerId(mutexOwnerId);
 									lastExecuteTimestamp = time(NULL);
@@ -563,7 +563,7 @@ namespace Shared {
 								}
 							}
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
 								break;
 							}
 
@@ -571,14 +571,14 @@ namespace Shared {
 						}
 						if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
 						mustDeleteSelf = getDeleteSelfOnExecutionDone();
 						if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					} catch (const exception &ex) {
 						SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, ex.what());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] uniqueID [%s] END\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, this->getUniqueID().c_str());
 						mustDeleteSelf = getDeleteSelfOnExecutionDone();
 
 						throw megaglest_runtime_error(ex.what());
@@ -598,7 +598,7 @@ namespace Shared {
 		}
 
 		void SimpleTaskThread::setTaskSignalled(bool value) {
-			string mutexOwnerId = CODE_AT_LINE;
+			const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexTaskSignaller, mutexOwnerId);
 			mutexTaskSignaller->setOwnerId(mutexOwnerId);
 			taskSignalled = value;
@@ -606,7 +606,7 @@ namespace Shared {
 		}
 
 		bool SimpleTaskThread::getTaskSignalled() {
-			string mutexOwnerId = CODE_AT_LINE;
+			const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexTaskSignaller, mutexOwnerId);
 			mutexTaskSignaller->setOwnerId(mutexOwnerId);
 			bool retval = taskSignalled;
@@ -621,7 +621,7 @@ namespace Shared {
 			uniqueID = "LogFileThread";
 			logList.clear();
 			lastSaveToDisk = time(NULL);
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			mutexLogList->setOwnerId(mutexOwnerId);
 		}
 
@@ -634,7 +634,7 @@ namespace Shared {
 		}
 
 		void LogFileThread::addLogEntry(SystemFlags::DebugType type, string logEntry) {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexLogList, mutexOwnerId);
 			mutexLogList->setOwnerId(mutexOwnerId);
 			LogFileEntry entry;
@@ -665,7 +665,7 @@ namespace Shared {
 			{
 				RunningStatusSafeWrapper runningStatus(this);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 				if (getQuitStatus() == true) {
 					deleteSelfIfRequired();
@@ -673,7 +673,7 @@ namespace Shared {
 				}
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "LogFile thread is running\n");
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "LogFile thread is running\n");
 
 				try {
 					ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
@@ -712,7 +712,7 @@ namespace Shared {
 		}
 
 		std::size_t LogFileThread::getLogEntryBufferCount() {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(mutexLogList, mutexOwnerId);
 			mutexLogList->setOwnerId(mutexOwnerId);
 			std::size_t logCount = logList.size();
@@ -732,7 +732,7 @@ namespace Shared {
 		}
 
 		void LogFileThread::saveToDisk(bool forceSaveAll, bool logListAlreadyLocked) {
-			static string mutexOwnerId = CODE_AT_LINE;
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(NULL, mutexOwnerId);
 			if (logListAlreadyLocked == false) {
 				safeMutex.setMutex(mutexLogList);
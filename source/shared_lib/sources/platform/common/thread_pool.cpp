@@ -0,0 +1,311 @@
+//      thread_pool.cpp:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "thread_pool.h"
+#include <SDL_cpuinfo.h>
+#include "platform_common.h"
+#include "platform_util.h"
+#include "conversion.h"
+#include "util.h"
+#include "profiler.h"
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::Util;
+
+namespace Shared {
+	namespace PlatformCommon {
+
+		// =====================================================
+		//	class ThreadPoolWorker
+		// =====================================================
+
+		ThreadPoolWorker::ThreadPoolWorker(WorkStealingThreadPool *pool, int queueIndex) : BaseThread() {
+			this->pool = pool;
+			this->queueIndex = queueIndex;
+			uniqueID = "ThreadPoolWorker";
+		}
+
+		ThreadPoolWorker::~ThreadPoolWorker() {
+			this->pool = NULL;
+		}
+
+		void ThreadPoolWorker::setQuitStatus(bool value) {
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s] Line: %d value = %d\n", __FILE__, __FUNCTION__, __LINE__, value);
+
+			BaseThread::setQuitStatus(value);
+			if (value == true) {
+				signalWork();
+			}
+		}
+
+		void ThreadPoolWorker::signalWork() {
+			semTaskSignalled.signal();
+		}
+
+		bool ThreadPoolWorker::canShutdown(bool deleteSelfIfShutdownDelayed) {
+			bool ret = (getExecutingTask() == false);
+			if (ret == false && deleteSelfIfShutdownDelayed == true) {
+				setDeleteSelfOnExecutionDone(deleteSelfIfShutdownDelayed);
+				deleteSelfIfRequired();
+				signalQuit();
+			}
+
+			return ret;
+		}
+
+		void ThreadPoolWorker::execute() {
+			RunningStatusSafeWrapper runningStatus(this);
+			try {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+
+				for (; this->pool != NULL;) {
+					if (getQuitStatus() == true) {
+						break;
+					}
+
+					semTaskSignalled.waitTillSignalled();
+
+					if (getQuitStatus() == true) {
+						break;
+					}
+
+					ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
+					this->pool->runQueuedTasks(this->queueIndex);
+				}
+
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			} catch (const exception &ex) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+				throw megaglest_runtime_error(ex.what());
+			}
+		}
+
+		// =====================================================
+		//	class WorkStealingThreadPool
+		// =====================================================
+
+		WorkStealingThreadPool::TaskQueue::TaskQueue() : mutex(new Mutex(CODE_AT_LINE)) {
+		}
+
+		WorkStealingThreadPool::TaskQueue::~TaskQueue() {
+			delete mutex;
+			mutex = NULL;
+		}
+
+		WorkStealingThreadPool::WorkStealingThreadPool(int workerCount, string uniqueID) {
+			mutexPendingTasks = new Mutex(CODE_AT_LINE);
+			triggerTasksCompleted = new Trigger(mutexPendingTasks);
+			pendingTaskCount = 0;
+			tasksCancelled = false;
+			taskErrorText = "";
+
+			// queue 0 belongs to the thread calling runTasks
+			queues.push_back(new TaskQueue());
+			for (int index = 0; index < workerCount; ++index) {
+				queues.push_back(new TaskQueue());
+
+				ThreadPoolWorker *worker = new ThreadPoolWorker(this, index + 1);
+				worker->setUniqueID(uniqueID + "_" + intToStr(index));
+				workers.push_back(worker);
+				worker->start();
+			}
+
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] started %d workers for [%s]\n", __FILE__, __FUNCTION__, __LINE__, workerCount, uniqueID.c_str());
+		}
+
+		WorkStealingThreadPool::~WorkStealingThreadPool() {
+			for (unsigned int index = 0; index < workers.size(); ++index) {
+				ThreadPoolWorker *worker = workers[index];
+				worker->signalQuit();
+				if (worker->shutdownAndWait() == true) {
+					delete worker;
+				}
+			}
+			workers.clear();
+
+			for (unsigned int index = 0; index < queues.size(); ++index) {
+				delete queues[index];
+			}
+			queues.clear();
+
+			delete triggerTasksCompleted;
+			triggerTasksCompleted = NULL;
+			delete mutexPendingTasks;
+			mutexPendingTasks = NULL;
+		}
+
+		int WorkStealingThreadPool::getDefaultWorkerCount() {
+			// the calling thread works too
+			int cpuCount = SDL_GetCPUCount();
+			return (cpuCount > 1 ? cpuCount - 1 : 1);
+		}
+
+		int WorkStealingThreadPool::getChainLength(ThreadPoolTask *task) {
+			int length = 0;
+			for (; task != NULL; task = task->getNextTask()) {
+				length++;
+			}
+			return length;
+		}
+
+		void WorkStealingThreadPool::pushTask(int queueIndex, ThreadPoolTask *task) {
+			TaskQueue *queue = queues[queueIndex];
+			MutexSafeWrapper safeMutex(queue->mutex);
+			queue->tasks.push_back(task);
+		}
+
+		bool WorkStealingThreadPool::popTask(int queueIndex, ThreadPoolTask *&task) {
+			TaskQueue *queue = queues[queueIndex];
+			MutexSafeWrapper safeMutex(queue->mutex);
+			if (queue->tasks.empty() == true) {
+				return false;
+			}
+			task = queue->tasks.back();
+			queue->tasks.pop_back();
+			return true;
+		}
+
+		bool WorkStealingThreadPool::stealTask(int queueIndex, ThreadPoolTask *&task) {
+			int queueCount = (int) queues.size();
+			for (int offset = 1; offset < queueCount; ++offset) {
+				TaskQueue *queue = queues[(queueIndex + offset) % queueCount];
+				MutexSafeWrapper safeMutex(queue->mutex);
+				if (queue->tasks.empty() == false) {
+					task = queue->tasks.front();
+					queue->tasks.pop_front();
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void WorkStealingThreadPool::runQueuedTasks(int queueIndex) {
+			for (;;) {
+				ThreadPoolTask *task = NULL;
+				if (popTask(queueIndex, task) == false &&
+					stealTask(queueIndex, task) == false) {
+					// the rest of any chain still running is queued by the
+					// thread running it, so nothing can be lost here
+					break;
+				}
+
+				string errorText = "";
+				try {
+					TraceScope traceScope("ThreadPoolTask::runTask");
+					task->runTask();
+				} catch (const exception &ex) {
+					errorText = ex.what();
+					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, errorText.c_str());
+				}
+
+				MutexSafeWrapper safeMutex(mutexPendingTasks);
+				if (errorText != "" && taskErrorText == "") {
+					taskErrorText = errorText;
+				}
+				pendingTaskCount--;
+				if (task->getNextTask() != NULL) {
+					if (tasksCancelled == true) {
+						// the rest of the chain will never run
+						pendingTaskCount -= getChainLength(task->getNextTask());
+					} else {
+						pushTask(queueIndex, task->getNextTask());
+					}
+				}
+				if (pendingTaskCount == 0) {
+					triggerTasksCompleted->signal(true);
+				}
+			}
+		}
+
+		// Drops every queued task with the rest of its chain. Called with
+		// mutexPendingTasks held so no finished task queues its successor
+		// in the meantime.
+		void WorkStealingThreadPool::cancelQueuedTasks() {
+			tasksCancelled = true;
+			for (unsigned int index = 0; index < queues.size(); ++index) {
+				TaskQueue *queue = queues[index];
+				MutexSafeWrapper safeMutex(queue->mutex);
+				for (unsigned int taskIndex = 0; taskIndex < queue->tasks.size(); ++taskIndex) {
+					pendingTaskCount -= getChainLength(queue->tasks[taskIndex]);
+				}
+				queue->tasks.clear();
+			}
+		}
+
+		bool WorkStealingThreadPool::runTasks(const std::vector<ThreadPoolTask *> &chainHeads, int waitMilliseconds) {
+			if (chainHeads.empty() == true) {
+				return true;
+			}
+
+			int taskCount = 0;
+			for (unsigned int index = 0; index < chainHeads.size(); ++index) {
+				taskCount += getChainLength(chainHeads[index]);
+			}
+
+			MutexSafeWrapper safeMutex(mutexPendingTasks);
+			pendingTaskCount += taskCount;
+			tasksCancelled = false;
+			taskErrorText = "";
+			safeMutex.ReleaseLock();
+
+			// hand the chains out round robin, idle workers steal the rest
+			int queueCount = (int) queues.size();
+			for (unsigned int index = 0; index < chainHeads.size(); ++index) {
+				pushTask(index % queueCount, chainHeads[index]);
+			}
+			for (unsigned int index = 0; index < workers.size(); ++index) {
+				workers[index]->signalWork();
+			}
+
+			runQueuedTasks(0);
+
+			Chrono chrono;
+			chrono.start();
+
+			bool completed = true;
+			safeMutex.setMutex(mutexPendingTasks);
+			for (; pendingTaskCount > 0;) {
+				int waitRemaining = -1;
+				if (waitMilliseconds >= 0 && completed == true) {
+					waitRemaining = waitMilliseconds - (int) chrono.getMillis();
+					if (waitRemaining <= 0) {
+						// the caller owns the tasks, so the running ones must
+						// still finish before returning
+						SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] tasks still pending after %d msecs, cancelling the queued ones\n", __FILE__, __FUNCTION__, __LINE__, waitMilliseconds);
+						completed = false;
+						cancelQueuedTasks();
+						continue;
+					}
+				}
+				triggerTasksCompleted->waitTillSignalled(mutexPendingTasks, waitRemaining);
+			}
+			string errorText = taskErrorText;
+			safeMutex.ReleaseLock();
+
+			if (errorText != "") {
+				throw megaglest_runtime_error(errorText);
+			}
+			return completed;
+		}
+
+	}
+}//end namespace
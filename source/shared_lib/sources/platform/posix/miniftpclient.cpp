@@ -77,7 +77,7 @@ namespace Shared {
 				}
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client thread CANCELLED, deleting file for writing [%s]\n", fullFilePath.c_str());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread CANCELLED, deleting file for writing [%s]\n", fullFilePath.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread CANCELLED, deleting file for writing [%s]\n", fullFilePath.c_str());
 
 
 				removeFile(fullFilePath);
@@ -86,7 +86,7 @@ namespace Shared {
 
 			if (out && out->stream == NULL) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client thread opening file for writing [%s]\n", fullFilePath.c_str());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread opening file for writing [%s]\n", fullFilePath.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread opening file for writing [%s]\n", fullFilePath.c_str());
 
 				/* open file for writing */
 #ifdef WIN32
@@ -96,7 +96,7 @@ namespace Shared {
 #endif
 				if (out->stream == NULL) {
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client thread FAILED to open file for writing [%s]\n", fullFilePath.c_str());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread FAILED to open file for writing [%s]\n", fullFilePath.c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread FAILED to open file for writing [%s]\n", fullFilePath.c_str());
 					SystemFlags::OutputDebug(SystemFlags::debugError, "===> FTP Client thread FAILED to open file for writing [%s]\n", fullFilePath.c_str());
 					return 0; /* failure, can't open file to write */
 				}
@@ -104,7 +104,7 @@ namespace Shared {
 				out->isValidXfer = true;
 			} else if (out == NULL) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> #2 FTP Client thread FAILED to open file for writing [%s]\n", fullFilePath.c_str());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> #2 FTP Client thread FAILED to open file for writing [%s]\n", fullFilePath.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> #2 FTP Client thread FAILED to open file for writing [%s]\n", fullFilePath.c_str());
 				SystemFlags::OutputDebug(SystemFlags::debugError, "===> #2 FTP Client thread FAILED to open file for writing [%s]\n", fullFilePath.c_str());
 				return 0; /* failure, can't open file to write */
 			}
@@ -112,7 +112,7 @@ namespace Shared {
 			size_t result = fwrite(buffer, size, nmemb, out->stream);
 			if (result != nmemb) {
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client thread FAILED to write data chunk to file [%s] nmemb = " MG_SIZE_T_SPECIFIER ", result = " MG_SIZE_T_SPECIFIER "\n", fullFilePath.c_str(), nmemb, result);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread FAILED to write data chunk to file [%s] nmemb = " MG_SIZE_T_SPECIFIER ", result = " MG_SIZE_T_SPECIFIER "\n", fullFilePath.c_str(), nmemb, result);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread FAILED to write data chunk to file [%s] nmemb = " MG_SIZE_T_SPECIFIER ", result = " MG_SIZE_T_SPECIFIER "\n", fullFilePath.c_str(), nmemb, result);
 				SystemFlags::OutputDebug(SystemFlags::debugError, "===> FTP Client thread FAILED to write data chunk to file [%s] nmemb = " MG_SIZE_T_SPECIFIER ", result = " MG_SIZE_T_SPECIFIER "\n", fullFilePath.c_str(), nmemb, result);
 				//return -1; /* failure, can't open file to write */
 			}
@@ -199,14 +199,14 @@ namespace Shared {
 
 		int file_progress(struct FtpFile *out, double download_total, double download_now, double upload_total, double upload_now) {
 			//if(SystemFlags::VERBOSE_MODE_ENABLED) printf(" download progress [%f][%f][%f][%f] ",download_total,download_now,upload_total,upload_now);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, " download progress [%f][%f][%f][%f] ", download_total, download_now, upload_total, upload_now);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, " download progress [%f][%f][%f][%f] ", download_total, download_now, upload_total, upload_now);
 
 			if (out != NULL &&
 				out->ftpServer != NULL &&
 				out->ftpServer->getCallBackObject() != NULL) {
 				if (out->ftpServer->getQuitStatus() == true) {
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client thread CANCELLED\n");
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread CANCELLED\n");
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread CANCELLED\n");
 
 					return -1;
 				}
@@ -218,7 +218,7 @@ namespace Shared {
 				stats.currentFilename = out->currentFilename;
 				stats.downloadType = out->downloadType;
 
-				static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper safeMutex(out->ftpServer->getProgressMutex(), mutexOwnerId);
 				out->ftpServer->getProgressMutex()->setOwnerId(mutexOwnerId);
 				out->ftpServer->getCallBackObject()->FTPClient_CallbackEvent(
@@ -259,18 +259,18 @@ namespace Shared {
 			this->fileArchiveExtractCommandSuccessResult = fileArchiveExtractCommandSuccessResult;
 			this->tempFilesPath = tempFilesPath;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line %d] Using FTP port #: %d, serverUrl [%s]\n", __FILE__, __FUNCTION__, __LINE__, portNumber, serverUrl.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line %d] Using FTP port #: %d, serverUrl [%s]\n", __FILE__, __FUNCTION__, __LINE__, portNumber, serverUrl.c_str());
 		}
 
 		void FTPClientThread::signalQuit() {
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client: signalQuit\n");
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client: signalQuit\n");
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client: signalQuit\n");
 			BaseThread::signalQuit();
 		}
 
 		bool FTPClientThread::shutdownAndWait() {
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client: shutdownAndWait\n");
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client: shutdownAndWait\n");
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client: shutdownAndWait\n");
 
 			signalQuit();
 			return BaseThread::shutdownAndWait();
@@ -294,7 +294,7 @@ namespace Shared {
 			}
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client thread about to try to RETR into [%s]\n", destFile.c_str());
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread about to try to RETR into [%s]\n", destFile.c_str());
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread about to try to RETR into [%s]\n", destFile.c_str());
 
 			struct FtpFile ftpfile = {
 				NULL,
@@ -342,7 +342,7 @@ namespace Shared {
 					result.second = curl_easy_strerror(res);
 					// we failed
 					printf("curl FAILED with: %d [%s] szBuf [%s]\n", res, curl_easy_strerror(res), szBuf);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "curl FAILED with: %d [%s] szBuf [%s]\n", res, curl_easy_strerror(res), szBuf);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "curl FAILED with: %d [%s] szBuf [%s]\n", res, curl_easy_strerror(res), szBuf);
 
 					if (res == CURLE_PARTIAL_FILE) {
 						result.first = ftp_crt_PARTIALFAIL;
@@ -393,7 +393,7 @@ namespace Shared {
 				}
 			}
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 			this->getProgressMutex()->setOwnerId(mutexOwnerId);
 			if (this->pCBObject != NULL) {
@@ -407,7 +407,7 @@ namespace Shared {
 
 		void FTPClientThread::addMapToRequests(string mapFilename, string URL) {
 			std::pair<string, string> item = make_pair(mapFilename, URL);
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(&mutexMapFileList, mutexOwnerId);
 			mutexMapFileList.setOwnerId(mutexOwnerId);
 			if (std::find(mapFileList.begin(), mapFileList.end(), item) == mapFileList.end()) {
@@ -417,7 +417,7 @@ namespace Shared {
 
 		void FTPClientThread::addTilesetToRequests(string tileSetName, string URL) {
 			std::pair<string, string> item = make_pair(tileSetName, URL);
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(&mutexTilesetList, mutexOwnerId);
 			mutexTilesetList.setOwnerId(mutexOwnerId);
 			if (std::find(tilesetList.begin(), tilesetList.end(), item) == tilesetList.end()) {
@@ -427,7 +427,7 @@ namespace Shared {
 
 		void FTPClientThread::addTechtreeToRequests(string techtreeName, string URL) {
 			std::pair<string, string> item = make_pair(techtreeName, URL);
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(&mutexTechtreeList, mutexOwnerId);
 			mutexTechtreeList.setOwnerId(mutexOwnerId);
 			if (std::find(techtreeList.begin(), techtreeList.end(), item) == techtreeList.end()) {
@@ -437,7 +437,7 @@ namespace Shared {
 
 		void FTPClientThread::addScenarioToRequests(string fileName, string URL) {
 			std::pair<string, string> item = make_pair(fileName, URL);
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(&mutexScenarioList, mutexOwnerId);
 			mutexScenarioList.setOwnerId(mutexOwnerId);
 			if (std::find(scenarioList.begin(), scenarioList.end(), item) == scenarioList.end()) {
@@ -447,7 +447,7 @@ namespace Shared {
 
 		void FTPClientThread::addFileToRequests(string fileName, string URL) {
 			std::pair<string, string> item = make_pair(fileName, URL);
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(&mutexFileList, mutexOwnerId);
 			mutexFileList.setOwnerId(mutexOwnerId);
 			if (std::find(fileList.begin(), fileList.end(), item) == fileList.end()) {
@@ -457,7 +457,7 @@ namespace Shared {
 
 		void FTPClientThread::addTempFileToRequests(string fileName, string URL) {
 			std::pair<string, string> item = make_pair(fileName, URL);
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(&mutexTempFileList, mutexOwnerId);
 			mutexTempFileList.setOwnerId(mutexOwnerId);
 			if (std::find(tempFileList.begin(), tempFileList.end(), item) == tempFileList.end()) {
@@ -495,7 +495,7 @@ namespace Shared {
 				}
 			}
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 			this->getProgressMutex()->setOwnerId(mutexOwnerId);
 			if (this->pCBObject != NULL) {
@@ -585,7 +585,7 @@ namespace Shared {
 						destRootArchiveFolder,
 						destRootArchiveFolder + tileSetName.first + this->fileArchiveExtension);
 
-					static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+					static const char *mutexOwnerId = CODE_AT_LINE;
 					MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 					this->getProgressMutex()->setOwnerId(mutexOwnerId);
 
@@ -664,7 +664,7 @@ namespace Shared {
 				}
 			}
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 			this->getProgressMutex()->setOwnerId(mutexOwnerId);
 			if (this->pCBObject != NULL) {
@@ -708,7 +708,7 @@ namespace Shared {
 					destRootArchiveFolder,
 					destRootArchiveFolder + techtreeName.first + this->fileArchiveExtension);
 
-				static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 				this->getProgressMutex()->setOwnerId(mutexOwnerId);
 				if (this->pCBObject != NULL) {
@@ -739,7 +739,7 @@ namespace Shared {
 				result = getScenarioInternalFromServer(fileName);
 			}
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 			this->getProgressMutex()->setOwnerId(mutexOwnerId);
 			if (this->pCBObject != NULL) {
@@ -781,7 +781,7 @@ namespace Shared {
 					destRootArchiveFolder,
 					destRootArchiveFolder + fileName.first + this->fileArchiveExtension);
 
-				static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+				static const char *mutexOwnerId = CODE_AT_LINE;
 				MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 				this->getProgressMutex()->setOwnerId(mutexOwnerId);
 				if (this->pCBObject != NULL) {
@@ -817,7 +817,7 @@ namespace Shared {
 				result = getFileInternalFromServer(fileName);
 			}
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 			this->getProgressMutex()->setOwnerId(mutexOwnerId);
 			if (this->pCBObject != NULL) {
@@ -871,7 +871,7 @@ namespace Shared {
 				result = getTempFileInternalFromServer(fileName);
 			}
 
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 			this->getProgressMutex()->setOwnerId(mutexOwnerId);
 			if (this->pCBObject != NULL) {
@@ -939,7 +939,7 @@ namespace Shared {
 			bool wantDirList = (wantDirListOnly != NULL);
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client thread about to try to RETR into [%s] wantDirList = %d\n", destFileSaveAs.c_str(), wantDirList);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread about to try to RETR into [%s] wantDirList = %d\n", destFileSaveAs.c_str(), wantDirList);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client thread about to try to RETR into [%s] wantDirList = %d\n", destFileSaveAs.c_str(), wantDirList);
 
 			struct FtpFile ftpfile = {
 				fileNameTitle.first.c_str(),
@@ -1007,7 +1007,7 @@ namespace Shared {
 					result.second = curl_easy_strerror(res);
 					// we failed
 					printf("curl FAILED with: %d [%s] attempting to remove folder contents [%s] szBuf [%s] ftpfile.isValidXfer = %d, pathCreated = %d\n", res, curl_easy_strerror(res), destRootFolder.c_str(), szBuf, ftpfile.isValidXfer, pathCreated);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "curl FAILED with: %d [%s] attempting to remove folder contents [%s] szBuf [%s] ftpfile.isValidXfer = %d, pathCreated = %d\n", res, curl_easy_strerror(res), destRootFolder.c_str(), szBuf, ftpfile.isValidXfer, pathCreated);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "curl FAILED with: %d [%s] attempting to remove folder contents [%s] szBuf [%s] ftpfile.isValidXfer = %d, pathCreated = %d\n", res, curl_easy_strerror(res), destRootFolder.c_str(), szBuf, ftpfile.isValidXfer, pathCreated);
 
 					if (res == CURLE_PARTIAL_FILE || ftpfile.isValidXfer == true) {
 						result.first = ftp_crt_PARTIALFAIL;
@@ -1069,14 +1069,14 @@ namespace Shared {
 		}
 
 		FTPClientCallbackInterface * FTPClientThread::getCallBackObject() {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 			this->getProgressMutex()->setOwnerId(mutexOwnerId);
 			return pCBObject;
 		}
 
 		void FTPClientThread::setCallBackObject(FTPClientCallbackInterface *value) {
-			static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			MutexSafeWrapper safeMutex(this->getProgressMutex(), mutexOwnerId);
 			this->getProgressMutex()->setOwnerId(mutexOwnerId);
 			pCBObject = value;
@@ -1101,18 +1101,18 @@ namespace Shared {
 		void FTPClientThread::execute() {
 			{
 				RunningStatusSafeWrapper runningStatus(this);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				if (getQuitStatus() == true) {
 					return;
 				}
 
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client thread is running\n");
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "FTP Client thread is running\n");
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "FTP Client thread is running\n");
 
 				try {
 					while (this->getQuitStatus() == false) {
-						static string mutexOwnerId = string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId = CODE_AT_LINE;
 						MutexSafeWrapper safeMutex(&mutexMapFileList, mutexOwnerId);
 						mutexMapFileList.setOwnerId(mutexOwnerId);
 						if (mapFileList.size() > 0) {
@@ -1129,7 +1129,7 @@ namespace Shared {
 							break;
 						}
 
-						static string mutexOwnerId2 = string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId2 = CODE_AT_LINE;
 						MutexSafeWrapper safeMutex2(&mutexTilesetList, mutexOwnerId2);
 						mutexTilesetList.setOwnerId(mutexOwnerId2);
 						if (tilesetList.size() > 0) {
@@ -1142,7 +1142,7 @@ namespace Shared {
 							safeMutex2.ReleaseLock();
 						}
 
-						static string mutexOwnerId3 = string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId3 = CODE_AT_LINE;
 						MutexSafeWrapper safeMutex3(&mutexTechtreeList, mutexOwnerId3);
 						mutexTechtreeList.setOwnerId(mutexOwnerId3);
 						if (techtreeList.size() > 0) {
@@ -1155,7 +1155,7 @@ namespace Shared {
 							safeMutex3.ReleaseLock();
 						}
 
-						static string mutexOwnerId4 = string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId4 = CODE_AT_LINE;
 						MutexSafeWrapper safeMutex4(&mutexScenarioList, mutexOwnerId4);
 						mutexScenarioList.setOwnerId(mutexOwnerId4);
 						if (scenarioList.size() > 0) {
@@ -1168,7 +1168,7 @@ namespace Shared {
 							safeMutex4.ReleaseLock();
 						}
 
-						static string mutexOwnerId5 = string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId5 = CODE_AT_LINE;
 						MutexSafeWrapper safeMutex5(&mutexFileList, mutexOwnerId5);
 						mutexFileList.setOwnerId(mutexOwnerId5);
 						if (fileList.size() > 0) {
@@ -1181,7 +1181,7 @@ namespace Shared {
 							safeMutex5.ReleaseLock();
 						}
 
-						static string mutexOwnerId6 = string(__FILE__) + string("_") + intToStr(__LINE__);
+						static const char *mutexOwnerId6 = CODE_AT_LINE;
 						MutexSafeWrapper safeMutex6(&mutexTempFileList, mutexOwnerId6);
 						mutexTempFileList.setOwnerId(mutexOwnerId6);
 						if (tempFileList.size() > 0) {
@@ -1200,16 +1200,16 @@ namespace Shared {
 					}
 
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("===> FTP Client exiting!\n");
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client exiting!\n");
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "===> FTP Client exiting!\n");
 				} catch (const exception &ex) {
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
 				} catch (...) {
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", __FILE__, __FUNCTION__, __LINE__);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] unknown error\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] unknown error\n", __FILE__, __FUNCTION__, __LINE__);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] FTP Client thread is exiting\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] FTP Client thread is exiting\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
 			// Delete ourself when the thread is done (no other actions can happen after this
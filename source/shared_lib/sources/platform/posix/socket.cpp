@@ -78,6 +78,11 @@ namespace Shared {
 		int ServerSocket::ftpServerPort = 61358;
 		int ServerSocket::maxPlayerCount = -1;
 		int ServerSocket::externalPort = Socket::broadcast_portno;
+
+		// sends a buffered socket queues for a peer that is not reading before
+		// it is disconnected
+		static const int maxSocketSendBufferBytes = 4 * 1024 * 1024;
+
 		BroadCastClientSocketThread *ClientSocket::broadCastClientThread = NULL;
 		SDL_Thread *ServerSocket::upnpdiscoverThread = NULL;
 		bool ServerSocket::cancelUpnpdiscoverThread = false;
@@ -231,13 +236,13 @@ namespace Shared {
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("SocketManager calling WSAStartup...\n");
 			WSAStartup(wVersionRequested, &wsaData);
 			//dont throw exceptions here, this is a static initializacion
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Winsock initialized.\n");
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Winsock initialized.\n");
 		}
 
 		SocketManager::~SocketManager() {
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("SocketManager calling WSACleanup...\n");
 			WSACleanup();
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Winsock cleanup complete.\n");
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Winsock cleanup complete.\n");
 		}
 
 #else
@@ -507,17 +512,17 @@ namespace Shared {
 
 #if defined(USE_GETIFADDRS)
 			// BSD-style implementation
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			struct ifaddrs * ifap;
 			if (getifaddrs(&ifap) == 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				struct ifaddrs * p = ifap;
 				while (p) {
 					uint32 ifaAddr = SockAddrToUint32(p->ifa_addr);
 					uint32 maskAddr = SockAddrToUint32(p->ifa_netmask);
 					uint32 dstAddr = SockAddrToUint32(p->ifa_dstaddr);
 					if (ifaAddr > 0) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 						char ifaAddrStr[32];  Ip::Inet_NtoA(ifaAddr, ifaAddrStr);
 						char maskAddrStr[32]; Ip::Inet_NtoA(maskAddr, maskAddrStr);
@@ -527,7 +532,7 @@ namespace Shared {
 							broadCastAddress = dstAddrStr;
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ifaAddrStr [%s], maskAddrStr [%s], dstAddrStr[%s], ipAddress [%s], broadCastAddress [%s]\n", __FILE__, __FUNCTION__, __LINE__, ifaAddrStr, maskAddrStr, dstAddrStr, ipAddress.c_str(), broadCastAddress.c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ifaAddrStr [%s], maskAddrStr [%s], dstAddrStr[%s], ipAddress [%s], broadCastAddress [%s]\n", __FILE__, __FUNCTION__, __LINE__, ifaAddrStr, maskAddrStr, dstAddrStr, ipAddress.c_str(), broadCastAddress.c_str());
 					}
 					p = p->ifa_next;
 				}
@@ -670,7 +675,7 @@ namespace Shared {
 					Ip::Inet_NtoA(SockAddrToUint32((struct in_addr *)myhostent->h_addr_list[ipIdx]), myhostaddr);
 
 					//printf("ipIdx = %d [%s]\n",ipIdx,myhostaddr);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] myhostaddr = [%s]\n", __FILE__, __FUNCTION__, __LINE__, myhostaddr);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] myhostaddr = [%s]\n", __FILE__, __FUNCTION__, __LINE__, myhostaddr);
 
 					if (strlen(myhostaddr) > 0 &&
 						strncmp(myhostaddr, "127.", 4) != 0 &&
@@ -694,7 +699,7 @@ namespace Shared {
 					struct sockaddr_in *sa = (struct sockaddr_in *) ifa->ifa_addr;
 					char *addr = inet_ntoa(sa->sin_addr);
 					//printf("Interface: %s\tAddress: %s\n", ifa->ifa_name, addr);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) {
 						SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Interface: [%s] address: [%s]\n", __FILE__, __FUNCTION__, __LINE__, ifa->ifa_name, addr);
 					}
 					if (strlen(addr) > 0 &&
@@ -740,7 +745,7 @@ namespace Shared {
 					/* I want IP address attached to "eth0" */
 					char szBuf[100] = "";
 					snprintf(szBuf, 100, "%s%d", intfName.c_str(), idx);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Trying NIC named [%s]\n", __FILE__, __FUNCTION__, __LINE__, szBuf);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Trying NIC named [%s]\n", __FILE__, __FUNCTION__, __LINE__, szBuf);
 					//printf("In [%s::%s Line: %d] Trying NIC named [%s]\n",__FILE__,__FUNCTION__,__LINE__,szBuf);
 
 					int maxIfNameLength = std::min((int) strlen(szBuf), IFNAMSIZ - 1);
@@ -759,7 +764,7 @@ namespace Shared {
 						if (pSockAddr != NULL) {
 							char myhostaddr[101] = "";
 							Ip::Inet_NtoA(SockAddrToUint32(&pSockAddr->sin_addr), myhostaddr);
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] szBuf [%s], myhostaddr = [%s], ifr.ifr_flags = %d, ifrA.ifr_flags = %d, ifr.ifr_name [%s]\n", __FILE__, __FUNCTION__, __LINE__, szBuf, myhostaddr, ifr.ifr_flags, ifrA.ifr_flags, ifr.ifr_name);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] szBuf [%s], myhostaddr = [%s], ifr.ifr_flags = %d, ifrA.ifr_flags = %d, ifr.ifr_name [%s]\n", __FILE__, __FUNCTION__, __LINE__, szBuf, myhostaddr, ifr.ifr_flags, ifrA.ifr_flags, ifr.ifr_name);
 							// Now only include interfaces that are both UP and running
 							if ((ifrA.ifr_flags & IFF_UP) == IFF_UP &&
 								(ifrA.ifr_flags & IFF_RUNNING) == IFF_RUNNING) {
@@ -802,7 +807,7 @@ namespace Shared {
 						sockaddr_in *sa_in = (sockaddr_in *) addr;
 						char *strIP = ::inet_ntoa((sa_in->sin_addr));
 						//printf("\tIPV4:%s\n", strIP);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) {
 							SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] strIP [%s]\n", __FILE__, __FUNCTION__, __LINE__, strIP);
 						}
 						if (strlen(strIP) > 0 &&
@@ -863,6 +868,12 @@ namespace Shared {
 			this->sock = sock;
 			this->isSocketBlocking = true;
 			this->connectedIpAddress = "";
+			this->isSocketBuffered = false;
+			this->bufferedWasBlocking = true;
+			this->receiveIncomplete = false;
+			this->receiveClosed = false;
+			this->receiveBufferStart = 0;
+			this->receiveBufferMark = 0;
 		}
 
 		Socket::Socket() {
@@ -878,7 +889,7 @@ namespace Shared {
 			this->inSocketDestructor = false;
 			//safeMutexSocketDestructorFlag.ReleaseLock();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//this->pingThread = NULL;
 
@@ -890,6 +901,12 @@ namespace Shared {
 			}
 
 			this->isSocketBlocking = true;
+			this->isSocketBuffered = false;
+			this->bufferedWasBlocking = true;
+			this->receiveIncomplete = false;
+			this->receiveClosed = false;
+			this->receiveBufferStart = 0;
+			this->receiveBufferMark = 0;
 
 #ifdef __APPLE__
 			int set = 1;
@@ -987,7 +1004,7 @@ namespace Shared {
 			inSocketDestructorSynchAccessor->setOwnerId(CODE_AT_LINE);
 			this->inSocketDestructor = true;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] START closing socket = %d...\n", __FILE__, __FUNCTION__, sock);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] START closing socket = %d...\n", __FILE__, __FUNCTION__, sock);
 
 			//safeMutexSocketDestructorFlag.ReleaseLock();
 
@@ -1002,7 +1019,7 @@ namespace Shared {
 				//sleep(0);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END closing socket = %d...\n", __FILE__, __FUNCTION__, sock);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END closing socket = %d...\n", __FILE__, __FUNCTION__, sock);
 
 			//delete pingThread;
 			//pingThread = NULL;
@@ -1019,10 +1036,10 @@ namespace Shared {
 		void Socket::disconnectSocket() {
 			//printf("Socket disconnecting sock = %d\n",sock);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] START closing socket = %d...\n", __FILE__, __FUNCTION__, sock);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] START closing socket = %d...\n", __FILE__, __FUNCTION__, sock);
 
 			if (isSocketValid() == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] calling shutdown and close for socket = %d...\n", __FILE__, __FUNCTION__, sock);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] calling shutdown and close for socket = %d...\n", __FILE__, __FUNCTION__, sock);
 
 				MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
 				MutexSafeWrapper safeMutex1(dataSynchAccessorWrite, CODE_AT_LINE);
@@ -1041,7 +1058,7 @@ namespace Shared {
 				safeMutex1.ReleaseLock();
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END closing socket = %d...\n", __FILE__, __FUNCTION__, sock);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] END closing socket = %d...\n", __FILE__, __FUNCTION__, sock);
 		}
 
 		// Int lookup is socket fd while bool result is whether or not that socket was signalled for reading
@@ -1082,7 +1099,7 @@ namespace Shared {
 						retval = select((int) imaxsocket + 1, &rfds, NULL, NULL, &tv);
 					}
 					if (retval < 0) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s, socketDebugList [%s]\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str(), socketDebugList.c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s, socketDebugList [%s]\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str(), socketDebugList.c_str());
 						printf("In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str());
 					} else if (retval) {
 						bResult = true;
@@ -1105,6 +1122,12 @@ namespace Shared {
 
 		bool Socket::hasDataToRead() {
 			MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
+			if (getReceiveBufferedBytes() > 0) {
+				return true;
+			}
+			if (isSocketBuffered == true) {
+				return false;
+			}
 			return Socket::hasDataToRead(sock);
 		}
 
@@ -1129,7 +1152,7 @@ namespace Shared {
 					retval = select((int) socket + 1, &rfds, NULL, NULL, &tv);
 				}
 				if (retval < 0) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str());
 					printf("In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str());
 				} else if (retval) {
 					if (FD_ISSET(socket, &rfds)) {
@@ -1143,6 +1166,13 @@ namespace Shared {
 
 		bool Socket::hasDataToReadWithWait(int waitMicroseconds) {
 			MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
+			// a buffered socket only gets data when its owner fills it, waiting won't help
+			if (getReceiveBufferedBytes() > 0) {
+				return true;
+			}
+			if (isSocketBuffered == true) {
+				return false;
+			}
 			return Socket::hasDataToReadWithWait(sock, waitMicroseconds);
 		}
 
@@ -1169,7 +1199,7 @@ namespace Shared {
 					retval = select((int) socket + 1, &rfds, NULL, NULL, &tv);
 				}
 				if (retval < 0) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str());
 					printf("In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, retval, getLastSocketErrorFormattedText().c_str());
 				}
 
@@ -1185,6 +1215,13 @@ namespace Shared {
 		}
 
 		int Socket::getDataToRead(bool wantImmediateReply) {
+			MutexSafeWrapper safeMutexBuffer(dataSynchAccessorRead, CODE_AT_LINE);
+			int bufferedBytes = getReceiveBufferedBytes();
+			if (bufferedBytes > 0 || isSocketBuffered == true) {
+				return bufferedBytes;
+			}
+			safeMutexBuffer.ReleaseLock();
+
 			unsigned long size = 0;
 
 			//fd_set rfds;
@@ -1213,11 +1250,11 @@ namespace Shared {
 #endif
 					int lastSocketError = getLastSocketError();
 					if (err < 0 && lastSocketError != PLATFORM_SOCKET_TRY_AGAIN) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR PEEKING SOCKET DATA, err = %d %s\n", __FILE__, __FUNCTION__, __LINE__, err, getLastSocketErrorFormattedText().c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR PEEKING SOCKET DATA, err = %d %s\n", __FILE__, __FUNCTION__, __LINE__, err, getLastSocketErrorFormattedText().c_str());
 						break;
 					} else if (err == 0) {
 						if (isConnected() == false) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR PEEKING SOCKET DATA, err = %d %s\n", __FILE__, __FUNCTION__, __LINE__, err, getLastSocketErrorFormattedText().c_str());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR PEEKING SOCKET DATA, err = %d %s\n", __FILE__, __FUNCTION__, __LINE__, err, getLastSocketErrorFormattedText().c_str());
 							break;
 						}
 					}
@@ -1226,10 +1263,10 @@ namespace Shared {
 						break;
 					} else if (hasDataToRead() == true) {
 						//if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] WARNING PEEKING SOCKET DATA, (hasDataToRead() == true) err = %d, sock = %d, size = " MG_SIZE_T_SPECIFIER ", loopCount = %d\n",__FILE__,__FUNCTION__,__LINE__,err,sock,size,loopCount);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING PEEKING SOCKET DATA, (hasDataToRead() == true) err = %d, sock = %d, size = " MG_SIZE_T_SPECIFIER "\n", __FILE__, __FUNCTION__, __LINE__, err, sock, size);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING PEEKING SOCKET DATA, (hasDataToRead() == true) err = %d, sock = %d, size = " MG_SIZE_T_SPECIFIER "\n", __FILE__, __FUNCTION__, __LINE__, err, sock, size);
 					} else {
 						//if(SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork,"In [%s::%s Line: %d] WARNING PEEKING SOCKET DATA, err = %d, sock = %d, size = " MG_SIZE_T_SPECIFIER ", loopCount = %d\n",__FILE__,__FUNCTION__,__LINE__,err,sock,size,loopCount);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING PEEKING SOCKET DATA, err = %d, sock = %d, size = " MG_SIZE_T_SPECIFIER "\n", __FILE__, __FUNCTION__, __LINE__, err, sock, size);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING PEEKING SOCKET DATA, err = %d, sock = %d, size = " MG_SIZE_T_SPECIFIER "\n", __FILE__, __FUNCTION__, __LINE__, err, sock, size);
 						break;
 					}
 
@@ -1245,6 +1282,10 @@ namespace Shared {
 		}
 
 		int Socket::send(const void *data, int dataSize) {
+			if (isSocketBuffered == true) {
+				return sendBuffered(data, dataSize);
+			}
+
 			const int MAX_SEND_WAIT_SECONDS = 3;
 
 			int bytesSent = 0;
@@ -1277,16 +1318,16 @@ namespace Shared {
 
 			int lastSocketError = getLastSocketError();
 			if (bytesSent < 0 && lastSocketError != PLATFORM_SOCKET_TRY_AGAIN) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR WRITING SOCKET DATA, err = %d error = %s dataSize = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, getLastSocketErrorFormattedText(&lastSocketError).c_str(), dataSize);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR WRITING SOCKET DATA, err = %d error = %s dataSize = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, getLastSocketErrorFormattedText(&lastSocketError).c_str(), dataSize);
 			} else if (bytesSent < 0 && lastSocketError == PLATFORM_SOCKET_TRY_AGAIN && isConnected() == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #1 EAGAIN during send, trying again... dataSize = %d\n", __FILE__, __FUNCTION__, __LINE__, dataSize);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #1 EAGAIN during send, trying again... dataSize = %d\n", __FILE__, __FUNCTION__, __LINE__, dataSize);
 
 				int attemptCount = 0;
 				time_t tStartTimer = time(NULL);
 				while ((bytesSent < 0 && lastSocketError == PLATFORM_SOCKET_TRY_AGAIN) &&
 					(difftime((long int) time(NULL), tStartTimer) <= MAX_SEND_WAIT_SECONDS)) {
 					attemptCount++;
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount);
 
 					MutexSafeWrapper safeMutex(dataSynchAccessorWrite, CODE_AT_LINE);
 					if (isConnected() == true) {
@@ -1295,7 +1336,7 @@ namespace Shared {
 						timeVal.tv_usec = 0;
 						bool canWrite = isWritable(&timeVal);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d, sock = %d, dataSize = %d, data = %p, canWrite = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount, sock, dataSize, data, canWrite);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d, sock = %d, dataSize = %d, data = %p, canWrite = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount, sock, dataSize, data, canWrite);
 
 						//	        	MutexSafeWrapper safeMutexSocketDestructorFlag(&inSocketDestructorSynchAccessor,CODE_AT_LINE);
 						//	        	if(this->inSocketDestructor == true) {
@@ -1318,24 +1359,24 @@ namespace Shared {
 
 						//safeMutex.ReleaseLock();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 EAGAIN during send, trying again returned: %d\n", __FILE__, __FUNCTION__, __LINE__, bytesSent);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 EAGAIN during send, trying again returned: %d\n", __FILE__, __FUNCTION__, __LINE__, bytesSent);
 					} else {
 						int iErr = getLastSocketError();
 
 						safeMutex.ReleaseLock();
 						disconnectSocket();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s] DISCONNECTED SOCKET error while sending socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, bytesSent, getLastSocketErrorFormattedText(&iErr).c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s] DISCONNECTED SOCKET error while sending socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, bytesSent, getLastSocketErrorFormattedText(&iErr).c_str());
 						break;
 
 					}
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount);
 				}
 			}
 
 			if (isConnected() == true && bytesSent > 0 && bytesSent < dataSize) {
 				lastSocketError = getLastSocketError();
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] need to send more data, trying again getLastSocketError() = %d, bytesSent = %d, dataSize = %d\n", __FILE__, __FUNCTION__, __LINE__, lastSocketError, bytesSent, dataSize);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] need to send more data, trying again getLastSocketError() = %d, bytesSent = %d, dataSize = %d\n", __FILE__, __FUNCTION__, __LINE__, lastSocketError, bytesSent, dataSize);
 
 				int totalBytesSent = bytesSent;
 				int attemptCount = 0;
@@ -1346,7 +1387,7 @@ namespace Shared {
 					(bytesSent < 0 && lastSocketError == PLATFORM_SOCKET_TRY_AGAIN)) &&
 					(difftime((long int) time(NULL), tStartTimer) <= MAX_SEND_WAIT_SECONDS)) {
 					attemptCount++;
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d, totalBytesSent = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount, totalBytesSent);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d, totalBytesSent = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount, totalBytesSent);
 
 					MutexSafeWrapper safeMutex(dataSynchAccessorWrite, CODE_AT_LINE);
 					if (isConnected() == true) {
@@ -1355,7 +1396,7 @@ namespace Shared {
 						timeVal.tv_usec = 0;
 						bool canWrite = isWritable(&timeVal);
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d, sock = %d, dataSize = %d, data = %p, canWrite = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount, sock, dataSize, data, canWrite);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d, sock = %d, dataSize = %d, data = %p, canWrite = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount, sock, dataSize, data, canWrite);
 
 						//	        	MutexSafeWrapper safeMutexSocketDestructorFlag(&inSocketDestructorSynchAccessor,CODE_AT_LINE);
 						//	        	if(this->inSocketDestructor == true) {
@@ -1381,21 +1422,21 @@ namespace Shared {
 							break;
 						}
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] retry send returned: %d\n", __FILE__, __FUNCTION__, __LINE__, bytesSent);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] retry send returned: %d\n", __FILE__, __FUNCTION__, __LINE__, bytesSent);
 					} else {
 						int iErr = getLastSocketError();
 
 						safeMutex.ReleaseLock();
 						disconnectSocket();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while sending socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, getLastSocketErrorFormattedText(&iErr).c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while sending socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, getLastSocketErrorFormattedText(&iErr).c_str());
 						break;
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] attemptCount = %d\n", __FILE__, __FUNCTION__, __LINE__, attemptCount);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] bytesSent = %d, totalBytesSent = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, totalBytesSent);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] bytesSent = %d, totalBytesSent = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, totalBytesSent);
 
 				if (bytesSent > 0) {
 					bytesSent = totalBytesSent;
@@ -1403,20 +1444,24 @@ namespace Shared {
 			}
 
 			if (bytesSent <= 0 || isConnected() == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR WRITING SOCKET DATA, err = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, getLastSocketErrorFormattedText().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] ERROR WRITING SOCKET DATA, err = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, getLastSocketErrorFormattedText().c_str());
 
 				int iErr = getLastSocketError();
 				disconnectSocket();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while sending socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, getLastSocketErrorFormattedText(&iErr).c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while sending socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesSent, getLastSocketErrorFormattedText(&iErr).c_str());
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sock = %d, bytesSent = %d\n", __FILE__, __FUNCTION__, __LINE__, sock, bytesSent);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] sock = %d, bytesSent = %d\n", __FILE__, __FUNCTION__, __LINE__, sock, bytesSent);
 
 			return static_cast<int>(bytesSent);
 		}
 
 		int Socket::receive(void *data, int dataSize, bool tryReceiveUntilDataSizeMet) {
+			if (isSocketBuffered == true || getReceiveBufferedBytes() > 0) {
+				return receiveBuffered(data, dataSize, tryReceiveUntilDataSizeMet);
+			}
+
 			ssize_t bytesReceived = 0;
 
 			if (isSocketValid() == true) {
@@ -1429,9 +1474,9 @@ namespace Shared {
 
 			int lastSocketError = getLastSocketError();
 			if (bytesReceived < 0 && lastSocketError != PLATFORM_SOCKET_TRY_AGAIN) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR READING SOCKET DATA error while sending socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, getLastSocketErrorFormattedText(&lastSocketError).c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR READING SOCKET DATA error while sending socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, getLastSocketErrorFormattedText(&lastSocketError).c_str());
 			} else if (bytesReceived < 0 && lastSocketError == PLATFORM_SOCKET_TRY_AGAIN) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #1 EAGAIN during receive, trying again...\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #1 EAGAIN during receive, trying again...\n", __FILE__, __FUNCTION__, __LINE__);
 
 				Chrono chronoElapsed(true);
 				const int MAX_RECV_WAIT_SECONDS = 3;
@@ -1439,12 +1484,12 @@ namespace Shared {
 				while ((bytesReceived < 0 && lastSocketError == PLATFORM_SOCKET_TRY_AGAIN) &&
 					(difftime((long int) time(NULL), tStartTimer) <= MAX_RECV_WAIT_SECONDS)) {
 					if (isConnected() == false) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] Socket is NOT connected!\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] Socket is NOT connected!\n", __FILE__, __FUNCTION__, __LINE__);
 
 						int iErr = getLastSocketError();
 						disconnectSocket();
 
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while receiving socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, getLastSocketErrorFormattedText(&iErr).c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while receiving socket data, bytesSent = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, getLastSocketErrorFormattedText(&iErr).c_str());
 						break;
 					}
 					//else if(Socket::isReadable(true) == true) {
@@ -1459,7 +1504,7 @@ namespace Shared {
 							//safeBlock.Restore();
 							safeMutex.ReleaseLock();
 
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 EAGAIN during receive, trying again returned: %d, lastSocketError = %d, dataSize = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, lastSocketError, (int) dataSize);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 EAGAIN during receive, trying again returned: %d, lastSocketError = %d, dataSize = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, lastSocketError, (int) dataSize);
 							//printf("In [%s::%s Line: %d] #2 EAGAIN during receive, trying again returned: %d, lastSocketError = %d, dataSize = %d\n",__FILE__,__FUNCTION__,__LINE__,bytesReceived,lastSocketError,(int)dataSize);
 						} else {
 							//if(chronoElapsed.getMillis() % 3 == 0) {
@@ -1474,35 +1519,35 @@ namespace Shared {
 			}
 
 			if (bytesReceived <= 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] bytesReceived = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] bytesReceived = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived);
 
 				int iErr = getLastSocketError();
 				disconnectSocket();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while receiving socket data, bytesReceived = %d, error = %s, dataSize = %d, tryReceiveUntilDataSizeMet = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, getLastSocketErrorFormattedText(&iErr).c_str(), dataSize, tryReceiveUntilDataSizeMet);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while receiving socket data, bytesReceived = %d, error = %s, dataSize = %d, tryReceiveUntilDataSizeMet = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, getLastSocketErrorFormattedText(&iErr).c_str(), dataSize, tryReceiveUntilDataSizeMet);
 			} else if (tryReceiveUntilDataSizeMet == true && bytesReceived < dataSize) {
 				int newBufferSize = (dataSize - (int) bytesReceived);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING, attempting to receive MORE data, bytesReceived = %d, dataSize = %d, newBufferSize = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, dataSize, newBufferSize);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING, attempting to receive MORE data, bytesReceived = %d, dataSize = %d, newBufferSize = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, dataSize, newBufferSize);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("\nIn [%s::%s Line: %d] WARNING, attempting to receive MORE data, bytesReceived = %d, dataSize = %d, newBufferSize = %d\n", __FILE__, __FUNCTION__, __LINE__, (int) bytesReceived, dataSize, newBufferSize);
 
 				char *dataAsCharPointer = reinterpret_cast<char *>(data);
 				int additionalBytes = receive(&dataAsCharPointer[bytesReceived], newBufferSize, tryReceiveUntilDataSizeMet);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING, additionalBytes = %d\n", __FILE__, __FUNCTION__, __LINE__, additionalBytes);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] WARNING, additionalBytes = %d\n", __FILE__, __FUNCTION__, __LINE__, additionalBytes);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("\nIn [%s::%s Line: %d] WARNING, additionalBytes = %d\n", __FILE__, __FUNCTION__, __LINE__, additionalBytes);
 
 				if (additionalBytes > 0) {
 					bytesReceived += additionalBytes;
 				} else {
 					//throw megaglest_runtime_error("additionalBytes == " + intToStr(additionalBytes));
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] additionalBytes == %d\n", __FILE__, __FUNCTION__, __LINE__, additionalBytes);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] additionalBytes == %d\n", __FILE__, __FUNCTION__, __LINE__, additionalBytes);
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("\nIn [%s::%s Line: %d] additionalBytes == %d\n", __FILE__, __FUNCTION__, __LINE__, additionalBytes);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] additionalBytes == %d\n", __FILE__, __FUNCTION__, __LINE__, additionalBytes);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] additionalBytes == %d\n", __FILE__, __FUNCTION__, __LINE__, additionalBytes);
 
 					int iErr = getLastSocketError();
 					disconnectSocket();
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while receiving socket data, bytesReceived = %d, error = %s, dataSize = %d, tryReceiveUntilDataSizeMet = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, getLastSocketErrorFormattedText(&iErr).c_str(), dataSize, tryReceiveUntilDataSizeMet);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while receiving socket data, bytesReceived = %d, error = %s, dataSize = %d, tryReceiveUntilDataSizeMet = %d\n", __FILE__, __FUNCTION__, __LINE__, bytesReceived, getLastSocketErrorFormattedText(&iErr).c_str(), dataSize, tryReceiveUntilDataSizeMet);
 				}
 			}
 			return static_cast<int>(bytesReceived);
@@ -1539,7 +1584,7 @@ namespace Shared {
 
 		int Socket::peek(void *data, int dataSize, bool mustGetData, int *pLastSocketError) {
 			Chrono chrono;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) chrono.start();
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) chrono.start();
 
 			int lastSocketError = 0;
 			int err = 0;
@@ -1584,17 +1629,17 @@ namespace Shared {
 
 				//printf("Peek #1 err = %d\n",err);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) if (chrono.getMillis() > 1) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] action running for msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) if (chrono.getMillis() > 1) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] action running for msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis());
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] SOCKET appears to be invalid [%d]\n", __FILE__, __FUNCTION__, __LINE__, sock);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] SOCKET appears to be invalid [%d]\n", __FILE__, __FUNCTION__, __LINE__, sock);
 			}
 			//if(chrono.getMillis() > 1) printf("In [%s::%s Line: %d] action running for msecs: %lld\n",__FILE__,__FUNCTION__,__LINE__,(long long int)chrono.getMillis());
 
 			if (err < 0 && lastSocketError != PLATFORM_SOCKET_TRY_AGAIN) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR PEEKING SOCKET DATA error while sending socket data, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, err, getLastSocketErrorFormattedText().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR PEEKING SOCKET DATA error while sending socket data, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, err, getLastSocketErrorFormattedText().c_str());
 				disconnectSocket();
 			} else if (err < 0 && lastSocketError == PLATFORM_SOCKET_TRY_AGAIN && mustGetData == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #1 ERROR EAGAIN during peek, trying again...\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #1 ERROR EAGAIN during peek, trying again...\n", __FILE__, __FUNCTION__, __LINE__);
 
 				//printf("Peek #2 err = %d\n",err);
 
@@ -1645,17 +1690,17 @@ namespace Shared {
 						if (err == 0 || err == PLATFORM_SOCKET_TRY_AGAIN) {
 							sleep(0);
 						}
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) if (chrono.getMillis() > 1) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] action running for msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 EAGAIN during peek, trying again returned: %d\n", __FILE__, __FUNCTION__, __LINE__, err);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) if (chrono.getMillis() > 1) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] action running for msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 EAGAIN during peek, trying again returned: %d\n", __FILE__, __FUNCTION__, __LINE__, err);
 					}
 					//else {
 						//printf("Socket peek delayed [NOT READABLE] checking for sock = %d err = %d\n",sock,err);
 					//}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) if (chrono.getMillis() > 1) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] action running for msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) if (chrono.getMillis() > 1) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] action running for msecs: %lld\n", __FILE__, __FUNCTION__, __LINE__, (long long int)chrono.getMillis());
 			} else if (err == 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 SOCKET appears to be invalid [%d] lastSocketError [%d] err [%d] mustGetData [%d] dataSize [%d]\n", __FILE__, __FUNCTION__, __LINE__, sock, lastSocketError, err, mustGetData, dataSize);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 SOCKET appears to be invalid [%d] lastSocketError [%d] err [%d] mustGetData [%d] dataSize [%d]\n", __FILE__, __FUNCTION__, __LINE__, sock, lastSocketError, err, mustGetData, dataSize);
 			}
 
 			//if(chrono.getMillis() > 1) printf("In [%s::%s Line: %d] action running for msecs: %lld\n",__FILE__,__FUNCTION__,__LINE__,(long long int)chrono.getMillis());
@@ -1665,16 +1710,16 @@ namespace Shared {
 				//printf("** #1 Socket peek error for sock = %d err = %d lastSocketError = %d\n",sock,err,lastSocketError);
 
 				int iErr = lastSocketError;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTING SOCKET for socket [%d], err = %d, dataSize = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, dataSize, getLastSocketErrorFormattedText(&iErr).c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTING SOCKET for socket [%d], err = %d, dataSize = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, dataSize, getLastSocketErrorFormattedText(&iErr).c_str());
 				//printf("Peek #3 err = %d\n",err);
 				//lastSocketError = getLastSocketError();
 				if (mustGetData == true || lastSocketError != PLATFORM_SOCKET_TRY_AGAIN) {
 					printf("** #2 Socket peek error for sock = %d err = %d lastSocketError = %d mustGetData = %d\n", sock, err, lastSocketError, mustGetData);
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTING SOCKET for socket [%d], err = %d, dataSize = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, dataSize, getLastSocketErrorFormattedText(&iErr).c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTING SOCKET for socket [%d], err = %d, dataSize = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, dataSize, getLastSocketErrorFormattedText(&iErr).c_str());
 
 					if (err == 0) {
 						printf("** LAST CHANCE for disconnection check for sock = %d\n", sock);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "** LAST CHANCE for disconnection check for sock = %d\n", sock);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "** LAST CHANCE for disconnection check for sock = %d\n", sock);
 
 						MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
 						SafeSocketBlockToggleWrapper safeUnblock(this, false);
@@ -1685,18 +1730,18 @@ namespace Shared {
 
 						if (second_err == 0 || second_err < 0) {
 							printf("** Disconnecting sock = %d\n", sock);
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "** Disconnecting sock = %d\n", sock);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "** Disconnecting sock = %d\n", sock);
 
 							disconnectSocket();
 						}
 					} else {
 						printf("** Disconnecting sock = %d\n", sock);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "** Disconnecting sock = %d\n", sock);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "** Disconnecting sock = %d\n", sock);
 
 						disconnectSocket();
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while peeking socket data for socket [%d], err = %d, dataSize = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, dataSize, getLastSocketErrorFormattedText(&iErr).c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while peeking socket data for socket [%d], err = %d, dataSize = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, dataSize, getLastSocketErrorFormattedText(&iErr).c_str());
 				}
 			}
 
@@ -1751,6 +1796,213 @@ namespace Shared {
 			}
 		}
 
+		void Socket::setBuffered(bool value) {
+			if (value == isSocketBuffered) {
+				return;
+			}
+
+			MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
+			MutexSafeWrapper safeMutex1(dataSynchAccessorWrite, CODE_AT_LINE);
+			if (value == true) {
+				bufferedWasBlocking = getBlock();
+				setBlock(false);
+				isSocketBuffered = true;
+				receiveIncomplete = false;
+				receiveClosed = false;
+			} else {
+				isSocketBuffered = false;
+				setBlock(bufferedWasBlocking);
+
+				// what is still queued goes out ahead of any new send, unread
+				// data is handed out by receive before the kernel's
+				if (sendBuffer.empty() == false) {
+					std::vector<char> pendingSend;
+					pendingSend.swap(sendBuffer);
+					send(&pendingSend[0], (int) pendingSend.size());
+				}
+			}
+		}
+
+		int Socket::fillReceiveBuffer() {
+			MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
+			// everything before the current message has been read
+			if (receiveBufferMark > 0) {
+				receiveBuffer.erase(receiveBuffer.begin(), receiveBuffer.begin() + receiveBufferMark);
+				receiveBufferStart -= receiveBufferMark;
+				receiveBufferMark = 0;
+			}
+
+			int bytesTotal = 0;
+			char data[4096];
+			for (; isSocketValid() == true;) {
+				ssize_t bytesReceived = recv(sock, data, sizeof(data), 0);
+				if (bytesReceived > 0) {
+					receiveBuffer.insert(receiveBuffer.end(), data, data + bytesReceived);
+					bytesTotal += (int) bytesReceived;
+					continue;
+				}
+				if (bytesReceived == 0) {
+					// the peer closed, isConnected says so once the rest is read
+					receiveClosed = true;
+					break;
+				}
+
+				int lastSocketError = getLastSocketError();
+				if (lastSocketError == PLATFORM_SOCKET_TRY_AGAIN) {
+					break;
+				}
+				if (lastSocketError == PLATFORM_SOCKET_INTERRUPTED) {
+					continue;
+				}
+
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while filling receive buffer, error = %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText(&lastSocketError).c_str());
+				safeMutex.ReleaseLock();
+				disconnectSocket();
+				return -1;
+			}
+
+			if (bytesTotal > 0) {
+				receiveIncomplete = false;
+			}
+			return bytesTotal;
+		}
+
+		int Socket::receiveBuffered(void *data, int dataSize, bool tryReceiveUntilDataSizeMet) {
+			MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
+			int bufferedBytes = getReceiveBufferedBytes();
+			char *dataAsCharPointer = reinterpret_cast<char *>(data);
+
+			if (isSocketBuffered == false) {
+				// left over from when the socket was buffered, the rest comes from the kernel
+				int bytesReceived = min(bufferedBytes, dataSize);
+				if (bytesReceived > 0) {
+					memcpy(dataAsCharPointer, &receiveBuffer[receiveBufferStart], bytesReceived);
+					receiveBufferStart += bytesReceived;
+				}
+				if (getReceiveBufferedBytes() == 0) {
+					receiveBuffer.clear();
+					receiveBufferStart = 0;
+					receiveBufferMark = 0;
+				}
+				safeMutex.ReleaseLock();
+
+				if (bytesReceived < dataSize) {
+					int additionalBytes = receive(&dataAsCharPointer[bytesReceived], dataSize - bytesReceived, tryReceiveUntilDataSizeMet);
+					if (additionalBytes <= 0) {
+						return additionalBytes;
+					}
+					bytesReceived += additionalBytes;
+				}
+				return bytesReceived;
+			}
+
+			if (bufferedBytes < dataSize) {
+				if (receiveClosed == true || isSocketValid() == false) {
+					// nothing more is coming, fail the read as a disconnect would
+					safeMutex.ReleaseLock();
+					disconnectSocket();
+					return 0;
+				}
+				receiveIncomplete = true;
+				throw socket_receive_incomplete("Waiting for " + intToStr(dataSize - bufferedBytes) + " more bytes of a message");
+			}
+
+			memcpy(dataAsCharPointer, &receiveBuffer[receiveBufferStart], dataSize);
+			receiveBufferStart += dataSize;
+			return dataSize;
+		}
+
+		int Socket::sendBuffered(const void *data, int dataSize) {
+			MutexSafeWrapper safeMutex(dataSynchAccessorWrite, CODE_AT_LINE);
+			if (isSocketValid() == false) {
+				return 0;
+			}
+
+			const char *sendData = reinterpret_cast<const char *>(data);
+			int bytesSent = 0;
+			// anything already queued has to go first
+			if (sendBuffer.empty() == true) {
+#ifdef __APPLE__
+				ssize_t result = ::send(sock, sendData, dataSize, SO_NOSIGPIPE);
+#else
+				ssize_t result = ::send(sock, sendData, dataSize, MSG_NOSIGNAL | MSG_DONTWAIT);
+#endif
+				if (result < 0) {
+					int lastSocketError = getLastSocketError();
+					if (lastSocketError != PLATFORM_SOCKET_TRY_AGAIN) {
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while sending socket data, error = %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText(&lastSocketError).c_str());
+						safeMutex.ReleaseLock();
+						disconnectSocket();
+						return -1;
+					}
+				} else {
+					bytesSent = (int) result;
+				}
+			}
+
+			if (bytesSent < dataSize) {
+				if ((int) sendBuffer.size() + dataSize - bytesSent > maxSocketSendBufferBytes) {
+					// the peer stopped reading a long time ago
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET send buffer full, queued = " MG_SIZE_T_SPECIFIER "\n", __FILE__, __FUNCTION__, __LINE__, sendBuffer.size());
+					safeMutex.ReleaseLock();
+					disconnectSocket();
+					return -1;
+				}
+				sendBuffer.insert(sendBuffer.end(), sendData + bytesSent, sendData + dataSize);
+			}
+			return dataSize;
+		}
+
+		int Socket::flushSendBuffer() {
+			MutexSafeWrapper safeMutex(dataSynchAccessorWrite, CODE_AT_LINE);
+			for (; sendBuffer.empty() == false && isSocketValid() == true;) {
+#ifdef __APPLE__
+				ssize_t bytesSent = ::send(sock, &sendBuffer[0], sendBuffer.size(), SO_NOSIGPIPE);
+#else
+				ssize_t bytesSent = ::send(sock, &sendBuffer[0], sendBuffer.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+#endif
+				if (bytesSent < 0) {
+					int lastSocketError = getLastSocketError();
+					if (lastSocketError == PLATFORM_SOCKET_TRY_AGAIN) {
+						break;
+					}
+					if (lastSocketError == PLATFORM_SOCKET_INTERRUPTED) {
+						continue;
+					}
+
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] DISCONNECTED SOCKET error while flushing send buffer, error = %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText(&lastSocketError).c_str());
+					safeMutex.ReleaseLock();
+					disconnectSocket();
+					return -1;
+				}
+				sendBuffer.erase(sendBuffer.begin(), sendBuffer.begin() + bytesSent);
+			}
+			return (int) sendBuffer.size();
+		}
+
+		bool Socket::hasPendingSend() {
+			MutexSafeWrapper safeMutex(dataSynchAccessorWrite, CODE_AT_LINE);
+			return (sendBuffer.empty() == false);
+		}
+
+		bool Socket::getReceiveIncomplete() {
+			MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
+			return receiveIncomplete;
+		}
+
+		void Socket::markReceive() {
+			if (isSocketBuffered == false) {
+				return;
+			}
+			MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
+			receiveBufferMark = receiveBufferStart;
+		}
+
+		void Socket::rewindReceive() {
+			MutexSafeWrapper safeMutex(dataSynchAccessorRead, CODE_AT_LINE);
+			receiveBufferStart = receiveBufferMark;
+		}
+
 		inline bool Socket::isReadable(bool lockMutex) {
 			if (isSocketValid() == false) return false;
 
@@ -1771,7 +2023,7 @@ namespace Shared {
 			safeMutex.ReleaseLock();
 
 			if (i < 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s] error while selecting socket data, err = %d, error = %s\n", __FILE__, __FUNCTION__, i, getLastSocketErrorFormattedText().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s] error while selecting socket data, err = %d, error = %s\n", __FILE__, __FUNCTION__, i, getLastSocketErrorFormattedText().c_str());
 				printf("In [%s::%s] Line: %d, ERROR SELECTING SOCKET DATA retval = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, i, getLastSocketErrorFormattedText().c_str());
 			}
 
@@ -1808,7 +2060,7 @@ namespace Shared {
 
 			bool result = false;
 			if (i < 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] error while selecting socket data, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, i, getLastSocketErrorFormattedText().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] error while selecting socket data, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, i, getLastSocketErrorFormattedText().c_str());
 
 				SystemFlags::OutputDebug(SystemFlags::debugError, "SOCKET DISCONNECTED In [%s::%s Line: %d] error while selecting socket data, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, i, getLastSocketErrorFormattedText().c_str());
 			} else if (i == 0) {
@@ -1830,6 +2082,12 @@ namespace Shared {
 		bool Socket::isConnected() {
 			if (isSocketValid() == false) return false;
 
+			// a peer that closed right after its last messages stays connected
+			// until those are read
+			if (isSocketBuffered == true && hasDataToRead() == true) {
+				return true;
+			}
+
 			//	MutexSafeWrapper safeMutexSocketDestructorFlag(&inSocketDestructorSynchAccessor,CODE_AT_LINE);
 			//	if(this->inSocketDestructor == true) {
 			//		SystemFlags::OutputDebug(SystemFlags::debugError,"In [%s::%s Line: %d] this->inSocketDestructor == true\n",__FILE__,__FUNCTION__,__LINE__);
@@ -1839,7 +2097,7 @@ namespace Shared {
 
 				//if the socket is not writable then it is not conencted
 			if (isWritable(NULL, true) == false) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR isWritable failed.\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR isWritable failed.\n", __FILE__, __FUNCTION__, __LINE__);
 				return false;
 			}
 			//if the socket is readable it is connected if we can read a byte from it
@@ -1857,10 +2115,10 @@ namespace Shared {
 					//printf("IsConnected socket has disconnected sock = %d err = %d lastSocketError = %d\n",sock,err,lastSocketError);
 					if (err == 0) {
 						printf("IsConnected socket has disconnected sock = %d err = %d lastSocketError = %d\n", sock, err, lastSocketError);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR Peek failed, err = %d for socket: %d, error = %s, lastSocketError = %d\n", __FILE__, __FUNCTION__, __LINE__, err, sock, getLastSocketErrorFormattedText().c_str(), lastSocketError);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR Peek failed, err = %d for socket: %d, error = %s, lastSocketError = %d\n", __FILE__, __FUNCTION__, __LINE__, err, sock, getLastSocketErrorFormattedText().c_str(), lastSocketError);
 					}
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR Peek failed, err = %d for socket: %d, error = %s, lastSocketError = %d\n", __FILE__, __FUNCTION__, __LINE__, err, sock, getLastSocketErrorFormattedText().c_str(), lastSocketError);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "[%s::%s Line: %d] ERROR Peek failed, err = %d for socket: %d, error = %s, lastSocketError = %d\n", __FILE__, __FUNCTION__, __LINE__, err, sock, getLastSocketErrorFormattedText().c_str(), lastSocketError);
 					if (SystemFlags::VERBOSE_MODE_ENABLED) SystemFlags::OutputDebug(SystemFlags::debugError, "SOCKET DISCONNECTED In [%s::%s Line: %d] ERROR Peek failed, err = %d for socket: %d, error = %s, lastSocketError = %d\n", __FILE__, __FUNCTION__, __LINE__, err, sock, getLastSocketErrorFormattedText().c_str(), lastSocketError);
 					return false;
 				}
@@ -1879,7 +2137,7 @@ namespace Shared {
 				if (result == 0) {
 					Socket::host_name = (hostname[0] != '\0' ? hostname : "");
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] result = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, result, getLastSocketErrorText());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] result = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, result, getLastSocketErrorText());
 				}
 			}
 			return Socket::host_name;
@@ -1916,46 +2174,46 @@ namespace Shared {
 		// ===============================================
 
 		ClientSocket::ClientSocket() : Socket() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			stopBroadCastClientThread();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		ClientSocket::~ClientSocket() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			stopBroadCastClientThread();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void ClientSocket::stopBroadCastClientThread() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			if (broadCastClientThread != NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				broadCastClientThread->shutdownAndWait();
 				delete broadCastClientThread;
 				broadCastClientThread = NULL;
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void ClientSocket::startBroadCastClientThread(DiscoveredServersInterface *cb) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			ClientSocket::stopBroadCastClientThread();
 
-			static string mutexOwnerId = string(extractFileFromDirectoryPath(__FILE__).c_str()) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			broadCastClientThread = new BroadCastClientSocketThread(cb);
 			broadCastClientThread->setUniqueID(mutexOwnerId);
 			broadCastClientThread->start();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void ClientSocket::discoverServers(DiscoveredServersInterface *cb) {
@@ -1970,13 +2228,13 @@ namespace Shared {
 			addr.sin_addr.s_addr = inet_addr(ip.getString().c_str());
 			addr.sin_port = htons(port);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Connecting to host [%s] on port = %d\n", ip.getString().c_str(), port);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Connecting to host [%s] on port = %d\n", ip.getString().c_str(), port);
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("Connecting to host [%s] on port = %d\n", ip.getString().c_str(), port);
 
 			connectedIpAddress = "";
 			int err = ::connect(sock, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr));
 			if (err < 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 Error connecting socket for IP: %s for Port: %d err = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, ip.getString().c_str(), port, err, getLastSocketErrorFormattedText().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] #2 Error connecting socket for IP: %s for Port: %d err = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, ip.getString().c_str(), port, err, getLastSocketErrorFormattedText().c_str());
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] #2 Error connecting socket for IP: %s for Port: %d err = %d error = %s\n", __FILE__, __FUNCTION__, __LINE__, ip.getString().c_str(), port, err, getLastSocketErrorFormattedText().c_str());
 
 				int lastSocketError = getLastSocketError();
@@ -1987,7 +2245,7 @@ namespace Shared {
 					int valopt = 0;
 					socklen_t lon = 0;
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] PLATFORM_SOCKET_INPROGRESS in connect() - selecting\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] PLATFORM_SOCKET_INPROGRESS in connect() - selecting\n", __FILE__, __FUNCTION__, __LINE__);
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] PLATFORM_SOCKET_INPROGRESS in connect() - selecting\n", __FILE__, __FUNCTION__, __LINE__);
 
 					do {
@@ -2005,7 +2263,7 @@ namespace Shared {
 						}
 
 						if (err < 0 && lastSocketError != PLATFORM_SOCKET_INTERRUPTED) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Error connecting %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText().c_str());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Error connecting %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText().c_str());
 							if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] Error connecting %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText().c_str());
 
 							break;
@@ -2019,24 +2277,24 @@ namespace Shared {
 							if (getsockopt(sock, SOL_SOCKET, SO_ERROR, (char *) (&valopt), &lon) < 0)
 #endif
 							{
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Error in getsockopt() %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText().c_str());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Error in getsockopt() %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText().c_str());
 								if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] Error in getsockopt() %s\n", __FILE__, __FUNCTION__, __LINE__, getLastSocketErrorFormattedText().c_str());
 								break;
 							}
 							// Check the value returned...
 							if (valopt) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Error in delayed connection() %d - [%s]\n", __FILE__, __FUNCTION__, __LINE__, valopt, strerror(valopt));
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Error in delayed connection() %d - [%s]\n", __FILE__, __FUNCTION__, __LINE__, valopt, strerror(valopt));
 								if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] Error in delayed connection() %d - [%s]\n", __FILE__, __FUNCTION__, __LINE__, valopt, strerror(valopt));
 								break;
 							}
 
 							errno = 0;
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Apparent recovery for connection sock = %d, err = %d\n", __FILE__, __FUNCTION__, __LINE__, sock, err);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Apparent recovery for connection sock = %d, err = %d\n", __FILE__, __FUNCTION__, __LINE__, sock, err);
 							if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] Apparent recovery for connection sock = " PLATFORM_SOCKET_FORMAT_TYPE ", err = %d\n", __FILE__, __FUNCTION__, __LINE__, sock, err);
 
 							break;
 						} else {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Timeout in select() - Cancelling!\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Timeout in select() - Cancelling!\n", __FILE__, __FUNCTION__, __LINE__);
 							if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] Timeout in select() - Cancelling!\n", __FILE__, __FUNCTION__, __LINE__);
 
 							disconnectSocket();
@@ -2046,16 +2304,16 @@ namespace Shared {
 				}
 
 				if (err < 0) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Before END sock = %d, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, getLastSocketErrorFormattedText().c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Before END sock = %d, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, getLastSocketErrorFormattedText().c_str());
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] Before END sock = " PLATFORM_SOCKET_FORMAT_TYPE ", err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, getLastSocketErrorFormattedText().c_str());
 					disconnectSocket();
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Valid recovery for connection sock = %d, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, getLastSocketErrorFormattedText().c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Valid recovery for connection sock = %d, err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, getLastSocketErrorFormattedText().c_str());
 					if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] Valid recovery for connection sock = " PLATFORM_SOCKET_FORMAT_TYPE ", err = %d, error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, err, getLastSocketErrorFormattedText().c_str());
 					connectedIpAddress = ip.getString();
 				}
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Connected to host [%s] on port = %d sock = %d err = %d", ip.getString().c_str(), port, sock, err);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Connected to host [%s] on port = %d sock = %d err = %d", ip.getString().c_str(), port, sock, err);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("Connected to host [%s] on port = %d sock = " PLATFORM_SOCKET_FORMAT_TYPE " err = %d", ip.getString().c_str(), port, sock, err);
 				connectedIpAddress = ip.getString();
 			}
@@ -2068,12 +2326,12 @@ namespace Shared {
 		//
 		BroadCastClientSocketThread::BroadCastClientSocketThread(DiscoveredServersInterface *cb) : BaseThread() {
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			discoveredServersCB = cb;
 			uniqueID = "BroadCastClientSocketThread";
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		//=======================================================================
@@ -2082,10 +2340,10 @@ namespace Shared {
 		//					the current broadcast message is <myhostname:my.ip.address.dotted>
 		//
 		void BroadCastClientSocketThread::execute() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			RunningStatusSafeWrapper runningStatus(this);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Broadcast Client thread is running\n");
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Broadcast Client thread is running\n");
 
 			std::vector<string> foundServers;
 
@@ -2101,7 +2359,7 @@ namespace Shared {
 			// Prepare to receive the broadcast.
 			bcfd = socket(AF_INET, SOCK_DGRAM, 0);
 			if (bcfd <= 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "socket failed: %s\n", Socket::getLastSocketErrorFormattedText().c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "socket failed: %s\n", Socket::getLastSocketErrorFormattedText().c_str());
 			} else {
 				// Create the address we are receiving on.
 				memset((char*) &bcaddr, 0, sizeof(bcaddr));
@@ -2116,13 +2374,13 @@ namespace Shared {
 				int opt_result = setsockopt(bcfd, SOL_SOCKET, SO_REUSEADDR, (char *) &val, sizeof(val));
 #endif
 				if (::bind(bcfd, (struct sockaddr *)&bcaddr, sizeof(bcaddr)) < 0) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "bind failed: %s opt_result = %d\n", Socket::getLastSocketErrorFormattedText().c_str(), opt_result);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "bind failed: %s opt_result = %d\n", Socket::getLastSocketErrorFormattedText().c_str(), opt_result);
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] opt_result = %d\n", __FILE__, __FUNCTION__, __LINE__, opt_result);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] opt_result = %d\n", __FILE__, __FUNCTION__, __LINE__, opt_result);
 
 					Socket::setBlock(false, bcfd);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 					try {
 						char buff[10025] = "";  // Buffers the data to be broadcasted.
@@ -2138,7 +2396,7 @@ namespace Shared {
 							//printf("Broadcasting client nb = %d buff [%s] gotData = %d\n",nb,buff,gotData);
 
 							if (gotData == false) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "recvfrom failed: %s\n", Socket::getLastSocketErrorFormattedText().c_str());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "recvfrom failed: %s\n", Socket::getLastSocketErrorFormattedText().c_str());
 							} else {
 								//string fromIP = inet_ntoa(bcSender.sin_addr);
 								char szHostFrom[100] = "";
@@ -2146,9 +2404,9 @@ namespace Shared {
 								//printf("Client szHostFrom [%s]\n",szHostFrom);
 
 								string fromIP = szHostFrom;
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "broadcast message received: [%s] from: [%s]\n", buff, fromIP.c_str());
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "broadcast message received: [%s] from: [%s]\n", buff, fromIP.c_str());
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Client got broadcast from server: [%s] data [%s]\n", fromIP.c_str(), buff);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Client got broadcast from server: [%s] data [%s]\n", fromIP.c_str(), buff);
 
 								int serverGamePort = Socket::getBroadCastPort();
 								vector<string> paramPartPortsTokens;
@@ -2166,21 +2424,21 @@ namespace Shared {
 							}
 
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								break;
 							}
 							sleep(100); // send out broadcast every 1 seconds
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								break;
 							}
 						}
 					} catch (const exception &ex) {
 						SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
 					} catch (...) {
 						SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", __FILE__, __FUNCTION__, __LINE__);
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] unknown error\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] unknown error\n", __FILE__, __FUNCTION__, __LINE__);
 					}
 				}
 			}
@@ -2193,15 +2451,15 @@ namespace Shared {
 			bcfd = INVALID_SOCKET;
 #endif
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			// Here we callback into the implementer class
 			if (getQuitStatus() == false && discoveredServersCB != NULL) {
 				discoveredServersCB->DiscoveredServers(foundServers);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Broadcast Client thread is exiting\n");
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Broadcast Client thread is exiting\n");
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		// ===============================================
@@ -2209,7 +2467,7 @@ namespace Shared {
 		// ===============================================
 
 		ServerSocket::ServerSocket(bool basicMode) : Socket() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] basicMode = %d\n", __FILE__, __FUNCTION__, __LINE__, basicMode);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] basicMode = %d\n", __FILE__, __FUNCTION__, __LINE__, basicMode);
 
 			this->basicMode = basicMode;
 			this->bindSpecificAddress = "";
@@ -2222,11 +2480,11 @@ namespace Shared {
 				UPNP_Tools::enabledUPNP = false;
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		ServerSocket::~ServerSocket() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//printf("In [%s::%s] Line: %d UPNP_Tools::enabledUPNP = %d\n",__FILE__,__FUNCTION__,__LINE__,UPNP_Tools::enabledUPNP);
 
@@ -2251,29 +2509,29 @@ namespace Shared {
 					FreeUPNPUrls(&urls);
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				safeMutexUPNP1.ReleaseLock();
 			}
 		}
 
 		void ServerSocket::stopBroadCastThread() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			//printf("Stopping broadcast thread [%p]\n",broadCastThread);
 
 			if (broadCastThread != NULL) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				//printf("Stopping broadcast thread [%p] - A\n",broadCastThread);
 
 				if (broadCastThread->canShutdown(false) == true) {
 					sleep(0);
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				//printf("Stopping broadcast thread [%p] - B\n",broadCastThread);
 
 				if (broadCastThread->shutdownAndWait() == true) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 					delete broadCastThread;
 
 					//printf("Stopping broadcast thread [%p] - C\n",broadCastThread);
@@ -2281,14 +2539,14 @@ namespace Shared {
 				broadCastThread = NULL;
 				//printf("Stopping broadcast thread [%p] - D\n",broadCastThread);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void ServerSocket::startBroadCastThread() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			stopBroadCastThread();
 
@@ -2296,11 +2554,11 @@ namespace Shared {
 
 			//printf("Start broadcast thread [%p]\n",broadCastThread);
 
-			static string mutexOwnerId = string(extractFileFromDirectoryPath(__FILE__).c_str()) + string("_") + intToStr(__LINE__);
+			static const char *mutexOwnerId = CODE_AT_LINE;
 			broadCastThread->setUniqueID(mutexOwnerId);
 			broadCastThread->start();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		void ServerSocket::resumeBroadcast() {
@@ -2315,17 +2573,17 @@ namespace Shared {
 		}
 
 		bool ServerSocket::isBroadCastThreadRunning() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			bool isThreadRunning = (broadCastThread != NULL && broadCastThread->getRunningStatus() == true);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] isThreadRunning = %d\n", __FILE__, __FUNCTION__, __LINE__, isThreadRunning);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] isThreadRunning = %d\n", __FILE__, __FUNCTION__, __LINE__, isThreadRunning);
 
 			return isThreadRunning;
 		}
 
 		void ServerSocket::bind(int port) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d port = %d, portBound = %d START\n", __FILE__, __FUNCTION__, __LINE__, port, portBound);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d port = %d, portBound = %d START\n", __FILE__, __FUNCTION__, __LINE__, port, portBound);
 
 			boundPort = port;
 
@@ -2360,14 +2618,14 @@ namespace Shared {
 			if (err < 0) {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096, "In [%s::%s] Error binding socket sock = " PLATFORM_SOCKET_FORMAT_TYPE ", address [%s] port = %d err = %d, error = %s opt_result = %d\n", __FILE__, __FUNCTION__, sock, this->bindSpecificAddress.c_str(), port, err, getLastSocketErrorFormattedText().c_str(), opt_result);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "%s", szBuf);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "%s", szBuf);
 
 				snprintf(szBuf, 8096, "Error binding socket sock = " PLATFORM_SOCKET_FORMAT_TYPE ", address [%s] port = %d err = %d, error = %s\n", sock, this->bindSpecificAddress.c_str(), port, err, getLastSocketErrorFormattedText().c_str());
 				throw megaglest_runtime_error(szBuf);
 			}
 			portBound = true;
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d port = %d, portBound = %d END\n", __FILE__, __FUNCTION__, __LINE__, port, portBound);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d port = %d, portBound = %d END\n", __FILE__, __FUNCTION__, __LINE__, port, portBound);
 		}
 
 		void ServerSocket::disconnectSocket() {
@@ -2376,11 +2634,11 @@ namespace Shared {
 		}
 
 		void ServerSocket::listen(int connectionQueueSize) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d connectionQueueSize = %d\n", __FILE__, __FUNCTION__, __LINE__, connectionQueueSize);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s] Line: %d connectionQueueSize = %d\n", __FILE__, __FUNCTION__, __LINE__, connectionQueueSize);
 
 			if (connectionQueueSize > 0) {
 				if (isSocketValid() == false) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 					sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
 					if (isSocketValid() == false) {
@@ -2400,7 +2658,7 @@ namespace Shared {
 					throwException(szBuf);
 				}
 			} else {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				disconnectSocket();
 			}
 
@@ -2440,7 +2698,7 @@ namespace Shared {
 			if (isSocketValid(&newSock) == false) {
 				char szBuf[8096] = "";
 				snprintf(szBuf, 8096, "In [%s::%s Line: %d] Error accepting socket connection sock = " PLATFORM_SOCKET_FORMAT_TYPE ", err = " PLATFORM_SOCKET_FORMAT_TYPE ", error = %s\n", __FILE__, __FUNCTION__, __LINE__, sock, newSock, getLastSocketErrorFormattedText().c_str());
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, szBuf);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] %s\n", __FILE__, __FUNCTION__, __LINE__, szBuf);
 
 				int lastSocketError = getLastSocketError();
 				if (lastSocketError == PLATFORM_SOCKET_TRY_AGAIN) {
@@ -2467,10 +2725,10 @@ namespace Shared {
 
 			} else {
 				Ip::Inet_NtoA(SockAddrToUint32((struct sockaddr *)&cli_addr), client_host);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got connection, newSock = %d client_host [%s]\n", __FILE__, __FUNCTION__, __LINE__, newSock, client_host);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] got connection, newSock = %d client_host [%s]\n", __FILE__, __FUNCTION__, __LINE__, newSock, client_host);
 			}
 			if (isIPAddressBlocked((client_host[0] != '\0' ? client_host : "")) == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] BLOCKING connection, newSock = %d client_host [%s]\n", __FILE__, __FUNCTION__, __LINE__, newSock, client_host);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] BLOCKING connection, newSock = %d client_host [%s]\n", __FILE__, __FUNCTION__, __LINE__, newSock, client_host);
 
 #ifndef WIN32
 				::close(newSock);
@@ -2491,7 +2749,7 @@ namespace Shared {
 		}
 
 		void ServerSocket::NETdiscoverUPnPDevices() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] UPNP - Start\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] UPNP - Start\n", __FILE__, __FUNCTION__, __LINE__);
 
 			MutexSafeWrapper safeMutexUPNP(&ServerSocket::mutexUpnpdiscoverThread, CODE_AT_LINE);
 			if (ServerSocket::upnpdiscoverThread != NULL) {
@@ -2512,7 +2770,7 @@ namespace Shared {
 		}
 
 		void ServerSocket::UPNPInitStatus(bool result) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] result = %d\n", __FILE__, __FUNCTION__, __LINE__, result);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] result = %d\n", __FILE__, __FUNCTION__, __LINE__, result);
 
 			if (result == true) {
 				//int ports[4] = { this->getExternalPort(), this->getBindPort(), this->getFTPServerPort(), this->getFTPServerPort() };
@@ -2540,7 +2798,7 @@ namespace Shared {
 		// UPNP Tools Start
 		//
 		void UPNP_Tools::AddUPNPPortForward(int internalPort, int externalPort) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] internalPort = %d, externalPort = %d\n", __FILE__, __FUNCTION__, __LINE__, internalPort, externalPort);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] internalPort = %d, externalPort = %d\n", __FILE__, __FUNCTION__, __LINE__, internalPort, externalPort);
 
 			bool addPorts = (UPNP_Tools::enabledUPNP == true);
 			if (addPorts == false) {
@@ -2548,7 +2806,7 @@ namespace Shared {
 				addPorts = (result != 0);
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] internalPort = %d, externalPort = %d, addPorts = %d\n", __FILE__, __FUNCTION__, __LINE__, internalPort, externalPort, addPorts);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] internalPort = %d, externalPort = %d, addPorts = %d\n", __FILE__, __FUNCTION__, __LINE__, internalPort, externalPort, addPorts);
 
 			if (addPorts == true) {
 				int ports[2] = { externalPort, internalPort };
@@ -2576,10 +2834,10 @@ namespace Shared {
 			memset(&urls, 0, sizeof(struct UPNPUrls));
 			memset(&data, 0, sizeof(struct IGDdatas));
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] isUPNP = %d callback = %p\n", __FILE__, __FUNCTION__, __LINE__, UPNP_Tools::isUPNP, callback);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] isUPNP = %d callback = %p\n", __FILE__, __FUNCTION__, __LINE__, UPNP_Tools::isUPNP, callback);
 
 			if (UPNP_Tools::isUPNP == true) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Searching for UPnP devices for automatic port forwarding...\n");
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Searching for UPnP devices for automatic port forwarding...\n");
 
 				int upnp_delay = 5000;
 				const char *upnp_multicastif = NULL;
@@ -2595,13 +2853,13 @@ namespace Shared {
 				// miniupnpc 1.9.20150730
 				devlist = upnpDiscover(upnp_delay, upnp_multicastif, upnp_minissdpdsock, upnp_sameport, upnp_ipv6, 2, &upnp_error);
 #endif
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP discover returned upnp_error = %d.\n", upnp_error);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP discover returned upnp_error = %d.\n", upnp_error);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("UPnP discover returned upnp_error = %d.\n", upnp_error);
 
 #else
 				devlist = upnpDiscover(upnp_delay, upnp_multicastif, upnp_minissdpdsock, upnp_sameport);
 #endif
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP device search finished devlist = %p.\n", devlist);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP device search finished devlist = %p.\n", devlist);
 				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("UPnP device search finished devlist = %p.\n", devlist);
 
 				if (ServerSocket::cancelUpnpdiscoverThread == true) {
@@ -2615,7 +2873,7 @@ namespace Shared {
 				if (devlist) {
 					dev = devlist;
 					while (dev) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP discover deviceList [%s].\n", (dev->st ? dev->st : "null"));
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP discover deviceList [%s].\n", (dev->st ? dev->st : "null"));
 						if (SystemFlags::VERBOSE_MODE_ENABLED) printf("UPnP discover deviceList [%s].\n", (dev->st ? dev->st : "null"));
 
 						dev = dev->pNext;
@@ -2633,7 +2891,7 @@ namespace Shared {
 					}
 
 					if (dev != NULL) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP device found: %s %s\n", dev->descURL, dev->st);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP device found: %s %s\n", dev->descURL, dev->st);
 						if (SystemFlags::VERBOSE_MODE_ENABLED) printf("UPnP device found: %s %s\n", dev->descURL, dev->st);
 
 						//printf("UPnP device found: [%s] [%s] lanaddr [%s]\n", dev->descURL, dev->st,lanaddr);
@@ -2644,7 +2902,7 @@ namespace Shared {
 #else
 						char *descXML = (char *) miniwget_getaddr(dev->descURL, &descXMLsize, lanaddr, (sizeof(lanaddr) / sizeof(lanaddr[0])));
 #endif
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "LAN address: %s\n", lanaddr);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "LAN address: %s\n", lanaddr);
 
 						if (descXML) {
 							parserootdesc(descXML, descXMLsize, &data);
@@ -2684,15 +2942,15 @@ namespace Shared {
 #else
 						UPNP_GetExternalIPAddress(urls.controlURL, data.servicetype, externalIP);
 #endif
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP device found at: [%s] callback [%p]\n", externalIP, callback);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP device found at: [%s] callback [%p]\n", externalIP, callback);
 
 						//UPNP_Tools::NETaddRedirects(ports);
 						UPNP_Tools::enabledUPNP = true;
 						if (callback) {
 							safeMutexUPNP.ReleaseLock();
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							callback->UPNPInitStatus(true);
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						}
 						result = 1;
 					}
@@ -2701,7 +2959,7 @@ namespace Shared {
 				if (result == -1) {
 					snprintf(buf, 255, "UPnP device not found.");
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "No UPnP devices found.\n");
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "No UPnP devices found.\n");
 
 					if (ServerSocket::cancelUpnpdiscoverThread == true) {
 						//if(devlist != NULL) {
@@ -2719,7 +2977,7 @@ namespace Shared {
 				}
 			} else {
 				snprintf(buf, 255, "UPnP detection routine disabled by user.");
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP detection routine disabled by user.\n");
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UPnP detection routine disabled by user.\n");
 
 				if (ServerSocket::cancelUpnpdiscoverThread == true) {
 					//if(devlist != NULL) {
@@ -2745,7 +3003,7 @@ namespace Shared {
 			bool result = true;
 
 			//printf("SERVER SOCKET upnp_add_redirect - START\n");
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] upnp_add_redir(%d : %d)\n", __FILE__, __FUNCTION__, __LINE__, ports[0], ports[1]);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] upnp_add_redir(%d : %d)\n", __FILE__, __FUNCTION__, __LINE__, ports[0], ports[1]);
 
 			if (mutexLock) {
 				MutexSafeWrapper safeMutexUPNP(&ServerSocket::mutexUpnpdiscoverThread, CODE_AT_LINE);
@@ -2785,11 +3043,11 @@ namespace Shared {
 				int r = UPNP_AddPortMapping(urls.controlURL, data.servicetype, ext_port_str, int_port_str, lanaddr, "ZetaGlest - zetaglest.github.io", "TCP", 0);
 #endif
 				if (r != UPNPCOMMAND_SUCCESS) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] AddPortMapping(%s, %s, %s) failed\n", __FILE__, __FUNCTION__, __LINE__, ext_port_str, int_port_str, lanaddr);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] AddPortMapping(%s, %s, %s) failed\n", __FILE__, __FUNCTION__, __LINE__, ext_port_str, int_port_str, lanaddr);
 					result = false;
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] AddPortMapping(%s, %s, %s) success\n", __FILE__, __FUNCTION__, __LINE__, ext_port_str, int_port_str, lanaddr);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] AddPortMapping(%s, %s, %s) success\n", __FILE__, __FUNCTION__, __LINE__, ext_port_str, int_port_str, lanaddr);
 			}
 
 			//printf("SERVER SOCKET upnp_add_redirect - END [%d]\n",result);
@@ -2797,7 +3055,7 @@ namespace Shared {
 		}
 
 		void UPNP_Tools::upnp_rem_redirect(int ext_port) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] upnp_rem_redir(%d)\n", __FILE__, __FUNCTION__, __LINE__, ext_port);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] upnp_rem_redir(%d)\n", __FILE__, __FUNCTION__, __LINE__, ext_port);
 
 			MutexSafeWrapper safeMutexUPNP(&ServerSocket::mutexUpnpdiscoverThread, CODE_AT_LINE);
 			if (ServerSocket::upnpdiscoverThread != NULL) {
@@ -2832,7 +3090,7 @@ namespace Shared {
 		}
 
 		void UPNP_Tools::NETaddRedirects(std::vector<int> UPNPPortForwardList, bool mutexLock) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] upnp_rem_redir(%d)\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] upnp_rem_redir(%d)\n", __FILE__, __FUNCTION__, __LINE__);
 
 			if (UPNPPortForwardList.size() % 2 != 0) {
 				// We need groups of 2 ports.. one external and one internal for opening ports on UPNP router
@@ -2846,7 +3104,7 @@ namespace Shared {
 		}
 
 		void UPNP_Tools::NETremRedirects(int ext_port) {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] upnp_rem_redir(%d)\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] upnp_rem_redir(%d)\n", __FILE__, __FUNCTION__, __LINE__);
 			upnp_rem_redirect(ext_port);
 		}
 		//
@@ -2861,7 +3119,7 @@ namespace Shared {
 		//					the current broadcast message is <myhostname:my.ip.address.dotted>
 		//
 		BroadCastSocketThread::BroadCastSocketThread(int boundPort) : BaseThread() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			mutexPauseBroadcast = new Mutex(CODE_AT_LINE);
 			setPauseBroadcast(false);
 			this->boundPort = boundPort;
@@ -2901,12 +3159,12 @@ namespace Shared {
 		}
 
 		void BroadCastSocketThread::execute() {
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			//setRunningStatus(true);
 			RunningStatusSafeWrapper runningStatus(this);
 			ExecutingTaskSafeWrapper safeExecutingTaskMutex(this);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Broadcast thread is running\n");
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Broadcast thread is running\n");
 
 			const int MAX_NIC_COUNT = 10;
 			short port = 0;                 // The port for the broadcast.
@@ -2943,7 +3201,7 @@ namespace Shared {
 				for (unsigned int idx = 0; idx < (unsigned int) ipList.size() && idx < (unsigned int) MAX_NIC_COUNT; idx++) {
 					string broadCastAddress = getNetworkInterfaceBroadcastAddress(ipList[idx]);
 					//printf("idx = %d broadCastAddress [%s]\n",idx,broadCastAddress.c_str());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "idx = %d broadCastAddress [%s]\n", idx, broadCastAddress.c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "idx = %d broadCastAddress [%s]\n", idx, broadCastAddress.c_str());
 
 					//strcpy(subnetmask[idx], broadCastAddress.c_str());
 					if (broadCastAddress != "" && std::find(ipSubnetMaskList.begin(), ipSubnetMaskList.end(), broadCastAddress) == ipSubnetMaskList.end()) {
@@ -2954,7 +3212,7 @@ namespace Shared {
 				}
 			} else {
 				//printf("NO Addresses found for broadCastAddress using INADDR_ANY\n");
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "NO Addresses found for broadCastAddress using INADDR_ANY\n");
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "NO Addresses found for broadCastAddress using INADDR_ANY\n");
 				//ipSubnetMaskList.push_back(INADDR_ANY);
 				ipSubnetMaskList.push_back("*");
 			}
@@ -2968,10 +3226,10 @@ namespace Shared {
 				bcLocal[idx].sin_family = AF_INET;
 				if (ipSubnetMaskList[idx] == "*") {
 					//printf("UDP Socket broadcast using INADDR_ANY\n");
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UDP Socket broadcast using INADDR_ANY\n");
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UDP Socket broadcast using INADDR_ANY\n");
 					bcLocal[idx].sin_addr.s_addr = INADDR_ANY;
 				} else {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UDP Socket broadcast using IP [%s]\n", ipSubnetMaskList[idx].c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "UDP Socket broadcast using IP [%s]\n", ipSubnetMaskList[idx].c_str());
 					bcLocal[idx].sin_addr.s_addr = inet_addr(ipSubnetMaskList[idx].c_str()); //htonl( INADDR_BROADCAST );
 				}
 				bcLocal[idx].sin_port = port;  // We are letting the OS fill in the port number for the local machine.
@@ -2984,22 +3242,22 @@ namespace Shared {
 				bcfd[idx] = socket(AF_INET, SOCK_DGRAM, 0);
 
 				if (bcfd[idx] <= 0) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Unable to allocate broadcast socket [%s]: %s\n", ipSubnetMaskList[idx].c_str(), Socket::getLastSocketErrorFormattedText().c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Unable to allocate broadcast socket [%s]: %s\n", ipSubnetMaskList[idx].c_str(), Socket::getLastSocketErrorFormattedText().c_str());
 					//printf("Unable to allocate broadcast socket [%s]: %s\n", ipSubnetMaskList[idx].c_str(), Socket::getLastSocketErrorFormattedText().c_str());
 					//exit(-1);
 				}
 				// Mark the socket for broadcast.
 				else if (setsockopt(bcfd[idx], SOL_SOCKET, SO_BROADCAST, (const char *) &one, sizeof(int)) < 0) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Could not set socket to broadcast [%s]: %s\n", ipSubnetMaskList[idx].c_str(), Socket::getLastSocketErrorFormattedText().c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Could not set socket to broadcast [%s]: %s\n", ipSubnetMaskList[idx].c_str(), Socket::getLastSocketErrorFormattedText().c_str());
 					//printf("Could not set socket to broadcast [%s]: %s\n", ipSubnetMaskList[idx].c_str(), Socket::getLastSocketErrorFormattedText().c_str());
 					//exit(-1);
 				}
 				//}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] setting up broadcast on address [%s]\n", __FILE__, __FUNCTION__, __LINE__, ipSubnetMaskList[idx].c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] setting up broadcast on address [%s]\n", __FILE__, __FUNCTION__, __LINE__, ipSubnetMaskList[idx].c_str());
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			time_t elapsed = 0;
 			for (pn = 1; getQuitStatus() == false; pn++) {
@@ -3031,44 +3289,44 @@ namespace Shared {
 									// Broadcast the packet to the subnet
 									//if( sendto( bcfd, buff, sizeof(buff) + 1, 0 , (struct sockaddr *)&bcaddr, sizeof(struct sockaddr_in) ) != sizeof(buff) + 1 )
 
-									if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Server is sending broadcast data [%s]\n", buff);
+									if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Server is sending broadcast data [%s]\n", buff);
 									//printf("Broadcasting index host info [%s]\n", buff);
 
 									ssize_t send_res = sendto(bcfd[idx], buff, buffMaxSize, 0, (struct sockaddr *)&bcLocal[idx], sizeof(struct sockaddr_in));
 									if (send_res != buffMaxSize) {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Sendto error: %s\n", Socket::getLastSocketErrorFormattedText().c_str());
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Sendto error: %s\n", Socket::getLastSocketErrorFormattedText().c_str());
 									} else {
-										if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Broadcasting on port [%d] the message: [%s]\n", Socket::getBroadCastPort(), buff);
+										if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "Broadcasting on port [%d] the message: [%s]\n", Socket::getBroadCastPort(), buff);
 									}
 								}
 								//printf("Broadcasting server send_res = %d buff [%s] ip [%s] getPauseBroadcast() = %d\n",send_res,buff,ipSubnetMaskList[idx].c_str(),pauseBroadCast);
 
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 							}
 
 							if (getQuitStatus() == true) {
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 								break;
 							}
 							sleep(100); // send out broadcast every 1 seconds
 						} catch (const exception &ex) {
 							SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
 							this->setQuitStatus(true);
 						} catch (...) {
 							SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", __FILE__, __FUNCTION__, __LINE__);
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] unknown error\n", __FILE__, __FUNCTION__, __LINE__);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] unknown error\n", __FILE__, __FUNCTION__, __LINE__);
 							this->setQuitStatus(true);
 						}
 					}
 
 					if (getQuitStatus() == true) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 						break;
 					}
 				}
 				if (getQuitStatus() == true) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 					break;
 				}
 			}
@@ -3085,7 +3343,7 @@ namespace Shared {
 				}
 			}
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugNetwork).enabled) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Broadcast thread is exiting\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] Broadcast thread is exiting\n", __FILE__, __FUNCTION__, __LINE__);
 		}
 
 		double Socket::getAveragePingMS(std::string host, int pingCount) {
@@ -3201,7 +3459,7 @@ namespace Shared {
 		void ServerSocket::addIPAddressToBlockedList(string value) {
 			if (isIPAddressBlocked(value) == false) {
 				blockIPList.push_back(value);
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Blocked IP Address [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, value.c_str());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Blocked IP Address [%s].\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, value.c_str());
 			}
 		}
 		bool ServerSocket::isIPAddressBlocked(string value) const {
@@ -0,0 +1,329 @@
+//      socket_reactor.cpp:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "socket_reactor.h"
+
+#include <cstring>
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+#include "conversion.h"
+#include "util.h"
+#include "platform_util.h"
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::Util;
+
+namespace Shared {
+	namespace Platform {
+
+		// =====================================================
+		//	class SocketReactor
+		// =====================================================
+
+#if defined(__linux__)
+		static const int maxReactorEvents = 64;
+#endif
+
+		SocketReactor::SocketReactor() {
+			mutex = new Mutex(CODE_AT_LINE);
+
+#if defined(__linux__)
+			epollId = epoll_create1(EPOLL_CLOEXEC);
+			if (epollId < 0) {
+				int errorCode = errno;
+				delete mutex;
+				mutex = NULL;
+				throw megaglest_runtime_error("epoll_create1 failed, error: " + intToStr(errorCode) + " [" + strerror(errorCode) + "]");
+			}
+			wakeupId = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+			if (wakeupId >= 0) {
+				struct epoll_event event;
+				memset(&event, 0, sizeof(event));
+				event.events = EPOLLIN;
+				event.data.fd = wakeupId;
+				if (epoll_ctl(epollId, EPOLL_CTL_ADD, wakeupId, &event) != 0) {
+					close(wakeupId);
+					wakeupId = -1;
+				}
+			}
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] epollId = %d wakeupId = %d\n", __FILE__, __FUNCTION__, __LINE__, epollId, wakeupId);
+#endif
+		}
+
+		SocketReactor::~SocketReactor() {
+#if defined(__linux__)
+			if (wakeupId >= 0) {
+				close(wakeupId);
+				wakeupId = -1;
+			}
+			if (epollId >= 0) {
+				close(epollId);
+				epollId = -1;
+			}
+#endif
+			delete mutex;
+			mutex = NULL;
+		}
+
+		bool SocketReactor::isEdgeTriggered() {
+#if defined(__linux__)
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		void SocketReactor::addSocket(PLATFORM_SOCKET socket, int userId) {
+			if (Socket::isSocketValid(&socket) == false) {
+				return;
+			}
+
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+#if defined(__linux__)
+			struct epoll_event event;
+			memset(&event, 0, sizeof(event));
+			// edge triggered EPOLLOUT only fires once a full send buffer has
+			// room again, so it costs nothing while sends go straight through
+			event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+			event.data.fd = socket;
+			// a closed descriptor leaves the epoll set on its own, so the same
+			// number may come back either registered or not
+			int result = epoll_ctl(epollId, EPOLL_CTL_ADD, socket, &event);
+			if (result != 0 && errno == EEXIST) {
+				result = epoll_ctl(epollId, EPOLL_CTL_MOD, socket, &event);
+			}
+			if (result != 0) {
+				int errorCode = errno;
+				throw megaglest_runtime_error("epoll_ctl failed for socket: " + intToStr(socket) + " error: " + intToStr(errorCode) + " [" + strerror(errorCode) + "]");
+			}
+#endif
+			Entry entry;
+			entry.userId = userId;
+			// data that arrived before registration raised no edge
+			entry.readPending = true;
+			entries[socket] = entry;
+		}
+
+		void SocketReactor::removeSocket(PLATFORM_SOCKET socket) {
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			std::map<PLATFORM_SOCKET, Entry>::iterator iterFind = entries.find(socket);
+			if (iterFind == entries.end()) {
+				return;
+			}
+			entries.erase(iterFind);
+
+#if defined(__linux__)
+			// the socket may already be closed (EBADF) or closed and reused
+			// (ENOENT), neither is an error here
+			struct epoll_event event;
+			memset(&event, 0, sizeof(event));
+			epoll_ctl(epollId, EPOLL_CTL_DEL, socket, &event);
+#endif
+		}
+
+		bool SocketReactor::hasSocket(PLATFORM_SOCKET socket) {
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			return entries.find(socket) != entries.end();
+		}
+
+		int SocketReactor::getSocketCount() {
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			return (int) entries.size();
+		}
+
+		void SocketReactor::setReadPending(PLATFORM_SOCKET socket, bool value) {
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			std::map<PLATFORM_SOCKET, Entry>::iterator iterFind = entries.find(socket);
+			if (iterFind != entries.end()) {
+				iterFind->second.readPending = value;
+			}
+		}
+
+		void SocketReactor::setWantWrite(PLATFORM_SOCKET socket, bool value) {
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			std::map<PLATFORM_SOCKET, Entry>::iterator iterFind = entries.find(socket);
+			if (iterFind != entries.end()) {
+				iterFind->second.wantWrite = value;
+			}
+		}
+
+		void SocketReactor::wakeup() {
+#if defined(__linux__)
+			if (wakeupId >= 0) {
+				uint64 value = 1;
+				ssize_t bytes = write(wakeupId, &value, sizeof(value));
+				if (bytes != sizeof(value) && DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] wakeup write failed\n", __FILE__, __FUNCTION__, __LINE__);
+			}
+#endif
+		}
+
+		bool SocketReactor::hasPendingEvents() {
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			for (std::map<PLATFORM_SOCKET, Entry>::iterator iterMap = entries.begin();
+				iterMap != entries.end(); ++iterMap) {
+				if (iterMap->second.readPending == true || iterMap->second.writePending == true) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+#if defined(__linux__)
+		void SocketReactor::waitForReadiness(int waitMilliseconds) {
+			struct epoll_event events[maxReactorEvents];
+			int eventCount = epoll_wait(epollId, events, maxReactorEvents, waitMilliseconds);
+			if (eventCount < 0) {
+				if (errno != EINTR && DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] epoll_wait error = %s\n", __FILE__, __FUNCTION__, __LINE__, strerror(errno));
+				return;
+			}
+
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			for (int index = 0; index < eventCount; ++index) {
+				if (events[index].data.fd == wakeupId) {
+					uint64 value = 0;
+					ssize_t bytes = read(wakeupId, &value, sizeof(value));
+					if (bytes != sizeof(value) && DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] wakeup read failed\n", __FILE__, __FUNCTION__, __LINE__);
+					continue;
+				}
+
+				std::map<PLATFORM_SOCKET, Entry>::iterator iterFind = entries.find(events[index].data.fd);
+				if (iterFind == entries.end()) {
+					continue;
+				}
+				// hangups and errors are reported as readable so the
+				// reader runs into them and closes the connection
+				if ((events[index].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) != 0) {
+					iterFind->second.readPending = true;
+				}
+				if ((events[index].events & EPOLLOUT) != 0) {
+					iterFind->second.writePending = true;
+				}
+			}
+		}
+#else
+		void SocketReactor::waitForReadiness(int waitMilliseconds) {
+			fd_set rfds;
+			FD_ZERO(&rfds);
+			fd_set wfds;
+			FD_ZERO(&wfds);
+
+			PLATFORM_SOCKET maxSocket = 0;
+			int socketCount = 0;
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			for (std::map<PLATFORM_SOCKET, Entry>::iterator iterMap = entries.begin();
+				iterMap != entries.end(); ++iterMap) {
+				PLATFORM_SOCKET socket = iterMap->first;
+				if (Socket::isSocketValid(&socket) == true) {
+					FD_SET(socket, &rfds);
+					if (iterMap->second.wantWrite == true) {
+						FD_SET(socket, &wfds);
+					}
+					maxSocket = std::max(maxSocket, socket);
+					socketCount++;
+				}
+			}
+			safeMutex.ReleaseLock();
+
+			if (socketCount == 0) {
+				if (waitMilliseconds > 0) {
+					sleep(waitMilliseconds);
+				}
+				return;
+			}
+
+			struct timeval tv;
+			tv.tv_sec = waitMilliseconds / 1000;
+			tv.tv_usec = (waitMilliseconds % 1000) * 1000;
+
+			int retval = select((int) maxSocket + 1, &rfds, &wfds, NULL, &tv);
+			if (retval < 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugNetwork)) SystemFlags::OutputDebug(SystemFlags::debugNetwork, "In [%s::%s Line: %d] select error = %s\n", __FILE__, __FUNCTION__, __LINE__, Socket::getLastSocketErrorFormattedText().c_str());
+				return;
+			}
+			if (retval == 0) {
+				return;
+			}
+
+			safeMutex.Lock();
+			for (std::map<PLATFORM_SOCKET, Entry>::iterator iterMap = entries.begin();
+				iterMap != entries.end(); ++iterMap) {
+				PLATFORM_SOCKET socket = iterMap->first;
+				if (Socket::isSocketValid(&socket) == false) {
+					continue;
+				}
+				if (FD_ISSET(socket, &rfds)) {
+					iterMap->second.readPending = true;
+				}
+				if (FD_ISSET(socket, &wfds)) {
+					iterMap->second.writePending = true;
+				}
+			}
+		}
+#endif
+
+		int SocketReactor::waitForEvents(int waitMilliseconds, SocketReactorEventInterface *callback) {
+			// don't block while something is still waiting to be consumed
+			waitForReadiness(hasPendingEvents() == true ? 0 : waitMilliseconds);
+
+			std::vector<ReadyEvent> readyEvents;
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
+			for (std::map<PLATFORM_SOCKET, Entry>::iterator iterMap = entries.begin();
+				iterMap != entries.end(); ++iterMap) {
+				Entry &entry = iterMap->second;
+				if (entry.readPending == true || entry.writePending == true) {
+					ReadyEvent readyEvent;
+					readyEvent.socket = iterMap->first;
+					readyEvent.userId = entry.userId;
+					readyEvent.read = entry.readPending;
+					readyEvent.write = entry.writePending;
+					readyEvents.push_back(readyEvent);
+
+					entry.readPending = false;
+					entry.writePending = false;
+				}
+			}
+			safeMutex.ReleaseLock();
+
+			if (callback != NULL) {
+				for (unsigned int index = 0; index < readyEvents.size(); ++index) {
+					const ReadyEvent &readyEvent = readyEvents[index];
+					if (readyEvent.read == true) {
+						callback->socketReadReady(readyEvent.socket, readyEvent.userId);
+					}
+				}
+				for (unsigned int index = 0; index < readyEvents.size(); ++index) {
+					const ReadyEvent &readyEvent = readyEvents[index];
+					if (readyEvent.write == true) {
+						callback->socketWriteReady(readyEvent.socket, readyEvent.userId);
+					}
+				}
+			}
+			return (int) readyEvents.size();
+		}
+
+	}
+}//end namespace
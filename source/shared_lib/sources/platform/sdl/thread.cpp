@@ -14,9 +14,12 @@
 #include <assert.h>
 #include "noimpl.h"
 #include <algorithm>
+#include <map>
+#include <set>
 #include "platform_util.h"
 #include "platform_common.h"
 #include "base_thread.h"
+#include "profiler.h"
 #include "time.h"
 
 using namespace std;
@@ -45,7 +48,7 @@ namespace Shared {
 			vector<Thread *> pendingCleanupList;
 
 			bool cleanupPendingThreads() {
-				MutexSafeWrapper safeMutex(&mutexPendingCleanupList);
+				MutexSafeWrapper safeMutex(&mutexPendingCleanupList, CODE_AT_LINE);
 				if (pendingCleanupList.empty() == false) {
 					for (unsigned int index = 0; index < pendingCleanupList.size(); ++index) {
 						Thread *thread = pendingCleanupList[index];
@@ -91,7 +94,7 @@ namespace Shared {
 			void addThread(Thread *thread) {
 				if (Thread::getEnableVerboseMode()) printf("In %s Line: %d this: %p\n", __FUNCTION__, __LINE__, this);
 
-				MutexSafeWrapper safeMutex(&mutexPendingCleanupList);
+				MutexSafeWrapper safeMutex(&mutexPendingCleanupList, CODE_AT_LINE);
 				pendingCleanupList.push_back(thread);
 				safeMutex.ReleaseLock();
 
@@ -150,12 +153,12 @@ namespace Shared {
 		}
 
 		void Thread::addThreadToList() {
-			MutexSafeWrapper safeMutex(&Thread::mutexthreadList);
+			MutexSafeWrapper safeMutex(&Thread::mutexthreadList, CODE_AT_LINE);
 			Thread::threadList.push_back(this);
 			safeMutex.ReleaseLock();
 		}
 		void Thread::removeThreadFromList() {
-			MutexSafeWrapper safeMutex(&Thread::mutexthreadList);
+			MutexSafeWrapper safeMutex(&Thread::mutexthreadList, CODE_AT_LINE);
 			if (Thread::threadList.empty() == false) {
 				std::vector<Thread *>::iterator iterFind = std::find(Thread::threadList.begin(), Thread::threadList.end(), this);
 				if (iterFind == Thread::threadList.end()) {
@@ -172,7 +175,7 @@ namespace Shared {
 		}
 
 		void Thread::shutdownThreads() {
-			MutexSafeWrapper safeMutex(&Thread::mutexthreadList);
+			MutexSafeWrapper safeMutex(&Thread::mutexthreadList, CODE_AT_LINE);
 			for (unsigned int index = 0; index < Thread::threadList.size(); ++index) {
 				BaseThread *thread = dynamic_cast<BaseThread *>(Thread::threadList[index]);
 				if (thread && thread->getRunningStatus() == true) {
@@ -196,7 +199,7 @@ namespace Shared {
 				//printf("In Thread::shutdownThreads Line: %d\n",__LINE__);
 				//sleep(100);
 
-				MutexSafeWrapper safeMutex(cleanupThreadMutex.get());
+				MutexSafeWrapper safeMutex(cleanupThreadMutex.get(), CODE_AT_LINE);
 				try {
 					cleanupThread.reset(0);
 				} catch (...) {
@@ -206,7 +209,7 @@ namespace Shared {
 		}
 
 		bool Thread::isThreadExecuteCompleteStatus() {
-			MutexSafeWrapper safeMutex(mutexthreadAccessor);
+			MutexSafeWrapper safeMutex(mutexthreadAccessor, CODE_AT_LINE);
 			return (currentState == thrsExecuteComplete);
 		}
 		Thread::~Thread() {
@@ -214,7 +217,7 @@ namespace Shared {
 			string uniqueId = (base_thread ? base_thread->getUniqueID() : "new_base_thread_prev_null");
 			if (Thread::getEnableVerboseMode()) printf("In ~Thread Line: %d [%p] thread = %p uniqueId [%s]\n", __LINE__, this, thread, uniqueId.c_str());
 
-			MutexSafeWrapper safeMutex(mutexthreadAccessor);
+			MutexSafeWrapper safeMutex(mutexthreadAccessor, CODE_AT_LINE);
 			if (thread != NULL) {
 
 				safeMutex.ReleaseLock();
@@ -255,7 +258,7 @@ namespace Shared {
 
 		std::vector<Thread *> Thread::getThreadList() {
 			std::vector<Thread *> result;
-			MutexSafeWrapper safeMutex(&Thread::mutexthreadList);
+			MutexSafeWrapper safeMutex(&Thread::mutexthreadList, CODE_AT_LINE);
 			result = threadList;
 			safeMutex.ReleaseLock();
 			return result;
@@ -264,7 +267,7 @@ namespace Shared {
 		void Thread::start() {
 			if (Thread::getEnableVerboseMode()) printf("In Thread::execute Line: %d\n", __LINE__);
 
-			MutexSafeWrapper safeMutex(mutexthreadAccessor);
+			MutexSafeWrapper safeMutex(mutexthreadAccessor, CODE_AT_LINE);
 			currentState = thrsStarting;
 
 			BaseThread *base_thread = dynamic_cast<BaseThread *>(this);
@@ -292,7 +295,7 @@ namespace Shared {
 		}
 
 		bool Thread::threadObjectValid() {
-			MutexSafeWrapper safeMutex(mutexthreadAccessor);
+			MutexSafeWrapper safeMutex(mutexthreadAccessor, CODE_AT_LINE);
 			return (thread != NULL);
 		}
 
@@ -310,7 +313,7 @@ namespace Shared {
 				throw megaglest_runtime_error(szBuf);
 			}
 
-			MutexSafeWrapper safeMutex(thread->mutexthreadAccessor);
+			MutexSafeWrapper safeMutex(thread->mutexthreadAccessor, CODE_AT_LINE);
 			thread->currentState = thrsExecuteStart;
 			safeMutex.ReleaseLock(true);
 
@@ -318,6 +321,10 @@ namespace Shared {
 			//ThreadGarbageCollector *garbage_collector = dynamic_cast<ThreadGarbageCollector *>(thread);
 			if (Thread::getEnableVerboseMode()) printf("In Thread::execute Line: %d thread = %p base_thread = %p [%s]\n", __LINE__, thread, base_thread, (base_thread != NULL ? base_thread->getUniqueID().c_str() : "n/a"));
 
+			if (base_thread != NULL && Shared::Util::TraceProfiler::isEnabled() == true) {
+				Shared::Util::TraceProfiler::setThreadName(base_thread->getUniqueID());
+			}
+
 			if (thread->threadObjectValid() == true) {
 				safeMutex.Lock();
 				thread->currentState = thrsExecuting;
@@ -340,7 +347,7 @@ namespace Shared {
 			}
 
 			if (Thread::getEnableVerboseMode()) printf("In Thread::execute Line: %d\n", __LINE__);
-			MutexSafeWrapper safeMutex2(thread->mutexthreadAccessor);
+			MutexSafeWrapper safeMutex2(thread->mutexthreadAccessor, CODE_AT_LINE);
 
 			if (Thread::getEnableVerboseMode()) printf("In Thread::execute Line: %d\n", __LINE__);
 			if (thread->threadObjectValid() == true) {
@@ -362,7 +369,7 @@ namespace Shared {
 				//ThreadGarbageCollector *garbage_collector = dynamic_cast<ThreadGarbageCollector *>(this);
 				if (Thread::getEnableVerboseMode()) printf("In Thread::shutdownThreads Line: %d thread = %p base_thread = %p [%s]\n", __LINE__, this, base_thread, (base_thread != NULL ? base_thread->getUniqueID().c_str() : "n/a"));
 
-				MutexSafeWrapper safeMutex(cleanupThreadMutex.get());
+				MutexSafeWrapper safeMutex(cleanupThreadMutex.get(), CODE_AT_LINE);
 				if (cleanupThread.get() == NULL) {
 					if (Thread::getEnableVerboseMode()) printf("In Thread::shutdownThreads Line: %d\n", __LINE__);
 					cleanupThread.reset(new ThreadGarbageCollector());
@@ -414,7 +421,7 @@ namespace Shared {
 		}
 
 		void Thread::kill() {
-			MutexSafeWrapper safeMutex(mutexthreadAccessor);
+			MutexSafeWrapper safeMutex(mutexthreadAccessor, CODE_AT_LINE);
 			//SDL_KillThread(thread);
 			thread = NULL;
 		}
@@ -497,7 +504,7 @@ namespace Shared {
 			}
 
 			if (Mutex::mutexMutexList.get()) {
-				MutexSafeWrapper safeMutexX(Mutex::mutexMutexList.get());
+				MutexSafeWrapper safeMutexX(Mutex::mutexMutexList.get(), CODE_AT_LINE);
 				Mutex::mutexList.push_back(this);
 				safeMutexX.ReleaseLock();
 			} else {
@@ -507,7 +514,7 @@ namespace Shared {
 
 		Mutex::~Mutex() {
 			if (Mutex::mutexMutexList.get() && isStaticMutexListMutex == false) {
-				MutexSafeWrapper safeMutexX(Mutex::mutexMutexList.get());
+				MutexSafeWrapper safeMutexX(Mutex::mutexMutexList.get(), CODE_AT_LINE);
 				std::vector<Mutex *>::iterator iterFind = std::find(Mutex::mutexList.begin(), Mutex::mutexList.end(), this);
 				if (iterFind == Mutex::mutexList.end()) {
 					printf("In [%s::%s Line: %d] iterFind == Mutex::mutexList.end()", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
@@ -591,6 +598,159 @@ namespace Shared {
 		}
 		*/
 
+		// =====================================================
+		//	class MutexProfiler
+		// =====================================================
+
+		bool MutexProfiler::enabled = false;
+
+		class MutexProfilerCounts {
+		public:
+			uint64 acquisitions;
+			uint64 contended;
+			Uint64 waitCount;
+			Uint64 maxWaitCount;
+			Uint64 holdCount;
+			Uint64 maxHoldCount;
+
+			MutexProfilerCounts() {
+				acquisitions = 0;
+				contended = 0;
+				waitCount = 0;
+				maxWaitCount = 0;
+				holdCount = 0;
+				maxHoldCount = 0;
+			}
+		};
+
+		// created once and never freed, locks still get released while
+		// the statics go away. A plain SDL mutex so that recording a
+		// sample does not go through a profiled lock itself.
+		static SDL_mutex *mutexProfilerAccessor = NULL;
+		static std::map<const char *, MutexProfilerCounts> *mutexProfilerSites = NULL;
+		static std::set<string> *mutexProfilerInternedSites = NULL;
+		static const char *mutexProfilerNoOwnerSite = "(no owner id)";
+
+		MutexProfiler::SiteStats::SiteStats() {
+			acquisitions = 0;
+			contended = 0;
+			waitMicros = 0;
+			maxWaitMicros = 0;
+			holdMicros = 0;
+			maxHoldMicros = 0;
+		}
+
+		void MutexProfiler::setEnabled(bool value) {
+			if (value == true && mutexProfilerAccessor == NULL) {
+				mutexProfilerSites = new std::map<const char *, MutexProfilerCounts>();
+				mutexProfilerInternedSites = new std::set<string>();
+				mutexProfilerAccessor = SDL_CreateMutex();
+			}
+			enabled = value;
+		}
+
+		void MutexProfiler::addSample(const char *site, bool contended, Uint64 waitCount, Uint64 holdCount) {
+			SDLMutexSafeWrapper safeMutex(&mutexProfilerAccessor);
+			if (mutexProfilerSites == NULL) {
+				return;
+			}
+			MutexProfilerCounts &counts = (*mutexProfilerSites)[site != NULL ? site : mutexProfilerNoOwnerSite];
+			counts.acquisitions++;
+			if (contended == true) {
+				counts.contended++;
+			}
+			counts.waitCount += waitCount;
+			counts.maxWaitCount = max(counts.maxWaitCount, waitCount);
+			counts.holdCount += holdCount;
+			counts.maxHoldCount = max(counts.maxHoldCount, holdCount);
+		}
+
+		const char * MutexProfiler::internSite(const string &site) {
+			SDLMutexSafeWrapper safeMutex(&mutexProfilerAccessor);
+			if (mutexProfilerInternedSites == NULL) {
+				return mutexProfilerNoOwnerSite;
+			}
+			return mutexProfilerInternedSites->insert(site).first->c_str();
+		}
+
+		static bool compareMutexProfilerSites(const MutexProfiler::SiteStats &site1, const MutexProfiler::SiteStats &site2) {
+			if (site1.waitMicros != site2.waitMicros) {
+				return site1.waitMicros > site2.waitMicros;
+			}
+			return site1.holdMicros > site2.holdMicros;
+		}
+
+		vector<MutexProfiler::SiteStats> MutexProfiler::getSiteStats() {
+			// the same literal may live at several addresses, merge by text
+			std::map<string, MutexProfilerCounts> sitesByName;
+			{
+				SDLMutexSafeWrapper safeMutex(&mutexProfilerAccessor);
+				if (mutexProfilerSites != NULL) {
+					for (std::map<const char *, MutexProfilerCounts>::const_iterator iterMap = mutexProfilerSites->begin();
+						iterMap != mutexProfilerSites->end(); ++iterMap) {
+						const MutexProfilerCounts &counts = iterMap->second;
+						MutexProfilerCounts &total = sitesByName[iterMap->first];
+						total.acquisitions += counts.acquisitions;
+						total.contended += counts.contended;
+						total.waitCount += counts.waitCount;
+						total.maxWaitCount = max(total.maxWaitCount, counts.maxWaitCount);
+						total.holdCount += counts.holdCount;
+						total.maxHoldCount = max(total.maxHoldCount, counts.maxHoldCount);
+					}
+				}
+			}
+
+			double microsPerCount = 1000000.0 / (double) SDL_GetPerformanceFrequency();
+			vector<SiteStats> result;
+			result.reserve(sitesByName.size());
+			for (std::map<string, MutexProfilerCounts>::const_iterator iterMap = sitesByName.begin();
+				iterMap != sitesByName.end(); ++iterMap) {
+				const MutexProfilerCounts &counts = iterMap->second;
+				SiteStats stats;
+				stats.site = iterMap->first;
+				stats.acquisitions = counts.acquisitions;
+				stats.contended = counts.contended;
+				stats.waitMicros = (int64) (counts.waitCount * microsPerCount);
+				stats.maxWaitMicros = (int64) (counts.maxWaitCount * microsPerCount);
+				stats.holdMicros = (int64) (counts.holdCount * microsPerCount);
+				stats.maxHoldMicros = (int64) (counts.maxHoldCount * microsPerCount);
+				result.push_back(stats);
+			}
+			std::sort(result.begin(), result.end(), compareMutexProfilerSites);
+			return result;
+		}
+
+		string MutexProfiler::getReport() {
+			vector<SiteStats> sites = getSiteStats();
+
+			char szBuf[8096] = "";
+			snprintf(szBuf, 8095, "%-70s %12s %12s %14s %12s %14s %12s\n",
+				"lock site", "locks", "contended", "wait us", "max wait us", "hold us", "max hold us");
+			string result = szBuf;
+			for (unsigned int index = 0; index < sites.size(); ++index) {
+				const SiteStats &stats = sites[index];
+				string site = stats.site;
+				// the path up to the source folder only makes the lines long
+				size_t sourcePos = site.rfind("source/");
+				if (sourcePos != string::npos) {
+					site = site.substr(sourcePos + 7);
+				}
+				snprintf(szBuf, 8095, "%-70s %12llu %12llu %14lld %12lld %14lld %12lld\n",
+					site.c_str(), (unsigned long long int) stats.acquisitions, (unsigned long long int) stats.contended,
+					(long long int) stats.waitMicros, (long long int) stats.maxWaitMicros,
+					(long long int) stats.holdMicros, (long long int) stats.maxHoldMicros);
+				result += szBuf;
+			}
+			return result;
+		}
+
+		void MutexProfiler::reset() {
+			SDLMutexSafeWrapper safeMutex(&mutexProfilerAccessor);
+			if (mutexProfilerSites != NULL) {
+				mutexProfilerSites->clear();
+			}
+		}
+
 		// =====================================================
 		//	class Semaphore
 		// =====================================================
@@ -685,7 +845,7 @@ namespace Shared {
 			semaphore.signal();
 		}
 		void ReadWriteMutex::LockWrite() {
-			MutexSafeWrapper safeMutex(&mutex);
+			MutexSafeWrapper safeMutex(&mutex, CODE_AT_LINE);
 			uint32 totalLocks = maxReaders();
 			for (unsigned int i = 0; i < totalLocks; ++i) {
 				semaphore.waitTillSignalled();
@@ -886,7 +1046,7 @@ namespace Shared {
 		void MasterSlaveThreadController::triggerMaster(int waitMilliseconds) {
 			if (debugMasterSlaveThreadController) printf("In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
-			MutexSafeWrapper safeMutex(mutex);
+			MutexSafeWrapper safeMutex(mutex, CODE_AT_LINE);
 			if (debugMasterSlaveThreadController) printf("In [%s::%s Line: %d] semVal = %u\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, slaveTriggerCounter);
 			//printf("In [%s::%s Line: %d] semVal = %u\n",extractFileFromDirectoryPath(__FILE__).c_str(),__FUNCTION__,__LINE__,slaveTriggerCounter);
 
@@ -143,7 +143,7 @@ namespace Shared {
 				// get window handle from SDL
 				SDL_VERSION(&info.version);
 				if (SDL_GetWindowWMInfo(Window::getSDLWindow(), &info) == -1) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s %d] SDL_GetWMInfo #1 failed\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s %d] SDL_GetWMInfo #1 failed\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					return false;
 				}
 
@@ -153,7 +153,7 @@ namespace Shared {
 				// create temporary context
 				tempRC = wglCreateContext(tempDC);
 				if (tempRC == NULL) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s %d] wglCreateContext failed\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s %d] wglCreateContext failed\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					return false;
 				}
 
@@ -183,7 +183,7 @@ namespace Shared {
 
 			this->initGl(colorBits, depthBits, stencilBits, hardware_acceleration,
 				fullscreen_anti_aliasing, gammaValue);
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 
 			this->makeCurrentGl();
 
@@ -192,7 +192,7 @@ namespace Shared {
 				// previously used structure may possibly be invalid, to be sure we get it again
 				SDL_VERSION(&info.version);
 				if (SDL_GetWindowWMInfo(Window::getSDLWindow(), &info) == -1) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s %d] SDL_GetWMInfo #2 failed\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s %d] SDL_GetWMInfo #2 failed\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					return false;
 				}
 
@@ -204,7 +204,7 @@ namespace Shared {
 
 				// we no longer need our temporary context
 				if (!wglDeleteContext(tempRC)) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugError).enabled) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s %d] wglDeleteContext failed\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugError)) SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s %d] wglDeleteContext failed\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__);
 					return false;
 				}
 			}
@@ -57,7 +57,7 @@ namespace Shared {
 			// -adecw-screen-medium-r-normal--18-180-75-75-m-160-gb2312.1980-1	 this is a Chinese font
 
 			std::string useRealFontName = type;
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] trying to load useRealFontName [%s], size = %d, width = %d\n", __FILE__, __FUNCTION__, __LINE__, useRealFontName.c_str(), size, width);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] trying to load useRealFontName [%s], size = %d, width = %d\n", __FILE__, __FUNCTION__, __LINE__, useRealFontName.c_str(), size, width);
 
 			DWORD dwErrorGL = 0;
 			HDC hDC = 0;
@@ -86,14 +86,14 @@ namespace Shared {
 
 				for (unsigned int idx = 0; idx < systemFontList.size(); ++idx) {
 					string &fontName = systemFontList[idx];
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] found system font [%s]\n", __FILE__, __FUNCTION__, __LINE__, fontName.c_str());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] found system font [%s]\n", __FILE__, __FUNCTION__, __LINE__, fontName.c_str());
 				}
 			} else {
 				for (unsigned int idx = 0; idx < systemFontList.size(); ++idx) {
 					string &fontName = systemFontList[idx];
 
 					if (_stricmp(useRealFontName.c_str(), fontName.c_str()) != 0) {
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] switch font name from [%s] to [%s]\n", __FILE__, __FUNCTION__, __LINE__, useRealFontName.c_str(), fontName.c_str());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] switch font name from [%s] to [%s]\n", __FILE__, __FUNCTION__, __LINE__, useRealFontName.c_str(), fontName.c_str());
 
 						useRealFontName = fontName;
 						break;
@@ -133,7 +133,7 @@ namespace Shared {
 			*/
 			assertGl();
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] wglUseFontBitmaps returned = %d, charCount = %d, base = %d\n", __FILE__, __FUNCTION__, __LINE__, err, charCount, base);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] wglUseFontBitmaps returned = %d, charCount = %d, base = %d\n", __FILE__, __FUNCTION__, __LINE__, err, charCount, base);
 
 			FIXED one;
 			one.value = 1;
@@ -156,7 +156,7 @@ namespace Shared {
 			GLYPHMETRICS glyphMetrics;
 			int errorCode = GetGlyphOutline(dc, 'a', GGO_METRICS, &glyphMetrics, 0, NULL, &mat2);
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] GetGlyphOutline returned = %d\n", __FILE__, __FUNCTION__, __LINE__, errorCode);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] GetGlyphOutline returned = %d\n", __FILE__, __FUNCTION__, __LINE__, errorCode);
 
 			if (errorCode != GDI_ERROR) {
 				metrics.setHeight(static_cast<float>(glyphMetrics.gmBlackBoxY));
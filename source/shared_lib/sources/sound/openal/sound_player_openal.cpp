@@ -24,12 +24,12 @@ namespace Shared {
 			using namespace Util;
 
 			SoundSource::SoundSource() {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				alGenSources(1, &source);
 				SoundPlayerOpenAL::checkAlError("Couldn't create audio source: ");
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
 			SoundSource::~SoundSource() {
@@ -140,7 +140,7 @@ namespace Shared {
 			}
 
 			void StaticSoundSource::play(StaticSound* sound) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				if (bufferAllocated) {
 					stop();
@@ -152,7 +152,7 @@ namespace Shared {
 				alGenBuffers(1, &buffer);
 				SoundPlayerOpenAL::checkAlError("Couldn't create audio buffer: ");
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d] filename [%s] format = %d, sound->getSamples() = %d, sound->getInfo()->getSize() = %d, sound->getInfo()->getSamplesPerSecond() = %d\n", __FILE__, __FUNCTION__, __LINE__, sound->getFileName().c_str(), format, sound->getSamples(), sound->getInfo()->getSize(), sound->getInfo()->getSamplesPerSecond());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d] filename [%s] format = %d, sound->getSamples() = %d, sound->getInfo()->getSize() = %d, sound->getInfo()->getSamplesPerSecond() = %d\n", __FILE__, __FUNCTION__, __LINE__, sound->getFileName().c_str(), format, sound->getSamples(), sound->getInfo()->getSize(), sound->getInfo()->getSamplesPerSecond());
 
 				bufferAllocated = true;
 				alBufferData(buffer, format, sound->getSamples(),
@@ -251,7 +251,7 @@ namespace Shared {
 
 				// we might have to restart the source if we had a buffer underrun
 				if (!playing()) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d] Restarting audio source because of buffer underrun.\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d] Restarting audio source because of buffer underrun.\n", __FILE__, __FUNCTION__, __LINE__);
 
 					std::cerr << "Restarting audio source because of buffer underrun.\n";
 					alSourcePlay(source);
@@ -318,22 +318,22 @@ namespace Shared {
 			// ================================
 
 			SoundPlayerOpenAL::SoundPlayerOpenAL() {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				device = 0;
 				context = 0;
 				initOk = false;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
 			SoundPlayerOpenAL::~SoundPlayerOpenAL() {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				end();
 				initOk = false;
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
 			void SoundPlayerOpenAL::printOpenALInfo() {
@@ -351,7 +351,7 @@ namespace Shared {
 			}
 
 			bool SoundPlayerOpenAL::init(const SoundPlayerParams* params) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				initOk = false;
 
@@ -379,7 +379,7 @@ namespace Shared {
 					char *deviceName = getenv("MEGAGLEST_SOUND_DEVICE");
 					device = alcOpenDevice(deviceName);
 
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) {
 						std::ostringstream os;
 						if (alcIsExtensionPresent(NULL, (const ALCchar *) "ALC_ENUMERATION_EXT") == AL_TRUE) {
 							const char *s = (const char *) alcGetString(NULL, ALC_DEVICE_SPECIFIER);
@@ -430,10 +430,10 @@ namespace Shared {
 					checkAlError("Audio error after init: ");
 
 					initOk = true;
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 				} catch (const exception &ex) {
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d] error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d] error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
 					printOpenALInfo();
 				}
 
@@ -442,7 +442,7 @@ namespace Shared {
 
 			void SoundPlayerOpenAL::end() {
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 
 				for (StaticSoundSources::iterator i = staticSources.begin();
@@ -451,7 +451,7 @@ namespace Shared {
 					src->stop();
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				for (StreamSoundSources::iterator i = streamSources.begin();
 					i != streamSources.end(); ++i) {
@@ -459,7 +459,7 @@ namespace Shared {
 					src->stop();
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				for (StaticSoundSources::iterator i = staticSources.begin();
 					i != staticSources.end(); ++i) {
@@ -467,7 +467,7 @@ namespace Shared {
 				}
 				staticSources.clear();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				for (StreamSoundSources::iterator i = streamSources.begin();
 					i != streamSources.end(); ++i) {
@@ -475,20 +475,20 @@ namespace Shared {
 				}
 				streamSources.clear();
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				if (context != 0) {
 					alcMakeContextCurrent(NULL);
 					SoundPlayerOpenAL::checkAlcError(string(__FILE__) + string(" ") + string(__FUNCTION__) + string(" ") + intToStr(__LINE__));
 				}
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				if (context != 0) {
 					alcDestroyContext(context);
 					context = 0;
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				if (device != 0) {
 					alcCloseDevice(device);
@@ -496,7 +496,7 @@ namespace Shared {
 					initOk = false;
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 			}
 
 			void SoundPlayerOpenAL::play(StaticSound* staticSound, bool force) {
@@ -577,7 +577,7 @@ namespace Shared {
 						try {
 							source->update();
 						} catch (std::exception& e) {
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, e.what());
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, e.what());
 							SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, e.what());
 
 							std::cerr << "Error while updating sound stream: " << e.what() << "\n";
@@ -586,12 +586,12 @@ namespace Shared {
 					alcProcessContext(context);
 					checkAlcError("Error while processing audio context: ");
 				} catch (exception &ex) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Error [%s]\n", __FILE__, __FUNCTION__, __LINE__, ex.what());
 					printOpenALInfo();
 					throw megaglest_runtime_error(ex.what());
 				} catch (...) {
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d] UNKNOWN Error\n", __FILE__, __FUNCTION__, __LINE__);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d] UNKNOWN Error\n", __FILE__, __FUNCTION__, __LINE__);
 					SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] UNKNOWN Error\n", __FILE__, __FUNCTION__, __LINE__);
 					printOpenALInfo();
 					throw;
@@ -613,19 +613,19 @@ namespace Shared {
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d] playingCount = %d, staticSources.size() = " MG_SIZE_T_SPECIFIER ", params.staticBufferCount = %u\n", __FILE__, __FUNCTION__, __LINE__, playingCount, (unsigned long) staticSources.size(), params.staticBufferCount);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s %d] playingCount = %d, staticSources.size() = " MG_SIZE_T_SPECIFIER ", params.staticBufferCount = %u\n", __FILE__, __FUNCTION__, __LINE__, playingCount, (unsigned long) staticSources.size(), params.staticBufferCount);
 
 				// create a new source
 				if (staticSources.size() >= params.staticBufferCount) {
 					return 0;
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				StaticSoundSource* source = new StaticSoundSource();
 				staticSources.push_back(source);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				return source;
 			}
@@ -647,12 +647,12 @@ namespace Shared {
 					throw std::runtime_error("Too many stream sounds played at once");
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				StreamSoundSource* source = new StreamSoundSource();
 				streamSources.push_back(source);
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSound, "In [%s::%s Line: %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 				return source;
 			}
@@ -33,7 +33,7 @@ namespace Shared {
 
 		SoundPlayer *SoundInterface::newSoundPlayer() {
 
-			if (SystemFlags::getSystemSettingType(SystemFlags::debugSound).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
+			if (DEBUG_TYPE_ENABLED(SystemFlags::debugSound)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s %d]\n", __FILE__, __FUNCTION__, __LINE__);
 
 			return soundFactory->newSoundPlayer();
 		}
@@ -40,6 +40,7 @@ namespace Shared {
 
 		Mutex Checksum::fileListCacheSynchAccessor;
 		std::map<string, uint32> Checksum::fileListCache;
+		FileCRCIndex Checksum::fileIndex;
 
 		unsigned int crc_table[256] =
 		{
@@ -77,6 +78,52 @@ namespace Shared {
 			0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94, 0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 		};
 
+		// crc_table extended for slicing-by-8, crcSliceTable[k][n] is the crc
+		// of byte n followed by k zero bytes
+		static uint32 crcSliceTable[8][256];
+
+		static bool initCrcSliceTable() {
+			for (int n = 0; n < 256; ++n) {
+				crcSliceTable[0][n] = crc_table[n];
+			}
+			for (int n = 0; n < 256; ++n) {
+				uint32 crc = crcSliceTable[0][n];
+				for (int k = 1; k < 8; ++k) {
+					crc = (crc >> 8) ^ crc_table[crc & 0xff];
+					crcSliceTable[k][n] = crc;
+				}
+			}
+			return true;
+		}
+		static bool crcSliceTableReady = initCrcSliceTable();
+
+		uint32 Checksum::updateCrc(uint32 crc, const void *_data, size_t _size) {
+			const unsigned char *rVal = reinterpret_cast<const unsigned char *>(_data);
+			crc = ~crc;
+
+			// eight bytes per step, the words are assembled byte by byte
+			// so this works on any alignment and byte order
+			for (; _size >= 8; _size -= 8, rVal += 8) {
+				uint32 one = crc ^ ((uint32) rVal[0] | ((uint32) rVal[1] << 8) |
+					((uint32) rVal[2] << 16) | ((uint32) rVal[3] << 24));
+				uint32 two = (uint32) rVal[4] | ((uint32) rVal[5] << 8) |
+					((uint32) rVal[6] << 16) | ((uint32) rVal[7] << 24);
+
+				crc = crcSliceTable[7][one & 0xff] ^
+					crcSliceTable[6][(one >> 8) & 0xff] ^
+					crcSliceTable[5][(one >> 16) & 0xff] ^
+					crcSliceTable[4][one >> 24] ^
+					crcSliceTable[3][two & 0xff] ^
+					crcSliceTable[2][(two >> 8) & 0xff] ^
+					crcSliceTable[1][(two >> 16) & 0xff] ^
+					crcSliceTable[0][two >> 24];
+			}
+			while (_size--) {
+				crc = (crc >> 8) ^ crc_table[*rVal++ ^ (crc & 0xff)];
+			}
+			return ~crc;
+		}
+
 		Checksum::Checksum() {
 			sum = 0;
 			r = 55665;
@@ -101,13 +148,7 @@ namespace Shared {
 		}
 
 		uint32 Checksum::addBytes(const void *_data, size_t _size) {
-			const unsigned char *rVal = reinterpret_cast<const unsigned char *>(_data);
-			sum = ~sum;
-			while (_size--) {
-				sum = (sum >> 8) ^ crc_table[*rVal++ ^ (sum & 0xff)];
-			}
-			sum = ~sum;
-
+			sum = updateCrc(sum, _data, _size);
 			return sum;
 		}
 
@@ -164,8 +205,8 @@ namespace Shared {
 		}
 
 		void Checksum::addString(const string &value) {
-			for (unsigned int i = 0; i < value.size(); ++i) {
-				addByte(value[i]);
+			if (value.empty() == false) {
+				addBytes(value.data(), value.size());
 			}
 		}
 
@@ -308,9 +349,13 @@ namespace Shared {
 				// Load the data
 				ifs.read((char*) &buf[0], buf.size());
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] buf.size() = %d, path [%s], isXMLFile = %d\n", __FILE__, __FUNCTION__, __LINE__, buf.size(), path.c_str(), isXMLFile);
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] buf.size() = %d, path [%s], isXMLFile = %d\n", __FILE__, __FUNCTION__, __LINE__, buf.size(), path.c_str(), isXMLFile);
 
 				if (isXMLFile == true) {
+					// the bytes that count are gathered first and hashed in one go
+					std::vector<char> xmlBytes;
+					xmlBytes.reserve(buf.size());
+
 					bool inCommentTag = false;
 					for (std::size_t i = 0; i < buf.size(); ++i) {
 						// Ignore Spaces in XML files as they are
@@ -320,10 +365,10 @@ namespace Shared {
 							if (buf[i] == '>' && i >= 3 && buf[i - 1] == '-' && buf[i - 2] == '-') {
 								inCommentTag = false;
 								//printf("TURNING OFF comment TAG, i = %d [%c]",i,buf[i]);
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] i = %d\n", __FILE__, __FUNCTION__, __LINE__, i);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] i = %d\n", __FILE__, __FUNCTION__, __LINE__, i);
 							} else {
 								//printf("SKIPPING XML comment character, i = %d [%c]",i,buf[i]);
-								if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] i = %d\n", __FILE__, __FUNCTION__, __LINE__, i);
+								if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] i = %d\n", __FILE__, __FUNCTION__, __LINE__, i);
 							}
 							continue;
 						}
@@ -331,21 +376,23 @@ namespace Shared {
 						else if (buf[i] == '<' && i + 4 < bufSize && buf[i + 1] == '!' && buf[i + 2] == '-' && buf[i + 3] == '-') {
 							inCommentTag = true;
 							//printf("TURNING ON comment TAG, i = %d [%c]",i,buf[i]);
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] i = %d\n", __FILE__, __FUNCTION__, __LINE__, i);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] i = %d\n", __FILE__, __FUNCTION__, __LINE__, i);
 							continue;
 						} else if (buf[i] == ' ' || buf[i] == '\t' || buf[i] == '\n' || buf[i] == '\r') {
 							//printf("SKIPPING special character, i = %d [%c]",i,buf[i]);
-							if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] i = %d\n", __FILE__, __FUNCTION__, __LINE__, i);
+							if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] i = %d\n", __FILE__, __FUNCTION__, __LINE__, i);
 							continue;
 						}
 						//}
-						uint32 cipher = addByte(buf[i]);
-
-						if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] %d / %d, cipher = %u\n", __FILE__, __FUNCTION__, __LINE__, i, buf.size(), cipher);
+						xmlBytes.push_back(buf[i]);
+					}
+					if (xmlBytes.empty() == false) {
+						uint32 cipher = addBytes(&xmlBytes[0], xmlBytes.size());
+						if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] %d / %d, cipher = %u\n", __FILE__, __FUNCTION__, __LINE__, xmlBytes.size(), buf.size(), cipher);
 					}
-				} else {
+				} else if (buf.empty() == false) {
 					uint32 cipher = addBytes(&buf[0], buf.size());
-					if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] %d, cipher = %u\n", __FILE__, __FUNCTION__, __LINE__, buf.size(), cipher);
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] %d, cipher = %u\n", __FILE__, __FUNCTION__, __LINE__, buf.size(), cipher);
 				}
 
 				// Close the file
@@ -360,10 +407,44 @@ namespace Shared {
 			return fileExists;
 		}
 
+		uint32 Checksum::getCachedFileCRC(const string &path) {
+			MutexSafeWrapper safeMutexSocketDestructorFlag(&Checksum::fileListCacheSynchAccessor, CODE_AT_LINE);
+			std::map<string, uint32>::iterator iterFind = Checksum::fileListCache.find(path);
+			if (iterFind != Checksum::fileListCache.end()) {
+				return iterFind->second;
+			}
+
+			// the stamp is taken before reading, a file changing
+			// meanwhile is simply read again next time
+			uint32 fileCRC = 0;
+			FileStamp fileStamp;
+			bool haveFileStamp = (fileIndex.isOpen() == true &&
+				FileCRCIndex::getFileStamp(path, fileStamp) == true);
+			if (haveFileStamp == false || fileIndex.lookup(path, fileStamp, fileCRC) == false) {
+				// read without the lock so loader threads hash side by side
+				safeMutexSocketDestructorFlag.ReleaseLock(true);
+				Checksum fileResult;
+				bool fileAddedOk = fileResult.addFileToSum(path);
+				fileCRC = fileResult.getSum();
+				safeMutexSocketDestructorFlag.Lock();
+
+				if (haveFileStamp == true && fileAddedOk == true && fileIndex.isOpen() == true) {
+					fileIndex.store(path, fileStamp, fileCRC);
+				}
+			}
+			Checksum::fileListCache[path] = fileCRC;
+			//printf("Getting checksum for file [%s] CRC [%d]\n",path.c_str(),fileCRC);
+			return fileCRC;
+		}
+
+		void Checksum::precacheFile(const string &path) {
+			getCachedFileCRC(path);
+		}
+
 		uint32 Checksum::getSum() {
 			//printf("Getting checksum for files [%d]\n",fileList.size());
 			if (fileList.size() > 0) {
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileList.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, fileList.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileList.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, fileList.size());
 
 				Checksum newResult;
 
@@ -372,21 +453,11 @@ namespace Shared {
 					for (std::map<string, uint32>::iterator iterMap = fileList.begin();
 						iterMap != fileList.end(); ++iterMap) {
 
-						MutexSafeWrapper safeMutexSocketDestructorFlag(&Checksum::fileListCacheSynchAccessor, string(__FILE__) + "_" + intToStr(__LINE__));
-						if (Checksum::fileListCache.find(iterMap->first) == Checksum::fileListCache.end()) {
-							Checksum fileResult;
-							//bool fileAddedOk = fileResult.addFileToSum(iterMap->first);
-							fileResult.addFileToSum(iterMap->first);
-							Checksum::fileListCache[iterMap->first] = fileResult.getSum();
-							//printf("fileAddedOk = %d for file [%s] CRC [%d]\n",fileAddedOk,iterMap->first.c_str(),Checksum::fileListCache[iterMap->first]);
-						} else {
-							//printf("Getting checksum from CACHE for file [%s] CRC [%d]\n",iterMap->first.c_str(),Checksum::fileListCache[iterMap->first]);
-						}
-						newResult.addSum(Checksum::fileListCache[iterMap->first]);
+						newResult.addSum(getCachedFileCRC(iterMap->first));
 					}
 				}
 
-				if (SystemFlags::getSystemSettingType(SystemFlags::debugSystem).enabled) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileList.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, fileList.size());
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] fileList.size() = %d\n", __FILE__, __FUNCTION__, __LINE__, fileList.size());
 
 				return newResult.getSum();
 			}
@@ -415,16 +486,29 @@ namespace Shared {
 		}
 
 		void Checksum::removeFileFromCache(const string file) {
-			MutexSafeWrapper safeMutexSocketDestructorFlag(&Checksum::fileListCacheSynchAccessor, string(__FILE__) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutexSocketDestructorFlag(&Checksum::fileListCacheSynchAccessor, CODE_AT_LINE);
 			if (Checksum::fileListCache.find(file) != Checksum::fileListCache.end()) {
 				Checksum::fileListCache.erase(file);
 			}
 		}
 
 		void Checksum::clearFileCache() {
-			MutexSafeWrapper safeMutexSocketDestructorFlag(&Checksum::fileListCacheSynchAccessor, string(__FILE__) + "_" + intToStr(__LINE__));
+			MutexSafeWrapper safeMutexSocketDestructorFlag(&Checksum::fileListCacheSynchAccessor, CODE_AT_LINE);
 			Checksum::fileListCache.clear();
 		}
 
+		bool Checksum::openFileIndex(const string &path) {
+			MutexSafeWrapper safeMutexSocketDestructorFlag(&Checksum::fileListCacheSynchAccessor, CODE_AT_LINE);
+			return fileIndex.open(path);
+		}
+
+		void Checksum::closeFileIndex() {
+			MutexSafeWrapper safeMutexSocketDestructorFlag(&Checksum::fileListCacheSynchAccessor, CODE_AT_LINE);
+			if (fileIndex.isOpen() == true) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] crc index hits = %u misses = %u entries = %u\n", __FILE__, __FUNCTION__, __LINE__, fileIndex.getHits(), fileIndex.getMisses(), fileIndex.getEntryCount());
+			}
+			fileIndex.close();
+		}
+
 	}
 }//end namespace
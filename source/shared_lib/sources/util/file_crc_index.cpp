@@ -0,0 +1,366 @@
+//      file_crc_index.cpp:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "file_crc_index.h"
+
+#include <cstring>
+#include <ctime>
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#endif
+
+#include "platform_util.h"
+#include "util.h"
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::PlatformCommon;
+
+namespace Shared {
+	namespace Util {
+
+		static const char fileCRCIndexMagic[8] = { 'Z', 'G', 'C', 'R', 'C', 'I', 'D', 'X' };
+		static const uint32 fileCRCIndexByteOrderMark = 0x01020304;
+
+		// =====================================================
+		//	class FileCRCIndex
+		// =====================================================
+
+		FileCRCIndex::FileCRCIndex() {
+#ifdef WIN32
+			fileHandle = INVALID_HANDLE_VALUE;
+			mappingHandle = NULL;
+#else
+			fileDescriptor = -1;
+#endif
+			mapping = NULL;
+			mappingSize = 0;
+			header = NULL;
+			slots = NULL;
+			hits = 0;
+			misses = 0;
+		}
+
+		FileCRCIndex::~FileCRCIndex() {
+			close();
+		}
+
+		uint64 FileCRCIndex::hashPath(const string &file) {
+			// 64 bit FNV-1a, 0 marks an empty slot so it is never returned
+			uint64 hash = 14695981039346656037ULL;
+			for (unsigned int index = 0; index < file.size(); ++index) {
+				hash ^= (unsigned char) file[index];
+				hash *= 1099511628211ULL;
+			}
+			return (hash != 0 ? hash : 1);
+		}
+
+		uint32 FileCRCIndex::slotCheck(const Slot &slot) {
+			uint64 mix = slot.pathHash;
+			mix = (mix ^ slot.size) * 1099511628211ULL;
+			mix = (mix ^ (uint64) slot.modifiedTime) * 1099511628211ULL;
+			mix = (mix ^ (uint64) slot.changeTime) * 1099511628211ULL;
+			mix = (mix ^ slot.inode) * 1099511628211ULL;
+			mix = (mix ^ slot.crc) * 1099511628211ULL;
+			uint32 check = (uint32) (mix ^ (mix >> 32));
+			return (check != 0 ? check : 1);
+		}
+
+		uint64 FileCRCIndex::fileSizeFor(uint32 slotCount) {
+			return sizeof(Header) + (uint64) slotCount * sizeof(Slot);
+		}
+
+		bool FileCRCIndex::getFileStamp(const string &file, FileStamp &stamp) {
+#ifdef WIN32
+			struct _stat64 fileInfo;
+			if (_wstat64(utf8_decode(file).c_str(), &fileInfo) != 0) {
+				return false;
+			}
+#else
+			struct stat fileInfo;
+			if (stat(file.c_str(), &fileInfo) != 0) {
+				return false;
+			}
+#endif
+			// whole seconds would miss a same size edit within one second
+			static const int64 nanosecondsPerSecond = 1000000000LL;
+			stamp.size = (uint64) fileInfo.st_size;
+#if defined(__APPLE__)
+			stamp.modifiedTime = (int64) fileInfo.st_mtimespec.tv_sec * nanosecondsPerSecond + fileInfo.st_mtimespec.tv_nsec;
+			stamp.changeTime = (int64) fileInfo.st_ctimespec.tv_sec * nanosecondsPerSecond + fileInfo.st_ctimespec.tv_nsec;
+#elif !defined(WIN32)
+			stamp.modifiedTime = (int64) fileInfo.st_mtim.tv_sec * nanosecondsPerSecond + fileInfo.st_mtim.tv_nsec;
+			stamp.changeTime = (int64) fileInfo.st_ctim.tv_sec * nanosecondsPerSecond + fileInfo.st_ctim.tv_nsec;
+#else
+			stamp.modifiedTime = (int64) fileInfo.st_mtime * nanosecondsPerSecond;
+			stamp.changeTime = (int64) fileInfo.st_ctime * nanosecondsPerSecond;
+#endif
+			stamp.inode = (uint64) fileInfo.st_ino;
+			return true;
+		}
+
+		bool FileCRCIndex::open(const string &path) {
+			close();
+			this->path = path;
+
+#ifdef WIN32
+			// no sharing, a second instance runs without the index
+			fileHandle = CreateFileW(utf8_decode(path).c_str(), GENERIC_READ | GENERIC_WRITE,
+				0, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+			if (fileHandle == INVALID_HANDLE_VALUE) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] cannot open crc index [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str());
+				return false;
+			}
+			LARGE_INTEGER fileSizeInfo;
+			if (GetFileSizeEx(fileHandle, &fileSizeInfo) == FALSE) {
+				close();
+				return false;
+			}
+			uint64 fileSize = (uint64) fileSizeInfo.QuadPart;
+#else
+			fileDescriptor = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+			if (fileDescriptor < 0) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] cannot open crc index [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str());
+				return false;
+			}
+			// a second instance runs without the index
+			if (flock(fileDescriptor, LOCK_EX | LOCK_NB) != 0) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] crc index [%s] is in use\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str());
+				close();
+				return false;
+			}
+			struct stat fileInfo;
+			if (fstat(fileDescriptor, &fileInfo) != 0) {
+				close();
+				return false;
+			}
+			uint64 fileSize = (uint64) fileInfo.st_size;
+#endif
+
+			if (fileSize >= sizeof(Header) && mapFile(fileSize) == true && isValid(fileSize) == true) {
+				if (DEBUG_TYPE_ENABLED(SystemFlags::debugSystem)) SystemFlags::OutputDebug(SystemFlags::debugSystem, "In [%s::%s Line: %d] crc index [%s] has %u entries\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str(), header->usedCount);
+				return true;
+			}
+
+			// missing, from another version or damaged, start over
+			unmapFile();
+			if (resizeFile(fileSizeFor(initialSlotCount)) == false ||
+				mapFile(fileSizeFor(initialSlotCount)) == false) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] cannot create crc index [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str());
+				close();
+				return false;
+			}
+			reset(initialSlotCount);
+			return true;
+		}
+
+		void FileCRCIndex::close() {
+			unmapFile();
+#ifdef WIN32
+			if (fileHandle != INVALID_HANDLE_VALUE) {
+				CloseHandle(fileHandle);
+				fileHandle = INVALID_HANDLE_VALUE;
+			}
+#else
+			if (fileDescriptor >= 0) {
+				::close(fileDescriptor);
+				fileDescriptor = -1;
+			}
+#endif
+		}
+
+		bool FileCRCIndex::resizeFile(uint64 size) {
+#ifdef WIN32
+			LARGE_INTEGER position;
+			position.QuadPart = (LONGLONG) size;
+			return (SetFilePointerEx(fileHandle, position, NULL, FILE_BEGIN) != FALSE &&
+				SetEndOfFile(fileHandle) != FALSE);
+#else
+			return (ftruncate(fileDescriptor, (off_t) size) == 0);
+#endif
+		}
+
+		bool FileCRCIndex::mapFile(uint64 size) {
+#ifdef WIN32
+			mappingHandle = CreateFileMappingW(fileHandle, NULL, PAGE_READWRITE,
+				(DWORD) (size >> 32), (DWORD) (size & 0xFFFFFFFF), NULL);
+			if (mappingHandle == NULL) {
+				return false;
+			}
+			mapping = MapViewOfFile(mappingHandle, FILE_MAP_ALL_ACCESS, 0, 0, (SIZE_T) size);
+			if (mapping == NULL) {
+				CloseHandle(mappingHandle);
+				mappingHandle = NULL;
+				return false;
+			}
+#else
+			void *result = mmap(NULL, (size_t) size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+			if (result == MAP_FAILED) {
+				return false;
+			}
+			mapping = result;
+#endif
+			mappingSize = size;
+			header = static_cast<Header *>(mapping);
+			slots = reinterpret_cast<Slot *>(static_cast<char *>(mapping) + sizeof(Header));
+			return true;
+		}
+
+		void FileCRCIndex::unmapFile() {
+			if (mapping != NULL) {
+#ifdef WIN32
+				UnmapViewOfFile(mapping);
+				CloseHandle(mappingHandle);
+				mappingHandle = NULL;
+#else
+				munmap(mapping, (size_t) mappingSize);
+#endif
+			}
+			mapping = NULL;
+			mappingSize = 0;
+			header = NULL;
+			slots = NULL;
+		}
+
+		bool FileCRCIndex::isValid(uint64 fileSize) const {
+			if (memcmp(header->magic, fileCRCIndexMagic, sizeof(fileCRCIndexMagic)) != 0 ||
+				header->byteOrderMark != fileCRCIndexByteOrderMark ||
+				header->version != formatVersion) {
+				return false;
+			}
+			// the slot count has to be a power of two for the probing
+			if (header->slotCount == 0 || (header->slotCount & (header->slotCount - 1)) != 0 ||
+				header->usedCount >= header->slotCount) {
+				return false;
+			}
+			return (fileSize == fileSizeFor(header->slotCount));
+		}
+
+		void FileCRCIndex::reset(uint32 slotCount) {
+			memset(mapping, 0, (size_t) mappingSize);
+			memcpy(header->magic, fileCRCIndexMagic, sizeof(fileCRCIndexMagic));
+			header->byteOrderMark = fileCRCIndexByteOrderMark;
+			header->version = formatVersion;
+			header->slotCount = slotCount;
+			header->usedCount = 0;
+		}
+
+		FileCRCIndex::Slot *FileCRCIndex::findSlot(uint64 pathHash) {
+			// linear probing, returns the slot of pathHash or the empty
+			// slot where it belongs
+			uint32 mask = header->slotCount - 1;
+			for (uint32 index = (uint32) pathHash & mask;; index = (index + 1) & mask) {
+				Slot &slot = slots[index];
+				if (slot.pathHash == pathHash || slot.pathHash == 0) {
+					return &slot;
+				}
+			}
+		}
+
+		bool FileCRCIndex::grow() {
+			std::vector<Slot> usedSlots;
+			usedSlots.reserve(header->usedCount);
+			for (uint32 index = 0; index < header->slotCount; ++index) {
+				if (slots[index].pathHash != 0) {
+					usedSlots.push_back(slots[index]);
+				}
+			}
+			uint32 slotCount = header->slotCount * 2;
+
+			unmapFile();
+			if (resizeFile(fileSizeFor(slotCount)) == false || mapFile(fileSizeFor(slotCount)) == false) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] cannot grow crc index [%s] to %u slots\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str(), slotCount);
+				close();
+				return false;
+			}
+			reset(slotCount);
+			for (unsigned int index = 0; index < usedSlots.size(); ++index) {
+				*findSlot(usedSlots[index].pathHash) = usedSlots[index];
+				header->usedCount++;
+			}
+			return true;
+		}
+
+		bool FileCRCIndex::lookup(const string &file, const FileStamp &stamp, uint32 &crc) {
+			if (isOpen() == false) {
+				return false;
+			}
+			const Slot *slot = findSlot(hashPath(file));
+			if (slot->pathHash != 0 && slot->check == slotCheck(*slot) &&
+				slot->size == stamp.size && slot->modifiedTime == stamp.modifiedTime &&
+				slot->changeTime == stamp.changeTime && slot->inode == stamp.inode) {
+				crc = slot->crc;
+				hits++;
+				return true;
+			}
+			misses++;
+			return false;
+		}
+
+		void FileCRCIndex::store(const string &file, const FileStamp &stamp, uint32 crc, int64 now) {
+			if (isOpen() == false) {
+				return;
+			}
+			// a file written this recently may change again without its
+			// timestamp moving on coarse filesystems, hash it next time too
+			if (now < 0) {
+				now = (int64) time(NULL) * 1000000000LL;
+			}
+			if (stamp.modifiedTime > now - recentChangeNanoseconds ||
+				stamp.changeTime > now - recentChangeNanoseconds) {
+				return;
+			}
+			uint64 pathHash = hashPath(file);
+			Slot *slot = findSlot(pathHash);
+			if (slot->pathHash == 0) {
+				// keep the table at most 70% full
+				if ((uint64) (header->usedCount + 1) * 10 > (uint64) header->slotCount * 7) {
+					if (grow() == false) {
+						return;
+					}
+					slot = findSlot(pathHash);
+				}
+				header->usedCount++;
+			}
+
+			// the check goes last, an interrupted write leaves a slot
+			// that never matches
+			slot->check = 0;
+			slot->pathHash = pathHash;
+			slot->size = stamp.size;
+			slot->modifiedTime = stamp.modifiedTime;
+			slot->changeTime = stamp.changeTime;
+			slot->inode = stamp.inode;
+			slot->crc = crc;
+			slot->check = slotCheck(*slot);
+		}
+
+	}
+}//end namespace
@@ -10,6 +10,11 @@
 // ==============================================================
 
 #include "profiler.h"
+#include <algorithm>
+#include <set>
+#include <vector>
+#include "thread.h"
+#include "conversion.h"
 
 #ifdef SL_PROFILE
 
@@ -127,3 +132,257 @@ namespace Shared {
 };//end namespace
 
 #endif
+
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::Platform;
+
+namespace Shared {
+	namespace Util {
+
+		// =====================================================
+		//	class TraceThreadBuffer
+		// =====================================================
+
+		class TraceEvent {
+		public:
+			const char *name;
+			Uint64 beginCounter;
+			Uint64 endCounter;
+		};
+
+		// Only the owning thread writes events, the others read them
+		// with the registry mutex locked. writeCount is published after
+		// each event so a reader can tell which events were overwritten
+		// while it copied them.
+		class TraceThreadBuffer {
+		public:
+			int threadId;
+			string threadName;
+			vector<TraceEvent> events;
+			uint32 eventMask;
+			SDL_atomic_t writeCount;
+			uint32 savedCount;
+			bool retired;
+
+			explicit TraceThreadBuffer(int threadId) {
+				this->threadId = threadId;
+				this->eventMask = 0;
+				SDL_AtomicSet(&this->writeCount, 0);
+				this->savedCount = 0;
+				this->retired = false;
+			}
+		};
+
+		bool TraceProfiler::enabled = false;
+		int TraceProfiler::threadEventCount = 32768;
+		Uint64 TraceProfiler::startCounter = 0;
+
+		// leaked on purpose, threads may still record while the process exits
+		static Mutex * getTraceRegistryMutex() {
+			static Mutex *registryMutex = new Mutex(CODE_AT_LINE);
+			return registryMutex;
+		}
+
+		static vector<TraceThreadBuffer *> & getTraceRegistry() {
+			static vector<TraceThreadBuffer *> *registry = new vector<TraceThreadBuffer *>();
+			return *registry;
+		}
+
+		static SDL_TLSID getTraceBufferId() {
+			static SDL_TLSID bufferId = SDL_TLSCreate();
+			return bufferId;
+		}
+
+		static int traceNextThreadId = 1;
+
+		static string escapeTraceString(const string &value) {
+			string result;
+			for (unsigned int index = 0; index < value.size(); ++index) {
+				char ch = value[index];
+				if (ch == '"' || ch == '\\') {
+					result += '\\';
+					result += ch;
+				} else if ((unsigned char) ch < 0x20) {
+					char szBuf[8] = "";
+					snprintf(szBuf, 8, "\\u%04x", (unsigned char) ch);
+					result += szBuf;
+				} else {
+					result += ch;
+				}
+			}
+			return result;
+		}
+
+		// =====================================================
+		//	class TraceProfiler
+		// =====================================================
+
+		void TraceProfiler::setEnabled(bool value) {
+			if (value == true && startCounter == 0) {
+				startCounter = getCounter();
+			}
+			enabled = value;
+		}
+
+		void TraceProfiler::setThreadEventCount(int value) {
+			// buffers that exist already keep their size
+			threadEventCount = max(value, 16);
+		}
+
+		void TraceProfiler::releaseThreadBuffer(void *data) {
+			TraceThreadBuffer *buffer = (TraceThreadBuffer *) data;
+			MutexSafeWrapper safeMutex(getTraceRegistryMutex(), CODE_AT_LINE);
+			if ((uint32) SDL_AtomicGet(&buffer->writeCount) != buffer->savedCount) {
+				// removed by the next export
+				buffer->retired = true;
+				return;
+			}
+			vector<TraceThreadBuffer *> &registry = getTraceRegistry();
+			registry.erase(std::remove(registry.begin(), registry.end(), buffer), registry.end());
+			delete buffer;
+		}
+
+		TraceThreadBuffer * TraceProfiler::getThreadBuffer() {
+			SDL_TLSID bufferId = getTraceBufferId();
+			TraceThreadBuffer *buffer = (TraceThreadBuffer *) SDL_TLSGet(bufferId);
+			if (buffer == NULL) {
+				MutexSafeWrapper safeMutex(getTraceRegistryMutex(), CODE_AT_LINE);
+				buffer = new TraceThreadBuffer(traceNextThreadId++);
+				buffer->threadName = "thread " + intToStr(buffer->threadId);
+				getTraceRegistry().push_back(buffer);
+				safeMutex.ReleaseLock();
+
+				SDL_TLSSet(bufferId, buffer, releaseThreadBuffer);
+			}
+			return buffer;
+		}
+
+		void TraceProfiler::addScope(const char *name, Uint64 beginCounter, Uint64 endCounter) {
+			if (enabled == false) {
+				return;
+			}
+			TraceThreadBuffer *buffer = getThreadBuffer();
+			if (buffer->events.empty() == true) {
+				uint32 eventCount = 16;
+				while (eventCount < (uint32) threadEventCount) {
+					eventCount *= 2;
+				}
+				MutexSafeWrapper safeMutex(getTraceRegistryMutex(), CODE_AT_LINE);
+				buffer->events.resize(eventCount);
+				buffer->eventMask = eventCount - 1;
+			}
+
+			uint32 writeCount = (uint32) SDL_AtomicGet(&buffer->writeCount);
+			TraceEvent &event = buffer->events[writeCount & buffer->eventMask];
+			event.name = name;
+			event.beginCounter = beginCounter;
+			event.endCounter = endCounter;
+			SDL_AtomicSet(&buffer->writeCount, (int) (writeCount + 1));
+		}
+
+		const char * TraceProfiler::internName(const string &name) {
+			static set<string> *names = new set<string>();
+			MutexSafeWrapper safeMutex(getTraceRegistryMutex(), CODE_AT_LINE);
+			return names->insert(name).first->c_str();
+		}
+
+		void TraceProfiler::setThreadName(const string &name) {
+			TraceThreadBuffer *buffer = getThreadBuffer();
+			MutexSafeWrapper safeMutex(getTraceRegistryMutex(), CODE_AT_LINE);
+			buffer->threadName = name;
+		}
+
+		string TraceProfiler::getChromeTrace() {
+			double microsPerCount = 1000000.0 / (double) max(SDL_GetPerformanceFrequency(), (Uint64) 1);
+			string result = "{\"traceEvents\":[\n";
+			bool firstEvent = true;
+			char szBuf[8096] = "";
+
+			TraceThreadBuffer *ownBuffer = (TraceThreadBuffer *) SDL_TLSGet(getTraceBufferId());
+			MutexSafeWrapper safeMutex(getTraceRegistryMutex(), CODE_AT_LINE);
+			vector<TraceThreadBuffer *> &registry = getTraceRegistry();
+			for (unsigned int index = 0; index < registry.size(); ++index) {
+				TraceThreadBuffer *buffer = registry[index];
+				snprintf(szBuf, 8096, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+					(firstEvent == true ? "" : ",\n"), buffer->threadId, escapeTraceString(buffer->threadName).c_str());
+				result += szBuf;
+				firstEvent = false;
+
+				if (buffer->events.empty() == true) {
+					continue;
+				}
+				uint32 eventCount = buffer->eventMask + 1;
+				uint32 writeCount = (uint32) SDL_AtomicGet(&buffer->writeCount);
+				uint32 readCount = (writeCount - buffer->savedCount > eventCount ? writeCount - eventCount : buffer->savedCount);
+				vector<TraceEvent> events;
+				events.reserve(writeCount - readCount);
+				for (uint32 count = readCount; count != writeCount; ++count) {
+					events.push_back(buffer->events[count & buffer->eventMask]);
+				}
+				// the owner kept recording while we copied, drop what it overwrote
+				// and the slot it may be filling right now
+				uint32 newWriteCount = (uint32) SDL_AtomicGet(&buffer->writeCount);
+				if (buffer->retired == false && buffer != ownBuffer) {
+					newWriteCount++;
+				}
+				uint32 overwritten = (newWriteCount - readCount > eventCount ? newWriteCount - readCount - eventCount : 0);
+				buffer->savedCount = writeCount;
+
+				for (uint32 eventIndex = min(overwritten, (uint32) events.size()); eventIndex < events.size(); ++eventIndex) {
+					const TraceEvent &event = events[eventIndex];
+					double beginMicros = (double) (Sint64) (event.beginCounter - startCounter) * microsPerCount;
+					double durationMicros = (double) (event.endCounter - event.beginCounter) * microsPerCount;
+					snprintf(szBuf, 8096, ",\n{\"name\":\"%s\",\"cat\":\"zetaglest\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+						escapeTraceString(event.name).c_str(), beginMicros, durationMicros, buffer->threadId);
+					result += szBuf;
+				}
+			}
+
+			// threads that ended are gone for good once their events are out
+			for (unsigned int index = 0; index < registry.size();) {
+				if (registry[index]->retired == true) {
+					delete registry[index];
+					registry.erase(registry.begin() + index);
+				} else {
+					++index;
+				}
+			}
+			safeMutex.ReleaseLock();
+
+			result += "\n],\n\"displayTimeUnit\":\"ns\"}\n";
+			return result;
+		}
+
+		void TraceProfiler::saveChromeTrace(const string &file) {
+			string trace = getChromeTrace();
+#ifdef WIN32
+			FILE *fp = _wfopen(utf8_decode(file).c_str(), L"w");
+#else
+			FILE *fp = fopen(file.c_str(), "w");
+#endif
+			if (fp == NULL) {
+				throw megaglest_runtime_error("Can not open file: " + file);
+			}
+			fwrite(trace.c_str(), 1, trace.size(), fp);
+			fclose(fp);
+		}
+
+		void TraceProfiler::reset() {
+			MutexSafeWrapper safeMutex(getTraceRegistryMutex(), CODE_AT_LINE);
+			vector<TraceThreadBuffer *> &registry = getTraceRegistry();
+			for (unsigned int index = 0; index < registry.size();) {
+				registry[index]->savedCount = (uint32) SDL_AtomicGet(&registry[index]->writeCount);
+				if (registry[index]->retired == true) {
+					delete registry[index];
+					registry.erase(registry.begin() + index);
+				} else {
+					++index;
+				}
+			}
+			startCounter = getCounter();
+		}
+
+	}
+};//end namespace
@@ -0,0 +1,157 @@
+//      varint_codec.cpp:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "varint_codec.h"
+#include "platform_util.h"
+#include "conversion.h"
+#include "leak_dumper.h"
+
+using namespace std;
+
+namespace Shared {
+	namespace Util {
+
+		// =====================================================
+		//	class VarintWriter
+		// =====================================================
+
+		void VarintWriter::writeUInt32(uint32 value) {
+			while (value >= 0x80) {
+				buffer.push_back((uint8) ((value & 0x7F) | 0x80));
+				value >>= 7;
+			}
+			buffer.push_back((uint8) value);
+		}
+
+		void VarintWriter::writeInt32(int32 value) {
+			uint32 zigzag = ((uint32) value << 1) ^ (uint32) (value >> 31);
+			writeUInt32(zigzag);
+		}
+
+		void VarintWriter::writeDelta(int32 value, int32 previousValue) {
+			writeInt32((int32) ((uint32) value - (uint32) previousValue));
+		}
+
+		void VarintWriter::writeFixed32(uint32 value) {
+			buffer.push_back((uint8) (value & 0xFF));
+			buffer.push_back((uint8) ((value >> 8) & 0xFF));
+			buffer.push_back((uint8) ((value >> 16) & 0xFF));
+			buffer.push_back((uint8) ((value >> 24) & 0xFF));
+		}
+
+		void VarintWriter::writeChangedWords(const uint32 *values, const uint32 *previousValues, int count) {
+			if (count < 0 || count > 32) {
+				throw megaglest_runtime_error("Invalid changed word count: " + intToStr(count));
+			}
+			uint32 changedMask = 0;
+			for (int index = 0; index < count; ++index) {
+				if (values[index] != previousValues[index]) {
+					changedMask |= (1u << index);
+				}
+			}
+			writeUInt32(changedMask);
+			for (int index = 0; index < count; ++index) {
+				if ((changedMask & (1u << index)) != 0) {
+					writeFixed32(values[index]);
+				}
+			}
+		}
+
+		void VarintWriter::writeString(const string &value) {
+			writeUInt32((uint32) value.size());
+			buffer.insert(buffer.end(), value.begin(), value.end());
+		}
+
+		// =====================================================
+		//	class VarintReader
+		// =====================================================
+
+		VarintReader::VarintReader(const uint8 *data, uint32 size) {
+			this->data = data;
+			this->size = size;
+			this->position = 0;
+		}
+
+		uint8 VarintReader::readByte() {
+			if (position >= size) {
+				throw megaglest_runtime_error("Varint data truncated at position: " + uIntToStr(position));
+			}
+			return data[position++];
+		}
+
+		uint32 VarintReader::readUInt32() {
+			uint32 result = 0;
+			for (int shift = 0; shift < 35; shift += 7) {
+				uint8 byte = readByte();
+				result |= (uint32) (byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0) {
+					return result;
+				}
+			}
+			throw megaglest_runtime_error("Varint too long at position: " + uIntToStr(position));
+		}
+
+		int32 VarintReader::readInt32() {
+			uint32 zigzag = readUInt32();
+			return (int32) ((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+		}
+
+		int32 VarintReader::readDelta(int32 previousValue) {
+			return (int32) ((uint32) previousValue + (uint32) readInt32());
+		}
+
+		uint32 VarintReader::readFixed32() {
+			uint32 result = readByte();
+			result |= (uint32) readByte() << 8;
+			result |= (uint32) readByte() << 16;
+			result |= (uint32) readByte() << 24;
+			return result;
+		}
+
+		void VarintReader::readChangedWords(uint32 *values, const uint32 *previousValues, int count) {
+			if (count < 0 || count > 32) {
+				throw megaglest_runtime_error("Invalid changed word count: " + intToStr(count));
+			}
+			uint32 changedMask = readUInt32();
+			if (count < 32 && (changedMask >> count) != 0) {
+				throw megaglest_runtime_error("Invalid changed word mask: " + uIntToStr(changedMask));
+			}
+			for (int index = 0; index < count; ++index) {
+				if ((changedMask & (1u << index)) != 0) {
+					values[index] = readFixed32();
+				} else {
+					values[index] = previousValues[index];
+				}
+			}
+		}
+
+		string VarintReader::readString() {
+			uint32 length = readUInt32();
+			if (length > size - position) {
+				throw megaglest_runtime_error("Varint string truncated at position: " + uIntToStr(position));
+			}
+			string result((const char *) &data[position], length);
+			position += length;
+			return result;
+		}
+
+	}
+}//end namespace
@@ -0,0 +1,366 @@
+//      xml_binary.cpp:
+//
+//      This file is part of the ZetaGlest Shared Library
+//
+//      Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//      ZetaGlest is a fork of MegaGlest <https://megaglest.org>
+//
+//      This program is free software: you can redistribute it and/or modify
+//      it under the terms of the GNU General Public License as published by
+//      the Free Software Foundation, either version 3 of the License, or
+//      (at your option) any later version.
+//
+//      This program is distributed in the hope that it will be useful,
+//      but WITHOUT ANY WARRANTY; without even the implied warranty of
+//      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//      GNU General Public License for more details.
+//
+//      You should have received a copy of the GNU General Public License
+//      along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "xml_binary.h"
+
+#include <cstring>
+#include "xml_parser.h"
+#include "properties.h"
+#include "compression_utils.h"
+#include "conversion.h"
+#include "platform_util.h"
+#include "util.h"
+#include "leak_dumper.h"
+
+using namespace std;
+using namespace Shared::Util;
+
+namespace Shared {
+	namespace Xml {
+
+		static const char binaryMagic[4] = { 'Z', 'G', 'X', 'B' };
+		static const uint32 binaryHeaderSize = 8;
+		static const uint32 chunkHeaderSize = 9;
+
+		static const uint8 chunkTypeData = 'D';
+		static const uint8 chunkTypeEnd = 'E';
+
+		enum XmlBinaryToken {
+			xbtEndElement,
+			xbtBeginElement,
+			xbtBeginElementWithText,
+			xbtAttribute
+		};
+
+		// a chunk can't reasonably get bigger than this, guards against
+		// allocating whatever a corrupt size field says
+		static const uint32 maxChunkSize = 64 * 1024 * 1024;
+
+		static FILE * openBinaryFile(const string &path, bool forWriting) {
+#if defined(WIN32) && !defined(__MINGW32__)
+			return _wfopen(utf8_decode(path).c_str(), (forWriting == true ? L"wb" : L"rb"));
+#else
+			return fopen(path.c_str(), (forWriting == true ? "wb" : "rb"));
+#endif
+		}
+
+		static uint32 decodeFixed32(const uint8 *data) {
+			return (uint32) data[0] | ((uint32) data[1] << 8) | ((uint32) data[2] << 16) | ((uint32) data[3] << 24);
+		}
+
+		// =====================================================
+		//	class XmlBinaryWriter
+		// =====================================================
+
+		const uint32 XmlBinaryWriter::formatVersion = 1;
+		const uint32 XmlBinaryWriter::chunkFlushSize = 64 * 1024;
+
+		XmlBinaryWriter::XmlBinaryWriter(const string &path, int compressionLevel) {
+			this->path = path;
+			this->compressionLevel = compressionLevel;
+			this->depth = 0;
+
+			file = openBinaryFile(path, true);
+			if (file == NULL) {
+				throw megaglest_runtime_error("Can not open file: [" + path + "]");
+			}
+
+			VarintWriter header;
+			header.writeFixed32(decodeFixed32((const uint8 *) binaryMagic));
+			header.writeFixed32(formatVersion);
+			if (fwrite(&header.getBuffer()[0], 1, header.getSize(), file) != header.getSize()) {
+				fclose(file);
+				file = NULL;
+				throw megaglest_runtime_error("Error writing file: [" + path + "]");
+			}
+		}
+
+		XmlBinaryWriter::~XmlBinaryWriter() {
+			// a writer that was never closed leaves a file without end
+			// chunk behind, which the reader refuses to load
+			if (file != NULL) {
+				fclose(file);
+				file = NULL;
+			}
+		}
+
+		void XmlBinaryWriter::writeName(const string &name) {
+			std::map<string, uint32>::iterator iterFind = nameIndexes.find(name);
+			if (iterFind != nameIndexes.end()) {
+				chunk.writeUInt32(iterFind->second + 1);
+			} else {
+				uint32 nameIndex = (uint32) nameIndexes.size();
+				nameIndexes[name] = nameIndex;
+				chunk.writeUInt32(0);
+				chunk.writeString(name);
+			}
+		}
+
+		void XmlBinaryWriter::beginElement(const string &name, const string &text) {
+			if (text.empty() == true) {
+				chunk.writeUInt32(xbtBeginElement);
+				writeName(name);
+			} else {
+				chunk.writeUInt32(xbtBeginElementWithText);
+				writeName(name);
+				chunk.writeString(text);
+			}
+			depth++;
+			flushChunk(false);
+		}
+
+		void XmlBinaryWriter::addAttribute(const string &name, const string &value) {
+			if (depth <= 0) {
+				throw megaglest_runtime_error("Attribute [" + name + "] written outside of an element to: [" + path + "]");
+			}
+			chunk.writeUInt32(xbtAttribute);
+			writeName(name);
+			chunk.writeString(value);
+			flushChunk(false);
+		}
+
+		void XmlBinaryWriter::endElement() {
+			if (depth <= 0) {
+				throw megaglest_runtime_error("Unbalanced element end written to: [" + path + "]");
+			}
+			chunk.writeUInt32(xbtEndElement);
+			depth--;
+			flushChunk(false);
+		}
+
+		void XmlBinaryWriter::writeNode(const XmlNode *node) {
+			beginElement(node->getName(), node->getText());
+			for (unsigned int index = 0; index < node->getAttributeCount(); ++index) {
+				const XmlAttribute *attribute = node->getAttribute(index);
+				addAttribute(attribute->getName(), attribute->getValue("", false));
+			}
+			for (unsigned int index = 0; index < node->getChildCount(); ++index) {
+				writeNode(node->getChild(index));
+			}
+			endElement();
+		}
+
+		void XmlBinaryWriter::flushChunk(bool force) {
+			if (chunk.getSize() == 0 || (force == false && chunk.getSize() < chunkFlushSize)) {
+				return;
+			}
+			writeChunk(chunkTypeData, &chunk.getBuffer()[0], chunk.getSize());
+			chunk.clear();
+		}
+
+		void XmlBinaryWriter::writeChunk(uint8 chunkType, const uint8 *data, uint32 rawSize) {
+			if (file == NULL) {
+				throw megaglest_runtime_error("Writing to closed file: [" + path + "]");
+			}
+
+			std::pair<unsigned char *, unsigned long> compressed(NULL, 0);
+			if (rawSize > 0 && compressionLevel > 0) {
+				compressed = Shared::CompressionUtil::compressMemoryToMemory((unsigned char *) data, rawSize, compressionLevel);
+				// keep whatever did not shrink as it is
+				if (compressed.second >= rawSize) {
+					delete[] compressed.first;
+					compressed.first = NULL;
+					compressed.second = 0;
+				}
+			}
+			const uint8 *storedData = (compressed.first != NULL ? compressed.first : data);
+			uint32 storedSize = (compressed.first != NULL ? (uint32) compressed.second : rawSize);
+
+			VarintWriter header;
+			header.writeFixed32(rawSize);
+			header.writeFixed32(storedSize);
+			uint8 headerData[chunkHeaderSize];
+			headerData[0] = chunkType;
+			memcpy(&headerData[1], &header.getBuffer()[0], header.getSize());
+
+			bool writeOk = (fwrite(headerData, 1, chunkHeaderSize, file) == chunkHeaderSize);
+			if (writeOk == true && storedSize > 0) {
+				writeOk = (fwrite(storedData, 1, storedSize, file) == storedSize);
+			}
+			delete[] compressed.first;
+
+			if (writeOk == false) {
+				throw megaglest_runtime_error("Error writing file: [" + path + "]");
+			}
+		}
+
+		void XmlBinaryWriter::close() {
+			if (file == NULL) {
+				return;
+			}
+			if (depth != 0) {
+				throw megaglest_runtime_error("Unclosed elements left while closing: [" + path + "] depth = " + intToStr(depth));
+			}
+			flushChunk(true);
+			writeChunk(chunkTypeEnd, NULL, 0);
+
+			int result = fclose(file);
+			file = NULL;
+			if (result != 0) {
+				throw megaglest_runtime_error("Error closing file: [" + path + "]");
+			}
+		}
+
+		// =====================================================
+		//	class XmlBinaryReader
+		// =====================================================
+
+		bool XmlBinaryReader::hasBinaryHeader(const char *data, size_t size) {
+			return size >= sizeof(binaryMagic) && memcmp(data, binaryMagic, sizeof(binaryMagic)) == 0;
+		}
+
+		bool XmlBinaryReader::isBinaryFile(const string &path) {
+			FILE *file = openBinaryFile(path, false);
+			if (file == NULL) {
+				return false;
+			}
+			char header[sizeof(binaryMagic)] = "";
+			size_t readBytes = fread(header, 1, sizeof(header), file);
+			fclose(file);
+			return hasBinaryHeader(header, readBytes);
+		}
+
+		XmlNode *XmlBinaryReader::load(const string &path, const std::map<string, string> &mapTagReplacementValues,
+			bool skipUpdatePathClimbingParts) {
+			FILE *file = openBinaryFile(path, false);
+			if (file == NULL) {
+				throw megaglest_runtime_error("Can not open file: [" + path + "]", true);
+			}
+
+			XmlNode *rootNode = NULL;
+			try {
+				uint8 header[binaryHeaderSize];
+				if (fread(header, 1, binaryHeaderSize, file) != binaryHeaderSize ||
+					hasBinaryHeader((const char *) header, binaryHeaderSize) == false) {
+					throw megaglest_runtime_error("Not a binary XML file: [" + path + "]");
+				}
+				uint32 version = decodeFixed32(&header[4]);
+				if (version == 0 || version > XmlBinaryWriter::formatVersion) {
+					throw megaglest_runtime_error("Unsupported binary XML version " + uIntToStr(version) + " in file: [" + path + "]");
+				}
+
+				vector<string> names;
+				vector<XmlNode *> nodeStack;
+				vector<uint8> storedData;
+				bool foundEnd = false;
+
+				for (;;) {
+					uint8 chunkHeader[chunkHeaderSize];
+					if (fread(chunkHeader, 1, chunkHeaderSize, file) != chunkHeaderSize) {
+						break;
+					}
+					uint32 rawSize = decodeFixed32(&chunkHeader[1]);
+					uint32 storedSize = decodeFixed32(&chunkHeader[5]);
+					if (chunkHeader[0] == chunkTypeEnd) {
+						foundEnd = true;
+						break;
+					}
+					if (chunkHeader[0] != chunkTypeData || rawSize > maxChunkSize || storedSize > maxChunkSize) {
+						throw megaglest_runtime_error("Corrupt chunk header in file: [" + path + "]");
+					}
+					if (rawSize == 0) {
+						continue;
+					}
+
+					storedData.resize(storedSize);
+					if (fread(&storedData[0], 1, storedSize, file) != storedSize) {
+						throw megaglest_runtime_error("Truncated chunk in file: [" + path + "]");
+					}
+
+					std::pair<unsigned char *, unsigned long> extracted(NULL, 0);
+					if (storedSize != rawSize) {
+						extracted = Shared::CompressionUtil::extractMemoryToMemory(&storedData[0], storedSize, rawSize);
+						if (extracted.second != rawSize) {
+							delete[] extracted.first;
+							throw megaglest_runtime_error("Corrupt compressed chunk in file: [" + path + "]");
+						}
+					}
+
+					try {
+						VarintReader reader((extracted.first != NULL ? extracted.first : &storedData[0]), rawSize);
+						while (reader.isAtEnd() == false) {
+							uint32 token = reader.readUInt32();
+							if (token == xbtEndElement) {
+								if (nodeStack.empty() == true) {
+									throw megaglest_runtime_error("Unbalanced element end in file: [" + path + "]");
+								}
+								nodeStack.pop_back();
+								continue;
+							}
+
+							uint32 nameRef = reader.readUInt32();
+							if (nameRef == 0) {
+								names.push_back(reader.readString());
+								nameRef = (uint32) names.size();
+							}
+							if (nameRef > names.size()) {
+								throw megaglest_runtime_error("Invalid name reference " + uIntToStr(nameRef) + " in file: [" + path + "]");
+							}
+							const string &name = names[nameRef - 1];
+
+							if (token == xbtBeginElement || token == xbtBeginElementWithText) {
+								string text;
+								if (token == xbtBeginElementWithText) {
+									text = reader.readString();
+									Properties::applyTagsToValue(text, &mapTagReplacementValues, skipUpdatePathClimbingParts);
+								}
+								if (nodeStack.empty() == true) {
+									if (rootNode != NULL) {
+										throw megaglest_runtime_error("More than one root element in file: [" + path + "]");
+									}
+									rootNode = new XmlNode(name);
+									rootNode->text = text;
+									nodeStack.push_back(rootNode);
+								} else {
+									nodeStack.push_back(nodeStack.back()->addChild(name, text));
+								}
+							} else if (token == xbtAttribute) {
+								string value = reader.readString();
+								if (nodeStack.empty() == true) {
+									throw megaglest_runtime_error("Attribute outside of an element in file: [" + path + "]");
+								}
+								nodeStack.back()->addAttribute(name, value, mapTagReplacementValues);
+							} else {
+								throw megaglest_runtime_error("Unknown token " + uIntToStr(token) + " in file: [" + path + "]");
+							}
+						}
+					} catch (...) {
+						delete[] extracted.first;
+						throw;
+					}
+					delete[] extracted.first;
+				}
+
+				if (foundEnd == false || rootNode == NULL || nodeStack.empty() == false) {
+					throw megaglest_runtime_error("Incomplete binary XML file: [" + path + "]");
+				}
+			} catch (...) {
+				fclose(file);
+				delete rootNode;
+				throw;
+			}
+
+			fclose(file);
+			return rootNode;
+		}
+
+	}
+}//end namespace
@@ -11,11 +11,14 @@
 
 #include "data_types.h"
 #include "xml_parser.h"
+#include "xml_binary.h"
 
 #include <fstream>
 #include <stdexcept>
 #include <vector>
 #include <algorithm>
+#include <cstring>
+#include <new>
 
 #include "conversion.h"
 
@@ -50,10 +53,105 @@ namespace Shared {
 
 		using namespace Util;
 
+		// =====================================================
+		//	class XmlArena
+		//
+		///	Bump allocator for the nodes and attributes of one
+		///	rapidxml load. It keeps the parse buffer alive, so
+		///	names and values can point into it, and is released
+		///	as a whole together with the root node.
+		// =====================================================
+
+		class XmlArena {
+		private:
+			enum {
+				minBlockSize = 4 * 1024,
+				maxBlockSize = 256 * 1024,
+				alignment = 16
+			};
+
+			vector<char *> blocks;
+			size_t blockSize;
+			size_t blockUsed;
+
+			XmlArena(XmlArena&);
+			void operator =(XmlArena&);
+
+		public:
+			vector<char> parseBuffer;
+			// the first character of every replacement tag, a value
+			// without any of them comes out of the replacement unchanged
+			string tagStartCharacters;
+
+			explicit XmlArena(size_t expectedSize) {
+				// nodes and attributes take a few times the size of their text
+				blockSize = max((size_t) minBlockSize, min((size_t) maxBlockSize, expectedSize * 4));
+				blockUsed = blockSize;
+			}
+			~XmlArena() {
+				for (unsigned int index = 0; index < blocks.size(); ++index) {
+					delete[] blocks[index];
+				}
+				blocks.clear();
+			}
+
+			void *allocate(size_t size) {
+				size = (size + alignment - 1) & ~((size_t) alignment - 1);
+				if (size > blockSize) {
+					char *block = new char[size];
+					blocks.insert(blocks.begin(), block);
+					return block;
+				}
+				if (blockUsed + size > blockSize) {
+					if (blocks.empty() == false) {
+						blockSize = min((size_t) maxBlockSize, blockSize * 2);
+					}
+					blocks.push_back(new char[blockSize]);
+					blockUsed = 0;
+				}
+				void *result = blocks.back() + blockUsed;
+				blockUsed += size;
+				return result;
+			}
+
+// leak_dumper.h may define new, which would break placement new
+#pragma push_macro("new")
+#undef new
+			template <typename T, typename P1, typename P2>
+			T *construct(P1 p1, const P2 &p2) {
+				T *result = ::new (allocate(sizeof(T))) T(p1, p2, this);
+				result->arenaAllocated = true;
+				return result;
+			}
+			template <typename T, typename P1, typename P2, typename P3>
+			T *construct(P1 p1, const P2 &p2, P3 p3) {
+				T *result = ::new (allocate(sizeof(T))) T(p1, p2, p3, this);
+				result->arenaAllocated = true;
+				return result;
+			}
+#pragma pop_macro("new")
+
+			void setTagReplacementValues(const std::map<string, string> &mapTagReplacementValues) {
+				// the path variables Properties::applyTagsToValue looks for
+				tagStartCharacters = "~$%{";
+				for (std::map<string, string>::const_iterator iterMap = mapTagReplacementValues.begin();
+					iterMap != mapTagReplacementValues.end(); ++iterMap) {
+					if (iterMap->first.empty() == false &&
+						tagStartCharacters.find(iterMap->first[0]) == string::npos) {
+						tagStartCharacters += iterMap->first[0];
+					}
+				}
+			}
+			bool mayHaveTags(const char *value) const {
+				return strpbrk(value, tagStartCharacters.c_str()) != NULL;
+			}
+		};
+
 		// =====================================================
 		//	class XmlIo
 		// =====================================================
 		bool XmlIoRapid::initialized = false;
+		bool XmlTree::arenaDefault = true;
 
 #if defined(WANT_XERCES)
 
@@ -332,7 +430,7 @@ namespace Shared {
 		}
 
 		XmlNode *XmlIoRapid::load(const string &path, const std::map<string, string> &mapTagReplacementValues,
-			bool noValidation, bool skipStackTrace, bool skipUpdatePathClimbingParts) {
+			bool noValidation, bool skipStackTrace, bool skipUpdatePathClimbingParts, bool useArena) {
 			bool showPerfStats = SystemFlags::VERBOSE_MODE_ENABLED;
 			Chrono chrono;
 			chrono.start();
@@ -356,6 +454,24 @@ namespace Shared {
 					throw megaglest_runtime_error("Can not open file: [" + path + "]", true);
 				}
 
+				// saved games may be stored in the binary format instead
+				char binaryHeader[4] = { 0 };
+				xmlFile.read(binaryHeader, 4);
+				bool isBinaryFile = XmlBinaryReader::hasBinaryHeader(binaryHeader, (size_t) xmlFile.gcount());
+				xmlFile.clear();
+				xmlFile.seekg(0);
+				if (isBinaryFile == true) {
+					xmlFile.close();
+#if defined(WIN32) && !defined(__MINGW32__)
+					if (fp) {
+						fclose(fp);
+					}
+#endif
+					rootNode = XmlBinaryReader::load(path, mapTagReplacementValues, skipUpdatePathClimbingParts);
+					if (showPerfStats) printf("In [%s::%s Line: %d] took msecs: " MG_I64_SPECIFIER " for binary file\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+					return rootNode;
+				}
+
 				if (showPerfStats) printf("In [%s::%s Line: %d] took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
 
 				xmlFile.unsetf(ios::skipws);
@@ -393,12 +509,31 @@ namespace Shared {
 
 				if (showPerfStats) printf("In [%s::%s Line: %d] took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
 
-				xml_document<> doc;
-				doc.parse<parse_no_data_nodes | parse_validate_closing_tags>(&buffer.front());
+				if (useArena == true) {
+					// the parsed strings stay where rapidxml put them, in the buffer
+					XmlArena *arena = new XmlArena((size_t) file_size);
+					arena->parseBuffer.swap(buffer);
+					arena->setTagReplacementValues(mapTagReplacementValues);
+					try {
+						xml_document<> doc;
+						doc.parse<parse_no_data_nodes | parse_validate_closing_tags>(&arena->parseBuffer.front());
+
+						if (showPerfStats) printf("In [%s::%s Line: %d] took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+
+						rootNode = new XmlNode(doc.first_node(), mapTagReplacementValues, skipUpdatePathClimbingParts, arena);
+						rootNode->ownedArena = arena;
+					} catch (...) {
+						delete arena;
+						throw;
+					}
+				} else {
+					xml_document<> doc;
+					doc.parse<parse_no_data_nodes | parse_validate_closing_tags>(&buffer.front());
 
-				if (showPerfStats) printf("In [%s::%s Line: %d] took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
+					if (showPerfStats) printf("In [%s::%s Line: %d] took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
 
-				rootNode = new XmlNode(doc.first_node(), mapTagReplacementValues, skipUpdatePathClimbingParts);
+					rootNode = new XmlNode(doc.first_node(), mapTagReplacementValues, skipUpdatePathClimbingParts);
+				}
 
 				if (showPerfStats) printf("In [%s::%s Line: %d] took msecs: " MG_I64_SPECIFIER "\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, chrono.getMillis());
 
@@ -517,6 +652,7 @@ namespace Shared {
 			}
 
 			this->engine_type = engine_type;
+			this->useArena = arenaDefault;
 			this->skipStackCheck = false;
 			this->skipUpdatePathClimbingParts = false;
 		}
@@ -565,7 +701,10 @@ namespace Shared {
 			} else
 #endif
 			{
-				this->rootNode = XmlIoRapid::getInstance().load(path, mapTagReplacementValues, noValidation, skipStackTrace, this->skipUpdatePathClimbingParts);
+				this->rootNode = XmlPreloadCache::take(path, mapTagReplacementValues, this->skipUpdatePathClimbingParts);
+				if (this->rootNode == NULL) {
+					this->rootNode = XmlIoRapid::getInstance().load(path, mapTagReplacementValues, noValidation, skipStackTrace, this->skipUpdatePathClimbingParts, this->useArena);
+				}
 			}
 
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] about to load [%s]\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str());
@@ -583,6 +722,20 @@ namespace Shared {
 			}
 		}
 
+		void XmlTree::saveBinary(const string &path, int compressionLevel) {
+			if (rootNode == NULL) {
+				throw megaglest_runtime_error("rootNode == NULL during save!");
+			}
+			try {
+				XmlBinaryWriter writer(path, compressionLevel);
+				writer.writeNode(rootNode);
+				writer.close();
+			} catch (const exception &e) {
+				SystemFlags::OutputDebug(SystemFlags::debugError, "In [%s::%s Line: %d] Exception while saving: [%s], %s\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str(), e.what());
+				throw megaglest_runtime_error("Exception while saving [" + path + "] msg: " + e.what());
+			}
+		}
+
 		void XmlTree::clearRootNode() {
 			if (this->skipStackCheck == false) {
 				LoadStack &loadStack = CacheManager::getCachedItem<LoadStack>(loadStackCacheName);
@@ -605,13 +758,173 @@ namespace Shared {
 			clearRootNode();
 		}
 
+		// =====================================================
+		//	class XmlPreloadCache
+		// =====================================================
+
+		enum XmlPreloadState {
+			xpsParsing,
+			xpsReady,
+			xpsTaken
+		};
+
+		class XmlPreloadEntry {
+		public:
+			XmlPreloadState state;
+			XmlNode *rootNode;
+
+			XmlPreloadEntry() {
+				state = xpsParsing;
+				rootNode = NULL;
+			}
+		};
+
+		class XmlPreloadStore {
+		public:
+			bool enabled;
+			std::map<string, XmlPreloadEntry> entries;
+			uint32 hits;
+			uint32 misses;
+
+			XmlPreloadStore() {
+				enabled = false;
+				hits = 0;
+				misses = 0;
+			}
+		};
+
+		static string preloadStoreCacheName = string(__FILE__) + string("_preloadStoreCacheName");
+
+		// a tree only fits a load with the very same replacements
+		static string getPreloadKey(const string &path, const std::map<string, string> &mapTagReplacementValues, bool skipUpdatePathClimbingParts) {
+			string key = path + (skipUpdatePathClimbingParts == true ? "\n1" : "\n0");
+			for (std::map<string, string>::const_iterator iterMap = mapTagReplacementValues.begin();
+				iterMap != mapTagReplacementValues.end(); ++iterMap) {
+				key += "\n" + iterMap->first + "=" + iterMap->second;
+			}
+			return key;
+		}
+
+		void XmlPreloadCache::enable() {
+			XmlPreloadStore &store = CacheManager::getCachedItem<XmlPreloadStore>(preloadStoreCacheName);
+			Mutex &mutex = CacheManager::getMutexForItem<XmlPreloadStore>(preloadStoreCacheName);
+			MutexSafeWrapper safeMutex(&mutex);
+			store.enabled = true;
+			store.hits = 0;
+			store.misses = 0;
+		}
+
+		void XmlPreloadCache::disable() {
+			XmlPreloadStore &store = CacheManager::getCachedItem<XmlPreloadStore>(preloadStoreCacheName);
+			Mutex &mutex = CacheManager::getMutexForItem<XmlPreloadStore>(preloadStoreCacheName);
+			MutexSafeWrapper safeMutex(&mutex);
+			store.enabled = false;
+			for (std::map<string, XmlPreloadEntry>::iterator iterMap = store.entries.begin();
+				iterMap != store.entries.end(); ++iterMap) {
+				delete iterMap->second.rootNode;
+			}
+			// a tree still being parsed is deleted by its loader thread
+			store.entries.clear();
+		}
+
+		bool XmlPreloadCache::isEnabled() {
+			XmlPreloadStore &store = CacheManager::getCachedItem<XmlPreloadStore>(preloadStoreCacheName);
+			Mutex &mutex = CacheManager::getMutexForItem<XmlPreloadStore>(preloadStoreCacheName);
+			MutexSafeWrapper safeMutex(&mutex);
+			return store.enabled;
+		}
+
+		bool XmlPreloadCache::preload(const string &path, const std::map<string, string> &mapTagReplacementValues, bool skipUpdatePathClimbingParts) {
+			string key = getPreloadKey(path, mapTagReplacementValues, skipUpdatePathClimbingParts);
+
+			XmlPreloadStore &store = CacheManager::getCachedItem<XmlPreloadStore>(preloadStoreCacheName);
+			Mutex &mutex = CacheManager::getMutexForItem<XmlPreloadStore>(preloadStoreCacheName);
+			MutexSafeWrapper safeMutex(&mutex);
+			if (store.enabled == false || store.entries.find(key) != store.entries.end()) {
+				return false;
+			}
+			store.entries[key] = XmlPreloadEntry();
+			safeMutex.ReleaseLock(true);
+
+			XmlNode *rootNode = NULL;
+			try {
+				rootNode = XmlIoRapid::getInstance().load(path, mapTagReplacementValues, false, true, skipUpdatePathClimbingParts, XmlTree::getArenaDefault());
+			} catch (const exception &ex) {
+				if (SystemFlags::VERBOSE_MODE_ENABLED) printf("In [%s::%s Line: %d] preloading [%s] failed: %s\n", extractFileFromDirectoryPath(__FILE__).c_str(), __FUNCTION__, __LINE__, path.c_str(), ex.what());
+			}
+
+			safeMutex.Lock();
+			std::map<string, XmlPreloadEntry>::iterator iterFind = store.entries.find(key);
+			if (iterFind == store.entries.end() || iterFind->second.state != xpsParsing) {
+				// the cache was dropped meanwhile
+				delete rootNode;
+				return false;
+			}
+			if (rootNode == NULL) {
+				store.entries.erase(iterFind);
+				return false;
+			}
+			iterFind->second.state = xpsReady;
+			iterFind->second.rootNode = rootNode;
+			return true;
+		}
+
+		XmlNode *XmlPreloadCache::take(const string &path, const std::map<string, string> &mapTagReplacementValues, bool skipUpdatePathClimbingParts) {
+			XmlPreloadStore &store = CacheManager::getCachedItem<XmlPreloadStore>(preloadStoreCacheName);
+			Mutex &mutex = CacheManager::getMutexForItem<XmlPreloadStore>(preloadStoreCacheName);
+			MutexSafeWrapper safeMutex(&mutex);
+			if (store.enabled == false) {
+				return NULL;
+			}
+
+			string key = getPreloadKey(path, mapTagReplacementValues, skipUpdatePathClimbingParts);
+			for (;;) {
+				std::map<string, XmlPreloadEntry>::iterator iterFind = store.entries.find(key);
+				if (iterFind == store.entries.end()) {
+					// loaded here, the loader threads skip it from now on
+					store.entries[key].state = xpsTaken;
+					store.misses++;
+					return NULL;
+				}
+				if (iterFind->second.state == xpsReady) {
+					XmlNode *rootNode = iterFind->second.rootNode;
+					iterFind->second.rootNode = NULL;
+					iterFind->second.state = xpsTaken;
+					store.hits++;
+					return rootNode;
+				}
+				if (iterFind->second.state == xpsTaken || store.enabled == false) {
+					return NULL;
+				}
+
+				// a loader thread is half way through, waiting beats parsing twice
+				safeMutex.ReleaseLock(true);
+				sleep(1);
+				safeMutex.Lock();
+			}
+		}
+
+		uint32 XmlPreloadCache::getHits() {
+			XmlPreloadStore &store = CacheManager::getCachedItem<XmlPreloadStore>(preloadStoreCacheName);
+			Mutex &mutex = CacheManager::getMutexForItem<XmlPreloadStore>(preloadStoreCacheName);
+			MutexSafeWrapper safeMutex(&mutex);
+			return store.hits;
+		}
+
+		uint32 XmlPreloadCache::getMisses() {
+			XmlPreloadStore &store = CacheManager::getCachedItem<XmlPreloadStore>(preloadStoreCacheName);
+			Mutex &mutex = CacheManager::getMutexForItem<XmlPreloadStore>(preloadStoreCacheName);
+			MutexSafeWrapper safeMutex(&mutex);
+			return store.misses;
+		}
+
 		// =====================================================
 		//	class XmlNode
 		// =====================================================
 
 #if defined(WANT_XERCES)
 
-		XmlNode::XmlNode(DOMNode *node, const std::map<string, string> &mapTagReplacementValues) : superNode(NULL) {
+		XmlNode::XmlNode(DOMNode *node, const std::map<string, string> &mapTagReplacementValues) : superNode(NULL), arenaAllocated(false), ownedArena(NULL) {
 			if (node == NULL || node->getNodeName() == NULL) {
 				throw megaglest_runtime_error("XML structure seems to be corrupt!", true);
 			}
@@ -661,15 +974,17 @@ namespace Shared {
 #endif
 
 		XmlNode::XmlNode(xml_node<> *node, const std::map<string, string> &mapTagReplacementValues,
-			bool skipUpdatePathClimbingParts) : superNode(NULL) {
+			bool skipUpdatePathClimbingParts) : XmlNode(node, mapTagReplacementValues, skipUpdatePathClimbingParts, NULL) {
+		}
+
+		XmlNode::XmlNode(xml_node<> *node, const std::map<string, string> &mapTagReplacementValues,
+			bool skipUpdatePathClimbingParts, XmlArena *arena) : superNode(NULL), arenaAllocated(false), ownedArena(NULL) {
 			if (node == NULL || node->name() == NULL) {
 				throw megaglest_runtime_error("XML structure seems to be corrupt!", true);
 			}
 
 			//get name
 			name = node->name();
-			children.reserve(1000);
-			attributes.reserve(1000);
 
 			//check document
 			if (node->type() == node_document) {
@@ -679,51 +994,96 @@ namespace Shared {
 			if (SystemFlags::VERBOSE_MODE_ENABLED) printf("Found XML Node\nName [%s]\nValue [%s]\n", name.c_str(), node->value());
 
 			//check children
+			unsigned int childCount = 0;
+			for (xml_node<> *currentNode = node->first_node();
+				currentNode; currentNode = currentNode->next_sibling()) {
+				if (currentNode->type() == node_element) {
+					childCount++;
+				}
+			}
+			children.reserve(childCount);
 			for (xml_node<> *currentNode = node->first_node();
 				currentNode; currentNode = currentNode->next_sibling()) {
 				if (currentNode != NULL && currentNode->type() == node_element) {
-					XmlNode *xmlNode = new XmlNode(currentNode, mapTagReplacementValues, skipUpdatePathClimbingParts);
+					XmlNode *xmlNode = NULL;
+					if (arena != NULL) {
+						xmlNode = arena->construct<XmlNode>(currentNode, mapTagReplacementValues, skipUpdatePathClimbingParts);
+					} else {
+						xmlNode = new XmlNode(currentNode, mapTagReplacementValues, skipUpdatePathClimbingParts);
+					}
 					children.push_back(xmlNode);
 				}
 			}
 
 			//check attributes
+			unsigned int attributeCount = 0;
 			for (xml_attribute<> *attr = node->first_attribute();
 				attr; attr = attr->next_attribute()) {
-				XmlAttribute *xmlAttribute = new XmlAttribute(attr, mapTagReplacementValues);
+				attributeCount++;
+			}
+			attributes.reserve(attributeCount);
+			for (xml_attribute<> *attr = node->first_attribute();
+				attr; attr = attr->next_attribute()) {
+				XmlAttribute *xmlAttribute = NULL;
+				if (arena != NULL) {
+					xmlAttribute = arena->construct<XmlAttribute>(attr, mapTagReplacementValues);
+				} else {
+					xmlAttribute = new XmlAttribute(attr, mapTagReplacementValues);
+				}
 				attributes.push_back(xmlAttribute);
 			}
 
 			//get value
 			if (node->type() == node_element && children.size() == 0) {
-				string xmlText = node->value();
-
-				//		bool debugReplace = false;
-				//		if(xmlText.find("{SCENARIOPATH}") != string::npos) {
-				//			printf("\n----------------------\n** XML!! WILL REPLACE [%s]\n",xmlText.c_str());
-				//			debugReplace = true;
-				//		}
-				Properties::applyTagsToValue(xmlText, &mapTagReplacementValues, skipUpdatePathClimbingParts);
-				//		if(debugReplace) {
-				//			printf("\n\n** XML!! REPLACED WITH [%s]\n===================\n",xmlText.c_str());
-				//		}
-				text = xmlText;
+				if (arena != NULL && arena->mayHaveTags(node->value()) == false) {
+					text = node->value();
+				} else {
+					string xmlText = node->value();
+
+					//		bool debugReplace = false;
+					//		if(xmlText.find("{SCENARIOPATH}") != string::npos) {
+					//			printf("\n----------------------\n** XML!! WILL REPLACE [%s]\n",xmlText.c_str());
+					//			debugReplace = true;
+					//		}
+					Properties::applyTagsToValue(xmlText, &mapTagReplacementValues, skipUpdatePathClimbingParts);
+					//		if(debugReplace) {
+					//			printf("\n\n** XML!! REPLACED WITH [%s]\n===================\n",xmlText.c_str());
+					//		}
+					text = xmlText;
+				}
 			}
 		}
 
-		XmlNode::XmlNode(const string &name) : superNode(NULL) {
+		XmlNode::XmlNode(const string &name) : superNode(NULL), arenaAllocated(false), ownedArena(NULL) {
 			this->name = name;
 		}
 
 		XmlNode::~XmlNode() {
 			for (unsigned int i = 0; i < children.size(); ++i) {
-				delete children[i];
+				deleteNode(children[i]);
 			}
 			children.clear();
 			for (unsigned int i = 0; i < attributes.size(); ++i) {
-				delete attributes[i];
+				if (attributes[i]->arenaAllocated == true) {
+					attributes[i]->~XmlAttribute();
+				} else {
+					delete attributes[i];
+				}
 			}
 			attributes.clear();
+
+			// last, the names and values above pointed into it
+			delete ownedArena;
+			ownedArena = NULL;
+		}
+
+		void XmlNode::deleteNode(XmlNode *node) {
+			if (node != NULL && node->arenaAllocated == true) {
+				// the arena of the root node frees the memory
+				node->~XmlNode();
+			} else {
+				delete node;
+			}
 		}
 
 		XmlAttribute *XmlNode::getAttribute(unsigned int i) const {
@@ -761,7 +1121,7 @@ namespace Shared {
 			int clearChildCount = 0;
 			for (int i = (int) children.size() - 1; i >= 0; --i) {
 				if (children[i]->getName() == childName) {
-					delete children[i];
+					deleteNode(children[i]);
 					children.erase(children.begin() + i);
 					clearChildCount++;
 				}
@@ -961,15 +1321,17 @@ namespace Shared {
 				throw megaglest_runtime_error("XML attribute seems to be corrupt!");
 			}
 
+			nameRef = NULL;
+			valueRef = NULL;
+			arenaAllocated = false;
 			skipRestrictionCheck = false;
 			usesCommondata = false;
-			this->mapTagReplacementValues = mapTagReplacementValues;
 			char str[strSize] = "";
 
 			XMLString::transcode(attribute->getNodeValue(), str, strSize - 1);
 			value = str;
 			usesCommondata = ((value.find("$COMMONDATAPATH") != string::npos) || (value.find("%%COMMONDATAPATH%%") != string::npos));
-			skipRestrictionCheck = Properties::applyTagsToValue(this->value, &this->mapTagReplacementValues);
+			skipRestrictionCheck = Properties::applyTagsToValue(this->value, &mapTagReplacementValues);
 
 			XMLString::transcode(attribute->getNodeName(), str, strSize - 1);
 			name = str;
@@ -977,81 +1339,97 @@ namespace Shared {
 
 #endif
 
-		XmlAttribute::XmlAttribute(xml_attribute<> *attribute, const std::map<string, string> &mapTagReplacementValues) {
+		XmlAttribute::XmlAttribute(xml_attribute<> *attribute, const std::map<string, string> &mapTagReplacementValues) :
+			XmlAttribute(attribute, mapTagReplacementValues, NULL) {
+		}
+
+		XmlAttribute::XmlAttribute(xml_attribute<> *attribute, const std::map<string, string> &mapTagReplacementValues, XmlArena *arena) {
 			if (attribute == NULL || attribute->name() == NULL) {
 				throw megaglest_runtime_error("XML attribute seems to be corrupt!");
 			}
 
+			nameRef = NULL;
+			valueRef = NULL;
+			arenaAllocated = false;
 			skipRestrictionCheck = false;
 			usesCommondata = false;
-			if (mapTagReplacementValues.size() > 0) {
-				this->mapTagReplacementValues = mapTagReplacementValues;
-			}
 			//char str[strSize]				= "";
 
 			//XMLString::transcode(attribute->getNodeValue(), str, strSize-1);
-			value = attribute->value();
-			usesCommondata = ((value.find("$COMMONDATAPATH") != string::npos) || (value.find("%%COMMONDATAPATH%%") != string::npos));
-			skipRestrictionCheck = Properties::applyTagsToValue(this->value, &this->mapTagReplacementValues);
+			if (arena != NULL && arena->mayHaveTags(attribute->value()) == false) {
+				// nothing to replace, the value stays in the parse buffer
+				valueRef = attribute->value();
+			} else {
+				value = attribute->value();
+				usesCommondata = ((value.find("$COMMONDATAPATH") != string::npos) || (value.find("%%COMMONDATAPATH%%") != string::npos));
+				skipRestrictionCheck = Properties::applyTagsToValue(this->value, &mapTagReplacementValues);
+			}
 
 			//XMLString::transcode(attribute->getNodeName(), str, strSize-1);
-			name = attribute->name();
+			if (arena != NULL) {
+				nameRef = attribute->name();
+			} else {
+				name = attribute->name();
+			}
 		}
 
 		XmlAttribute::XmlAttribute(const string &name, const string &value, const std::map<string, string> &mapTagReplacementValues) {
+			nameRef = NULL;
+			valueRef = NULL;
+			arenaAllocated = false;
 			skipRestrictionCheck = false;
 			usesCommondata = false;
-			if (mapTagReplacementValues.size() > 0) {
-				this->mapTagReplacementValues = mapTagReplacementValues;
-			}
 			this->name = name;
 			this->value = value;
 
 			usesCommondata = ((value.find("$COMMONDATAPATH") != string::npos) || (value.find("%%COMMONDATAPATH%%") != string::npos));
-			skipRestrictionCheck = Properties::applyTagsToValue(this->value, &this->mapTagReplacementValues);
+			skipRestrictionCheck = Properties::applyTagsToValue(this->value, &mapTagReplacementValues);
 		}
 
 		bool XmlAttribute::getBoolValue() const {
-			if (value == "true") {
+			const string rawValue = getRawValue();
+			if (rawValue == "true") {
 				return true;
-			} else if (value == "false") {
+			} else if (rawValue == "false") {
 				return false;
 			} else {
-				throw megaglest_runtime_error("Not a valid bool value (true or false): " + getName() + ": " + value, true);
+				throw megaglest_runtime_error("Not a valid bool value (true or false): " + getName() + ": " + rawValue, true);
 			}
 		}
 
 		int XmlAttribute::getIntValue() const {
-			return strToInt(value);
+			return strToInt(getRawValue());
 		}
 
 		uint32 XmlAttribute::getUIntValue() const {
-			return strToUInt(value);
+			return strToUInt(getRawValue());
 		}
 
 		int XmlAttribute::getIntValue(int min, int max) const {
-			int i = strToInt(value);
+			const string rawValue = getRawValue();
+			int i = strToInt(rawValue);
 			if (i<min || i>max) {
-				throw megaglest_runtime_error("Xml Attribute int out of range: " + getName() + ": " + value, true);
+				throw megaglest_runtime_error("Xml Attribute int out of range: " + getName() + ": " + rawValue, true);
 			}
 			return i;
 		}
 
 		float XmlAttribute::getFloatValue() const {
-			return strToFloat(value);
+			return strToFloat(getRawValue());
 		}
 
 		float XmlAttribute::getFloatValue(float min, float max) const {
-			float f = strToFloat(value);
+			const string rawValue = getRawValue();
+			float f = strToFloat(rawValue);
 			//printf("getFloatValue f = %.10f [%s]\n",f,value.c_str());
 			if (f<min || f>max) {
-				throw megaglest_runtime_error("Xml attribute float out of range: " + getName() + ": " + value, true);
+				throw megaglest_runtime_error("Xml attribute float out of range: " + getName() + ": " + rawValue, true);
 			}
 			return f;
 		}
 
 		const string XmlAttribute::getValue(string prefixValue, bool trimValueWithStartingSlash) const {
-			string result = value;
+			string result = getRawValue();
 			if (skipRestrictionCheck == false && usesCommondata == false) {
 				if (trimValueWithStartingSlash == true) {
 					trimPathWithStartingSlash(result);
@@ -1062,19 +1440,20 @@ namespace Shared {
 		}
 
 		const string XmlAttribute::getRestrictedValue(string prefixValue, bool trimValueWithStartingSlash) const {
+			const string rawValue = getRawValue();
 			if (skipRestrictionCheck == false && usesCommondata == false) {
 				const string allowedCharacters = "abcdefghijklmnopqrstuvwxyz1234567890._-/";
 
-				for (unsigned int i = 0; i < value.size(); ++i) {
-					if (allowedCharacters.find(value[i]) == string::npos) {
+				for (unsigned int i = 0; i < rawValue.size(); ++i) {
+					if (allowedCharacters.find(rawValue[i]) == string::npos) {
 						throw megaglest_runtime_error(
-							string("The string \"" + value + "\" contains a character that is not allowed: \"") + value[i] +
+							string("The string \"" + rawValue + "\" contains a character that is not allowed: \"") + rawValue[i] +
 							"\"\nFor portability reasons the only allowed characters in this field are: " + allowedCharacters, true);
 					}
 				}
 			}
 
-			string result = value;
+			string result = rawValue;
 			if (skipRestrictionCheck == false && usesCommondata == false) {
 				if (trimValueWithStartingSlash == true) {
 					trimPathWithStartingSlash(result);
@@ -1086,6 +1465,7 @@ namespace Shared {
 
 		void XmlAttribute::setValue(string val) {
 			value = val;
+			valueRef = NULL;
 		}
 
 	}
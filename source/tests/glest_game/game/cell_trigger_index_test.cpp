@@ -0,0 +1,480 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "cell_trigger_index.h"
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <vector>
+
+using namespace Shared::Graphics;
+using namespace Glest::Game;
+
+namespace {
+
+	enum ModelEventType {
+		metUnit,
+		metFaction,
+		metFactionPos,
+		metFactionAreaPos,
+		metAreaPos,
+
+		metCount
+	};
+
+	struct ModelEvent {
+		ModelEventType type;
+		int sourceId;
+		Vec2i destPos;
+		Vec2i destPosEnd;
+		std::set<int> unitsInside;
+		int triggerCount;
+	};
+
+	struct ModelUnit {
+		int id;
+		int factionIndex;
+		int size;
+		Vec2i pos;
+	};
+
+	class ModelRandom {
+	private:
+		unsigned int seed;
+
+	public:
+		explicit ModelRandom(unsigned int seed) : seed(seed) {
+		}
+
+		int next(int minValue, int maxValue) {
+			seed = seed * 1103515245 + 12345;
+			return minValue + (int) ((seed >> 16) % (unsigned int) (maxValue - minValue + 1));
+		}
+	};
+
+	//
+	// The cell trigger dispatch of ScriptManager with the lua calls and the
+	// map taken out. The exact test of each event type is the one
+	// onCellTriggerEvent runs, the index only picks which events get tested.
+	// Without the index every registered event is tested in id order, the
+	// way the dispatch worked before it.
+	//
+	class CellTriggerModel {
+	public:
+		static const int unitCount = 6;
+		static const int factionCount = 4;
+
+		int w;
+		int h;
+		bool useIndex;
+		CellTriggerEventIndex index;
+		std::map<int, ModelEvent> events;
+		std::vector<int> delayedRemovals;
+		bool inDispatch;
+		int nextEventId;
+		ModelRandom random;
+		// the script reacts to every fired event
+		bool runScript;
+		std::set<int> unregisterOnFire;
+		int exitCount;
+
+		CellTriggerModel(int w, int h, bool useIndex) : random(777) {
+			this->w = w;
+			this->h = h;
+			this->useIndex = useIndex;
+			index.init(w, h);
+			inDispatch = false;
+			nextEventId = 1;
+			runScript = false;
+			exitCount = 0;
+		}
+
+		void indexEvent(int eventId, const ModelEvent &event, bool add) {
+			switch (event.type) {
+				case metUnit:
+					if (add == true) {
+						index.addUnitEvent(eventId, event.sourceId);
+					} else {
+						index.removeUnitEvent(eventId, event.sourceId);
+					}
+					break;
+				case metFaction:
+					if (add == true) {
+						index.addFactionEvent(eventId, event.sourceId);
+					} else {
+						index.removeFactionEvent(eventId, event.sourceId);
+					}
+					break;
+				default:
+				{
+					Vec2i posEnd = (event.type == metFactionPos ? event.destPos : event.destPosEnd);
+					if (add == true) {
+						index.addAreaEvent(eventId, event.destPos, posEnd);
+					} else {
+						index.removeAreaEvent(eventId, event.destPos, posEnd);
+					}
+				}
+				break;
+			}
+		}
+
+		int registerEvent(const ModelEvent &event) {
+			int eventId = nextEventId++;
+			events[eventId] = event;
+			indexEvent(eventId, event, true);
+			return eventId;
+		}
+
+		void unregisterEvent(int eventId) {
+			if (events.find(eventId) != events.end()) {
+				if (inDispatch == false) {
+					eraseEvent(eventId);
+				} else {
+					delayedRemovals.push_back(eventId);
+				}
+			}
+			if (inDispatch == false) {
+				for (unsigned int removal = 0; removal < delayedRemovals.size(); ++removal) {
+					eraseEvent(delayedRemovals[removal]);
+				}
+				delayedRemovals.clear();
+			}
+		}
+
+		void eraseEvent(int eventId) {
+			std::map<int, ModelEvent>::iterator iterFind = events.find(eventId);
+			if (iterFind != events.end()) {
+				indexEvent(eventId, iterFind->second, false);
+				events.erase(iterFind);
+			}
+		}
+
+		ModelEvent makeRandomEvent() {
+			ModelEvent event;
+			event.type = (ModelEventType) random.next(0, metCount - 1);
+			event.triggerCount = 0;
+			if (event.type == metUnit) {
+				event.sourceId = random.next(1, unitCount);
+			} else {
+				event.sourceId = random.next(0, factionCount - 1);
+			}
+			// areas may reach past the map edges, or be empty
+			event.destPos = Vec2i(random.next(-3, w + 1), random.next(-3, h + 1));
+			event.destPosEnd = event.destPos + Vec2i(random.next(-1, 20), random.next(-1, 20));
+			if (random.next(0, 3) == 0) {
+				event.destPos.x = (random.next(0, 1) == 0 ? 0 : w - 1);
+			}
+			return event;
+		}
+
+		// the area cell test of Map::isInUnitTypeCells
+		bool coversCell(const ModelUnit &unit, int x, int y) const {
+			if (unit.pos.x < 0 || unit.pos.y < 0 || unit.pos.x >= w || unit.pos.y >= h) {
+				return false;
+			}
+			return (unit.pos.x >= x && unit.pos.x <= x + unit.size - 1 &&
+				unit.pos.y >= y && unit.pos.y <= y + unit.size - 1);
+		}
+
+		bool coversArea(const ModelUnit &unit, const Vec2i &pos, const Vec2i &posEnd) const {
+			for (int x = pos.x; x <= posEnd.x; ++x) {
+				for (int y = pos.y; y <= posEnd.y; ++y) {
+					if (coversCell(unit, x, y) == true) {
+						return true;
+					}
+				}
+			}
+			return false;
+		}
+
+		bool testEvent(int eventId, ModelEvent &event, const ModelUnit &unit) {
+			bool nextToDest = (abs(unit.pos.x - event.destPos.x) <= 1 && abs(unit.pos.y - event.destPos.y) <= 1);
+			switch (event.type) {
+				case metUnit:
+					return (unit.id == event.sourceId && nextToDest == true);
+				case metFaction:
+					return (unit.factionIndex == event.sourceId && nextToDest == true);
+				case metFactionPos:
+					return (unit.factionIndex == event.sourceId && coversCell(unit, event.destPos.x, event.destPos.y) == true);
+				case metFactionAreaPos:
+					return (unit.factionIndex == event.sourceId && coversArea(unit, event.destPos, event.destPosEnd) == true);
+				default:
+				{
+					bool inside = coversArea(unit, event.destPos, event.destPosEnd);
+					if (event.unitsInside.find(unit.id) == event.unitsInside.end()) {
+						if (inside == true) {
+							event.unitsInside.insert(unit.id);
+							index.setUnitInsideArea(eventId, unit.id, true);
+						}
+						return inside;
+					}
+					if (inside == false) {
+						event.unitsInside.erase(unit.id);
+						index.setUnitInsideArea(eventId, unit.id, false);
+						exitCount++;
+					}
+					return (inside == false);
+				}
+			}
+		}
+
+		void onEventFired(int eventId, ModelEvent &event, ModelUnit &unit) {
+			if (unregisterOnFire.find(eventId) != unregisterOnFire.end()) {
+				unregisterEvent(eventId);
+			}
+			if (runScript == false) {
+				return;
+			}
+			int key = eventId * 7919 + event.triggerCount * 104729;
+			if (key % 4 == 0) {
+				unregisterEvent(eventId);
+			}
+			if (key % 6 == 1) {
+				registerEvent(makeRandomEvent());
+			}
+			if (key % 9 == 2) {
+				unit.pos.x = std::min(std::max(unit.pos.x + random.next(-1, 1), 0), w - 1);
+				unit.pos.y = std::min(std::max(unit.pos.y + random.next(-1, 1), 0), h - 1);
+			}
+			if (key % 13 == 3 && events.empty() == false) {
+				unregisterEvent(events.begin()->first);
+			}
+		}
+
+		void dispatch(ModelUnit &unit, std::vector<int> &fired) {
+			unregisterEvent(-1);
+			inDispatch = true;
+			if (useIndex == true) {
+				std::set<int> eventIds;
+				index.findEvents(unit.id, unit.factionIndex, unit.pos, unit.size, eventIds);
+				for (std::set<int>::iterator iterSet = eventIds.begin(); iterSet != eventIds.end(); ++iterSet) {
+					std::map<int, ModelEvent>::iterator iterMap = events.find(*iterSet);
+					if (iterMap == events.end() || testEvent(iterMap->first, iterMap->second, unit) == false) {
+						continue;
+					}
+					iterMap->second.triggerCount++;
+					fired.push_back(iterMap->first);
+					onEventFired(iterMap->first, iterMap->second, unit);
+					index.findEvents(unit.id, unit.factionIndex, unit.pos, unit.size, eventIds);
+				}
+			} else {
+				int lastEventId = 0;
+				for (std::map<int, ModelEvent>::iterator iterMap = events.upper_bound(lastEventId);
+					iterMap != events.end(); iterMap = events.upper_bound(lastEventId)) {
+					lastEventId = iterMap->first;
+					if (testEvent(iterMap->first, iterMap->second, unit) == false) {
+						continue;
+					}
+					iterMap->second.triggerCount++;
+					fired.push_back(iterMap->first);
+					onEventFired(iterMap->first, iterMap->second, unit);
+				}
+			}
+			inDispatch = false;
+		}
+	};
+
+}
+
+//
+// Tests for the index picking the cell trigger events a moving unit can set off
+//
+class CellTriggerEventIndexTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( CellTriggerEventIndexTest );
+
+	CPPUNIT_TEST( test_random_moves_match_full_walk );
+	CPPUNIT_TEST( test_large_unit_at_map_edge );
+	CPPUNIT_TEST( test_leaving_area_far_away );
+	CPPUNIT_TEST( test_unregister_during_callback );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	// a map size that leaves the last buckets partly off the map
+	static const int mapW = 70;
+	static const int mapH = 45;
+
+	ModelUnit makeUnit(int id, int factionIndex, int size, const Vec2i &pos) {
+		ModelUnit unit;
+		unit.id = id;
+		unit.factionIndex = factionIndex;
+		unit.size = size;
+		unit.pos = pos;
+		return unit;
+	}
+
+	ModelEvent makeAreaEvent(ModelEventType type, int sourceId, const Vec2i &pos, const Vec2i &posEnd) {
+		ModelEvent event;
+		event.type = type;
+		event.sourceId = sourceId;
+		event.destPos = pos;
+		event.destPosEnd = posEnd;
+		event.triggerCount = 0;
+		return event;
+	}
+
+public:
+
+	void test_random_moves_match_full_walk() {
+		CellTriggerModel indexed(mapW, mapH, true);
+		CellTriggerModel walked(mapW, mapH, false);
+		indexed.runScript = true;
+		walked.runScript = true;
+
+		std::vector<ModelUnit> indexedUnits;
+		for (int id = 1; id <= CellTriggerModel::unitCount; ++id) {
+			indexedUnits.push_back(makeUnit(id, id % CellTriggerModel::factionCount, 1 + id % 3, Vec2i(id * 9, id * 5)));
+		}
+		std::vector<ModelUnit> walkedUnits = indexedUnits;
+
+		ModelRandom random(4242);
+		int firedCount = 0;
+		for (int step = 0; step < 20000; ++step) {
+			int action = random.next(0, 99);
+			if (action < 4 || indexed.events.size() < 20) {
+				int eventId = indexed.registerEvent(indexed.makeRandomEvent());
+				CPPUNIT_ASSERT_EQUAL( eventId, walked.registerEvent(walked.makeRandomEvent()) );
+				continue;
+			}
+			if (action < 7) {
+				std::map<int, ModelEvent>::iterator iterMap = indexed.events.begin();
+				std::advance(iterMap, random.next(0, (int) indexed.events.size() - 1));
+				int eventId = iterMap->first;
+				indexed.unregisterEvent(eventId);
+				walked.unregisterEvent(eventId);
+				continue;
+			}
+
+			int unitIndex = random.next(0, CellTriggerModel::unitCount - 1);
+			Vec2i pos = indexedUnits[unitIndex].pos;
+			if (action < 10) {
+				// onto the map edges now and then
+				pos = Vec2i(random.next(0, 1) == 0 ? 0 : mapW - 1, random.next(0, mapH - 1));
+				if (random.next(0, 1) == 0) {
+					std::swap(pos.x, pos.y);
+					pos.x = std::min(pos.x, mapW - 1);
+					pos.y = std::min(pos.y, mapH - 1);
+				}
+			} else if (action < 13) {
+				pos = Vec2i(random.next(0, mapW - 1), random.next(0, mapH - 1));
+			} else {
+				pos.x = std::min(std::max(pos.x + random.next(-1, 1), 0), mapW - 1);
+				pos.y = std::min(std::max(pos.y + random.next(-1, 1), 0), mapH - 1);
+			}
+			indexedUnits[unitIndex].pos = pos;
+			walkedUnits[unitIndex].pos = pos;
+
+			std::vector<int> indexedFired;
+			std::vector<int> walkedFired;
+			indexed.dispatch(indexedUnits[unitIndex], indexedFired);
+			walked.dispatch(walkedUnits[unitIndex], walkedFired);
+			CPPUNIT_ASSERT( indexedFired == walkedFired );
+			CPPUNIT_ASSERT( indexedUnits[unitIndex].pos == walkedUnits[unitIndex].pos );
+			CPPUNIT_ASSERT_EQUAL( walked.events.size(), indexed.events.size() );
+			firedCount += (int) indexedFired.size();
+		}
+
+		// the run has to reach the cases it is meant to compare
+		CPPUNIT_ASSERT( firedCount > 500 );
+		CPPUNIT_ASSERT( indexed.exitCount > 50 );
+		CPPUNIT_ASSERT_EQUAL( walked.exitCount, indexed.exitCount );
+	}
+
+	void test_large_unit_at_map_edge() {
+		CellTriggerModel model(mapW, mapH, true);
+		// the far corner cell of the map and an area hanging off its edge
+		int cornerId = model.registerEvent(makeAreaEvent(metFactionPos, 2, Vec2i(mapW - 3, mapH - 3), Vec2i(mapW - 3, mapH - 3)));
+		int edgeId = model.registerEvent(makeAreaEvent(metFactionAreaPos, 2, Vec2i(-5, 20), Vec2i(0, 22)));
+
+		ModelUnit unit = makeUnit(1, 2, 3, Vec2i(mapW - 1, mapH - 1));
+		std::vector<int> fired;
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired == std::vector<int>(1, cornerId) );
+
+		// one cell further out the unit no longer covers the corner cell
+		unit.size = 2;
+		fired.clear();
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired.empty() == true );
+
+		unit.pos = Vec2i(0, 24);
+		unit.size = 3;
+		fired.clear();
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired == std::vector<int>(1, edgeId) );
+
+		unit.pos = Vec2i(0, 25);
+		fired.clear();
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired.empty() == true );
+	}
+
+	void test_leaving_area_far_away() {
+		CellTriggerModel model(mapW, mapH, true);
+		int areaId = model.registerEvent(makeAreaEvent(metAreaPos, 0, Vec2i(5, 5), Vec2i(6, 6)));
+
+		ModelUnit unit = makeUnit(1, 0, 1, Vec2i(6, 6));
+		std::vector<int> fired;
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired == std::vector<int>(1, areaId) );
+
+		// staying inside sets nothing off
+		unit.pos = Vec2i(5, 5);
+		fired.clear();
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired.empty() == true );
+
+		// nowhere near the buckets of the area, the exit still fires
+		unit.pos = Vec2i(mapW - 1, mapH - 1);
+		fired.clear();
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired == std::vector<int>(1, areaId) );
+		CPPUNIT_ASSERT_EQUAL( 1, model.exitCount );
+
+		fired.clear();
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired.empty() == true );
+	}
+
+	void test_unregister_during_callback() {
+		CellTriggerModel model(mapW, mapH, true);
+		int areaId = model.registerEvent(makeAreaEvent(metAreaPos, 0, Vec2i(10, 10), Vec2i(20, 20)));
+		int otherId = model.registerEvent(makeAreaEvent(metFactionAreaPos, 1, Vec2i(10, 10), Vec2i(20, 20)));
+		model.unregisterOnFire.insert(areaId);
+
+		// the removal waits for the end of the dispatch, the next event still runs
+		ModelUnit unit = makeUnit(1, 1, 2, Vec2i(15, 15));
+		std::vector<int> fired;
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT_EQUAL( (size_t) 2, fired.size() );
+		CPPUNIT_ASSERT_EQUAL( areaId, fired[0] );
+		CPPUNIT_ASSERT_EQUAL( otherId, fired[1] );
+		CPPUNIT_ASSERT( model.events.find(areaId) != model.events.end() );
+
+		// gone from the index along with the unit standing in its area,
+		// leaving does not fire it again
+		unit.pos = Vec2i(mapW - 1, 0);
+		fired.clear();
+		model.dispatch(unit, fired);
+		CPPUNIT_ASSERT( fired.empty() == true );
+		CPPUNIT_ASSERT( model.events.find(areaId) == model.events.end() );
+
+		std::set<int> eventIds;
+		model.index.findEvents(unit.id, unit.factionIndex, Vec2i(15, 15), unit.size, eventIds);
+		CPPUNIT_ASSERT( eventIds == std::set<int>(&otherId, &otherId + 1) );
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( CellTriggerEventIndexTest );
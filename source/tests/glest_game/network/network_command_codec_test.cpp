@@ -0,0 +1,207 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "network_command_codec.h"
+#include "platform_util.h"
+#include <vector>
+
+using namespace Shared::Util;
+using namespace Shared::Platform;
+using namespace Glest::Game;
+
+//
+// Tests for the delta encoding of network command lists
+//
+class NetworkCommandListCodecTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( NetworkCommandListCodecTest );
+
+	CPPUNIT_TEST( test_all_fields_round_trip );
+	CPPUNIT_TEST( test_only_changed_crcs_are_sent );
+	CPPUNIT_TEST( test_max_command_count_round_trip );
+	CPPUNIT_TEST_EXCEPTION( test_encode_over_max_command_count_throws, megaglest_runtime_error );
+	CPPUNIT_TEST_EXCEPTION( test_decode_over_max_command_count_throws, megaglest_runtime_error );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	// every field at values that wrap its width when taken as a delta
+	NetworkCommand makeCommand(int frame, int index) {
+		bool high = ((frame + index) % 2 == 0);
+		NetworkCommand command;
+		command.networkCommandType = (int16) (high ? 32767 : -32768 + index);
+		command.unitId = (high ? 0x7FFFFFFF - index : (int32) 0x80000000 + frame);
+		command.unitTypeId = (int16) (high ? -1 : 32767);
+		command.commandTypeId = (int16) (high ? -32768 : index);
+		command.positionX = (int16) (high ? 32767 - frame : -32768);
+		command.positionY = (int16) (high ? -300 + index : 511);
+		command.targetId = (high ? -1 : (int32) 0x80000000);
+		command.wantQueue = (int8) (high ? 1 : 0);
+		command.fromFactionIndex = (int8) (high ? 127 : -128);
+		command.unitFactionUnitCount = (uint16) (high ? 65535 : index);
+		command.unitFactionIndex = (int8) (high ? -128 : 7);
+		command.commandStateType = (int8) (high ? 127 : -1);
+		command.commandStateValue = (high ? (int32) 0x80000000 : 0x7FFFFFFF);
+		command.unitCommandGroupId = (high ? -1 : 0x12345678 + frame);
+		return command;
+	}
+
+	void assertCommandEqual(const NetworkCommand &expected, const NetworkCommand &actual) {
+		CPPUNIT_ASSERT_EQUAL( expected.networkCommandType, actual.networkCommandType );
+		CPPUNIT_ASSERT_EQUAL( expected.unitId, actual.unitId );
+		CPPUNIT_ASSERT_EQUAL( expected.unitTypeId, actual.unitTypeId );
+		CPPUNIT_ASSERT_EQUAL( expected.commandTypeId, actual.commandTypeId );
+		CPPUNIT_ASSERT_EQUAL( expected.positionX, actual.positionX );
+		CPPUNIT_ASSERT_EQUAL( expected.positionY, actual.positionY );
+		CPPUNIT_ASSERT_EQUAL( expected.targetId, actual.targetId );
+		CPPUNIT_ASSERT_EQUAL( expected.wantQueue, actual.wantQueue );
+		CPPUNIT_ASSERT_EQUAL( expected.fromFactionIndex, actual.fromFactionIndex );
+		CPPUNIT_ASSERT_EQUAL( expected.unitFactionUnitCount, actual.unitFactionUnitCount );
+		CPPUNIT_ASSERT_EQUAL( expected.unitFactionIndex, actual.unitFactionIndex );
+		CPPUNIT_ASSERT_EQUAL( expected.commandStateType, actual.commandStateType );
+		CPPUNIT_ASSERT_EQUAL( expected.commandStateValue, actual.commandStateValue );
+		CPPUNIT_ASSERT_EQUAL( expected.unitCommandGroupId, actual.unitCommandGroupId );
+	}
+
+public:
+
+	void test_all_fields_round_trip() {
+		const int frames = 8;
+		NetworkCommandListCodec encoder;
+		VarintWriter writer;
+		for (int frame = 0; frame < frames; ++frame) {
+			uint32 crc[GameConstants::maxPlayers];
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				crc[index] = 0x9E3779B9 * (uint32) (frame / 3 + index + 1);
+			}
+			std::vector<NetworkCommand> commands;
+			for (int index = 0; index < frame * 2; ++index) {
+				commands.push_back(makeCommand(frame, index));
+			}
+			encoder.encode(frame * 20 - 40, crc, commands, writer);
+		}
+
+		NetworkCommandListCodec decoder;
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize());
+		for (int frame = 0; frame < frames; ++frame) {
+			int32 frameCount = 0;
+			uint32 crc[GameConstants::maxPlayers];
+			std::vector<NetworkCommand> commands;
+			decoder.decode(reader, frameCount, crc, commands);
+
+			CPPUNIT_ASSERT_EQUAL( frame * 20 - 40, frameCount );
+			for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+				CPPUNIT_ASSERT_EQUAL( 0x9E3779B9 * (uint32) (frame / 3 + index + 1), crc[index] );
+			}
+			CPPUNIT_ASSERT_EQUAL( (size_t) (frame * 2), commands.size() );
+			for (int index = 0; index < (int) commands.size(); ++index) {
+				assertCommandEqual(makeCommand(frame, index), commands[index]);
+			}
+		}
+		CPPUNIT_ASSERT_EQUAL( true, reader.isAtEnd() );
+
+		// a reset codec starts over from zero deltas
+		encoder.reset();
+		decoder.reset();
+		writer.clear();
+		std::vector<NetworkCommand> commands(1, makeCommand(3, 4));
+		uint32 crc[GameConstants::maxPlayers] = { 0 };
+		encoder.encode(7, crc, commands, writer);
+		VarintReader resetReader(&writer.getBuffer()[0], writer.getSize());
+		int32 frameCount = 0;
+		decoder.decode(resetReader, frameCount, crc, commands);
+		CPPUNIT_ASSERT_EQUAL( 7, frameCount );
+		assertCommandEqual(makeCommand(3, 4), commands[0]);
+	}
+
+	void test_only_changed_crcs_are_sent() {
+		NetworkCommandListCodec encoder;
+		std::vector<NetworkCommand> commands;
+		uint32 crc[GameConstants::maxPlayers];
+		for (int index = 0; index < GameConstants::maxPlayers; ++index) {
+			crc[index] = 0xC0DE0000 + index;
+		}
+
+		VarintWriter writer;
+		encoder.encode(1, crc, commands, writer);
+		// frame delta, changed mask, every crc in full and the command count
+		uint32 firstSize = writer.getSize();
+		CPPUNIT_ASSERT_EQUAL( (uint32) (1 + 2 + GameConstants::maxPlayers * 4 + 1), firstSize );
+
+		// nothing changed: frame delta, empty mask and command count
+		encoder.encode(2, crc, commands, writer);
+		CPPUNIT_ASSERT_EQUAL( firstSize + 3, writer.getSize() );
+
+		// one changed faction crc is sent alone
+		crc[3] = 0xFFFFFFFF;
+		encoder.encode(3, crc, commands, writer);
+		CPPUNIT_ASSERT_EQUAL( firstSize + 3 + 7, writer.getSize() );
+
+		NetworkCommandListCodec decoder;
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize());
+		uint32 decodedCRC[GameConstants::maxPlayers];
+		int32 frameCount = 0;
+		for (int frame = 1; frame <= 3; ++frame) {
+			decoder.decode(reader, frameCount, decodedCRC, commands);
+			CPPUNIT_ASSERT_EQUAL( frame, frameCount );
+			CPPUNIT_ASSERT_EQUAL( (uint32) 0xC0DE0000 + 1, decodedCRC[1] );
+			CPPUNIT_ASSERT_EQUAL( (frame == 3 ? 0xFFFFFFFF : (uint32) 0xC0DE0000 + 3), decodedCRC[3] );
+		}
+		CPPUNIT_ASSERT_EQUAL( true, reader.isAtEnd() );
+	}
+
+	void test_max_command_count_round_trip() {
+		std::vector<NetworkCommand> commands(NetworkCommandListCodec::maxCommandCount, makeCommand(1, 2));
+		commands.back() = makeCommand(2, 2);
+		uint32 crc[GameConstants::maxPlayers] = { 0 };
+
+		NetworkCommandListCodec encoder;
+		VarintWriter writer;
+		encoder.encode(100, crc, commands, writer);
+
+		NetworkCommandListCodec decoder;
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize());
+		std::vector<NetworkCommand> decoded;
+		int32 frameCount = 0;
+		decoder.decode(reader, frameCount, crc, decoded);
+		CPPUNIT_ASSERT_EQUAL( (size_t) NetworkCommandListCodec::maxCommandCount, decoded.size() );
+		assertCommandEqual(makeCommand(1, 2), decoded.front());
+		assertCommandEqual(makeCommand(2, 2), decoded.back());
+	}
+
+	void test_encode_over_max_command_count_throws() {
+		std::vector<NetworkCommand> commands(NetworkCommandListCodec::maxCommandCount + 1);
+		uint32 crc[GameConstants::maxPlayers] = { 0 };
+
+		NetworkCommandListCodec encoder;
+		VarintWriter writer;
+		encoder.encode(100, crc, commands, writer);
+	}
+
+	void test_decode_over_max_command_count_throws() {
+		// a peer claiming more commands than a list can hold
+		uint32 crc[GameConstants::maxPlayers] = { 0 };
+		VarintWriter writer;
+		writer.writeDelta(100, 0);
+		writer.writeChangedWords(crc, crc, GameConstants::maxPlayers);
+		writer.writeUInt32(NetworkCommandListCodec::maxCommandCount + 1);
+
+		NetworkCommandListCodec decoder;
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize());
+		std::vector<NetworkCommand> commands;
+		int32 frameCount = 0;
+		decoder.decode(reader, frameCount, crc, commands);
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( NetworkCommandListCodecTest );
@@ -0,0 +1,277 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cmath>
+#include <cstdio>
+#include <map>
+#include <string>
+#include "font.h"
+#include "platform_common.h"
+
+using namespace Shared::Graphics;
+using namespace Shared::PlatformCommon;
+
+//
+// Measures text the way FTGL does: every utf-8 character is looked up in
+// a glyph map and kerned against the character that follows it.
+//
+class GlyphMapText : public Text {
+private:
+	std::map<unsigned int, float> glyphs;
+	std::map<std::pair<unsigned int, unsigned int>, float> kerning;
+
+	unsigned int nextChar(const unsigned char *&text) {
+		unsigned int result = *text++;
+		if (result >= 0xC0) {
+			int extraBytes = (result >= 0xF0 ? 3 : (result >= 0xE0 ? 2 : 1));
+			result &= (0x3F >> extraBytes);
+			for (int index = 0; index < extraBytes && (*text & 0xC0) == 0x80; ++index) {
+				result = (result << 6) | (*text++ & 0x3F);
+			}
+		}
+		return result;
+	}
+
+	float glyphAdvance(unsigned int glyph) {
+		std::map<unsigned int, float>::iterator iterFind = glyphs.find(glyph);
+		if (iterFind == glyphs.end()) {
+			float advance = 4.0f + (glyph % 7) * 1.25f;
+			glyphs[glyph] = advance;
+			return advance;
+		}
+		return iterFind->second;
+	}
+
+public:
+	int advanceCalls;
+
+	GlyphMapText() : Text(ftht_2D) {
+		advanceCalls = 0;
+		kerning[std::make_pair((unsigned int) 'A', (unsigned int) 'V')] = -1.5f;
+		kerning[std::make_pair((unsigned int) 'T', (unsigned int) 'o')] = -0.75f;
+		kerning[std::make_pair((unsigned int) 'W', (unsigned int) '.')] = -0.5f;
+	}
+
+	virtual float Advance(const char *str, const int len = -1) {
+		advanceCalls++;
+		float result = 0;
+		const unsigned char *text = (const unsigned char *) str;
+		unsigned int glyph = nextChar(text);
+		while (glyph != 0) {
+			const unsigned char *peek = text;
+			unsigned int next = nextChar(peek);
+			result += glyphAdvance(glyph);
+			std::map<std::pair<unsigned int, unsigned int>, float>::iterator iterFind = kerning.find(std::make_pair(glyph, next));
+			if (iterFind != kerning.end()) {
+				result += iterFind->second;
+			}
+			text = peek;
+			glyph = next;
+		}
+		return result;
+	}
+};
+
+//
+// Tests for the glyph table and text caches of FontMetrics
+//
+class FontMetricsTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( FontMetricsTest );
+
+	CPPUNIT_TEST( test_glyph_table_matches_handler );
+	CPPUNIT_TEST( test_multibyte_text_cache );
+	CPPUNIT_TEST( test_word_wrap_cache );
+	CPPUNIT_TEST( test_hud_text_benchmark );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	// how FontMetrics measured text before it had a glyph table
+	float referenceTextWidth(GlyphMapText &text, const string &str) {
+		string longestLine = "";
+		vector<string> lineTokens;
+		Tokenize(str, lineTokens, "\n");
+		for (unsigned int i = 0; i < lineTokens.size(); ++i) {
+			if (lineTokens[i].length() > longestLine.length()) {
+				longestLine = lineTokens[i];
+			}
+		}
+		return text.Advance(longestLine.c_str()) * Font::scaleFontValue;
+	}
+
+	string referenceWordWrap(GlyphMapText &text, string str, int maxWidth) {
+		replaceAll(str, "\n", " \n ");
+		vector<string> words;
+		Tokenize(str, words, " ");
+
+		string wrappedText = "";
+		float lineWidth = 0.0f;
+		for (unsigned int i = 0; i < words.size(); ++i) {
+			string word = words[i];
+			if (word == "\n") {
+				wrappedText += word;
+				lineWidth = 0;
+			} else {
+				float wordWidth = referenceTextWidth(text, word);
+				if (lineWidth + wordWidth > maxWidth) {
+					wrappedText += "\n";
+					lineWidth = 0;
+				}
+				lineWidth += referenceTextWidth(text, word + " ");
+				wrappedText += word + " ";
+			}
+		}
+		return wrappedText;
+	}
+
+public:
+
+	void setUp() {
+		FontMetrics::setMaxCacheEntries(256);
+		FontMetrics::resetCacheStats();
+	}
+
+	void test_glyph_table_matches_handler() {
+		GlyphMapText text;
+		FontMetrics metrics(&text);
+
+		const char *lines[] = { "AV Tower", "To the W.", "HP: 9000/9000", "", "~{|}", "AVAVAV Tooo W.W." };
+		for (unsigned int index = 0; index < sizeof(lines) / sizeof(lines[0]); ++index) {
+			string line = lines[index];
+			float expected = text.Advance(line.c_str());
+			CPPUNIT_ASSERT_DOUBLES_EQUAL( expected, metrics.getTextAdvance(line), 0.001 );
+			CPPUNIT_ASSERT_DOUBLES_EQUAL( expected * Font::scaleFontValue, metrics.getTextWidth(line), 0.001 );
+		}
+		CPPUNIT_ASSERT_EQUAL( (uint64) 12, FontMetrics::getGlyphTableMeasures() );
+
+		// the longest line in characters is measured
+		string lineStats = "\nHP: 9000\nArmor: 0 (Stone)\nAV";
+		CPPUNIT_ASSERT_DOUBLES_EQUAL( referenceTextWidth(text, lineStats), metrics.getTextWidth(lineStats), 0.001 );
+
+		// glyphs and pairs seen before come from the table
+		text.advanceCalls = 0;
+		metrics.getTextWidth("AV To the Tower");
+		CPPUNIT_ASSERT_EQUAL( 0, text.advanceCalls );
+
+		// a new face size measures again
+		metrics.clearCaches();
+		metrics.getTextWidth("AV");
+		CPPUNIT_ASSERT_EQUAL( 3, text.advanceCalls );
+	}
+
+	void test_multibyte_text_cache() {
+		GlyphMapText text;
+		FontMetrics metrics(&text);
+
+		string faction = "Indian (אינדיאנים)";
+		float expected = text.Advance(faction.c_str());
+		text.advanceCalls = 0;
+		for (int index = 0; index < 10; ++index) {
+			CPPUNIT_ASSERT_DOUBLES_EQUAL( expected, metrics.getTextAdvance(faction), 0.001 );
+		}
+		CPPUNIT_ASSERT_EQUAL( 1, text.advanceCalls );
+		CPPUNIT_ASSERT_EQUAL( (uint64) 9, FontMetrics::getTextAdvanceCacheHits() );
+		CPPUNIT_ASSERT_EQUAL( (uint64) 1, FontMetrics::getTextAdvanceCacheMisses() );
+
+		// the least recently used text goes first
+		FontMetrics::setMaxCacheEntries(2);
+		metrics.clearCaches();
+		metrics.getTextAdvance("\xC3\xA9t\xC3\xA9");
+		metrics.getTextAdvance("\xC3\xBC" "ber");
+		metrics.getTextAdvance("\xC3\xA9t\xC3\xA9");
+		metrics.getTextAdvance("gr\xC3\xBC\xC3\x9F");
+		text.advanceCalls = 0;
+		metrics.getTextAdvance("\xC3\xA9t\xC3\xA9");
+		CPPUNIT_ASSERT_EQUAL( 0, text.advanceCalls );
+		metrics.getTextAdvance("\xC3\xBC" "ber");
+		CPPUNIT_ASSERT_EQUAL( 1, text.advanceCalls );
+
+		FontMetrics::setMaxCacheEntries(0);
+		metrics.clearCaches();
+		metrics.getTextAdvance(faction);
+		metrics.getTextAdvance(faction);
+		CPPUNIT_ASSERT_EQUAL( 3, text.advanceCalls );
+	}
+
+	void test_word_wrap_cache() {
+		GlyphMapText text;
+		FontMetrics metrics(&text);
+
+		string message = "Your ally has surrendered. To the Waypoint AVANT!\nThe game continues, \xC3\xA9t\xC3\xA9 without them.";
+		for (int maxWidth = 40; maxWidth <= 400; maxWidth += 60) {
+			CPPUNIT_ASSERT_EQUAL( referenceWordWrap(text, message, maxWidth), metrics.wordWrapText(message, maxWidth) );
+		}
+
+		FontMetrics::resetCacheStats();
+		text.advanceCalls = 0;
+		string wrapped = metrics.wordWrapText(message, 160);
+		CPPUNIT_ASSERT_EQUAL( 0, text.advanceCalls );
+		CPPUNIT_ASSERT_EQUAL( (uint64) 1, FontMetrics::getWrappedTextCacheHits() );
+		CPPUNIT_ASSERT_EQUAL( (uint64) 0, FontMetrics::getWrappedTextCacheMisses() );
+
+		// wrapped at the old scale
+		float scaleFontValue = Font::scaleFontValue;
+		Font::scaleFontValue = scaleFontValue * 2;
+		string wrappedScaled = metrics.wordWrapText(message, 160);
+		CPPUNIT_ASSERT_EQUAL( referenceWordWrap(text, message, 160), wrappedScaled );
+		CPPUNIT_ASSERT( wrapped != wrappedScaled );
+		CPPUNIT_ASSERT_EQUAL( (uint64) 1, FontMetrics::getWrappedTextCacheMisses() );
+		Font::scaleFontValue = scaleFontValue;
+	}
+
+	void test_hud_text_benchmark() {
+		const int frames = 2000;
+		GlyphMapText text;
+		FontMetrics metrics(&text);
+
+		// what a frame of the in game HUD and console measures
+		vector<string> lines;
+		lines.push_back("Render FPS: 60[59]");
+		lines.push_back("Update FPS: 40[40]");
+		lines.push_back("Time: 12.75 [3.50]");
+		lines.push_back("Gold: 1250  Wood: 830  Stone: 415  Food: 12/40");
+		lines.push_back("Player 2 (CPU Ultra) has been defeated.");
+		lines.push_back("Swordman: Attack Stopped - Out of range");
+		lines.push_back("Indian (\xD7\x90\xD7\x99\xD7\xA0\xD7\x93\xD7\x99\xD7\x90\xD7\xA0\xD7\x99\xD7\x9D)");
+		lines.push_back("Bat\xC3\xA4illon: Angriff gestoppt");
+		string message = "Your ally has surrendered. To the Waypoint! The game continues without them, good luck commander.";
+
+		Chrono chrono;
+		chrono.start();
+		float handlerTotal = 0;
+		for (int frame = 0; frame < frames; ++frame) {
+			for (unsigned int index = 0; index < lines.size(); ++index) {
+				handlerTotal += referenceTextWidth(text, lines[index]);
+			}
+			handlerTotal += referenceWordWrap(text, message, 200).size();
+		}
+		int64 handlerMillis = chrono.getMillis();
+
+		chrono.start();
+		float metricsTotal = 0;
+		for (int frame = 0; frame < frames; ++frame) {
+			for (unsigned int index = 0; index < lines.size(); ++index) {
+				metricsTotal += metrics.getTextWidth(lines[index]);
+			}
+			metricsTotal += metrics.wordWrapText(message, 200).size();
+		}
+		int64 metricsMillis = chrono.getMillis();
+
+		CPPUNIT_ASSERT( fabs(handlerTotal - metricsTotal) < 0.001 * handlerTotal );
+		printf("\n%d HUD frames: text handler %d msecs, glyph table and caches %d msecs, %s\n",
+			frames, (int) handlerMillis, (int) metricsMillis, FontMetrics::getCacheStats().c_str());
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( FontMetricsTest );
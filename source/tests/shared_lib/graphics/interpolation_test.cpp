@@ -0,0 +1,81 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <vector>
+#include "interpolation.h"
+
+using namespace Shared::Graphics;
+
+//
+// Tests for the vertex lerp used by mesh interpolation
+//
+class InterpolationTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( InterpolationTest );
+
+	CPPUNIT_TEST( test_lerp_matches_vec3 );
+	CPPUNIT_TEST( test_lerp_end_points );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	void fillVertices(std::vector<Vec3f> &prev, std::vector<Vec3f> &next, unsigned int count) {
+		prev.resize(count);
+		next.resize(count);
+		for (unsigned int i = 0; i < count; ++i) {
+			prev[i] = Vec3f(i * 0.5f, -(float) i, i * 2.0f + 1.0f);
+			next[i] = Vec3f(i * 1.5f + 3.0f, i * 0.25f, -(float) i);
+		}
+	}
+
+public:
+
+	void test_lerp_matches_vec3() {
+		// odd sizes leave a tail the vector loops don't cover
+		const unsigned int counts[] = { 1, 2, 3, 5, 7, 11, 64, 101 };
+		for (unsigned int c = 0; c < sizeof(counts) / sizeof(counts[0]); ++c) {
+			std::vector<Vec3f> prev;
+			std::vector<Vec3f> next;
+			fillVertices(prev, next, counts[c]);
+			std::vector<Vec3f> dest(counts[c]);
+
+			InterpolationData::lerpVertices(&prev[0], &next[0], &dest[0], counts[c], 0.3f);
+			for (unsigned int i = 0; i < counts[c]; ++i) {
+				Vec3f expected = prev[i].lerp(0.3f, next[i]);
+				CPPUNIT_ASSERT_DOUBLES_EQUAL( expected.x, dest[i].x, 0.0001 );
+				CPPUNIT_ASSERT_DOUBLES_EQUAL( expected.y, dest[i].y, 0.0001 );
+				CPPUNIT_ASSERT_DOUBLES_EQUAL( expected.z, dest[i].z, 0.0001 );
+			}
+		}
+	}
+
+	void test_lerp_end_points() {
+		std::vector<Vec3f> prev;
+		std::vector<Vec3f> next;
+		fillVertices(prev, next, 9);
+		std::vector<Vec3f> dest(9);
+
+		InterpolationData::lerpVertices(&prev[0], &next[0], &dest[0], 9, 0.0f);
+		for (unsigned int i = 0; i < 9; ++i) {
+			CPPUNIT_ASSERT( dest[i] == prev[i] );
+		}
+		InterpolationData::lerpVertices(&prev[0], &next[0], &dest[0], 9, 1.0f);
+		for (unsigned int i = 0; i < 9; ++i) {
+			CPPUNIT_ASSERT_DOUBLES_EQUAL( next[i].x, dest[i].x, 0.0001 );
+			CPPUNIT_ASSERT_DOUBLES_EQUAL( next[i].y, dest[i].y, 0.0001 );
+			CPPUNIT_ASSERT_DOUBLES_EQUAL( next[i].z, dest[i].z, 0.0001 );
+		}
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( InterpolationTest );
@@ -0,0 +1,299 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "model.h"
+#include "model_header.h"
+#include "model_renderer.h"
+
+using namespace Shared::Graphics;
+
+// a model read from a g3d file the test writes itself
+class TestModel : public Model {
+public:
+	explicit TestModel(const string &path) {
+		load(path);
+	}
+	virtual void init() {
+	}
+	virtual void end() {
+	}
+};
+
+//
+// Records the render state each mesh is drawn with instead of calling GL.
+// The item is what the instance callback set up, like the matrix and
+// colours of a tileset object.
+//
+class RecordingModelRenderer : public ModelRenderer {
+public:
+	bool instancing;
+	int currentItem;
+	const Mesh *boundMesh;
+	int stateErrors;
+	// (mesh, item) of every draw call
+	vector<pair<const Mesh *, int> > drawList;
+
+	RecordingModelRenderer() {
+		instancing = true;
+		currentItem = -1;
+		boundMesh = NULL;
+		stateErrors = 0;
+	}
+
+	virtual void begin(bool renderNormals, bool renderTextures, bool renderColors, bool colorPickingMode, Gl::MeshCallback *meshCallback) {
+	}
+	virtual void end() {
+	}
+	virtual void render(Model *model, int renderMode, float alpha) {
+		for (uint32 i = 0; i < model->getMeshCount(); ++i) {
+			Mesh *mesh = model->getMeshPtr(i);
+			if (renderMode == rmSelection && mesh->getNoSelect() == true) {
+				continue;
+			}
+			setupMesh(mesh, renderMode, alpha);
+			drawMesh(mesh);
+			finishMesh(mesh, renderMode);
+		}
+	}
+	virtual void renderNormalsOnly(Model *model) {
+	}
+	virtual bool canRenderInstances(const Model *model) const {
+		return (instancing == true && isStaticModel(model) == true);
+	}
+
+protected:
+	virtual void setupMesh(Mesh *mesh, int renderMode, float alpha) {
+		if (boundMesh != NULL) {
+			stateErrors++;
+		}
+		boundMesh = mesh;
+		meshSetupCount++;
+	}
+	virtual void drawMesh(Mesh *mesh) {
+		if (boundMesh != mesh || currentItem < 0) {
+			stateErrors++;
+		}
+		drawList.push_back(make_pair(mesh, currentItem));
+		drawCallCount++;
+	}
+	virtual void finishMesh(Mesh *mesh, int renderMode) {
+		if (boundMesh != mesh) {
+			stateErrors++;
+		}
+		boundMesh = NULL;
+	}
+};
+
+class RecordingInstanceCallback : public ModelInstanceCallback {
+private:
+	RecordingModelRenderer &renderer;
+	const vector<int> &itemList;
+
+public:
+	RecordingInstanceCallback(RecordingModelRenderer &renderer, const vector<int> &itemList) :
+		renderer(renderer), itemList(itemList) {
+	}
+	virtual void beginInstance(int instanceIndex) {
+		renderer.currentItem = itemList[instanceIndex];
+	}
+	virtual void endInstance(int instanceIndex) {
+		renderer.currentItem = -1;
+	}
+};
+
+//
+// Tests for drawing many objects of a model through renderInstances
+//
+class ModelRendererTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( ModelRendererTest );
+
+	CPPUNIT_TEST( test_batched_objects_draw_the_same );
+	CPPUNIT_TEST( test_animated_model_draws_per_instance );
+	CPPUNIT_TEST( test_selection_skips_no_select_meshes );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	vector<string> modelFiles;
+
+	// a g3d v4 model of one triangle per mesh, every mesh with its own
+	// colour so loading does not join them
+	string writeModelFile(const string &name, int meshCount, int frameCount, bool lastMeshNoSelect) {
+		string path = "model_renderer_test_" + name + ".g3d";
+		FILE *file = fopen(path.c_str(), "wb");
+		CPPUNIT_ASSERT( file != NULL );
+
+		FileHeader fileHeader;
+		memcpy(fileHeader.id, "G3D", 3);
+		fileHeader.version = 4;
+		fwrite(&fileHeader, sizeof(FileHeader), 1, file);
+
+		ModelHeader modelHeader;
+		modelHeader.meshCount = (uint16) meshCount;
+		modelHeader.type = mtMorphMesh;
+		fwrite(&modelHeader, sizeof(ModelHeader), 1, file);
+
+		for (int meshIndex = 0; meshIndex < meshCount; ++meshIndex) {
+			MeshHeader meshHeader;
+			memset(&meshHeader, 0, sizeof(MeshHeader));
+			snprintf((char *) meshHeader.name, meshNameSize, "mesh%d", meshIndex);
+			meshHeader.frameCount = frameCount;
+			meshHeader.vertexCount = 3;
+			meshHeader.indexCount = 3;
+			meshHeader.diffuseColor[0] = 0.1f * (meshIndex + 1);
+			meshHeader.opacity = 1.f;
+			meshHeader.properties = (lastMeshNoSelect == true && meshIndex == meshCount - 1 ? mpfNoSelect : 0);
+			fwrite(&meshHeader, sizeof(MeshHeader), 1, file);
+
+			for (int data = 0; data < 2; ++data) {
+				for (int vertex = 0; vertex < frameCount * 3; ++vertex) {
+					float32 values[3] = { (float32) vertex, (float32) meshIndex, (float32) data };
+					fwrite(values, sizeof(values), 1, file);
+				}
+			}
+			uint32 indices[3] = { 0, 1, 2 };
+			fwrite(indices, sizeof(indices), 1, file);
+		}
+		fclose(file);
+
+		modelFiles.push_back(path);
+		return path;
+	}
+
+	// the tileset object loop of Renderer::renderObjects, batched or not
+	void renderObjects(RecordingModelRenderer &renderer, const vector<Model *> &objectModels, bool batchObjects) {
+		renderer.begin(true, true, false, false, NULL);
+
+		vector<int> batchItemIndexes;
+		ModelInstanceBatch objectBatch;
+		for (int item = 0; item < (int) objectModels.size(); ++item) {
+			Model *objModel = objectModels[item];
+			if (batchObjects == true && renderer.canRenderInstances(objModel) == true) {
+				objectBatch.add(objModel, (int) batchItemIndexes.size());
+				batchItemIndexes.push_back(item);
+				continue;
+			}
+			renderer.currentItem = item;
+			renderer.render(objModel, rmNormal, 1.f);
+			renderer.currentItem = -1;
+		}
+
+		for (int modelIndex = 0; modelIndex < objectBatch.getModelCount(); ++modelIndex) {
+			const vector<int> &batchIndexes = objectBatch.getItemList(modelIndex);
+			vector<int> itemList;
+			for (unsigned int index = 0; index < batchIndexes.size(); ++index) {
+				itemList.push_back(batchItemIndexes[batchIndexes[index]]);
+			}
+			RecordingInstanceCallback instanceCallback(renderer, itemList);
+			renderer.renderInstances(objectBatch.getModel(modelIndex), (int) itemList.size(), &instanceCallback);
+		}
+
+		renderer.end();
+	}
+
+public:
+
+	void tearDown() {
+		for (unsigned int index = 0; index < modelFiles.size(); ++index) {
+			remove(modelFiles[index].c_str());
+		}
+		modelFiles.clear();
+	}
+
+	void test_batched_objects_draw_the_same() {
+		TestModel tree(writeModelFile("tree", 2, 1, false));
+		TestModel rock(writeModelFile("rock", 1, 1, false));
+		TestModel bush(writeModelFile("bush", 1, 3, false));
+		CPPUNIT_ASSERT_EQUAL( (uint32) 2, tree.getMeshCount() );
+
+		// tileset objects as the quad cache lists them, models mixed
+		vector<Model *> objectModels;
+		for (int index = 0; index < 60; ++index) {
+			objectModels.push_back(index % 5 == 4 ? (Model *) &bush : (index % 3 == 0 ? (Model *) &rock : (Model *) &tree));
+		}
+		int treeCount = (int) std::count(objectModels.begin(), objectModels.end(), (Model *) &tree);
+		int rockCount = (int) std::count(objectModels.begin(), objectModels.end(), (Model *) &rock);
+		int bushCount = (int) std::count(objectModels.begin(), objectModels.end(), (Model *) &bush);
+
+		// BatchTilesetObjects off
+		RecordingModelRenderer unbatched;
+		renderObjects(unbatched, objectModels, false);
+		// BatchTilesetObjects on
+		RecordingModelRenderer batched;
+		renderObjects(batched, objectModels, true);
+
+		CPPUNIT_ASSERT_EQUAL( 0, unbatched.stateErrors );
+		CPPUNIT_ASSERT_EQUAL( 0, batched.stateErrors );
+
+		// every mesh of every object is drawn once with its own state either way
+		uint32 drawCalls = treeCount * 2 + rockCount + bushCount;
+		CPPUNIT_ASSERT_EQUAL( drawCalls, unbatched.getDrawCallCount() );
+		CPPUNIT_ASSERT_EQUAL( drawCalls, batched.getDrawCallCount() );
+		vector<pair<const Mesh *, int> > unbatchedDraws = unbatched.drawList;
+		vector<pair<const Mesh *, int> > batchedDraws = batched.drawList;
+		std::sort(unbatchedDraws.begin(), unbatchedDraws.end());
+		std::sort(batchedDraws.begin(), batchedDraws.end());
+		CPPUNIT_ASSERT( unbatchedDraws == batchedDraws );
+
+		// static meshes are set up once, the animated bush still per object
+		CPPUNIT_ASSERT_EQUAL( drawCalls, unbatched.getMeshSetupCount() );
+		CPPUNIT_ASSERT_EQUAL( (uint32) (2 + 1 + bushCount), batched.getMeshSetupCount() );
+		printf("\n%d tileset objects: %u draw calls, mesh setups unbatched %u batched %u\n",
+			(int) objectModels.size(), batched.getDrawCallCount(), unbatched.getMeshSetupCount(), batched.getMeshSetupCount());
+	}
+
+	void test_animated_model_draws_per_instance() {
+		TestModel bush(writeModelFile("bush", 2, 3, false));
+		vector<int> itemList;
+		for (int item = 0; item < 4; ++item) {
+			itemList.push_back(item);
+		}
+
+		RecordingModelRenderer renderer;
+		CPPUNIT_ASSERT_EQUAL( false, renderer.canRenderInstances(&bush) );
+		RecordingInstanceCallback instanceCallback(renderer, itemList);
+		renderer.renderInstances(&bush, (int) itemList.size(), &instanceCallback);
+
+		CPPUNIT_ASSERT_EQUAL( 0, renderer.stateErrors );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 8, renderer.getDrawCallCount() );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 8, renderer.getMeshSetupCount() );
+		// object by object, like render() of each one
+		CPPUNIT_ASSERT_EQUAL( 0, renderer.drawList[1].second );
+		CPPUNIT_ASSERT_EQUAL( 1, renderer.drawList[2].second );
+	}
+
+	void test_selection_skips_no_select_meshes() {
+		TestModel tree(writeModelFile("tree", 2, 1, true));
+		vector<int> itemList(3, 0);
+		itemList[1] = 1;
+		itemList[2] = 2;
+
+		RecordingModelRenderer renderer;
+		RecordingInstanceCallback instanceCallback(renderer, itemList);
+		renderer.renderInstances(&tree, (int) itemList.size(), &instanceCallback, rmSelection);
+
+		CPPUNIT_ASSERT_EQUAL( 0, renderer.stateErrors );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 3, renderer.getDrawCallCount() );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 1, renderer.getMeshSetupCount() );
+		for (unsigned int index = 0; index < renderer.drawList.size(); ++index) {
+			CPPUNIT_ASSERT( renderer.drawList[index].first == tree.getMesh(0) );
+		}
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( ModelRendererTest );
@@ -0,0 +1,92 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <vector>
+#include "particle.h"
+
+using namespace Shared::Graphics;
+
+//
+// Tests for the particle array pool used by the particle systems
+//
+class ParticleTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( ParticleTest );
+
+	CPPUNIT_TEST( test_pool_reuses_and_resets_buffers );
+	CPPUNIT_TEST( test_pool_limit );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+public:
+
+	void setUp() {
+		ParticleBufferPool::clear();
+	}
+
+	void tearDown() {
+		ParticleBufferPool::clear();
+		ParticleBufferPool::setMaxBuffersPerSize(32);
+	}
+
+	void test_pool_reuses_and_resets_buffers() {
+		std::vector<Particle> particles;
+		ParticleBufferPool::acquire(particles, 100);
+		CPPUNIT_ASSERT_EQUAL( (size_t) 100, particles.size() );
+
+		particles[5].energy = 42;
+		particles[5].speedUpRelative = 1.5f;
+		const Particle *memory = &particles[0];
+		ParticleBufferPool::release(particles);
+		CPPUNIT_ASSERT( particles.empty() );
+
+		// a different size must not get the pooled array
+		std::vector<Particle> otherParticles;
+		ParticleBufferPool::acquire(otherParticles, 50);
+		CPPUNIT_ASSERT( &otherParticles[0] != memory );
+
+		std::vector<Particle> reusedParticles;
+		ParticleBufferPool::acquire(reusedParticles, 100);
+		CPPUNIT_ASSERT_EQUAL( (size_t) 100, reusedParticles.size() );
+		CPPUNIT_ASSERT( &reusedParticles[0] == memory );
+		CPPUNIT_ASSERT_EQUAL( 0, reusedParticles[5].energy );
+		CPPUNIT_ASSERT_EQUAL( 0.0f, reusedParticles[5].speedUpRelative );
+	}
+
+	void test_pool_limit() {
+		ParticleBufferPool::setMaxBuffersPerSize(1);
+
+		std::vector<Particle> first;
+		std::vector<Particle> second;
+		ParticleBufferPool::acquire(first, 10);
+		ParticleBufferPool::acquire(second, 10);
+		const Particle *firstMemory = &first[0];
+		ParticleBufferPool::release(first);
+		// over the limit, this one is freed
+		ParticleBufferPool::release(second);
+		CPPUNIT_ASSERT( second.empty() );
+
+		std::vector<Particle> reused;
+		ParticleBufferPool::acquire(reused, 10);
+		CPPUNIT_ASSERT( &reused[0] == firstMemory );
+
+		ParticleBufferPool::setMaxBuffersPerSize(0);
+		ParticleBufferPool::release(reused);
+		std::vector<Particle> fresh;
+		ParticleBufferPool::acquire(fresh, 10);
+		CPPUNIT_ASSERT_EQUAL( (size_t) 10, fresh.size() );
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( ParticleTest );
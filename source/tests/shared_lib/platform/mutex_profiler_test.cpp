@@ -0,0 +1,170 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "thread.h"
+#include "platform_common.h"
+#include "conversion.h"
+
+using namespace Shared::Platform;
+using namespace Shared::PlatformCommon;
+using namespace Shared::Util;
+
+static const char *testSiteHolder = "mutex_profiler_test:holder";
+static const char *testSiteWaiter = "mutex_profiler_test:waiter";
+
+class HoldLockArgs {
+public:
+	Mutex *mutex;
+	SDL_sem *locked;
+	int holdMillis;
+};
+
+static int holdLockThread(void *data) {
+	HoldLockArgs *args = (HoldLockArgs *) data;
+	MutexSafeWrapper safeMutex(args->mutex, testSiteHolder);
+	SDL_SemPost(args->locked);
+	SDL_Delay(args->holdMillis);
+	return 0;
+}
+
+//
+// Tests for the lock site statistics of MutexSafeWrapper
+//
+class MutexProfilerTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( MutexProfilerTest );
+
+	CPPUNIT_TEST( test_counts_per_site );
+	CPPUNIT_TEST( test_contended_lock );
+	CPPUNIT_TEST( test_disabled_records_nothing );
+	CPPUNIT_TEST( test_lock_cost );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	MutexProfiler::SiteStats findSite(const string &site) {
+		vector<MutexProfiler::SiteStats> sites = MutexProfiler::getSiteStats();
+		for (unsigned int index = 0; index < sites.size(); ++index) {
+			if (sites[index].site == site) {
+				return sites[index];
+			}
+		}
+		return MutexProfiler::SiteStats();
+	}
+
+public:
+
+	void setUp() {
+		MutexProfiler::setEnabled(true);
+		MutexProfiler::reset();
+	}
+
+	void tearDown() {
+		MutexProfiler::setEnabled(false);
+		MutexProfiler::reset();
+	}
+
+	void test_counts_per_site() {
+		Mutex mutex(CODE_AT_LINE);
+		for (int index = 0; index < 10; ++index) {
+			MutexSafeWrapper safeMutex(&mutex, "mutex_profiler_test:literal");
+		}
+		// ids built at runtime end up on one site as well
+		for (int index = 0; index < 5; ++index) {
+			MutexSafeWrapper safeMutex(&mutex, string("mutex_profiler_test:") + intToStr(42));
+		}
+		uint64 noOwnerLocks = findSite("(no owner id)").acquisitions;
+		MutexSafeWrapper safeMutex(&mutex);
+		safeMutex.ReleaseLock(true);
+		CPPUNIT_ASSERT_EQUAL( 0, safeMutex.TryLock() );
+		safeMutex.ReleaseLock();
+
+		CPPUNIT_ASSERT_EQUAL( (uint64) 10, findSite("mutex_profiler_test:literal").acquisitions );
+		CPPUNIT_ASSERT_EQUAL( (uint64) 5, findSite("mutex_profiler_test:42").acquisitions );
+		CPPUNIT_ASSERT_EQUAL( noOwnerLocks + 2, findSite("(no owner id)").acquisitions );
+		CPPUNIT_ASSERT_EQUAL( (uint64) 0, findSite("mutex_profiler_test:literal").contended );
+	}
+
+	void test_contended_lock() {
+		Mutex mutex(CODE_AT_LINE);
+		HoldLockArgs args;
+		args.mutex = &mutex;
+		args.locked = SDL_CreateSemaphore(0);
+		args.holdMillis = 50;
+
+		SDL_Thread *thread = SDL_CreateThread(holdLockThread, "holdLockThread", &args);
+		CPPUNIT_ASSERT( thread != NULL );
+		SDL_SemWait(args.locked);
+		{
+			MutexSafeWrapper safeMutex(&mutex, testSiteWaiter);
+		}
+		SDL_WaitThread(thread, NULL);
+		SDL_DestroySemaphore(args.locked);
+
+		MutexProfiler::SiteStats waiter = findSite(testSiteWaiter);
+		CPPUNIT_ASSERT_EQUAL( (uint64) 1, waiter.acquisitions );
+		CPPUNIT_ASSERT_EQUAL( (uint64) 1, waiter.contended );
+		CPPUNIT_ASSERT( waiter.waitMicros >= 20000 );
+		CPPUNIT_ASSERT( findSite(testSiteHolder).holdMicros >= 20000 );
+
+		// the site that waited longest comes first
+		vector<MutexProfiler::SiteStats> sites = MutexProfiler::getSiteStats();
+		CPPUNIT_ASSERT_EQUAL( string(testSiteWaiter), sites[0].site );
+		CPPUNIT_ASSERT( MutexProfiler::getReport().find(testSiteWaiter) != string::npos );
+	}
+
+	void test_disabled_records_nothing() {
+		MutexProfiler::setEnabled(false);
+		Mutex mutex(CODE_AT_LINE);
+		{
+			MutexSafeWrapper safeMutex(&mutex, "mutex_profiler_test:disabled");
+		}
+		CPPUNIT_ASSERT_EQUAL( true, MutexProfiler::getSiteStats().empty() );
+	}
+
+	void test_lock_cost() {
+		const int locks = 1000000;
+		Mutex mutex(CODE_AT_LINE);
+		MutexProfiler::setEnabled(false);
+
+		Chrono chrono;
+		chrono.start();
+		for (int index = 0; index < locks; ++index) {
+			// the owner ids most call sites used to build
+			MutexSafeWrapper safeMutex(&mutex, string(__FILE__) + "_" + intToStr(__LINE__));
+		}
+		int64 stringIdMillis = chrono.getMillis();
+
+		chrono.start();
+		for (int index = 0; index < locks; ++index) {
+			MutexSafeWrapper safeMutex(&mutex, CODE_AT_LINE);
+		}
+		int64 literalIdMillis = chrono.getMillis();
+
+		MutexProfiler::setEnabled(true);
+		chrono.start();
+		for (int index = 0; index < locks; ++index) {
+			MutexSafeWrapper safeMutex(&mutex, "mutex_profiler_test:cost");
+		}
+		int64 profiledMillis = chrono.getMillis();
+
+		CPPUNIT_ASSERT_EQUAL( (uint64) locks, findSite("mutex_profiler_test:cost").acquisitions );
+		printf("\n%d locks: string owner id %d msecs, literal owner id %d msecs, profiled %d msecs\n",
+			locks, (int) stringIdMillis, (int) literalIdMillis, (int) profiledMillis);
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( MutexProfilerTest );
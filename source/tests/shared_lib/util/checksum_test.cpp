@@ -0,0 +1,123 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "checksum.h"
+#include "platform_common.h"
+
+using namespace Shared::Util;
+using namespace Shared::PlatformCommon;
+
+//
+// Tests for the crc32 used by Checksum
+//
+class ChecksumTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( ChecksumTest );
+
+	CPPUNIT_TEST( test_known_value );
+	CPPUNIT_TEST( test_matches_byte_loop );
+	CPPUNIT_TEST( test_throughput );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	void fillData(std::vector<unsigned char> &data, size_t size) {
+		data.resize(size);
+		unsigned int seed = 12345;
+		for (size_t i = 0; i < size; ++i) {
+			seed = seed * 1103515245 + 12345;
+			data[i] = (unsigned char) (seed >> 16);
+		}
+	}
+
+	// the loop Checksum::addBytes used before, one table lookup per byte
+	uint32 byteLoopCrc(const std::vector<unsigned char> &data, size_t offset, size_t size) {
+		uint32 table[256];
+		for (uint32 n = 0; n < 256; ++n) {
+			uint32 crc = n;
+			for (int bit = 0; bit < 8; ++bit) {
+				crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1;
+			}
+			table[n] = crc;
+		}
+
+		const unsigned char *rVal = &data[0] + offset;
+		uint32 sum = ~0u;
+		while (size--) {
+			sum = (sum >> 8) ^ table[*rVal++ ^ (sum & 0xff)];
+		}
+		return ~sum;
+	}
+
+public:
+
+	void test_known_value() {
+		// the standard crc32 check value
+		Checksum checksum;
+		checksum.addString("123456789");
+		CPPUNIT_ASSERT_EQUAL( (uint32) 0xCBF43926, checksum.getSum() );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 0xCBF43926, Checksum::updateCrc(0, "123456789", 9) );
+	}
+
+	void test_matches_byte_loop() {
+		std::vector<unsigned char> data;
+		fillData(data, 4096);
+
+		// every tail length and misaligned start
+		for (size_t offset = 0; offset < 8; ++offset) {
+			for (size_t size = 0; size < 80; ++size) {
+				Checksum checksum;
+				uint32 result = checksum.addBytes(&data[offset], size);
+				CPPUNIT_ASSERT_EQUAL( byteLoopCrc(data, offset, size), result );
+			}
+		}
+
+		// fed in pieces it has to come out the same
+		Checksum whole;
+		whole.addBytes(&data[0], data.size());
+		Checksum pieces;
+		pieces.addBytes(&data[0], 13);
+		pieces.addBytes(&data[13], 1000);
+		pieces.addBytes(&data[1013], data.size() - 1013);
+		CPPUNIT_ASSERT_EQUAL( whole.getSum(), pieces.getSum() );
+		CPPUNIT_ASSERT_EQUAL( byteLoopCrc(data, 0, data.size()), whole.getSum() );
+	}
+
+	void test_throughput() {
+		const size_t size = 32 * 1024 * 1024;
+		std::vector<unsigned char> data;
+		fillData(data, size);
+
+		Chrono chrono;
+		chrono.start();
+		uint32 byteLoopResult = byteLoopCrc(data, 0, size);
+		int64 byteLoopMillis = chrono.getMillis();
+
+		chrono.start();
+		Checksum checksum;
+		uint32 result = checksum.addBytes(&data[0], size);
+		int64 sliceMillis = chrono.getMillis();
+
+		CPPUNIT_ASSERT_EQUAL( byteLoopResult, result );
+
+		double megaBytes = size / (1024.0 * 1024.0);
+		printf("\ncrc32 byte loop: %.1f MB/s, slicing-by-8: %.1f MB/s\n",
+			megaBytes * 1000.0 / max((int64) 1, byteLoopMillis),
+			megaBytes * 1000.0 / max((int64) 1, sliceMillis));
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( ChecksumTest );
@@ -0,0 +1,189 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cstdio>
+#include <string>
+#include "file_crc_index.h"
+#include "conversion.h"
+
+using namespace Shared::Util;
+
+//
+// Tests for the persistent file crc index
+//
+class FileCRCIndexTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( FileCRCIndexTest );
+
+	CPPUNIT_TEST( test_lookup_needs_same_stamp );
+	CPPUNIT_TEST( test_entries_survive_reopen );
+	CPPUNIT_TEST( test_grows_past_initial_size );
+	CPPUNIT_TEST( test_damaged_file_starts_over );
+	CPPUNIT_TEST( test_recent_changes_are_not_stored );
+#ifndef WIN32
+	// windows only reports whole seconds
+	CPPUNIT_TEST( test_file_stamp_changes_within_a_second );
+#endif
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	string indexFile;
+
+	FileStamp makeStamp(uint64 size, int64 modifiedTime, uint64 inode, int64 changeTime = 0) {
+		FileStamp stamp;
+		stamp.size = size;
+		stamp.modifiedTime = modifiedTime;
+		stamp.changeTime = changeTime;
+		stamp.inode = inode;
+		return stamp;
+	}
+
+public:
+
+	void setUp() {
+		indexFile = "file_crc_index_test.bin";
+		remove(indexFile.c_str());
+	}
+
+	void tearDown() {
+		remove(indexFile.c_str());
+	}
+
+	void test_lookup_needs_same_stamp() {
+		FileCRCIndex index;
+		CPPUNIT_ASSERT( index.open(indexFile) );
+
+		uint32 crc = 0;
+		FileStamp stamp = makeStamp(100, 1500000000, 42);
+		CPPUNIT_ASSERT( index.lookup("data/a.xml", stamp, crc) == false );
+
+		index.store("data/a.xml", stamp, 0x12345678);
+		CPPUNIT_ASSERT( index.lookup("data/a.xml", stamp, crc) );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 0x12345678, crc );
+
+		// any change of the file invalidates the entry
+		CPPUNIT_ASSERT( index.lookup("data/a.xml", makeStamp(101, 1500000000, 42), crc) == false );
+		CPPUNIT_ASSERT( index.lookup("data/a.xml", makeStamp(100, 1500000001, 42), crc) == false );
+		CPPUNIT_ASSERT( index.lookup("data/a.xml", makeStamp(100, 1500000000, 43), crc) == false );
+		CPPUNIT_ASSERT( index.lookup("data/a.xml", makeStamp(100, 1500000000, 42, 1), crc) == false );
+		CPPUNIT_ASSERT( index.lookup("data/b.xml", stamp, crc) == false );
+
+		// storing again replaces the entry
+		FileStamp newStamp = makeStamp(120, 1500000100, 42);
+		index.store("data/a.xml", newStamp, 0x9abcdef0);
+		CPPUNIT_ASSERT( index.lookup("data/a.xml", newStamp, crc) );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 0x9abcdef0, crc );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 1, index.getEntryCount() );
+	}
+
+	void test_entries_survive_reopen() {
+		FileStamp stamp = makeStamp(7, 1500000000, 9);
+		{
+			FileCRCIndex index;
+			CPPUNIT_ASSERT( index.open(indexFile) );
+			index.store("techs/unit.g3d", stamp, 77);
+		}
+
+		FileCRCIndex index;
+		CPPUNIT_ASSERT( index.open(indexFile) );
+		uint32 crc = 0;
+		CPPUNIT_ASSERT( index.lookup("techs/unit.g3d", stamp, crc) );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 77, crc );
+	}
+
+	void test_grows_past_initial_size() {
+		const uint32 fileCount = FileCRCIndex::initialSlotCount * 2;
+		{
+			FileCRCIndex index;
+			CPPUNIT_ASSERT( index.open(indexFile) );
+			for (uint32 i = 0; i < fileCount; ++i) {
+				index.store("file_" + uIntToStr(i), makeStamp(i, 1500000000, i), i * 3);
+			}
+			CPPUNIT_ASSERT_EQUAL( fileCount, index.getEntryCount() );
+		}
+
+		FileCRCIndex index;
+		CPPUNIT_ASSERT( index.open(indexFile) );
+		for (uint32 i = 0; i < fileCount; ++i) {
+			uint32 crc = 0;
+			CPPUNIT_ASSERT( index.lookup("file_" + uIntToStr(i), makeStamp(i, 1500000000, i), crc) );
+			CPPUNIT_ASSERT_EQUAL( i * 3, crc );
+		}
+	}
+
+	void test_damaged_file_starts_over() {
+		FILE *fp = fopen(indexFile.c_str(), "wb");
+		CPPUNIT_ASSERT( fp != NULL );
+		fputs("not an index", fp);
+		fclose(fp);
+
+		FileCRCIndex index;
+		CPPUNIT_ASSERT( index.open(indexFile) );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 0, index.getEntryCount() );
+
+		uint32 crc = 0;
+		FileStamp stamp = makeStamp(1, 1, 1);
+		index.store("x", stamp, 5);
+		CPPUNIT_ASSERT( index.lookup("x", stamp, crc) );
+	}
+
+	void test_recent_changes_are_not_stored() {
+		FileCRCIndex index;
+		CPPUNIT_ASSERT( index.open(indexFile) );
+
+		const int64 now = 1500000000000000000LL;
+		uint32 crc = 0;
+		FileStamp recentWrite = makeStamp(10, now - 1000, 3, now - 5000000000LL);
+		index.store("recent_write", recentWrite, 1, now);
+		CPPUNIT_ASSERT( index.lookup("recent_write", recentWrite, crc) == false );
+
+		FileStamp recentChange = makeStamp(10, now - 5000000000LL, 4, now - 1000);
+		index.store("recent_change", recentChange, 2, now);
+		CPPUNIT_ASSERT( index.lookup("recent_change", recentChange, crc) == false );
+
+		FileStamp settled = makeStamp(10, now - 5000000000LL, 5, now - 5000000000LL);
+		index.store("settled", settled, 3, now);
+		CPPUNIT_ASSERT( index.lookup("settled", settled, crc) );
+		CPPUNIT_ASSERT_EQUAL( (uint32) 3, crc );
+	}
+
+	void test_file_stamp_changes_within_a_second() {
+		string file = "file_crc_index_test.dat";
+		FILE *fp = fopen(file.c_str(), "wb");
+		CPPUNIT_ASSERT( fp != NULL );
+		fputs("first", fp);
+		fclose(fp);
+		FileStamp before;
+		CPPUNIT_ASSERT( FileCRCIndex::getFileStamp(file, before) );
+
+		// rewrite with the same size until the timestamp moves, which
+		// takes one filesystem tick and not a whole second
+		FileStamp after = before;
+		for (int attempt = 0; attempt < 1000 &&
+			after.modifiedTime == before.modifiedTime && after.changeTime == before.changeTime; ++attempt) {
+			fp = fopen(file.c_str(), "wb");
+			CPPUNIT_ASSERT( fp != NULL );
+			fputs("other", fp);
+			fclose(fp);
+			CPPUNIT_ASSERT( FileCRCIndex::getFileStamp(file, after) );
+		}
+		remove(file.c_str());
+
+		CPPUNIT_ASSERT_EQUAL( before.size, after.size );
+		CPPUNIT_ASSERT( after.modifiedTime != before.modifiedTime || after.changeTime != before.changeTime );
+		CPPUNIT_ASSERT( after.modifiedTime - before.modifiedTime < 1000000000LL );
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( FileCRCIndexTest );
@@ -0,0 +1,228 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cstdio>
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include "util.h"
+#include "platform_common.h"
+
+using namespace Shared::Util;
+using namespace Shared::PlatformCommon;
+
+//
+// Tests for the cached debug log switches of SystemFlags
+//
+class SystemFlagsTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( SystemFlagsTest );
+
+	CPPUNIT_TEST( test_enabled_bits_follow_setting );
+	CPPUNIT_TEST( test_stripped_types_stay_disabled );
+	CPPUNIT_TEST( test_node_loop_check_cost );
+	CPPUNIT_TEST( test_grid_search_check_cost );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	// the checks the path finder makes for every node it looks at
+	int runNodeLoop(int nodes, bool useMacro) {
+		int logged = 0;
+		for (int node = 0; node < nodes; ++node) {
+			for (int neighbour = 0; neighbour < 8; ++neighbour) {
+				if (useMacro == true) {
+					if (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+						&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true) {
+						logged++;
+					}
+				} else {
+					if (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true
+						&& SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true) {
+						logged++;
+					}
+				}
+			}
+		}
+		return logged;
+	}
+
+	inline bool isNodeLogEnabled(bool useMacro) {
+		if (useMacro == true) {
+			return (DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) == true
+				&& DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynchMax) == true);
+		}
+		return (SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled == true
+			&& SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynchMax).enabled == true);
+	}
+
+	// An A* search laid out like PathFinder's flat grid search: a heap of
+	// open cells, a per cell search stamp, eight neighbours with the
+	// diagonal corner rule and the same log checks, once before and after
+	// each expansion and once per neighbour. Returns the expanded count.
+	int runGridSearch(const std::vector<bool> &blocked, int size, int fromIndex, int toIndex,
+		std::vector<int> &cost, std::vector<int> &stamp, int searchStamp, bool useMacro, int &logged) {
+		typedef std::pair<int, int> OpenCell;
+		std::vector<OpenCell> openHeap;
+		int toX = toIndex % size;
+		int toY = toIndex / size;
+
+		cost[fromIndex] = 0;
+		stamp[fromIndex] = searchStamp;
+		openHeap.push_back(OpenCell(std::max(abs(fromIndex % size - toX), abs(fromIndex / size - toY)), fromIndex));
+		int expanded = 0;
+		while (openHeap.empty() == false) {
+			std::pop_heap(openHeap.begin(), openHeap.end(), std::greater<OpenCell>());
+			OpenCell current = openHeap.back();
+			openHeap.pop_back();
+			int index = current.second;
+			int x = index % size;
+			int y = index / size;
+			int estimate = std::max(abs(x - toX), abs(y - toY));
+			if (current.first != cost[index] + estimate) {
+				continue;
+			}
+			if (isNodeLogEnabled(useMacro) == true) {
+				logged++;
+			}
+			if (index == toIndex) {
+				break;
+			}
+			expanded++;
+
+			for (int i = -1; i <= 1; ++i) {
+				for (int j = -1; j <= 1; ++j) {
+					int nx = x + i;
+					int ny = y + j;
+					if ((i == 0 && j == 0) || nx < 0 || ny < 0 || nx >= size || ny >= size) {
+						continue;
+					}
+					if (isNodeLogEnabled(useMacro) == true) {
+						logged++;
+					}
+					int nextIndex = ny * size + nx;
+					if (blocked[nextIndex] == true ||
+						(i != 0 && j != 0 && (blocked[y * size + nx] == true || blocked[ny * size + x] == true))) {
+						continue;
+					}
+					int nextCost = cost[index] + 1;
+					if (stamp[nextIndex] != searchStamp || nextCost < cost[nextIndex]) {
+						stamp[nextIndex] = searchStamp;
+						cost[nextIndex] = nextCost;
+						int nextEstimate = std::max(abs(nx - toX), abs(ny - toY));
+						openHeap.push_back(OpenCell(nextCost + nextEstimate, nextIndex));
+						std::push_heap(openHeap.begin(), openHeap.end(), std::greater<OpenCell>());
+					}
+				}
+			}
+			if (isNodeLogEnabled(useMacro) == true) {
+				logged++;
+			}
+		}
+		return expanded;
+	}
+
+	// every search on the same map, so both runs do identical work
+	int64 runGridSearches(bool useMacro, int &expanded, int &logged) {
+		const int size = 128;
+		const int searches = 200;
+		std::vector<bool> blocked(size * size, false);
+		unsigned int seed = 12345;
+		for (int index = 0; index < size * size; ++index) {
+			seed = seed * 1103515245 + 12345;
+			blocked[index] = ((seed >> 16) % 100 < 25);
+		}
+		std::vector<int> cost(size * size, 0);
+		std::vector<int> stamp(size * size, 0);
+
+		expanded = 0;
+		logged = 0;
+		Chrono chrono;
+		chrono.start();
+		for (int search = 0; search < searches; ++search) {
+			int fromIndex = (search % 16) * size / 16 * size + 1;
+			int toIndex = (size - 2) * size + size - 2 - (search % 16) * 4;
+			blocked[fromIndex] = false;
+			blocked[toIndex] = false;
+			expanded += runGridSearch(blocked, size, fromIndex, toIndex, cost, stamp, search + 1, useMacro, logged);
+		}
+		return chrono.getMillis();
+	}
+
+public:
+
+	void tearDown() {
+		SystemFlags::setDebugTypeEnabled(SystemFlags::debugUnitCommands, false);
+		SystemFlags::setDebugTypeEnabled(SystemFlags::debugWorldSynch, false);
+	}
+
+	void test_enabled_bits_follow_setting() {
+		SystemFlags::setDebugTypeEnabled(SystemFlags::debugUnitCommands, true);
+		CPPUNIT_ASSERT_EQUAL( true, DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands) );
+		CPPUNIT_ASSERT_EQUAL( true, SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled );
+		CPPUNIT_ASSERT_EQUAL( false, DEBUG_TYPE_ENABLED(SystemFlags::debugSound) );
+
+		SystemFlags::setDebugTypeEnabled(SystemFlags::debugUnitCommands, false);
+		CPPUNIT_ASSERT_EQUAL( false, DEBUG_TYPE_ENABLED(SystemFlags::debugUnitCommands) );
+		CPPUNIT_ASSERT_EQUAL( false, SystemFlags::getSystemSettingType(SystemFlags::debugUnitCommands).enabled );
+	}
+
+	void test_stripped_types_stay_disabled() {
+		SystemFlags::setDebugTypeEnabled(SystemFlags::debugWorldSynch, true);
+		bool compiled = SystemFlags::isDebugTypeCompiled(SystemFlags::debugWorldSynch);
+		CPPUNIT_ASSERT_EQUAL( compiled, DEBUG_TYPE_ENABLED(SystemFlags::debugWorldSynch) );
+		CPPUNIT_ASSERT_EQUAL( compiled, SystemFlags::getSystemSettingType(SystemFlags::debugWorldSynch).enabled );
+#ifdef STRIP_SIMULATION_DEBUG_LOG
+		CPPUNIT_ASSERT_EQUAL( false, compiled );
+		CPPUNIT_ASSERT_EQUAL( false, SystemFlags::isDebugTypeCompiled(SystemFlags::debugLUA) );
+		CPPUNIT_ASSERT_EQUAL( true, SystemFlags::isDebugTypeCompiled(SystemFlags::debugError) );
+#endif
+	}
+
+	void test_node_loop_check_cost() {
+		const int nodes = 2000000;
+
+		Chrono chrono;
+		chrono.start();
+		int lookupLogged = runNodeLoop(nodes, false);
+		int64 lookupMillis = chrono.getMillis();
+
+		chrono.start();
+		int macroLogged = runNodeLoop(nodes, true);
+		int64 macroMillis = chrono.getMillis();
+
+		CPPUNIT_ASSERT_EQUAL( lookupLogged, macroLogged );
+		printf("\n%d path finder nodes: map lookup checks %d msecs, cached bit checks %d msecs\n",
+			nodes, (int) lookupMillis, (int) macroMillis);
+	}
+
+	// whole searches, so the checks are weighed against the rest of the
+	// work a path search does per node
+	void test_grid_search_check_cost() {
+		int lookupExpanded = 0;
+		int lookupLogged = 0;
+		int64 lookupMillis = runGridSearches(false, lookupExpanded, lookupLogged);
+
+		int macroExpanded = 0;
+		int macroLogged = 0;
+		int64 macroMillis = runGridSearches(true, macroExpanded, macroLogged);
+
+		CPPUNIT_ASSERT( lookupExpanded > 0 );
+		CPPUNIT_ASSERT_EQUAL( lookupExpanded, macroExpanded );
+		CPPUNIT_ASSERT_EQUAL( lookupLogged, macroLogged );
+		printf("\n%d expanded grid search nodes: map lookup checks %d msecs, cached bit checks %d msecs\n",
+			lookupExpanded, (int) lookupMillis, (int) macroMillis);
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( SystemFlagsTest );
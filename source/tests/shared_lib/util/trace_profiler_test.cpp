@@ -0,0 +1,158 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "profiler.h"
+#include "platform_common.h"
+#include "conversion.h"
+
+using namespace Shared::Util;
+using namespace Shared::PlatformCommon;
+
+static int recordScopesThread(void *data) {
+	int scopeCount = *(int *) data;
+	TraceProfiler::setThreadName("trace_test \"worker\"");
+	for (int index = 0; index < scopeCount; ++index) {
+		TraceScope traceScope(TraceProfiler::internName("trace_test:worker_" + intToStr(index)));
+	}
+	return 0;
+}
+
+//
+// Tests for the per thread trace buffers and their Chrome trace export
+//
+class TraceProfilerTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( TraceProfilerTest );
+
+	CPPUNIT_TEST( test_scopes_of_two_threads );
+	CPPUNIT_TEST( test_ring_keeps_newest_events );
+	CPPUNIT_TEST( test_disabled_records_nothing );
+	CPPUNIT_TEST( test_scope_cost );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	int countOf(const string &text, const string &value) {
+		int result = 0;
+		for (size_t pos = text.find(value); pos != string::npos; pos = text.find(value, pos + value.size())) {
+			result++;
+		}
+		return result;
+	}
+
+	void runWorker(int scopeCount) {
+		SDL_Thread *thread = SDL_CreateThread(recordScopesThread, "recordScopesThread", &scopeCount);
+		CPPUNIT_ASSERT( thread != NULL );
+		SDL_WaitThread(thread, NULL);
+	}
+
+public:
+
+	void setUp() {
+		TraceProfiler::setEnabled(true);
+		TraceProfiler::reset();
+	}
+
+	void tearDown() {
+		TraceProfiler::setEnabled(false);
+		TraceProfiler::setThreadEventCount(32768);
+		TraceProfiler::reset();
+	}
+
+	void test_scopes_of_two_threads() {
+		TraceProfiler::setThreadName("trace_test_main");
+		{
+			TraceScope outerScope("trace_test:outer");
+			TraceScope innerScope("trace_test:inner");
+			SDL_Delay(2);
+		}
+		runWorker(3);
+
+		string trace = TraceProfiler::getChromeTrace();
+		CPPUNIT_ASSERT_EQUAL( (size_t) 0, trace.find("{\"traceEvents\":[") );
+		CPPUNIT_ASSERT( trace.find("\"displayTimeUnit\":\"ns\"") != string::npos );
+		CPPUNIT_ASSERT( trace.find("\"args\":{\"name\":\"trace_test_main\"}") != string::npos );
+		CPPUNIT_ASSERT( trace.find("\"args\":{\"name\":\"trace_test \\\"worker\\\"\"}") != string::npos );
+		CPPUNIT_ASSERT_EQUAL( 5, countOf(trace, "\"ph\":\"X\"") );
+		CPPUNIT_ASSERT_EQUAL( 1, countOf(trace, "\"name\":\"trace_test:outer\"") );
+		CPPUNIT_ASSERT_EQUAL( 1, countOf(trace, "\"name\":\"trace_test:worker_2\"") );
+
+		// the worker got a thread id of its own
+		size_t mainTid = trace.find("\"tid\"", trace.find("\"name\":\"trace_test:outer\""));
+		size_t workerTid = trace.find("\"tid\"", trace.find("\"name\":\"trace_test:worker_0\""));
+		CPPUNIT_ASSERT( trace.substr(mainTid, 10) != trace.substr(workerTid, 10) );
+
+		// the outer scope lasted the delay at least
+		size_t outerPos = trace.find("\"name\":\"trace_test:outer\"");
+		double outerDuration = atof(trace.c_str() + trace.find("\"dur\":", outerPos) + 6);
+		CPPUNIT_ASSERT( outerDuration >= 1000.0 );
+
+		// events are exported once, the ended worker is gone afterwards
+		string nextTrace = TraceProfiler::getChromeTrace();
+		CPPUNIT_ASSERT_EQUAL( 0, countOf(nextTrace, "\"ph\":\"X\"") );
+		CPPUNIT_ASSERT( nextTrace.find("trace_test \\\"worker\\\"") == string::npos );
+	}
+
+	void test_ring_keeps_newest_events() {
+		// applies to threads that start recording from now on
+		TraceProfiler::setThreadEventCount(16);
+		runWorker(40);
+
+		string trace = TraceProfiler::getChromeTrace();
+		CPPUNIT_ASSERT_EQUAL( 16, countOf(trace, "\"ph\":\"X\"") );
+		CPPUNIT_ASSERT_EQUAL( 0, countOf(trace, "\"name\":\"trace_test:worker_23\"") );
+		CPPUNIT_ASSERT_EQUAL( 1, countOf(trace, "\"name\":\"trace_test:worker_24\"") );
+		CPPUNIT_ASSERT_EQUAL( 1, countOf(trace, "\"name\":\"trace_test:worker_39\"") );
+	}
+
+	void test_disabled_records_nothing() {
+		TraceProfiler::setEnabled(false);
+		{
+			TraceScope traceScope("trace_test:disabled");
+		}
+		runWorker(3);
+		CPPUNIT_ASSERT_EQUAL( 0, countOf(TraceProfiler::getChromeTrace(), "\"ph\":\"X\"") );
+	}
+
+	void test_scope_cost() {
+		const int scopes = 1000000;
+		TraceProfiler::setEnabled(false);
+
+		Chrono chrono;
+		chrono.start();
+		for (int index = 0; index < scopes; ++index) {
+			TraceScope traceScope("trace_test:cost");
+		}
+		int64 disabledMillis = chrono.getMillis();
+
+		TraceProfiler::setEnabled(true);
+		chrono.start();
+		for (int index = 0; index < scopes; ++index) {
+			TraceScope traceScope("trace_test:cost");
+		}
+		int64 enabledMillis = chrono.getMillis();
+
+		chrono.start();
+		string trace = TraceProfiler::getChromeTrace();
+		int64 exportMillis = chrono.getMillis();
+
+		CPPUNIT_ASSERT_EQUAL( TraceProfiler::getThreadEventCount(), countOf(trace, "\"ph\":\"X\"") );
+		printf("\n%d trace scopes: disabled %d msecs, enabled %d msecs, export of %d events %d msecs\n",
+			scopes, (int) disabledMillis, (int) enabledMillis, TraceProfiler::getThreadEventCount(), (int) exportMillis);
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( TraceProfilerTest );
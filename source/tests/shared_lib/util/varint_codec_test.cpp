@@ -0,0 +1,137 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include "varint_codec.h"
+#include "platform_util.h"
+
+using namespace Shared::Util;
+using namespace Shared::Platform;
+
+//
+// Tests for the varint / delta codec used by the network command lists
+//
+class VarintCodecTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( VarintCodecTest );
+
+	CPPUNIT_TEST( test_unsigned_round_trip );
+	CPPUNIT_TEST( test_signed_round_trip );
+	CPPUNIT_TEST( test_small_values_stay_short );
+	CPPUNIT_TEST( test_changed_words_round_trip );
+	CPPUNIT_TEST_EXCEPTION( test_truncated_input_throws, megaglest_runtime_error );
+	CPPUNIT_TEST_EXCEPTION( test_invalid_changed_mask_throws, megaglest_runtime_error );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+public:
+
+	void test_unsigned_round_trip() {
+		const uint32 values[] = { 0, 1, 127, 128, 255, 16383, 16384, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF };
+		const int valueCount = sizeof(values) / sizeof(values[0]);
+
+		VarintWriter writer;
+		for (int index = 0; index < valueCount; ++index) {
+			writer.writeUInt32(values[index]);
+		}
+
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize());
+		for (int index = 0; index < valueCount; ++index) {
+			CPPUNIT_ASSERT_EQUAL( values[index], reader.readUInt32() );
+		}
+		CPPUNIT_ASSERT_EQUAL( true, reader.isAtEnd() );
+	}
+
+	void test_signed_round_trip() {
+		const int32 values[] = { 0, -1, 1, -64, 64, -65, 32767, -32768, 0x7FFFFFFF, (int32) 0x80000000 };
+		const int valueCount = sizeof(values) / sizeof(values[0]);
+
+		VarintWriter writer;
+		int32 previousValue = 0;
+		for (int index = 0; index < valueCount; ++index) {
+			writer.writeInt32(values[index]);
+			writer.writeDelta(values[index], previousValue);
+			previousValue = values[index];
+		}
+
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize());
+		previousValue = 0;
+		for (int index = 0; index < valueCount; ++index) {
+			CPPUNIT_ASSERT_EQUAL( values[index], reader.readInt32() );
+			previousValue = reader.readDelta(previousValue);
+			CPPUNIT_ASSERT_EQUAL( values[index], previousValue );
+		}
+		CPPUNIT_ASSERT_EQUAL( true, reader.isAtEnd() );
+	}
+
+	void test_small_values_stay_short() {
+		VarintWriter writer;
+		writer.writeInt32(-1);
+		writer.writeInt32(63);
+		writer.writeDelta(1005, 1000);
+		CPPUNIT_ASSERT_EQUAL( (uint32) 3, writer.getSize() );
+
+		writer.clear();
+		writer.writeUInt32(0xFFFFFFFF);
+		CPPUNIT_ASSERT_EQUAL( (uint32) 5, writer.getSize() );
+	}
+
+	void test_changed_words_round_trip() {
+		const int count = 10;
+		uint32 previous[count] = { 0 };
+		uint32 current[count] = { 0 };
+		for (int index = 0; index < count; ++index) {
+			previous[index] = 0xDEAD0000 + index;
+			current[index] = previous[index];
+		}
+		current[2] = 0x12345678;
+		current[9] = 0;
+
+		VarintWriter writer;
+		writer.writeChangedWords(current, previous, count);
+		writer.writeChangedWords(current, current, count);
+		// mask plus two changed words, then a lone empty mask
+		CPPUNIT_ASSERT_EQUAL( (uint32) (2 + 8 + 1), writer.getSize() );
+
+		uint32 decoded[count] = { 0 };
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize());
+		reader.readChangedWords(decoded, previous, count);
+		for (int index = 0; index < count; ++index) {
+			CPPUNIT_ASSERT_EQUAL( current[index], decoded[index] );
+		}
+		reader.readChangedWords(decoded, decoded, count);
+		for (int index = 0; index < count; ++index) {
+			CPPUNIT_ASSERT_EQUAL( current[index], decoded[index] );
+		}
+		CPPUNIT_ASSERT_EQUAL( true, reader.isAtEnd() );
+	}
+
+	void test_truncated_input_throws() {
+		VarintWriter writer;
+		writer.writeUInt32(0x12345678);
+
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize() - 1);
+		reader.readUInt32();
+	}
+
+	void test_invalid_changed_mask_throws() {
+		VarintWriter writer;
+		writer.writeUInt32(1 << 12);
+
+		uint32 values[10] = { 0 };
+		VarintReader reader(&writer.getBuffer()[0], writer.getSize());
+		reader.readChangedWords(values, values, 10);
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( VarintCodecTest );
@@ -0,0 +1,216 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <vector>
+#include "xml_parser.h"
+#include "conversion.h"
+#include "platform_common.h"
+#include "platform_util.h"
+
+using namespace Shared::Xml;
+using namespace Shared::Util;
+using namespace Shared::PlatformCommon;
+
+//
+// Tests for the arena backed trees of rapidxml loads
+//
+class XmlArenaTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( XmlArenaTest );
+
+	CPPUNIT_TEST( test_same_tree_as_heap_load );
+	CPPUNIT_TEST( test_arena_tree_can_change );
+	CPPUNIT_TEST( test_load_benchmark );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	vector<string> createdFiles;
+
+	void writeUnitFile(const string &file, int unitIndex) {
+		std::ofstream xmlFile(file.c_str());
+		xmlFile << "<?xml version=\"1.0\" standalone=\"no\"?>" << std::endl
+				<< "<unit>" << std::endl
+				<< "<parameters>" << std::endl
+				<< "<size value=\"" << (unitIndex % 3 + 1) << "\"/>" << std::endl
+				<< "<max-hp value=\"" << (unitIndex * 10 + 450) << "\" regeneration=\"0\"/>" << std::endl
+				<< "<armor-type value=\"leather\"/>" << std::endl
+				<< "<height value=\"2.5\"/>" << std::endl
+				<< "<image path=\"images/unit_" << unitIndex << "_portrait.bmp\"/>" << std::endl
+				<< "<light enabled=\"false\"/>" << std::endl
+				<< "<resource-requirements>" << std::endl
+				<< "<resource name=\"gold\" amount=\"" << (unitIndex + 75) << "\"/>" << std::endl
+				<< "<resource name=\"food\" amount=\"1\"/>" << std::endl
+				<< "</resource-requirements>" << std::endl
+				<< "</parameters>" << std::endl
+				<< "<skills>" << std::endl;
+		for (int skill = 0; skill < 8; ++skill) {
+			xmlFile << "<skill>" << std::endl
+					<< "<type value=\"move\"/>" << std::endl
+					<< "<name value=\"move_skill_" << skill << "\"/>" << std::endl
+					<< "<ep-cost value=\"0\"/>" << std::endl
+					<< "<speed value=\"" << (skill * 5 + 100) << "\"/>" << std::endl
+					<< "<anim-speed value=\"60\"/>" << std::endl
+					<< "<animation path=\"models/unit_walking_" << skill << ".g3d\"/>" << std::endl
+					<< "<sound enabled=\"true\" start-time=\"0\">" << std::endl
+					<< "<sound-file path=\"$COMMONDATAPATH/sounds/step" << skill << ".wav\"/>" << std::endl
+					<< "</sound>" << std::endl
+					<< "</skill>" << std::endl;
+		}
+		xmlFile << "</skills>" << std::endl
+				<< "<description>A unit loaded from {TECHTREEPATH}</description>" << std::endl
+				<< "</unit>" << std::endl;
+		xmlFile.close();
+		createdFiles.push_back(file);
+	}
+
+	std::map<string, string> getReplacementValues() {
+		std::map<string, string> mapTagReplacementValues;
+		mapTagReplacementValues["$COMMONDATAPATH"] = "techs/test/commondata";
+		mapTagReplacementValues["{TECHTREEPATH}"] = "techs/test/";
+		return mapTagReplacementValues;
+	}
+
+	void assertSameNode(const XmlNode *expected, const XmlNode *actual) {
+		CPPUNIT_ASSERT_EQUAL( expected->getName(), actual->getName() );
+		CPPUNIT_ASSERT_EQUAL( expected->getText(), actual->getText() );
+		CPPUNIT_ASSERT_EQUAL( expected->getAttributeCount(), actual->getAttributeCount() );
+		for (unsigned int index = 0; index < expected->getAttributeCount(); ++index) {
+			const XmlAttribute *expectedAttribute = expected->getAttribute(index);
+			const XmlAttribute *actualAttribute = actual->getAttribute(index);
+			CPPUNIT_ASSERT_EQUAL( expectedAttribute->getName(), actualAttribute->getName() );
+			CPPUNIT_ASSERT_EQUAL( expectedAttribute->getValue(), actualAttribute->getValue() );
+			// the prefix is only applied to values that were not replaced
+			CPPUNIT_ASSERT_EQUAL( expectedAttribute->getValue("data/", true), actualAttribute->getValue("data/", true) );
+		}
+		CPPUNIT_ASSERT_EQUAL( expected->getChildCount(), actual->getChildCount() );
+		for (unsigned int index = 0; index < expected->getChildCount(); ++index) {
+			assertSameNode(expected->getChild(index), actual->getChild(index));
+		}
+	}
+
+	void loadFiles(const vector<string> &files, bool useArena, const std::map<string, string> &mapTagReplacementValues) {
+		for (unsigned int index = 0; index < files.size(); ++index) {
+			XmlTree xmlTree;
+			xmlTree.setUseArena(useArena);
+			xmlTree.load(files[index], mapTagReplacementValues);
+		}
+	}
+
+public:
+
+	void tearDown() {
+		for (unsigned int index = 0; index < createdFiles.size(); ++index) {
+			remove(createdFiles[index].c_str());
+		}
+		createdFiles.clear();
+	}
+
+	void test_same_tree_as_heap_load() {
+		const string test_filename = "xml_arena_test_unit.xml";
+		writeUnitFile(test_filename, 7);
+
+		XmlTree heapTree;
+		heapTree.setUseArena(false);
+		heapTree.load(test_filename, getReplacementValues());
+		XmlTree arenaTree;
+		arenaTree.setUseArena(true);
+		arenaTree.load(test_filename, getReplacementValues(), false, true);
+
+		assertSameNode(heapTree.getRootNode(), arenaTree.getRootNode());
+
+		const XmlNode *soundFileNode = arenaTree.getRootNode()->getChild("skills")->getChild("skill", 2)->getChild("sound")->getChild("sound-file");
+		CPPUNIT_ASSERT_EQUAL( string("techs/test/commondata/sounds/step2.wav"), soundFileNode->getAttribute("path")->getValue("data/") );
+		CPPUNIT_ASSERT_EQUAL( string("A unit loaded from techs/test/"), arenaTree.getRootNode()->getChild("description")->getText() );
+		CPPUNIT_ASSERT_EQUAL( 520, arenaTree.getRootNode()->getChild("parameters")->getChild("max-hp")->getAttribute("value")->getIntValue() );
+		CPPUNIT_ASSERT_EQUAL( false, arenaTree.getRootNode()->getChild("parameters")->getChild("light")->getAttribute("enabled")->getBoolValue() );
+	}
+
+	void test_arena_tree_can_change() {
+		const string test_filename = "xml_arena_test_unit.xml";
+		writeUnitFile(test_filename, 3);
+
+		XmlTree arenaTree;
+		arenaTree.setUseArena(true);
+		arenaTree.load(test_filename, getReplacementValues());
+		XmlNode *rootNode = arenaTree.getRootNode();
+
+		XmlAttribute *sizeAttribute = rootNode->getChild("parameters")->getChild("size")->getAttribute("value");
+		CPPUNIT_ASSERT_EQUAL( 1, sizeAttribute->getIntValue() );
+		sizeAttribute->setValue("4");
+		CPPUNIT_ASSERT_EQUAL( 4, sizeAttribute->getIntValue() );
+
+		// heap nodes mixed into an arena tree
+		XmlNode *addedNode = rootNode->addChild("added", "text");
+		addedNode->addAttribute("name", "value", std::map<string, string>());
+		CPPUNIT_ASSERT_EQUAL( string("value"), rootNode->getChild("added")->getAttribute("name")->getValue() );
+
+		CPPUNIT_ASSERT_EQUAL( 1, rootNode->clearChild("skills") );
+		CPPUNIT_ASSERT_EQUAL( 1, rootNode->clearChild("added") );
+		CPPUNIT_ASSERT_EQUAL( false, rootNode->hasChild("skills") );
+		CPPUNIT_ASSERT_EQUAL( string("leather"), rootNode->getChild("parameters")->getChild("armor-type")->getAttribute("value")->getRestrictedValue() );
+	}
+
+	void test_load_benchmark() {
+		// the shipped tech trees if they are around, a generated faction otherwise
+		string techsPath = (getenv("ZETAGLEST_TECHS_PATH") != NULL ? getenv("ZETAGLEST_TECHS_PATH") : "");
+		const char *candidatePaths[] = { "../../data/glest_game/techs", "../data/glest_game/techs", "data/glest_game/techs" };
+		for (unsigned int index = 0; techsPath == "" && index < sizeof(candidatePaths) / sizeof(candidatePaths[0]); ++index) {
+			if (isdir(candidatePaths[index]) == true) {
+				techsPath = candidatePaths[index];
+			}
+		}
+
+		vector<string> files;
+		if (techsPath != "") {
+			endPathWithSlash(techsPath);
+			files = getFolderTreeContentsListRecursively(techsPath + "*.", ".xml");
+		}
+		if (files.empty() == true) {
+			techsPath = "";
+			for (int index = 0; index < 200; ++index) {
+				string file = "xml_arena_test_unit_" + intToStr(index) + ".xml";
+				writeUnitFile(file, index);
+				files.push_back(file);
+			}
+		}
+
+		std::map<string, string> mapTagReplacementValues = getReplacementValues();
+		// warm up the file cache
+		loadFiles(files, false, mapTagReplacementValues);
+
+		const int rounds = 3;
+		Chrono chrono;
+		chrono.start();
+		for (int round = 0; round < rounds; ++round) {
+			loadFiles(files, false, mapTagReplacementValues);
+		}
+		int64 heapMillis = chrono.getMillis();
+
+		chrono.start();
+		for (int round = 0; round < rounds; ++round) {
+			loadFiles(files, true, mapTagReplacementValues);
+		}
+		int64 arenaMillis = chrono.getMillis();
+
+		printf("\nloading %d xml files from %s %d times: heap %d msecs, arena %d msecs\n",
+			(int) files.size(), (techsPath != "" ? techsPath.c_str() : "a generated faction"), rounds,
+			(int) heapMillis, (int) arenaMillis);
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( XmlArenaTest );
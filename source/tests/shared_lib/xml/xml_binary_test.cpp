@@ -0,0 +1,175 @@
+// ==============================================================
+//	This file is part of ZetaGlest Unit Tests
+//
+//	Copyright (C) 2018  The ZetaGlest team <https://github.com/ZetaGlest>
+//
+//	You can redistribute this code and/or modify it under
+//	the terms of the GNU General Public License as published
+//	by the Free Software Foundation; either version 3 of the
+//	License, or (at your option) any later version
+// ==============================================================
+
+#include <cppunit/extensions/HelperMacros.h>
+#include <fstream>
+#include <vector>
+#include "xml_parser.h"
+#include "xml_binary.h"
+#include "conversion.h"
+#include "platform_util.h"
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+using namespace Shared::Xml;
+using namespace Shared::Util;
+using namespace Shared::Platform;
+
+//
+// Removes the file it was given once it goes out of scope
+//
+class BinaryTestFileRemover {
+private:
+	string file;
+
+public:
+	explicit BinaryTestFileRemover(const string &file) {
+		this->file = file;
+	}
+	~BinaryTestFileRemover() {
+#ifdef WIN32
+		_unlink(file.c_str());
+#else
+		unlink(file.c_str());
+#endif
+	}
+};
+
+//
+// Tests for the binary chunked format used by saved games
+//
+class XmlBinaryTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( XmlBinaryTest );
+
+	CPPUNIT_TEST( test_round_trip_compressed );
+	CPPUNIT_TEST( test_round_trip_stored );
+	CPPUNIT_TEST( test_round_trip_many_chunks );
+	CPPUNIT_TEST( test_detects_binary_file );
+	CPPUNIT_TEST_EXCEPTION( test_truncated_file_throws, megaglest_runtime_error );
+	CPPUNIT_TEST_EXCEPTION( test_unclosed_element_throws, megaglest_runtime_error );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+	void buildTestTree(XmlTree &xmlTree, int unitCount) {
+		std::map<string, string> mapTagReplacements;
+		xmlTree.init("zetaglest-saved-game");
+		XmlNode *rootNode = xmlTree.getRootNode();
+		rootNode->addAttribute("version", "v1.0.0", mapTagReplacements);
+
+		XmlNode *gameNode = rootNode->addChild("Game");
+		gameNode->addAttribute("tickCount", "12345", mapTagReplacements);
+		gameNode->addChild("Text", "some \"quoted\" <text> & more");
+		for (int index = 0; index < unitCount; ++index) {
+			XmlNode *unitNode = gameNode->addChild("Unit");
+			unitNode->addAttribute("id", intToStr(index), mapTagReplacements);
+			unitNode->addAttribute("pos", intToStr(index % 128) + "," + intToStr(index / 128), mapTagReplacements);
+			unitNode->addAttribute("hp", floatToStr(index * 0.5f, 6), mapTagReplacements);
+		}
+	}
+
+	void compareNodes(const XmlNode *expected, const XmlNode *actual) {
+		CPPUNIT_ASSERT_EQUAL( expected->getName(), actual->getName() );
+		CPPUNIT_ASSERT_EQUAL( expected->getText(), actual->getText() );
+		CPPUNIT_ASSERT_EQUAL( expected->getAttributeCount(), actual->getAttributeCount() );
+		for (unsigned int index = 0; index < expected->getAttributeCount(); ++index) {
+			CPPUNIT_ASSERT_EQUAL( expected->getAttribute(index)->getName(), actual->getAttribute(index)->getName() );
+			CPPUNIT_ASSERT_EQUAL( expected->getAttribute(index)->getValue(), actual->getAttribute(index)->getValue() );
+		}
+		CPPUNIT_ASSERT_EQUAL( expected->getChildCount(), actual->getChildCount() );
+		for (unsigned int index = 0; index < expected->getChildCount(); ++index) {
+			compareNodes(expected->getChild(index), actual->getChild(index));
+		}
+	}
+
+	void checkRoundTrip(const string &test_filename, int compressionLevel, int unitCount) {
+		BinaryTestFileRemover removeFile(test_filename);
+
+		XmlTree xmlTree;
+		buildTestTree(xmlTree, unitCount);
+		xmlTree.saveBinary(test_filename, compressionLevel);
+
+		XmlTree loadedTree;
+		loadedTree.load(test_filename, std::map<string, string>());
+		CPPUNIT_ASSERT( loadedTree.getRootNode() != NULL );
+		compareNodes(xmlTree.getRootNode(), loadedTree.getRootNode());
+	}
+
+public:
+
+	void test_round_trip_compressed() {
+		checkRoundTrip("xml_binary_test_compressed.xml", 1, 20);
+	}
+
+	void test_round_trip_stored() {
+		checkRoundTrip("xml_binary_test_stored.xml", 0, 20);
+	}
+
+	void test_round_trip_many_chunks() {
+		// enough units to need several chunks
+		checkRoundTrip("xml_binary_test_chunks.xml", 1, 20000);
+	}
+
+	void test_detects_binary_file() {
+		const string binary_filename = "xml_binary_test_detect.xml";
+		const string text_filename = "xml_binary_test_detect_text.xml";
+		BinaryTestFileRemover removeBinaryFile(binary_filename);
+		BinaryTestFileRemover removeTextFile(text_filename);
+
+		XmlTree xmlTree;
+		buildTestTree(xmlTree, 2);
+		xmlTree.saveBinary(binary_filename);
+		xmlTree.save(text_filename);
+
+		CPPUNIT_ASSERT_EQUAL( true, XmlBinaryReader::isBinaryFile(binary_filename) );
+		CPPUNIT_ASSERT_EQUAL( false, XmlBinaryReader::isBinaryFile(text_filename) );
+		CPPUNIT_ASSERT_EQUAL( false, XmlBinaryReader::isBinaryFile("xml_binary_test_missing.xml") );
+	}
+
+	void test_truncated_file_throws() {
+		const string test_filename = "xml_binary_test_truncated.xml";
+		BinaryTestFileRemover removeFile(test_filename);
+
+		XmlTree xmlTree;
+		buildTestTree(xmlTree, 200);
+		xmlTree.saveBinary(test_filename, 0);
+
+		std::vector<char> contents;
+		{
+			std::ifstream inFile(test_filename.c_str(), std::ios::binary);
+			contents.assign(std::istreambuf_iterator<char>(inFile), std::istreambuf_iterator<char>());
+		}
+		{
+			std::ofstream outFile(test_filename.c_str(), std::ios::binary | std::ios::trunc);
+			outFile.write(&contents[0], contents.size() / 2);
+		}
+
+		XmlTree loadedTree;
+		loadedTree.load(test_filename, std::map<string, string>());
+	}
+
+	void test_unclosed_element_throws() {
+		const string test_filename = "xml_binary_test_unclosed.xml";
+		BinaryTestFileRemover removeFile(test_filename);
+
+		XmlBinaryWriter writer(test_filename);
+		writer.beginElement("root");
+		writer.close();
+	}
+};
+
+// Test Suite Registrations
+CPPUNIT_TEST_SUITE_REGISTRATION( XmlBinaryTest );
@@ -317,6 +317,124 @@ public:
 };
 
 
+//
+// Tests for XmlPreloadCache
+//
+class XmlPreloadCacheTest : public CppUnit::TestFixture {
+	// Register the suite of tests for this fixture
+	CPPUNIT_TEST_SUITE( XmlPreloadCacheTest );
+
+	CPPUNIT_TEST( test_load_takes_preloaded_tree );
+	CPPUNIT_TEST( test_replacements_must_match );
+	CPPUNIT_TEST( test_disabled_cache_is_ignored );
+	CPPUNIT_TEST( test_loaded_file_is_not_preloaded );
+	CPPUNIT_TEST( test_broken_file_is_left_to_load );
+
+	CPPUNIT_TEST_SUITE_END();
+	// End of Fixture registration
+
+public:
+
+	void tearDown() {
+		XmlPreloadCache::disable();
+	}
+
+	void test_load_takes_preloaded_tree() {
+		const string test_filename = "xml_test_preload.xml";
+		createValidXMLTestFile(test_filename);
+		SafeRemoveTestFile deleteFile(test_filename);
+
+		XmlPreloadCache::enable();
+		CPPUNIT_ASSERT( XmlPreloadCache::preload(test_filename, std::map<string,string>()) );
+		// queued twice only parses once
+		CPPUNIT_ASSERT( XmlPreloadCache::preload(test_filename, std::map<string,string>()) == false );
+
+		XmlNode *preloadedNode = NULL;
+		{
+			XmlTree xmlInstance;
+			xmlInstance.load(test_filename, std::map<string,string>());
+			preloadedNode = xmlInstance.getRootNode();
+			CPPUNIT_ASSERT( preloadedNode != NULL );
+			CPPUNIT_ASSERT_EQUAL( string("menu"), preloadedNode->getName() );
+			CPPUNIT_ASSERT_EQUAL( true, preloadedNode->getAttribute("mytest-attribute")->getBoolValue() );
+		}
+		CPPUNIT_ASSERT_EQUAL( (uint32)1, XmlPreloadCache::getHits() );
+		CPPUNIT_ASSERT_EQUAL( (uint32)0, XmlPreloadCache::getMisses() );
+
+		// loading again parses the file as usual
+		XmlTree xmlInstance;
+		xmlInstance.load(test_filename, std::map<string,string>());
+		CPPUNIT_ASSERT( xmlInstance.getRootNode() != NULL );
+		CPPUNIT_ASSERT_EQUAL( string("menu"), xmlInstance.getRootNode()->getName() );
+		CPPUNIT_ASSERT_EQUAL( (uint32)1, XmlPreloadCache::getHits() );
+	}
+	void test_replacements_must_match() {
+		const string test_filename = "xml_test_preload.xml";
+		createValidXMLTestFile(test_filename);
+		SafeRemoveTestFile deleteFile(test_filename);
+
+		std::map<string,string> mapTagReplacementValues;
+		mapTagReplacementValues["$COMMONDATAPATH"] = "techs/test/commondata/";
+
+		XmlPreloadCache::enable();
+		CPPUNIT_ASSERT( XmlPreloadCache::preload(test_filename, mapTagReplacementValues) );
+
+		{
+			XmlTree xmlInstance;
+			xmlInstance.load(test_filename, std::map<string,string>());
+			CPPUNIT_ASSERT( xmlInstance.getRootNode() != NULL );
+		}
+		CPPUNIT_ASSERT_EQUAL( (uint32)0, XmlPreloadCache::getHits() );
+		CPPUNIT_ASSERT_EQUAL( (uint32)1, XmlPreloadCache::getMisses() );
+
+		XmlTree xmlInstance;
+		xmlInstance.load(test_filename, mapTagReplacementValues);
+		CPPUNIT_ASSERT( xmlInstance.getRootNode() != NULL );
+		CPPUNIT_ASSERT_EQUAL( (uint32)1, XmlPreloadCache::getHits() );
+	}
+	void test_disabled_cache_is_ignored() {
+		const string test_filename = "xml_test_preload.xml";
+		createValidXMLTestFile(test_filename);
+		SafeRemoveTestFile deleteFile(test_filename);
+
+		CPPUNIT_ASSERT( XmlPreloadCache::preload(test_filename, std::map<string,string>()) == false );
+
+		XmlPreloadCache::enable();
+		CPPUNIT_ASSERT( XmlPreloadCache::preload(test_filename, std::map<string,string>()) );
+		XmlPreloadCache::disable();
+		CPPUNIT_ASSERT( XmlPreloadCache::isEnabled() == false );
+		CPPUNIT_ASSERT_EQUAL( (XmlNode *)NULL, XmlPreloadCache::take(test_filename, std::map<string,string>()) );
+	}
+	void test_loaded_file_is_not_preloaded() {
+		const string test_filename = "xml_test_preload.xml";
+		createValidXMLTestFile(test_filename);
+		SafeRemoveTestFile deleteFile(test_filename);
+
+		XmlPreloadCache::enable();
+		XmlTree xmlInstance;
+		xmlInstance.load(test_filename, std::map<string,string>());
+		CPPUNIT_ASSERT( XmlPreloadCache::preload(test_filename, std::map<string,string>()) == false );
+	}
+	void test_broken_file_is_left_to_load() {
+		const string test_filename = "xml_test_preload_malformed.xml";
+		createMalformedXMLTestFile(test_filename);
+		SafeRemoveTestFile deleteFile(test_filename);
+
+		XmlPreloadCache::enable();
+		CPPUNIT_ASSERT( XmlPreloadCache::preload(test_filename, std::map<string,string>()) == false );
+
+		bool loadFailed = false;
+		try {
+			XmlTree xmlInstance;
+			xmlInstance.load(test_filename, std::map<string,string>());
+		} catch (const megaglest_runtime_error &) {
+			loadFailed = true;
+		}
+		CPPUNIT_ASSERT( loadFailed );
+	}
+};
+
+
 //
 // Tests for XmlNode
 //
@@ -624,6 +742,7 @@ public:
 
 CPPUNIT_TEST_SUITE_REGISTRATION( XmlIoRapidTest );
 CPPUNIT_TEST_SUITE_REGISTRATION( XmlTreeTest );
+CPPUNIT_TEST_SUITE_REGISTRATION( XmlPreloadCacheTest );
 CPPUNIT_TEST_SUITE_REGISTRATION( XmlNodeTest );
 
 #if defined(WANT_XERCES)